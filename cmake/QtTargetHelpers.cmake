@@ -327,9 +327,21 @@ function(qt_internal_export_modern_cmake_config_targets_file)
 endfunction()
 
 function(qt_create_tracepoints name tracePointsFile)
-    #### TODO
-    string(TOLOWER "${name}" name)
-
-    file(GENERATE OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/qt${name}_tracepoints_p.h" CONTENT
-        "#include <private/qtrace_p.h>")
+    #### TODO: lttng and etw
+    string(TOLOWER "${name}" provider_name)
+    set(header_file "${CMAKE_CURRENT_BINARY_DIR}/qt${provider_name}_tracepoints_p.h")
+
+    if(QT_FEATURE_ctf)
+        set(provider_file "${CMAKE_CURRENT_SOURCE_DIR}/${tracePointsFile}")
+        add_custom_command(OUTPUT "${header_file}"
+                           COMMAND ${QT_CMAKE_EXPORT_NAMESPACE}::tracegen ctf
+                                   "${provider_file}" "${header_file}"
+                           DEPENDS "${provider_file}" ${QT_CMAKE_EXPORT_NAMESPACE}::tracegen
+                           VERBATIM)
+        target_sources(${name} PRIVATE "${header_file}")
+        target_compile_definitions(${name} PRIVATE Q_TRACEPOINT)
+    else()
+        file(GENERATE OUTPUT "${header_file}" CONTENT
+            "#include <private/qtrace_p.h>")
+    endif()
 endfunction()
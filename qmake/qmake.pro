@@ -114,6 +114,7 @@ VPATH += \
 
 SOURCES += \
     qabstractfileengine.cpp \
+    qarenascope.cpp \
     qarraydata.cpp \
     qbitarray.cpp \
     qbuffer.cpp \
@@ -168,6 +169,8 @@ SOURCES += \
 
 HEADERS += \
     qabstractfileengine_p.h \
+    qarenascope.h \
+    qarenascope_p.h \
     qarraydata.h \
     qarraydataops.h \
     qarraydatapointer.h \
@@ -99,6 +99,7 @@
 
 static int system_has_forkfd(void);
 static int system_forkfd(int flags, pid_t *ppid, int *system);
+static int system_vforkfd(int flags, pid_t *ppid, int (*childFn)(void *), void *token, int *system);
 static int system_forkfd_wait(int ffd, struct forkfd_info *info, int ffdwoptions, struct rusage *rusage);
 
 static int disable_fork_fallback(void)
@@ -764,6 +765,45 @@ err_free:
     freeInfo(header, info);
     return -1;
 }
+
+/**
+ * @brief vforkfd returns a file descriptor representing a child process
+ * @return a file descriptor, or -1 in case of failure
+ *
+ * vforkfd() works like forkfd(), except that the child process does not
+ * return from this function. Instead, it runs @a childFn with @a token as its
+ * only argument and exits with the value returned from that function. This
+ * allows the implementation to start the child on a separate stack.
+ *
+ * In addition to the flags accepted by forkfd(), @a flags can contain:
+ *
+ * @li @c FFD_VFORK_SEMANTICS Request that the child share the memory of the
+ * parent process and that the parent be suspended until the child either
+ * calls one of the exec(3) functions or exits, like vfork(2) does. This avoids
+ * copying the page tables of the parent process, which is expensive for
+ * processes with a large address space. @a childFn must therefore restrict
+ * itself to async-signal-safe functions and must not modify any state the
+ * parent can observe. Signal handlers installed by the parent are reset to
+ * their default in the child before @a childFn is called. This flag is
+ * ignored if it is not supported or if @c FFD_USE_FORK is also present.
+ */
+int vforkfd(int flags, pid_t *ppid, int (*childFn)(void *), void *token)
+{
+    int fd;
+    if ((flags & FFD_USE_FORK) == 0) {
+        int system;
+        fd = system_vforkfd(flags, ppid, childFn, token, &system);
+        if (system)
+            return fd;
+    }
+
+    fd = forkfd(flags, ppid);
+    if (fd == FFD_CHILD_PROCESS) {
+        /* child process */
+        _exit(childFn(token));
+    }
+    return fd;
+}
 #endif // FORKFD_NO_FORKFD
 
 #if _POSIX_SPAWN > 0 && !defined(FORKFD_NO_SPAWNFD)
@@ -880,6 +920,16 @@ int system_forkfd(int flags, pid_t *ppid, int *system)
     return -1;
 }
 
+int system_vforkfd(int flags, pid_t *ppid, int (*childFn)(void *), void *token, int *system)
+{
+    (void)flags;
+    (void)ppid;
+    (void)childFn;
+    (void)token;
+    *system = 0;
+    return -1;
+}
+
 int system_forkfd_wait(int ffd, struct forkfd_info *info, int options, struct rusage *rusage)
 {
     (void)ffd;
@@ -85,6 +85,17 @@ int system_forkfd(int flags, pid_t *ppid, int *system)
     return ret;
 }
 
+int system_vforkfd(int flags, pid_t *ppid, int (*childFn)(void *), void *token, int *system)
+{
+    /* pdfork() has no vfork variant; let vforkfd() go through forkfd() */
+    (void)flags;
+    (void)ppid;
+    (void)childFn;
+    (void)token;
+    *system = 0;
+    return -1;
+}
+
 int system_forkfd_wait(int ffd, struct forkfd_info *info, int ffdoptions, struct rusage *rusage)
 {
     pid_t pid;
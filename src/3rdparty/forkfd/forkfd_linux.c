@@ -31,6 +31,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <pthread.h>
 #include <sched.h>
 #include <signal.h>
 #include <stdio.h>
@@ -169,6 +170,85 @@ int system_forkfd(int flags, pid_t *ppid, int *system)
     return pidfd;
 }
 
+struct vfork_child_args
+{
+    int (*childFn)(void *);
+    void *token;
+    sigset_t oldmask;
+};
+
+static int vfork_child_start(void *arg)
+{
+    /* Running on our own stack, but possibly in the parent's memory. Any
+     * handlers the parent installed would run here and could corrupt its
+     * state, so reset them before restoring the signal mask. */
+    const struct vfork_child_args *args = (const struct vfork_child_args *)arg;
+    struct sigaction dfl;
+    int sig;
+
+    memset(&dfl, 0, sizeof(dfl));
+    dfl.sa_handler = SIG_DFL;
+    for (sig = 1; sig < NSIG; ++sig) {
+        struct sigaction sa;
+        if (sigaction(sig, NULL, &sa) == 0 && sa.sa_handler != SIG_DFL && sa.sa_handler != SIG_IGN)
+            sigaction(sig, &dfl, NULL);
+    }
+    pthread_sigmask(SIG_SETMASK, &args->oldmask, NULL);
+    return args->childFn(args->token);
+}
+
+int system_vforkfd(int flags, pid_t *ppid, int (*childFn)(void *), void *token, int *system)
+{
+    __attribute__((aligned(64))) char childStack[16384];
+    struct vfork_child_args args;
+    sigset_t allsignals;
+    pid_t pid;
+    int pidfd;
+    int saved_errno;
+
+    int state = ffd_atomic_load(&system_forkfd_state, FFD_ATOMIC_RELAXED);
+    if (state == 0) {
+        state = detect_clone_pidfd_support();
+        ffd_atomic_store(&system_forkfd_state, state, FFD_ATOMIC_RELAXED);
+    }
+    if (state < 0) {
+        *system = 0;
+        return state;
+    }
+
+    *system = 1;
+    unsigned long cloneflags = CLONE_PIDFD;
+    if (flags & FFD_VFORK_SEMANTICS)
+        cloneflags |= CLONE_VFORK | CLONE_VM;
+
+    /* block all signals until the child has reset the handlers */
+    args.childFn = childFn;
+    args.token = token;
+    sigfillset(&allsignals);
+    pthread_sigmask(SIG_SETMASK, &allsignals, &args.oldmask);
+
+    /* the stack grows down on all architectures we support here */
+    pid = clone(vfork_child_start, childStack + sizeof(childStack), (int)cloneflags, &args,
+                &pidfd, NULL, NULL);
+    saved_errno = errno;
+    pthread_sigmask(SIG_SETMASK, &args.oldmask, NULL);
+    errno = saved_errno;
+
+    if (pid < 0)
+        return pid;
+    if (ppid)
+        *ppid = pid;
+
+    /* parent process */
+    if ((flags & FFD_CLOEXEC) == 0) {
+        /* pidfd defaults to O_CLOEXEC */
+        fcntl(pidfd, F_SETFD, 0);
+    }
+    if (flags & FFD_NONBLOCK)
+        fcntl(pidfd, F_SETFL, fcntl(pidfd, F_GETFL) | O_NONBLOCK);
+    return pidfd;
+}
+
 int system_forkfd_wait(int ffd, struct forkfd_info *info, int ffdoptions, struct rusage *rusage)
 {
     siginfo_t si;
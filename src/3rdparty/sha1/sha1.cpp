@@ -42,6 +42,9 @@
   Copyright (C) Dominik Reichl <dominik.reichl@t-online.de>
 */
 #include <QtCore/qendian.h>
+#ifndef QT_BOOTSTRAPPED
+#  include <QtCore/private/qsimd_p.h>
+#endif
 
 #ifdef Q_CC_MSVC
 #  include <stdlib.h>
@@ -190,6 +193,84 @@ static inline void sha1ProcessChunk(Sha1State *state, const unsigned char *buffe
 #endif
 }
 
+#ifndef QT_BOOTSTRAPPED
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(SHA) && QT_COMPILER_SUPPORTS_HERE(SSSE3)
+#  define SHA1_SHANI
+
+// Four rounds with the SHA extensions. Rounds 4n..4n+3 consume message
+// word group msg[n % 4]; the schedule for group n + 1..n + 3 is advanced
+// while these rounds run.
+#  define SHA1_SHANI_ROUNDS(n, func, eIn, eOut) \
+    eIn = _mm_sha1nexte_epu32(eIn, msg[(n) % 4]); \
+    eOut = abcd; \
+    if ((n) >= 3 && (n) <= 18) \
+        msg[((n) + 1) % 4] = _mm_sha1msg2_epu32(msg[((n) + 1) % 4], msg[(n) % 4]); \
+    abcd = _mm_sha1rnds4_epu32(abcd, eIn, func); \
+    if ((n) >= 1 && (n) <= 16) \
+        msg[((n) + 3) % 4] = _mm_sha1msg1_epu32(msg[((n) + 3) % 4], msg[(n) % 4]); \
+    if ((n) >= 2 && (n) <= 17) \
+        msg[((n) + 2) % 4] = _mm_xor_si128(msg[((n) + 2) % 4], msg[(n) % 4]);
+
+QT_FUNCTION_TARGET(SHA) QT_FUNCTION_TARGET(SSSE3)
+static void sha1ProcessChunksShaNi(Sha1State *state, const unsigned char *data, qint64 chunks)
+{
+    const __m128i byteSwap = _mm_set_epi64x(Q_INT64_C(0x0001020304050607),
+                                            Q_INT64_C(0x08090a0b0c0d0e0f));
+
+    // h0..h3 are kept as one vector in a, b, c, d order from the high lane down
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state->h0)), 0x1b);
+    __m128i e0 = _mm_set_epi32(int(state->h4), 0, 0, 0);
+    __m128i e1;
+    __m128i msg[4];
+
+    for (; chunks > 0; --chunks, data += 64) {
+        const __m128i abcdSave = abcd;
+        const __m128i eSave = e0;
+
+        for (int i = 0; i < 4; ++i) {
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * i)),
+                                      byteSwap);
+        }
+
+        // rounds 0..3 add the initial e instead of deriving it
+        e0 = _mm_add_epi32(e0, msg[0]);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+        SHA1_SHANI_ROUNDS( 1, 0, e1, e0) SHA1_SHANI_ROUNDS( 2, 0, e0, e1)
+        SHA1_SHANI_ROUNDS( 3, 0, e1, e0) SHA1_SHANI_ROUNDS( 4, 0, e0, e1)
+        SHA1_SHANI_ROUNDS( 5, 1, e1, e0) SHA1_SHANI_ROUNDS( 6, 1, e0, e1)
+        SHA1_SHANI_ROUNDS( 7, 1, e1, e0) SHA1_SHANI_ROUNDS( 8, 1, e0, e1)
+        SHA1_SHANI_ROUNDS( 9, 1, e1, e0) SHA1_SHANI_ROUNDS(10, 2, e0, e1)
+        SHA1_SHANI_ROUNDS(11, 2, e1, e0) SHA1_SHANI_ROUNDS(12, 2, e0, e1)
+        SHA1_SHANI_ROUNDS(13, 2, e1, e0) SHA1_SHANI_ROUNDS(14, 2, e0, e1)
+        SHA1_SHANI_ROUNDS(15, 3, e1, e0) SHA1_SHANI_ROUNDS(16, 3, e0, e1)
+        SHA1_SHANI_ROUNDS(17, 3, e1, e0) SHA1_SHANI_ROUNDS(18, 3, e0, e1)
+        SHA1_SHANI_ROUNDS(19, 3, e1, e0)
+
+        e0 = _mm_sha1nexte_epu32(e0, eSave);
+        abcd = _mm_add_epi32(abcd, abcdSave);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&state->h0), _mm_shuffle_epi32(abcd, 0x1b));
+    state->h4 = quint32(_mm_cvtsi128_si32(_mm_shuffle_epi32(e0, 0xff)));
+}
+#  undef SHA1_SHANI_ROUNDS
+#endif
+#endif // QT_BOOTSTRAPPED
+
+static inline void sha1ProcessChunks(Sha1State *state, const unsigned char *data, qint64 chunks)
+{
+#ifdef SHA1_SHANI
+    if (qCpuHasFeature(SHA) && qCpuHasFeature(SSSE3)) {
+        sha1ProcessChunksShaNi(state, data, chunks);
+        return;
+    }
+#endif
+    for (; chunks > 0; --chunks, data += 64)
+        sha1ProcessChunk(state, data);
+}
+
 static inline void sha1InitState(Sha1State *state)
 {
     state->h0 = 0x67452301;
@@ -214,11 +295,13 @@ static inline void sha1Update(Sha1State *state, const unsigned char *data, qint6
     } else {
         qint64 i = static_cast<qint64>(64 - rest);
         memcpy(&state->buffer[rest], &data[0], static_cast<qint32>(i));
-        sha1ProcessChunk(state, state->buffer);
+        sha1ProcessChunks(state, state->buffer, 1);
 
         qint64 lastI = len - ((len + rest) & Q_INT64_C(63));
-        for( ; i < lastI; i += 64)
-            sha1ProcessChunk(state, &data[i]);
+        if (i < lastI) {
+            sha1ProcessChunks(state, &data[i], (lastI - i) / 64);
+            i = lastI;
+        }
 
         memcpy(&state->buffer[0], &data[i], len - i);
     }
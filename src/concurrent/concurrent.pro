@@ -15,7 +15,8 @@ SOURCES += \
         qtconcurrentmap.cpp \
         qtconcurrentrun.cpp \
         qtconcurrentthreadengine.cpp \
-        qtconcurrentiteratekernel.cpp
+        qtconcurrentiteratekernel.cpp \
+        qtconcurrenttokenize.cpp
 
 HEADERS += \
         qtconcurrent_global.h \
@@ -33,6 +34,7 @@ HEADERS += \
         qtconcurrentrunbase.h \
         qtconcurrentstoredfunctioncall.h \
         qtconcurrentthreadengine.h \
+        qtconcurrenttokenize.h \
         qtaskbuilder.h \
         qtconcurrenttask.h
 
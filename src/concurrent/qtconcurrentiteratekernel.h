@@ -203,7 +203,8 @@ public:
             if (this->isCanceled())
                 break;
 
-            const int currentBlockSize = blockSizeManager.blockSize();
+            const int currentBlockSize = fixedBlockSize > 0 ? fixedBlockSize
+                                                            : blockSizeManager.blockSize();
 
             if (currentIndex.loadRelaxed() >= iterationCount)
                 break;
@@ -293,6 +294,10 @@ public:
 
     bool progressReportingEnabled;
     QAtomicInt completed;
+
+    // If > 0, the range is split into blocks of this size instead of
+    // letting BlockSizeManager adapt the block size
+    int fixedBlockSize = 0;
 };
 
 } // namespace QtConcurrent
@@ -137,8 +137,17 @@
     \value OrderedReduce Reduction is done in the order of the
     original sequence.
     \value SequentialReduce Reduction is done sequentially: only one
-    thread will enter the reduce function at a time. (Parallel reduction
-    might be supported in a future version of Qt Concurrent.)
+    thread will enter the reduce function at a time.
+    \value ParallelReduce For random access sequences, the sequence is split
+    into a few blocks per thread and each block is reduced into its own
+    default-constructed partial result, without serializing the threads.
+    The partial results are then combined using the reduce function, so it
+    must also accept the result type as its second argument, must be
+    associative and commutative, and a default-constructed result must be
+    its identity. The reduce function may be called from several threads at
+    once, but never on the same result. This option was introduced in Qt 6.0.
+    If these requirements cannot be checked at compile time, or the sequence
+    is not random access, this option behaves like UnorderedReduce.
 */
 
 /*!
@@ -104,7 +104,9 @@ public:
                         ReduceFunctor _reduce, ReduceOptions reduceOptions)
         : IterateKernel<Iterator, ReducedResultType>(pool, begin, end), reducedResult(),
           map(_map), reduce(_reduce), reducer(pool, reduceOptions)
-    { }
+    {
+        partitionStatically(pool);
+    }
 
     MappedReducedKernel(QThreadPool *pool, Iterator begin, Iterator end, MapFunctor _map,
                         ReduceFunctor _reduce, ReducedResultType &&initialValue,
@@ -115,6 +117,26 @@ public:
           reduce(_reduce),
           reducer(pool, reduceOptions)
     {
+        partitionStatically(pool);
+    }
+
+    // With ParallelReduce, split random access ranges into a few blocks per
+    // thread, with boundaries on cache line multiples, and reduce each block
+    // into its own partial result without taking the reducer's lock.
+    void partitionStatically(QThreadPool *pool)
+    {
+        if (!reducer.reducesPartials() || !this->forIteration || this->iterationCount <= 0)
+            return;
+
+        using ValueType = typename std::iterator_traits<Iterator>::value_type;
+        constexpr int cacheLineSize = 64;
+        constexpr int itemsPerCacheLine = qMax(1, int(cacheLineSize / sizeof(ValueType)));
+        constexpr int blocksPerThread = 4;
+
+        const int blockCount = qMax(1, pool->maxThreadCount()) * blocksPerThread;
+        int blockSize = (this->iterationCount + blockCount - 1) / blockCount;
+        blockSize = (blockSize + itemsPerCacheLine - 1) / itemsPerCacheLine * itemsPerCacheLine;
+        this->fixedBlockSize = blockSize;
     }
 
     bool runIteration(Iterator it, int index, ReducedResultType *) override
@@ -130,6 +152,20 @@ public:
 
     bool runIterations(Iterator sequenceBeginIterator, int beginIndex, int endIndex, ReducedResultType *) override
     {
+        if constexpr (Reducer::canReducePartials()) {
+            if (reducer.reducesPartials()) {
+                ReducedResultType partial{};
+                Iterator it = sequenceBeginIterator;
+                std::advance(it, beginIndex);
+                for (int i = beginIndex; i < endIndex; ++i) {
+                    std::invoke(reduce, partial, std::invoke(map, *it));
+                    std::advance(it, 1);
+                }
+                reducer.addPartialResult(std::move(partial));
+                return false;
+            }
+        }
+
         IntermediateResults<IntermediateResultsType> results;
         results.begin = beginIndex;
         results.end = endIndex;
@@ -91,8 +91,8 @@ public:
 enum ReduceOption {
     UnorderedReduce = 0x1,
     OrderedReduce = 0x2,
-    SequentialReduce = 0x4
-    // ParallelReduce = 0x8
+    SequentialReduce = 0x4,
+    ParallelReduce = 0x8
 };
 Q_DECLARE_FLAGS(ReduceOptions, ReduceOption)
 #ifndef Q_CLANG_QDOC
@@ -111,9 +111,11 @@ class ReduceKernel
     const int threadCount;
     ResultsMap resultsMap;
 
+    QList<ReduceResultType> partialResults;
+
     bool canReduce(int begin) const
     {
-        return (((reduceOptions & UnorderedReduce)
+        return (((reduceOptions & (UnorderedReduce | ParallelReduce))
                  && progress == 0)
                 || ((reduceOptions & OrderedReduce)
                     && progress == begin));
@@ -156,7 +158,7 @@ public:
             return;
         }
 
-        if (reduceOptions & UnorderedReduce) {
+        if (reduceOptions & (UnorderedReduce | ParallelReduce)) {
             // UnorderedReduce
             progress = -1;
 
@@ -204,10 +206,40 @@ public:
         }
     }
 
+    // whether results may be reduced into per-block partial results, which
+    // are then combined with the reduce functor itself
+    static constexpr bool canReducePartials()
+    {
+        return std::is_default_constructible_v<ReduceResultType>
+                && std::is_invocable_v<ReduceFunctor &, ReduceResultType &, const ReduceResultType &>;
+    }
+
+    inline bool reducesPartials() const
+    {
+        return canReducePartials() && (reduceOptions & ParallelReduce);
+    }
+
+    void addPartialResult(ReduceResultType &&partial)
+    {
+        std::lock_guard<QMutex> locker(mutex);
+        partialResults.append(std::move(partial));
+    }
+
     // final reduction
     void finish(ReduceFunctor &reduce, ReduceResultType &r)
     {
         reduceResults(reduce, r, resultsMap);
+
+        if constexpr (canReducePartials()) {
+            // combine the partial results pairwise, in a tree
+            for (qsizetype step = 1; step < partialResults.size(); step *= 2) {
+                for (qsizetype i = 0; i + step < partialResults.size(); i += 2 * step)
+                    std::invoke(reduce, partialResults[i], std::as_const(partialResults[i + step]));
+            }
+            if (!partialResults.isEmpty())
+                std::invoke(reduce, r, std::as_const(partialResults.first()));
+            partialResults.clear();
+        }
     }
 
     inline bool shouldThrottle()
@@ -0,0 +1,250 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtConcurrent module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qtconcurrenttokenize.h"
+
+#if !defined(QT_NO_CONCURRENT) || defined(Q_CLANG_QDOC)
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \fn template <typename Functor> QFuture<void> QtConcurrent::tokenize(QThreadPool *pool, QStringView haystack, QStringView separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+
+    Splits \a haystack wherever \a separator occurs and calls \a function
+    once for each token. The tokens are exactly those that
+    qTokenize(\a haystack, \a separator, \a sb, \a cs) yields, but the work
+    is shared by the threads taken from the QThreadPool \a pool: \a haystack
+    is first divided into partitions that end at occurrences of
+    \a separator, and each partition is then tokenized sequentially in one
+    thread.
+
+    The tokens of one partition are passed to \a function in order, but
+    calls for different partitions run concurrently and in no particular
+    order, so \a function must be safe to call from several threads at
+    once. Neither the tokens nor a list of them is ever copied: \a function
+    receives views into \a haystack, which, like \a separator, must stay
+    valid until the returned future has finished.
+
+    If \a separator is empty, or if it could occur at overlapping positions
+    (that is, it begins with one of its own suffixes, like \c{"aa"}), the
+    whole of \a haystack is tokenized in a single thread.
+
+    \sa blockingTokenize(), partitionAtSeparators(), qTokenize(), {Concurrent Map and Map-Reduce}
+*/
+
+/*!
+    \fn template <typename Functor> QFuture<void> QtConcurrent::tokenize(QThreadPool *pool, QStringView haystack, QChar separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+    \overload
+
+    Splits \a haystack wherever the character \a separator occurs and calls
+    \a function once for each token, from threads taken from the QThreadPool
+    \a pool. \a sb and \a cs have the same meaning as for qTokenize().
+*/
+
+/*!
+    \fn template <typename Functor> QFuture<void> QtConcurrent::tokenize(QStringView haystack, QStringView separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+    \overload
+
+    Splits \a haystack wherever \a separator occurs and calls \a function
+    once for each token, from threads taken from the global QThreadPool.
+    \a sb and \a cs have the same meaning as for qTokenize().
+*/
+
+/*!
+    \fn template <typename Functor> QFuture<void> QtConcurrent::tokenize(QStringView haystack, QChar separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+    \overload
+
+    Splits \a haystack wherever the character \a separator occurs and calls
+    \a function once for each token, from threads taken from the global
+    QThreadPool. \a sb and \a cs have the same meaning as for qTokenize().
+*/
+
+/*!
+    \fn template <typename Functor> void QtConcurrent::blockingTokenize(QThreadPool *pool, QStringView haystack, QStringView separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+
+    Splits \a haystack wherever \a separator occurs and calls \a function
+    once for each token, from threads taken from the QThreadPool \a pool.
+    \a sb and \a cs have the same meaning as for qTokenize().
+
+    \note This function will block until all tokens have been processed.
+
+    \sa tokenize()
+*/
+
+/*!
+    \fn template <typename Functor> void QtConcurrent::blockingTokenize(QThreadPool *pool, QStringView haystack, QChar separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+    \overload
+
+    Splits \a haystack wherever the character \a separator occurs and calls
+    \a function once for each token, from threads taken from the QThreadPool
+    \a pool.
+
+    \note This function will block until all tokens have been processed.
+*/
+
+/*!
+    \fn template <typename Functor> void QtConcurrent::blockingTokenize(QStringView haystack, QStringView separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+    \overload
+
+    Splits \a haystack wherever \a separator occurs and calls \a function
+    once for each token, from threads taken from the global QThreadPool.
+
+    \note This function will block until all tokens have been processed.
+*/
+
+/*!
+    \fn template <typename Functor> void QtConcurrent::blockingTokenize(QStringView haystack, QChar separator, Functor function, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+    \since 6.0
+    \overload
+
+    Splits \a haystack wherever the character \a separator occurs and calls
+    \a function once for each token, from threads taken from the global
+    QThreadPool.
+
+    \note This function will block until all tokens have been processed.
+*/
+
+namespace {
+enum {
+    // Don't bother handing out less than this many characters to a thread.
+    MinimumPartitionSize = 16 * 1024,
+    // Have some more partitions than threads, so that the threads that are
+    // done early can help out with the rest.
+    PartitionsPerThread = 4
+};
+
+// Could \a separator match at overlapping positions? If it could, an
+// occurrence found by searching from the middle of the haystack need not
+// be one that sequential tokenizing would find.
+bool mayOverlap(QStringView separator, Qt::CaseSensitivity cs)
+{
+    for (qsizetype n = 1; n < separator.size(); ++n) {
+        if (separator.first(n).compare(separator.last(n), cs) == 0)
+            return true;
+    }
+    return false;
+}
+
+template <typename Find>
+QList<QStringView> partitionImpl(QStringView haystack, Find findSeparator, qsizetype separatorSize,
+                                 qsizetype partitionCount)
+{
+    QList<QStringView> partitions;
+    partitions.reserve(partitionCount);
+    const qsizetype step = haystack.size() / partitionCount;
+    qsizetype start = 0;
+    for (qsizetype i = 1; i < partitionCount; ++i) {
+        const qsizetype pos = findSeparator(qMax(start, i * step));
+        if (pos < 0)
+            break;
+        partitions.append(haystack.sliced(start, pos - start));
+        start = pos + separatorSize;
+    }
+    partitions.append(haystack.sliced(start));
+    return partitions;
+}
+} // unnamed namespace
+
+/*!
+    \since 6.0
+
+    Divides \a haystack into at most \a partitionCount partitions of about
+    the same size, each of which ends before an occurrence of \a separator,
+    and returns them. The separators between the partitions are not part of
+    any partition.
+
+    Tokenizing each of the partitions using qTokenize() with \a separator
+    and the case sensitivity \a cs, and concatenating the results, yields the
+    same tokens as tokenizing all of \a haystack. This makes the partitions
+    suitable for being tokenized in parallel. If \a separator is empty or
+    could occur at overlapping positions, a list containing only
+    \a haystack is returned.
+
+    \sa tokenize()
+*/
+QList<QStringView> QtConcurrent::partitionAtSeparators(QStringView haystack, QStringView separator,
+                                                       qsizetype partitionCount,
+                                                       Qt::CaseSensitivity cs)
+{
+    if (partitionCount <= 1 || separator.isEmpty() || mayOverlap(separator, cs))
+        return { haystack };
+    const auto find = [=](qsizetype from) { return haystack.indexOf(separator, from, cs); };
+    return partitionImpl(haystack, find, separator.size(), partitionCount);
+}
+
+/*!
+    \since 6.0
+    \overload
+
+    Divides \a haystack into at most \a partitionCount partitions of about
+    the same size, each of which ends before an occurrence of the character
+    \a separator, using the case sensitivity \a cs.
+*/
+QList<QStringView> QtConcurrent::partitionAtSeparators(QStringView haystack, QChar separator,
+                                                       qsizetype partitionCount,
+                                                       Qt::CaseSensitivity cs)
+{
+    if (partitionCount <= 1)
+        return { haystack };
+    const auto find = [=](qsizetype from) { return haystack.indexOf(separator, from, cs); };
+    return partitionImpl(haystack, find, 1, partitionCount);
+}
+
+/*!
+    \internal
+
+    Returns the number of partitions that tokenize() divides \a haystack into
+    when running on \a pool.
+*/
+qsizetype QtPrivate::tokenizePartitionCount(QThreadPool *pool, QStringView haystack)
+{
+    const qsizetype byThreads = qsizetype(pool->maxThreadCount()) * PartitionsPerThread;
+    return qBound(qsizetype(1), haystack.size() / MinimumPartitionSize, byThreads);
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_CONCURRENT
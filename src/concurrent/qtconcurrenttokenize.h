@@ -0,0 +1,171 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtConcurrent module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QTCONCURRENT_TOKENIZE_H
+#define QTCONCURRENT_TOKENIZE_H
+
+#include <QtConcurrent/qtconcurrent_global.h>
+
+#if !defined(QT_NO_CONCURRENT) || defined(Q_CLANG_QDOC)
+
+#include <QtConcurrent/qtconcurrentmapkernel.h>
+#include <QtCore/qstringtokenizer.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtConcurrent {
+
+Q_CONCURRENT_EXPORT QList<QStringView> partitionAtSeparators(QStringView haystack,
+                                                             QStringView separator,
+                                                             qsizetype partitionCount,
+                                                             Qt::CaseSensitivity cs = Qt::CaseSensitive);
+Q_CONCURRENT_EXPORT QList<QStringView> partitionAtSeparators(QStringView haystack,
+                                                             QChar separator,
+                                                             qsizetype partitionCount,
+                                                             Qt::CaseSensitivity cs = Qt::CaseSensitive);
+
+} // namespace QtConcurrent
+
+#ifndef Q_CLANG_QDOC
+namespace QtPrivate {
+
+Q_CONCURRENT_EXPORT qsizetype tokenizePartitionCount(QThreadPool *pool, QStringView haystack);
+
+template <typename Needle, typename Functor>
+QFuture<void> startTokenize(QThreadPool *pool, QStringView haystack, Needle separator,
+                            Functor functor, Qt::SplitBehavior sb, Qt::CaseSensitivity cs)
+{
+    const QList<QStringView> partitions =
+            QtConcurrent::partitionAtSeparators(haystack, separator,
+                                                tokenizePartitionCount(pool, haystack), cs);
+    auto tokenizePartition = [separator, functor, sb, cs](QStringView partition) {
+        for (QStringView token : qTokenize(partition, separator, sb, cs))
+            std::invoke(functor, token);
+    };
+    using Kernel = QtConcurrent::MapKernel<QList<QStringView>::const_iterator,
+                                           decltype(tokenizePartition)>;
+    using Holder = QtConcurrent::SequenceHolder1<QList<QStringView>, Kernel,
+                                                 decltype(tokenizePartition)>;
+    return QtConcurrent::startThreadEngine(new Holder(pool, partitions, tokenizePartition));
+}
+
+} // namespace QtPrivate
+#endif
+
+namespace QtConcurrent {
+
+template <typename Functor>
+QFuture<void> tokenize(QThreadPool *pool, QStringView haystack, QStringView separator,
+                       Functor functor, Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                       Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    return QtPrivate::startTokenize(pool, haystack, separator, functor, sb, cs);
+}
+
+template <typename Functor>
+QFuture<void> tokenize(QThreadPool *pool, QStringView haystack, QChar separator,
+                       Functor functor, Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                       Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    return QtPrivate::startTokenize(pool, haystack, separator, functor, sb, cs);
+}
+
+template <typename Functor>
+QFuture<void> tokenize(QStringView haystack, QStringView separator, Functor functor,
+                       Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                       Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    return QtPrivate::startTokenize(QThreadPool::globalInstance(), haystack, separator,
+                                    functor, sb, cs);
+}
+
+template <typename Functor>
+QFuture<void> tokenize(QStringView haystack, QChar separator, Functor functor,
+                       Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                       Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    return QtPrivate::startTokenize(QThreadPool::globalInstance(), haystack, separator,
+                                    functor, sb, cs);
+}
+
+template <typename Functor>
+void blockingTokenize(QThreadPool *pool, QStringView haystack, QStringView separator,
+                      Functor functor, Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                      Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    QFuture<void> future = QtPrivate::startTokenize(pool, haystack, separator, functor, sb, cs);
+    future.waitForFinished();
+}
+
+template <typename Functor>
+void blockingTokenize(QThreadPool *pool, QStringView haystack, QChar separator,
+                      Functor functor, Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                      Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    QFuture<void> future = QtPrivate::startTokenize(pool, haystack, separator, functor, sb, cs);
+    future.waitForFinished();
+}
+
+template <typename Functor>
+void blockingTokenize(QStringView haystack, QStringView separator, Functor functor,
+                      Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                      Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    QFuture<void> future = QtPrivate::startTokenize(QThreadPool::globalInstance(), haystack,
+                                                    separator, functor, sb, cs);
+    future.waitForFinished();
+}
+
+template <typename Functor>
+void blockingTokenize(QStringView haystack, QChar separator, Functor functor,
+                      Qt::SplitBehavior sb = Qt::KeepEmptyParts,
+                      Qt::CaseSensitivity cs = Qt::CaseSensitive)
+{
+    QFuture<void> future = QtPrivate::startTokenize(QThreadPool::globalInstance(), haystack,
+                                                    separator, functor, sb, cs);
+    future.waitForFinished();
+}
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_CONCURRENT
+
+#endif
@@ -603,8 +603,9 @@ void QAnimationTimer::updateAnimationsTime(qint64 delta)
         QScopedValueRollback<bool> guard(insideTick, true);
         for (currentAnimationIdx = 0; currentAnimationIdx < animations.count(); ++currentAnimationIdx) {
             QAbstractAnimation *animation = animations.at(currentAnimationIdx);
-            int elapsed = QAbstractAnimationPrivate::get(animation)->totalCurrentTime
-                          + (animation->direction() == QAbstractAnimation::Forward ? delta : -delta);
+            const QAbstractAnimationPrivate *d = QAbstractAnimationPrivate::get(animation);
+            int elapsed = d->totalCurrentTime
+                          + (d->direction == QAbstractAnimation::Forward ? delta : -delta);
             animation->setCurrentTime(elapsed);
         }
         currentAnimationIdx = 0;
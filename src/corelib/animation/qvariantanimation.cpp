@@ -185,7 +185,8 @@ template<> Q_INLINE_TEMPLATE QLineF _q_interpolate(const QLineF &f, const QLineF
     return QLineF( _q_interpolate(f.p1(), t.p1(), progress), _q_interpolate(f.p2(), t.p2(), progress));
 }
 
-QVariantAnimationPrivate::QVariantAnimationPrivate() : duration(250), interpolator(&defaultInterpolator)
+QVariantAnimationPrivate::QVariantAnimationPrivate()
+    : duration(250), linearEasing(true), interpolator(&defaultInterpolator)
 { }
 
 void QVariantAnimationPrivate::convertValues(int t)
@@ -230,7 +231,12 @@ void QVariantAnimationPrivate::recalculateCurrentInterval(bool force/*=false*/)
         return;
 
     const qreal endProgress = (direction == QAbstractAnimation::Forward) ? qreal(1) : qreal(0);
-    const qreal progress = easing.valueForProgress(((duration == 0) ? endProgress : qreal(currentTime) / qreal(duration)));
+    qreal progress = (duration == 0) ? endProgress : qreal(currentTime) / qreal(duration);
+    // This runs for every animation on every tick; a linear curve only clamps.
+    if (linearEasing)
+        progress = qBound(qreal(0), progress, qreal(1));
+    else
+        progress = easing.valueForProgress(progress);
 
     //0 and 1 are still the boundaries
     if (force || (currentInterval.start.first > 0 && progress < currentInterval.start.first)
@@ -387,6 +393,7 @@ void QVariantAnimation::setEasingCurve(const QEasingCurve &easing)
 {
     Q_D(QVariantAnimation);
     d->easing = easing;
+    d->linearEasing = (easing.type() == QEasingCurve::Linear);
     d->recalculateCurrentInterval();
 }
 
@@ -89,6 +89,7 @@ public:
 
     QEasingCurve easing;
     int duration;
+    bool linearEasing; // easing is the default QEasingCurve::Linear
     QVariantAnimation::KeyValues keyValues;
     QVariantAnimation::Interpolator interpolator;
 
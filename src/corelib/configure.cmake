@@ -201,6 +201,26 @@ eventfd_write(fd, value);
 }
 ")
 
+# epoll
+qt_config_compile_test(epoll
+    LABEL "epoll"
+    CODE
+"
+#include <sys/epoll.h>
+
+int main(int argc, char **argv)
+{
+    (void)argc; (void)argv;
+    /* BEGIN TEST: */
+struct epoll_event ev = {};
+int fd = epoll_create1(EPOLL_CLOEXEC);
+epoll_ctl(fd, EPOLL_CTL_ADD, 0, &ev);
+epoll_wait(fd, &ev, 1, 0);
+    /* END TEST: */
+    return 0;
+}
+")
+
 # futimens
 qt_config_compile_test(futimens
     LABEL "futimens()"
@@ -566,6 +586,10 @@ qt_feature("eventfd" PUBLIC
     CONDITION NOT WASM AND TEST_eventfd
 )
 qt_feature_definition("eventfd" "QT_NO_EVENTFD" NEGATE VALUE "1")
+qt_feature("epoll" PRIVATE
+    LABEL "epoll"
+    CONDITION LINUX AND TEST_epoll
+)
 qt_feature("futimens" PRIVATE
     LABEL "futimens()"
     CONDITION NOT WIN32 AND TEST_futimens
@@ -609,6 +633,11 @@ qt_feature("ipc_posix"
     CONDITION NOT TEST_ipc_sysv AND TEST_ipc_posix
 )
 qt_feature_definition("ipc_posix" "QT_POSIX_IPC")
+qt_feature("arraydata_cache" PRIVATE
+    LABEL "Per-thread cache of small string blocks"
+    PURPOSE "Recycles the memory of short QString and QByteArray data through a per-thread cache."
+    AUTODETECT OFF
+)
 qt_feature("journald" PRIVATE
     LABEL "journald"
     AUTODETECT OFF
@@ -926,14 +955,20 @@ qt_feature("lttng" PRIVATE
     AUTODETECT OFF
     CONDITION LINUX AND LTTNGUST_FOUND
     ENABLE INPUT_trace STREQUAL 'lttng' OR ( INPUT_trace STREQUAL 'yes' AND LINUX )
-    DISABLE INPUT_trace STREQUAL 'etw' OR INPUT_trace STREQUAL 'no'
+    DISABLE INPUT_trace STREQUAL 'etw' OR INPUT_trace STREQUAL 'ctf' OR INPUT_trace STREQUAL 'no'
 )
 qt_feature("etw" PRIVATE
     LABEL "ETW"
     AUTODETECT OFF
     CONDITION WIN32
     ENABLE INPUT_trace STREQUAL 'etw' OR ( INPUT_trace STREQUAL 'yes' AND WIN32 )
-    DISABLE INPUT_trace STREQUAL 'lttng' OR INPUT_trace STREQUAL 'no'
+    DISABLE INPUT_trace STREQUAL 'lttng' OR INPUT_trace STREQUAL 'ctf' OR INPUT_trace STREQUAL 'no'
+)
+qt_feature("ctf" PRIVATE
+    LABEL "CTF"
+    AUTODETECT OFF
+    ENABLE INPUT_trace STREQUAL 'ctf'
+    DISABLE INPUT_trace STREQUAL 'etw' OR INPUT_trace STREQUAL 'lttng' OR INPUT_trace STREQUAL 'no'
 )
 qt_feature("win32_system_libs"
     LABEL "Windows System Libraries"
@@ -956,9 +991,10 @@ qt_configure_add_summary_entry(ARGS "glib")
 qt_configure_add_summary_entry(ARGS "icu")
 qt_configure_add_summary_entry(ARGS "system-libb2")
 qt_configure_add_summary_entry(ARGS "mimetype-database")
+qt_configure_add_summary_entry(ARGS "arraydata_cache")
 qt_configure_add_summary_entry(
     TYPE "firstAvailableFeature"
-    ARGS "etw lttng"
+    ARGS "etw lttng ctf"
     MESSAGE "Tracing backend"
 )
 qt_configure_add_summary_section(NAME "Logging backends")
@@ -356,3 +356,19 @@
         result = reader.readStringChunk(buffer.data() + oldsize, size);
     } while (result.status() == QCborStreamReader::Ok);
 //! [29]
+
+//! [30]
+    QFile file("data.cbor");
+    file.open(QIODevice::ReadOnly);
+    const uchar *data = file.map(0, file.size());
+    QCborStreamReader reader(data, file.size());
+    ...
+    while (reader.isByteArray()) {
+        auto r = reader.readStringChunkView();
+        while (r.status == QCborStreamReader::Ok) {
+            process(r.data);    // points into the mapped file
+            r = reader.readStringChunkView();
+        }
+        ...
+    }
+//! [30]
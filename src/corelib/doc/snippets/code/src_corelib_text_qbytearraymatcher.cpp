@@ -55,3 +55,15 @@ static const auto matcher = qMakeStaticByteArrayMatcher("needle");
 //! [1]
 static const auto matcher = qMakeStaticByteArrayMatcher("needle");
 //! [1]
+
+//! [2]
+const QMultiByteArrayMatcher matcher({ "error", "fatal", "panic" });
+QByteArray message = ...;
+
+if (matcher.indexIn(message) != -1) {
+    // message contains at least one of the keywords
+}
+
+for (const QMultiByteArrayMatcher::Match &match : matcher.findAll(message))
+    qDebug() << match.position << matcher.patterns().at(match.patternIndex);
+//! [2]
@@ -355,4 +355,14 @@ QString wildcard = QRegularExpression::wildcardToRegularExpression("*.jpeg");
     ("", "day", "month", "year", "", "name")
 //! [33]
 
+{
+//! [34]
+QList<QStringView> lines = ...;
+QRegularExpression re("\\btimeout\\b", QRegularExpression::CaseInsensitiveOption);
+for (qsizetype index : re.matchingIndexes(lines)) {
+    // lines[index] mentions a timeout
+}
+//! [34]
+}
+
 }
@@ -63,6 +63,14 @@ Q_LOGGING_CATEGORY(driverUsb, "driver.usb")
 Q_LOGGING_CATEGORY(driverUsbEvents, "driver.usb.events", QtWarningMsg)
 //![5]
 
+//![min_level]
+// in a header
+Q_DECLARE_LOGGING_CATEGORY_WITH_MIN_LEVEL(driverUsbIrq, QtInfoMsg)
+
+// in one source file
+Q_LOGGING_CATEGORY_WITH_MIN_LEVEL(driverUsbIrq, QtInfoMsg, "driver.usb.irq")
+//![min_level]
+
 // Completely made up example, inspired by en.wikipedia.org/wiki/USB :)
 struct UsbEntry {
     int id;
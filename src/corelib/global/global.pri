@@ -114,6 +114,11 @@ qtConfig(slog2): \
 qtConfig(journald): \
     QMAKE_USE_PRIVATE += journald
 
+qtConfig(ctf) {
+    HEADERS += global/qctf_p.h
+    SOURCES += global/qctf.cpp
+}
+
 gcc:ltcg {
     versiontagging_compiler.commands = $$QMAKE_CXX -c $(CXXFLAGS) $(INCPATH)
 
@@ -0,0 +1,401 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qplatformdefs.h"
+#include "qctf_p.h"
+
+#include <qcoreapplication.h>
+#include <qdir.h>
+#include <qfile.h>
+#include <qglobalstatic.h>
+#include <qscopedvaluerollback.h>
+#include <qthread.h>
+#include <quuid.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+QBasicAtomicInt ctfTracingState = Q_BASIC_ATOMIC_INITIALIZER(-1);
+
+namespace {
+
+constexpr quint32 CtfMagic = 0xc1fc1fc1;
+constexpr qsizetype CtfThreadBufferSize = 64 * 1024;
+
+// Set while the calling thread is inside the tracer, so that whatever the
+// tracer itself does cannot fire tracepoints recursively.
+thread_local bool ctfInTracer = false;
+
+quint64 ctfTimestamp()
+{
+    using namespace std::chrono;
+    return quint64(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+// Collects the events of one thread and writes them, one buffer at a time,
+// to the stream file of that thread. The stream is a single CTF packet.
+struct QCtfSession;
+
+struct QCtfThreadBuffer
+{
+    explicit QCtfThreadBuffer(QCtfSession *session) : session(session) {}
+    ~QCtfThreadBuffer();
+
+    void append(quint32 id, quint64 timestamp, const QCtfPayload &payload);
+    void flush();
+    void close();
+    void write(const void *data, size_t size)
+    {
+        if (file)
+            fwrite(data, 1, size, file);
+    }
+
+    QCtfSession *session;
+    std::mutex mutex;               // also taken by QCtfSession when it finishes
+    int streamIndex = -1;
+    quint64 threadId = quint64(quintptr(QThread::currentThreadId()));
+    FILE *file = nullptr;
+    bool closed = false;
+    qsizetype used = 0;
+    char data[CtfThreadBufferSize];
+};
+
+struct QCtfSession
+{
+    QCtfSession();
+    ~QCtfSession();
+
+    int registerTracePoint(QCtfTracePoint *tracePoint);
+    void addBuffer(QCtfThreadBuffer *buffer);
+    void removeBuffer(QCtfThreadBuffer *buffer);
+    FILE *openStream(QCtfThreadBuffer *buffer);
+    void writeMetadata();
+
+    QString directory;
+    QUuid uuid;
+    qint64 clockOffsetNs = 0;       // system_clock minus steady_clock
+    std::mutex mutex;
+    std::vector<QCtfTracePoint *> tracePoints;
+    std::vector<QCtfThreadBuffer *> buffers;
+    int streamCount = 0;
+};
+
+Q_GLOBAL_STATIC(QCtfSession, ctfSession)
+
+QCtfThreadBuffer *ctfThreadBuffer(QCtfSession *session)
+{
+    static thread_local std::unique_ptr<QCtfThreadBuffer> buffer;
+    if (!buffer) {
+        buffer.reset(new QCtfThreadBuffer(session));
+        session->addBuffer(buffer.get());
+    }
+    return buffer.get();
+}
+
+QCtfThreadBuffer::~QCtfThreadBuffer()
+{
+    if (ctfSession.exists())
+        session->removeBuffer(this);
+}
+
+void QCtfThreadBuffer::append(quint32 id, quint64 timestamp, const QCtfPayload &payload)
+{
+    const qsizetype size = qsizetype(sizeof(id) + sizeof(timestamp)) + payload.size();
+    if (used + size > CtfThreadBufferSize)
+        flush();
+    if (size > CtfThreadBufferSize) {
+        write(&id, sizeof(id));
+        write(&timestamp, sizeof(timestamp));
+        write(payload.data(), size_t(payload.size()));
+        return;
+    }
+
+    char *out = data + used;
+    memcpy(out, &id, sizeof(id));
+    memcpy(out + sizeof(id), &timestamp, sizeof(timestamp));
+    memcpy(out + sizeof(id) + sizeof(timestamp), payload.data(), size_t(payload.size()));
+    used += size;
+}
+
+void QCtfThreadBuffer::flush()
+{
+    if (used == 0)
+        return;
+    if (!file)
+        file = session->openStream(this);
+    write(data, size_t(used));
+    used = 0;
+}
+
+void QCtfThreadBuffer::close()
+{
+    if (closed)
+        return;
+    flush();
+    if (file)
+        fclose(file);
+    file = nullptr;
+    closed = true;
+}
+
+QCtfSession::QCtfSession()
+{
+    directory = qEnvironmentVariable("QT_CTF_TRACE_DIR");
+    if (directory.isEmpty())
+        return;
+    if (!QDir().mkpath(directory)) {
+        fprintf(stderr, "Qt: cannot create the trace directory %s\n", qPrintable(directory));
+        directory.clear();
+        return;
+    }
+
+    using namespace std::chrono;
+    const qint64 systemNs = duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+    clockOffsetNs = systemNs - qint64(ctfTimestamp());
+    uuid = QUuid::createUuid();
+}
+
+QCtfSession::~QCtfSession()
+{
+    ctfTracingState.storeRelaxed(0);
+    if (directory.isEmpty())
+        return;
+
+    std::vector<QCtfThreadBuffer *> remaining;
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        remaining.swap(buffers);
+    }
+    for (QCtfThreadBuffer *buffer : remaining) {
+        const std::lock_guard<std::mutex> lock(buffer->mutex);
+        buffer->close();
+    }
+    writeMetadata();
+}
+
+int QCtfSession::registerTracePoint(QCtfTracePoint *tracePoint)
+{
+    const std::lock_guard<std::mutex> lock(mutex);
+    int id = tracePoint->id.loadRelaxed();
+    if (id < 0) {
+        id = int(tracePoints.size());
+        tracePoints.push_back(tracePoint);
+        tracePoint->id.storeRelease(id);
+    }
+    return id;
+}
+
+void QCtfSession::addBuffer(QCtfThreadBuffer *buffer)
+{
+    const std::lock_guard<std::mutex> lock(mutex);
+    buffers.push_back(buffer);
+}
+
+void QCtfSession::removeBuffer(QCtfThreadBuffer *buffer)
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        const auto it = std::find(buffers.begin(), buffers.end(), buffer);
+        if (it == buffers.end())
+            return;             // already closed by ~QCtfSession
+        buffers.erase(it);
+    }
+    const QScopedValueRollback<bool> guard(ctfInTracer, true);
+    const std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->close();
+}
+
+FILE *QCtfSession::openStream(QCtfThreadBuffer *buffer)
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        buffer->streamIndex = streamCount++;
+    }
+    const QString fileName = directory + QLatin1String("/stream_")
+            + QString::number(buffer->streamIndex);
+    FILE *file = QT_FOPEN(QFile::encodeName(fileName).constData(), "wb");
+    if (!file) {
+        fprintf(stderr, "Qt: cannot open the trace stream %s\n", qPrintable(fileName));
+        return nullptr;
+    }
+
+    // packet header and context, as declared in writeMetadata()
+    const QByteArray uuidBytes = uuid.toRfc4122();
+    const quint32 streamId = 0;
+    fwrite(&CtfMagic, 1, sizeof(CtfMagic), file);
+    fwrite(uuidBytes.constData(), 1, size_t(uuidBytes.size()), file);
+    fwrite(&streamId, 1, sizeof(streamId), file);
+    fwrite(&buffer->threadId, 1, sizeof(buffer->threadId), file);
+    return file;
+}
+
+void QCtfSession::writeMetadata()
+{
+    QByteArray metadata =
+        "/* CTF 1.8 */\n"
+        "\n"
+        "typealias integer { size = 8; align = 8; signed = false; } := uint8_t;\n"
+        "typealias integer { size = 32; align = 8; signed = false; } := uint32_t;\n"
+        "typealias integer { size = 32; align = 8; signed = true; } := int32_t;\n"
+        "typealias integer { size = 64; align = 8; signed = false; } := uint64_t;\n"
+        "\n"
+        "trace {\n"
+        "    major = 1;\n"
+        "    minor = 8;\n"
+        "    uuid = \"" + uuid.toByteArray(QUuid::WithoutBraces) + "\";\n"
+        "    byte_order = " + (QSysInfo::ByteOrder == QSysInfo::LittleEndian ? "le" : "be") + ";\n"
+        "    packet.header := struct {\n"
+        "        uint32_t magic;\n"
+        "        uint8_t uuid[16];\n"
+        "        uint32_t stream_id;\n"
+        "    };\n"
+        "};\n"
+        "\n"
+        "env {\n"
+        "    tracer_name = \"qt\";\n"
+        "    vpid = " + QByteArray::number(QCoreApplication::applicationPid()) + ";\n"
+        "};\n"
+        "\n"
+        "clock {\n"
+        "    name = monotonic;\n"
+        "    description = \"Monotonic clock\";\n"
+        "    freq = 1000000000;\n"
+        "    offset_s = " + QByteArray::number(clockOffsetNs / 1000000000) + ";\n"
+        "    offset = " + QByteArray::number(clockOffsetNs % 1000000000) + ";\n"
+        "};\n"
+        "\n"
+        "typealias integer { size = 64; align = 8; signed = false; map = clock.monotonic.value; }"
+        " := uint64_clock_monotonic_t;\n"
+        "\n"
+        "stream {\n"
+        "    id = 0;\n"
+        "    packet.context := struct {\n"
+        "        uint64_t thread_id;\n"
+        "    };\n"
+        "    event.header := struct {\n"
+        "        uint32_t id;\n"
+        "        uint64_clock_monotonic_t timestamp;\n"
+        "    };\n"
+        "};\n";
+
+    for (size_t i = 0; i < tracePoints.size(); ++i) {
+        const QCtfTracePoint *tracePoint = tracePoints[i];
+        metadata += "\nevent {\n"
+                    "    name = \"";
+        metadata += tracePoint->provider;
+        metadata += ':';
+        metadata += tracePoint->name;
+        metadata += "\";\n"
+                    "    id = " + QByteArray::number(quint64(i)) + ";\n"
+                    "    stream_id = 0;\n"
+                    "    fields := struct {\n";
+        tracePoint->describe(metadata);
+        metadata += "    };\n"
+                    "};\n";
+    }
+
+    const QString fileName = directory + QLatin1String("/metadata");
+    FILE *file = QT_FOPEN(QFile::encodeName(fileName).constData(), "wb");
+    if (!file) {
+        fprintf(stderr, "Qt: cannot write the trace metadata %s\n", qPrintable(fileName));
+        return;
+    }
+    fwrite(metadata.constData(), 1, size_t(metadata.size()), file);
+    fclose(file);
+}
+
+} // unnamed namespace
+
+bool ctfInitialize()
+{
+    if (ctfInTracer)
+        return false;
+    const QScopedValueRollback<bool> guard(ctfInTracer, true);
+    QCtfSession *session = ctfSession();
+    const bool tracing = session && !session->directory.isEmpty();
+    ctfTracingState.storeRelaxed(tracing ? 1 : 0);
+    return tracing;
+}
+
+void ctfWriteEvent(QCtfTracePoint *tracePoint, const QCtfPayload &payload)
+{
+    if (ctfInTracer)
+        return;
+    const QScopedValueRollback<bool> guard(ctfInTracer, true);
+    const quint64 timestamp = ctfTimestamp();
+
+    QCtfSession *session = ctfSession();
+    if (!session || session->directory.isEmpty())
+        return;
+    int id = tracePoint->id.loadAcquire();
+    if (id < 0)
+        id = session->registerTracePoint(tracePoint);
+
+    QCtfThreadBuffer *buffer = ctfThreadBuffer(session);
+    const std::lock_guard<std::mutex> lock(buffer->mutex);
+    if (!buffer->closed)
+        buffer->append(quint32(id), timestamp, payload);
+}
+
+void ctfDeclareInteger(QByteArray &out, int bits, bool isSigned, int base)
+{
+    out += "integer { size = " + QByteArray::number(bits) + "; align = 8; signed = "
+            + (isSigned ? "true" : "false") + "; base = " + QByteArray::number(base) + "; }";
+}
+
+void ctfDeclareFloat(QByteArray &out, int bits)
+{
+    if (bits == 32)
+        out += "floating_point { exp_dig = 8; mant_dig = 24; align = 8; }";
+    else
+        out += "floating_point { exp_dig = 11; mant_dig = 53; align = 8; }";
+}
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
@@ -0,0 +1,343 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QCTF_P_H
+#define QCTF_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+/*
+ * Runtime of the built-in CTF tracing backend (configure -trace ctf).
+ *
+ * tracegen generates, for each tracepoint, a QCtfTracePoint describing the
+ * event and inline wrappers that serialize the arguments into a QCtfPayload
+ * and hand it to ctfWriteEvent(). The events are timestamped and collected
+ * in per-thread buffers, which are written out as a Common Trace Format
+ * trace (one stream file per thread plus the metadata) into the directory
+ * named by the QT_CTF_TRACE_DIR environment variable. Tracing is off when
+ * that variable is not set, and then every tracepoint costs one relaxed
+ * load.
+ *
+ * Arguments are stored according to QCtfType: integers, enumerations,
+ * floating point numbers and pointers as is, char * and QString as UTF-8
+ * strings, QByteArray as a byte sequence, QUrl in its encoded form and
+ * QPoint, QSize and QRect as structures of their coordinates. Arguments of
+ * other types are left out of the event.
+ */
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qpoint.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qsize.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qurl.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <type_traits>
+
+QT_REQUIRE_CONFIG(ctf);
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+struct QCtfTracePoint
+{
+    const char *provider;
+    const char *name;
+    void (*describe)(QByteArray &fields);
+    QBasicAtomicInt id;             // assigned when the event first fires
+};
+
+class QCtfPayload
+{
+public:
+    void append(const void *data, qsizetype size)
+    { m_data.append(static_cast<const char *>(data), size); }
+    template <typename T>
+    void appendValue(T value) { append(&value, sizeof(value)); }
+
+    const char *data() const { return m_data.constData(); }
+    qsizetype size() const { return m_data.size(); }
+
+private:
+    QVarLengthArray<char, 256> m_data;
+};
+
+Q_CORE_EXPORT extern QBasicAtomicInt ctfTracingState;   // -1 until the first check
+Q_CORE_EXPORT bool ctfInitialize();
+Q_CORE_EXPORT void ctfWriteEvent(QCtfTracePoint *tracePoint, const QCtfPayload &payload);
+Q_CORE_EXPORT void ctfDeclareInteger(QByteArray &out, int bits, bool isSigned, int base = 10);
+Q_CORE_EXPORT void ctfDeclareFloat(QByteArray &out, int bits);
+
+inline bool ctfIsTracing()
+{
+    const int state = ctfTracingState.loadRelaxed();
+    return state > 0 || (state < 0 && ctfInitialize());
+}
+
+template <typename T, typename = void>
+struct QCtfType
+{
+    static constexpr bool isSupported = false;
+};
+
+template <typename T>
+struct QCtfType<T, std::enable_if_t<std::is_integral_v<T>>>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out)
+    { ctfDeclareInteger(out, sizeof(T) * 8, std::is_signed_v<T>); }
+    static void write(QCtfPayload &payload, T value) { payload.appendValue(value); }
+};
+
+template <typename T>
+struct QCtfType<T, std::enable_if_t<std::is_enum_v<T>>>
+{
+    using Underlying = std::underlying_type_t<T>;
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { QCtfType<Underlying>::declare(out); }
+    static void write(QCtfPayload &payload, T value)
+    { payload.appendValue(static_cast<Underlying>(value)); }
+};
+
+template <typename T>
+struct QCtfType<T, std::enable_if_t<std::is_floating_point_v<T>>>
+{
+    using Stored = std::conditional_t<sizeof(T) == sizeof(float), float, double>;
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { ctfDeclareFloat(out, sizeof(Stored) * 8); }
+    static void write(QCtfPayload &payload, T value)
+    { payload.appendValue(static_cast<Stored>(value)); }
+};
+
+template <typename T>
+struct QCtfType<T *>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out)
+    { ctfDeclareInteger(out, sizeof(quintptr) * 8, false, 16); }
+    static void write(QCtfPayload &payload, const T *value)
+    { payload.appendValue(quintptr(value)); }
+};
+
+template <>
+struct QCtfType<const char *>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { out += "string { encoding = UTF8; }"; }
+    static void write(QCtfPayload &payload, const char *value)
+    {
+        if (!value)
+            value = "";
+        payload.append(value, qsizetype(qstrlen(value)) + 1);
+    }
+};
+
+template <>
+struct QCtfType<char *> : QCtfType<const char *> {};
+
+template <>
+struct QCtfType<QString>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { QCtfType<const char *>::declare(out); }
+    static void write(QCtfPayload &payload, const QString &value)
+    {
+        const QByteArray utf8 = value.toUtf8();
+        payload.append(utf8.constData(), utf8.size() + 1);
+    }
+};
+
+template <>
+struct QCtfType<QByteArray>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out)
+    { out += "struct { uint32_t length; uint8_t data[length]; }"; }
+    static void write(QCtfPayload &payload, const QByteArray &value)
+    {
+        payload.appendValue(quint32(value.size()));
+        payload.append(value.constData(), value.size());
+    }
+};
+
+template <>
+struct QCtfType<QUrl>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { QCtfType<const char *>::declare(out); }
+    static void write(QCtfPayload &payload, const QUrl &value)
+    {
+        const QByteArray encoded = value.toEncoded();
+        payload.append(encoded.constData(), encoded.size() + 1);
+    }
+};
+
+template <>
+struct QCtfType<QPoint>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { out += "struct { int32_t x; int32_t y; }"; }
+    static void write(QCtfPayload &payload, const QPoint &value)
+    {
+        payload.appendValue(qint32(value.x()));
+        payload.appendValue(qint32(value.y()));
+    }
+};
+
+template <>
+struct QCtfType<QSize>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out) { out += "struct { int32_t width; int32_t height; }"; }
+    static void write(QCtfPayload &payload, const QSize &value)
+    {
+        payload.appendValue(qint32(value.width()));
+        payload.appendValue(qint32(value.height()));
+    }
+};
+
+template <>
+struct QCtfType<QRect>
+{
+    static constexpr bool isSupported = true;
+    static void declare(QByteArray &out)
+    { out += "struct { int32_t x; int32_t y; int32_t width; int32_t height; }"; }
+    static void write(QCtfPayload &payload, const QRect &value)
+    {
+        payload.appendValue(qint32(value.x()));
+        payload.appendValue(qint32(value.y()));
+        payload.appendValue(qint32(value.width()));
+        payload.appendValue(qint32(value.height()));
+    }
+};
+
+// The functions below are what the code generated by tracegen calls.
+
+template <typename T>
+void ctfDescribeField(QByteArray &out, const char *name)
+{
+    using Type = QCtfType<std::decay_t<T>>;
+    if constexpr (Type::isSupported) {
+        out += "        ";
+        Type::declare(out);
+        out += ' ';
+        out += name;
+        out += ";\n";
+    }
+}
+
+template <typename T>
+void ctfWriteField(QCtfPayload &payload, const T &value)
+{
+    using Type = QCtfType<std::decay_t<T>>;
+    if constexpr (Type::isSupported)
+        Type::write(payload, value);
+}
+
+// fixed-size arrays, as in "const char[10] name"
+template <typename T>
+void ctfDescribeArray(QByteArray &out, const char *name, int length)
+{
+    using Type = QCtfType<std::remove_cv_t<T>>;
+    if constexpr (Type::isSupported) {
+        out += "        ";
+        Type::declare(out);
+        out += ' ';
+        out += name;
+        out += '[';
+        out += QByteArray::number(length);
+        out += "];\n";
+    }
+}
+
+template <typename T>
+void ctfWriteArray(QCtfPayload &payload, const T *values, int length)
+{
+    using Type = QCtfType<std::remove_cv_t<T>>;
+    if constexpr (Type::isSupported) {
+        for (int i = 0; i < length; ++i)
+            Type::write(payload, values[i]);
+    }
+}
+
+// sequences, as in "const char[len] name, unsigned int len"; the length is
+// stored in front of the elements
+template <typename T>
+void ctfDescribeSequence(QByteArray &out, const char *name)
+{
+    using Type = QCtfType<std::remove_cv_t<T>>;
+    if constexpr (Type::isSupported) {
+        out += "        struct { uint32_t length; ";
+        Type::declare(out);
+        out += " data[length]; } ";
+        out += name;
+        out += ";\n";
+    }
+}
+
+template <typename T>
+void ctfWriteSequence(QCtfPayload &payload, const T *values, quint32 length)
+{
+    using Type = QCtfType<std::remove_cv_t<T>>;
+    if constexpr (Type::isSupported) {
+        payload.appendValue(length);
+        for (quint32 i = 0; i < length; ++i)
+            Type::write(payload, values[i]);
+    }
+}
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // QCTF_P_H
@@ -56,6 +56,9 @@
 #include "qdatetime.h"
 #include "qcoreapplication.h"
 #include "qthread.h"
+#if QT_CONFIG(thread)
+#include "qwaitcondition.h"
+#endif
 #include "private/qloggingregistry_p.h"
 #include "private/qcoreapplication_p.h"
 #include "private/qsimd_p.h"
@@ -1727,6 +1730,134 @@ static bool wasm_default_message_handler(QtMsgType type,
 
 // --------------------------------------------------------------------------
 
+#if QT_CONFIG(thread) && !defined(QT_BOOTSTRAPPED)
+/*
+    Writes the formatted stderr output on a background thread, so that the
+    logging thread does not wait for the terminal or pipe. Enabled by setting
+    QT_LOGGING_ASYNC to "block" (or "1"), which makes logging wait when too
+    much output is pending, or to "drop", which discards messages instead and
+    reports how many were lost. Messages are formatted on the logging thread,
+    as the message pattern refers to the calling thread, time and backtrace.
+*/
+class QAsyncLogWriter : public QThread
+{
+public:
+    enum Policy { Block, Drop };
+    enum { MaxPendingBytes = 1024 * 1024 };
+
+    QAsyncLogWriter();
+    ~QAsyncLogWriter();
+
+    static bool isEnabled() { return policy() >= 0; }
+
+    void write(QByteArray &&line);
+    void flush();
+
+protected:
+    void run() override;
+
+private:
+    static int policy();
+
+    QMutex mutex;
+    QWaitCondition dataAvailable;
+    QWaitCondition spaceAvailable;
+    QWaitCondition drained;
+    QByteArrayList pending;
+    qsizetype pendingBytes = 0;
+    qsizetype dropped = 0;
+    bool writing = false;
+    bool quit = false;
+};
+
+Q_GLOBAL_STATIC(QAsyncLogWriter, asyncLogWriter)
+
+int QAsyncLogWriter::policy()
+{
+    static const int policy = [] {
+        const QByteArray value = qgetenv("QT_LOGGING_ASYNC");
+        if (value == "drop")
+            return int(Drop);
+        if (value == "block" || value == "1")
+            return int(Block);
+        return -1;
+    }();
+    return policy;
+}
+
+QAsyncLogWriter::QAsyncLogWriter()
+{
+    start();
+}
+
+QAsyncLogWriter::~QAsyncLogWriter()
+{
+    {
+        const auto locker = qt_scoped_lock(mutex);
+        quit = true;
+        dataAvailable.wakeOne();
+    }
+    wait();
+}
+
+void QAsyncLogWriter::write(QByteArray &&line)
+{
+    auto locker = qt_unique_lock(mutex);
+    while (pendingBytes + line.size() > MaxPendingBytes && !pending.isEmpty()) {
+        if (policy() == Drop) {
+            ++dropped;
+            return;
+        }
+        spaceAvailable.wait(&mutex);
+    }
+    pendingBytes += line.size();
+    pending.append(std::move(line));
+    dataAvailable.wakeOne();
+}
+
+// waits until everything that was logged so far has been written
+void QAsyncLogWriter::flush()
+{
+    auto locker = qt_unique_lock(mutex);
+    while (!pending.isEmpty() || dropped || writing)
+        drained.wait(&mutex);
+}
+
+void QAsyncLogWriter::run()
+{
+    auto locker = qt_unique_lock(mutex);
+    for (;;) {
+        while (pending.isEmpty() && !dropped && !quit)
+            dataAvailable.wait(&mutex);
+        if (pending.isEmpty() && !dropped)
+            break;  // quit and nothing left to write
+
+        const QByteArrayList lines = std::exchange(pending, {});
+        const qsizetype lost = std::exchange(dropped, 0);
+        pendingBytes = 0;
+        writing = true;
+        spaceAvailable.wakeAll();
+        locker.unlock();
+
+        for (const QByteArray &line : lines)
+            fwrite(line.constData(), 1, size_t(line.size()), stderr);
+        if (lost)
+            fprintf(stderr, "QT_LOGGING_ASYNC: %lld messages dropped\n", qlonglong(lost));
+        fflush(stderr);
+
+        locker.lock();
+        writing = false;
+        drained.wakeAll();
+    }
+}
+
+static void flushAsyncLogOutput()
+{
+    if (QAsyncLogWriter::isEnabled() && asyncLogWriter.exists() && !asyncLogWriter.isDestroyed())
+        asyncLogWriter->flush();
+}
+#endif // QT_CONFIG(thread) && !QT_BOOTSTRAPPED
+
 static void stderr_message_handler(QtMsgType type, const QMessageLogContext &context, const QString &message)
 {
     QString formattedMessage = qFormatLogMessage(type, context, message);
@@ -1736,6 +1867,17 @@ static void stderr_message_handler(QtMsgType type, const QMessageLogContext &con
     if (formattedMessage.isNull())
         return;
 
+#if QT_CONFIG(thread) && !defined(QT_BOOTSTRAPPED)
+    if (QAsyncLogWriter::isEnabled()) {
+        if (QAsyncLogWriter *writer = asyncLogWriter()) {
+            QByteArray line = formattedMessage.toLocal8Bit();
+            line += '\n';
+            writer->write(std::move(line));
+            return;
+        }
+    }
+#endif
+
     fprintf(stderr, "%s\n", formattedMessage.toLocal8Bit().constData());
     fflush(stderr);
 }
@@ -1909,8 +2051,12 @@ static void qt_message_fatal(QtMsgType, const QMessageLogContext &context, const
 void qt_message_output(QtMsgType msgType, const QMessageLogContext &context, const QString &message)
 {
     qt_message_print(msgType, context, message);
-    if (isFatal(msgType))
+    if (isFatal(msgType)) {
+#if QT_CONFIG(thread) && !defined(QT_BOOTSTRAPPED)
+        flushAsyncLogOutput();
+#endif
         qt_message_fatal(msgType, context, message);
+    }
 }
 
 void qErrnoWarning(const char *msg, ...)
@@ -1977,6 +2123,15 @@ void qErrnoWarning(int code, const char *msg, ...)
     output under X11 or to the debugger under Windows. If it is a
     fatal message, the application aborts immediately.
 
+    If the \c QT_LOGGING_ASYNC environment variable is set to \c block, the
+    default message handler writes to the standard error output from a
+    background thread, so that logging does not wait for the output to be
+    written. When more than 1 MB of output is pending, logging blocks until
+    there is room again; with \c drop, messages are discarded instead and
+    the number of lost messages is reported. Pending output is written
+    before a fatal message aborts the application, and when the application
+    exits normally.
+
     Only one message handler can be defined, since this is usually
     done on an application-wide basis to control debug output.
 
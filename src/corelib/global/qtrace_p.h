@@ -79,6 +79,12 @@
  * amounting to a call to TraceLoggingWrite(), whereas Q_TRACE_ENABLED()
  * wraps around TraceLoggingProviderEnabled().
  *
+ * With the built-in CTF backend (configure -trace ctf), which needs no
+ * external tracing framework, Q_TRACE() records the event into a per-thread
+ * buffer and Q_TRACE_ENABLED() checks whether the QT_CTF_TRACE_DIR
+ * environment variable named a directory for the trace at startup. See
+ * qctf_p.h for the trace format.
+ *
  * A tracepoint provider is defined in a separate file, that follows the
  * following format:
  *
@@ -93,7 +99,7 @@
  *     qcoreapplication_qrect(const QRect &rect)
  *
  * The provider file is then parsed by src/tools/tracegen, which can be
- * switched to output either ETW or LTTNG tracepoint definitions. The provider
+ * switched to output ETW, LTTNG or CTF tracepoint definitions. The provider
  * name is deduced to be basename(provider_file).
  *
  * To use the above (inside qtcore), you need to include
@@ -57,6 +57,11 @@
 
 #include <private/qmemory_p.h>
 
+#if !defined(QT_BOOTSTRAPPED) && QT_CONFIG(future)
+#include "qfuture.h"
+#include "qthreadpool.h"
+#endif
+
 #ifdef QT_NO_QOBJECT
 #define tr(X) QString::fromLatin1(X)
 #endif
@@ -884,6 +889,76 @@ QFile::copy(const QString &fileName, const QString &newName)
     return QFile(fileName).copy(newName);
 }
 
+#if !defined(QT_BOOTSTRAPPED) && QT_CONFIG(future)
+/*!
+    \since 6.0
+
+    Reads the contents of the file \a fileName on a thread of \a pool, or of
+    QThreadPool::globalInstance() if \a pool is \nullptr. Returns a
+    QFuture for the contents.
+
+    The result is an empty QByteArray if the file cannot be opened.
+
+    \sa readAll()
+*/
+QFuture<QByteArray> QFile::readAllAsync(const QString &fileName, QThreadPool *pool)
+{
+    return readAllAsync(QStringList(fileName), pool);
+}
+
+/*!
+    \since 6.0
+    \overload
+
+    Reads the contents of each of the files \a fileNames in the background,
+    using the threads of \a pool, or of QThreadPool::globalInstance() if
+    \a pool is \nullptr. The returned QFuture has one result per file, in the
+    same order as \a fileNames, and each result becomes available as soon as
+    its file has been read. The result for a file that cannot be opened is an
+    empty QByteArray.
+
+    The files are split into a few batches per thread, so reading many small
+    files does not cost a thread pool task each. Canceling the future stops
+    reading files that have not been started yet.
+
+    \sa readAll(), QFuture::resultAt()
+*/
+QFuture<QByteArray> QFile::readAllAsync(const QStringList &fileNames, QThreadPool *pool)
+{
+    if (!pool)
+        pool = QThreadPool::globalInstance();
+
+    QFutureInterface<QByteArray> promise;
+    promise.reportStarted();
+    QFuture<QByteArray> future = promise.future();
+    const qsizetype count = fileNames.size();
+    if (count == 0) {
+        promise.reportFinished();
+        return future;
+    }
+
+    const qsizetype maxBatches = qMax(1, pool->maxThreadCount()) * 4;
+    const qsizetype batchSize = (count + maxBatches - 1) / maxBatches;
+    const qsizetype batchCount = (count + batchSize - 1) / batchSize;
+    const auto pending = std::make_shared<QAtomicInt>(int(batchCount));
+    for (qsizetype begin = 0; begin < count; begin += batchSize) {
+        const qsizetype end = qMin(begin + batchSize, count);
+        pool->start([promise, fileNames, begin, end, pending]() mutable {
+            for (qsizetype i = begin; i < end && !promise.isCanceled(); ++i) {
+                QFile file(fileNames.at(i));
+                QByteArray data;
+                if (file.open(QIODevice::ReadOnly))
+                    data = file.readAll();
+                promise.reportResult(std::move(data), int(i));
+            }
+            if (pending->fetchAndSubOrdered(1) == 1)
+                promise.reportFinished();
+        });
+    }
+    return future;
+}
+#endif // !QT_BOOTSTRAPPED && QT_CONFIG(future)
+
 /*!
     Opens the file using OpenMode \a mode, returning true if successful;
     otherwise false.
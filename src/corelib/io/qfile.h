@@ -55,6 +55,13 @@
 
 QT_BEGIN_NAMESPACE
 
+#if !defined(QT_BOOTSTRAPPED)
+#if QT_CONFIG(future)
+template <typename T> class QFuture;
+class QThreadPool;
+#endif
+#endif
+
 #if QT_CONFIG(cxx17_filesystem)
 namespace QtPrivate {
 inline QString fromFilesystemPath(const std::filesystem::path &path)
@@ -214,6 +221,14 @@ public:
 #endif // QT_CONFIG(cxx17_filesystem)
     static bool copy(const QString &fileName, const QString &newName);
 
+#if !defined(QT_BOOTSTRAPPED)
+#if QT_CONFIG(future)
+    static QFuture<QByteArray> readAllAsync(const QString &fileName, QThreadPool *pool = nullptr);
+    static QFuture<QByteArray> readAllAsync(const QStringList &fileNames,
+                                            QThreadPool *pool = nullptr);
+#endif
+#endif
+
     bool open(OpenMode flags) override;
     bool open(FILE *f, OpenMode ioFlags, FileHandleFlags handleFlags=DontCloseHandle);
     bool open(int fd, OpenMode ioFlags, FileHandleFlags handleFlags=DontCloseHandle);
@@ -428,6 +428,43 @@ bool QFileSystemEngine::fillMetaData(int fd, QFileSystemMetaData &data)
     return false;
 }
 
+/*!
+    \internal
+
+    Fills \a data with the type and stat(2) information of the entry \a name
+    in the directory \a dirfd, following it if it is a symlink (whose
+    LinkType is recorded too). Looking the name up relative to the open
+    directory is cheaper than resolving the full path again later. Returns
+    \c false if nothing could be determined, leaving \a data unchanged.
+*/
+bool QFileSystemEngine::fillMetaDataAt(int dirfd, const char *name, QFileSystemMetaData &data)
+{
+#ifdef STATX_BASIC_STATS
+    struct statx statxBuffer;
+    if (qt_real_statx(dirfd, name, AT_SYMLINK_NOFOLLOW, &statxBuffer) != 0)
+        return false;
+
+    data.clear();
+    data.knownFlagsMask |= QFileSystemMetaData::LinkType;
+    if (S_ISLNK(statxBuffer.stx_mode)) {
+        data.entryFlags |= QFileSystemMetaData::LinkType;
+        // dangling links are left for fillMetaData() to sort out
+        if (qt_real_statx(dirfd, name, 0, &statxBuffer) != 0)
+            return true;
+    }
+
+    data.fillFromStatxBuf(statxBuffer);
+    data.knownFlagsMask |= QFileSystemMetaData::PosixStatFlags
+            | QFileSystemMetaData::ExistsAttribute;
+    return true;
+#else
+    Q_UNUSED(dirfd);
+    Q_UNUSED(name);
+    Q_UNUSED(data);
+    return false;
+#endif
+}
+
 #if defined(_DEXTRA_FIRST)
 static void fillStat64fromStat32(struct stat64 *statBuf64, const struct stat &statBuf32)
 {
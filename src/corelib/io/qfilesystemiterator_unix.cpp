@@ -39,6 +39,7 @@
 
 #include "qplatformdefs.h"
 #include "qfilesystemiterator_p.h"
+#include "qfilesystemengine_p.h"
 
 #include <private/qstringconverter_p.h>
 
@@ -95,8 +96,18 @@ bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaDa
         if (dirEntry) {
             qsizetype len = strlen(dirEntry->d_name);
             if (checkNameDecodable(dirEntry->d_name, len)) {
-                fileEntry = QFileSystemEntry(nativePath + QByteArray(dirEntry->d_name, len), QFileSystemEntry::FromNativePath());
+                QByteArray path;
+                path.reserve(nativePath.size() + len);
+                path.append(nativePath).append(dirEntry->d_name, len);
+                fileEntry = QFileSystemEntry(path, QFileSystemEntry::FromNativePath());
                 metaData.fillFromDirEnt(*dirEntry);
+#if defined(_DIRENT_HAVE_D_TYPE) || defined(Q_OS_BSD4)
+                // The directory entry did not tell us the type, or it's a
+                // symlink whose target's type QDirIterator's filters need:
+                // stat it relative to the directory while it's at hand.
+                if (dirEntry->d_type == DT_UNKNOWN || dirEntry->d_type == DT_LNK)
+                    QFileSystemEngine::fillMetaDataAt(dirfd(dir), dirEntry->d_name, metaData);
+#endif
                 return true;
             }
         } else {
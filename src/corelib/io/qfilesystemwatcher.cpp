@@ -42,6 +42,7 @@
 
 #include <qdatetime.h>
 #include <qdir.h>
+#include <qdiriterator.h>
 #include <qfileinfo.h>
 #include <qloggingcategory.h>
 #include <qset.h>
@@ -157,11 +158,45 @@ void QFileSystemWatcherPrivate::_q_directoryChanged(const QString &path, bool re
         // perhaps the path was removed after a change was detected, but before we delivered the signal
         return;
     }
-    if (removed)
+    if (removed) {
         directories.removeAll(path);
+        recursiveDirectories.removeAll(path);
+    } else if (isWatchedRecursively(path)) {
+        // pick up subdirectories created or moved in since the last scan
+        watchSubdirectories(path);
+    }
     emit q->directoryChanged(path, QFileSystemWatcher::QPrivateSignal());
 }
 
+bool QFileSystemWatcherPrivate::isWatchedRecursively(const QString &path) const
+{
+    for (const QString &root : recursiveDirectories) {
+        if (path.size() == root.size()) {
+            if (path == root)
+                return true;
+        } else if (path.size() > root.size() && path.startsWith(root)
+                   && (root.endsWith(QLatin1Char('/')) || path.at(root.size()) == QLatin1Char('/'))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void QFileSystemWatcherPrivate::watchSubdirectories(const QString &path)
+{
+    Q_Q(QFileSystemWatcher);
+    QStringList newDirectories;
+    QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot | QDir::NoSymLinks | QDir::Hidden,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString subdirectory = it.next();
+        if (!directories.contains(subdirectory))
+            newDirectories.append(subdirectory);
+    }
+    if (!newDirectories.isEmpty())
+        q->addPaths(newDirectories);
+}
+
 #if defined(Q_OS_WIN)
 
 void QFileSystemWatcherPrivate::_q_winDriveLockForRemoval(const QString &path)
@@ -347,7 +382,7 @@ static QStringList empty_paths_pruned(const QStringList &paths)
     If this limit has been reached, the excess \a paths will not
     be monitored, and they will be added to the returned QStringList.
 
-    \sa addPath(), removePaths()
+    \sa addPath(), removePaths(), addRecursivePath()
 */
 QStringList QFileSystemWatcher::addPaths(const QStringList &paths)
 {
@@ -393,6 +428,50 @@ QStringList QFileSystemWatcher::addPaths(const QStringList &paths)
     return p;
 }
 
+/*!
+    \since 6.0
+
+    Adds \a directory and every directory below it to the file system
+    watcher. Symbolic links to directories are not followed.
+
+    The directoryChanged() signal is emitted with the path of the
+    directory whose contents changed, which may be \a directory itself
+    or any of its subdirectories. Subdirectories that are created or
+    moved into the tree later are watched automatically once the change
+    to their parent has been reported. Only directories are watched:
+    modifying the contents of an existing file does not emit a signal.
+
+    Because no watch is installed for individual files, a large tree
+    needs only as many watches as it has directories, which keeps it
+    within the system limits far more often than adding every file
+    with addPaths().
+
+    Returns \c true if \a directory itself could be watched. Passing
+    \a directory to removePath() stops watching the whole tree.
+
+    \sa addPath(), removePath(), directories()
+*/
+bool QFileSystemWatcher::addRecursivePath(const QString &directory)
+{
+    Q_D(QFileSystemWatcher);
+    if (directory.isEmpty()) {
+        qWarning("QFileSystemWatcher::addRecursivePath: path is empty");
+        return true;
+    }
+    if (!QFileInfo(directory).isDir()) {
+        qWarning("QFileSystemWatcher::addRecursivePath: %ls is not a directory",
+                 qUtf16Printable(directory));
+        return false;
+    }
+
+    if (!d->directories.contains(directory) && !addPath(directory))
+        return false;
+    if (!d->recursiveDirectories.contains(directory))
+        d->recursiveDirectories.append(directory);
+    d->watchSubdirectories(directory);
+    return true;
+}
+
 /*!
     Removes the specified \a path from the file system watcher.
 
@@ -423,6 +502,9 @@ bool QFileSystemWatcher::removePath(const QString &path)
     Reasons for watch removal failing are generally system-dependent,
     but may be due to the path having already been deleted, for example.
 
+    Removing a directory that was added with addRecursivePath() also
+    removes the watches on all of its subdirectories.
+
     \sa removePath(), addPaths()
 */
 QStringList QFileSystemWatcher::removePaths(const QStringList &paths)
@@ -437,6 +519,24 @@ QStringList QFileSystemWatcher::removePaths(const QStringList &paths)
     }
     qCDebug(lcWatcher) << "removing" << paths;
 
+    QStringList subdirectories;
+    for (const QString &path : qAsConst(p)) {
+        if (!d->recursiveDirectories.removeAll(path))
+            continue;
+        const QString prefix = path.endsWith(QLatin1Char('/')) ? path : path + QLatin1Char('/');
+        for (const QString &directory : qAsConst(d->directories)) {
+            if (directory.startsWith(prefix) && !d->isWatchedRecursively(directory))
+                subdirectories.append(directory);
+        }
+    }
+    if (!subdirectories.isEmpty()) {
+        // failures here are not interesting to the caller, who never added these paths
+        if (d->native)
+            subdirectories = d->native->removePaths(subdirectories, &d->files, &d->directories);
+        if (d->poller)
+            d->poller->removePaths(subdirectories, &d->files, &d->directories);
+    }
+
     if (d->native)
         p = d->native->removePaths(p, &d->files, &d->directories);
     if (d->poller)
@@ -103,6 +103,10 @@ public:
 
     QFileSystemWatcherEngine *native, *poller;
     QStringList files, directories;
+    QStringList recursiveDirectories;
+
+    bool isWatchedRecursively(const QString &path) const;
+    void watchSubdirectories(const QString &path);
 
     // private slots
     void _q_fileChanged(const QString &path, bool removed);
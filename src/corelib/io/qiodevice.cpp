@@ -1283,6 +1283,58 @@ QByteArray QIODevice::readAll()
     return result;
 }
 
+/*!
+    \since 6.0
+
+    Reads at most \a maxSize bytes from the device and returns them as a
+    list of byte arrays whose concatenation is the data read.
+
+    Data that QIODevice has already buffered is handed over in the
+    blocks it was received in, without copying it. Only when nothing is
+    buffered does this function read from the device, as read() would.
+
+    This function has no way of reporting errors; returning an empty
+    list can mean either that no data was currently available for
+    reading, or that an error occurred.
+
+    \sa read(), writeChunks()
+*/
+QByteArrayList QIODevice::readChunks(qint64 maxSize)
+{
+    Q_D(QIODevice);
+    QByteArrayList result;
+
+    CHECK_MAXLEN(readChunks, result);
+    CHECK_READABLE(readChunks, result);
+
+    // Buffered data must stay in place during a transaction and is
+    // rewritten in text mode, so take the regular path then.
+    if (!d->transactionStarted && (d->openMode & Text) == 0) {
+        const bool sequential = d->isSequential();
+        qint64 chunkSize;
+        while ((chunkSize = d->buffer.nextDataBlockSize()) > 0 && chunkSize <= maxSize) {
+            result.append(d->buffer.read());
+            if (!sequential)
+                d->pos += chunkSize;
+            maxSize -= chunkSize;
+        }
+        if (!result.isEmpty()) {
+            // Split the next block if only part of it was asked for.
+            if (maxSize > 0 && !d->buffer.isEmpty())
+                result.append(read(qMin(maxSize, d->buffer.nextDataBlockSize())));
+            if (d->buffer.isEmpty())
+                readData(nullptr, 0);
+            return result;
+        }
+    }
+
+    const QByteArray data = read(qMin(maxSize, qMax(bytesAvailable(),
+                                                    qint64(d->readBufferChunkSize))));
+    if (!data.isEmpty())
+        result.append(data);
+    return result;
+}
+
 /*!
     This function reads a line of ASCII characters from the device, up
     to a maximum of \a maxSize - 1 bytes, stores the characters in \a
@@ -1749,6 +1801,57 @@ qint64 QIODevice::write(const QByteArray &data)
     return ret;
 }
 
+/*!
+    \since 6.0
+    \overload
+
+    Writes the \a count byte sequences in \a chunks to the device, in
+    order, as if they were a single contiguous block. Returns the total
+    number of bytes that were actually written, or -1 if an error
+    occurred.
+
+    This avoids concatenating, for example, a protocol header and its
+    payload before writing them. Sequential devices pass all chunks to
+    writeChunksData(), which a socket can turn into one vectored write.
+
+    \sa write(), readChunks(), writeChunksData()
+*/
+qint64 QIODevice::writeChunks(const QByteArrayView *chunks, qsizetype count)
+{
+    Q_D(QIODevice);
+    CHECK_WRITABLE(writeChunks, qint64(-1));
+    if (count < 0) {
+        checkWarnMessage(this, "writeChunks", "Called with count < 0");
+        return qint64(-1);
+    }
+
+    if (d->isSequential() && (d->openMode & Text) == 0)
+        return writeChunksData(chunks, count);
+
+    // Random-access and text devices need the bookkeeping done by write().
+    qint64 written = 0;
+    for (qsizetype i = 0; i < count; ++i) {
+        const QByteArrayView chunk = chunks[i];
+        if (chunk.isEmpty())
+            continue;
+        const qint64 ret = write(chunk.data(), chunk.size());
+        if (ret < 0)
+            return written ? written : ret;
+        written += ret;
+        if (ret < chunk.size())
+            break;
+    }
+    return written;
+}
+
+/*!
+    \fn qint64 QIODevice::writeChunks(std::initializer_list<QByteArrayView> chunks)
+    \since 6.0
+    \overload
+
+    Writes the byte sequences in \a chunks to the device, in order.
+*/
+
 /*!
     \internal
 */
@@ -2177,6 +2280,38 @@ QString QIODevice::errorString() const
     \sa read(), write()
 */
 
+/*!
+    \since 6.0
+
+    Writes the \a count byte sequences in \a chunks to the device, in
+    order. Returns the total number of bytes written, or -1 if an error
+    occurred before anything was written.
+
+    This function is called by writeChunks() on sequential devices. The
+    default implementation calls writeData() for each chunk and stops at
+    the first one that is not written completely. Reimplement it when
+    the device can transfer several buffers at once, for instance with
+    a vectored system call.
+
+    \sa writeChunks(), writeData()
+*/
+qint64 QIODevice::writeChunksData(const QByteArrayView *chunks, qsizetype count)
+{
+    qint64 written = 0;
+    for (qsizetype i = 0; i < count; ++i) {
+        const QByteArrayView chunk = chunks[i];
+        if (chunk.isEmpty())
+            continue;
+        const qint64 ret = writeData(chunk.data(), chunk.size());
+        if (ret < 0)
+            return written ? written : ret;
+        written += ret;
+        if (ret < chunk.size())
+            break;
+    }
+    return written;
+}
+
 /*!
   \internal
   \fn int qt_subtract_from_timeout(int timeout, int elapsed)
@@ -49,6 +49,7 @@
 #include <QtCore/qscopedpointer.h>
 #endif
 #include <QtCore/qstring.h>
+#include <QtCore/qbytearraylist.h>
 
 #ifdef open
 #error qiodevice.h must be included before any header file that defines open
@@ -112,6 +113,7 @@ public:
     qint64 read(char *data, qint64 maxlen);
     QByteArray read(qint64 maxlen);
     QByteArray readAll();
+    QByteArrayList readChunks(qint64 maxSize);
     qint64 readLine(char *data, qint64 maxlen);
     QByteArray readLine(qint64 maxlen = 0);
     virtual bool canReadLine() const;
@@ -124,6 +126,9 @@ public:
     qint64 write(const char *data, qint64 len);
     qint64 write(const char *data);
     qint64 write(const QByteArray &data);
+    qint64 writeChunks(const QByteArrayView *chunks, qsizetype count);
+    qint64 writeChunks(std::initializer_list<QByteArrayView> chunks)
+    { return writeChunks(chunks.begin(), qsizetype(chunks.size())); }
 
     qint64 peek(char *data, qint64 maxlen);
     QByteArray peek(qint64 maxlen);
@@ -158,6 +163,7 @@ protected:
     virtual qint64 readLineData(char *data, qint64 maxlen);
     virtual qint64 skipData(qint64 maxSize);
     virtual qint64 writeData(const char *data, qint64 len) = 0;
+    virtual qint64 writeChunksData(const QByteArrayView *chunks, qsizetype count);
 
     void setOpenMode(OpenMode openMode);
 
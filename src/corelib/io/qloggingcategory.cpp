@@ -631,4 +631,49 @@ void QLoggingCategory::setFilterRules(const QString &rules)
     if variadic macros are supported.
 */
 
+/*!
+    \macro Q_DECLARE_LOGGING_CATEGORY_WITH_MIN_LEVEL(name, minLevel)
+    \sa Q_LOGGING_CATEGORY_WITH_MIN_LEVEL()
+    \relates QLoggingCategory
+    \since 6.0
+
+    Declares a logging category \a name whose messages of a lower severity
+    than the QtMsgType \a minLevel are removed at compile time. The qCDebug(),
+    qCInfo(), qCWarning() and qCCritical() macros for such message types
+    expand to code that the compiler discards, including the evaluation of
+    their arguments, whatever the filter rules say at run time. Messages of
+    \a minLevel and more severe are filtered at run time as usual.
+
+    Unlike a category declared with Q_DECLARE_LOGGING_CATEGORY(), \a name
+    is an object rather than a function; it converts to a
+    \c{const QLoggingCategory &} where one is needed.
+
+    The declaration must be visible where the category is defined with
+    Q_LOGGING_CATEGORY_WITH_MIN_LEVEL(). This macro must be used outside of
+    a class or method.
+*/
+
+/*!
+    \macro Q_LOGGING_CATEGORY_WITH_MIN_LEVEL(name, minLevel, ...)
+    \sa Q_DECLARE_LOGGING_CATEGORY_WITH_MIN_LEVEL()
+    \relates QLoggingCategory
+    \since 6.0
+
+    Defines the logging category \a name, which must have been declared
+    with Q_DECLARE_LOGGING_CATEGORY_WITH_MIN_LEVEL() and the same \a minLevel.
+    The remaining arguments are passed to the QLoggingCategory constructor as
+    with Q_LOGGING_CATEGORY(): the category identifier and, optionally, the
+    least severe message type enabled by default.
+
+    For example:
+
+    \snippet qloggingcategory/main.cpp min_level
+
+    Here qCDebug(driverUsbIrq) statements compile to nothing, while
+    qCInfo(driverUsbIrq) and more severe messages still honor the filter
+    rules.
+
+    This macro must be used outside of a class or method.
+*/
+
 QT_END_NAMESPACE
@@ -106,9 +106,44 @@ private:
     Q_DECL_UNUSED_MEMBER bool placeholder[4]; // reserved for future use
 };
 
+namespace QtPrivate {
+constexpr int loggingSeverity(QtMsgType type) noexcept
+{
+    return type == QtDebugMsg ? 0
+         : type == QtInfoMsg ? 1
+         : type == QtWarningMsg ? 2
+         : type == QtCriticalMsg ? 3
+         : 4;
+}
+
+// Stands in for a category function in the qCX macros. Message types below
+// MinLevel are known to be disabled at compile time, so those macros compile
+// to nothing.
+template <QtMsgType MinLevel, const QLoggingCategory &(*Category)()>
+struct QMinLevelLoggingCategory
+{
+    static constexpr QtMsgType minimumLevel = MinLevel;
+    static constexpr bool isCompiledIn(QtMsgType type) noexcept
+    { return loggingSeverity(type) >= loggingSeverity(MinLevel); }
+
+    bool isDebugEnabled() const { return isCompiledIn(QtDebugMsg) && Category().isDebugEnabled(); }
+    bool isInfoEnabled() const { return isCompiledIn(QtInfoMsg) && Category().isInfoEnabled(); }
+    bool isWarningEnabled() const { return isCompiledIn(QtWarningMsg) && Category().isWarningEnabled(); }
+    bool isCriticalEnabled() const { return isCompiledIn(QtCriticalMsg) && Category().isCriticalEnabled(); }
+    const char *categoryName() const { return Category().categoryName(); }
+
+    const QMinLevelLoggingCategory &operator()() const { return *this; }
+    operator const QLoggingCategory &() const { return Category(); }
+};
+} // namespace QtPrivate
+
 #define Q_DECLARE_LOGGING_CATEGORY(name) \
     extern const QLoggingCategory &name();
 
+#define Q_DECLARE_LOGGING_CATEGORY_WITH_MIN_LEVEL(name, minLevel) \
+    extern const QLoggingCategory &name##_qt_category(); \
+    inline constexpr QtPrivate::QMinLevelLoggingCategory<minLevel, name##_qt_category> name{};
+
 #define Q_LOGGING_CATEGORY(name, ...) \
     const QLoggingCategory &name() \
     { \
@@ -116,6 +151,15 @@ private:
         return category; \
     }
 
+#define Q_LOGGING_CATEGORY_WITH_MIN_LEVEL(name, minLevel, ...) \
+    const QLoggingCategory &name##_qt_category() \
+    { \
+        static const QLoggingCategory category(__VA_ARGS__); \
+        return category; \
+    } \
+    static_assert(decltype(name)::minimumLevel == minLevel, \
+                  "Q_LOGGING_CATEGORY_WITH_MIN_LEVEL: level differs from the declaration");
+
 #if !defined(QT_NO_DEBUG_OUTPUT)
 #  define qCDebug(category, ...) \
     for (bool qt_category_enabled = category().isDebugEnabled(); qt_category_enabled; qt_category_enabled = false) \
@@ -42,6 +42,8 @@
 #include <qdebug.h>
 #include <qfile.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -175,6 +177,55 @@ qint64 QNonContiguousByteDeviceBufferImpl::size() const
     return arrayImpl->size();
 }
 
+// Serves a memory mapped region of a QFile, so uploading a file does not read it
+// chunk by chunk into a buffer first.
+QNonContiguousByteDeviceFileImpl::QNonContiguousByteDeviceFileImpl(QFile *f, uchar *mapped, qint64 size)
+    : QNonContiguousByteDevice(), file(f), mappedData(mapped)
+{
+    byteArray = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), size);
+    arrayImpl = new QNonContiguousByteDeviceByteArrayImpl(&byteArray);
+    arrayImpl->setParent(this);
+    connect(arrayImpl, SIGNAL(readyRead()), SIGNAL(readyRead()));
+    connect(arrayImpl, SIGNAL(readProgress(qint64,qint64)), SIGNAL(readProgress(qint64,qint64)));
+}
+
+QNonContiguousByteDeviceFileImpl::~QNonContiguousByteDeviceFileImpl()
+{
+    // If the file is gone, so is the mapping.
+    if (file)
+        file->unmap(mappedData);
+}
+
+const char* QNonContiguousByteDeviceFileImpl::readPointer(qint64 maximumLength, qint64 &len)
+{
+    return arrayImpl->readPointer(maximumLength, len);
+}
+
+bool QNonContiguousByteDeviceFileImpl::advanceReadPointer(qint64 amount)
+{
+    return arrayImpl->advanceReadPointer(amount);
+}
+
+bool QNonContiguousByteDeviceFileImpl::atEnd() const
+{
+    return arrayImpl->atEnd();
+}
+
+bool QNonContiguousByteDeviceFileImpl::reset()
+{
+    return arrayImpl->reset();
+}
+
+qint64 QNonContiguousByteDeviceFileImpl::size() const
+{
+    return arrayImpl->size();
+}
+
+qint64 QNonContiguousByteDeviceFileImpl::pos() const
+{
+    return arrayImpl->pos();
+}
+
 QNonContiguousByteDeviceByteArrayImpl::QNonContiguousByteDeviceByteArrayImpl(QByteArray *ba) : QNonContiguousByteDevice(), currentPosition(0)
 {
     byteArray = ba;
@@ -474,6 +525,22 @@ qint64 QByteDeviceWrappingIoDevice::writeData( const char* data, qint64 maxSize)
     \internal
 */
 
+// Maps the part of \a file from its current position to its end, or returns
+// nullptr if the file cannot be used that way.
+static uchar *mapFileForReading(QFile *file, qint64 *size)
+{
+    if (!file->isReadable() || file->isSequential())
+        return nullptr;
+
+    const qint64 offset = file->pos();
+    *size = file->size() - offset;
+    // Small files are not worth a mapping, and empty ranges cannot be mapped.
+    if (*size < 16 * 1024 || *size > std::numeric_limits<qsizetype>::max())
+        return nullptr;
+
+    return file->map(offset, *size);
+}
+
 /*!
     \fn static QNonContiguousByteDevice* QNonContiguousByteDeviceFactory::create(QIODevice *device)
 
@@ -489,8 +556,12 @@ QNonContiguousByteDevice* QNonContiguousByteDeviceFactory::create(QIODevice *dev
         return new QNonContiguousByteDeviceBufferImpl(buffer);
     }
 
-    // ### FIXME special case if device is a QFile that supports map()
-    // then we can actually deal with the file without using read/peek
+    // a QFile that supports map() can be used without read/peek
+    if (QFile *file = qobject_cast<QFile *>(device)) {
+        qint64 size;
+        if (uchar *mapped = mapFileForReading(file, &size))
+            return new QNonContiguousByteDeviceFileImpl(file, mapped, size);
+    }
 
     // generic QIODevice
     return new QNonContiguousByteDeviceIoDeviceImpl(device); // FIXME
@@ -508,8 +579,12 @@ QSharedPointer<QNonContiguousByteDevice> QNonContiguousByteDeviceFactory::create
     if (QBuffer *buffer = qobject_cast<QBuffer*>(device))
         return QSharedPointer<QNonContiguousByteDeviceBufferImpl>::create(buffer);
 
-    // ### FIXME special case if device is a QFile that supports map()
-    // then we can actually deal with the file without using read/peek
+    // a QFile that supports map() can be used without read/peek
+    if (QFile *file = qobject_cast<QFile *>(device)) {
+        qint64 size;
+        if (uchar *mapped = mapFileForReading(file, &size))
+            return QSharedPointer<QNonContiguousByteDeviceFileImpl>::create(file, mapped, size);
+    }
 
     // generic QIODevice
     return QSharedPointer<QNonContiguousByteDeviceIoDeviceImpl>::create(device); // FIXME
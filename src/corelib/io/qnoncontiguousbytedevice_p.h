@@ -55,6 +55,8 @@
 #include <QtCore/qbytearray.h>
 #include <QtCore/qbuffer.h>
 #include <QtCore/qiodevice.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qpointer.h>
 #include <QtCore/QSharedPointer>
 #include "private/qringbuffer_p.h"
 
@@ -173,6 +175,25 @@ protected:
     QNonContiguousByteDeviceByteArrayImpl* arrayImpl;
 };
 
+class QNonContiguousByteDeviceFileImpl : public QNonContiguousByteDevice
+{
+    Q_OBJECT
+public:
+    QNonContiguousByteDeviceFileImpl(QFile *f, uchar *mapped, qint64 size);
+    ~QNonContiguousByteDeviceFileImpl();
+    const char* readPointer(qint64 maximumLength, qint64 &len) override;
+    bool advanceReadPointer(qint64 amount) override;
+    bool atEnd() const override;
+    bool reset() override;
+    qint64 size() const override;
+    qint64 pos() const override;
+protected:
+    QPointer<QFile> file;
+    uchar *mappedData;
+    QByteArray byteArray;
+    QNonContiguousByteDeviceByteArrayImpl* arrayImpl;
+};
+
 // ... and the reverse thing
 class QByteDeviceWrappingIoDevice : public QIODevice
 {
@@ -834,6 +834,7 @@ QProcessPrivate::QProcessPrivate()
     processState = QProcess::NotRunning;
     pid = 0;
     sequenceNumber = 0;
+    readBufferMaxSize = 0;
     exitCode = 0;
     exitStatus = QProcess::NormalExit;
     startupSocketNotifier = nullptr;
@@ -972,15 +973,28 @@ bool QProcessPrivate::tryReadFromChannel(Channel *channel)
     if (channel->pipe[0] == INVALID_Q_PIPE)
         return false;
 
-    qint64 available = bytesAvailableInChannel(channel);
-    if (available == 0)
-        available = 1;      // always try to read at least one byte
-
     QProcess::ProcessChannel channelIdx = (channel == &stdoutChannel
                                            ? QProcess::StandardOutput
                                            : QProcess::StandardError);
     Q_ASSERT(readBuffers.size() > int(channelIdx));
     QRingBuffer &readBuffer = readBuffers[int(channelIdx)];
+
+    if (isReadBufferFull(channel)) {
+        // Leave the data in the pipe, so that the child blocks on write()
+        // until the buffer has been drained.
+        if (channel->notifier)
+            channel->notifier->setEnabled(false);
+        return false;
+    }
+
+    qint64 available = bytesAvailableInChannel(channel);
+    if (available == 0)
+        available = 1;      // always try to read at least one byte
+#ifdef Q_OS_UNIX
+    if (readBufferMaxSize && !dying)
+        available = qMin(available, readBufferMaxSize - readBuffer.size());
+#endif
+
     char *ptr = readBuffer.reserve(available);
     qint64 readBytes = readFromChannel(channel, ptr, available);
     if (readBytes <= 0)
@@ -1036,6 +1050,44 @@ bool QProcessPrivate::tryReadFromChannel(Channel *channel)
     return didRead;
 }
 
+/*!
+    \internal
+    Returns \c true if readBufferMaxSize is set and the read buffer of
+    \a channel has reached it. Reading from the channel is then suspended
+    until the buffer has been drained.
+
+    The limit is not applied while the process is dying, to avoid losing
+    data still in the pipe.
+*/
+bool QProcessPrivate::isReadBufferFull(const Channel *channel) const
+{
+#ifdef Q_OS_UNIX
+    if (readBufferMaxSize == 0 || dying)
+        return false;
+    const int channelIdx = (channel == &stdoutChannel ? QProcess::StandardOutput
+                                                      : QProcess::StandardError);
+    return readBuffers.at(channelIdx).size() >= readBufferMaxSize;
+#else
+    Q_UNUSED(channel);
+    return false;
+#endif
+}
+
+/*!
+    \internal
+    Re-enables the read notifiers of the channels whose read buffer is no
+    longer full.
+*/
+void QProcessPrivate::resumeReadingFromChannels()
+{
+    for (Channel *channel : { &stdoutChannel, &stderrChannel }) {
+        if (channel->notifier && channel->pipe[0] != INVALID_Q_PIPE
+                && !channel->notifier->isEnabled() && !isReadBufferFull(channel)) {
+            channel->notifier->setEnabled(true);
+        }
+    }
+}
+
 /*!
     \internal
 */
@@ -1309,6 +1361,55 @@ void QProcess::setReadChannel(ProcessChannel channel)
     QIODevice::setCurrentReadChannel(int(channel));
 }
 
+/*!
+    \since 6.0
+
+    Returns the size of the internal read buffer of each read channel.
+    This limits the amount of output that QProcess buffers before you
+    call read() or readAll().
+
+    A read buffer size of 0 (the default) means that the buffer has
+    no size limit, ensuring that no data is lost.
+
+    \sa setReadBufferSize(), read()
+*/
+qint64 QProcess::readBufferSize() const
+{
+    Q_D(const QProcess);
+    return d->readBufferMaxSize;
+}
+
+/*!
+    \since 6.0
+
+    Sets the size of the internal read buffer of each of QProcess's read
+    channels to be \a size bytes.
+
+    If the buffer size is limited, QProcess stops reading from a channel
+    once its buffer holds \a size bytes, and resumes when the buffer has
+    been drained. Until then, the output stays in the pipe, so a process
+    that writes a lot of output is blocked rather than causing QProcess
+    to consume an unbounded amount of memory. A buffer size of 0 means
+    that the read buffer is unlimited and all output is buffered. This
+    is the default.
+
+    Note that a process blocked this way cannot finish, so
+    waitForFinished() will time out unless its output is read. Any output
+    left in the pipes when the process exits is always read.
+
+    This option currently only has an effect on Unix platforms.
+
+    \sa readBufferSize(), read()
+*/
+void QProcess::setReadBufferSize(qint64 size)
+{
+    Q_D(QProcess);
+    if (d->readBufferMaxSize == size)
+        return;
+    d->readBufferMaxSize = size;
+    d->resumeReadingFromChannels();
+}
+
 /*!
     Closes the read channel \a channel. After calling this function,
     QProcess will no longer receive data on the channel. Any data that
@@ -1873,6 +1974,8 @@ qint64 QProcess::readData(char *data, qint64 maxlen)
         return 0;
     if (d->processState == QProcess::NotRunning)
         return -1;              // EOF
+    // the buffer has been drained, so there may be room for more output
+    d->resumeReadingFromChannels();
     return 0;
 }
 
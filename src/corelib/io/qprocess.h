@@ -177,6 +177,9 @@ public:
     ProcessChannel readChannel() const;
     void setReadChannel(ProcessChannel channel);
 
+    qint64 readBufferSize() const;
+    void setReadBufferSize(qint64 size);
+
     void closeReadChannel(ProcessChannel channel);
     void closeWriteChannel();
 
@@ -305,6 +305,8 @@ public:
     Q_PID pid;
     int sequenceNumber;
 
+    qint64 readBufferMaxSize;
+
     bool dying;
     bool emittedReadyRead;
     bool emittedBytesWritten;
@@ -316,6 +318,8 @@ public:
     void closeChannel(Channel *channel);
     void closeWriteChannel();
     bool tryReadFromChannel(Channel *channel); // obviously, only stdout and stderr
+    bool isReadBufferFull(const Channel *channel) const;
+    void resumeReadingFromChannels();
 
     QString program;
     QStringList arguments;
@@ -169,8 +169,11 @@ QProcessPoller::QProcessPoller(const QProcessPrivate &proc)
     for (int i = 0; i < n_pfds; i++)
         pfds[i] = qt_make_pollfd(-1, POLLIN);
 
-    stdoutPipe().fd = proc.stdoutChannel.pipe[0];
-    stderrPipe().fd = proc.stderrChannel.pipe[0];
+    // don't wait on channels whose read buffer is full
+    if (!proc.isReadBufferFull(&proc.stdoutChannel))
+        stdoutPipe().fd = proc.stdoutChannel.pipe[0];
+    if (!proc.isReadBufferFull(&proc.stderrChannel))
+        stderrPipe().fd = proc.stderrChannel.pipe[0];
 
     if (!proc.writeBuffer.isEmpty()) {
         stdinPipe().fd = proc.stdinChannel.pipe[1];
@@ -461,19 +464,32 @@ void QProcessPrivate::startProcess()
     int ffdflags = FFD_CLOEXEC;
     if (typeid(*q) != typeid(QProcess))
         ffdflags |= FFD_USE_FORK;
+    else
+        ffdflags |= FFD_VFORK_SEMANTICS;
+
+    struct ChildArguments {
+        QProcessPrivate *d;
+        const char *workingDir;
+        char **argv;
+        char **envp;
+    } childArguments = { this, workingDirPtr, argv, envp };
+    auto childMain = [](void *token) -> int {
+        auto args = static_cast<ChildArguments *>(token);
+        args->d->execChild(args->workingDir, args->argv, args->envp);
+        return -1;
+    };
+
     pid_t childPid;
-    forkfd = ::forkfd(ffdflags , &childPid);
+    forkfd = ::vforkfd(ffdflags, &childPid, childMain, &childArguments);
     int lastForkErrno = errno;
-    if (forkfd != FFD_CHILD_PROCESS) {
-        // Parent process.
-        // Clean up duplicated memory.
-        for (int i = 0; i <= arguments.count(); ++i)
-            free(argv[i]);
-        for (int i = 0; i < envc; ++i)
-            free(envp[i]);
-        delete [] argv;
-        delete [] envp;
-    }
+
+    // Clean up duplicated memory.
+    for (int i = 0; i <= arguments.count(); ++i)
+        free(argv[i]);
+    for (int i = 0; i < envc; ++i)
+        free(envp[i]);
+    delete [] argv;
+    delete [] envp;
 
     // On QNX, if spawnChild failed, childPid will be -1 but forkfd is still 0.
     // This is intentional because we only want to handle failure to fork()
@@ -491,12 +507,6 @@ void QProcessPrivate::startProcess()
         return;
     }
 
-    // Start the child.
-    if (forkfd == FFD_CHILD_PROCESS) {
-        execChild(workingDirPtr, argv, envp);
-        ::_exit(-1);
-    }
-
     pid = Q_PID(childPid);
 
     // parent
@@ -595,7 +605,6 @@ void QProcessPrivate::execChild(const char *workingDir, char **argv, char **envp
 report_errno:
     error.code = errno;
     qt_safe_write(childStartedPipe[1], &error, sizeof(error));
-    childStartedPipe[1] = -1;
 }
 
 bool QProcessPrivate::processStarted(QString *errorMessage)
@@ -51,6 +51,7 @@
 #include "qbytearray.h"
 #include "qstringlist.h"
 #include "qendian.h"
+#include "qcache.h"
 #include <qshareddata.h>
 #include <qplatformdefs.h>
 #include <qendian.h>
@@ -196,11 +197,17 @@ static QString cleanPath(const QString &_path)
 Q_DECLARE_TYPEINFO(QResourceRoot, Q_MOVABLE_TYPE);
 
 typedef QList<QResourceRoot*> ResourceList;
+
+// the most bytes of decompressed resource contents that are kept around
+enum { MaxUncompressedCacheCost = 8 * 1024 * 1024 };
+
 struct QResourceGlobalData
 {
     QRecursiveMutex resourceMutex;
     ResourceList resourceList;
     QStringList resourceSearchPaths;
+    // decompressed contents of compressed resources, keyed by their payload
+    QCache<const uchar *, QByteArray> uncompressedCache{MaxUncompressedCacheCost};
 };
 Q_GLOBAL_STATIC(QResourceGlobalData, resourceGlobalData)
 
@@ -213,6 +220,16 @@ static inline ResourceList *resourceList()
 static inline QStringList *resourceSearchPaths()
 { return &resourceGlobalData->resourceSearchPaths; }
 
+// Must be called whenever the payloads of a root may go away, so that a root
+// registered later at the same address does not get stale contents.
+static void clearUncompressedCache()
+{
+    if (resourceGlobalData.isDestroyed())
+        return;
+    const auto locker = qt_scoped_lock(resourceMutex());
+    resourceGlobalData->uncompressedCache.clear();
+}
+
 /*!
     \class QResource
     \inmodule QtCore
@@ -704,8 +721,10 @@ const uchar *QResource::data() const
     compressed. If the resource is a directory or an error occurs while
     decompressing, a null QByteArray is returned.
 
-    \note If the data was compressed, this function will decompress every time
-    it is called. The result is not cached between calls.
+    \note If the data was compressed, the decompressed contents are kept in a
+    process-wide cache shared with QFile, so that reading the same resource
+    again does not decompress it again. Up to 8 MB of decompressed data are
+    cached; the least recently used entries are dropped first.
 
     \sa uncompressedSize(), size(), isCompressed(), isFile()
 */
@@ -723,13 +742,26 @@ QByteArray QResource::uncompressedData() const
     if (d->compressionAlgo == NoCompression)
         return QByteArray::fromRawData(reinterpret_cast<const char *>(d->data), n);
 
+    const bool cacheable = n <= MaxUncompressedCacheCost && !resourceGlobalData.isDestroyed();
+    if (cacheable) {
+        const auto locker = qt_scoped_lock(resourceMutex());
+        if (const QByteArray *cached = resourceGlobalData->uncompressedCache.object(d->data))
+            return *cached;
+    }
+
     // decompress
     QByteArray result(n, Qt::Uninitialized);
     n = d->decompress(result.data(), n);
-    if (n < 0)
+    if (n < 0) {
         result.clear();
-    else
-        result.truncate(n);
+        return result;
+    }
+    result.truncate(n);
+
+    if (cacheable) {
+        const auto locker = qt_scoped_lock(resourceMutex());
+        resourceGlobalData->uncompressedCache.insert(d->data, new QByteArray(result), int(n));
+    }
     return result;
 }
 
@@ -1053,6 +1085,8 @@ Q_CORE_EXPORT bool qUnregisterResourceData(int version, const unsigned char *tre
                 ++i;
             }
         }
+        // the library holding the data may be unloaded next
+        clearUncompressedCache();
         return true;
     }
     return false;
@@ -1067,7 +1101,7 @@ class QDynamicBufferResourceRoot: public QResourceRoot
 
 public:
     inline QDynamicBufferResourceRoot(const QString &_root) : root(_root), buffer(nullptr) { }
-    inline ~QDynamicBufferResourceRoot() { }
+    inline ~QDynamicBufferResourceRoot() { clearUncompressedCache(); }
     inline const uchar *mappingBuffer() const { return buffer; }
     QString mappingRoot() const override { return root; }
     ResourceRootType type() const override { return Resource_Buffer; }
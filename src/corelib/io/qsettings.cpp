@@ -1170,7 +1170,7 @@ void QConfFileSettingsPrivate::remove(const QString &key)
 
     QSettingsKey theKey(key, caseSensitivity);
     QSettingsKey prefix(key + QLatin1Char('/'), caseSensitivity);
-    const auto locker = qt_scoped_lock(confFile->mutex);
+    QWriteLocker locker(&confFile->lock);
 
     ensureSectionParsed(confFile, theKey);
     ensureSectionParsed(confFile, prefix);
@@ -1198,7 +1198,7 @@ void QConfFileSettingsPrivate::set(const QString &key, const QVariant &value)
     QConfFile *confFile = confFiles.at(0);
 
     QSettingsKey theKey(key, caseSensitivity, nextPosition++);
-    const auto locker = qt_scoped_lock(confFile->mutex);
+    QWriteLocker locker(&confFile->lock);
     confFile->removedKeys.remove(theKey);
     confFile->addedKeys.insert(theKey, value);
 }
@@ -1206,26 +1206,40 @@ void QConfFileSettingsPrivate::set(const QString &key, const QVariant &value)
 bool QConfFileSettingsPrivate::get(const QString &key, QVariant *value) const
 {
     QSettingsKey theKey(key, caseSensitivity);
-    ParsedSettingsMap::const_iterator j;
-    bool found = false;
 
     for (auto confFile : qAsConst(confFiles)) {
-        const auto locker = qt_scoped_lock(confFile->mutex);
-
-        if (!confFile->addedKeys.isEmpty()) {
-            j = confFile->addedKeys.constFind(theKey);
-            found = (j != confFile->addedKeys.constEnd());
-        }
-        if (!found) {
-            ensureSectionParsed(confFile, theKey);
-            j = confFile->originalKeys.constFind(theKey);
-            found = (j != confFile->originalKeys.constEnd()
-                     && !confFile->removedKeys.contains(theKey));
+        const auto lookup = [&]() {
+            ParsedSettingsMap::const_iterator j;
+            bool found = false;
+            if (!confFile->addedKeys.isEmpty()) {
+                j = confFile->addedKeys.constFind(theKey);
+                found = (j != confFile->addedKeys.constEnd());
+            }
+            if (!found) {
+                j = confFile->originalKeys.constFind(theKey);
+                found = (j != confFile->originalKeys.constEnd()
+                         && !confFile->removedKeys.contains(theKey));
+            }
+            if (found && value)
+                *value = *j;
+            return found;
+        };
+
+        bool found;
+        {
+            // Concurrent readers share the lock, unless the key's section
+            // still has to be parsed, which modifies the QConfFile.
+            QReadLocker locker(&confFile->lock);
+            if (unparsedSection(confFile, theKey) == confFile->unparsedIniSections.constEnd()) {
+                found = lookup();
+            } else {
+                locker.unlock();
+                QWriteLocker writeLocker(&confFile->lock);
+                ensureSectionParsed(confFile, theKey);
+                found = lookup();
+            }
         }
 
-        if (found && value)
-            *value = *j;
-
         if (found)
             return true;
         if (!fallbacks)
@@ -1243,7 +1257,7 @@ QStringList QConfFileSettingsPrivate::children(const QString &prefix, ChildSpec
     int startPos = prefix.size();
 
     for (auto confFile : qAsConst(confFiles)) {
-        const auto locker = qt_scoped_lock(confFile->mutex);
+        QWriteLocker locker(&confFile->lock);
 
         if (thePrefix.isEmpty())
             ensureAllSectionsParsed(confFile);
@@ -1282,7 +1296,7 @@ void QConfFileSettingsPrivate::clear()
     // Note: First config file is always the most specific.
     QConfFile *confFile = confFiles.at(0);
 
-    const auto locker = qt_scoped_lock(confFile->mutex);
+    QWriteLocker locker(&confFile->lock);
     ensureAllSectionsParsed(confFile);
     confFile->addedKeys.clear();
     confFile->removedKeys = confFile->originalKeys;
@@ -1294,7 +1308,7 @@ void QConfFileSettingsPrivate::sync()
     // error we just try to go on and make the best of it
 
     for (auto confFile : qAsConst(confFiles)) {
-        const auto locker = qt_scoped_lock(confFile->mutex);
+        QWriteLocker locker(&confFile->lock);
         syncConfFile(confFile);
     }
 }
@@ -1843,27 +1857,44 @@ void QConfFileSettingsPrivate::ensureAllSectionsParsed(QConfFile *confFile) cons
     confFile->unparsedIniSections.clear();
 }
 
-void QConfFileSettingsPrivate::ensureSectionParsed(QConfFile *confFile,
-                                                   const QSettingsKey &key) const
+/*!
+    \internal
+
+    Returns the not yet parsed section of \a confFile that \a key belongs to,
+    or the end iterator if that section has been parsed already. This does not
+    modify \a confFile, so it only needs shared access.
+*/
+UnparsedSettingsMap::const_iterator
+QConfFileSettingsPrivate::unparsedSection(const QConfFile *confFile, const QSettingsKey &key)
 {
-    if (confFile->unparsedIniSections.isEmpty())
-        return;
+    const UnparsedSettingsMap &sections = confFile->unparsedIniSections;
+    if (sections.isEmpty())
+        return sections.constEnd();
 
-    UnparsedSettingsMap::iterator i;
+    UnparsedSettingsMap::const_iterator i;
 
     int indexOfSlash = key.indexOf(QLatin1Char('/'));
     if (indexOfSlash != -1) {
-        i = confFile->unparsedIniSections.upperBound(key);
-        if (i == confFile->unparsedIniSections.begin())
-            return;
+        i = sections.upperBound(key);
+        if (i == sections.constBegin())
+            return sections.constEnd();
         --i;
         if (i.key().isEmpty() || !key.startsWith(i.key()))
-            return;
+            return sections.constEnd();
     } else {
-        i = confFile->unparsedIniSections.begin();
-        if (i == confFile->unparsedIniSections.end() || !i.key().isEmpty())
-            return;
+        i = sections.constBegin();
+        if (!i.key().isEmpty())
+            return sections.constEnd();
     }
+    return i;
+}
+
+void QConfFileSettingsPrivate::ensureSectionParsed(QConfFile *confFile,
+                                                   const QSettingsKey &key) const
+{
+    const UnparsedSettingsMap::const_iterator i = unparsedSection(confFile, key);
+    if (i == confFile->unparsedIniSections.constEnd())
+        return;
 
     if (!QConfFileSettingsPrivate::readIniSection(i.key(), i.value(), &confFile->originalKeys))
         setStatus(QSettings::FormatError);
@@ -54,6 +54,7 @@
 #include "QtCore/qdatetime.h"
 #include "QtCore/qmap.h"
 #include "QtCore/qmutex.h"
+#include "QtCore/qreadwritelock.h"
 #include "QtCore/qiodevice.h"
 #include "QtCore/qstack.h"
 #include "QtCore/qstringlist.h"
@@ -167,7 +168,8 @@ public:
     ParsedSettingsMap addedKeys;
     ParsedSettingsMap removedKeys;
     QAtomicInt ref;
-    QMutex mutex;
+    // get() only needs shared access once the key's section is parsed
+    QReadWriteLock lock;
     bool userPerms;
 
 private:
@@ -292,6 +294,8 @@ private:
 #endif
     void ensureAllSectionsParsed(QConfFile *confFile) const;
     void ensureSectionParsed(QConfFile *confFile, const QSettingsKey &key) const;
+    static UnparsedSettingsMap::const_iterator unparsedSection(const QConfFile *confFile,
+                                                               const QSettingsKey &key);
 
     QList<QConfFile *> confFiles;
     QSettings::ReadFunc readFunc;
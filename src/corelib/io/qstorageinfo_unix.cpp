@@ -864,18 +864,27 @@ QList<QStorageInfo> QStorageInfoPrivate::mountedVolumes()
         return QList<QStorageInfo>() << root();
 
     QList<QStorageInfo> volumes;
+    QStorageInfo rootVolume;
 
     while (it.next()) {
         if (!shouldIncludeFs(it))
             continue;
 
-        const QString mountDir = it.rootPath();
-        QStorageInfo info(mountDir);
+        // Fill in the entry directly: constructing the QStorageInfo from the
+        // mount point would scan the whole mount table again for each volume.
+        QStorageInfo info;
+        info.d->rootPath = it.rootPath();
         info.d->device = it.device();
         info.d->fileSystemType = it.fileSystemType();
         info.d->subvolume = it.subvolume();
-        if (info.bytesTotal() == 0 && info != root())
-            continue;
+        info.d->retrieveVolumeInfo();
+        info.d->name = retrieveLabel(info.d->device);
+        if (info.bytesTotal() == 0) {
+            if (!rootVolume.isValid())
+                rootVolume = root();
+            if (info != rootVolume)
+                continue;
+        }
         volumes.append(info);
     }
 
@@ -2500,7 +2500,10 @@ QString qt_ACE_do(QStringView domain, AceOperation op, AceLeadingDot dot)
 
     result.reserve(domain.length());
 
-    const bool isIdnEnabled = op == NormalizeAce ? qt_is_idn_enabled(domain) : false;
+    // Looking the TLD up in the IDN whitelist costs a ToASCII conversion of
+    // its own, so it's only done once a label actually needs IDNA processing
+    bool isIdnEnabled = false;
+    bool idnChecked = op != NormalizeAce;
     qsizetype lastIdx = 0;
     QString aceForm; // this variable is here for caching
 
@@ -2570,6 +2573,10 @@ QString qt_ACE_do(QStringView domain, AceOperation op, AceLeadingDot dot)
 
             // We use resize()+memcpy() here because we're overwriting the data we've copied
             bool appended = false;
+            if (!idnChecked) {
+                isIdnEnabled = qt_is_idn_enabled(domain);
+                idnChecked = true;
+            }
             if (isIdnEnabled) {
                 QString tmp = qt_punycodeDecoder(aceForm);
                 if (tmp.isEmpty())
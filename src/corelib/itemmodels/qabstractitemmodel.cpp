@@ -423,6 +423,18 @@ QVariant QPersistentModelIndex::data(int role) const
     return QVariant();
 }
 
+/*!
+    \since 6.0
+
+    Populates the given \a roleDataSpan for the item referred to by the
+    index.
+*/
+void QPersistentModelIndex::multiData(QModelRoleDataSpan roleDataSpan) const
+{
+    if (d)
+        d->index.multiData(roleDataSpan);
+}
+
 /*!
     \since 4.2
 
@@ -790,29 +802,7 @@ void QAbstractItemModelPrivate::itemsMoved(const QModelIndex &sourceParent, int
 void QAbstractItemModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
                                                      int first, int last)
 {
-    QList<QPersistentModelIndexData *> persistent_moved;
-    QList<QPersistentModelIndexData *> persistent_invalidated;
-    // find the persistent indexes that are affected by the change, either by being in the removed subtree
-    // or by being on the same level and below the removed rows
-    for (auto *data : qAsConst(persistent.indexes)) {
-        bool level_changed = false;
-        QModelIndex current = data->index;
-        while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.row() > last) // below the removed rows
-                    persistent_moved.append(data);
-                else if (current.row() <= last && current.row() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
-                break;
-            }
-            current = current_parent;
-            level_changed = true;
-        }
-    }
-
-    persistent.moved.push(persistent_moved);
-    persistent.invalidated.push(persistent_invalidated);
+    persistentIndexesAboutToBeRemoved(parent, first, last, Qt::Vertical);
 }
 
 void QAbstractItemModelPrivate::rowsRemoved(const QModelIndex &parent,
@@ -874,31 +864,75 @@ void QAbstractItemModelPrivate::columnsInserted(const QModelIndex &parent,
 
 void QAbstractItemModelPrivate::columnsAboutToBeRemoved(const QModelIndex &parent,
                                                         int first, int last)
+{
+    persistentIndexesAboutToBeRemoved(parent, first, last, Qt::Horizontal);
+}
+
+void QAbstractItemModelPrivate::persistentIndexesAboutToBeRemoved(const QModelIndex &parent,
+                                                                  int first, int last,
+                                                                  Qt::Orientation orientation)
 {
     QList<QPersistentModelIndexData *> persistent_moved;
     QList<QPersistentModelIndexData *> persistent_invalidated;
-    // find the persistent indexes that are affected by the change, either by being in the removed subtree
-    // or by being on the same level and to the right of the removed columns
-    for (auto *data : qAsConst(persistent.indexes)) {
-        bool level_changed = false;
-        QModelIndex current = data->index;
+    if (persistent.indexes.isEmpty()) {
+        persistent.moved.push(persistent_moved);
+        persistent.invalidated.push(persistent_invalidated);
+        return;
+    }
+
+    const auto position = [orientation](const QModelIndex &index) {
+        return orientation == Qt::Vertical ? index.row() : index.column();
+    };
+
+    // Persistent indexes usually share most of their ancestors (think of the
+    // children of an expanded branch), so remember for every ancestor we have
+    // seen whether it lies in the removed subtree. This way parent() is called
+    // at most once per distinct ancestor instead of once per level and index.
+    QHash<QModelIndex, bool> removedAncestors;
+    QList<QModelIndex> chain;
+    const auto isInRemovedSubtree = [&](QModelIndex current) {
+        chain.clear();
+        bool removed = false;
         while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.column() > last) // right of the removed columns
-                    persistent_moved.append(data);
-                else if (current.column() <= last && current.column() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
+            const auto it = removedAncestors.constFind(current);
+            if (it != removedAncestors.cend()) {
+                removed = it.value();
+                break;
+            }
+            chain.append(current);
+            const QModelIndex current_parent = current.parent();
+            if (current_parent == parent) {
+                const int pos = position(current);
+                removed = pos >= first && pos <= last;
                 break;
             }
             current = current_parent;
-            level_changed = true;
+        }
+        for (const QModelIndex &ancestor : qAsConst(chain))
+            removedAncestors.insert(ancestor, removed);
+        return removed;
+    };
+
+    // find the persistent indexes that are affected by the change, either by being in the removed subtree
+    // or by being on the same level and below (or right of) the removed rows (or columns)
+    for (auto *data : qAsConst(persistent.indexes)) {
+        const QModelIndex &index = data->index;
+        if (!index.isValid())
+            continue;
+        const QModelIndex index_parent = index.parent();
+        if (index_parent == parent) { // on the same level as the change
+            const int pos = position(index);
+            if (pos > last)
+                persistent_moved.append(data);
+            else if (pos >= first)
+                persistent_invalidated.append(data);
+        } else if (isInRemovedSubtree(index_parent)) {
+            persistent_invalidated.append(data);
         }
     }
 
     persistent.moved.push(persistent_moved);
     persistent.invalidated.push(persistent_invalidated);
-
 }
 
 void QAbstractItemModelPrivate::columnsRemoved(const QModelIndex &parent,
@@ -1108,6 +1142,16 @@ void QAbstractItemModel::resetInternalData()
     index.
 */
 
+/*!
+    \fn void QModelIndex::multiData(QModelRoleDataSpan roleDataSpan) const
+    \since 6.0
+
+    Populates the given \a roleDataSpan for the item referred to by the
+    index.
+
+    \sa QAbstractItemModel::multiData()
+*/
+
 /*!
     \fn Qt::ItemFlags QModelIndex::flags() const
     \since 4.2
@@ -1505,7 +1549,17 @@ QAbstractItemModel::QAbstractItemModel(QAbstractItemModelPrivate &dd, QObject *p
 */
 QAbstractItemModel::~QAbstractItemModel()
 {
-    d_func()->invalidatePersistentIndexes();
+    Q_D(QAbstractItemModel);
+    d->invalidatePersistentIndexes();
+    if (d->batchDepth > 0) {
+        // the changes collected by the listeners refer to this model's data
+        for (const QPointer<QAbstractItemModel> &listener : qAsConst(d->batchListeners)) {
+            if (listener) {
+                QAbstractItemModelPrivate::get(listener)->pendingDataChanges.clear();
+                listener->endBatchUpdate();
+            }
+        }
+    }
 }
 
 
@@ -2666,6 +2720,7 @@ void QAbstractItemModel::beginInsertRows(const QModelIndex &parent, int first, i
     Q_ASSERT(first <= rowCount(parent)); // == is allowed, to insert at the end
     Q_ASSERT(last >= first);
     Q_D(QAbstractItemModel);
+    d->emitPendingDataChanges();
     d->changes.push(QAbstractItemModelPrivate::Change(parent, first, last));
     emit rowsAboutToBeInserted(parent, first, last, QPrivateSignal());
     d->rowsAboutToBeInserted(parent, first, last);
@@ -2721,6 +2776,7 @@ void QAbstractItemModel::beginRemoveRows(const QModelIndex &parent, int first, i
     Q_ASSERT(last >= first);
     Q_ASSERT(last < rowCount(parent));
     Q_D(QAbstractItemModel);
+    d->emitPendingDataChanges();
     d->changes.push(QAbstractItemModelPrivate::Change(parent, first, last));
     emit rowsAboutToBeRemoved(parent, first, last, QPrivateSignal());
     d->rowsAboutToBeRemoved(parent, first, last);
@@ -2876,6 +2932,7 @@ bool QAbstractItemModel::beginMoveRows(const QModelIndex &sourceParent, int sour
         return false;
     }
 
+    d->emitPendingDataChanges();
     QAbstractItemModelPrivate::Change sourceChange(sourceParent, sourceFirst, sourceLast);
     sourceChange.needsAdjust = sourceParent.isValid() && sourceParent.row() >= destinationChild && sourceParent.parent() == destinationParent;
     d->changes.push(sourceChange);
@@ -2969,6 +3026,7 @@ void QAbstractItemModel::beginInsertColumns(const QModelIndex &parent, int first
     Q_ASSERT(first <= columnCount(parent)); // == is allowed, to insert at the end
     Q_ASSERT(last >= first);
     Q_D(QAbstractItemModel);
+    d->emitPendingDataChanges();
     d->changes.push(QAbstractItemModelPrivate::Change(parent, first, last));
     emit columnsAboutToBeInserted(parent, first, last, QPrivateSignal());
     d->columnsAboutToBeInserted(parent, first, last);
@@ -3025,6 +3083,7 @@ void QAbstractItemModel::beginRemoveColumns(const QModelIndex &parent, int first
     Q_ASSERT(last >= first);
     Q_ASSERT(last < columnCount(parent));
     Q_D(QAbstractItemModel);
+    d->emitPendingDataChanges();
     d->changes.push(QAbstractItemModelPrivate::Change(parent, first, last));
     emit columnsAboutToBeRemoved(parent, first, last, QPrivateSignal());
     d->columnsAboutToBeRemoved(parent, first, last);
@@ -3095,6 +3154,7 @@ bool QAbstractItemModel::beginMoveColumns(const QModelIndex &sourceParent, int s
         return false;
     }
 
+    d->emitPendingDataChanges();
     QAbstractItemModelPrivate::Change sourceChange(sourceParent, sourceFirst, sourceLast);
     sourceChange.needsAdjust = sourceParent.isValid() && sourceParent.row() >= destinationChild && sourceParent.parent() == destinationParent;
     d->changes.push(sourceChange);
@@ -3167,6 +3227,8 @@ void QAbstractItemModel::endMoveColumns()
 */
 void QAbstractItemModel::beginResetModel()
 {
+    Q_D(QAbstractItemModel);
+    d->pendingDataChanges.clear();
     emit modelAboutToBeReset(QPrivateSignal());
 }
 
@@ -3189,6 +3251,184 @@ void QAbstractItemModel::endResetModel()
     emit modelReset(QPrivateSignal());
 }
 
+/*!
+    \since 6.0
+
+    Begins a batch of data changes.
+
+    Until the matching call to endBatchUpdate(), the ranges passed to
+    reportDataChanged() are collected instead of being emitted one by one.
+    Overlapping and adjacent ranges below the same parent are merged, so that
+    connected views and proxies process a few dataChanged() signals instead
+    of one for every changed item.
+
+    Batches can be nested; the collected changes are emitted when the
+    outermost batch ends. Proxy models that use this model as their source
+    model batch their own data changes for as long as this model does.
+
+    Row and column insertions, removals and moves flush the changes
+    collected so far before they are announced, and a model reset discards
+    them. A model that changes its layout during a batch must end the batch
+    before emitting layoutAboutToBeChanged().
+
+    \sa endBatchUpdate(), reportDataChanged()
+*/
+void QAbstractItemModel::beginBatchUpdate()
+{
+    Q_D(QAbstractItemModel);
+    if (d->batchDepth++ > 0)
+        return;
+    for (const QPointer<QAbstractItemModel> &listener : qAsConst(d->batchListeners)) {
+        if (listener)
+            listener->beginBatchUpdate();
+    }
+}
+
+/*!
+    \since 6.0
+
+    Ends a batch of data changes started with beginBatchUpdate().
+
+    When the outermost batch ends, this function emits dataChanged() for each
+    of the merged ranges collected since the batch began.
+
+    \sa beginBatchUpdate()
+*/
+void QAbstractItemModel::endBatchUpdate()
+{
+    Q_D(QAbstractItemModel);
+    if (d->batchDepth == 0) {
+        qWarning("QAbstractItemModel::endBatchUpdate: No batch update in progress");
+        return;
+    }
+    if (--d->batchDepth > 0)
+        return;
+    d->emitPendingDataChanges();
+    const auto listeners = d->batchListeners;
+    for (const QPointer<QAbstractItemModel> &listener : listeners) {
+        if (listener)
+            listener->endBatchUpdate();
+    }
+}
+
+/*!
+    \since 6.0
+
+    Reports that the items from \a topLeft to \a bottomRight changed for
+    the given \a roles.
+
+    Outside of a batch this emits dataChanged() right away. Between
+    beginBatchUpdate() and endBatchUpdate(), the range is merged with the
+    ranges reported before and emitted when the batch ends.
+
+    \sa dataChanged(), beginBatchUpdate()
+*/
+void QAbstractItemModel::reportDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                                           const QList<int> &roles)
+{
+    Q_D(QAbstractItemModel);
+    if (d->batchDepth == 0)
+        emit dataChanged(topLeft, bottomRight, roles);
+    else
+        d->addDataChange(topLeft, bottomRight, roles);
+}
+
+void QAbstractItemModelPrivate::addDataChange(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                                              const QList<int> &roles)
+{
+    // beyond this many separate ranges below one parent, they are all
+    // merged into their bounding range to keep adding changes cheap
+    enum { MaximumRangesPerParent = 32 };
+
+    if (!topLeft.isValid() || !bottomRight.isValid())
+        return;
+
+    DataChange change = { topLeft.parent(), topLeft.row(), topLeft.column(),
+                          bottomRight.row(), bottomRight.column(), roles };
+    const auto mergeRoles = [](QList<int> &into, const QList<int> &from) {
+        if (into.isEmpty())
+            return;
+        if (from.isEmpty()) {
+            into.clear();
+            return;
+        }
+        for (int role : from) {
+            if (!into.contains(role))
+                into.append(role);
+        }
+    };
+
+    // merge with every overlapping or adjacent range until none is left
+    int sameParent = 0;
+    for (int i = 0; i < pendingDataChanges.size();) {
+        const DataChange &other = pendingDataChanges.at(i);
+        if (other.parent != change.parent) {
+            ++i;
+            continue;
+        }
+        const bool rowsTouch = change.top <= other.bottom + 1 && other.top <= change.bottom + 1;
+        const bool columnsTouch = change.left <= other.right + 1 && other.left <= change.right + 1;
+        const bool rowsOverlap = change.top <= other.bottom && other.top <= change.bottom;
+        const bool columnsOverlap = change.left <= other.right && other.left <= change.right;
+        if ((rowsTouch && columnsOverlap) || (rowsOverlap && columnsTouch)) {
+            change.top = qMin(change.top, other.top);
+            change.left = qMin(change.left, other.left);
+            change.bottom = qMax(change.bottom, other.bottom);
+            change.right = qMax(change.right, other.right);
+            mergeRoles(change.roles, other.roles);
+            pendingDataChanges.removeAt(i);
+            i = 0;
+            sameParent = 0;
+            continue;
+        }
+        ++sameParent;
+        ++i;
+    }
+
+    if (sameParent >= MaximumRangesPerParent) {
+        for (int i = pendingDataChanges.size() - 1; i >= 0; --i) {
+            const DataChange &other = pendingDataChanges.at(i);
+            if (other.parent != change.parent)
+                continue;
+            change.top = qMin(change.top, other.top);
+            change.left = qMin(change.left, other.left);
+            change.bottom = qMax(change.bottom, other.bottom);
+            change.right = qMax(change.right, other.right);
+            mergeRoles(change.roles, other.roles);
+            pendingDataChanges.removeAt(i);
+        }
+    }
+    pendingDataChanges.append(std::move(change));
+}
+
+void QAbstractItemModelPrivate::emitPendingDataChanges()
+{
+    Q_Q(QAbstractItemModel);
+    if (pendingDataChanges.isEmpty())
+        return;
+    const QList<DataChange> changes = std::exchange(pendingDataChanges, QList<DataChange>());
+    for (const DataChange &change : changes) {
+        emit q->dataChanged(q->index(change.top, change.left, change.parent),
+                            q->index(change.bottom, change.right, change.parent), change.roles);
+    }
+}
+
+void QAbstractItemModelPrivate::addBatchListener(QAbstractItemModel *listener)
+{
+    batchListeners.removeAll(nullptr);
+    batchListeners.append(listener);
+    if (batchDepth > 0)
+        listener->beginBatchUpdate();
+}
+
+void QAbstractItemModelPrivate::removeBatchListener(QAbstractItemModel *listener)
+{
+    if (!batchListeners.removeOne(listener))
+        return;
+    if (batchDepth > 0)
+        listener->endBatchUpdate();
+}
+
 /*!
     Changes the QPersistentModelIndex that is equal to the given \a from model
     index to the given \a to model index.
@@ -3265,6 +3505,49 @@ QModelIndexList QAbstractItemModel::persistentIndexList() const
     return result;
 }
 
+/*!
+    \since 6.0
+
+    Fills the \a roleDataSpan with the requested data for the given \a index.
+
+    The default implementation will call data() for each role in
+    the span. A subclass can reimplement this function to provide data
+    to views more efficiently, for instance by looking up the item
+    behind \a index only once for all the requested roles:
+
+    \code
+    void MyModel::multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const
+    {
+        const Item &item = itemForIndex(index);
+        for (QModelRoleData &roleData : roleDataSpan) {
+            switch (roleData.role()) {
+            case Qt::DisplayRole:
+                roleData.setData(item.name);
+                break;
+            case Qt::DecorationRole:
+                roleData.setData(item.icon);
+                break;
+            default:
+                roleData.clearData();
+                break;
+            }
+        }
+    }
+    \endcode
+
+    Views such as QTableView ask for several roles for every cell they
+    paint through QStyledItemDelegate, which uses this function.
+
+    \sa data(), QModelRoleData, QModelRoleDataSpan
+*/
+void QAbstractItemModel::multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const
+{
+    Q_ASSERT(checkIndex(index, CheckIndexOption::IndexIsValid));
+
+    for (QModelRoleData &d : roleDataSpan)
+        d.setData(data(index, d.role()));
+}
+
 /*!
     \enum QAbstractItemModel::CheckIndexOption
     \since 5.11
@@ -3886,6 +4169,201 @@ void QAbstractItemModelPrivate::Persistent::insertMultiAtEnd(const QModelIndex&
     }
 }
 
+/*!
+    \class QModelRoleData
+    \inmodule QtCore
+    \since 6.0
+    \ingroup model-view
+    \brief The QModelRoleData class holds a role and the data associated to that role.
+
+    QModelRoleData objects store an item role (which is a value from the
+    Qt::ItemDataRole enumeration, or an arbitrary integer for a custom role)
+    as well as the data associated with that role.
+
+    A QModelRoleData object is typically created by views or delegates,
+    setting which role they want to fetch the data for. The object
+    is then passed to models (see QAbstractItemModel::multiData()),
+    which populate the data corresponding to the role stored. Finally,
+    the view visualizes the data retrieved from the model.
+
+    \sa {Model/View Programming}, QModelRoleDataSpan
+*/
+
+/*!
+    \fn QModelRoleData::QModelRoleData(int role) noexcept
+
+    Constructs a QModelRoleData object for the given \a role.
+
+    \sa Qt::ItemDataRole
+*/
+
+/*!
+    \fn int QModelRoleData::role() const noexcept
+
+    Returns the role held by this object.
+
+    \sa Qt::ItemDataRole
+*/
+
+/*!
+    \fn const QVariant &QModelRoleData::data() const noexcept
+
+    Returns the data held by this object.
+
+    \sa setData()
+*/
+
+/*!
+    \fn QVariant &QModelRoleData::data() noexcept
+
+    Returns the data held by this object as a modifiable reference.
+
+    \sa setData()
+*/
+
+/*!
+    \fn template <typename T> void QModelRoleData::setData(T &&value)
+
+    Sets the data held by this object to \a value.
+    \a value must be of a datatype which can be stored in a QVariant.
+
+    \sa data(), clearData(), Q_DECLARE_METATYPE
+*/
+
+/*!
+    \fn void QModelRoleData::clearData() noexcept
+
+    Clears the data held by this object. Note that the role is
+    unchanged; only the data is cleared.
+
+    \sa data()
+*/
+
+/*!
+    \class QModelRoleDataSpan
+    \inmodule QtCore
+    \since 6.0
+    \ingroup model-view
+    \brief The QModelRoleDataSpan class provides a span over QModelRoleData objects.
+
+    A QModelRoleDataSpan is used as an abstraction over an array of
+    QModelRoleData objects. It does not own the objects it refers to.
+
+    Like a view, QModelRoleDataSpan provides a small object (pointer
+    and size) that can be passed to functions that need to examine the
+    contents of the array. A QModelRoleDataSpan can be constructed from
+    any array-like sequence (plain arrays, QList, std::vector,
+    QVarLengthArray, and so on). Moreover, it does not own the
+    sequence, which must therefore be kept alive longer than any
+    QModelRoleDataSpan objects referencing it.
+
+    Views and delegates use a span to ask a model for the data of several
+    roles at once, see QAbstractItemModel::multiData():
+
+    \code
+    QModelRoleData roleData[] = {
+        QModelRoleData(Qt::DisplayRole),
+        QModelRoleData(Qt::DecorationRole)
+    };
+    index.multiData(roleData);
+    const QModelRoleDataSpan span(roleData);
+    const QVariant *display = span.dataForRole(Qt::DisplayRole);
+    \endcode
+
+    \sa {Model/View Programming}, QAbstractItemModel::multiData()
+*/
+
+/*!
+    \fn QModelRoleDataSpan::QModelRoleDataSpan() noexcept
+
+    Constructs an empty QModelRoleDataSpan. Its data() will be set to
+    \nullptr, and its length to zero.
+*/
+
+/*!
+    \fn QModelRoleDataSpan::QModelRoleDataSpan(QModelRoleData &modelRoleData) noexcept
+
+    Constructs a QModelRoleDataSpan spanning over \a modelRoleData,
+    seen as a 1-element array.
+*/
+
+/*!
+    \fn QModelRoleDataSpan::QModelRoleDataSpan(QModelRoleData *modelRoleData, qsizetype len)
+
+    Constructs a QModelRoleDataSpan spanning over the array beginning
+    at \a modelRoleData and with length \a len.
+
+    \note The array must be kept alive as long as this object has not
+    been destructed.
+*/
+
+/*!
+    \fn template <typename Container> QModelRoleDataSpan::QModelRoleDataSpan(Container &c)
+
+    Constructs a QModelRoleDataSpan spanning over the container \a c,
+    which can be any contiguous container of QModelRoleData objects.
+    For instance, it can be a \c{QList<QModelRoleData>},
+    a \c{std::array<QModelRoleData, 10>} and so on.
+
+    \note The container must be kept alive as long as this object has not
+    been destructed.
+*/
+
+/*!
+    \fn qsizetype QModelRoleDataSpan::size() const noexcept
+
+    Returns the length of the span represented by this object.
+*/
+
+/*!
+    \fn qsizetype QModelRoleDataSpan::length() const noexcept
+
+    Returns the length of the span represented by this object.
+*/
+
+/*!
+    \fn QModelRoleData *QModelRoleDataSpan::data() const noexcept
+
+    Returns a pointer to the beginning of the span represented by this
+    object.
+*/
+
+/*!
+    \fn QModelRoleData *QModelRoleDataSpan::begin() const noexcept
+
+    Returns a pointer to the beginning of the span represented by this
+    object.
+*/
+
+/*!
+    \fn QModelRoleData *QModelRoleDataSpan::end() const noexcept
+
+    Returns a pointer to the imaginary element one past the end of the
+    span represented by this object.
+*/
+
+/*!
+    \fn QModelRoleData &QModelRoleDataSpan::operator[](qsizetype index) const
+
+    Returns a modifiable reference to the QModelRoleData at position
+    \a index in the span.
+
+    \note \a index must be a valid index for this span (0 <= \a index < size()).
+*/
+
+/*!
+    \fn QVariant *QModelRoleDataSpan::dataForRole(int role) const
+
+    Returns the data associated with the first QModelRoleData in the
+    span that has its role equal to \a role. If such a QModelRoleData
+    object does not exist, the behavior is undefined.
+
+    \note Avoid calling this function from the model's side, as a
+    model cannot possibly know in advance which roles are in a given
+    QModelRoleDataSpan. This function is instead suitable for views and
+    delegates, which have control over the roles in the span.
+*/
+
 QT_END_NAMESPACE
 
 #include "moc_qabstractitemmodel.cpp"
@@ -57,6 +57,7 @@
 #include "QtCore/qstack.h"
 #include "QtCore/qset.h"
 #include "QtCore/qhash.h"
+#include "QtCore/qpointer.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -92,6 +93,8 @@ public:
     void columnsInserted(const QModelIndex &parent, int first, int last);
     void columnsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
     void columnsRemoved(const QModelIndex &parent, int first, int last);
+    void persistentIndexesAboutToBeRemoved(const QModelIndex &parent, int first, int last,
+                                           Qt::Orientation orientation);
     static QAbstractItemModel *staticEmptyModel();
     static bool variantLessThan(const QVariant &v1, const QVariant &v2);
 
@@ -114,6 +117,25 @@ public:
     void invalidatePersistentIndexes();
     void invalidatePersistentIndex(const QModelIndex &index);
 
+    static QAbstractItemModelPrivate *get(QAbstractItemModel *model) { return model->d_func(); }
+
+    // dataChanged() ranges collected between beginBatchUpdate() and endBatchUpdate()
+    struct DataChange {
+        QModelIndex parent;
+        int top, left, bottom, right;
+        QList<int> roles;
+    };
+    void addDataChange(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                       const QList<int> &roles);
+    void emitPendingDataChanges();
+    void addBatchListener(QAbstractItemModel *listener);
+    void removeBatchListener(QAbstractItemModel *listener);
+
+    QList<DataChange> pendingDataChanges;
+    // proxy models whose batches follow the batches of this model
+    QList<QPointer<QAbstractItemModel>> batchListeners;
+    int batchDepth = 0;
+
     struct Change {
         constexpr Change() : parent(), first(-1), last(-1), needsAdjust(false) {}
         constexpr Change(const QModelIndex &p, int f, int l) : parent(p), first(f), last(l), needsAdjust(false) {}
@@ -129,12 +129,15 @@ void QAbstractProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
 {
     Q_D(QAbstractProxyModel);
     if (sourceModel != d->model) {
-        if (d->model)
+        if (d->model) {
             disconnect(d->model, SIGNAL(destroyed()), this, SLOT(_q_sourceModelDestroyed()));
+            QAbstractItemModelPrivate::get(d->model)->removeBatchListener(this);
+        }
 
         if (sourceModel) {
             d->model = sourceModel;
             connect(d->model, SIGNAL(destroyed()), this, SLOT(_q_sourceModelDestroyed()));
+            QAbstractItemModelPrivate::get(d->model)->addBatchListener(this);
         } else {
             d->model = QAbstractItemModelPrivate::staticEmptyModel();
         }
@@ -504,7 +504,7 @@ void QIdentityProxyModelPrivate::_q_sourceDataChanged(const QModelIndex &topLeft
     Q_ASSERT(topLeft.isValid() ? topLeft.model() == model : true);
     Q_ASSERT(bottomRight.isValid() ? bottomRight.model() == model : true);
     Q_Q(QIdentityProxyModel);
-    emit q->dataChanged(q->mapFromSource(topLeft), q->mapFromSource(bottomRight), roles);
+    q->reportDataChanged(q->mapFromSource(topLeft), q->mapFromSource(bottomRight), roles);
 }
 
 void QIdentityProxyModelPrivate::_q_sourceHeaderDataChanged(Qt::Orientation orientation, int first, int last)
@@ -529,6 +529,7 @@ void QIdentityProxyModelPrivate::_q_sourceLayoutAboutToBeChanged(const QList<QPe
         parents << mappedParent;
     }
 
+    emitPendingDataChanges();
     emit q->layoutAboutToBeChanged(parents, hint);
 
     const auto proxyPersistentIndexes = q->persistentIndexList();
@@ -46,8 +46,14 @@
 #include <qstringlist.h>
 #include <private/qabstractitemmodel_p.h>
 #include <private/qabstractproxymodel_p.h>
+#if QT_CONFIG(thread)
+#include <qsemaphore.h>
+#include <qthread.h>
+#include <qthreadpool.h>
+#endif
 
 #include <algorithm>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -180,6 +186,7 @@ public:
     bool accept_children;
     bool complete_insert;
     bool dynamic_sortfilter;
+    bool sort_key_caching;
     QRowsRemoval itemsBeingRemoved;
 
     QModelIndexPairList saved_persistent_indexes;
@@ -260,6 +267,8 @@ public:
     int find_source_sort_column() const;
     void sort_source_rows(QList<int> &source_rows,
                           const QModelIndex &source_parent) const;
+    void sort_source_rows_by_keys(QList<int> &source_rows,
+                                  const QModelIndex &source_parent) const;
     QList<QPair<int, QList<int>>> proxy_intervals_for_source_items_to_add(
         const QList<int> &proxy_to_source, const QList<int> &source_items,
         const QModelIndex &source_parent, Qt::Orientation orient) const;
@@ -511,6 +520,7 @@ bool QSortFilterProxyModelPrivate::can_create_mapping(const QModelIndex &source_
 void QSortFilterProxyModelPrivate::sort()
 {
     Q_Q(QSortFilterProxyModel);
+    emitPendingDataChanges();
     emit q->layoutAboutToBeChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
     QModelIndexPairList source_indexes = store_persistent_indexes();
     const auto end = source_index_mapping.constEnd();
@@ -586,7 +596,9 @@ void QSortFilterProxyModelPrivate::sort_source_rows(
 {
     Q_Q(const QSortFilterProxyModel);
     if (source_sort_column >= 0) {
-        if (sort_order == Qt::AscendingOrder) {
+        if (sort_key_caching) {
+            sort_source_rows_by_keys(source_rows, source_parent);
+        } else if (sort_order == Qt::AscendingOrder) {
             QSortFilterProxyModelLessThan lt(source_sort_column, source_parent, model, q);
             std::stable_sort(source_rows.begin(), source_rows.end(), lt);
         } else {
@@ -598,6 +610,92 @@ void QSortFilterProxyModelPrivate::sort_source_rows(
     }
 }
 
+/*!
+  \internal
+
+  Sorts [\a begin, \a end) like std::stable_sort(). Large ranges are split
+  into chunks that are sorted on the global thread pool and then merged.
+  Chunks for which no pool thread is available are sorted by the calling
+  thread, so this never waits for a busy pool.
+*/
+template <typename RandomAccessIterator, typename LessThan>
+static void qParallelStableSort(RandomAccessIterator begin, RandomAccessIterator end, LessThan lessThan)
+{
+#if QT_CONFIG(thread)
+    enum { MinimumChunkSize = 16384 };
+    const qsizetype size = end - begin;
+    const int chunkCount = int(qMin<qsizetype>(qMax(QThread::idealThreadCount(), 1),
+                                               size / MinimumChunkSize));
+    if (chunkCount > 1) {
+        std::vector<RandomAccessIterator> bounds;
+        bounds.reserve(chunkCount + 1);
+        for (int i = 0; i <= chunkCount; ++i)
+            bounds.push_back(begin + size * i / chunkCount);
+
+        QSemaphore finished;
+        int started = 0;
+        for (int i = 1; i < chunkCount; ++i) {
+            const auto first = bounds[i];
+            const auto last = bounds[i + 1];
+            const bool ok = QThreadPool::globalInstance()->tryStart([first, last, lessThan, &finished]() {
+                std::stable_sort(first, last, lessThan);
+                finished.release();
+            });
+            if (ok)
+                ++started;
+            else
+                std::stable_sort(first, last, lessThan);
+        }
+        std::stable_sort(bounds[0], bounds[1], lessThan);
+        finished.acquire(started);
+
+        for (int width = 1; width < chunkCount; width *= 2) {
+            for (int i = 0; i + width < chunkCount; i += 2 * width) {
+                std::inplace_merge(bounds[i], bounds[i + width],
+                                   bounds[qMin(i + 2 * width, chunkCount)], lessThan);
+            }
+        }
+        return;
+    }
+#endif
+    std::stable_sort(begin, end, lessThan);
+}
+
+/*!
+  \internal
+
+  Sorts the given \a source_rows like sort_source_rows(), but reads the sort
+  key of every row only once and compares the keys directly instead of
+  calling lessThan().
+*/
+void QSortFilterProxyModelPrivate::sort_source_rows_by_keys(
+    QList<int> &source_rows, const QModelIndex &source_parent) const
+{
+    struct SortEntry {
+        QVariant key;
+        int row;
+    };
+    std::vector<SortEntry> entries;
+    entries.reserve(source_rows.size());
+    for (int row : qAsConst(source_rows))
+        entries.push_back({ model->data(model->index(row, source_sort_column, source_parent), sort_role), row });
+
+    const Qt::CaseSensitivity cs = sort_casesensitivity;
+    const bool localeAware = sort_localeaware;
+    if (sort_order == Qt::AscendingOrder) {
+        qParallelStableSort(entries.begin(), entries.end(), [cs, localeAware](const SortEntry &l, const SortEntry &r) {
+            return QAbstractItemModelPrivate::isVariantLessThan(l.key, r.key, cs, localeAware);
+        });
+    } else {
+        qParallelStableSort(entries.begin(), entries.end(), [cs, localeAware](const SortEntry &l, const SortEntry &r) {
+            return QAbstractItemModelPrivate::isVariantLessThan(r.key, l.key, cs, localeAware);
+        });
+    }
+
+    for (int i = 0; i < int(entries.size()); ++i)
+        source_rows[i] = entries[i].row;
+}
+
 /*!
   \internal
 
@@ -1377,6 +1475,7 @@ void QSortFilterProxyModelPrivate::_q_sourceDataChanged(const QModelIndex &sourc
                 // Re-sort the rows of this level
                 QList<QPersistentModelIndex> parents;
                 parents << q->mapFromSource(source_parent);
+                emitPendingDataChanges();
                 emit q->layoutAboutToBeChanged(parents, QAbstractItemModel::VerticalSortHint);
                 QModelIndexPairList source_indexes = store_persistent_indexes();
                 remove_source_items(m->proxy_rows, m->source_rows, source_rows_resort,
@@ -1412,7 +1511,7 @@ void QSortFilterProxyModelPrivate::_q_sourceDataChanged(const QModelIndex &sourc
                     --source_right_column;
                 const QModelIndex proxy_bottom_right = create_index(
                     proxy_end_row, m->proxy_columns.at(source_right_column), it);
-                emit q->dataChanged(proxy_top_left, proxy_bottom_right, roles);
+                q->reportDataChanged(proxy_top_left, proxy_bottom_right, roles);
             }
         }
 
@@ -1506,6 +1605,7 @@ void QSortFilterProxyModelPrivate::_q_sourceLayoutAboutToBeChanged(const QList<Q
     if (!sourceParents.isEmpty() && saved_layoutChange_parents.isEmpty())
         return;
 
+    emitPendingDataChanges();
     emit q->layoutAboutToBeChanged(saved_layoutChange_parents);
     if (persistent.indexes.isEmpty())
         return;
@@ -1907,6 +2007,7 @@ QSortFilterProxyModel::QSortFilterProxyModel(QObject *parent)
     d->filter_recursive = false;
     d->accept_children = false;
     d->dynamic_sortfilter = true;
+    d->sort_key_caching = false;
     d->complete_insert = false;
     connect(this, SIGNAL(modelReset()), this, SLOT(_q_clearMapping()));
 }
@@ -2857,6 +2958,54 @@ void QSortFilterProxyModel::setAutoAcceptChildRows(bool accept)
     emit autoAcceptChildRowsChanged(accept);
 }
 
+/*!
+    \since 6.0
+    \property QSortFilterProxyModel::sortKeyCachingEnabled
+    \brief whether sorting reads each row's sort key only once.
+
+    By default, sorting calls lessThan() for every comparison, and
+    lessThan() asks the source model for the data of both items. When this
+    property is true, the proxy model reads the sortRole() data of the sort
+    column once for each row that is sorted. It then compares these keys the
+    same way the default implementation of lessThan() does, honoring
+    sortCaseSensitivity and isSortLocaleAware. Large row sets are sorted on
+    several threads of the global thread pool.
+
+    A reimplementation of lessThan() is not called while this property is
+    true, so only enable it if lessThan() is not reimplemented.
+
+    The default value is false.
+
+    \sa sortRole, lessThan()
+*/
+
+/*!
+    \since 6.0
+    \fn void QSortFilterProxyModel::sortKeyCachingEnabledChanged(bool sortKeyCachingEnabled)
+
+    This signal is emitted when the value of the \a sortKeyCachingEnabled
+    property is changed.
+
+    \sa sortKeyCachingEnabled
+*/
+bool QSortFilterProxyModel::isSortKeyCachingEnabled() const
+{
+    Q_D(const QSortFilterProxyModel);
+    return d->sort_key_caching;
+}
+
+void QSortFilterProxyModel::setSortKeyCachingEnabled(bool enable)
+{
+    Q_D(QSortFilterProxyModel);
+    if (d->sort_key_caching == enable)
+        return;
+    d->sort_key_caching = enable;
+    // a reimplemented lessThan() may order the rows differently
+    if (d->proxy_sort_column >= 0)
+        d->sort();
+    emit sortKeyCachingEnabledChanged(enable);
+}
+
 /*!
    \since 4.3
 
@@ -2867,6 +3016,7 @@ void QSortFilterProxyModel::setAutoAcceptChildRows(bool accept)
 void QSortFilterProxyModel::invalidate()
 {
     Q_D(QSortFilterProxyModel);
+    d->emitPendingDataChanges();
     emit layoutAboutToBeChanged();
     d->_q_clearMapping();
     emit layoutChanged();
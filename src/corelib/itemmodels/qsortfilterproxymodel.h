@@ -73,6 +73,7 @@ class Q_CORE_EXPORT QSortFilterProxyModel : public QAbstractProxyModel
     Q_PROPERTY(int filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged)
     Q_PROPERTY(bool recursiveFilteringEnabled READ isRecursiveFilteringEnabled WRITE setRecursiveFilteringEnabled NOTIFY recursiveFilteringEnabledChanged)
     Q_PROPERTY(bool autoAcceptChildRows READ autoAcceptChildRows WRITE setAutoAcceptChildRows NOTIFY autoAcceptChildRowsChanged)
+    Q_PROPERTY(bool sortKeyCachingEnabled READ isSortKeyCachingEnabled WRITE setSortKeyCachingEnabled NOTIFY sortKeyCachingEnabledChanged)
 
 public:
     explicit QSortFilterProxyModel(QObject *parent = nullptr);
@@ -120,6 +121,9 @@ public:
     bool autoAcceptChildRows() const;
     void setAutoAcceptChildRows(bool accept);
 
+    bool isSortKeyCachingEnabled() const;
+    void setSortKeyCachingEnabled(bool enable);
+
 public Q_SLOTS:
 #if QT_CONFIG(regularexpression)
     void setFilterRegularExpression(const QString &pattern);
@@ -189,6 +193,7 @@ Q_SIGNALS:
     void filterRoleChanged(int filterRole);
     void recursiveFilteringEnabledChanged(bool recursiveFilteringEnabled);
     void autoAcceptChildRowsChanged(bool autoAcceptChildRows);
+    void sortKeyCachingEnabledChanged(bool sortKeyCachingEnabled);
 
 private:
     Q_DECLARE_PRIVATE(QSortFilterProxyModel)
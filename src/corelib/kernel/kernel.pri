@@ -25,6 +25,7 @@ HEADERS += \
         kernel/qtranslator.h \
         kernel/qtranslator_p.h \
         kernel/qvariant.h \
+        kernel/qvariantarray.h \
         kernel/qabstracteventdispatcher_p.h \
         kernel/qcoreapplication_p.h \
         kernel/qobjectcleanuphandler.h \
@@ -36,6 +37,7 @@ HEADERS += \
         kernel/qcoreglobaldata_p.h \
         kernel/qsharedmemory.h \
         kernel/qsharedmemory_p.h \
+        kernel/qsharedringbuffer_p.h \
         kernel/qsystemsemaphore.h \
         kernel/qsystemsemaphore_p.h \
         kernel/qfunctions_p.h \
@@ -67,8 +69,10 @@ SOURCES += \
         kernel/qtimer.cpp \
         kernel/qtranslator.cpp \
         kernel/qvariant.cpp \
+        kernel/qvariantarray.cpp \
         kernel/qcoreglobaldata.cpp \
         kernel/qsharedmemory.cpp \
+        kernel/qsharedringbuffer.cpp \
         kernel/qsystemsemaphore.cpp \
         kernel/qpointer.cpp \
         kernel/qmath.cpp \
@@ -340,6 +340,10 @@ bool QCoreApplicationPrivate::is_app_closing = false;
 Q_CORE_EXPORT uint qGlobalPostedEventsCount()
 {
     QThreadData *currentThreadData = QThreadData::current();
+    if (currentThreadData->postEventList.hasIncomingEvents()) {
+        const auto locker = qt_scoped_lock(currentThreadData->postEventList.mutex);
+        currentThreadData->postEventList.mergeIncoming();
+    }
     return currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset;
 }
 
@@ -488,6 +492,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         const auto locker = qt_scoped_lock(thisThreadData->postEventList.mutex);
+        thisThreadData->postEventList.mergeIncoming();
         for (int i = 0; i < thisThreadData->postEventList.size(); ++i) {
             const QPostEvent &pe = thisThreadData->postEventList.at(i);
             if (pe.event) {
@@ -1459,6 +1464,7 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     if (!object) {
         locker.threadData = QThreadData::current();
         locker.locker = qt_unique_lock(locker.threadData->postEventList.mutex);
+        locker.threadData->postEventList.mergeIncoming();
         return locker;
     }
 
@@ -1481,9 +1487,51 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     }
 
     Q_ASSERT(locker.threadData);
+    // anything posted lock-free so far goes before whatever the caller adds
+    locker.threadData->postEventList.mergeIncoming();
     return locker;
 }
 
+/*!
+    \internal
+
+    Posts \a event to \a receiver living in another thread without taking
+    that thread's post event list mutex. Returns \c false if the event has
+    to be posted the regular way, in which case the caller keeps ownership
+    of \a event.
+*/
+bool QCoreApplicationPrivate::postEventLockFree(QObject *receiver, QEvent *event, int priority)
+{
+    auto &threadData = QObjectPrivate::get(receiver)->threadData;
+    QThreadData *data = threadData.loadAcquire();
+    if (!data || data == QThreadData::current())
+        return false;
+
+    QPostEventList &list = data->postEventList;
+    auto *node = new QPostEventList::IncomingEvent{ QPostEvent(receiver, event, priority), nullptr };
+
+    // Pairs with the fence in QObject::moveToThread(): either we see the
+    // receiver's new thread here, or moveToThread() waits for us and then
+    // re-homes what we pushed.
+    list.activePushers.ref();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (threadData.loadRelaxed() != data) {
+        list.activePushers.deref();
+        delete node;
+        return false;
+    }
+
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, event->type());
+    event->posted = true;
+    list.pushIncoming(node);
+    list.activePushers.deref();
+
+    QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+    return true;
+}
+
 /*!
     \since 4.3
 
@@ -1519,6 +1567,17 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    // Queued meta-calls are never compressed, so when they come from another
+    // thread they can skip the receiving thread's mutex altogether.
+    if (event->type() == QEvent::MetaCall) {
+        // delete the event if allocating the queue node throws
+        QScopedPointer<QEvent> eventDeleter(event);
+        const bool posted = QCoreApplicationPrivate::postEventLockFree(receiver, event, priority);
+        eventDeleter.take();
+        if (posted)
+            return;
+    }
+
     auto locker = QCoreApplicationPrivate::lockThreadPostEventList(receiver);
     if (!locker.threadData) {
         // posting during destruction? just delete the event to prevent a leak
@@ -1664,6 +1723,8 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
         event_type = 0;
     }
 
+    Q_TRACE_SCOPE(QCoreApplicationPrivate_sendPostedEvents, receiver, event_type);
+
     if (receiver && receiver->d_func()->threadData != data) {
         qWarning("QCoreApplication::sendPostedEvents: Cannot send "
                  "posted events for objects in another thread");
@@ -1673,6 +1734,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     auto locker = qt_unique_lock(data->postEventList.mutex);
+    data->postEventList.mergeIncoming();
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -1890,6 +1952,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
     QThreadData *data = QThreadData::current();
 
     const auto locker = qt_scoped_lock(data->postEventList.mutex);
+    data->postEventList.mergeIncoming();
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
@@ -154,6 +154,7 @@ public:
         void unlock() { locker.unlock(); }
     };
     static QPostEventListLocker lockThreadPostEventList(QObject *object);
+    static bool postEventLockFree(QObject *receiver, QEvent *event, int priority);
 #endif // QT_NO_QOBJECT
 
     int &argc;
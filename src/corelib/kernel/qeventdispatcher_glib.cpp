@@ -50,6 +50,8 @@
 
 #include <glib.h>
 
+#include <qtcore_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
 struct GPollFDWithQSocketNotifier
@@ -404,6 +406,7 @@ QEventDispatcherGlib::~QEventDispatcherGlib()
 bool QEventDispatcherGlib::processEvents(QEventLoop::ProcessEventsFlags flags)
 {
     Q_D(QEventDispatcherGlib);
+    Q_TRACE_SCOPE(QEventDispatcher_processEvents, this, int(flags));
 
     const bool canWait = (flags & QEventLoop::WaitForMoreEvents);
     if (canWait)
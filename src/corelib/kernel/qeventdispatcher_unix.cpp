@@ -51,14 +51,22 @@
 #include <private/qcoreapplication_p.h>
 #include <private/qcore_unix_p.h>
 
+#include <qtcore_tracepoints_p.h>
+
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <limits>
+
 #ifndef QT_NO_EVENTFD
 #  include <sys/eventfd.h>
 #endif
 
+#if QT_CONFIG(epoll)
+#  include <sys/epoll.h>
+#endif
+
 // VxWorks doesn't correctly set the _POSIX_... options
 #if defined(Q_OS_VXWORKS)
 #  if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK <= 0)
@@ -222,14 +230,44 @@ int QThreadPipe::check(const pollfd &pfd)
     return readyread;
 }
 
+#if QT_CONFIG(epoll)
+// the epoll event bits have the same values as their poll counterparts,
+// so revents can be handed to the poll-based code unchanged
+static_assert(EPOLLIN == POLLIN && EPOLLOUT == POLLOUT && EPOLLPRI == POLLPRI
+              && EPOLLERR == POLLERR && EPOLLHUP == POLLHUP);
+#endif
+
 QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
 {
     if (Q_UNLIKELY(threadPipe.init() == false))
         qFatal("QEventDispatcherUNIXPrivate(): Cannot continue without a thread pipe");
+
+#if QT_CONFIG(epoll)
+    if (qEnvironmentVariableIntValue("QT_EVENTDISPATCHER_EPOLL") > 0) {
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        if (epollFd < 0) {
+            perror("QEventDispatcherUNIXPrivate(): Unable to create epoll set, falling back to poll");
+        } else {
+            epoll_event ev = {};
+            ev.events = EPOLLIN;
+            ev.data.fd = threadPipe.fds[0];
+            if (epoll_ctl(epollFd, EPOLL_CTL_ADD, threadPipe.fds[0], &ev) < 0) {
+                perror("QEventDispatcherUNIXPrivate(): Unable to add the thread pipe to the epoll set");
+                qt_safe_close(epollFd);
+                epollFd = -1;
+            }
+        }
+    }
+#endif
 }
 
 QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
 {
+#if QT_CONFIG(epoll)
+    if (epollFd >= 0)
+        qt_safe_close(epollFd);
+#endif
+
     // cleanup timers
     qDeleteAll(timerList);
 }
@@ -289,6 +327,93 @@ void QEventDispatcherUNIXPrivate::markPendingSocketNotifiers()
     pollfds.clear();
 }
 
+#if QT_CONFIG(epoll)
+void QEventDispatcherUNIXPrivate::updateEpollSet(int fd, short oldEvents, short newEvents)
+{
+    if (oldEvents == newEvents)
+        return;
+
+    if (epollFallbackFds.contains(fd)) {
+        // waitForEpollEvents() polls it with the notifiers' current events
+        if (!newEvents)
+            epollFallbackFds.remove(fd);
+        return;
+    }
+
+    epoll_event ev = {};
+    ev.events = uint(newEvents);
+    ev.data.fd = fd;
+
+    int op = !oldEvents ? EPOLL_CTL_ADD : !newEvents ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+    int ret = epoll_ctl(epollFd, op, fd, &ev);
+    if (ret < 0 && op == EPOLL_CTL_ADD && errno == EEXIST) {
+        op = EPOLL_CTL_MOD;
+        ret = epoll_ctl(epollFd, op, fd, &ev);
+    } else if (ret < 0 && op == EPOLL_CTL_MOD && errno == ENOENT) {
+        // the kernel drops closed descriptors from the set on its own
+        op = EPOLL_CTL_ADD;
+        ret = epoll_ctl(epollFd, op, fd, &ev);
+    }
+
+    if (ret < 0 && op == EPOLL_CTL_ADD && errno == EPERM) {
+        // not pollable through epoll, but poll() reports it as always ready
+        epollFallbackFds.insert(fd);
+        return;
+    }
+
+    if (ret < 0 && !(op == EPOLL_CTL_DEL && (errno == ENOENT || errno == EBADF)))
+        qErrnoWarning("QSocketNotifier: Unable to update the epoll set for socket %d", fd);
+}
+
+int QEventDispatcherUNIXPrivate::waitForEpollEvents(timespec *tm)
+{
+    int timeout = -1;
+    if (tm) {
+        // round up, so that we never return before the next timer is due
+        const qint64 msecs = qint64(tm->tv_sec) * 1000 + (tm->tv_nsec + 999999) / 1000000;
+        timeout = int(qMin<qint64>(msecs, std::numeric_limits<int>::max()));
+    }
+
+    pollfds.clear();
+    if (!epollFallbackFds.isEmpty()) {
+        for (int fd : qAsConst(epollFallbackFds))
+            pollfds.append(qt_make_pollfd(fd, socketNotifiers.value(fd).events()));
+        timespec noWait = { 0, 0 };
+        const int polled = qt_safe_poll(pollfds.data(), pollfds.size(), &noWait);
+        if (polled < 0) {
+            perror("qt_safe_poll");
+            pollfds.clear();
+        } else if (polled > 0) {
+            // don't block, the ready ones must be activated right away
+            timeout = 0;
+        }
+    }
+
+    // level-triggered, so whatever does not fit is reported on the next call
+    const int maxEvents = 128;
+    epoll_event events[maxEvents];
+    int ready = epoll_wait(epollFd, events, maxEvents, timeout);
+    if (ready < 0) {
+        if (errno != EINTR)
+            perror("epoll_wait");
+        ready = 0;
+    }
+
+    int nevents = 0;
+    for (int i = 0; i < ready; ++i) {
+        const int fd = events[i].data.fd;
+        pollfd pfd = qt_make_pollfd(fd, 0);
+        pfd.revents = short(events[i].events);
+        if (fd == threadPipe.fds[0])
+            nevents += threadPipe.check(pfd);
+        else if (socketNotifiers.contains(fd))
+            pollfds.append(pfd);
+    }
+
+    return nevents + activateSocketNotifiers();
+}
+#endif
+
 int QEventDispatcherUNIXPrivate::activateSocketNotifiers()
 {
     markPendingSocketNotifiers();
@@ -411,7 +536,14 @@ void QEventDispatcherUNIX::registerSocketNotifier(QSocketNotifier *notifier)
         qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
                  Q_FUNC_INFO, sockfd, socketType(type));
 
+#if QT_CONFIG(epoll)
+    const short oldEvents = sn_set.events();
     sn_set.notifiers[type] = notifier;
+    if (d->epollFd >= 0)
+        d->updateEpollSet(sockfd, oldEvents, sn_set.events());
+#else
+    sn_set.notifiers[type] = notifier;
+#endif
 }
 
 void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
@@ -450,7 +582,14 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
         return;
     }
 
+#if QT_CONFIG(epoll)
+    const short oldEvents = sn_set.events();
     sn_set.notifiers[type] = nullptr;
+    if (d->epollFd >= 0)
+        d->updateEpollSet(sockfd, oldEvents, sn_set.events());
+#else
+    sn_set.notifiers[type] = nullptr;
+#endif
 
     if (sn_set.isEmpty())
         d->socketNotifiers.erase(i);
@@ -459,6 +598,7 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
 bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
 {
     Q_D(QEventDispatcherUNIX);
+    Q_TRACE_SCOPE(QEventDispatcher_processEvents, this, int(flags));
     d->interrupt.storeRelaxed(0);
 
     // we are awake, broadcast it
@@ -487,6 +627,15 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
     if (!canWait || (include_timers && d->timerList.timerWait(wait_tm)))
         tm = &wait_tm;
 
+#if QT_CONFIG(epoll)
+    if (d->epollFd >= 0 && include_notifiers) {
+        int nevents = d->waitForEpollEvents(tm);
+        if (include_timers)
+            nevents += d->activateTimers();
+        return (nevents > 0);
+    }
+#endif
+
     d->pollfds.clear();
     d->pollfds.reserve(1 + (include_notifiers ? d->socketNotifiers.size() : 0));
 
@@ -53,6 +53,7 @@
 
 #include "QtCore/qabstracteventdispatcher.h"
 #include "QtCore/qlist.h"
+#include "QtCore/qset.h"
 #include "private/qabstracteventdispatcher_p.h"
 #include "private/qcore_unix_p.h"
 #include "QtCore/qvarlengtharray.h"
@@ -140,9 +141,23 @@ public:
     int activateSocketNotifiers();
     void setSocketNotifierPending(QSocketNotifier *notifier);
 
+#if QT_CONFIG(epoll)
+    void updateEpollSet(int fd, short oldEvents, short newEvents);
+    int waitForEpollEvents(timespec *tm);
+#endif
+
     QThreadPipe threadPipe;
     QList<pollfd> pollfds;
 
+#if QT_CONFIG(epoll)
+    // If >= 0, socket notifiers are kept registered in this epoll set
+    // instead of being polled individually on every loop iteration.
+    int epollFd = -1;
+    // Descriptors epoll refuses with EPERM, like regular files and
+    // directories; they are poll()ed on every iteration instead.
+    QSet<int> epollFallbackFds;
+#endif
+
     QHash<int, QSocketNotifierSetUNIX> socketNotifiers;
     QList<QSocketNotifier *> pendingNotifiers;
 
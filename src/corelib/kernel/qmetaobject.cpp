@@ -604,6 +604,7 @@ inline int QMetaObjectPrivate::indexOfMethodRelative(const QMetaObject **baseObj
                                         const QByteArray &name, int argc,
                                         const QArgumentType *types)
 {
+    const uint hash = methodNameHash(name.constData(), name.size());
     for (const QMetaObject *m = *baseObject; m; m = m->d.superdata) {
         Q_ASSERT(priv(m->d.data)->revision >= 7);
         int i = (MethodType == MethodSignal)
@@ -611,6 +612,25 @@ inline int QMetaObjectPrivate::indexOfMethodRelative(const QMetaObject **baseObj
         const int end = (MethodType == MethodSlot)
                         ? (priv(m->d.data)->signalCount) : 0;
 
+        if (priv(m->d.data)->revision >= 10 && priv(m->d.data)->methodHashSize) {
+            // only the methods sharing the name's bucket can match, and
+            // they are stored in the same descending order as the scan below
+            const uint *table = m->d.data + priv(m->d.data)->methodHashData;
+            const uint bucket = hash & uint(priv(m->d.data)->methodHashSize - 1);
+            const uint *entries = table + priv(m->d.data)->methodHashSize + 1;
+            for (uint e = table[bucket]; e < table[bucket + 1]; ++e) {
+                const int index = int(entries[e]);
+                if (index > i || index < end)
+                    continue;
+                auto data = QMetaMethod::fromRelativeMethodIndex(m, index);
+                if (methodMatch(m, data, name, argc, types)) {
+                    *baseObject = m;
+                    return index;
+                }
+            }
+            continue;
+        }
+
         for (; i >= end; --i) {
             auto data = QMetaMethod::fromRelativeMethodIndex(m, i);
             if (methodMatch(m, data, name, argc, types)) {
@@ -3685,4 +3705,107 @@ QList<QByteArray> QMetaObjectPrivate::parameterTypeNamesFromSignature(const char
     return list;
 }
 
+namespace {
+// Holds one property value while it is streamed, on the stack when it fits
+class GadgetPropertyValue
+{
+    Q_DISABLE_COPY_MOVE(GadgetPropertyValue)
+public:
+    explicit GadgetPropertyValue(QMetaType t) : type(t)
+    {
+        if (type.sizeOf() <= qsizetype(sizeof(storage)) && type.alignOf() <= qsizetype(alignof(Storage)))
+            data = type.construct(&storage);
+        else
+            data = type.create();
+    }
+    ~GadgetPropertyValue()
+    {
+        if (data == static_cast<void *>(&storage))
+            type.destruct(data);
+        else if (data)
+            type.destroy(data);
+    }
+
+    QMetaType type;
+    void *data = nullptr;
+
+private:
+    struct alignas(std::max_align_t) Storage { char buf[8 * sizeof(void *)]; } storage;
+};
+
+// Only stored properties that can be written back are part of the stream
+inline bool isStreamedGadgetProperty(const QMetaProperty &p)
+{
+    return p.isStored() && p.isWritable();
+}
+} // unnamed namespace
+
+namespace QtPrivate {
+/*!
+    \internal
+
+    Writes the stored, writable properties of the Q_GADGET \a gadget, whose
+    meta-object is \a mo, to \a ds in declaration order (base classes first).
+    Each value is read through the moc-generated accessor straight into typed
+    storage and written with its type's stream operator, so no QVariant is
+    created and no type names are written.
+
+    Sets QDataStream::WriteFailed if a property's type cannot be streamed.
+ */
+void writeGadgetProperties(QDataStream &ds, const QMetaObject *mo, const void *gadget)
+{
+    for (int i = 0, count = mo->propertyCount(); i < count && ds.status() == QDataStream::Ok; ++i) {
+        const QMetaProperty p = mo->property(i);
+        if (!isStreamedGadgetProperty(p))
+            continue;
+        const QMetaObject *m = p.enclosingMetaObject();
+        Q_ASSERT(priv(m->d.data)->flags & PropertyAccessInStaticMetaCall && m->d.static_metacall);
+
+        GadgetPropertyValue value(p.metaType());
+        if (!value.data) {
+            ds.setStatus(QDataStream::WriteFailed);
+            break;
+        }
+        int status = -1;
+        void *argv[] = { value.data, nullptr, &status };
+        m->d.static_metacall(reinterpret_cast<QObject *>(const_cast<void *>(gadget)),
+                             QMetaObject::ReadProperty, p.relativePropertyIndex(), argv);
+        if (!value.type.save(ds, argv[0]))
+            ds.setStatus(QDataStream::WriteFailed);
+    }
+}
+
+/*!
+    \internal
+
+    Reads the properties written by writeGadgetProperties() from \a ds into
+    the Q_GADGET \a gadget, whose meta-object is \a mo.
+
+    Sets QDataStream::ReadCorruptData if a property's type cannot be streamed.
+ */
+void readGadgetProperties(QDataStream &ds, const QMetaObject *mo, void *gadget)
+{
+    for (int i = 0, count = mo->propertyCount(); i < count && ds.status() == QDataStream::Ok; ++i) {
+        const QMetaProperty p = mo->property(i);
+        if (!isStreamedGadgetProperty(p))
+            continue;
+        const QMetaObject *m = p.enclosingMetaObject();
+        Q_ASSERT(priv(m->d.data)->flags & PropertyAccessInStaticMetaCall && m->d.static_metacall);
+
+        GadgetPropertyValue value(p.metaType());
+        if (!value.data || !value.type.load(ds, value.data)) {
+            ds.setStatus(QDataStream::ReadCorruptData);
+            break;
+        }
+        if (ds.status() != QDataStream::Ok)
+            break;
+        int status = -1;
+        int flags = 0;
+        void *argv[] = { value.data, nullptr, &status, &flags };
+        m->d.static_metacall(reinterpret_cast<QObject *>(gadget),
+                             QMetaObject::WriteProperty, p.relativePropertyIndex(), argv);
+    }
+}
+} // namespace QtPrivate
+
 QT_END_NAMESPACE
@@ -171,7 +171,8 @@ struct QMetaObjectPrivate
     // revision 7 is Qt 5.0 everything lower is not supported
     // revision 8 is Qt 5.12: It adds the enum name to QMetaEnum
     // revision 9 is Qt 6.0: It adds the metatype of properties and methods
-    enum { OutputRevision = 9 }; // Used by moc, qmetaobjectbuilder and qdbus
+    // revision 10 is Qt 6.0: It adds a hash table from method names to method indexes
+    enum { OutputRevision = 10 }; // Used by moc, qmetaobjectbuilder and qdbus
     enum { IntsPerMethod = QMetaMethod::Data::Size};
     enum { IntsPerEnum = QMetaEnum::Data::Size };
     enum { IntsPerProperty = QMetaProperty::Data::Size };
@@ -185,6 +186,55 @@ struct QMetaObjectPrivate
     int constructorCount, constructorData;
     int flags;
     int signalCount;
+    int methodHashSize, methodHashData;
+
+    // The method hash table, if present, starts with methodHashSize + 1
+    // bucket offsets followed by methodCount relative method indexes. The
+    // indexes of the methods whose name hashes to bucket b are stored, in
+    // descending order, at [offset[b], offset[b + 1]) after the offsets.
+    // methodHashSize is a power of two; zero means there is no table.
+    static constexpr uint methodNameHash(const char *name, qsizetype len) noexcept
+    {
+        uint h = 2166136261u; // FNV-1a, which is stable across moc and runtime builds
+        for (qsizetype i = 0; i < len; ++i)
+            h = (h ^ uchar(name[i])) * 16777619u;
+        return h;
+    }
+    static constexpr int methodHashBuckets(int methodCount) noexcept
+    {
+        int buckets = methodCount ? 1 : 0;
+        while (buckets < methodCount)
+            buckets *= 2;
+        return buckets;
+    }
+    static constexpr int methodHashTableSize(int methodCount) noexcept
+    {
+        return methodCount ? methodHashBuckets(methodCount) + 1 + methodCount : 0;
+    }
+    // Used by moc and QMetaObjectBuilder; nameAt(i) returns the name of
+    // the method with relative index i as a QByteArray.
+    template <typename NameAt>
+    static void fillMethodHashTable(int *table, int methodCount, NameAt nameAt)
+    {
+        const int buckets = methodHashBuckets(methodCount);
+        int *offsets = table;
+        int *entries = table + buckets + 1;
+        for (int b = 0; b <= buckets; ++b)
+            offsets[b] = 0;
+        for (int i = 0; i < methodCount; ++i) {
+            const auto name = nameAt(i);
+            ++offsets[methodNameHash(name.constData(), name.size()) & uint(buckets - 1)];
+        }
+        for (int b = 1; b < buckets; ++b)
+            offsets[b] += offsets[b - 1];
+        offsets[buckets] = methodCount;
+        // filling each bucket from its end leaves it in descending order
+        // and its offset pointing at its start
+        for (int i = 0; i < methodCount; ++i) {
+            const auto name = nameAt(i);
+            entries[--offsets[methodNameHash(name.constData(), name.size()) & uint(buckets - 1)]] = i;
+        }
+    }
 
     static inline const QMetaObjectPrivate *get(const QMetaObject *metaobject)
     { return reinterpret_cast<const QMetaObjectPrivate*>(metaobject->d.data); }
@@ -1193,7 +1193,7 @@ static int buildMetaObject(QMetaObjectBuilderPrivate *d, char *buf,
             - int(d->methods.size())       // return "parameters" don't have names
             - int(d->constructors.size()); // "this" parameters don't have names
     if (buf) {
-        static_assert(QMetaObjectPrivate::OutputRevision == 9, "QMetaObjectBuilder should generate the same version as moc");
+        static_assert(QMetaObjectPrivate::OutputRevision == 10, "QMetaObjectBuilder should generate the same version as moc");
         pmeta->revision = QMetaObjectPrivate::OutputRevision;
         pmeta->flags = d->flags;
         pmeta->className = 0;   // Class name is always the first string.
@@ -1222,6 +1222,10 @@ static int buildMetaObject(QMetaObjectBuilderPrivate *d, char *buf,
         pmeta->constructorCount = int(d->constructors.size());
         pmeta->constructorData = dataIndex;
         dataIndex += QMetaObjectPrivate::IntsPerMethod * int(d->constructors.size());
+
+        pmeta->methodHashSize = QMetaObjectPrivate::methodHashBuckets(int(d->methods.size()));
+        pmeta->methodHashData = pmeta->methodHashSize ? dataIndex : 0;
+        dataIndex += QMetaObjectPrivate::methodHashTableSize(int(d->methods.size()));
     } else {
         dataIndex += 2 * int(d->classInfoNames.size());
         dataIndex += QMetaObjectPrivate::IntsPerMethod * int(d->methods.size());
@@ -1232,6 +1236,7 @@ static int buildMetaObject(QMetaObjectBuilderPrivate *d, char *buf,
         dataIndex += QMetaObjectPrivate::IntsPerProperty * int(d->properties.size());
         dataIndex += QMetaObjectPrivate::IntsPerEnum * int(d->enumerators.size());
         dataIndex += QMetaObjectPrivate::IntsPerMethod * int(d->constructors.size());
+        dataIndex += QMetaObjectPrivate::methodHashTableSize(int(d->methods.size()));
     }
 
     // Allocate space for the enumerator key names and values.
@@ -1409,6 +1414,14 @@ static int buildMetaObject(QMetaObjectBuilderPrivate *d, char *buf,
         parameterMetaTypesIndex += argc;
     }
 
+    // Output the method name hash table.
+    Q_ASSERT(!buf || dataIndex == pmeta->methodHashData || !pmeta->methodHashSize);
+    if (buf && !d->methods.empty()) {
+        QMetaObjectPrivate::fillMethodHashTable(data + dataIndex, int(d->methods.size()),
+                                                [d](int i) { return d->methods[i].name(); });
+    }
+    dataIndex += QMetaObjectPrivate::methodHashTableSize(int(d->methods.size()));
+
     size += strings.blobSize();
 
     if (buf)
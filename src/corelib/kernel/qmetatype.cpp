@@ -85,9 +85,12 @@
 # include "qline.h"
 #endif
 
+#include <algorithm>
 #include <bitset>
+#include <memory>
 #include <new>
 #include <cstring>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -102,11 +105,164 @@ struct DefinedTypesFilter {
     };
 };
 
+// The tables below are read without locking. Writers are serialized by
+// QMetaTypeCustomRegistry::lock and never free anything a reader may still
+// be looking at: entries are only ever added or reset to null, and a table
+// that was outgrown stays allocated until the registry is destroyed. As
+// each table is twice the size of the one it replaces, that costs at most
+// as much memory as the live table.
+
+// Maps (normalized) type names to interfaces, by open addressing.
+class QMetaTypeNameTable
+{
+public:
+    QtPrivate::QMetaTypeInterface *value(const char *name, qsizetype length) const
+    {
+        const Table *t = current.loadAcquire();
+        if (!t)
+            return nullptr;
+        const Node *node = findNode(t, name, length, qHashBits(name, size_t(length)));
+        return node ? node->iface.loadAcquire() : nullptr;
+    }
+    QtPrivate::QMetaTypeInterface *value(const QByteArray &name) const
+    { return value(name.constData(), name.size()); }
+    qsizetype size() const { return qsizetype(nodes.size()); }
+
+    void insert(const QByteArray &name, QtPrivate::QMetaTypeInterface *iface)
+    {
+        const size_t hash = qHashBits(name.constData(), size_t(name.size()));
+        Table *t = current.loadRelaxed();
+        if (t) {
+            if (Node *node = findNode(t, name.constData(), name.size(), hash)) {
+                node->iface.storeRelease(iface);
+                return;
+            }
+        }
+        if (!t || (nodes.size() + 1) * 2 > t->mask + 1)
+            t = grow();
+        nodes.push_back(std::make_unique<Node>(name, hash, iface));
+        place(t, nodes.back().get());
+    }
+
+    void removeInterface(const QtPrivate::QMetaTypeInterface *iface)
+    {
+        for (const auto &node : nodes) {
+            if (node->iface.loadRelaxed() == iface)
+                node->iface.storeRelease(nullptr);
+        }
+    }
+
+private:
+    struct Node
+    {
+        Node(const QByteArray &name, size_t hash, QtPrivate::QMetaTypeInterface *iface)
+            : name(name), hash(hash), iface(iface) {}
+        const QByteArray name;
+        const size_t hash;
+        QAtomicPointer<QtPrivate::QMetaTypeInterface> iface;
+    };
+    struct Table
+    {
+        explicit Table(size_t capacity)
+            : mask(capacity - 1), buckets(new QAtomicPointer<Node>[capacity]) {}
+        const size_t mask;
+        const std::unique_ptr<QAtomicPointer<Node>[]> buckets;
+    };
+
+    static Node *findNode(const Table *t, const char *name, qsizetype length, size_t hash)
+    {
+        // never more than half full, so there always is an empty slot
+        for (size_t i = hash & t->mask; ; i = (i + 1) & t->mask) {
+            Node *node = t->buckets[i].loadAcquire();
+            if (!node)
+                return nullptr;
+            if (node->hash == hash && node->name.size() == length
+                    && memcmp(node->name.constData(), name, size_t(length)) == 0) {
+                return node;
+            }
+        }
+    }
+
+    static void place(Table *t, Node *node)
+    {
+        size_t i = node->hash & t->mask;
+        while (t->buckets[i].loadRelaxed())
+            i = (i + 1) & t->mask;
+        t->buckets[i].storeRelease(node);
+    }
+
+    Table *grow()
+    {
+        const Table *old = current.loadRelaxed();
+        auto t = std::make_unique<Table>(old ? (old->mask + 1) * 2 : 64);
+        for (const auto &node : nodes)
+            place(t.get(), node.get());
+        tables.push_back(std::move(t));
+        current.storeRelease(tables.back().get());
+        return tables.back().get();
+    }
+
+    QAtomicPointer<Table> current;
+    std::vector<std::unique_ptr<Table>> tables;
+    std::vector<std::unique_ptr<Node>> nodes;
+};
+
+// The interfaces of the custom types, indexed by id - QMetaType::User - 1.
+class QMetaTypeIdTable
+{
+public:
+    QtPrivate::QMetaTypeInterface *value(qsizetype index) const
+    {
+        const Table *t = current.loadAcquire();
+        if (!t || index < 0 || index >= t->capacity)
+            return nullptr;
+        return t->entries[index].loadAcquire();
+    }
+    QtPrivate::QMetaTypeInterface *at(qsizetype index) const
+    { return current.loadRelaxed()->entries[index].loadRelaxed(); }
+    qsizetype size() const { return count; }
+
+    void set(qsizetype index, QtPrivate::QMetaTypeInterface *iface)
+    {
+        Q_ASSERT(index < count);
+        current.loadRelaxed()->entries[index].storeRelease(iface);
+    }
+
+    void append(QtPrivate::QMetaTypeInterface *iface)
+    {
+        Table *t = current.loadRelaxed();
+        if (!t || count == t->capacity) {
+            auto grown = std::make_unique<Table>(t ? t->capacity * 2 : 64);
+            for (qsizetype i = 0; i < count; ++i)
+                grown->entries[i].storeRelaxed(t->entries[i].loadRelaxed());
+            tables.push_back(std::move(grown));
+            t = tables.back().get();
+            current.storeRelease(t);
+        }
+        t->entries[count++].storeRelease(iface);
+    }
+
+private:
+    struct Table
+    {
+        explicit Table(qsizetype capacity)
+            : capacity(capacity), entries(new QAtomicPointer<QtPrivate::QMetaTypeInterface>[capacity]) {}
+        const qsizetype capacity;
+        const std::unique_ptr<QAtomicPointer<QtPrivate::QMetaTypeInterface>[]> entries;
+    };
+
+    QAtomicPointer<Table> current;
+    std::vector<std::unique_ptr<Table>> tables;
+    qsizetype count = 0;
+};
+
 struct QMetaTypeCustomRegistry
 {
-    QReadWriteLock lock;
-    QList<QtPrivate::QMetaTypeInterface *> registry;
-    QHash<QByteArray, QtPrivate::QMetaTypeInterface *> aliases;
+    QReadWriteLock lock;            // serializes the writers
+    QMetaTypeIdTable registry;
+    QMetaTypeNameTable aliases;
+    // names that were found only after normalizing them; see qMetaTypeTypeImpl()
+    QMetaTypeNameTable unnormalizedNames;
     // index of first empty (unregistered) type in registry, if any.
     int firstEmpty = 0;
 
@@ -125,12 +281,12 @@ struct QMetaTypeCustomRegistry
                 ti->typeId.storeRelaxed(ti2->typeId.loadRelaxed());
                 return ti2->typeId;
             }
-            aliases[name] = ti;
+            aliases.insert(name, ti);
             int size = registry.size();
-            while (firstEmpty < size && registry[firstEmpty])
+            while (firstEmpty < size && registry.at(firstEmpty))
                 ++firstEmpty;
             if (firstEmpty < size) {
-                registry[firstEmpty] = ti;
+                registry.set(firstEmpty, ti);
                 ++firstEmpty;
             } else {
                 registry.append(ti);
@@ -150,25 +306,19 @@ struct QMetaTypeCustomRegistry
         Q_ASSERT(id > QMetaType::User);
         QWriteLocker l(&lock);
         int idx = id - QMetaType::User - 1;
-        auto &ti = registry[idx];
+        QtPrivate::QMetaTypeInterface *ti = registry.at(idx);
 
         // We must unregister all names.
-        auto it = aliases.begin();
-        while (it != aliases.end()) {
-            if (it.value() == ti)
-                it = aliases.erase(it);
-            else
-                ++it;
-        }
+        aliases.removeInterface(ti);
+        unnormalizedNames.removeInterface(ti);
 
-        ti = nullptr;
+        registry.set(idx, nullptr);
 
         firstEmpty = std::min(firstEmpty, idx);
     }
 
     QtPrivate::QMetaTypeInterface *getCustomType(int id)
     {
-        QReadLocker l(&lock);
         return registry.value(id - QMetaType::User - 1);
     }
 };
@@ -2237,28 +2387,50 @@ const char *QMetaType::name() const
 */
 static inline int qMetaTypeStaticType(const char *typeName, int length)
 {
-    int i = 0;
-    while (types[i].typeName && ((length != types[i].typeNameLength)
-                                 || memcmp(typeName, types[i].typeName, length))) {
-        ++i;
+    // open addressing over the indexes into types[], built on first use
+    struct StaticTypeIndex
+    {
+        enum : size_t { Size = 512 };
+        static_assert(sizeof(types) / sizeof(types[0]) * 2 < Size);
+        short buckets[Size];
+
+        StaticTypeIndex()
+        {
+            std::fill(std::begin(buckets), std::end(buckets), short(-1));
+            for (short i = 0; types[i].typeName; ++i) {
+                size_t slot = qHashBits(types[i].typeName, size_t(types[i].typeNameLength)) % Size;
+                bool duplicate = false;
+                while (buckets[slot] >= 0 && !duplicate) {
+                    const auto &other = types[buckets[slot]];
+                    duplicate = other.typeNameLength == types[i].typeNameLength
+                            && memcmp(other.typeName, types[i].typeName, size_t(other.typeNameLength)) == 0;
+                    slot = (slot + 1) % Size;
+                }
+                if (!duplicate)     // the first entry for a name wins
+                    buckets[slot] = i;
+            }
+        }
+    };
+    static const StaticTypeIndex index;
+
+    for (size_t slot = qHashBits(typeName, size_t(length)) % StaticTypeIndex::Size;
+         index.buckets[slot] >= 0; slot = (slot + 1) % StaticTypeIndex::Size) {
+        const auto &type = types[index.buckets[slot]];
+        if (type.typeNameLength == length && memcmp(type.typeName, typeName, size_t(length)) == 0)
+            return type.type;
     }
-    return types[i].type;
+    return QMetaType::UnknownType;
 }
 
 /*
     Similar to QMetaType::type(), but only looks in the custom set of
-    types, and doesn't lock the mutex.
-
+    types. Does not lock.
 */
-static int qMetaTypeCustomType_unlocked(const char *typeName, int length)
+static int qMetaTypeCustomType(const char *typeName, int length)
 {
     if (auto reg = customTypeRegistry()) {
-#if QT_CONFIG(thread)
-        Q_ASSERT(!reg->lock.tryLockForWrite());
-#endif
-        if (auto ti = reg->aliases.value(QByteArray(typeName, length), nullptr)) {
+        if (auto ti = reg->aliases.value(typeName, length))
             return ti->typeId;
-        }
     }
     return QMetaType::UnknownType;
 }
@@ -2277,10 +2449,9 @@ void QMetaType::registerNormalizedTypedef(const NS(QByteArray) & normalizedTypeN
         return;
     if (auto reg = customTypeRegistry()) {
         QWriteLocker lock(&reg->lock);
-        auto &al = reg->aliases[normalizedTypeName];
-        if (al)
+        if (reg->aliases.value(normalizedTypeName))
             return;
-        al = metaType.d_ptr;
+        reg->aliases.insert(normalizedTypeName, metaType.d_ptr);
     }
 }
 
@@ -2302,16 +2473,32 @@ static inline int qMetaTypeTypeImpl(const char *typeName, int length)
         return QMetaType::UnknownType;
     int type = qMetaTypeStaticType(typeName, length);
     if (type == QMetaType::UnknownType) {
-        QReadLocker locker(&customTypeRegistry()->lock);
-        type = qMetaTypeCustomType_unlocked(typeName, length);
+        type = qMetaTypeCustomType(typeName, length);
 #ifndef QT_NO_QOBJECT
         if ((type == QMetaType::UnknownType) && tryNormalizedType) {
+            // Normalizing is expensive; remember the names it resolved, but
+            // only successfully, as the type may still be registered later.
+            enum { MaxUnnormalizedNames = 1024 };
+            auto reg = customTypeRegistry();
+            if (!reg)
+                return type;
+            if (auto ti = reg->unnormalizedNames.value(typeName, length))
+                return ti->typeId;
+
             const NS(QByteArray) normalizedTypeName = QMetaObject::normalizedType(typeName);
+            QtPrivate::QMetaTypeInterface *ti = nullptr;
             type = qMetaTypeStaticType(normalizedTypeName.constData(),
                                        normalizedTypeName.size());
             if (type == QMetaType::UnknownType) {
-                type = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                                    normalizedTypeName.size());
+                ti = reg->aliases.value(normalizedTypeName);
+                if (ti)
+                    type = ti->typeId;
+            } else if (auto moduleHelper = qModuleHelperForType(type)) {
+                ti = moduleHelper->interfaceForType(type);
+            }
+            if (ti && reg->unnormalizedNames.size() < MaxUnnormalizedNames) {
+                QWriteLocker locker(&reg->lock);
+                reg->unnormalizedNames.insert(QByteArray(typeName, length), ti);
             }
         }
 #endif
@@ -2367,6 +2554,13 @@ Q_CORE_EXPORT int qMetaTypeTypeInternal(const char *typeName)
     Instead, use QVariant's \c operator<<(), which relies on save()
     to stream custom types.
 
+    Types declared with Q_GADGET that have no QDataStream operators of their
+    own are saved property by property: the stored, writable properties are written
+    in declaration order (base classes first), each with its type's stream
+    operator. No QVariant is created for the values and no type names are
+    written, so calling save() and load() directly on a gadget is a cheap
+    way to serialize it.
+
     \sa load()
 */
 bool QMetaType::save(QDataStream &stream, const void *data) const
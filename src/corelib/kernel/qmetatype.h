@@ -2437,13 +2437,33 @@ struct QDataStreamOperatorForType
     { ds >> *reinterpret_cast<T *>(a); }
 };
 
-template<typename T>
-struct QDataStreamOperatorForType <T, false>
+Q_CORE_EXPORT void writeGadgetProperties(QDataStream &ds, const QMetaObject *mo, const void *gadget);
+Q_CORE_EXPORT void readGadgetProperties(QDataStream &ds, const QMetaObject *mo, void *gadget);
+
+template<typename T, bool = IsGadgetHelper<T>::IsRealGadget>
+struct QGadgetDataStreamOperatorForType
 {
     static constexpr QMetaTypeInterface::DataStreamOutFn dataStreamOut = nullptr;
     static constexpr QMetaTypeInterface::DataStreamInFn dataStreamIn = nullptr;
 };
 
+#ifndef QT_BUILD_QMAKE // qmake is built without meta objects
+template<typename T>
+struct QGadgetDataStreamOperatorForType <T, true>
+{
+    static void dataStreamOut(const QMetaTypeInterface *, QDataStream &ds, const void *a)
+    { writeGadgetProperties(ds, &T::staticMetaObject, a); }
+    static void dataStreamIn(const QMetaTypeInterface *, QDataStream &ds, void *a)
+    { readGadgetProperties(ds, &T::staticMetaObject, a); }
+};
+#endif
+
+// gadgets without their own stream operators are streamed property by property
+template<typename T>
+struct QDataStreamOperatorForType <T, false> : QGadgetDataStreamOperatorForType<T>
+{
+};
+
 template<typename S>
 class QMetaTypeForType
 {
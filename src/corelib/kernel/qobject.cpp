@@ -65,6 +65,7 @@
 #endif
 #include <qsharedpointer.h>
 
+#include <private/qfreelist_p.h>
 #include <private/qorderedmutexlocker_p.h>
 #include <private/qhooks_p.h>
 #include <qtcore_tracepoints_p.h>
@@ -220,7 +221,7 @@ QObjectPrivate::~QObjectPrivate()
         }
     }
 
-    if (postedEvents)
+    if (postedEvents || thisThreadData->postEventList.hasIncomingEvents())
         QCoreApplication::removePostedEvents(q_ptr, 0);
 
     thisThreadData->deref();
@@ -350,16 +351,13 @@ void QObjectPrivate::ConnectionData::removeConnection(QObjectPrivate::Connection
         td->deref();
     c->receiverThreadData.storeRelaxed(nullptr);
 
-#ifndef QT_NO_DEBUG
-    bool found = false;
-    for (Connection *cc = connections.first.loadRelaxed(); cc; cc = cc->nextConnectionList.loadRelaxed()) {
-        if (cc == c) {
-            found = true;
-            break;
-        }
-    }
-    Q_ASSERT(found);
-#endif
+    // Check that c is linked into the list through its neighbours rather than
+    // by walking the list: that made debug builds quadratic when a sender with
+    // many receivers, or many receivers of one signal, got destroyed together.
+    Connection *p = c->prevConnectionList;
+    Connection *n = c->nextConnectionList.loadRelaxed();
+    Q_ASSERT(p ? p->nextConnectionList.loadRelaxed() == c : connections.first.loadRelaxed() == c);
+    Q_ASSERT(n ? n->prevConnectionList == c : connections.last.loadRelaxed() == c);
 
     // remove from the senders linked list
     *c->prev = c->next;
@@ -375,29 +373,18 @@ void QObjectPrivate::ConnectionData::removeConnection(QObjectPrivate::Connection
     Q_ASSERT(signalVector.loadRelaxed()->at(c->signal_index).last.loadRelaxed() != c);
 
     // keep c->nextConnectionList intact, as it might still get accessed by activate
-    Connection *n = c->nextConnectionList.loadRelaxed();
     if (n)
-        n->prevConnectionList = c->prevConnectionList;
-    if (c->prevConnectionList)
-        c->prevConnectionList->nextConnectionList.storeRelaxed(n);
+        n->prevConnectionList = p;
+    if (p)
+        p->nextConnectionList.storeRelaxed(n);
     c->prevConnectionList = nullptr;
+    Q_ASSERT(p ? p->nextConnectionList.loadRelaxed() == n : connections.first.loadRelaxed() == n);
+    Q_ASSERT(n ? n->prevConnectionList == p : connections.last.loadRelaxed() == p);
 
     Q_ASSERT(c != orphaned.loadRelaxed());
     // add c to orphanedConnections
     c->nextInOrphanList = orphaned.loadRelaxed();
     orphaned.storeRelaxed(c);
-
-#ifndef QT_NO_DEBUG
-    found = false;
-    for (Connection *cc = connections.first.loadRelaxed(); cc; cc = cc->nextConnectionList.loadRelaxed()) {
-        if (cc == c) {
-            found = true;
-            break;
-        }
-    }
-    Q_ASSERT(!found);
-#endif
-
 }
 
 void QObjectPrivate::ConnectionData::cleanOrphanedConnectionsImpl(QObject *sender)
@@ -498,6 +485,83 @@ QAbstractMetaCallEvent::~QAbstractMetaCallEvent()
 #endif
 }
 
+namespace {
+// Queued connections allocate one QMetaCallEvent per emission, usually in one
+// thread and delete it in another. Recycle their memory through a lock-free
+// free list instead of going through the heap every time.
+struct MetaCallEventSlot
+{
+    alignas(QMetaCallEvent) char storage[sizeof(QMetaCallEvent)];
+    int id; // index in the free list, or -1 if allocated on the heap
+};
+
+struct MetaCallEventFreeListConstants : QFreeListDefaultConstants {
+    enum { BlockCount = 4, MaxIndex = 0xffff };
+    static const int Sizes[BlockCount];
+};
+const int MetaCallEventFreeListConstants::Sizes[MetaCallEventFreeListConstants::BlockCount] = {
+    64,
+    512,
+    4096,
+    MetaCallEventFreeListConstants::MaxIndex - (64 + 512 + 4096)
+};
+
+typedef QFreeList<MetaCallEventSlot, MetaCallEventFreeListConstants> MetaCallEventFreeList;
+// The events live inside the free list's blocks, and events still posted to
+// global objects can be deleted during static destruction. So the list is
+// intentionally never destroyed: destroying it would free their memory.
+static MetaCallEventFreeList &metaCallEventFreeList()
+{
+    static MetaCallEventFreeList *list = new MetaCallEventFreeList;
+    return *list;
+}
+// The free list cannot grow past MaxIndex, fall back to the heap when it is full
+static QBasicAtomicInt metaCallEventSlotsInUse = Q_BASIC_ATOMIC_INITIALIZER(0);
+}
+
+/*!
+    \internal
+ */
+void *QMetaCallEvent::operator new(std::size_t size)
+{
+    if (size != sizeof(QMetaCallEvent))
+        return ::operator new(size); // subclass
+
+    if (metaCallEventSlotsInUse.fetchAndAddRelaxed(1) < MetaCallEventFreeListConstants::MaxIndex) {
+        MetaCallEventFreeList &freeList = metaCallEventFreeList();
+        const int id = freeList.next();
+        MetaCallEventSlot &slot = freeList[id];
+        slot.id = id;
+        return slot.storage;
+    }
+    metaCallEventSlotsInUse.fetchAndSubRelaxed(1);
+
+    MetaCallEventSlot *slot = new MetaCallEventSlot;
+    slot->id = -1;
+    return slot->storage;
+}
+
+/*!
+    \internal
+ */
+void QMetaCallEvent::operator delete(void *ptr, std::size_t size) noexcept
+{
+    if (!ptr)
+        return;
+    if (size != sizeof(QMetaCallEvent)) {
+        ::operator delete(ptr); // subclass
+        return;
+    }
+
+    MetaCallEventSlot *slot = reinterpret_cast<MetaCallEventSlot *>(ptr);
+    if (slot->id < 0) {
+        delete slot;
+        return;
+    }
+    metaCallEventFreeList().release(slot->id);
+    metaCallEventSlotsInUse.fetchAndSubRelaxed(1);
+}
+
 /*!
     \internal
  */
@@ -615,6 +679,93 @@ void QMetaCallEvent::placeMetaCall(QObject *object)
     }
 }
 
+inline void QBatchedMetaCallEvent::allocArgs()
+{
+    if (!d.nargs_)
+        return;
+
+    void *const memory = calloc(1, d.count_ * d.nargs_ * sizeof(void *) + d.nargs_ * sizeof(QMetaType));
+    Q_CHECK_PTR(memory);
+    d.args_ = static_cast<void **>(memory);
+}
+
+/*!
+    \internal
+
+    Allocates memory for \a count sets of \a nargs arguments; code creating
+    an event needs to initialize the void* arrays by accessing \a args() for
+    each emission and the shared type array by accessing \a types().
+ */
+QBatchedMetaCallEvent::QBatchedMetaCallEvent(ushort method_offset, ushort method_relative,
+                                             QObjectPrivate::StaticMetaCallFunction callFunction,
+                                             const QObject *sender, int signalId,
+                                             int nargs, int count)
+    : QAbstractMetaCallEvent(sender, signalId),
+      d({nullptr, nullptr, callFunction, nargs, count, method_offset, method_relative})
+{
+    allocArgs();
+}
+
+/*!
+    \internal
+
+    Allocates memory for \a count sets of \a nargs arguments; code creating
+    an event needs to initialize the void* arrays by accessing \a args() for
+    each emission and the shared type array by accessing \a types().
+ */
+QBatchedMetaCallEvent::QBatchedMetaCallEvent(QtPrivate::QSlotObjectBase *slotO,
+                                             const QObject *sender, int signalId,
+                                             int nargs, int count)
+    : QAbstractMetaCallEvent(sender, signalId),
+      d({slotO, nullptr, nullptr, nargs, count, 0, ushort(-1)})
+{
+    if (d.slotObj_)
+        d.slotObj_->ref();
+    allocArgs();
+}
+
+/*!
+    \internal
+ */
+QBatchedMetaCallEvent::~QBatchedMetaCallEvent()
+{
+    if (d.nargs_) {
+        QMetaType *t = types();
+        for (int emission = 0; emission < d.count_; ++emission) {
+            void **a = args(emission);
+            for (int i = 0; i < d.nargs_; ++i) {
+                if (t[i].isValid() && a[i])
+                    t[i].destroy(a[i]);
+            }
+        }
+        free(d.args_);
+    }
+    if (d.slotObj_)
+        d.slotObj_->destroyIfLastRef();
+}
+
+/*!
+    \internal
+
+    Invokes the slot once per emission, in emission order. Delivery stops
+    early if one of the calls destroys \a object.
+ */
+void QBatchedMetaCallEvent::placeMetaCall(QObject *object)
+{
+    QPointer<QObject> guard(object);
+    for (int emission = 0; emission < d.count_ && guard; ++emission) {
+        void **a = d.nargs_ ? args(emission) : nullptr;
+        if (d.slotObj_) {
+            d.slotObj_->call(object, a);
+        } else if (d.callFunction_ && d.method_offset_ <= object->metaObject()->methodOffset()) {
+            d.callFunction_(object, QMetaObject::InvokeMetaMethod, d.method_relative_, a);
+        } else {
+            QMetaObject::metacall(object, QMetaObject::InvokeMetaMethod,
+                                  d.method_offset_ + d.method_relative_, a);
+        }
+    }
+}
+
 /*!
     \class QSignalBlocker
     \brief Exception-safe wrapper around QObject::blockSignals().
@@ -1026,7 +1177,10 @@ QObject::~QObject()
             // Send disconnectNotify before removing the connection from sender's connection list.
             // This ensures any eventual destructor of sender will block on getting receiver's lock
             // and not finish until we release it.
-            sender->disconnectNotify(QMetaObjectPrivate::signal(sender->metaObject(), node->signal_index));
+            // A sender that is itself being destroyed can only run the empty base
+            // implementation, so skip the signal lookup when tearing down a subtree.
+            if (!sender->d_func()->wasDeleted)
+                sender->disconnectNotify(QMetaObjectPrivate::signal(sender->metaObject(), node->signal_index));
             QBasicMutex *m = signalSlotLock(sender);
             bool needToUnlock = QOrderedMutexLocker::relock(signalSlotMutex, m);
             //the node has maybe been removed while the mutex was unlocked in relock?
@@ -1570,6 +1724,28 @@ void QObject::moveToThread(QThread *targetThread)
     // move the object
     d_func()->setThreadData_helper(currentData, targetData);
 
+    // Events posted lock-free by threads that looked up the old thread data
+    // before the move landed in currentData; they have to follow the objects.
+    // Pairs with the fence in QCoreApplicationPrivate::postEventLockFree().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (currentData->postEventList.activePushers.loadAcquire())
+        QThread::yieldCurrentThread();
+    if (currentData->postEventList.mergeIncoming()) {
+        int eventsMoved = 0;
+        for (int i = 0; i < currentData->postEventList.size(); ++i) {
+            const QPostEvent &pe = currentData->postEventList.at(i);
+            if (pe.event && QObjectPrivate::get(pe.receiver)->threadData.loadRelaxed() == targetData) {
+                targetData->postEventList.addEvent(pe);
+                const_cast<QPostEvent &>(pe).event = nullptr;
+                ++eventsMoved;
+            }
+        }
+        if (eventsMoved > 0 && targetData->hasEventDispatcher()) {
+            targetData->canWait = false;
+            targetData->eventDispatcher.loadRelaxed()->wakeUp();
+        }
+    }
+
     locker.unlock();
 
     // now currentData can commit suicide if it wants to
@@ -3608,9 +3784,12 @@ void QMetaObject::connectSlotsByName(QObject *o)
 /*!
     \internal
 
+    Returns the argument types of the queued connection \a c, or \nullptr if
+    they cannot be queued.
+
     \a signal must be in the signal index range (see QObjectPrivate::signalIndex()).
 */
-static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connection *c, void **argv)
+static const int *queuedArgumentTypes(QObject *sender, int signal, QObjectPrivate::Connection *c)
 {
     const int *argumentTypes = c->argumentTypes.loadRelaxed();
     if (!argumentTypes) {
@@ -3625,6 +3804,19 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         }
     }
     if (argumentTypes == &DIRECT_CONNECTION_ONLY) // cannot activate
+        return nullptr;
+    return argumentTypes;
+}
+
+/*!
+    \internal
+
+    \a signal must be in the signal index range (see QObjectPrivate::signalIndex()).
+*/
+static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connection *c, void **argv)
+{
+    const int *argumentTypes = queuedArgumentTypes(sender, signal, c);
+    if (!argumentTypes) // cannot activate
         return;
     int nargs = 1; // include return type
     while (argumentTypes[nargs-1])
@@ -3667,10 +3859,132 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         return;
     }
 
+    Q_TRACE(QMetaObject_activate_queued, sender, signal, c->receiver.loadRelaxed());
     QCoreApplication::postEvent(c->receiver.loadRelaxed(), ev);
 }
 
-template <bool callbacks_enabled>
+/*!
+    \internal
+
+    Like queued_activate(), but posts a single event that carries the
+    arguments of all \a count emissions in \a argvs.
+*/
+static void queued_activate_batch(QObject *sender, int signal, QObjectPrivate::Connection *c,
+                                  void **const *argvs, int count)
+{
+    const int *argumentTypes = queuedArgumentTypes(sender, signal, c);
+    if (!argumentTypes) // cannot activate
+        return;
+    int nargs = 1; // include return type
+    while (argumentTypes[nargs-1])
+        ++nargs;
+
+    QBasicMutexLocker locker(signalSlotLock(c->receiver.loadRelaxed()));
+    if (!c->receiver.loadRelaxed()) {
+        // the connection has been disconnected before we got the lock
+        return;
+    }
+    if (c->isSlotObject)
+        c->slotObj->ref();
+    locker.unlock();
+
+    QBatchedMetaCallEvent *ev = c->isSlotObject ?
+        new QBatchedMetaCallEvent(c->slotObj, sender, signal, nargs, count) :
+        new QBatchedMetaCallEvent(c->method_offset, c->method_relative, c->callFunction, sender,
+                                  signal, nargs, count);
+
+    QMetaType *types = ev->types();
+    types[0] = QMetaType(); // return type
+    for (int n = 1; n < nargs; ++n)
+        types[n] = QMetaType(argumentTypes[n-1]);
+
+    for (int emission = 0; emission < count; ++emission) {
+        void **args = ev->args(emission);
+        args[0] = nullptr; // return value
+        for (int n = 1; n < nargs; ++n)
+            args[n] = types[n].create(argvs[emission][n]);
+    }
+
+    locker.relock();
+    if (c->isSlotObject)
+        c->slotObj->destroyIfLastRef();
+    if (!c->receiver.loadRelaxed()) {
+        // the connection has been disconnected while we were unlocked
+        locker.unlock();
+        delete ev;
+        return;
+    }
+
+    Q_TRACE(QMetaObject_activate_queued, sender, signal, c->receiver.loadRelaxed());
+    QCoreApplication::postEvent(c->receiver.loadRelaxed(), ev);
+}
+
+/*!
+    \internal
+
+    Posts one batched event to each queued receiver of \a signal_index.
+    Returns \c true if there are connections that still need to be
+    activated directly, once per emission.
+*/
+static bool activateQueuedBatch(QObject *sender, int signal_index, void **const *argvs, int count)
+{
+    QObjectPrivate *sp = QObjectPrivate::get(sender);
+    bool needsDirectActivation = false;
+    {
+    Q_ASSERT(sp->connections.loadAcquire());
+    QObjectPrivate::ConnectionDataPointer connections(sp->connections.loadRelaxed());
+    QObjectPrivate::SignalVector *signalVector = connections->signalVector.loadRelaxed();
+
+    const QObjectPrivate::ConnectionList *list;
+    if (signal_index < signalVector->count())
+        list = &signalVector->at(signal_index);
+    else
+        list = &signalVector->at(-1);
+
+    Qt::HANDLE currentThreadId = QThread::currentThreadId();
+    bool inSenderThread = currentThreadId == sp->threadData.loadRelaxed()->threadId.loadRelaxed();
+
+    uint highestConnectionId = connections->currentConnectionId.loadRelaxed();
+    do {
+        QObjectPrivate::Connection *c = list->first.loadRelaxed();
+        if (!c)
+            continue;
+
+        do {
+            QObject * const receiver = c->receiver.loadRelaxed();
+            if (!receiver)
+                continue;
+
+            QThreadData *td = c->receiverThreadData.loadRelaxed();
+            if (!td)
+                continue;
+
+            bool receiverInSameThread;
+            if (inSenderThread) {
+                receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
+            } else {
+                // need to lock before reading the threadId, because moveToThread() could interfere
+                QMutexLocker lock(signalSlotLock(receiver));
+                receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
+            }
+
+            if ((c->connectionType == Qt::AutoConnection && !receiverInSameThread)
+                || (c->connectionType == Qt::QueuedConnection)) {
+                queued_activate_batch(sender, signal_index, c, argvs, count);
+            } else {
+                needsDirectActivation = true;
+            }
+        } while ((c = c->nextConnectionList.loadRelaxed()) != nullptr && c->id <= highestConnectionId);
+
+    } while (list != &signalVector->at(-1) &&
+        //start over for all signals;
+        ((list = &signalVector->at(-1)), true));
+    }
+    sp->connections.loadRelaxed()->cleanOrphanedConnections(sender);
+    return needsDirectActivation;
+}
+
+template <bool callbacks_enabled, bool queued_batched = false>
 void doActivate(QObject *sender, int signal_index, void **argv)
 {
     QObjectPrivate *sp = QObjectPrivate::get(sender);
@@ -3751,7 +4065,9 @@ void doActivate(QObject *sender, int signal_index, void **argv)
             // put into the event queue
             if ((c->connectionType == Qt::AutoConnection && !receiverInSameThread)
                 || (c->connectionType == Qt::QueuedConnection)) {
-                queued_activate(sender, signal_index, c, argv);
+                // batched emissions have already been posted by activateQueuedBatch()
+                if (!queued_batched)
+                    queued_activate(sender, signal_index, c, argv);
                 continue;
 #if QT_CONFIG(thread)
             } else if (c->connectionType == Qt::BlockingQueuedConnection) {
@@ -3879,6 +4195,63 @@ void QMetaObject::activate(QObject *sender, int signal_index, void **argv)
     activate(sender, mo, signal_index - mo->methodOffset(), argv);
 }
 
+/*!
+    \internal
+
+    Emits the signal \a signal_index of \a sender once for each of the
+    \a count argument vectors in \a argvs. Directly connected slots are
+    called once per emission, as with QMetaObject::activate(). Each queued
+    connection receives a single QBatchedMetaCallEvent carrying all
+    emissions, which is posted before the direct connections are called.
+
+    \a signal_index must be in the signal index range (see QObjectPrivate::signalIndex()).
+*/
+void QObjectPrivate::activateBatch(QObject *sender, int signal_index, void **const *argvs, int count)
+{
+    QObjectPrivate *sp = QObjectPrivate::get(sender);
+    if (sp->blockSig || count <= 0)
+        return;
+
+    bool needsDirectActivation = false;
+    if (sp->maybeSignalConnected(signal_index))
+        needsDirectActivation = activateQueuedBatch(sender, signal_index, argvs, count);
+
+    const bool callbacks = qt_signal_spy_callback_set.loadRelaxed() != nullptr;
+    if (!needsDirectActivation && !callbacks && !sp->isDeclarativeSignalConnected(signal_index))
+        return;
+
+    for (int emission = 0; emission < count; ++emission) {
+        if (Q_UNLIKELY(callbacks))
+            doActivate<true, true>(sender, signal_index, argvs[emission]);
+        else
+            doActivate<false, true>(sender, signal_index, argvs[emission]);
+    }
+}
+
+/*!
+    \internal
+
+    Overload used by QObjectPrivate::emitBatch(); \a signal is a pointer to
+    the signal's member function pointer.
+*/
+void QObjectPrivate::activateBatch(QObject *sender, void **signal, const QMetaObject *senderMetaObject,
+                                   void **const *argvs, int count)
+{
+    int signal_index = -1;
+    void *args[] = { &signal_index, signal };
+    for (; senderMetaObject && signal_index < 0; senderMetaObject = senderMetaObject->superClass()) {
+        senderMetaObject->static_metacall(QMetaObject::IndexOfMethod, 0, args);
+        if (signal_index >= 0 && signal_index < QMetaObjectPrivate::get(senderMetaObject)->signalCount)
+            break;
+    }
+    if (!senderMetaObject) {
+        qWarning("QObjectPrivate::emitBatch: signal not found in %s", sender->metaObject()->className());
+        return;
+    }
+    signal_index += QMetaObjectPrivate::signalOffset(senderMetaObject);
+    activateBatch(sender, signal_index, argvs, count);
+}
+
 /*!
     \internal
     Returns the signal index used in the internal connections->receivers vector.
@@ -60,6 +60,9 @@
 #include "QtCore/qreadwritelock.h"
 #include "QtCore/qsharedpointer.h"
 #include "QtCore/qvariant.h"
+#include "QtCore/qvarlengtharray.h"
+
+#include <tuple>
 
 QT_BEGIN_NAMESPACE
 
@@ -278,9 +281,12 @@ public:
 
         void resizeSignalVector(uint size) {
             SignalVector *vector = this->signalVector.loadRelaxed();
-            if (vector && vector->allocated > size)
+            if (vector && vector->allocated >= size)
                 return;
-            size = (size + 7) & ~7;
+            // Most objects only ever have one or two of their signals connected,
+            // so the first vector is sized exactly and later ones grow by half.
+            if (vector)
+                size = qMax(size, uint(vector->allocated + vector->allocated / 2));
             SignalVector *newVector = reinterpret_cast<SignalVector *>(malloc(sizeof(SignalVector) + (size + 1) * sizeof(ConnectionList)));
             int start = -1;
             if (vector) {
@@ -353,6 +359,13 @@ public:
     static QMetaObject::Connection connect(const QObject *sender, int signal_index, QtPrivate::QSlotObjectBase *slotObj, Qt::ConnectionType type);
     static bool disconnect(const QObject *sender, int signal_index, void **slot);
 
+    template <typename Func, typename... Args>
+    static inline void emitBatch(typename QtPrivate::FunctionPointer<Func>::Object *sender, Func signal,
+                                 const std::tuple<Args...> *argumentPacks, int count);
+    static void activateBatch(QObject *sender, void **signal, const QMetaObject *senderMetaObject,
+                              void **const *argvs, int count);
+    static void activateBatch(QObject *sender, int signal_index, void **const *argvs, int count);
+
     void ensureConnectionData()
     {
         if (connections.loadRelaxed())
@@ -447,6 +460,10 @@ template<typename Func, typename Args, typename R> class QPrivateSlotObject : pu
 public:
     explicit QPrivateSlotObject(Func f) : QSlotObjectBase(&impl), function(f) {}
 };
+
+template <typename List> struct DecayedArguments;
+template <typename... Args> struct DecayedArguments<List<Args...>>
+{ typedef List<typename std::decay<Args>::type...> Type; };
 } //namespace QtPrivate
 
 template <typename Func1, typename Func2>
@@ -494,6 +511,39 @@ bool QObjectPrivate::disconnect(const typename QtPrivate::FunctionPointer< Func1
                           &SignalType::Object::staticMetaObject);
 }
 
+/*
+    Emits \a signal of \a sender once for each of the \a count argument
+    packs. Queued connections receive a single event carrying all packs
+    instead of one event per emission.
+*/
+template <typename Func, typename... Args>
+inline void QObjectPrivate::emitBatch(typename QtPrivate::FunctionPointer<Func>::Object *sender, Func signal,
+                                      const std::tuple<Args...> *argumentPacks, int count)
+{
+    typedef QtPrivate::FunctionPointer<Func> SignalType;
+    static_assert(QtPrivate::HasQ_OBJECT_Macro<typename SignalType::Object>::Value,
+                      "No Q_OBJECT in the class with the signal");
+    static_assert(std::is_same<typename QtPrivate::DecayedArguments<typename SignalType::Arguments>::Type,
+                               QtPrivate::List<Args...>>::value,
+                      "The argument packs do not match the arguments of the signal.");
+
+    constexpr int nargs = int(sizeof...(Args)) + 1; // include return value
+    QVarLengthArray<void *, 16 * nargs> args(count * nargs);
+    QVarLengthArray<void **, 16> argvs(count);
+    for (int i = 0; i < count; ++i) {
+        void **argv = args.data() + i * nargs;
+        argv[0] = nullptr;
+        std::apply([argv](const Args &... a) {
+            void **arg = argv + 1;
+            ((*arg++ = const_cast<void *>(static_cast<const void *>(std::addressof(a)))), ...);
+            Q_UNUSED(arg);
+        }, argumentPacks[i]);
+        argvs[i] = argv;
+    }
+    activateBatch(sender, reinterpret_cast<void **>(&signal), &SignalType::Object::staticMetaObject,
+                  argvs.constData(), count);
+}
+
 Q_DECLARE_TYPEINFO(QObjectPrivate::Connection, Q_MOVABLE_TYPE);
 Q_DECLARE_TYPEINFO(QObjectPrivate::Sender, Q_MOVABLE_TYPE);
 
@@ -545,6 +595,10 @@ public:
 
     ~QMetaCallEvent() override;
 
+    // recycled through a lock-free free list
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr, std::size_t size) noexcept;
+
     inline int id() const { return d.method_offset_ + d.method_relative_; }
     inline const void * const* args() const { return d.args_; }
     inline void ** args() { return d.args_; }
@@ -568,6 +622,43 @@ private:
     alignas(void *) char prealloc_[3*sizeof(void*) + 3*sizeof(QMetaType)];
 };
 
+class Q_CORE_EXPORT QBatchedMetaCallEvent : public QAbstractMetaCallEvent
+{
+public:
+    // queued - one set of args per emission, all sharing the same types;
+    // args allocated by event, copied by caller
+    QBatchedMetaCallEvent(ushort method_offset, ushort method_relative,
+                          QObjectPrivate::StaticMetaCallFunction callFunction,
+                          const QObject *sender, int signalId,
+                          int nargs, int count);
+    QBatchedMetaCallEvent(QtPrivate::QSlotObjectBase *slotObj,
+                          const QObject *sender, int signalId,
+                          int nargs, int count);
+
+    ~QBatchedMetaCallEvent() override;
+
+    inline int id() const { return d.method_offset_ + d.method_relative_; }
+    inline int count() const { return d.count_; }
+    inline void **args(int emission) { return d.args_ + emission * d.nargs_; }
+    inline const QMetaType *types() const { return reinterpret_cast<QMetaType *>(d.args_ + d.count_ * d.nargs_); }
+    inline QMetaType *types() { return reinterpret_cast<QMetaType *>(d.args_ + d.count_ * d.nargs_); }
+
+    virtual void placeMetaCall(QObject *object) override;
+
+private:
+    inline void allocArgs();
+
+    struct Data {
+        QtPrivate::QSlotObjectBase *slotObj_;
+        void **args_;
+        QObjectPrivate::StaticMetaCallFunction callFunction_;
+        int nargs_;
+        int count_;
+        ushort method_offset_;
+        ushort method_relative_;
+    } d;
+};
+
 class QBoolBlocker
 {
     Q_DISABLE_COPY_MOVE(QBoolBlocker)
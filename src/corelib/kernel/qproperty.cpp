@@ -41,11 +41,56 @@
 #include "qproperty_p.h"
 
 #include <qscopedvaluerollback.h>
+#include <qset.h>
+
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
 using namespace QtPrivate;
 
+namespace {
+// Notifications deferred by Qt::beginPropertyUpdateGroup(). Bindings are
+// still marked dirty right away, but change handlers and static observers
+// only run when the outermost group ends, so that every dirty binding is
+// evaluated at most once, when a handler or a reader asks for its value.
+struct QPropertyUpdateGroupState
+{
+    int depth = 0;
+    std::vector<std::pair<QPropertyBase *, void *>> properties;
+    std::vector<QPropertyBindingPrivatePtr> bindings;
+    QSet<const void *> queued;
+    // properties of the group currently being flushed, so that the ones
+    // destroyed by a change handler are not notified anymore
+    QSet<const void *> *flushing = nullptr;
+
+    bool isActive() const { return depth > 0; }
+
+    void queueProperty(QPropertyBase *property, void *propertyDataPtr)
+    {
+        if (!queued.contains(property)) {
+            queued.insert(property);
+            properties.emplace_back(property, propertyDataPtr);
+        }
+    }
+    void queueBinding(QPropertyBindingPrivate *binding)
+    {
+        if (!queued.contains(binding)) {
+            queued.insert(binding);
+            bindings.emplace_back(binding);
+        }
+    }
+    void forgetProperty(const QPropertyBase *property)
+    {
+        queued.remove(property);
+        if (flushing)
+            flushing->remove(property);
+    }
+};
+}
+
+static thread_local QPropertyUpdateGroupState propertyUpdateGroup;
+
 void QPropertyBasePointer::addObserver(QPropertyObserver *observer)
 {
     if (auto *binding = bindingPtr()) {
@@ -84,16 +129,37 @@ void QPropertyBindingPrivate::markDirtyAndNotifyObservers()
     if (dirty)
         return;
     dirty = true;
+    if (Q_UNLIKELY(propertyUpdateGroup.isActive())) {
+        const bool hasChangeHandlers = firstObserver
+                && firstObserver.notify(this, propertyDataPtr, QPropertyObserverPointer::MarkBindingsDirty);
+        if (hasChangeHandlers || hasStaticObserver)
+            propertyUpdateGroup.queueBinding(this);
+        return;
+    }
     if (firstObserver)
         firstObserver.notify(this, propertyDataPtr);
-    if (hasStaticObserver) {
-        if (isBool) {
-            auto propertyPtr = reinterpret_cast<QPropertyBase *>(propertyDataPtr);
-            bool oldValue = propertyPtr->extraBit();
-            staticObserverCallback(staticObserver, &oldValue);
-        } else {
-            staticObserverCallback(staticObserver, propertyDataPtr);
-        }
+    if (hasStaticObserver)
+        notifyStaticObserver();
+}
+
+void QPropertyBindingPrivate::notifyDeferredObservers()
+{
+    if (!propertyDataPtr)
+        return; // the binding was removed from its property in the meantime
+    if (firstObserver)
+        firstObserver.notify(this, propertyDataPtr, QPropertyObserverPointer::NotifyChangeHandlers);
+    if (hasStaticObserver)
+        notifyStaticObserver();
+}
+
+void QPropertyBindingPrivate::notifyStaticObserver()
+{
+    if (isBool) {
+        auto propertyPtr = reinterpret_cast<QPropertyBase *>(propertyDataPtr);
+        bool oldValue = propertyPtr->extraBit();
+        staticObserverCallback(staticObserver, &oldValue);
+    } else {
+        staticObserverCallback(staticObserver, propertyDataPtr);
     }
 }
 
@@ -241,6 +307,8 @@ void QPropertyBase::moveAssign(QPropertyBase &&other, void *propertyDataPtr)
 
 QPropertyBase::~QPropertyBase()
 {
+    if (Q_UNLIKELY(propertyUpdateGroup.isActive() || propertyUpdateGroup.flushing))
+        propertyUpdateGroup.forgetProperty(this);
     QPropertyBasePointer d{this};
     for (auto observer = d.firstObserver(); observer;) {
         auto next = observer.nextObserver();
@@ -361,8 +429,14 @@ void QPropertyBase::registerWithCurrentlyEvaluatingBinding() const
 void QPropertyBase::notifyObservers(void *propertyDataPtr)
 {
     QPropertyBasePointer d{this};
-    if (QPropertyObserverPointer observer = d.firstObserver())
+    if (QPropertyObserverPointer observer = d.firstObserver()) {
+        if (Q_UNLIKELY(propertyUpdateGroup.isActive())) {
+            if (observer.notify(d.bindingPtr(), propertyDataPtr, QPropertyObserverPointer::MarkBindingsDirty))
+                propertyUpdateGroup.queueProperty(this, propertyDataPtr);
+            return;
+        }
         observer.notify(d.bindingPtr(), propertyDataPtr);
+    }
 }
 
 int QPropertyBasePointer::observerCount() const
@@ -460,23 +534,32 @@ void QPropertyObserverPointer::setBindingToMarkDirty(QPropertyBindingPrivate *bi
     ptr->next.setTag(QPropertyObserver::ObserverNotifiesBinding);
 }
 
-void QPropertyObserverPointer::notify(QPropertyBindingPrivate *triggeringBinding, void *propertyDataPtr)
+bool QPropertyObserverPointer::notify(QPropertyBindingPrivate *triggeringBinding, void *propertyDataPtr,
+                                      NotificationMode mode)
 {
     bool knownIfPropertyChanged = false;
     bool propertyChanged = true;
+    bool hasChangeHandlers = false;
 
     auto observer = const_cast<QPropertyObserver*>(ptr);
     while (observer) {
         auto * const next = observer->next.data();
         switch (observer->next.tag()) {
         case QPropertyObserver::ObserverNotifiesChangeHandler:
+            if (mode == MarkBindingsDirty) {
+                hasChangeHandlers = true;
+                break;
+            }
             if (!knownIfPropertyChanged && triggeringBinding) {
                 knownIfPropertyChanged = true;
 
-                propertyChanged = triggeringBinding->evaluateIfDirtyAndReturnTrueIfValueChanged();
+                // A deferred binding that was read, and thus evaluated, while its
+                // update group was still open may have changed without being dirty.
+                if (mode == NotifyAll || triggeringBinding->isDirty())
+                    propertyChanged = triggeringBinding->evaluateIfDirtyAndReturnTrueIfValueChanged();
             }
             if (!propertyChanged)
-                return;
+                return hasChangeHandlers;
 
             if (auto handlerToCall = std::exchange(observer->changeHandler, nullptr)) {
                 handlerToCall(observer, propertyDataPtr);
@@ -484,7 +567,7 @@ void QPropertyObserverPointer::notify(QPropertyBindingPrivate *triggeringBinding
             }
             break;
         case QPropertyObserver::ObserverNotifiesBinding:
-            if (observer->bindingToMarkDirty)
+            if (mode != NotifyChangeHandlers && observer->bindingToMarkDirty)
                 observer->bindingToMarkDirty->markDirtyAndNotifyObservers();
             break;
         case QPropertyObserver::ObserverNotifiesAlias:
@@ -492,6 +575,7 @@ void QPropertyObserverPointer::notify(QPropertyBindingPrivate *triggeringBinding
         }
         observer = next;
     }
+    return hasChangeHandlers;
 }
 
 void QPropertyObserverPointer::observeProperty(QPropertyBasePointer property)
@@ -501,6 +585,95 @@ void QPropertyObserverPointer::observeProperty(QPropertyBasePointer property)
     property.addObserver(ptr);
 }
 
+/*!
+    \since 6.0
+    \relates QProperty
+
+    Starts a group of property updates. While a group is active, changing a
+    property marks the bindings that depend on it as dirty, but neither
+    evaluates them nor calls change handlers or the notifiers of
+    QNotifiedProperty bindings. These notifications are delivered once,
+    when the outermost group is ended with endPropertyUpdateGroup().
+
+    Use this when updating many interdependent properties at once: each
+    affected binding is then evaluated at most once instead of after every
+    individual change.
+
+    Groups can be nested and are local to the current thread.
+
+    \sa Qt::endPropertyUpdateGroup(), QScopedPropertyUpdateGroup
+*/
+void Qt::beginPropertyUpdateGroup()
+{
+    ++propertyUpdateGroup.depth;
+}
+
+/*!
+    \since 6.0
+    \relates QProperty
+
+    Ends a group of property updates started with beginPropertyUpdateGroup().
+    When the outermost group ends, the change handlers and notifiers of all
+    properties changed inside the group are called.
+
+    \sa Qt::beginPropertyUpdateGroup(), QScopedPropertyUpdateGroup
+*/
+void Qt::endPropertyUpdateGroup()
+{
+    auto &group = propertyUpdateGroup;
+    Q_ASSERT_X(group.depth > 0, "Qt::endPropertyUpdateGroup",
+               "endPropertyUpdateGroup() called without a matching beginPropertyUpdateGroup()");
+    if (group.depth <= 0 || --group.depth > 0)
+        return;
+
+    // Change handlers may start groups of their own, so deliver the
+    // notifications from a snapshot of the pending ones.
+    const auto properties = std::move(group.properties);
+    const auto bindings = std::move(group.bindings);
+    QSet<const void *> queued = std::move(group.queued);
+    group.properties.clear();
+    group.bindings.clear();
+    group.queued.clear();
+    QScopedValueRollback<QSet<const void *> *> flushingGuard(group.flushing, &queued);
+
+    for (const auto &[property, propertyDataPtr] : properties) {
+        if (!queued.contains(property))
+            continue; // destroyed by an earlier change handler
+        QPropertyBasePointer d{property};
+        if (QPropertyObserverPointer observer = d.firstObserver())
+            observer.notify(d.bindingPtr(), propertyDataPtr, QPropertyObserverPointer::NotifyChangeHandlers);
+    }
+    for (const QPropertyBindingPrivatePtr &binding : bindings)
+        binding->notifyDeferredObservers();
+}
+
+/*!
+    \class QScopedPropertyUpdateGroup
+    \inmodule QtCore
+    \since 6.0
+    \brief The QScopedPropertyUpdateGroup class starts a property update
+    group for the lifetime of the object.
+
+    The constructor calls Qt::beginPropertyUpdateGroup() and the destructor
+    calls Qt::endPropertyUpdateGroup().
+
+    \snippet code/src_corelib_kernel_qproperty.cpp 0
+
+    \sa Qt::beginPropertyUpdateGroup()
+*/
+
+/*!
+    \fn QScopedPropertyUpdateGroup::QScopedPropertyUpdateGroup()
+
+    Calls Qt::beginPropertyUpdateGroup().
+*/
+
+/*!
+    \fn QScopedPropertyUpdateGroup::~QScopedPropertyUpdateGroup()
+
+    Calls Qt::endPropertyUpdateGroup().
+*/
+
 QPropertyBindingError::QPropertyBindingError()
 {
 }
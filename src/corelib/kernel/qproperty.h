@@ -193,8 +193,19 @@ namespace Qt {
     {
         return QPropertyBinding<std::invoke_result_t<Functor>>(std::forward<Functor>(f), location);
     }
+
+    Q_CORE_EXPORT void beginPropertyUpdateGroup();
+    Q_CORE_EXPORT void endPropertyUpdateGroup();
 }
 
+class QScopedPropertyUpdateGroup
+{
+    Q_DISABLE_COPY_MOVE(QScopedPropertyUpdateGroup)
+public:
+    QScopedPropertyUpdateGroup() { Qt::beginPropertyUpdateGroup(); }
+    ~QScopedPropertyUpdateGroup() { Qt::endPropertyUpdateGroup(); }
+};
+
 struct QPropertyBasePointer;
 
 template <typename T>
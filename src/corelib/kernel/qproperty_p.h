@@ -105,7 +105,13 @@ struct QPropertyObserverPointer
     void setChangeHandler(void (*changeHandler)(QPropertyObserver *, void *));
     void setAliasedProperty(void *propertyPtr);
 
-    void notify(QPropertyBindingPrivate *triggeringBinding, void *propertyDataPtr);
+    enum NotificationMode {
+        NotifyAll,
+        MarkBindingsDirty,   // returns whether there are change handlers to notify later
+        NotifyChangeHandlers
+    };
+    bool notify(QPropertyBindingPrivate *triggeringBinding, void *propertyDataPtr,
+                NotificationMode mode = NotifyAll);
     void observeProperty(QPropertyBasePointer property);
 
     explicit operator bool() const { return ptr != nullptr; }
@@ -177,6 +183,7 @@ public:
     virtual ~QPropertyBindingPrivate();
 
     void setDirty(bool d) { dirty = d; }
+    bool isDirty() const { return dirty; }
     void setProperty(void *propertyPtr) { propertyDataPtr = propertyPtr; }
     void setStaticObserver(void *observer, QtPrivate::QPropertyObserverCallback callback,
                            QtPrivate::QPropertyGuardFunction guardCallback)
@@ -246,6 +253,7 @@ public:
     void unlinkAndDeref();
 
     void markDirtyAndNotifyObservers();
+    void notifyDeferredObservers();
     bool evaluateIfDirtyAndReturnTrueIfValueChanged();
 
     static QPropertyBindingPrivate *get(const QUntypedPropertyBinding &binding)
@@ -254,6 +262,11 @@ public:
     void setError(QPropertyBindingError &&e)
     { error = std::move(e); }
 
+private:
+    void notifyStaticObserver();
+
+public:
+
     static QPropertyBindingPrivate *currentlyEvaluatingBinding();
 };
 
@@ -56,7 +56,9 @@
 #include <QtCore/qtaggedpointer.h>
 #include <QtCore/qmetatype.h>
 
-#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 QT_BEGIN_NAMESPACE
 
@@ -67,11 +69,107 @@ struct QPropertyBasePointer;
 
 namespace QtPrivate {
 
-// writes binding result into dataPtr
-using QPropertyBindingFunction = std::function<bool(QMetaType metaType, void *dataPtr)>;
+// Type erased binding evaluation function; writes the binding result into
+// dataPtr. Functors of up to three pointers are stored inline and all calls
+// go through a plain function pointer, so creating a binding from a small
+// lambda does not allocate anything besides the binding itself.
+class QPropertyBindingFunction
+{
+    struct Operations
+    {
+        bool (*call)(void *functor, QMetaType metaType, void *dataPtr);
+        void (*destroy)(void *functor);
+        void (*relocate)(void *from, void *to);
+    };
+    union Storage {
+        void *heap;
+        void *inlineStorage[3];
+    };
+
+    template <typename F>
+    static constexpr bool FitsInline = sizeof(F) <= sizeof(Storage)
+            && alignof(F) <= alignof(Storage) && std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static F *functor(void *storage)
+    {
+        if constexpr (FitsInline<F>)
+            return static_cast<F *>(storage);
+        else
+            return static_cast<F *>(static_cast<Storage *>(storage)->heap);
+    }
+
+    template <typename F>
+    static constexpr Operations operationsFor = {
+        [](void *storage, QMetaType metaType, void *dataPtr) -> bool {
+            return (*functor<F>(storage))(metaType, dataPtr);
+        },
+        [](void *storage) {
+            if constexpr (FitsInline<F>)
+                functor<F>(storage)->~F();
+            else
+                delete functor<F>(storage);
+        },
+        [](void *from, void *to) {
+            if constexpr (FitsInline<F>) {
+                new (to) F(std::move(*functor<F>(from)));
+                functor<F>(from)->~F();
+            } else {
+                static_cast<Storage *>(to)->heap = static_cast<Storage *>(from)->heap;
+            }
+        }
+    };
+
+public:
+    QPropertyBindingFunction() noexcept = default;
+    template <typename Functor, typename F = std::decay_t<Functor>,
+              std::enable_if_t<!std::is_same_v<F, QPropertyBindingFunction>, bool> = true>
+    QPropertyBindingFunction(Functor &&f)
+        : ops(&operationsFor<F>)
+    {
+        if constexpr (FitsInline<F>)
+            new (&storage) F(std::forward<Functor>(f));
+        else
+            storage.heap = new F(std::forward<Functor>(f));
+    }
+    QPropertyBindingFunction(QPropertyBindingFunction &&other) noexcept
+        : ops(std::exchange(other.ops, nullptr))
+    {
+        if (ops)
+            ops->relocate(&other.storage, &storage);
+    }
+    QPropertyBindingFunction &operator=(QPropertyBindingFunction &&other) noexcept
+    {
+        if (this != &other) {
+            if (ops)
+                ops->destroy(&storage);
+            ops = std::exchange(other.ops, nullptr);
+            if (ops)
+                ops->relocate(&other.storage, &storage);
+        }
+        return *this;
+    }
+    ~QPropertyBindingFunction()
+    {
+        if (ops)
+            ops->destroy(&storage);
+    }
+    Q_DISABLE_COPY(QPropertyBindingFunction)
+
+    explicit operator bool() const noexcept { return ops != nullptr; }
+
+    bool operator()(QMetaType metaType, void *dataPtr) const
+    {
+        return ops->call(&storage, metaType, dataPtr);
+    }
+
+private:
+    const Operations *ops = nullptr;
+    mutable Storage storage;
+};
 
 using QPropertyGuardFunction = bool(*)(QMetaType, void *dataPtr,
-                                       QPropertyBindingFunction, void *owner);
+                                       const QPropertyBindingFunction &, void *owner);
 using QPropertyObserverCallback = void (*)(void *, void *);
 
 class Q_CORE_EXPORT QPropertyBase
@@ -243,7 +341,7 @@ template<typename T, typename Class, auto Guard>
 struct QPropertyGuardFunctionHelper<T, Class, Guard, false>
 {
     static auto guard(const QMetaType metaType, void *dataPtr,
-                      QPropertyBindingFunction eval, void *owner) -> bool
+                      const QPropertyBindingFunction &eval, void *owner) -> bool
     {
         T t = T();
         eval(metaType, &t);
@@ -0,0 +1,405 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsharedringbuffer_p.h"
+
+#ifndef QT_NO_SHAREDMEMORY
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qmath.h>
+#include <QtCore/qthread.h>
+
+#include <string.h>
+
+#if defined(Q_OS_LINUX) && !defined(QT_LINUXBASE)
+#  include <sys/syscall.h>
+#  include <limits.h>
+#  include <unistd.h>
+#  include <linux/futex.h>
+#  define QT_SHAREDRINGBUFFER_USE_FUTEX
+#endif
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QSharedRingBuffer
+    \inmodule QtCore
+
+    \brief The QSharedRingBuffer class is a message queue in a shared memory
+    segment, for exchanging messages between two processes on the same host.
+
+    One process creates the buffer with create() and the other one attaches
+    to it with attach(), using the same key. There must be exactly one
+    writer and one reader at any time; the queue is lock-free under that
+    assumption and does not use QSystemSemaphore.
+
+    Each message is stored as a 32-bit length followed by the payload,
+    padded to a multiple of 4 bytes. The read and write positions are
+    free-running counters, so the amount of queued data is always their
+    difference.
+
+    A reader or writer that has to wait sets a flag in the segment and
+    sleeps on the position counter it is waiting for. The other side only
+    issues a wake-up when that flag is set, so an uncontended transfer does
+    not make any system call. On Linux, the sleep uses a process-shared
+    futex; on other platforms, the waiting side polls with short sleeps.
+*/
+
+struct QSharedRingBuffer::Header
+{
+    enum : quint32 {
+        Magic = 0x42525351,         // "QSRB"
+        Version = 1
+    };
+
+    QBasicAtomicInteger<quint32> magic;
+    quint32 version;
+    quint32 capacity;
+
+    // the producer and consumer sides live on separate cache lines
+    alignas(64) QBasicAtomicInteger<quint32> head;
+    QBasicAtomicInt readerWaiting;
+    alignas(64) QBasicAtomicInteger<quint32> tail;
+    QBasicAtomicInt writerWaiting;
+};
+
+static inline quint32 recordSize(quint32 size)
+{
+    return sizeof(quint32) + ((size + 3) & ~3U);
+}
+
+static QString translatedError(const char *text)
+{
+    return QCoreApplication::translate("QSharedRingBuffer", text);
+}
+
+#ifdef QT_SHAREDRINGBUFFER_USE_FUTEX
+// The futex words are in memory shared with another process, so we can't use
+// QtFutex, which always passes FUTEX_PRIVATE_FLAG.
+static void waitForChange(QBasicAtomicInteger<quint32> &word, quint32 expected,
+                          QDeadlineTimer deadline)
+{
+    struct timespec ts;
+    struct timespec *timeout = nullptr;
+    if (!deadline.isForever()) {
+        const qint64 nsecs = qMax<qint64>(deadline.remainingTimeNSecs(), 0);
+        ts.tv_sec = nsecs / (1000 * 1000 * 1000);
+        ts.tv_nsec = nsecs % (1000 * 1000 * 1000);
+        timeout = &ts;
+    }
+    syscall(__NR_futex, reinterpret_cast<int *>(&word), FUTEX_WAIT, int(expected), timeout,
+            nullptr, 0);
+}
+
+static void wakeWaiter(QBasicAtomicInteger<quint32> &word)
+{
+    syscall(__NR_futex, reinterpret_cast<int *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+#else
+static void waitForChange(QBasicAtomicInteger<quint32> &word, quint32 expected,
+                          QDeadlineTimer deadline)
+{
+    // sleep briefly, but not past the deadline
+    if (word.loadAcquire() == expected && deadline.remainingTimeNSecs() != 0)
+        QThread::usleep(50);
+}
+
+static void wakeWaiter(QBasicAtomicInteger<quint32> &)
+{
+}
+#endif
+
+/*!
+    Constructs a ring buffer object for the shared memory segment
+    identified by \a key. Call create() or attach() before using it.
+*/
+QSharedRingBuffer::QSharedRingBuffer(const QString &key)
+    : memory(key)
+{
+}
+
+/*!
+    Destroys the object, detaching from the shared memory segment.
+*/
+QSharedRingBuffer::~QSharedRingBuffer()
+{
+}
+
+QSharedRingBuffer::Header *QSharedRingBuffer::header() const
+{
+    return static_cast<Header *>(const_cast<void *>(memory.constData()));
+}
+
+char *QSharedRingBuffer::buffer() const
+{
+    return reinterpret_cast<char *>(header()) + sizeof(Header);
+}
+
+/*!
+    Creates the shared memory segment with room for at least \a capacity
+    bytes of queued messages and attaches to it. The capacity is rounded up
+    to a power of two. Returns \c false on failure, in which case
+    errorString() describes the error.
+*/
+bool QSharedRingBuffer::create(qsizetype capacity)
+{
+    if (capacity <= 0 || capacity > (1 << 30)) {
+        error = translatedError("Invalid capacity");
+        return false;
+    }
+    const quint32 size = qMax(qNextPowerOfTwo(quint32(capacity - 1)), 64U);
+    if (!memory.create(int(sizeof(Header) + size))) {
+        error = memory.errorString();
+        return false;
+    }
+
+    // the segment is zero-filled, so the positions and flags start at 0
+    Header *h = header();
+    h->version = Header::Version;
+    h->capacity = size;
+    h->magic.storeRelease(Header::Magic);
+    error.clear();
+    return true;
+}
+
+/*!
+    Attaches to a segment that was created by another QSharedRingBuffer
+    with the same key. Returns \c false on failure, in which case
+    errorString() describes the error.
+*/
+bool QSharedRingBuffer::attach()
+{
+    if (!memory.attach()) {
+        error = memory.errorString();
+        return false;
+    }
+
+    const Header *h = header();
+    if (memory.size() < int(sizeof(Header)) || h->magic.loadAcquire() != Header::Magic
+            || h->version != Header::Version
+            || memory.size() < int(sizeof(Header) + h->capacity)) {
+        memory.detach();
+        error = translatedError("Shared memory segment is not a ring buffer");
+        return false;
+    }
+    error.clear();
+    return true;
+}
+
+/*!
+    Detaches from the shared memory segment. The segment is destroyed when
+    the last process detaches from it.
+*/
+bool QSharedRingBuffer::detach()
+{
+    return memory.detach();
+}
+
+/*!
+    Returns \c true if this object is attached to a segment.
+*/
+bool QSharedRingBuffer::isAttached() const
+{
+    return memory.isAttached();
+}
+
+/*!
+    Returns the number of bytes the buffer can hold, including the 4 bytes
+    of framing per message, or 0 if it is not attached.
+*/
+qsizetype QSharedRingBuffer::capacity() const
+{
+    return isAttached() ? qsizetype(header()->capacity) : 0;
+}
+
+/*!
+    Returns the size of the largest message that fits in the buffer.
+*/
+qsizetype QSharedRingBuffer::maximumMessageSize() const
+{
+    return isAttached() ? capacity() - qsizetype(sizeof(quint32)) : 0;
+}
+
+void QSharedRingBuffer::copyIn(quint32 position, const char *data, quint32 size)
+{
+    const quint32 mask = header()->capacity - 1;
+    const quint32 offset = position & mask;
+    const quint32 first = qMin(size, mask + 1 - offset);
+    memcpy(buffer() + offset, data, first);
+    memcpy(buffer(), data + first, size - first);
+}
+
+void QSharedRingBuffer::copyOut(quint32 position, char *data, quint32 size) const
+{
+    const quint32 mask = header()->capacity - 1;
+    const quint32 offset = position & mask;
+    const quint32 first = qMin(size, mask + 1 - offset);
+    memcpy(data, buffer() + offset, first);
+    memcpy(data + first, buffer(), size - first);
+}
+
+/*!
+    Appends the message of \a size bytes at \a data to the buffer, if there
+    is room for it. Returns \c false without waiting if the buffer is full.
+
+    Only one process may write to a buffer.
+*/
+bool QSharedRingBuffer::tryWrite(const char *data, qsizetype size)
+{
+    if (!isAttached())
+        return false;
+    if (size < 0 || size > maximumMessageSize()) {
+        error = translatedError("Message too large");
+        return false;
+    }
+
+    Header *h = header();
+    const quint32 length = quint32(size);
+    const quint32 head = h->head.loadRelaxed();
+    const quint32 tail = h->tail.loadAcquire();
+    if (h->capacity - (head - tail) < recordSize(length))
+        return false;
+
+    copyIn(head, reinterpret_cast<const char *>(&length), sizeof(length));
+    copyIn(head + sizeof(length), data, length);
+
+    // Publish the message. The full barrier orders the store to head before
+    // the load of readerWaiting, pairing with the one in read().
+    h->head.fetchAndStoreOrdered(head + recordSize(length));
+    if (h->readerWaiting.loadAcquire() && h->readerWaiting.fetchAndStoreOrdered(0))
+        wakeWaiter(h->head);
+    return true;
+}
+
+/*!
+    Appends the message of \a size bytes at \a data to the buffer, waiting
+    until \a deadline for the reader to make room for it. Returns \c false
+    if the deadline expired or the message can never fit.
+*/
+bool QSharedRingBuffer::write(const char *data, qsizetype size, QDeadlineTimer deadline)
+{
+    if (!isAttached() || size < 0 || size > maximumMessageSize())
+        return tryWrite(data, size);
+
+    Header *h = header();
+    const quint32 needed = recordSize(quint32(size));
+    forever {
+        if (tryWrite(data, size))
+            return true;
+        if (deadline.hasExpired())
+            return false;
+
+        // the reader may have made room since tryWrite() looked
+        const quint32 head = h->head.loadRelaxed();
+        const quint32 tail = h->tail.loadAcquire();
+        if (h->capacity - (head - tail) >= needed)
+            continue;
+        h->writerWaiting.fetchAndStoreOrdered(1);
+        if (h->tail.loadAcquire() == tail)
+            waitForChange(h->tail, tail, deadline);
+    }
+}
+
+/*!
+    Removes the oldest message from the buffer and stores it in \a message.
+    Returns \c false without waiting if the buffer is empty. If the queued
+    data is found to be inconsistent, it is discarded and errorString() is
+    set.
+
+    Only one process may read from a buffer.
+*/
+bool QSharedRingBuffer::tryRead(QByteArray *message)
+{
+    if (!isAttached())
+        return false;
+
+    Header *h = header();
+    const quint32 tail = h->tail.loadRelaxed();
+    const quint32 head = h->head.loadAcquire();
+    if (head == tail)
+        return false;
+
+    quint32 length;
+    copyOut(tail, reinterpret_cast<char *>(&length), sizeof(length));
+    if (recordSize(length) > head - tail) {
+        // discard everything, so that the reader doesn't get stuck
+        error = translatedError("Shared memory segment is corrupt");
+        h->tail.fetchAndStoreOrdered(head);
+        return false;
+    }
+    message->resize(length);
+    copyOut(tail + sizeof(length), message->data(), length);
+
+    // release the space; see tryWrite()
+    h->tail.fetchAndStoreOrdered(tail + recordSize(length));
+    if (h->writerWaiting.loadAcquire() && h->writerWaiting.fetchAndStoreOrdered(0))
+        wakeWaiter(h->tail);
+    return true;
+}
+
+/*!
+    Removes the oldest message from the buffer and stores it in \a message,
+    waiting until \a deadline for one to arrive. Returns \c false if the
+    deadline expired.
+*/
+bool QSharedRingBuffer::read(QByteArray *message, QDeadlineTimer deadline)
+{
+    if (!isAttached())
+        return false;
+
+    Header *h = header();
+    error.clear();
+    forever {
+        if (tryRead(message))
+            return true;
+        if (!error.isEmpty() || deadline.hasExpired())
+            return false;
+
+        // the buffer is empty when head catches up with our tail
+        const quint32 tail = h->tail.loadRelaxed();
+        h->readerWaiting.fetchAndStoreOrdered(1);
+        if (h->head.loadAcquire() == tail)
+            waitForChange(h->head, tail, deadline);
+    }
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_SHAREDMEMORY
@@ -0,0 +1,110 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSHAREDRINGBUFFER_P_H
+#define QSHAREDRINGBUFFER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qsharedmemory.h>
+
+#ifndef QT_NO_SHAREDMEMORY
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QSharedRingBuffer
+{
+public:
+    explicit QSharedRingBuffer(const QString &key);
+    ~QSharedRingBuffer();
+
+    QString key() const { return memory.key(); }
+
+    bool create(qsizetype capacity);
+    bool attach();
+    bool detach();
+    bool isAttached() const;
+
+    qsizetype capacity() const;
+    qsizetype maximumMessageSize() const;
+    QString errorString() const { return error; }
+
+    bool tryWrite(const char *data, qsizetype size);
+    bool tryWrite(const QByteArray &message)
+    { return tryWrite(message.constData(), message.size()); }
+    bool write(const char *data, qsizetype size,
+               QDeadlineTimer deadline = QDeadlineTimer(QDeadlineTimer::Forever));
+    bool write(const QByteArray &message,
+               QDeadlineTimer deadline = QDeadlineTimer(QDeadlineTimer::Forever))
+    { return write(message.constData(), message.size(), deadline); }
+
+    bool tryRead(QByteArray *message);
+    bool read(QByteArray *message,
+              QDeadlineTimer deadline = QDeadlineTimer(QDeadlineTimer::Forever));
+
+private:
+    Q_DISABLE_COPY(QSharedRingBuffer)
+
+    struct Header;
+    Header *header() const;
+    char *buffer() const;
+    void copyIn(quint32 position, const char *data, quint32 size);
+    void copyOut(quint32 position, char *data, quint32 size) const;
+
+    QSharedMemory memory;
+    QString error;
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_SHAREDMEMORY
+
+#endif // QSHAREDRINGBUFFER_P_H
@@ -84,6 +84,7 @@ QTimerInfoList::QTimerInfoList()
 #endif
 
     firstTimerInfo = nullptr;
+    nextSequence = 0;
 }
 
 timespec QTimerInfoList::updateCurrentTime()
@@ -175,17 +176,87 @@ void QTimerInfoList::repairTimersIfNeeded()
 #endif
 
 /*
-  insert timer info into list
+  heap maintenance; timers with equal timeouts fire in insertion order
 */
-void QTimerInfoList::timerInsert(QTimerInfo *ti)
+bool QTimerInfoList::timerLessThan(const QTimerInfo *t1, const QTimerInfo *t2)
+{
+    if (t1->timeout < t2->timeout)
+        return true;
+    if (t2->timeout < t1->timeout)
+        return false;
+    return t1->sequence < t2->sequence;
+}
+
+void QTimerInfoList::siftUp(int index)
+{
+    QTimerInfo **heap = data();
+    QTimerInfo *t = heap[index];
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (!timerLessThan(t, heap[parent]))
+            break;
+        heap[index] = heap[parent];
+        heap[index]->heapIndex = index;
+        index = parent;
+    }
+    heap[index] = t;
+    t->heapIndex = index;
+}
+
+void QTimerInfoList::siftDown(int index)
 {
-    int index = size();
-    while (index--) {
-        const QTimerInfo * const t = at(index);
-        if (!(ti->timeout < t->timeout))
+    QTimerInfo **heap = data();
+    const int n = size();
+    QTimerInfo *t = heap[index];
+    for (;;) {
+        int child = 2 * index + 1;
+        if (child >= n)
             break;
+        if (child + 1 < n && timerLessThan(heap[child + 1], heap[child]))
+            ++child;
+        if (!timerLessThan(heap[child], t))
+            break;
+        heap[index] = heap[child];
+        heap[index]->heapIndex = index;
+        index = child;
+    }
+    heap[index] = t;
+    t->heapIndex = index;
+}
+
+/*
+  remove the timer at heap position index, without deleting it
+*/
+void QTimerInfoList::timerRemoveAt(int index)
+{
+    QTimerInfo *last = takeLast();
+    if (index < size()) {
+        data()[index] = last;
+        last->heapIndex = index;
+        siftDown(index);
+        siftUp(last->heapIndex);
     }
-    insert(index+1, ti);
+}
+
+/*
+  count the timers in the subtree at index that have expired
+*/
+int QTimerInfoList::countExpiredTimers(int index, timespec currentTime) const
+{
+    if (index >= size() || currentTime < at(index)->timeout)
+        return 0;
+    return 1 + countExpiredTimers(2 * index + 1, currentTime)
+             + countExpiredTimers(2 * index + 2, currentTime);
+}
+
+/*
+  insert timer info into list
+*/
+void QTimerInfoList::timerInsert(QTimerInfo *ti)
+{
+    ti->sequence = nextSequence++;
+    append(ti);
+    siftUp(size() - 1);
 }
 
 inline timespec &operator+=(timespec &t1, int ms)
@@ -390,10 +461,13 @@ bool QTimerInfoList::timerWait(timespec &tm)
 
     // Find first waiting timer not already active
     QTimerInfo *t = nullptr;
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (!(*it)->activateRef) {
-            t = *it;
-            break;
+    if (!isEmpty() && !constFirst()->activateRef) {
+        t = constFirst();
+    } else {
+        // only timers whose event is being delivered right now are active
+        for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
+            if (!(*it)->activateRef && (!t || timerLessThan(*it, t)))
+                t = *it;
         }
     }
 
@@ -423,16 +497,13 @@ int QTimerInfoList::timerRemainingTime(int timerId)
     repairTimersIfNeeded();
     timespec tm = {0, 0};
 
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            if (currentTime < t->timeout) {
-                // time to wait
-                tm = roundToMillisecond(t->timeout - currentTime);
-                return tm.tv_sec*1000 + tm.tv_nsec/1000/1000;
-            } else {
-                return 0;
-            }
+    if (const QTimerInfo *t = timersById.value(timerId)) {
+        if (currentTime < t->timeout) {
+            // time to wait
+            tm = roundToMillisecond(t->timeout - currentTime);
+            return tm.tv_sec*1000 + tm.tv_nsec/1000/1000;
+        } else {
+            return 0;
         }
     }
 
@@ -494,6 +565,7 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
     }
 
     timerInsert(t);
+    timersById.insert(timerId, t);
 
 #ifdef QTIMERINFO_DEBUG
     t->expected = expected;
@@ -508,41 +580,51 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
 bool QTimerInfoList::unregisterTimer(int timerId)
 {
     // set timer inactive
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            // found it
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = nullptr;
-            if (t->activateRef)
-                *(t->activateRef) = nullptr;
-            delete t;
-            return true;
-        }
+    QTimerInfo *t = timersById.take(timerId);
+    if (!t) {
+        // id not found
+        return false;
     }
-    // id not found
-    return false;
+
+    timerRemoveAt(t->heapIndex);
+    if (t == firstTimerInfo)
+        firstTimerInfo = nullptr;
+    if (t->activateRef)
+        *(t->activateRef) = nullptr;
+    delete t;
+    return true;
 }
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
     if (isEmpty())
         return false;
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
+
+    // compact the remaining timers, then restore the heap order once
+    QTimerInfo **heap = data();
+    const int n = size();
+    int kept = 0;
+    for (int i = 0; i < n; ++i) {
+        QTimerInfo *t = heap[i];
         if (t->obj == object) {
             // object found
-            removeAt(i);
+            timersById.remove(t->id);
             if (t == firstTimerInfo)
                 firstTimerInfo = nullptr;
             if (t->activateRef)
                 *(t->activateRef) = nullptr;
             delete t;
-            // move back one so that we don't skip the new current item
-            --i;
+        } else {
+            heap[kept] = t;
+            t->heapIndex = kept;
+            ++kept;
         }
     }
+    if (kept != n) {
+        resize(kept);
+        for (int i = kept / 2 - 1; i >= 0; --i)
+            siftDown(i);
+    }
     return true;
 }
 
@@ -579,11 +661,7 @@ int QTimerInfoList::activateTimers()
 
 
     // Find out how many timer have expired
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (currentTime < (*it)->timeout)
-            break;
-        maxCount++;
-    }
+    maxCount = countExpiredTimers(0, currentTime);
 
     //fire the timers.
     while (maxCount--) {
@@ -605,7 +683,7 @@ int QTimerInfoList::activateTimers()
         }
 
         // remove from list
-        removeFirst();
+        timerRemoveAt(0);
 
 #ifdef QTIMERINFO_DEBUG
         float diff;
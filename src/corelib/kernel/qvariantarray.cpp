@@ -0,0 +1,491 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qvariantarray.h"
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+class QVariantArrayPrivate : public QSharedData
+{
+public:
+    explicit QVariantArrayPrivate(QMetaType t)
+        : type(t), stride(t.sizeOf()), alignment(t.alignOf()),
+          trivial(!(t.flags() & (QMetaType::NeedsConstruction | QMetaType::NeedsDestruction))),
+          relocatable(trivial || (t.flags() & QMetaType::MovableType))
+    {}
+    QVariantArrayPrivate(const QVariantArrayPrivate &other)
+        : QSharedData(), type(other.type), stride(other.stride), alignment(other.alignment),
+          trivial(other.trivial), relocatable(other.relocatable)
+    {
+        reallocate(other.size);
+        if (trivial) {
+            if (other.size)
+                memcpy(ptr, other.ptr, size_t(other.size * stride));
+            size = other.size;
+        } else {
+            for (; size < other.size; ++size)
+                type.construct(element(size), other.element(size));
+        }
+    }
+    ~QVariantArrayPrivate()
+    {
+        truncate(0);
+        qFreeAligned(ptr);
+    }
+
+    char *element(qsizetype i) const { return ptr + i * stride; }
+
+    void truncate(qsizetype newSize)
+    {
+        if (!trivial) {
+            for (qsizetype i = newSize; i < size; ++i)
+                type.destruct(element(i));
+        }
+        size = newSize;
+    }
+
+    void reallocate(qsizetype newCapacity)
+    {
+        Q_ASSERT(newCapacity >= size);
+        if (newCapacity == capacity)
+            return;
+        const size_t bytes = size_t(newCapacity * stride);
+        if (relocatable) {
+            // Relocatable types may be moved with memcpy, which is what
+            // qReallocAligned does when it cannot grow the block in place.
+            void *p = qReallocAligned(ptr, bytes, size_t(capacity * stride), size_t(alignment));
+            Q_CHECK_PTR(p);
+            ptr = static_cast<char *>(p);
+        } else {
+            char *p = static_cast<char *>(qMallocAligned(bytes, size_t(alignment)));
+            Q_CHECK_PTR(p);
+            for (qsizetype i = 0; i < size; ++i) {
+                type.construct(p + i * stride, element(i));
+                type.destruct(element(i));
+            }
+            qFreeAligned(ptr);
+            ptr = p;
+        }
+        capacity = newCapacity;
+    }
+
+    void grow()
+    {
+        reallocate(capacity ? capacity * 2 : 4);
+    }
+
+    QMetaType type;
+    char *ptr = nullptr;
+    qsizetype size = 0;
+    qsizetype capacity = 0;
+    qsizetype stride;
+    qsizetype alignment;
+    bool trivial;
+    bool relocatable;
+};
+
+static void registerVariantArrayConverters()
+{
+    static const bool registered = []() {
+        QMetaType::registerConverter<QVariantArray, QVariantList>(&QVariantArray::toVariantList);
+        QMetaType::registerConverter<QVariantList, QVariantArray>([](const QVariantList &list) {
+            return QVariantArray::fromVariantList(list);
+        });
+        return true;
+    }();
+    Q_UNUSED(registered);
+}
+
+/*!
+    \class QVariantArray
+    \inmodule QtCore
+    \since 6.0
+    \brief The QVariantArray class holds a sequence of values of one type
+    in contiguous, unboxed storage.
+
+    \ingroup objectmodel
+    \ingroup shared
+
+    A QVariantList stores every element in its own QVariant. Values that do
+    not fit into QVariant's internal storage, such as QRectF or QLineF, are
+    therefore allocated one by one, and every access goes through the
+    element's QMetaType. QVariantArray instead stores a single QMetaType
+    and places all elements side by side in one block of memory, the way
+    QList<T> would.
+
+    A QVariantArray can itself be stored in a QVariant, and converts to and
+    from QVariantList through QVariant::value() or QVariant::convert(). The
+    conversion only happens when it is requested, so code that knows the
+    element type can read the values directly through constData() or
+    toList() without boxing a single element:
+
+    \snippet code/src_corelib_kernel_qvariantarray.cpp 0
+
+    QVariantArray is \l{implicitly shared}.
+
+    \sa QVariant, QVariantList
+*/
+
+/*!
+    Constructs an invalid, empty array. The first value passed to
+    append(const QVariant &) determines the element type.
+*/
+QVariantArray::QVariantArray() noexcept = default;
+
+/*!
+    Constructs an empty array holding elements of type \a type.
+*/
+QVariantArray::QVariantArray(QMetaType type)
+{
+    registerVariantArrayConverters();
+    if (type.isValid() && type.sizeOf() > 0)
+        d = new QVariantArrayPrivate(type);
+}
+
+/*!
+    Constructs a copy of \a other. This operation takes constant time,
+    because QVariantArray is implicitly shared.
+*/
+QVariantArray::QVariantArray(const QVariantArray &other) noexcept = default;
+
+/*!
+    Move-constructs a QVariantArray instance, making it point at the same
+    object that \a other was pointing to.
+*/
+QVariantArray::QVariantArray(QVariantArray &&other) noexcept = default;
+
+/*!
+    Assigns \a other to this array and returns a reference to this array.
+*/
+QVariantArray &QVariantArray::operator=(const QVariantArray &other) noexcept = default;
+
+/*!
+    \fn QVariantArray &QVariantArray::operator=(QVariantArray &&other)
+
+    Move-assigns \a other to this QVariantArray instance.
+*/
+
+/*!
+    Destroys the array.
+*/
+QVariantArray::~QVariantArray() = default;
+
+/*!
+    \fn void QVariantArray::swap(QVariantArray &other)
+
+    Swaps this array with \a other. This operation is very fast and never
+    fails.
+*/
+
+/*!
+    \fn bool QVariantArray::isValid() const
+
+    Returns \c true if the array has an element type.
+*/
+
+/*!
+    Returns the type of the elements in this array, or an invalid QMetaType
+    if the array has no element type yet.
+*/
+QMetaType QVariantArray::metaType() const noexcept
+{
+    return d ? d->type : QMetaType();
+}
+
+/*!
+    Returns the number of elements in the array.
+
+    \sa isEmpty()
+*/
+qsizetype QVariantArray::size() const noexcept
+{
+    return d ? d->size : 0;
+}
+
+/*!
+    \fn qsizetype QVariantArray::count() const
+
+    Same as size().
+*/
+
+/*!
+    \fn bool QVariantArray::isEmpty() const
+
+    Returns \c true if the array contains no elements.
+*/
+
+/*!
+    Returns the number of elements that can be stored without reallocating.
+*/
+qsizetype QVariantArray::capacity() const noexcept
+{
+    return d ? d->capacity : 0;
+}
+
+/*!
+    Allocates memory for at least \a size elements. Does nothing for an
+    array without an element type.
+*/
+void QVariantArray::reserve(qsizetype size)
+{
+    if (!d || size <= d->capacity)
+        return;
+    detach();
+    d->reallocate(size);
+}
+
+/*!
+    Removes all elements from the array. The element type is kept.
+*/
+void QVariantArray::clear()
+{
+    if (!d)
+        return;
+    if (d->ref.loadRelaxed() != 1)
+        d = new QVariantArrayPrivate(d->type);
+    else
+        d->truncate(0);
+}
+
+/*!
+    Returns the element at index position \a i boxed in a QVariant.
+    \a i must be a valid index position in the array.
+
+    \sa value(), constData()
+*/
+QVariant QVariantArray::at(qsizetype i) const
+{
+    Q_ASSERT_X(i >= 0 && i < size(), "QVariantArray::at", "index out of range");
+    return QVariant(d->type, d->element(i));
+}
+
+/*!
+    \fn QVariant QVariantArray::operator[](qsizetype i) const
+
+    Same as at(\a i).
+*/
+
+/*!
+    Returns a pointer to the first element of the array, or \nullptr if
+    the array has no storage. The elements are laid out contiguously,
+    QMetaType::sizeOf() bytes apart.
+*/
+const void *QVariantArray::constData() const noexcept
+{
+    return d ? d->ptr : nullptr;
+}
+
+/*!
+    Returns a pointer to the element at index position \a i.
+*/
+const void *QVariantArray::constData(qsizetype i) const noexcept
+{
+    Q_ASSERT_X(i >= 0 && i < size(), "QVariantArray::constData", "index out of range");
+    return d->element(i);
+}
+
+/*!
+    Returns a pointer to the element at index position \a i that can be
+    used to modify it. The array is detached first.
+*/
+void *QVariantArray::data(qsizetype i)
+{
+    Q_ASSERT_X(i >= 0 && i < size(), "QVariantArray::data", "index out of range");
+    detach();
+    return d->element(i);
+}
+
+/*!
+    Appends \a value to the array, converting it to metaType() if
+    necessary. If the array does not have an element type yet, it adopts
+    the type of \a value.
+
+    Returns \c false, and leaves the array unchanged, if \a value cannot be
+    converted to the element type.
+*/
+bool QVariantArray::append(const QVariant &value)
+{
+    if (!d) {
+        if (!value.isValid())
+            return false;
+        *this = QVariantArray(value.metaType());
+        if (!d)
+            return false;
+    }
+    if (value.metaType() == d->type) {
+        append(value.constData());
+        return true;
+    }
+    QVariant converted = value;
+    if (!converted.convert(d->type))
+        return false;
+    append(converted.constData());
+    return true;
+}
+
+/*!
+    \overload
+
+    Appends a copy of the value at \a copy, which must point to an object
+    of type metaType(). If \a copy is \nullptr, a default-constructed value
+    is appended.
+*/
+void QVariantArray::append(const void *copy)
+{
+    if (!d)
+        return;
+    detach();
+    if (d->size == d->capacity)
+        d->grow();
+    if (d->trivial && copy)
+        memcpy(d->element(d->size), copy, size_t(d->stride));
+    else
+        d->type.construct(d->element(d->size), copy);
+    ++d->size;
+}
+
+/*!
+    \fn template <typename T> void QVariantArray::append(const T &value)
+
+    Appends \a value to the array without boxing it. T must be the element
+    type of the array.
+*/
+
+/*!
+    \fn template <typename T> const T *QVariantArray::constData() const
+
+    Returns a typed pointer to the first element if T is the element type
+    of the array; otherwise returns \nullptr.
+*/
+
+/*!
+    \fn template <typename T> T QVariantArray::value(qsizetype i) const
+
+    Returns the element at index position \a i as a T. If T is not the
+    element type, the element is converted as with qvariant_cast().
+*/
+
+/*!
+    \fn template <typename T> QVariantArray QVariantArray::fromList(const QList<T> &list)
+
+    Returns an array with the elements of \a list.
+*/
+
+/*!
+    \fn template <typename T> QList<T> QVariantArray::toList() const
+
+    Returns the elements of the array as a QList<T>. If T is the element
+    type, the elements are copied directly; otherwise each one is
+    converted as with qvariant_cast().
+*/
+
+/*!
+    Returns an array holding the elements of \a list converted to \a type.
+    If \a type is invalid, the type of the first valid element is used.
+    Elements that cannot be converted are replaced by default-constructed
+    values, as QVariant::value() would do.
+*/
+QVariantArray QVariantArray::fromVariantList(const QVariantList &list, QMetaType type)
+{
+    if (!type.isValid()) {
+        for (const QVariant &v : list) {
+            if (v.isValid()) {
+                type = v.metaType();
+                break;
+            }
+        }
+    }
+    QVariantArray array(type);
+    if (!array.d)
+        return array;
+    array.reserve(list.size());
+    for (const QVariant &v : list) {
+        if (!array.append(v))
+            array.append(static_cast<const void *>(nullptr));
+    }
+    return array;
+}
+
+/*!
+    Returns the elements of the array boxed one by one in a QVariantList.
+*/
+QVariantList QVariantArray::toVariantList() const
+{
+    QVariantList list;
+    list.reserve(size());
+    for (qsizetype i = 0; i < size(); ++i)
+        list.append(QVariant(d->type, d->element(i)));
+    return list;
+}
+
+/*!
+    \fn bool QVariantArray::operator==(const QVariantArray &lhs, const QVariantArray &rhs)
+
+    Returns \c true if \a lhs and \a rhs have the same element type and
+    their elements compare equal with QMetaType::equals().
+*/
+
+/*!
+    \fn bool QVariantArray::operator!=(const QVariantArray &lhs, const QVariantArray &rhs)
+
+    Returns \c true if \a lhs and \a rhs are not equal.
+*/
+
+bool QVariantArray::equals(const QVariantArray &other) const
+{
+    if (d == other.d)
+        return true;
+    if (metaType() != other.metaType() || size() != other.size())
+        return false;
+    for (qsizetype i = 0; i < d->size; ++i) {
+        if (!d->type.equals(d->element(i), other.d->element(i)))
+            return false;
+    }
+    return true;
+}
+
+void QVariantArray::detach()
+{
+    if (d && d->ref.loadRelaxed() != 1)
+        d.detach();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,146 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QVARIANTARRAY_H
+#define QVARIANTARRAY_H
+
+#include <QtCore/qvariant.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QVariantArrayPrivate;
+
+class Q_CORE_EXPORT QVariantArray
+{
+public:
+    QVariantArray() noexcept;
+    explicit QVariantArray(QMetaType type);
+    QVariantArray(const QVariantArray &other) noexcept;
+    QVariantArray(QVariantArray &&other) noexcept;
+    QVariantArray &operator=(const QVariantArray &other) noexcept;
+    QVariantArray &operator=(QVariantArray &&other) noexcept { swap(other); return *this; }
+    ~QVariantArray();
+
+    void swap(QVariantArray &other) noexcept { d.swap(other.d); }
+
+    bool isValid() const noexcept { return metaType().isValid(); }
+    QMetaType metaType() const noexcept;
+
+    qsizetype size() const noexcept;
+    qsizetype count() const noexcept { return size(); }
+    bool isEmpty() const noexcept { return size() == 0; }
+    qsizetype capacity() const noexcept;
+    void reserve(qsizetype size);
+    void clear();
+
+    QVariant at(qsizetype i) const;
+    QVariant operator[](qsizetype i) const { return at(i); }
+
+    const void *constData() const noexcept;
+    const void *constData(qsizetype i) const noexcept;
+    void *data(qsizetype i);
+
+    bool append(const QVariant &value);
+    void append(const void *copy);
+    template <typename T>
+    void append(const T &value)
+    {
+        Q_ASSERT(metaType() == QMetaType::fromType<T>());
+        append(static_cast<const void *>(&value));
+    }
+
+    template <typename T>
+    const T *constData() const noexcept
+    {
+        if (metaType() != QMetaType::fromType<T>())
+            return nullptr;
+        return static_cast<const T *>(constData());
+    }
+    template <typename T>
+    T value(qsizetype i) const
+    {
+        if (const T *p = constData<T>())
+            return p[i];
+        return qvariant_cast<T>(at(i));
+    }
+
+    template <typename T>
+    static QVariantArray fromList(const QList<T> &list)
+    {
+        QVariantArray array(QMetaType::fromType<T>());
+        array.reserve(list.size());
+        for (const T &t : list)
+            array.append(static_cast<const void *>(&t));
+        return array;
+    }
+    template <typename T>
+    QList<T> toList() const
+    {
+        if (const T *p = constData<T>())
+            return QList<T>(p, p + size());
+        QList<T> list;
+        list.reserve(size());
+        for (qsizetype i = 0; i < size(); ++i)
+            list.append(qvariant_cast<T>(at(i)));
+        return list;
+    }
+
+    static QVariantArray fromVariantList(const QVariantList &list, QMetaType type = QMetaType());
+    QVariantList toVariantList() const;
+
+    friend bool operator==(const QVariantArray &lhs, const QVariantArray &rhs)
+    { return lhs.equals(rhs); }
+    friend bool operator!=(const QVariantArray &lhs, const QVariantArray &rhs)
+    { return !lhs.equals(rhs); }
+
+private:
+    bool equals(const QVariantArray &other) const;
+    void detach();
+
+    QExplicitlySharedDataPointer<QVariantArrayPrivate> d;
+};
+
+Q_DECLARE_SHARED(QVariantArray)
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QVariantArray)
+
+#endif // QVARIANTARRAY_H
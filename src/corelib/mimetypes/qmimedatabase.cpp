@@ -52,6 +52,7 @@
 #include <QtCore/QBuffer>
 #include <QtCore/QUrl>
 #include <QtCore/QDebug>
+#include <QtCore/QScopeGuard>
 
 #include <algorithm>
 #include <functional>
@@ -366,6 +367,13 @@ QMimeType QMimeDatabasePrivate::mimeTypeForFileNameAndData(const QString &fileNa
 
     // Extension is unknown, or matches multiple mimetypes.
     // Pass 2) Match on content, if we can read the data
+    // (mimeTypeForFile() leaves opening the file to us, so that this is only
+    // done when the file name is not enough)
+    const bool openedByUs = !device->isOpen() && device->open(QIODevice::ReadOnly);
+    const auto closeDevice = qScopeGuard([device, openedByUs] {
+        if (openedByUs)
+            device->close();
+    });
     if (device->isOpen()) {
 
         // Read 16K in one go (QIODEVICE_BUFFERSIZE in qiodevice_p.h).
@@ -562,7 +570,7 @@ QMimeType QMimeDatabase::mimeTypeForFile(const QFileInfo &fileInfo, MatchMode mo
     int priority = 0;
     switch (mode) {
     case MatchDefault:
-        file.open(QIODevice::ReadOnly); // isOpen() will be tested by method below
+        // the file is only opened if its name does not determine the type
         return d->mimeTypeForFileNameAndData(fileInfo.absoluteFilePath(), &file, &priority);
     case MatchExtension:
         locker.unlock();
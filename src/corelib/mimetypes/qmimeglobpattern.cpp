@@ -97,58 +97,71 @@ void QMimeGlobMatchResult::addMatch(const QString &mimeType, int weight, const Q
     \sa QMimeType, QMimeDatabase, QMimeMagicRuleMatcher, QMimeMagicRule
 */
 
-bool QMimeGlobPattern::matchFileName(const QString &inputFilename) const
+QMimeGlobPattern::QMimeGlobPattern(const QString &thePattern, const QString &theMimeType,
+                                   unsigned theWeight, Qt::CaseSensitivity s)
+    : m_pattern(s == Qt::CaseInsensitive ? thePattern.toLower() : thePattern),
+      m_mimeType(theMimeType), m_weight(theWeight), m_caseSensitivity(s)
 {
-    // "Applications MUST match globs case-insensitively, except when the case-sensitive
-    // attribute is set to true."
-    // The constructor takes care of putting case-insensitive patterns in lowercase.
-    const QString filename = m_caseSensitivity == Qt::CaseInsensitive ? inputFilename.toLower() : inputFilename;
-
-    const int pattern_len = m_pattern.length();
-    if (!pattern_len)
-        return false;
-    const int len = filename.length();
-
+    // Classify the pattern once, matchFileName() is called for every pattern
+    // of the (long) glob lists on every lookup.
     const int starCount = m_pattern.count(QLatin1Char('*'));
+    const bool hasOtherWildcards = m_pattern.contains(QLatin1Char('['))
+            || m_pattern.contains(QLatin1Char('?'));
+    if (hasOtherWildcards || starCount > 1)
+        m_patternType = OtherPattern;
+    else if (starCount == 0)
+        m_patternType = LiteralPattern;
+    else if (m_pattern.startsWith(QLatin1Char('*')))
+        m_patternType = SuffixPattern;
+    else if (m_pattern.endsWith(QLatin1Char('*')))
+        m_patternType = PrefixPattern;
+    else
+        m_patternType = OtherPattern;
 
-    // Patterns like "*~", "*.extension"
-    if (m_pattern[0] == QLatin1Char('*') && m_pattern.indexOf(QLatin1Char('[')) == -1 && starCount == 1)
-    {
-        if (len + 1 < pattern_len) return false;
-
-        const QChar *c1 = m_pattern.unicode() + pattern_len - 1;
-        const QChar *c2 = filename.unicode() + len - 1;
-        int cnt = 1;
-        while (cnt < pattern_len && *c1-- == *c2--)
-            ++cnt;
-        return cnt == pattern_len;
-    }
+#if QT_CONFIG(regularexpression)
+    if (m_patternType == OtherPattern)
+        m_regexp = QRegularExpression::fromWildcard(m_pattern, m_caseSensitivity);
+#endif
+}
 
-    // Patterns like "README*" (well this is currently the only one like that...)
-    if (starCount == 1 && m_pattern.at(pattern_len - 1) == QLatin1Char('*')) {
-        if (len + 1 < pattern_len) return false;
-        if (m_pattern.at(0) == QLatin1Char('*'))
-            return filename.indexOf(QStringView{m_pattern}.mid(1, pattern_len - 2)) != -1;
+bool QMimeGlobPattern::matchFileName(const QString &filename) const
+{
+    return matchFileName(filename, m_caseSensitivity == Qt::CaseInsensitive ? filename.toLower()
+                                                                          : QString());
+}
 
-        const QChar *c1 = m_pattern.unicode();
-        const QChar *c2 = filename.unicode();
-        int cnt = 1;
-        while (cnt < pattern_len && *c1++ == *c2++)
-           ++cnt;
-        return cnt == pattern_len;
-    }
+/*!
+    \internal
+    Matches  filename against the pattern.  lowerFilename is  filename
+    converted to lowercase, so that callers matching many patterns only need
+    to convert it once. It is not used for case-sensitive patterns.
+*/
+bool QMimeGlobPattern::matchFileName(const QString &filename, const QString &lowerFilename) const
+{
+    // "Applications MUST match globs case-insensitively, except when the case-sensitive
+    // attribute is set to true."
+    // The constructor takes care of putting case-insensitive patterns in lowercase.
+    const QString &name = m_caseSensitivity == Qt::CaseInsensitive ? lowerFilename : filename;
 
-    // Names without any wildcards like "README"
-    if (m_pattern.indexOf(QLatin1Char('[')) == -1 && starCount == 0 && m_pattern.indexOf(QLatin1Char('?')))
-        return (m_pattern == filename);
+    if (m_pattern.isEmpty())
+        return false;
 
-    // Other (quite rare) patterns, like "*.anim[1-9j]": use slow but correct method
+    switch (m_patternType) {
+    case SuffixPattern:
+        return name.endsWith(QStringView{m_pattern}.mid(1));
+    case PrefixPattern:
+        return name.startsWith(QStringView{m_pattern}.chopped(1));
+    case LiteralPattern:
+        return name == m_pattern;
+    case OtherPattern:
+        // Quite rare patterns, like "*.anim[1-9j]": use slow but correct method
 #if QT_CONFIG(regularexpression)
-    auto rx = QRegularExpression::fromWildcard(m_pattern);
-    return rx.match(filename).hasMatch();
+        return m_regexp.match(name).hasMatch();
 #else
-    return false;
+        return false;
 #endif
+    }
+    return false;
 }
 
 static bool isSimplePattern(const QString &pattern)
@@ -212,11 +225,12 @@ void QMimeGlobPatternList::match(QMimeGlobMatchResult &result,
                                  const QString &fileName) const
 {
 
+    const QString lowerFileName = fileName.toLower();
     QMimeGlobPatternList::const_iterator it = this->constBegin();
     const QMimeGlobPatternList::const_iterator endIt = this->constEnd();
     for (; it != endIt; ++it) {
         const QMimeGlobPattern &glob = *it;
-        if (glob.matchFileName(fileName)) {
+        if (glob.matchFileName(fileName, lowerFileName)) {
             const QString pattern = glob.pattern();
             const int suffixLen = isSimplePattern(pattern) ? pattern.length() - 2 : 0;
             result.addMatch(glob.mimeType(), glob.weight(), pattern, suffixLen);
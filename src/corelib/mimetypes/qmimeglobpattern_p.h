@@ -57,6 +57,9 @@ QT_REQUIRE_CONFIG(mimetype);
 
 #include <QtCore/qstringlist.h>
 #include <QtCore/qhash.h>
+#if QT_CONFIG(regularexpression)
+#include <QtCore/qregularexpression.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -78,11 +81,7 @@ public:
     static const unsigned DefaultWeight = 50;
     static const unsigned MinWeight = 1;
 
-    explicit QMimeGlobPattern(const QString &thePattern, const QString &theMimeType, unsigned theWeight = DefaultWeight, Qt::CaseSensitivity s = Qt::CaseInsensitive) :
-        m_pattern(s == Qt::CaseInsensitive ? thePattern.toLower() : thePattern),
-        m_mimeType(theMimeType), m_weight(theWeight), m_caseSensitivity(s)
-    {
-    }
+    explicit QMimeGlobPattern(const QString &thePattern, const QString &theMimeType, unsigned theWeight = DefaultWeight, Qt::CaseSensitivity s = Qt::CaseInsensitive);
 
     void swap(QMimeGlobPattern &other) noexcept
     {
@@ -90,9 +89,14 @@ public:
         qSwap(m_mimeType,        other.m_mimeType);
         qSwap(m_weight,          other.m_weight);
         qSwap(m_caseSensitivity, other.m_caseSensitivity);
+        qSwap(m_patternType,     other.m_patternType);
+#if QT_CONFIG(regularexpression)
+        qSwap(m_regexp,          other.m_regexp);
+#endif
     }
 
     bool matchFileName(const QString &filename) const;
+    bool matchFileName(const QString &filename, const QString &lowerFilename) const;
 
     inline const QString &pattern() const { return m_pattern; }
     inline unsigned weight() const { return m_weight; }
@@ -100,10 +104,21 @@ public:
     inline bool isCaseSensitive() const { return m_caseSensitivity == Qt::CaseSensitive; }
 
 private:
+    enum PatternType {
+        SuffixPattern,  // "*~", "*.extension"
+        PrefixPattern,  // "README*"
+        LiteralPattern, // "README"
+        OtherPattern    // "*.anim[1-9j]"
+    };
+
     QString m_pattern;
     QString m_mimeType;
     int m_weight;
     Qt::CaseSensitivity m_caseSensitivity;
+    PatternType m_patternType;
+#if QT_CONFIG(regularexpression)
+    QRegularExpression m_regexp; // only for OtherPattern
+#endif
 };
 Q_DECLARE_SHARED(QMimeGlobPattern)
 
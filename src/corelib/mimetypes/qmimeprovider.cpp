@@ -254,6 +254,7 @@ void QMimeBinaryProvider::matchGlobList(QMimeGlobMatchResult &result, CacheFile
 {
     const int numGlobs = cacheFile->getUint32(off);
     //qDebug() << "Loading" << numGlobs << "globs from" << cacheFile->file.fileName() << "at offset" << cacheFile->globListOffset;
+    const QString lowerFileName = fileName.toLower();
     for (int i = 0; i < numGlobs; ++i) {
         const int globOffset = cacheFile->getUint32(off + 4 + 12 * i);
         const int mimeTypeOffset = cacheFile->getUint32(off + 4 + 12 * i + 4);
@@ -268,7 +269,7 @@ void QMimeBinaryProvider::matchGlobList(QMimeGlobMatchResult &result, CacheFile
         QMimeGlobPattern glob(pattern, QString() /*unused*/, weight, qtCaseSensitive);
 
         // TODO: this could be done faster for literals where a simple == would do.
-        if (glob.matchFileName(fileName))
+        if (glob.matchFileName(fileName, lowerFileName))
             result.addMatch(QLatin1String(mimeType), weight, pattern);
     }
 }
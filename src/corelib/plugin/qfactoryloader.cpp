@@ -58,6 +58,9 @@
 #include "qjsonobject.h"
 #include "qjsonarray.h"
 #include "private/qduplicatetracker_p.h"
+#if QT_CONFIG(library)
+#include "qpluginmetadatacache_p.h"
+#endif
 
 #include <qtcore_tracepoints_p.h>
 
@@ -170,6 +173,7 @@ void QFactoryLoader::update()
 {
 #ifdef QT_SHARED
     Q_D(QFactoryLoader);
+    Q_TRACE_SCOPE(QFactoryLoader_update, d->suffix);
     QStringList paths = QCoreApplication::libraryPaths();
     for (int i = 0; i < paths.count(); ++i) {
         const QString &pluginDir = paths.at(i);
@@ -284,6 +288,7 @@ void QFactoryLoader::update()
             }
         }
     }
+    QPluginMetaDataCache::save();
 #else
     Q_D(QFactoryLoader);
     if (qt_debug_component()) {
@@ -63,6 +63,7 @@
 #include <qjsonvalue.h>
 #include "qelfparser_p.h"
 #include "qmachparser_p.h"
+#include "qpluginmetadatacache_p.h"
 
 #include <qtcore_tracepoints_p.h>
 
@@ -236,6 +237,19 @@ static qsizetype qt_find_pattern(const char *s, qsizetype s_len,
 */
 static bool findPatternUnloaded(const QString &library, QLibraryPrivate *lib)
 {
+    QJsonObject cachedMetaData;
+    if (QPluginMetaDataCache::lookup(library, &cachedMetaData)) {
+        if (cachedMetaData.isEmpty()) {
+            if (lib)
+                lib->errorString = QLibrary::tr("Failed to extract plugin meta data from '%1'").arg(library);
+            return false;
+        }
+        if (qt_debug_component())
+            qWarning("Found cached metadata for lib %ls", qUtf16Printable(library));
+        lib->metaData = cachedMetaData;
+        return true;
+    }
+
     QFile file(library);
     if (!file.open(QIODevice::ReadOnly)) {
         if (lib)
@@ -333,6 +347,7 @@ static bool findPatternUnloaded(const QString &library, QLibraryPrivate *lib)
     if (!ret && lib)
         lib->errorString = QLibrary::tr("Failed to extract plugin meta data from '%1'").arg(library);
     file.close();
+    QPluginMetaDataCache::insert(library, ret ? lib->metaData : QJsonObject());
     return ret;
 }
 
@@ -0,0 +1,275 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qpluginmetadatacache_p.h"
+
+#include <qcborarray.h>
+#include <qcbormap.h>
+#include <qcborvalue.h>
+#include <qcryptographichash.h>
+#include <qdatetime.h>
+#include <qdir.h>
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qhash.h>
+#include <qmutex.h>
+#include <qsavefile.h>
+#include <qstandardpaths.h>
+#include <private/qlocking_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    The plugin metadata cache remembers the metadata that was extracted from
+    each plugin file, so that scanning a plugin directory does not need to
+    open and parse every library in it again on the next start.
+
+    There is one cache file per plugin directory, in the generic cache
+    location. An entry is only used if the size and the modification time
+    of the plugin file still match; files that turned out not to be plugins
+    are stored with empty metadata. Set QT_NO_PLUGIN_METADATA_CACHE to
+    disable the cache.
+*/
+
+enum { CacheFormatVersion = 1 };
+
+namespace {
+struct CacheEntry
+{
+    qint64 size = -1;
+    qint64 lastModified = 0;
+    QJsonObject metaData;       // empty if the file is not a plugin
+    bool used = false;
+};
+
+struct DirectoryCache
+{
+    QHash<QString, CacheEntry> entries;     // keyed by file name
+    bool dirty = false;
+};
+
+struct CacheData
+{
+    QBasicMutex mutex;
+    QHash<QString, DirectoryCache> directories;
+
+    DirectoryCache &directory(const QString &path);
+};
+}
+
+Q_GLOBAL_STATIC(CacheData, cacheData)
+
+static qint64 lastModified(const QFileInfo &info)
+{
+    return info.lastModified().toMSecsSinceEpoch();
+}
+
+DirectoryCache &CacheData::directory(const QString &path)
+{
+    auto it = directories.find(path);
+    if (it != directories.end())
+        return *it;
+
+    DirectoryCache &cache = directories[path];
+    QFile file(QPluginMetaDataCache::cacheFileName(path));
+    if (file.fileName().isEmpty() || !file.open(QIODevice::ReadOnly))
+        return cache;
+
+    const QCborMap map = QCborValue::fromCbor(file.readAll()).toMap();
+    // the interpretation of the metadata may change between Qt versions
+    if (map.value(QLatin1String("version")).toInteger() != CacheFormatVersion
+            || map.value(QLatin1String("qt")).toInteger() != QT_VERSION)
+        return cache;
+
+    const QCborMap files = map.value(QLatin1String("files")).toMap();
+    for (auto it : files) {
+        const QCborArray array = it.second.toArray();
+        CacheEntry entry;
+        entry.size = array.at(0).toInteger(-1);
+        entry.lastModified = array.at(1).toInteger();
+        entry.metaData = array.at(2).toMap().toJsonObject();
+        cache.entries.insert(it.first.toString(), entry);
+    }
+    return cache;
+}
+
+bool QPluginMetaDataCache::isEnabled()
+{
+    static const bool enabled = !qEnvironmentVariableIsSet("QT_NO_PLUGIN_METADATA_CACHE");
+    return enabled;
+}
+
+/*!
+    \internal
+
+    Returns the name of the file caching the metadata of the plugins in
+    \a directory, or an empty string if there is no writable cache location.
+*/
+QString QPluginMetaDataCache::cacheFileName(const QString &directory)
+{
+    const QString base = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (base.isEmpty())
+        return QString();
+
+    const QByteArray hash = QCryptographicHash::hash(QFile::encodeName(directory),
+                                                     QCryptographicHash::Sha1).toHex();
+    return base + QLatin1String("/qtpluginmetadata/") + QLatin1String(hash)
+            + QLatin1String(".cbor");
+}
+
+/*!
+    \internal
+
+    Looks up the cached metadata of the plugin \a fileName. Returns \c true
+    and sets \a metaData if the cache has an entry matching the file as it is
+    on disk now; \a metaData is empty if the file is known not to be a plugin.
+*/
+bool QPluginMetaDataCache::lookup(const QString &fileName, QJsonObject *metaData)
+{
+    if (!isEnabled())
+        return false;
+    CacheData *d = cacheData();
+    if (!d)
+        return false;
+
+    const QFileInfo info(fileName);
+    const auto locker = qt_scoped_lock(d->mutex);
+    DirectoryCache &cache = d->directory(info.absolutePath());
+    auto it = cache.entries.find(info.fileName());
+    if (it == cache.entries.end() || it->size != info.size()
+            || it->lastModified != lastModified(info))
+        return false;
+
+    it->used = true;
+    *metaData = it->metaData;
+    return true;
+}
+
+/*!
+    \internal
+
+    Records \a metaData as the metadata of the plugin \a fileName. An empty
+    \a metaData records that the file is not a plugin. The cache file is
+    only updated by save().
+*/
+void QPluginMetaDataCache::insert(const QString &fileName, const QJsonObject &metaData)
+{
+    if (!isEnabled())
+        return;
+    CacheData *d = cacheData();
+    if (!d)
+        return;
+
+    const QFileInfo info(fileName);
+    const auto locker = qt_scoped_lock(d->mutex);
+    DirectoryCache &cache = d->directory(info.absolutePath());
+    CacheEntry &entry = cache.entries[info.fileName()];
+    entry.size = info.size();
+    entry.lastModified = lastModified(info);
+    entry.metaData = metaData;
+    entry.used = true;
+    cache.dirty = true;
+}
+
+/*!
+    \internal
+
+    Writes the cache files of all directories that gained new entries.
+    Entries for plugin files that no longer exist are dropped.
+*/
+void QPluginMetaDataCache::save()
+{
+#if QT_CONFIG(temporaryfile)
+    if (!isEnabled())
+        return;
+    CacheData *d = cacheData();
+    if (!d)
+        return;
+
+    const auto locker = qt_scoped_lock(d->mutex);
+    for (auto dir = d->directories.begin(); dir != d->directories.end(); ++dir) {
+        if (!dir->dirty)
+            continue;
+        dir->dirty = false;
+
+        const QString fileName = cacheFileName(dir.key());
+        if (fileName.isEmpty())
+            continue;
+
+        QCborMap files;
+        for (auto it = dir->entries.cbegin(); it != dir->entries.cend(); ++it) {
+            if (!it->used && !QFileInfo::exists(dir.key() + QLatin1Char('/') + it.key()))
+                continue;
+            const QCborValue metaData = it->metaData.isEmpty()
+                    ? QCborValue() : QCborValue(QCborMap::fromJsonObject(it->metaData));
+            files.insert(it.key(), QCborArray{ it->size, it->lastModified, metaData });
+        }
+
+        QCborMap map;
+        map.insert(QLatin1String("version"), CacheFormatVersion);
+        map.insert(QLatin1String("qt"), QT_VERSION);
+        map.insert(QLatin1String("files"), files);
+
+        QDir().mkpath(QFileInfo(fileName).absolutePath());
+        QSaveFile file(fileName);
+        if (file.open(QIODevice::WriteOnly)) {
+            file.write(map.toCborValue().toCbor());
+            file.commit();
+        }
+    }
+#endif
+}
+
+/*!
+    \internal
+
+    Forgets everything that was read or recorded, so that the cache files
+    are read again on the next lookup. Used by the auto test.
+*/
+void QPluginMetaDataCache::clear()
+{
+    CacheData *d = cacheData();
+    if (!d)
+        return;
+
+    const auto locker = qt_scoped_lock(d->mutex);
+    d->directories.clear();
+}
+
+QT_END_NAMESPACE
@@ -1,3 +1,4 @@
+qt_commandline_option(arraydata-cache TYPE boolean NAME arraydata_cache)
 qt_commandline_option(doubleconversion TYPE enum VALUES no qt system)
 qt_commandline_option(eventfd TYPE boolean)
 qt_commandline_option(glib TYPE boolean)
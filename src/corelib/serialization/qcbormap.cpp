@@ -40,6 +40,9 @@
 #include "qcbormap.h"
 #include "qcborvalue_p.h"
 
+#include <algorithm>
+#include <numeric>
+
 QT_BEGIN_NAMESPACE
 
 using namespace QtCbor;
@@ -228,6 +231,74 @@ QCborMap::QCborMap(const QCborMap &other) noexcept
     \endcode
  */
 
+/*!
+    \since 6.0
+
+    Returns a map containing the key-value pairs in \a list. The result is
+    the same as inserting the pairs one by one with insert(): if a key occurs
+    more than once, the map contains it once, at the position of its first
+    occurrence, with the value of its last one.
+
+    Inserting into a QCborMap needs a linear search for the key, so building a
+    large map one element at a time takes quadratic time. This function finds
+    the duplicate keys by sorting the list once instead. If all keys are
+    strings, they are compared as QString, without looking at how each
+    would be encoded.
+
+    \sa insert(), fromVariantMap()
+ */
+QCborMap QCborMap::fromKeyValueList(const QList<value_type> &list)
+{
+    const qsizetype n = list.size();
+    QList<qsizetype> order(n);
+    std::iota(order.begin(), order.end(), 0);
+
+    QList<QString> stringKeys;
+    if (std::all_of(list.cbegin(), list.cend(), [](const value_type &p) { return p.first.isString(); })) {
+        stringKeys.reserve(n);
+        for (const value_type &pair : list)
+            stringKeys.append(pair.first.toString());
+        std::stable_sort(order.begin(), order.end(), [&stringKeys](qsizetype a, qsizetype b) {
+            return QtPrivate::compareStrings(stringKeys.at(a), stringKeys.at(b)) < 0;
+        });
+    } else {
+        std::stable_sort(order.begin(), order.end(), [&list](qsizetype a, qsizetype b) {
+            return list.at(a).first.compare(list.at(b).first) < 0;
+        });
+    }
+    const auto sameKey = [&](qsizetype a, qsizetype b) {
+        if (!stringKeys.isEmpty())
+            return stringKeys.at(a) == stringKeys.at(b);
+        return list.at(a).first == list.at(b).first;
+    };
+
+    // The sort is stable, so each run of equal keys starts with the first
+    // occurrence and ends with the last one. Map the former to the latter.
+    QList<qsizetype> valueIndex(n, -1);
+    qsizetype count = 0;
+    for (qsizetype i = 0; i < n; ) {
+        qsizetype j = i + 1;
+        while (j < n && sameKey(order.at(i), order.at(j)))
+            ++j;
+        valueIndex[order.at(i)] = order.at(j - 1);
+        ++count;
+        i = j;
+    }
+
+    QCborMap m;
+    if (!count)
+        return m;
+    m.detach(count * 2);
+    QCborContainerPrivate *d = m.d.data();
+    for (qsizetype i = 0; i < n; ++i) {
+        if (valueIndex.at(i) < 0)
+            continue;
+        d->append(list.at(i).first);
+        d->append(list.at(valueIndex.at(i)).second);
+    }
+    return m;
+}
+
 /*!
     Destroys this QCborMap object and frees any associated resources it owns.
  */
@@ -319,6 +319,7 @@ public:
     }
     iterator insert(value_type v) { return insert(v.first, v.second); }
 
+    static QCborMap fromKeyValueList(const QList<value_type> &list);
     static QCborMap fromVariantMap(const QVariantMap &map);
     static QCborMap fromVariantHash(const QVariantHash &hash);
     static QCborMap fromJsonObject(const QJsonObject &o);
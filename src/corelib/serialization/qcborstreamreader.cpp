@@ -558,6 +558,7 @@ public:
 
     QIODevice *device;
     QByteArray buffer;
+    QByteArray chunkBuffer;     // for readStringChunkView() from a device
     QStack<CborValue> containerStack;
 
     CborParser parser;
@@ -1338,7 +1339,8 @@ bool QCborStreamReader::leaveContainer()
  */
 QCborStreamReader::StringResult<QString> QCborStreamReader::_readString_helper()
 {
-    auto r = _readByteArray_helper();
+    // Without a device, this converts straight from the source data
+    auto r = readStringChunkView();
     QCborStreamReader::StringResult<QString> result;
     result.status = r.status;
 
@@ -1350,7 +1352,7 @@ QCborStreamReader::StringResult<QString> QCborStreamReader::_readString_helper()
             err = CborErrorDataTooLarge;
         } else {
             QStringConverter::State cs(QStringConverter::Flag::Stateless);
-            result.data = QUtf8::convertToUnicode(r.data, r.data.size(), &cs);
+            result.data = QUtf8::convertToUnicode(r.data.data(), r.data.size(), &cs);
             if (cs.invalidChars != 0 || cs.remainingChars != 0)
                 err = CborErrorInvalidUtf8TextString;
         }
@@ -1460,6 +1462,121 @@ qsizetype QCborStreamReader::_currentStringChunkSize() const
  */
 QCborStreamReader::StringResult<qsizetype>
 QCborStreamReader::readStringChunk(char *ptr, qsizetype maxlen)
+{
+    qptrdiff offset;
+    QCborStreamReader::StringResult<qsizetype> result = _nextStringChunk_helper(&offset);
+    if (result.status != Ok)
+        return result;
+
+    // Read the chunk into the user's buffer.
+    qint64 actuallyRead;
+    const qsizetype len = result.data;
+    qsizetype toRead = len;
+    qsizetype left = toRead - maxlen;
+    if (left < 0)
+        left = 0;               // buffer bigger than string
+    else
+        toRead = maxlen;        // buffer smaller than string
+
+    if (d->device) {
+        // This first skip can't fail because we've already read this many bytes.
+        d->device->skip(d->bufferStart + offset);
+        actuallyRead = d->device->read(ptr, toRead);
+
+        if (actuallyRead != toRead)  {
+            actuallyRead = -1;
+        } else if (left) {
+            qint64 skipped = d->device->skip(left);
+            if (skipped != left)
+                actuallyRead = -1;
+        }
+
+        if (actuallyRead < 0) {
+            d->handleError(CborErrorIO);
+            result.data = 0;
+            result.status = Error;
+            return result;
+        }
+
+        d->updateBufferAfterString(offset, len);
+    } else {
+        actuallyRead = toRead;
+        memcpy(ptr, d->buffer.constData() + d->bufferStart + offset, toRead);
+        d->bufferStart += QByteArray::size_type(offset + len);
+    }
+
+    d->preread();
+    result.data = actuallyRead;
+    return result;
+}
+
+/*!
+    \since 6.0
+
+    Reads the current text or byte string chunk and returns a view of it,
+    without copying the data when possible. The \c \l StringResult::status
+    member indicates whether there was an error reading the string, whether a
+    chunk was returned or whether this was the last chunk, as for
+    readStringChunk().
+
+    If this reader is reading from a QByteArray or raw data, the view points
+    into that data, so it remains valid as long as the data does, even after
+    the reader has advanced past the string. This makes it possible to read
+    large CBOR files without any copying by mapping them into memory with
+    QFile::map():
+
+    \snippet code/src_corelib_serialization_qcborstream.cpp 30
+
+    If this reader is reading from a QIODevice, the chunk is copied into a
+    buffer owned by the reader, and the view is only valid until the next call
+    to a function of this reader.
+
+    As with readStringChunk(), strings are returned in UTF-8, without
+    verification that their contents are properly formatted.
+
+    \sa readStringChunk(), readString(), readByteArray(), currentStringChunkSize()
+ */
+QCborStreamReader::StringResult<QByteArrayView> QCborStreamReader::readStringChunkView()
+{
+    QCborStreamReader::StringResult<QByteArrayView> result;
+    result.status = Error;
+    const qsizetype len = _currentStringChunkSize();
+    if (len < 0)
+        return result;
+    if (len > MaxByteArraySize) {
+        d->handleError(CborErrorDataTooLarge);
+        return result;
+    }
+
+    if (d->device) {
+        d->chunkBuffer.resize(len);
+        const auto r = readStringChunk(d->chunkBuffer.data(), len);
+        result.status = r.status;
+        if (r.status == Ok)
+            result.data = QByteArrayView(d->chunkBuffer.constData(), r.data);
+        return result;
+    }
+
+    qptrdiff offset;
+    const auto r = _nextStringChunk_helper(&offset);
+    result.status = r.status;
+    if (r.status != Ok)
+        return result;
+
+    result.data = QByteArrayView(d->buffer.constData() + d->bufferStart + offset, r.data);
+    d->bufferStart += QByteArray::size_type(offset + r.data);
+    d->preread();
+    return result;
+}
+
+/*!
+    \internal
+
+    Locates the next string chunk: on success, returns Ok with the chunk's size
+    and sets \a offset to its position relative to the buffer start.
+ */
+QCborStreamReader::StringResult<qsizetype>
+QCborStreamReader::_nextStringChunk_helper(qptrdiff *offset)
 {
     CborError err;
     size_t len;
@@ -1505,43 +1622,8 @@ QCborStreamReader::readStringChunk(char *ptr, qsizetype maxlen)
         return result;
     }
 
-    // Read the chunk into the user's buffer.
-    qint64 actuallyRead;
-    qptrdiff offset = qptrdiff(content);
-    qsizetype toRead = qsizetype(len);
-    qsizetype left = toRead - maxlen;
-    if (left < 0)
-        left = 0;               // buffer bigger than string
-    else
-        toRead = maxlen;        // buffer smaller than string
-
-    if (d->device) {
-        // This first skip can't fail because we've already read this many bytes.
-        d->device->skip(d->bufferStart + qptrdiff(content));
-        actuallyRead = d->device->read(ptr, toRead);
-
-        if (actuallyRead != toRead)  {
-            actuallyRead = -1;
-        } else if (left) {
-            qint64 skipped = d->device->skip(left);
-            if (skipped != left)
-                actuallyRead = -1;
-        }
-
-        if (actuallyRead < 0) {
-            d->handleError(CborErrorIO);
-            return result;
-        }
-
-        d->updateBufferAfterString(offset, len);
-    } else {
-        actuallyRead = toRead;
-        memcpy(ptr, d->buffer.constData() + d->bufferStart + offset, toRead);
-        d->bufferStart += QByteArray::size_type(offset + len);
-    }
-
-    d->preread();
-    result.data = actuallyRead;
+    *offset = qptrdiff(content);
+    result.data = qsizetype(len);
     result.status = Ok;
     return result;
 }
@@ -347,6 +347,59 @@ QDataStream &writeAssociativeMultiContainer(QDataStream &s, const Container &c)
     return s;
 }
 
+// Integer types whose QDataStream representation is their in-memory
+// representation in the stream's byte order
+template <typename T>
+constexpr bool IsRawStreamableIntegral = std::is_integral_v<T> && !std::is_same_v<T, bool>
+        && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename T>
+inline bool canStreamRawData(const QDataStream &s)
+{
+    return sizeof(T) == 1 || s.byteOrder() == QDataStream::ByteOrder(QSysInfo::ByteOrder);
+}
+
+template <typename T>
+QDataStream &readRawIntegralList(QDataStream &s, QList<T> &c)
+{
+    StreamStateSaver stateSaver(&s);
+
+    c.clear();
+    quint32 n;
+    s >> n;
+    // grow in bounded steps, so a corrupt count can't make us allocate
+    // more than the stream actually contains
+    constexpr quint32 StepSize = quint32((1024 * 1024) / sizeof(T));
+    for (quint32 done = 0; done < n && s.status() == QDataStream::Ok; ) {
+        const quint32 step = qMin(n - done, StepSize);
+        c.resize(done + step);
+        const int len = int(step * sizeof(T));
+        if (s.readRawData(reinterpret_cast<char *>(c.data() + done), len) != len)
+            s.setStatus(QDataStream::ReadPastEnd);
+        done += step;
+    }
+    if (s.status() != QDataStream::Ok)
+        c.clear();
+
+    return s;
+}
+
+template <typename T>
+QDataStream &writeRawIntegralList(QDataStream &s, const QList<T> &c)
+{
+    s << quint32(c.size());
+    const char *data = reinterpret_cast<const char *>(c.constData());
+    qsizetype left = c.size() * qsizetype(sizeof(T));
+    while (left > 0 && s.status() == QDataStream::Ok) {
+        const int len = int(qMin(left, qsizetype(1024 * 1024)));
+        s.writeRawData(data, len);
+        data += len;
+        left -= len;
+    }
+
+    return s;
+}
+
 } // QtPrivate namespace
 
 template<typename ...T>
@@ -428,12 +481,20 @@ operator>>(QDataStream &s, T &t)
 template<typename T>
 inline QDataStreamIfHasIStreamOperators<T> operator>>(QDataStream &s, QList<T> &v)
 {
+    if constexpr (QtPrivate::IsRawStreamableIntegral<T>) {
+        if (QtPrivate::canStreamRawData<T>(s))
+            return QtPrivate::readRawIntegralList(s, v);
+    }
     return QtPrivate::readArrayBasedContainer(s, v);
 }
 
 template<typename T>
 inline QDataStreamIfHasOStreamOperators<T> operator<<(QDataStream &s, const QList<T> &v)
 {
+    if constexpr (QtPrivate::IsRawStreamableIntegral<T>) {
+        if (QtPrivate::canStreamRawData<T>(s))
+            return QtPrivate::writeRawIntegralList(s, v);
+    }
     return QtPrivate::writeSequentialContainer(s, v);
 }
 
@@ -245,12 +245,15 @@ static QJsonArray convertToJsonArray(QCborContainerPrivate *d,
 static QJsonObject convertToJsonObject(QCborContainerPrivate *d,
                                        ConversionMode mode = ConversionMode::FromRaw)
 {
-    QJsonObject o;
-    if (d) {
-        for (qsizetype idx = 0; idx < d->elements.size(); idx += 2)
-            o.insert(makeString(d, idx), qt_convertToJson(d, idx + 1, mode));
-    }
-    return o;
+    if (!d)
+        return QJsonObject();
+
+    // stringified keys may be in any order and may collide
+    QList<QPair<QString, QJsonValue>> pairs;
+    pairs.reserve(d->elements.size() / 2);
+    for (qsizetype idx = 0; idx < d->elements.size(); idx += 2)
+        pairs.append({ makeString(d, idx), qt_convertToJson(d, idx + 1, mode) });
+    return QJsonObject::fromKeyValueList(pairs);
 }
 
 QJsonValue qt_convertToJson(QCborContainerPrivate *d, qsizetype idx, ConversionMode mode)
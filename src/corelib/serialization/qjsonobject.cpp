@@ -44,6 +44,7 @@
 #include <qstringlist.h>
 #include <qdebug.h>
 #include <qvariant.h>
+#include <qvarlengtharray.h>
 #include <qcbormap.h>
 
 #include <private/qcborvalue_p.h>
@@ -51,6 +52,7 @@
 #include "qjson_p.h"
 
 #include <algorithm>
+#include <numeric>
 
 QT_BEGIN_NAMESPACE
 
@@ -147,8 +149,61 @@ QJsonObject::~QJsonObject() = default;
 
 QJsonObject::QJsonObject(std::initializer_list<QPair<QString, QJsonValue> > args)
 {
-    for (const auto &arg : args)
-        insert(arg.first, arg.second);
+    if (args.size())
+        o = createSorted(args.begin(), qsizetype(args.size()));
+}
+
+/*!
+    \internal
+
+    Creates the storage for an object with the \a n key-value pairs starting
+    at \a pairs, which may be in any order. Sorting once and appending keeps
+    this O(n log n), whereas inserting the pairs one by one would move the
+    elements after each insertion point every time. As with insert(), the
+    last occurrence of a key wins and Undefined values are dropped.
+ */
+QCborContainerPrivate *QJsonObject::createSorted(const QPair<QString, QJsonValue> *pairs, qsizetype n)
+{
+    QVarLengthArray<qsizetype, 64> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [pairs](qsizetype a, qsizetype b) {
+        // the same order that indexOf() uses for the stored keys
+        return QtPrivate::compareStrings(pairs[a].first, pairs[b].first) < 0;
+    });
+
+    auto container = new QCborContainerPrivate;
+    container->elements.reserve(n * 2);
+    for (qsizetype i = 0; i < n; ++i) {
+        const auto &pair = pairs[order[i]];
+        if (i + 1 < n && pairs[order[i + 1]].first == pair.first)
+            continue;
+        if (pair.second.type() == QJsonValue::Undefined)
+            continue;
+        container->append(pair.first);
+        container->append(QCborValue::fromJsonValue(pair.second));
+    }
+    return container;
+}
+
+/*!
+    \since 6.0
+
+    Returns an object containing the key-value pairs in \a list. The result
+    is the same as inserting the pairs one by one with insert(): if a key
+    occurs more than once, the value of its last occurrence is used, and
+    pairs with an undefined value remove the key.
+
+    QJsonObject keeps its keys sorted, so each insert() has to move all the
+    elements that follow the new key. Building a large object with this
+    function sorts the keys only once instead.
+
+    \sa insert(), fromVariantHash()
+ */
+QJsonObject QJsonObject::fromKeyValueList(const QList<QPair<QString, QJsonValue>> &list)
+{
+    if (list.isEmpty())
+        return QJsonObject();
+    return QJsonObject(createSorted(list.constData(), list.size()));
 }
 
 /*!
@@ -208,7 +263,7 @@ QJsonObject &QJsonObject::operator =(const QJsonObject &other)
     \note Conversion from \l QVariant is not completely lossless. Please see
     the documentation in QJsonValue::fromVariant() for more information.
 
-    \sa fromVariantHash(), toVariantMap(), QJsonValue::fromVariant()
+    \sa fromVariantHash(), fromKeyValueList(), toVariantMap(), QJsonValue::fromVariant()
  */
 QJsonObject QJsonObject::fromVariantMap(const QVariantMap &map)
 {
@@ -241,12 +296,11 @@ QVariantMap QJsonObject::toVariantMap() const
  */
 QJsonObject QJsonObject::fromVariantHash(const QVariantHash &hash)
 {
-    // ### this is implemented the trivial way, not the most efficient way
-
-    QJsonObject object;
+    QList<QPair<QString, QJsonValue>> pairs;
+    pairs.reserve(hash.size());
     for (QVariantHash::const_iterator it = hash.constBegin(); it != hash.constEnd(); ++it)
-        object.insert(it.key(), QJsonValue::fromVariant(it.value()));
-    return object;
+        pairs.append({ it.key(), QJsonValue::fromVariant(it.value()) });
+    return fromKeyValueList(pairs);
 }
 
 /*!
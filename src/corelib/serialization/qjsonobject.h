@@ -81,6 +81,7 @@ public:
         qSwap(o, other.o);
     }
 
+    static QJsonObject fromKeyValueList(const QList<QPair<QString, QJsonValue>> &list);
     static QJsonObject fromVariantMap(const QVariantMap &map);
     QVariantMap toVariantMap() const;
     static QJsonObject fromVariantHash(const QVariantHash &map);
@@ -308,6 +309,7 @@ private:
     void setValueAt(qsizetype i, const QJsonValue &val);
     void removeAt(qsizetype i);
     template <typename T> iterator insertAt(qsizetype i, T key, const QJsonValue &val, bool exists);
+    static QCborContainerPrivate *createSorted(const QPair<QString, QJsonValue> *pairs, qsizetype n);
 
     QExplicitlySharedDataPointer<QCborContainerPrivate> o;
 };
@@ -47,6 +47,7 @@
 #include "private/qstringconverter_p.h"
 #include "private/qcborvalue_p.h"
 #include "private/qnumeric_p.h"
+#include "private/qsimd_p.h"
 
 //#define PARSER_DEBUG
 #ifdef PARSER_DEBUG
@@ -283,18 +284,69 @@ void Parser::eatBOM()
         json += 3;
 }
 
-bool Parser::eatSpace()
+/*
+    Returns the first byte at or after \a ptr that is not JSON whitespace, or
+    \a end if there is none. Only the first byte is checked without SIMD:
+    compact JSON has no whitespace at all, but indented JSON has long runs of
+    it.
+*/
+static const char *skipWhitespace(const char *ptr, const char *end)
 {
-    while (json < end) {
-        if (*json > Space)
+    if (ptr == end || uchar(*ptr) > Space)
+        return ptr;
+#ifdef __SSE2__
+    const __m128i spaces = _mm_set1_epi8(Space);
+    const __m128i tabs = _mm_set1_epi8(Tab);
+    const __m128i lineFeeds = _mm_set1_epi8(LineFeed);
+    const __m128i returns = _mm_set1_epi8(Return);
+    for ( ; end - ptr >= 16; ptr += 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        const __m128i isSpace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, spaces),
+                                                          _mm_cmpeq_epi8(data, tabs)),
+                                             _mm_or_si128(_mm_cmpeq_epi8(data, lineFeeds),
+                                                          _mm_cmpeq_epi8(data, returns)));
+        const uint mask = ~uint(_mm_movemask_epi8(isSpace)) & 0xffff;
+        if (mask)
+            return ptr + qCountTrailingZeroBits(mask);
+    }
+#endif
+    for ( ; ptr < end; ++ptr) {
+        if (*ptr != Space && *ptr != Tab && *ptr != LineFeed && *ptr != Return)
             break;
-        if (*json != Space &&
-            *json != Tab &&
-            *json != LineFeed &&
-            *json != Return)
+    }
+    return ptr;
+}
+
+/*
+    Returns the first byte at or after \a ptr that needs a closer look inside
+    a string: the closing quote, the start of an escape sequence or a byte that
+    is not 7-bit ASCII. Returns \a end if there is none.
+*/
+static const char *skipPlainAscii(const char *ptr, const char *end)
+{
+#ifdef __SSE2__
+    const __m128i quotes = _mm_set1_epi8(Quote);
+    const __m128i backslashes = _mm_set1_epi8('\\');
+    for ( ; end - ptr >= 16; ptr += 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(data, quotes),
+                                             _mm_cmpeq_epi8(data, backslashes));
+        // the sign bit of each byte flags the non-ASCII ones
+        const uint mask = uint(_mm_movemask_epi8(_mm_or_si128(special, data)));
+        if (mask)
+            return ptr + qCountTrailingZeroBits(mask);
+    }
+#endif
+    for ( ; ptr < end; ++ptr) {
+        if (*ptr == Quote || *ptr == '\\' || uchar(*ptr) >= 0x80)
             break;
-        ++json;
     }
+    return ptr;
+}
+
+bool Parser::eatSpace()
+{
+    json = skipWhitespace(json, end);
     return (json < end);
 }
 
@@ -867,6 +919,9 @@ bool Parser::parseString()
     bool isAscii = true;
     while (json < end) {
         uint ch = 0;
+        json = skipPlainAscii(json, end);
+        if (json >= end)
+            break;
         if (*json == '"')
             break;
         if (*json == '\\') {
@@ -909,6 +964,13 @@ bool Parser::parseString()
     QString ucs4;
     while (json < end) {
         uint ch = 0;
+        const char *plain = skipPlainAscii(json, end);
+        if (plain != json) {
+            ucs4.append(QLatin1String(json, plain - json));
+            json = plain;
+            if (json >= end)
+                break;
+        }
         if (*json == '"')
             break;
         else if (*json == '\\') {
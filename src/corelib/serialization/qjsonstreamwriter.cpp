@@ -0,0 +1,458 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qjsonstreamwriter.h"
+
+#include <qcborvalue.h>
+#include <qiodevice.h>
+#include <qjsonvalue.h>
+#include <qlocale.h>
+#include <qvarlengtharray.h>
+#include "qjsonwriter_p.h"
+#include <private/qnumeric_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+   \class QJsonStreamWriter
+   \inmodule QtCore
+   \ingroup json
+   \reentrant
+   \since 6.0
+
+   \brief The QJsonStreamWriter class writes JSON text incrementally to a
+   QIODevice or QByteArray.
+
+   QJsonDocument::toJson() produces the whole text of a document at once, so
+   the document has to be fully built first and its text held in memory until
+   it is written out. QJsonStreamWriter instead encodes values as they are
+   appended, in the same format as QJsonDocument::toJson(), and passes the
+   text on to its device whenever bufferSize() bytes have accumulated. Like
+   QCborStreamWriter, it provides a StAX-like API: arrays and objects are
+   opened with startArray() and startObject() and must be closed with the
+   matching endArray() and endObject(); each member of an object is written as
+   a key, with appendKey(), followed by its value.
+
+   The following example writes a result set row by row:
+
+   \snippet code/src_corelib_serialization_qjsonstreamwriter.cpp 0
+
+   A complete QJsonValue, including arrays and objects, can be written with
+   append() as well.
+
+   QJsonStreamWriter does not validate its input beyond checking that
+   endArray() and endObject() match the open container. Writing a value
+   inside an object without a key first, or more than one value at the top
+   level, results in invalid JSON.
+
+   \sa QJsonDocument, QCborStreamWriter, QXmlStreamWriter
+*/
+
+class QJsonStreamWriterPrivate
+{
+public:
+    struct Container
+    {
+        bool isObject;
+        qsizetype count;
+    };
+
+    QJsonStreamWriterPrivate(QIODevice *device, QByteArray *data, QJsonDocument::JsonFormat format)
+        : device(device), data(data), compact(format == QJsonDocument::Compact)
+    {
+    }
+
+    QByteArray &out() { return data ? *data : buffer; }
+    int level() const { return int(containers.size()); }
+
+    void appendIndent(int level)
+    {
+        if (compact || level == 0)
+            return;
+        QByteArray &json = out();
+        const qsizetype size = json.size();
+        json.resize(size + 4 * level);
+        memset(json.data() + size, ' ', 4 * level);
+    }
+
+    void startValue();
+    void finishValue()
+    {
+        if (device && buffer.size() >= bufferSize)
+            flush();
+    }
+    void startContainer(bool isObject);
+    bool endContainer(bool isObject);
+    void flush();
+
+    QIODevice *device;
+    QByteArray *data;
+    QByteArray buffer;
+    QVarLengthArray<Container, 16> containers;
+    qsizetype bufferSize = 16 * 1024;
+    bool compact;
+    bool keyWritten = false;
+};
+
+void QJsonStreamWriterPrivate::startValue()
+{
+    if (keyWritten) {
+        // the separator and indentation were written with the key
+        keyWritten = false;
+        return;
+    }
+    if (containers.isEmpty())
+        return;
+
+    Container &container = containers.last();
+    Q_ASSERT_X(!container.isObject, "QJsonStreamWriter", "a value in an object needs a key");
+    if (container.count++)
+        out() += compact ? "," : ",\n";
+    appendIndent(level());
+}
+
+void QJsonStreamWriterPrivate::startContainer(bool isObject)
+{
+    startValue();
+    if (isObject)
+        out() += compact ? "{" : "{\n";
+    else
+        out() += compact ? "[" : "[\n";
+    containers.append({ isObject, 0 });
+}
+
+bool QJsonStreamWriterPrivate::endContainer(bool isObject)
+{
+    if (containers.isEmpty() || containers.last().isObject != isObject || keyWritten)
+        return false;
+
+    const Container container = containers.last();
+    containers.removeLast();
+    QByteArray &json = out();
+    if (container.count && !compact)
+        json += '\n';
+    appendIndent(level());
+    json += isObject ? '}' : ']';
+    if (containers.isEmpty() && !compact)
+        json += '\n';
+    finishValue();
+    return true;
+}
+
+void QJsonStreamWriterPrivate::flush()
+{
+    if (!device || buffer.isEmpty())
+        return;
+    device->write(buffer);
+    buffer.truncate(0);
+}
+
+/*!
+   Creates a QJsonStreamWriter that writes JSON text in the given
+   \a format to the device \a device, which must already be open for
+   writing. The writer does not take ownership of the device.
+
+   \sa setDevice(), flush()
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device, QJsonDocument::JsonFormat format)
+    : d(new QJsonStreamWriterPrivate(device, nullptr, format))
+{
+}
+
+/*!
+   Creates a QJsonStreamWriter that appends JSON text in the given \a format
+   to \a data. The text is appended directly, without buffering.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QByteArray *data, QJsonDocument::JsonFormat format)
+    : d(new QJsonStreamWriterPrivate(nullptr, data, format))
+{
+}
+
+/*!
+   Destroys this QJsonStreamWriter, after writing any buffered text to the
+   device. Containers still open are not closed.
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+    d->flush();
+}
+
+/*!
+   Replaces the device or byte array that this QJsonStreamWriter is writing to
+   with \a device, after writing any buffered text to the previous device.
+
+   \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    d->flush();
+    d->device = device;
+    d->data = nullptr;
+}
+
+/*!
+   Returns the device this writer is writing to, or \nullptr if it appends to
+   a QByteArray.
+
+   \sa setDevice()
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    return d->device;
+}
+
+/*!
+   Sets the format of the text written from now on to \a format. The format
+   should only be changed before the first value is written.
+*/
+void QJsonStreamWriter::setFormat(QJsonDocument::JsonFormat format)
+{
+    d->compact = format == QJsonDocument::Compact;
+}
+
+/*!
+   Returns the format of the text this writer produces.
+*/
+QJsonDocument::JsonFormat QJsonStreamWriter::format() const
+{
+    return d->compact ? QJsonDocument::Compact : QJsonDocument::Indented;
+}
+
+/*!
+   Sets to \a size the number of bytes of text that are collected before they
+   are written to the device. The default is 16 KiB.
+
+   The buffer only grows past \a size while a single string or QJsonValue is
+   encoded.
+
+   \sa flush()
+*/
+void QJsonStreamWriter::setBufferSize(qsizetype size)
+{
+    d->bufferSize = qMax(size, qsizetype(0));
+    d->finishValue();
+}
+
+/*!
+   Returns the number of bytes of text that are collected before they are
+   written to the device.
+*/
+qsizetype QJsonStreamWriter::bufferSize() const
+{
+    return d->bufferSize;
+}
+
+/*!
+   Writes all buffered text to the device.
+
+   \sa bufferSize()
+*/
+void QJsonStreamWriter::flush()
+{
+    d->flush();
+}
+
+/*!
+   Writes \a key as the key of the next member of the current object. It must
+   be followed by the member's value.
+*/
+void QJsonStreamWriter::appendKey(QStringView key)
+{
+    Q_ASSERT_X(!d->containers.isEmpty() && d->containers.last().isObject && !d->keyWritten,
+               "QJsonStreamWriter::appendKey", "keys can only be written in objects");
+    QJsonStreamWriterPrivate::Container &container = d->containers.last();
+    QByteArray &json = d->out();
+    if (container.count++)
+        json += d->compact ? "," : ",\n";
+    d->appendIndent(d->level());
+    QJsonPrivate::Writer::stringToJson(key, json);
+    json += d->compact ? ":" : ": ";
+    d->keyWritten = true;
+}
+
+/*!
+   \overload
+*/
+void QJsonStreamWriter::appendKey(QLatin1String key)
+{
+    appendKey(QString(key));
+}
+
+/*!
+   Writes the string \a str, escaping the characters that JSON requires to be
+   escaped.
+*/
+void QJsonStreamWriter::append(QStringView str)
+{
+    d->startValue();
+    QJsonPrivate::Writer::stringToJson(str, d->out());
+    d->finishValue();
+}
+
+/*!
+   \overload
+*/
+void QJsonStreamWriter::append(QLatin1String str)
+{
+    append(QString(str));
+}
+
+/*!
+   \fn void QJsonStreamWriter::append(const char *str)
+   \overload
+
+   Writes the UTF-8 encoded, null-terminated string \a str.
+*/
+
+/*!
+   \overload
+
+   Writes the integer \a i.
+*/
+void QJsonStreamWriter::append(qint64 i)
+{
+    d->startValue();
+    d->out() += QByteArray::number(i);
+    d->finishValue();
+}
+
+/*!
+   \overload
+
+   Writes the number \a d, in its shortest exact representation. JSON has no
+   representation for infinities and NaN, so these are written as \c null,
+   as QJsonDocument::toJson() does.
+*/
+void QJsonStreamWriter::append(double d)
+{
+    this->d->startValue();
+    if (qIsFinite(d))
+        this->d->out() += QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+    else
+        this->d->out() += "null";
+    this->d->finishValue();
+}
+
+/*!
+   \overload
+
+   Writes \c true or \c false, depending on \a b.
+*/
+void QJsonStreamWriter::append(bool b)
+{
+    d->startValue();
+    d->out() += b ? "true" : "false";
+    d->finishValue();
+}
+
+/*!
+   \overload
+
+   Writes \a value, including all the contents of arrays and objects.
+   QJsonValue::Undefined is written as \c null.
+*/
+void QJsonStreamWriter::append(const QJsonValue &value)
+{
+    d->startValue();
+    // in compact mode, the Writer expects to be at the top level
+    QJsonPrivate::Writer::valueToJson(QCborValue::fromJsonValue(value), d->out(),
+                                      d->compact ? 0 : d->level(), d->compact);
+    if (d->containers.isEmpty() && !d->compact && (value.isArray() || value.isObject()))
+        d->out() += '\n';
+    d->finishValue();
+}
+
+/*!
+   Writes \c null.
+*/
+void QJsonStreamWriter::appendNull()
+{
+    d->startValue();
+    d->out() += "null";
+    d->finishValue();
+}
+
+/*!
+   Starts an array. The elements appended next, up to the matching call to
+   endArray(), belong to this array.
+
+   \sa endArray(), startObject()
+*/
+void QJsonStreamWriter::startArray()
+{
+    d->startContainer(false);
+}
+
+/*!
+   Ends the array started by the matching startArray(). Returns \c false, and
+   writes nothing, if the innermost open container is not an array.
+
+   \sa startArray(), endObject()
+*/
+bool QJsonStreamWriter::endArray()
+{
+    return d->endContainer(false);
+}
+
+/*!
+   Starts an object. The members appended next, each being a key written with
+   appendKey() followed by a value, up to the matching call to endObject(),
+   belong to this object.
+
+   \sa endObject(), startArray()
+*/
+void QJsonStreamWriter::startObject()
+{
+    d->startContainer(true);
+}
+
+/*!
+   Ends the object started by the matching startObject(). Returns \c false,
+   and writes nothing, if the innermost open container is not an object, or if
+   the value for the last key is missing.
+
+   \sa startObject(), endArray()
+*/
+bool QJsonStreamWriter::endObject()
+{
+    return d->endContainer(true);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,957 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qjsonview.h"
+
+#include <qjsonarray.h>
+#include <qjsonobject.h>
+#include <qhash.h>
+#include <qlist.h>
+#include <qmutex.h>
+#include <qstringlist.h>
+#include <private/qnumeric_p.h>
+#include <private/qstringconverter_p.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QJsonView
+    \inmodule QtCore
+    \ingroup json
+    \ingroup shared
+    \reentrant
+    \since 6.0
+
+    \brief The QJsonView class provides read-only access to a JSON document
+    without converting it as a whole.
+
+    QJsonDocument::fromJson() converts the complete document into QJsonObject,
+    QJsonArray and QJsonValue instances, decoding every string on the way. When
+    only a few values of a large document are needed, most of that work is
+    wasted. QJsonView::fromJson() instead validates the document, keeps a
+    reference to it and decodes values only when they are asked for:
+
+    \snippet code/src_corelib_serialization_qjsonview.cpp 0
+
+    A QJsonView refers to a single value within the document; all views of a
+    document share the source QByteArray, which has to be valid UTF-8 JSON as
+    accepted by QJsonDocument::fromJson(). The members of an object and the
+    elements of an array are located the first time they are accessed, and that
+    index is then shared by all views of the same document; copies of a view
+    can be used concurrently from different threads.
+
+    String values can be read as QString with toString(), or without any
+    conversion with toUtf8StringView() when they contain no escape sequences.
+    toValue() converts the value into a QJsonValue, for code that needs the
+    mutable classes.
+
+    If an object contains the same key more than once, value() returns the
+    last of its values, as QJsonDocument::fromJson() does.
+
+    \sa QJsonDocument, QJsonValue
+*/
+
+namespace {
+
+static const int nestingLimit = 1024;
+
+static bool isJsonSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static const char *skipSpace(const char *ptr, const char *end)
+{
+    while (ptr < end && isJsonSpace(*ptr))
+        ++ptr;
+    return ptr;
+}
+
+/*
+    Checks that a document is valid JSON, with the same rules and errors as
+    QJsonPrivate::Parser, but without building any values.
+*/
+class Validator
+{
+public:
+    Validator(const char *json, qsizetype length)
+        : head(json), json(json), end(json + length)
+    {
+    }
+
+    bool validate(QJsonParseError *error, qsizetype *begin, qsizetype *finish);
+
+private:
+    bool eatSpace()
+    {
+        json = skipSpace(json, end);
+        return json < end;
+    }
+
+    char nextToken()
+    {
+        if (!eatSpace())
+            return 0;
+        const char token = *json++;
+        switch (token) {
+        case '[': case '{': case ':': case ',': case ']': case '}': case '"':
+            return token;
+        }
+        return 0;
+    }
+
+    bool validateObject();
+    bool validateArray();
+    bool validateValue();
+    bool validateString();
+    bool validateNumber();
+    bool validateLiteral(const char *rest, qsizetype length);
+
+    const char *head;
+    const char *json;
+    const char *end;
+    int nestingLevel = 0;
+    QJsonParseError::ParseError lastError = QJsonParseError::NoError;
+};
+
+bool Validator::validate(QJsonParseError *error, qsizetype *begin, qsizetype *finish)
+{
+    // eat UTF-8 byte order mark
+    if (end - json > 3 && qstrncmp(json, "\xef\xbb\xbf", 3) == 0)
+        json += 3;
+
+    bool ok = false;
+    const char token = nextToken();
+    *begin = json - head - 1;
+    if (token == '[') {
+        ok = validateArray();
+    } else if (token == '{') {
+        ok = validateObject();
+    } else {
+        lastError = QJsonParseError::IllegalValue;
+    }
+    *finish = json - head;
+
+    if (ok && eatSpace()) {
+        lastError = QJsonParseError::GarbageAtEnd;
+        ok = false;
+    }
+
+    if (error) {
+        error->offset = ok ? 0 : int(json - head);
+        error->error = lastError;
+    }
+    return ok;
+}
+
+bool Validator::validateObject()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    char token = nextToken();
+    while (token == '"') {
+        if (!validateString())
+            return false;
+        if (nextToken() != ':') {
+            lastError = QJsonParseError::MissingNameSeparator;
+            return false;
+        }
+        if (!eatSpace()) {
+            lastError = QJsonParseError::UnterminatedObject;
+            return false;
+        }
+        if (!validateValue())
+            return false;
+        token = nextToken();
+        if (token != ',')
+            break;
+        token = nextToken();
+        if (token == '}') {
+            lastError = QJsonParseError::MissingObject;
+            return false;
+        }
+    }
+
+    if (token != '}') {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+
+    --nestingLevel;
+    return true;
+}
+
+bool Validator::validateArray()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedArray;
+        return false;
+    }
+    if (*json == ']') {
+        nextToken();
+    } else {
+        while (true) {
+            if (!eatSpace()) {
+                lastError = QJsonParseError::UnterminatedArray;
+                return false;
+            }
+            if (!validateValue())
+                return false;
+            const char token = nextToken();
+            if (token == ']')
+                break;
+            if (token != ',') {
+                if (!eatSpace())
+                    lastError = QJsonParseError::UnterminatedArray;
+                else
+                    lastError = QJsonParseError::MissingValueSeparator;
+                return false;
+            }
+        }
+    }
+
+    --nestingLevel;
+    return true;
+}
+
+bool Validator::validateLiteral(const char *rest, qsizetype length)
+{
+    // Like the parser, insist on one more character after the literal
+    if (end - json <= length || qstrncmp(json, rest, length) != 0) {
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    }
+    json += length;
+    return true;
+}
+
+bool Validator::validateValue()
+{
+    switch (*json++) {
+    case 'n':
+        return validateLiteral("ull", 3);
+    case 't':
+        return validateLiteral("rue", 3);
+    case 'f':
+        return validateLiteral("alse", 4);
+    case '"':
+        return validateString();
+    case '[':
+        return validateArray();
+    case '{':
+        return validateObject();
+    case ',':
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case '}':
+    case ']':
+        lastError = QJsonParseError::MissingObject;
+        return false;
+    default:
+        --json;
+        return validateNumber();
+    }
+}
+
+bool Validator::validateNumber()
+{
+    const char *start = json;
+    auto isDigit = [this]() { return json < end && *json >= '0' && *json <= '9'; };
+
+    if (json < end && *json == '-')
+        ++json;
+    if (json < end && *json == '0') {
+        ++json;
+    } else {
+        while (isDigit())
+            ++json;
+    }
+    if (json < end && *json == '.') {
+        ++json;
+        while (isDigit())
+            ++json;
+    }
+    if (json < end && (*json == 'e' || *json == 'E')) {
+        ++json;
+        if (json < end && (*json == '-' || *json == '+'))
+            ++json;
+        while (isDigit())
+            ++json;
+    }
+
+    if (json >= end) {
+        lastError = QJsonParseError::TerminationByNumber;
+        return false;
+    }
+
+    bool ok;
+    QByteArray::fromRawData(start, json - start).toDouble(&ok);
+    if (!ok) {
+        lastError = QJsonParseError::IllegalNumber;
+        return false;
+    }
+    return true;
+}
+
+bool Validator::validateString()
+{
+    while (json < end) {
+        const char c = *json;
+        if (c == '"')
+            break;
+        if (c == '\\') {
+            if (++json >= end) {
+                lastError = QJsonParseError::UnterminatedString;
+                return false;
+            }
+            if (*json++ == 'u') {
+                if (json > end - 4) {
+                    lastError = QJsonParseError::IllegalEscapeSequence;
+                    return false;
+                }
+                for (int i = 0; i < 4; ++i, ++json) {
+                    if (!isxdigit(uchar(*json))) {
+                        lastError = QJsonParseError::IllegalEscapeSequence;
+                        return false;
+                    }
+                }
+            }
+        } else if (uchar(c) < 0x80) {
+            ++json;
+        } else {
+            const auto *usrc = reinterpret_cast<const uchar *>(json) + 1;
+            const auto *uend = reinterpret_cast<const uchar *>(end);
+            uint ch;
+            uint *dst = &ch;
+            if (QUtf8Functions::fromUtf8<QUtf8BaseTraits>(uchar(c), dst, usrc, uend) < 0) {
+                lastError = QJsonParseError::IllegalUTF8String;
+                return false;
+            }
+            json = reinterpret_cast<const char *>(usrc);
+        }
+    }
+
+    ++json;
+    if (json >= end) {
+        lastError = QJsonParseError::UnterminatedString;
+        return false;
+    }
+    return true;
+}
+
+// The following work on documents that passed the Validator
+
+static const char *skipString(const char *ptr)
+{
+    // ptr is just past the opening quote
+    while (*ptr != '"') {
+        if (*ptr == '\\')
+            ++ptr;
+        ++ptr;
+    }
+    return ptr + 1;
+}
+
+static const char *skipValue(const char *ptr)
+{
+    switch (*ptr) {
+    case '"':
+        return skipString(ptr + 1);
+    case '[':
+    case '{': {
+        int depth = 0;
+        do {
+            switch (*ptr++) {
+            case '"':
+                ptr = skipString(ptr);
+                break;
+            case '[':
+            case '{':
+                ++depth;
+                break;
+            case ']':
+            case '}':
+                --depth;
+                break;
+            }
+        } while (depth);
+        return ptr;
+    }
+    }
+    while (!isJsonSpace(*ptr) && *ptr != ',' && *ptr != ']' && *ptr != '}')
+        ++ptr;
+    return ptr;
+}
+
+static QString decodeString(const char *begin, const char *end)
+{
+    QString result;
+    result.reserve(end - begin);
+    while (begin < end) {
+        const char *escape = static_cast<const char *>(memchr(begin, '\\', end - begin));
+        if (!escape)
+            escape = end;
+        result += QString::fromUtf8(begin, escape - begin);
+        if (escape == end)
+            break;
+
+        const char c = escape[1];
+        begin = escape + 2;
+        switch (c) {
+        case 'b': result += QChar(0x8); break;
+        case 'f': result += QChar(0xc); break;
+        case 'n': result += QChar(0xa); break;
+        case 'r': result += QChar(0xd); break;
+        case 't': result += QChar(0x9); break;
+        case 'u':
+            result += QChar(ushort(QByteArray::fromRawData(begin, 4).toUShort(nullptr, 16)));
+            begin += 4;
+            break;
+        default:
+            // like the parser, accept any other escaped character as itself
+            result += QLatin1Char(c);
+            break;
+        }
+    }
+    return result;
+}
+
+} // unnamed namespace
+
+class QJsonViewPrivate : public QSharedData
+{
+public:
+    struct Entry
+    {
+        qsizetype keyBegin;
+        qsizetype keyEnd;
+        qsizetype valueBegin;
+        qsizetype valueEnd;
+        bool keyHasEscapes;
+    };
+
+    explicit QJsonViewPrivate(const QByteArray &json) : json(json) { }
+
+    QList<Entry> entries(qsizetype container);
+
+    QByteArrayView span(qsizetype begin, qsizetype end) const
+    { return QByteArrayView(json.constData() + begin, end - begin); }
+
+    const QByteArray json;
+
+private:
+    QMutex mutex;
+    QHash<qsizetype, QList<Entry>> index;
+};
+
+/*
+    Returns the members of the object, or the elements of the array, starting
+    at offset \a container, locating them on first use.
+*/
+QList<QJsonViewPrivate::Entry> QJsonViewPrivate::entries(qsizetype container)
+{
+    QMutexLocker locker(&mutex);
+    auto it = index.constFind(container);
+    if (it != index.cend())
+        return *it;
+    locker.unlock();
+
+    QList<Entry> list;
+    const char *const head = json.constData();
+    const bool isObject = head[container] == '{';
+    const char *ptr = skipSpace(head + container + 1, head + json.size());
+    if (*ptr != '}' && *ptr != ']') {
+        while (true) {
+            Entry entry = {};
+            if (isObject) {
+                entry.keyBegin = ptr + 1 - head;
+                ptr = skipString(ptr + 1);
+                entry.keyEnd = ptr - 1 - head;
+                entry.keyHasEscapes = memchr(head + entry.keyBegin, '\\',
+                                             entry.keyEnd - entry.keyBegin) != nullptr;
+                ptr = skipSpace(ptr, head + json.size()) + 1;   // the colon
+                ptr = skipSpace(ptr, head + json.size());
+            }
+            entry.valueBegin = ptr - head;
+            ptr = skipValue(ptr);
+            entry.valueEnd = ptr - head;
+            list.append(entry);
+
+            ptr = skipSpace(ptr, head + json.size());
+            if (*ptr != ',')
+                break;
+            ptr = skipSpace(ptr + 1, head + json.size());
+        }
+    }
+
+    locker.relock();
+    index.insert(container, list);
+    return list;
+}
+
+/*!
+    Constructs an undefined view.
+
+    \sa isUndefined()
+*/
+QJsonView::QJsonView() noexcept = default;
+
+/*!
+    Destroys the view.
+*/
+QJsonView::~QJsonView() = default;
+
+/*!
+    Creates a copy of \a other; both refer to the same value of the same
+    document.
+*/
+QJsonView::QJsonView(const QJsonView &other) noexcept = default;
+
+/*!
+    Makes this view refer to the value \a other refers to.
+*/
+QJsonView &QJsonView::operator=(const QJsonView &other) noexcept = default;
+
+/*!
+    Move-constructs a view from \a other.
+*/
+QJsonView::QJsonView(QJsonView &&other) noexcept = default;
+
+/*!
+    \fn QJsonView &QJsonView::operator=(QJsonView &&other)
+
+    Move-assigns \a other to this view.
+*/
+
+/*!
+    \fn void QJsonView::swap(QJsonView &other)
+
+    Swaps the view \a other with this view. This operation is very fast and
+    never fails.
+*/
+
+/*!
+    \internal
+*/
+QJsonView::QJsonView(QJsonViewPrivate *data, qsizetype begin, qsizetype end)
+    : d(data), b(begin), e(end)
+{
+}
+
+/*!
+    Validates \a json as a UTF-8 encoded JSON document and returns a view of
+    its top-level object or array. The view keeps a reference to \a json;
+    nothing of it is converted yet.
+
+    \a json is held to the same rules as by QJsonDocument::fromJson(). If it
+    is not a valid document, an undefined view is returned, and the error is
+    reported in \a error if that is not \nullptr.
+
+    \sa QJsonDocument::fromJson(), isUndefined()
+*/
+QJsonView QJsonView::fromJson(const QByteArray &json, QJsonParseError *error)
+{
+    qsizetype begin, end;
+    Validator validator(json.constData(), json.size());
+    if (!validator.validate(error, &begin, &end))
+        return QJsonView();
+    return QJsonView(new QJsonViewPrivate(json), begin, end);
+}
+
+/*!
+    Returns the type of the value this view refers to, or
+    QJsonValue::Undefined for a default-constructed view or the result of a
+    failed lookup.
+
+    \sa isNull(), isBool(), isDouble(), isString(), isArray(), isObject(),
+        isUndefined()
+*/
+QJsonValue::Type QJsonView::type() const
+{
+    if (!d)
+        return QJsonValue::Undefined;
+    switch (d->json.at(b)) {
+    case '"':
+        return QJsonValue::String;
+    case '[':
+        return QJsonValue::Array;
+    case '{':
+        return QJsonValue::Object;
+    case 't':
+    case 'f':
+        return QJsonValue::Bool;
+    case 'n':
+        return QJsonValue::Null;
+    }
+    return QJsonValue::Double;
+}
+
+/*!
+    \fn bool QJsonView::isNull() const
+
+    Returns \c true if the view refers to a null value.
+*/
+
+/*!
+    \fn bool QJsonView::isBool() const
+
+    Returns \c true if the view refers to a boolean value.
+*/
+
+/*!
+    \fn bool QJsonView::isDouble() const
+
+    Returns \c true if the view refers to a number.
+*/
+
+/*!
+    \fn bool QJsonView::isString() const
+
+    Returns \c true if the view refers to a string.
+*/
+
+/*!
+    \fn bool QJsonView::isArray() const
+
+    Returns \c true if the view refers to an array.
+*/
+
+/*!
+    \fn bool QJsonView::isObject() const
+
+    Returns \c true if the view refers to an object.
+*/
+
+/*!
+    \fn bool QJsonView::isUndefined() const
+
+    Returns \c true if the view does not refer to any value, for instance
+    because it is the result of looking up a key that does not exist.
+*/
+
+/*!
+    Returns the boolean this view refers to, or \a defaultValue if it refers
+    to something else.
+*/
+bool QJsonView::toBool(bool defaultValue) const
+{
+    if (!isBool())
+        return defaultValue;
+    return d->json.at(b) == 't';
+}
+
+/*!
+    Returns the number this view refers to converted to \c int, or
+    \a defaultValue if it refers to something else or the number is not an
+    integer in the range of \c int.
+
+    \sa QJsonValue::toInt()
+*/
+int QJsonView::toInt(int defaultValue) const
+{
+    return isDouble() ? toValue().toInt(defaultValue) : defaultValue;
+}
+
+/*!
+    Returns the number this view refers to converted to \c qint64, or
+    \a defaultValue if it refers to something else or the number is not an
+    integer in the range of \c qint64.
+
+    \sa QJsonValue::toInteger()
+*/
+qint64 QJsonView::toInteger(qint64 defaultValue) const
+{
+    return isDouble() ? toValue().toInteger(defaultValue) : defaultValue;
+}
+
+/*!
+    Returns the number this view refers to, or \a defaultValue if it refers to
+    something else.
+*/
+double QJsonView::toDouble(double defaultValue) const
+{
+    if (!isDouble())
+        return defaultValue;
+    return QByteArray::fromRawData(d->json.constData() + b, e - b).toDouble();
+}
+
+/*!
+    Returns the string this view refers to, with all escape sequences
+    resolved, or a null string if it refers to something else.
+
+    \sa toUtf8StringView()
+*/
+QString QJsonView::toString() const
+{
+    if (!isString())
+        return QString();
+    const char *data = d->json.constData();
+    return decodeString(data + b + 1, data + e - 1);
+}
+
+/*!
+    Returns the contents of the string this view refers to as UTF-8, pointing
+    into the source document, so no conversion or allocation takes place.
+
+    Returns a null view if this view does not refer to a string, or if the
+    string contains escape sequences, which toString() has to resolve.
+
+    \sa toString()
+*/
+QByteArrayView QJsonView::toUtf8StringView() const
+{
+    if (!isString())
+        return QByteArrayView();
+    const QByteArrayView contents = d->span(b + 1, e - 1);
+    if (memchr(contents.data(), '\\', contents.size()))
+        return QByteArrayView();
+    return contents;
+}
+
+/*!
+    Returns the number of elements of the array, or the number of members of
+    the object, this view refers to; or 0 if it refers to something else.
+*/
+qsizetype QJsonView::size() const
+{
+    if (!isArray() && !isObject())
+        return 0;
+    return d->entries(b).size();
+}
+
+/*!
+    Returns a view of element \a i of the array this view refers to, or of the
+    value of its member \a i if it refers to an object. Returns an undefined
+    view if \a i is out of range or this view refers to something else.
+*/
+QJsonView QJsonView::at(qsizetype i) const
+{
+    if (!isArray() && !isObject())
+        return QJsonView();
+    const QList<QJsonViewPrivate::Entry> entries = d->entries(b);
+    if (i < 0 || i >= entries.size())
+        return QJsonView();
+    return QJsonView(d.data(), entries.at(i).valueBegin, entries.at(i).valueEnd);
+}
+
+/*!
+    \fn QJsonView QJsonView::operator[](qsizetype i) const
+
+    Same as at(\a i).
+*/
+
+/*!
+    Returns the keys of the object this view refers to, in the order they
+    appear in the document, or an empty list if it refers to something else.
+*/
+QStringList QJsonView::keys() const
+{
+    QStringList keys;
+    if (!isObject())
+        return keys;
+    const QList<QJsonViewPrivate::Entry> entries = d->entries(b);
+    const char *data = d->json.constData();
+    keys.reserve(entries.size());
+    for (const QJsonViewPrivate::Entry &entry : entries)
+        keys.append(decodeString(data + entry.keyBegin, data + entry.keyEnd));
+    return keys;
+}
+
+QJsonView QJsonView::valueImpl(QByteArrayView utf8Key) const
+{
+    if (!isObject())
+        return QJsonView();
+    const QList<QJsonViewPrivate::Entry> entries = d->entries(b);
+    QString decodedKey;
+    // The last of duplicate keys wins, as in QJsonDocument
+    for (auto it = entries.crbegin(); it != entries.crend(); ++it) {
+        const QByteArrayView key = d->span(it->keyBegin, it->keyEnd);
+        if (it->keyHasEscapes) {
+            if (decodedKey.isNull())
+                decodedKey = QString::fromUtf8(utf8Key.data(), utf8Key.size());
+            if (decodeString(key.data(), key.data() + key.size()) != decodedKey)
+                continue;
+        } else if (key.size() != utf8Key.size()
+                   || memcmp(key.data(), utf8Key.data(), key.size()) != 0) {
+            continue;
+        }
+        return QJsonView(d.data(), it->valueBegin, it->valueEnd);
+    }
+    return QJsonView();
+}
+
+#if QT_STRINGVIEW_LEVEL < 2
+/*!
+    Returns a view of the value of the member \a key of the object this view
+    refers to. Returns an undefined view if there is no such member or this
+    view refers to something else.
+
+    Only the members of the object are located; none of their values is
+    converted.
+*/
+QJsonView QJsonView::value(const QString &key) const
+{
+    return value(QStringView(key));
+}
+
+/*!
+    \fn QJsonView QJsonView::operator[](const QString &key) const
+
+    Same as value(\a key).
+*/
+
+/*!
+    Returns \c true if the object this view refers to has a member \a key.
+*/
+bool QJsonView::contains(const QString &key) const
+{
+    return contains(QStringView(key));
+}
+#endif
+
+/*!
+    \overload
+*/
+QJsonView QJsonView::value(QStringView key) const
+{
+    return valueImpl(key.toUtf8());
+}
+
+/*!
+    \overload
+*/
+QJsonView QJsonView::value(QLatin1String key) const
+{
+    const auto isAscii = [](char c) { return uchar(c) < 0x80; };
+    if (std::all_of(key.begin(), key.end(), isAscii))
+        return valueImpl(QByteArrayView(key.data(), key.size()));
+    return valueImpl(QString(key).toUtf8());
+}
+
+/*!
+    \fn QJsonView QJsonView::operator[](QStringView key) const
+    \overload
+*/
+
+/*!
+    \fn QJsonView QJsonView::operator[](QLatin1String key) const
+    \overload
+*/
+
+/*!
+    \overload
+*/
+bool QJsonView::contains(QStringView key) const
+{
+    return !value(key).isUndefined();
+}
+
+/*!
+    \overload
+*/
+bool QJsonView::contains(QLatin1String key) const
+{
+    return !value(key).isUndefined();
+}
+
+/*!
+    Converts the value this view refers to, including all its contents, into
+    a QJsonValue.
+*/
+QJsonValue QJsonView::toValue() const
+{
+    switch (type()) {
+    case QJsonValue::Undefined:
+        return QJsonValue(QJsonValue::Undefined);
+    case QJsonValue::Null:
+        return QJsonValue(QJsonValue::Null);
+    case QJsonValue::Bool:
+        return QJsonValue(toBool());
+    case QJsonValue::String:
+        return QJsonValue(toString());
+    case QJsonValue::Array:
+    case QJsonValue::Object: {
+        const QJsonDocument doc =
+                QJsonDocument::fromJson(QByteArray::fromRawData(d->json.constData() + b, e - b));
+        return doc.isArray() ? QJsonValue(doc.array()) : QJsonValue(doc.object());
+    }
+    case QJsonValue::Double:
+        break;
+    }
+
+    // Same conversion as in the parser
+    const QByteArray number = QByteArray::fromRawData(d->json.constData() + b, e - b);
+    if (!number.contains('e') && !number.contains('E')) {
+        const qsizetype point = number.indexOf('.');
+        const bool isInt = point < 0
+                || std::all_of(number.begin() + point + 1, number.end(),
+                               [](char c) { return c == '0'; });
+        bool ok;
+        const qlonglong n = number.toLongLong(&ok);
+        if (isInt && ok)
+            return QJsonValue(qint64(n));
+    }
+    const double value = number.toDouble();
+    qint64 n;
+    if (convertDoubleTo(value, &n))
+        return QJsonValue(n);
+    return QJsonValue(value);
+}
+
+/*!
+    Returns the JSON text of the value this view refers to, as it appears in
+    the source document, or a null view for an undefined view.
+*/
+QByteArrayView QJsonView::rawJson() const
+{
+    return d ? d->span(b, e) : QByteArrayView();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QJSONVIEW_H
+#define QJSONVIEW_H
+
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QJsonViewPrivate;
+
+class Q_CORE_EXPORT QJsonView
+{
+public:
+    QJsonView() noexcept;
+    ~QJsonView();
+
+    QJsonView(const QJsonView &other) noexcept;
+    QJsonView &operator=(const QJsonView &other) noexcept;
+    QJsonView(QJsonView &&other) noexcept;
+    QJsonView &operator=(QJsonView &&other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    void swap(QJsonView &other) noexcept
+    {
+        qSwap(d, other.d);
+        qSwap(b, other.b);
+        qSwap(e, other.e);
+    }
+
+    static QJsonView fromJson(const QByteArray &json, QJsonParseError *error = nullptr);
+
+    QJsonValue::Type type() const;
+    inline bool isNull() const { return type() == QJsonValue::Null; }
+    inline bool isBool() const { return type() == QJsonValue::Bool; }
+    inline bool isDouble() const { return type() == QJsonValue::Double; }
+    inline bool isString() const { return type() == QJsonValue::String; }
+    inline bool isArray() const { return type() == QJsonValue::Array; }
+    inline bool isObject() const { return type() == QJsonValue::Object; }
+    inline bool isUndefined() const { return type() == QJsonValue::Undefined; }
+
+    bool toBool(bool defaultValue = false) const;
+    int toInt(int defaultValue = 0) const;
+    qint64 toInteger(qint64 defaultValue = 0) const;
+    double toDouble(double defaultValue = 0) const;
+    QString toString() const;
+    QByteArrayView toUtf8StringView() const;
+
+    qsizetype size() const;
+    QJsonView at(qsizetype i) const;
+    inline QJsonView operator[](qsizetype i) const { return at(i); }
+
+    QStringList keys() const;
+#if QT_STRINGVIEW_LEVEL < 2
+    QJsonView value(const QString &key) const;
+    QJsonView operator[](const QString &key) const { return value(key); }
+    bool contains(const QString &key) const;
+#endif
+    QJsonView value(QStringView key) const;
+    QJsonView value(QLatin1String key) const;
+    QJsonView operator[](QStringView key) const { return value(key); }
+    QJsonView operator[](QLatin1String key) const { return value(key); }
+    bool contains(QStringView key) const;
+    bool contains(QLatin1String key) const;
+
+    QJsonValue toValue() const;
+    QByteArrayView rawJson() const;
+
+private:
+    QJsonView(QJsonViewPrivate *data, qsizetype begin, qsizetype end);
+    QJsonView valueImpl(QByteArrayView utf8Key) const;
+
+    QExplicitlySharedDataPointer<QJsonViewPrivate> d;
+    qsizetype b = 0;
+    qsizetype e = 0;
+};
+
+Q_DECLARE_SHARED(QJsonView)
+
+QT_END_NAMESPACE
+
+#endif // QJSONVIEW_H
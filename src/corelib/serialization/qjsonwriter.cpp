@@ -58,15 +58,16 @@ static inline uchar hexdig(uint u)
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(const QString &s)
+static void appendEscapedString(QByteArray &ba, QStringView s)
 {
     // give it a minimum size to ensure the resize() below always adds enough space
-    QByteArray ba(qMax(s.length(), 16), Qt::Uninitialized);
+    const qsizetype start = ba.size();
+    ba.resize(start + qMax(s.length(), qsizetype(16)));
 
-    uchar *cursor = reinterpret_cast<uchar *>(const_cast<char *>(ba.constData()));
-    const uchar *ba_end = cursor + ba.length();
-    const ushort *src = reinterpret_cast<const ushort *>(s.constBegin());
-    const ushort *const end = reinterpret_cast<const ushort *>(s.constEnd());
+    uchar *cursor = reinterpret_cast<uchar *>(ba.data()) + start;
+    const uchar *ba_end = reinterpret_cast<const uchar *>(ba.constData()) + ba.length();
+    const ushort *src = reinterpret_cast<const ushort *>(s.utf16());
+    const ushort *const end = src + s.size();
 
     while (src != end) {
         if (cursor >= ba_end - 6) {
@@ -125,10 +126,9 @@ static QByteArray escapedString(const QString &s)
     }
 
     ba.resize(cursor - (const uchar *)ba.constData());
-    return ba;
 }
 
-static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
+void Writer::valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
 {
     QCborValue::Type type = v.type();
     switch (type) {
@@ -151,7 +151,7 @@ static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool
     }
     case QCborValue::String:
         json += '"';
-        json += escapedString(v.toString());
+        appendEscapedString(json, v.toString());
         json += '"';
         break;
     case QCborValue::Array:
@@ -184,7 +184,7 @@ static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json,
     qsizetype i = 0;
     while (true) {
         json += indentString;
-        valueToJson(a->valueAt(i), json, indent, compact);
+        Writer::valueToJson(a->valueAt(i), json, indent, compact);
 
         if (++i == a->elements.size()) {
             if (!compact)
@@ -209,9 +209,9 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
         QCborValue e = o->valueAt(i);
         json += indentString;
         json += '"';
-        json += escapedString(o->valueAt(i).toString());
+        appendEscapedString(json, o->valueAt(i).toString());
         json += compact ? "\":" : "\": ";
-        valueToJson(o->valueAt(i + 1), json, indent, compact);
+        Writer::valueToJson(o->valueAt(i + 1), json, indent, compact);
 
         if ((i += 2) == o->elements.size()) {
             if (!compact)
@@ -223,6 +223,13 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
     }
 }
 
+void Writer::stringToJson(QStringView s, QByteArray &json)
+{
+    json += '"';
+    appendEscapedString(json, s);
+    json += '"';
+}
+
 void Writer::objectToJson(const QCborContainerPrivate *o, QByteArray &json, int indent, bool compact)
 {
     json.reserve(json.size() + (o ? (int)o->elements.size() : 16));
@@ -68,6 +68,7 @@ public: \
 private:
 #endif
 #include <private/qmemory_p.h>
+#include <private/qsimd_p.h>
 
 #include <iterator>
 #include "qxmlstream_p.h"
@@ -926,6 +927,82 @@ inline uint QXmlStreamReaderPrivate::filterCarriageReturn()
     return '\n';
 }
 
+/*!
+ \internal
+ Returns the length of the run at the start of [\a ptr, \a end) of
+ characters that need no special treatment by the fastScan functions: that
+ is, characters from U+0020 (space) up to U+FFFD that are none of \a stop1
+ to \a stop4.
+ */
+static qsizetype plainTextRun(const QChar *ptr, const QChar *end,
+                              char16_t stop1, char16_t stop2, char16_t stop3, char16_t stop4)
+{
+    const QChar *begin = ptr;
+#ifdef __SSE2__
+    // compare as signed after flipping the top bit, for unsigned comparisons
+    const __m128i signFlip = _mm_set1_epi16(short(0x8000));
+    const __m128i belowSpace = _mm_set1_epi16(short(0x20 ^ 0x8000));
+    const __m128i aboveFFFD = _mm_set1_epi16(short(0xfffd ^ 0x8000));
+    const __m128i s1 = _mm_set1_epi16(short(stop1));
+    const __m128i s2 = _mm_set1_epi16(short(stop2));
+    const __m128i s3 = _mm_set1_epi16(short(stop3));
+    const __m128i s4 = _mm_set1_epi16(short(stop4));
+    for ( ; end - ptr >= 8; ptr += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        const __m128i flipped = _mm_xor_si128(data, signFlip);
+        __m128i special = _mm_or_si128(_mm_cmplt_epi16(flipped, belowSpace),
+                                       _mm_cmpgt_epi16(flipped, aboveFFFD));
+        special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi16(data, s1),
+                                                     _mm_cmpeq_epi16(data, s2)));
+        special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi16(data, s3),
+                                                     _mm_cmpeq_epi16(data, s4)));
+        if (const uint mask = _mm_movemask_epi8(special))
+            return ptr - begin + qCountTrailingZeroBits(mask) / 2;
+    }
+#endif
+    for ( ; ptr != end; ++ptr) {
+        const char16_t c = ptr->unicode();
+        if (c < 0x20 || c > 0xfffd || c == stop1 || c == stop2 || c == stop3 || c == stop4)
+            break;
+    }
+    return ptr - begin;
+}
+
+/*!
+ \internal
+ Returns the length of the run of spaces and tabs at the start of
+ [\a ptr, \a end).
+ */
+static qsizetype blankRun(const QChar *ptr, const QChar *end)
+{
+    const QChar *begin = ptr;
+#ifdef __SSE2__
+    const __m128i space = _mm_set1_epi16(' ');
+    const __m128i tab = _mm_set1_epi16('\t');
+    for ( ; end - ptr >= 8; ptr += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        const __m128i blank = _mm_or_si128(_mm_cmpeq_epi16(data, space), _mm_cmpeq_epi16(data, tab));
+        if (const uint mask = ~uint(_mm_movemask_epi8(blank)) & 0xffff)
+            return ptr - begin + qCountTrailingZeroBits(mask) / 2;
+    }
+#endif
+    while (ptr != end && (*ptr == QLatin1Char(' ') || *ptr == QLatin1Char('\t')))
+        ++ptr;
+    return ptr - begin;
+}
+
+/*!
+ \internal
+ Appends the next \a len characters of the read buffer to the text buffer
+ and consumes them. Only valid while the put-back stack is empty.
+ */
+inline void QXmlStreamReaderPrivate::takeFromReadBuffer(qsizetype len)
+{
+    Q_ASSERT(putStack.isEmpty());
+    textBuffer.append(readBuffer.constData() + readBufferPos, len);
+    readBufferPos += len;
+}
+
 /*!
  \internal
  If the end of the file is encountered, ~0 is returned.
@@ -1154,7 +1231,18 @@ inline int QXmlStreamReaderPrivate::fastScanLiteralContent()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    forever {
+        if (putStack.isEmpty()) {
+            const QChar *ptr = readBuffer.constData() + readBufferPos;
+            const QChar *end = readBuffer.constData() + readBuffer.size();
+            const qsizetype run = plainTextRun(ptr, end, '&', '<', '\"', '\'');
+            if (run) {
+                takeFromReadBuffer(run);
+                n += int(run);
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -1204,7 +1292,18 @@ inline int QXmlStreamReaderPrivate::fastScanSpace()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    forever {
+        if (putStack.isEmpty()) {
+            const QChar *ptr = readBuffer.constData() + readBufferPos;
+            const QChar *end = readBuffer.constData() + readBuffer.size();
+            const qsizetype run = blankRun(ptr, end);
+            if (run) {
+                takeFromReadBuffer(run);
+                n += int(run);
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (c) {
         case '\r':
             if ((c = filterCarriageReturn()) == 0)
@@ -1237,7 +1336,20 @@ inline int QXmlStreamReaderPrivate::fastScanContentCharList()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    forever {
+        if (putStack.isEmpty()) {
+            const QChar *ptr = readBuffer.constData() + readBufferPos;
+            const QChar *end = readBuffer.constData() + readBuffer.size();
+            const qsizetype run = plainTextRun(ptr, end, '&', '<', ']', '<');
+            if (run) {
+                if (isWhitespace)
+                    isWhitespace = blankRun(ptr, ptr + run) == run;
+                takeFromReadBuffer(run);
+                n += int(run);
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
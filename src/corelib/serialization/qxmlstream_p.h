@@ -471,6 +471,7 @@ public:
 
     // scan optimization functions. Not strictly necessary but LALR is
     // not very well suited for scanning fast
+    inline void takeFromReadBuffer(qsizetype len);
     int fastScanLiteralContent();
     int fastScanSpace();
     int fastScanContentCharList();
@@ -15,8 +15,10 @@ HEADERS += \
     serialization/qjsonobject.h \
     serialization/qjsonvalue.h \
     serialization/qjsonarray.h \
+    serialization/qjsonview.h \
     serialization/qjsonwriter_p.h \
     serialization/qjsonparser_p.h \
+    serialization/qjsonstreamwriter.h \
     serialization/qtextstream.h \
     serialization/qtextstream_p.h \
     serialization/qxmlstream.h \
@@ -35,8 +37,10 @@ SOURCES += \
     serialization/qjsonobject.cpp \
     serialization/qjsonarray.cpp \
     serialization/qjsonvalue.cpp \
+    serialization/qjsonview.cpp \
     serialization/qjsonwriter.cpp \
     serialization/qjsonparser.cpp \
+    serialization/qjsonstreamwriter.cpp \
     serialization/qtextstream.cpp \
     serialization/qxmlstream.cpp \
     serialization/qxmlstreamgrammar.cpp \
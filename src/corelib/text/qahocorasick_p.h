@@ -0,0 +1,272 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QAHOCORASICK_P_H
+#define QAHOCORASICK_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qlist.h>
+
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A deterministic Aho-Corasick automaton over code units of type Char
+    (uchar or char16_t), used by QMultiByteArrayMatcher and QMultiStringMatcher.
+
+    The code units appearing in the patterns are mapped to dense character
+    classes (class 0 stands for "any code unit not in any pattern"), and the
+    transition table has one row of classCount() entries per state, with the
+    failure transitions already folded in. Scanning a haystack is therefore
+    one table lookup per code unit. Every state also knows the (lowest)
+    index of the pattern ending in it, if any, and the nearest state on its
+    failure chain where some other pattern ends, so that all the patterns
+    ending at a given position can be enumerated.
+
+    Empty patterns are ignored.
+*/
+template <typename Char>
+class QAhoCorasickAutomaton
+{
+    static_assert(std::is_same_v<Char, uchar> || std::is_same_v<Char, char16_t>,
+                  "QAhoCorasickAutomaton only supports uchar and char16_t code units");
+
+    static constexpr bool HasPages = sizeof(Char) > 1;
+
+public:
+    struct Pattern {
+        const Char *data;
+        qsizetype size;
+    };
+
+    QAhoCorasickAutomaton() = default;
+
+    explicit QAhoCorasickAutomaton(const QList<Pattern> &patterns)
+    {
+        build(patterns);
+    }
+
+    bool isEmpty() const noexcept { return m_maximumLength == 0; }
+    qsizetype maximumPatternLength() const noexcept { return m_maximumLength; }
+
+    static constexpr int initialState() noexcept { return 0; }
+
+    int nextState(int state, Char c) const noexcept
+    {
+        return m_transitions.constData()[qsizetype(state) * m_classCount + classOf(c)];
+    }
+
+    // Calls f(patternIndex, patternLength) for every pattern ending in state
+    template <typename F>
+    void forEachMatch(int state, F f) const
+    {
+        if (m_output.at(state) < 0)
+            state = m_dictionaryLink.at(state);
+        while (state > 0) {
+            f(qsizetype(m_output.at(state)), qsizetype(m_depth.at(state)));
+            state = m_dictionaryLink.at(state);
+        }
+    }
+
+    struct Hit {
+        qsizetype position;
+        qsizetype length;
+        qsizetype patternIndex;
+    };
+
+    // Returns the leftmost hit in [haystack + from, haystack + length), the
+    // one with the lowest pattern index if several patterns start there.
+    // fold(const Char *) returns the code unit to feed to the automaton.
+    template <typename Fold>
+    Hit findFirst(const Char *haystack, qsizetype length, qsizetype from, Fold fold) const
+    {
+        Hit best = { -1, 0, -1 };
+        int state = initialState();
+        for (qsizetype i = from; i < length; ++i) {
+            // any hit ending from here on starts after the best one so far
+            if (best.position >= 0 && i + 1 - m_maximumLength > best.position)
+                break;
+            state = nextState(state, fold(haystack + i));
+            forEachMatch(state, [&](qsizetype patternIndex, qsizetype patternLength) {
+                const qsizetype start = i + 1 - patternLength;
+                if (best.position < 0 || start < best.position
+                        || (start == best.position && patternIndex < best.patternIndex)) {
+                    best = { start, patternLength, patternIndex };
+                }
+            });
+        }
+        return best;
+    }
+
+    // Calls f(Hit) for every (possibly overlapping) hit, in the order in
+    // which they end; hits ending at the same position come longest first.
+    template <typename Fold, typename F>
+    void findAll(const Char *haystack, qsizetype length, qsizetype from, Fold fold, F f) const
+    {
+        int state = initialState();
+        for (qsizetype i = from; i < length; ++i) {
+            state = nextState(state, fold(haystack + i));
+            forEachMatch(state, [&](qsizetype patternIndex, qsizetype patternLength) {
+                f(Hit{ i + 1 - patternLength, patternLength, patternIndex });
+            });
+        }
+    }
+
+private:
+    int classOf(Char c) const noexcept
+    {
+        if constexpr (HasPages)
+            return m_classes.constData()[m_pages.constData()[c >> 8] * 256 + (c & 0xff)];
+        else
+            return m_classes.constData()[c];
+    }
+
+    void build(const QList<Pattern> &patterns)
+    {
+        // Character classes. Page 0 of m_classes is all zeroes when HasPages
+        // (it is shared by all the pages of code units not in any pattern),
+        // and the only page otherwise.
+        m_classes.fill(0, 256);
+        if constexpr (HasPages) {
+            m_pages.fill(0, 256);
+            m_classes.resize(512, 0);
+            m_pages[0] = 1;
+        }
+        m_classCount = 1;
+        const auto classSlot = [this](Char c) -> int & {
+            if constexpr (HasPages) {
+                if (!m_pages.at(c >> 8)) {
+                    m_pages[c >> 8] = int(m_classes.size() / 256);
+                    m_classes.resize(m_classes.size() + 256, 0);
+                }
+                return m_classes[m_pages.at(c >> 8) * 256 + (c & 0xff)];
+            } else {
+                return m_classes[c];
+            }
+        };
+        for (const Pattern &pattern : patterns) {
+            for (qsizetype i = 0; i < pattern.size; ++i) {
+                int &cls = classSlot(pattern.data[i]);
+                if (!cls)
+                    cls = m_classCount++;
+            }
+        }
+
+        // The trie; -1 marks a missing edge until the failure links are computed
+        const qsizetype stride = m_classCount;
+        m_transitions.fill(-1, stride);
+        m_output.fill(-1, 1);
+        m_depth.fill(0, 1);
+        m_maximumLength = 0;
+        for (qsizetype p = 0; p < patterns.size(); ++p) {
+            const Pattern &pattern = patterns.at(p);
+            if (!pattern.size)
+                continue;
+            int state = 0;
+            for (qsizetype i = 0; i < pattern.size; ++i) {
+                const qsizetype slot = state * stride + classOf(pattern.data[i]);
+                int next = m_transitions.at(slot);
+                if (next < 0) {
+                    next = int(m_output.size());
+                    m_transitions[slot] = next;
+                    m_transitions.resize(m_transitions.size() + stride, -1);
+                    m_output.append(-1);
+                    m_depth.append(int(i + 1));
+                }
+                state = next;
+            }
+            if (m_output.at(state) < 0)
+                m_output[state] = int(p);
+            m_maximumLength = qMax(m_maximumLength, pattern.size);
+        }
+
+        // Breadth-first: fill in the failure transitions and the dictionary
+        // links. When a state gets processed, all the states closer to the
+        // root (and so its failure state) have already been completed.
+        const qsizetype stateCount = m_output.size();
+        QList<int> failure(stateCount, 0);
+        m_dictionaryLink.fill(0, stateCount);
+        QList<int> queue;
+        queue.reserve(stateCount);
+        queue.append(0);
+        int *transitions = m_transitions.data();
+        for (qsizetype head = 0; head < queue.size(); ++head) {
+            const int state = queue.at(head);
+            const int *failureRow = transitions + failure.at(state) * stride;
+            int *row = transitions + state * stride;
+            for (qsizetype cls = 0; cls < stride; ++cls) {
+                const int next = row[cls];
+                if (next < 0) {
+                    row[cls] = state ? failureRow[cls] : 0;
+                    continue;
+                }
+                const int nextFailure = state ? failureRow[cls] : 0;
+                failure[next] = nextFailure;
+                m_dictionaryLink[next] = m_output.at(nextFailure) >= 0
+                        ? nextFailure : m_dictionaryLink.at(nextFailure);
+                queue.append(next);
+            }
+        }
+    }
+
+    QList<int> m_transitions;
+    QList<int> m_classes;
+    QList<int> m_pages;
+    QList<int> m_output;
+    QList<int> m_dictionaryLink;
+    QList<int> m_depth;
+    qsizetype m_classCount = 0;
+    qsizetype m_maximumLength = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QAHOCORASICK_P_H
@@ -50,6 +50,7 @@
 #include "private/qsimd_p.h"
 #include "qstringalgorithms_p.h"
 #include "qscopedpointer.h"
+#include "qscopeguard.h"
 #include "qbytearray_p.h"
 #include <qdatastream.h>
 #include <qmath.h>
@@ -422,49 +423,28 @@ int QtPrivate::compareMemory(QByteArrayView lhs, QByteArrayView rhs)
     return lhs.size() == rhs.size() ? 0 : lhs.size() > rhs.size() ? 1 : -1;
 }
 
-// the CRC table below is created by the following piece of code
-#if 0
-static void createCRC16Table()                        // build CRC16 lookup table
-{
-    unsigned int i;
-    unsigned int j;
-    unsigned short crc_tbl[16];
-    unsigned int v0, v1, v2, v3;
-    for (i = 0; i < 16; i++) {
-        v0 = i & 1;
-        v1 = (i >> 1) & 1;
-        v2 = (i >> 2) & 1;
-        v3 = (i >> 3) & 1;
-        j = 0;
-#undef SET_BIT
-#define SET_BIT(x, b, v) (x) |= (v) << (b)
-        SET_BIT(j,  0, v0);
-        SET_BIT(j,  7, v0);
-        SET_BIT(j, 12, v0);
-        SET_BIT(j,  1, v1);
-        SET_BIT(j,  8, v1);
-        SET_BIT(j, 13, v1);
-        SET_BIT(j,  2, v2);
-        SET_BIT(j,  9, v2);
-        SET_BIT(j, 14, v2);
-        SET_BIT(j,  3, v3);
-        SET_BIT(j, 10, v3);
-        SET_BIT(j, 15, v3);
-        crc_tbl[i] = j;
+namespace {
+struct Crc16Table
+{
+    quint16 entries[256];
+};
+}
+
+// CRC-16-CCITT in its bit-reflected form (polynomial 0x8408), one entry per
+// input byte
+static constexpr Crc16Table createCrc16Table()
+{
+    Crc16Table table = {};
+    for (int i = 0; i < 256; ++i) {
+        quint16 crc = quint16(i);
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 1) ? quint16((crc >> 1) ^ 0x8408) : quint16(crc >> 1);
+        table.entries[i] = crc;
     }
-    printf("static const quint16 crc_tbl[16] = {\n");
-    for (int i = 0; i < 16; i +=4)
-        printf("    0x%04x, 0x%04x, 0x%04x, 0x%04x,\n", crc_tbl[i], crc_tbl[i+1], crc_tbl[i+2], crc_tbl[i+3]);
-    printf("};\n");
+    return table;
 }
-#endif
 
-static const quint16 crc_tbl[16] = {
-    0x0000, 0x1081, 0x2102, 0x3183,
-    0x4204, 0x5285, 0x6306, 0x7387,
-    0x8408, 0x9489, 0xa50a, 0xb58b,
-    0xc60c, 0xd68d, 0xe70e, 0xf78f
-};
+static constexpr Crc16Table crc_tbl = createCrc16Table();
 
 /*!
     \relates QByteArray
@@ -476,7 +456,7 @@ static const quint16 crc_tbl[16] = {
     be calculated accorded to the algorithm published in \a standard.
     By default the algorithm published in ISO 3309 (Qt::ChecksumIso3309) is used.
 
-    \note This function is a 16-bit cache conserving (16 entry table)
+    \note This function is a table-driven (256 entry, 512 byte table)
     implementation of the CRC-16-CCITT algorithm.
 */
 quint16 qChecksum(const char *data, uint len, Qt::ChecksumType standard)
@@ -490,14 +470,9 @@ quint16 qChecksum(const char *data, uint len, Qt::ChecksumType standard)
         crc = 0x6363;
         break;
     }
-    uchar c;
     const uchar *p = reinterpret_cast<const uchar *>(data);
-    while (len--) {
-        c = *p++;
-        crc = ((crc >> 4) & 0x0fff) ^ crc_tbl[((crc ^ c) & 15)];
-        c >>= 4;
-        crc = ((crc >> 4) & 0x0fff) ^ crc_tbl[((crc ^ c) & 15)];
-    }
+    while (len--)
+        crc = (crc >> 8) ^ crc_tbl.entries[(crc ^ *p++) & 0xff];
     switch (standard) {
     case Qt::ChecksumIso3309:
         crc = ~crc;
@@ -549,7 +524,7 @@ QByteArray qCompress(const uchar* data, int nbytes, int compressionLevel)
     if (compressionLevel < -1 || compressionLevel > 9)
         compressionLevel = -1;
 
-    ulong len = nbytes + nbytes / 100 + 13;
+    ulong len = ::compressBound(nbytes);
     QByteArray bazip;
     int res;
     do {
@@ -635,42 +610,60 @@ QByteArray qUncompress(const uchar* data, int nbytes)
         return invalidCompressedData();
     }
 
-    QByteArray::DataPointer d(QByteArray::Data::allocate(expectedSize + 1));
+    // deflate cannot compress by more than a factor of 1032, so don't let a
+    // bogus header make us allocate more than the input can possibly expand to
+    len = qMin(len, ulong(nbytes - 4) * 1032);
+
+    QByteArray::DataPointer d(QByteArray::Data::allocate(len + 1));
     if (Q_UNLIKELY(d.data() == nullptr))
         return invalidCompressedData();
 
+    z_stream zs = {};
+    zs.next_in = const_cast<uchar *>(data) + 4;
+    zs.avail_in = uInt(nbytes - 4);
+    if (inflateInit(&zs) != Z_OK) {
+        qWarning("qUncompress: Z_MEM_ERROR: Not enough memory");
+        return QByteArray();
+    }
+    const auto cleanup = qScopeGuard([&zs] { inflateEnd(&zs); });
+
+    // inflate in place, so that a header that is too small only grows the
+    // buffer instead of starting the decompression all over again
     forever {
-        ulong alloc = len;
-        int res = ::uncompress((uchar*)d.data(), &len,
-                               data+4, nbytes-4);
+        zs.next_out = reinterpret_cast<uchar *>(d.data()) + d.size;
+        zs.avail_out = uInt(len - d.size);
+        int res = ::inflate(&zs, Z_NO_FLUSH);
+        d.size = zs.total_out;
 
         switch (res) {
-        case Z_OK: {
-            Q_ASSERT(len <= alloc);
-            Q_UNUSED(alloc);
-            d.data()[len] = '\0';
-            d.size = len;
+        case Z_STREAM_END:
+            Q_ASSERT(ulong(d.size) <= len);
+            d.data()[d.size] = '\0';
             return QByteArray(d);
-        }
-
-        case Z_MEM_ERROR:
-            qWarning("qUncompress: Z_MEM_ERROR: Not enough memory");
-            return QByteArray();
 
+        case Z_OK:
         case Z_BUF_ERROR:
-            len *= 2;
-            if (Q_UNLIKELY(len >= maxPossibleSize)) {
-                // QByteArray does not support that huge size anyway.
-                return invalidCompressedData();
-            } else {
+            if (zs.avail_out == 0) {
+                len *= 2;
+                if (Q_UNLIKELY(len >= maxPossibleSize)) {
+                    // QByteArray does not support that huge size anyway.
+                    return invalidCompressedData();
+                }
                 // grow the block
-                d->reallocate(d->allocatedCapacity()*2, QByteArray::Data::GrowsForward);
+                d->reallocate(len + 1, QByteArray::Data::GrowsForward);
                 if (Q_UNLIKELY(d.data() == nullptr))
                     return invalidCompressedData();
+            } else if (zs.avail_in == 0) {
+                // the stream ended before the end of the compressed data
+                return invalidCompressedData();
             }
             continue;
 
-        case Z_DATA_ERROR:
+        case Z_MEM_ERROR:
+            qWarning("qUncompress: Z_MEM_ERROR: Not enough memory");
+            return QByteArray();
+
+        default:
             qWarning("qUncompress: Z_DATA_ERROR: Input data is corrupted");
             return QByteArray();
         }
@@ -4016,7 +4009,11 @@ QByteArray &QByteArray::setNum(double n, char f, int prec)
             break;
     }
 
-    *this = QLocaleData::c()->doubleToString(n, prec, form, -1, flags).toUtf8();
+    QLocaleData::CharBuff buf;
+    if (QLocaleData::doubleToCLocaleChars(&buf, n, prec, form, -1, flags))
+        *this = QByteArray(buf.constData(), buf.size());
+    else
+        *this = QLocaleData::c()->doubleToString(n, prec, form, -1, flags).toUtf8();
     return *this;
 }
 
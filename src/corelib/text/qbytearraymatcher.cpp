@@ -38,6 +38,9 @@
 ****************************************************************************/
 
 #include "qbytearraymatcher.h"
+#include "qahocorasick_p.h"
+
+#include <algorithm>
 
 #include <limits.h>
 
@@ -322,6 +325,216 @@ qsizetype qFindByteArray(
     return -1;
 }
 
+class QMultiByteArrayMatcherPrivate : public QSharedData
+{
+public:
+    explicit QMultiByteArrayMatcherPrivate(const QList<QByteArray> &patterns)
+        : patterns(patterns),
+          automaton(automatonPatterns(patterns))
+    {
+    }
+
+    static QList<QAhoCorasickAutomaton<uchar>::Pattern>
+    automatonPatterns(const QList<QByteArray> &patterns)
+    {
+        QList<QAhoCorasickAutomaton<uchar>::Pattern> result;
+        result.reserve(patterns.size());
+        for (const QByteArray &pattern : patterns)
+            result.append({ reinterpret_cast<const uchar *>(pattern.constData()), pattern.size() });
+        return result;
+    }
+
+    const QList<QByteArray> patterns;
+    const QAhoCorasickAutomaton<uchar> automaton;
+};
+
+static inline uchar identityFold(const uchar *c) noexcept
+{
+    return *c;
+}
+
+/*!
+    \class QMultiByteArrayMatcher
+    \since 6.0
+    \inmodule QtCore
+    \brief The QMultiByteArrayMatcher class holds a set of byte sequences
+    that can be quickly matched, all at once, in a byte array.
+
+    \ingroup tools
+    \ingroup string-processing
+    \reentrant
+
+    This class is useful when you want to search byte arrays for any of
+    a (possibly large) number of patterns, for instance to find out
+    whether a message contains any keyword from a list. Instead of
+    searching for each pattern in turn, as a list of QByteArrayMatcher
+    objects would, QMultiByteArrayMatcher builds an automaton (following
+    the Aho-Corasick algorithm) out of all the patterns when it is
+    constructed, and then finds the occurrences of all of them in a
+    single pass over the data. The cost of a search therefore depends on
+    the size of the data and on the number of occurrences, but not on the
+    number of patterns.
+
+    Create the QMultiByteArrayMatcher with the list of patterns you want
+    to search for. Then call indexIn() to find the leftmost occurrence of
+    any pattern, or findAll() to find all of them:
+
+    \snippet code/src_corelib_text_qbytearraymatcher.cpp 2
+
+    Empty patterns never match. Building the automaton takes time and
+    memory proportional to the total size of the patterns, so the matcher
+    only offers a benefit if it is reused for many searches. Copies of
+    a QMultiByteArrayMatcher share the automaton.
+
+    \sa QByteArrayMatcher, QMultiStringMatcher
+*/
+
+/*!
+    \class QMultiByteArrayMatcher::Match
+    \inmodule QtCore
+    \brief The Match struct describes an occurrence of a pattern.
+
+    \variable QMultiByteArrayMatcher::Match::position
+    The position of the first byte of the occurrence.
+
+    \variable QMultiByteArrayMatcher::Match::length
+    The length of the occurrence, i.e. of the pattern.
+
+    \variable QMultiByteArrayMatcher::Match::patternIndex
+    The index of the pattern in patterns().
+*/
+
+/*!
+    Constructs a matcher without patterns, that won't match anything.
+    Call setPatterns() to give it patterns to match.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher()
+    = default;
+
+/*!
+    Constructs a matcher that will search for any of the \a patterns.
+
+    Call indexIn() or findAll() to perform a search.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(const QList<QByteArray> &patterns)
+    : d(new QMultiByteArrayMatcherPrivate(patterns))
+{
+}
+
+/*!
+    Constructs a copy of \a other. The two matchers share the automaton.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(const QMultiByteArrayMatcher &other)
+    = default;
+
+/*!
+    Move-constructs a matcher from \a other. \a other is left without patterns.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(QMultiByteArrayMatcher &&other) noexcept
+    = default;
+
+/*!
+    Destroys the matcher.
+*/
+QMultiByteArrayMatcher::~QMultiByteArrayMatcher()
+    = default;
+
+/*!
+    Assigns \a other to this matcher, and returns a reference to this matcher.
+*/
+QMultiByteArrayMatcher &QMultiByteArrayMatcher::operator=(const QMultiByteArrayMatcher &other)
+    = default;
+
+/*!
+    \fn QMultiByteArrayMatcher &QMultiByteArrayMatcher::operator=(QMultiByteArrayMatcher &&other)
+
+    Move-assigns \a other to this matcher, and returns a reference to this matcher.
+*/
+
+/*!
+    \fn void QMultiByteArrayMatcher::swap(QMultiByteArrayMatcher &other)
+
+    Swaps this matcher with \a other. This operation is very fast and never fails.
+*/
+
+/*!
+    Sets the patterns that this matcher will search for to \a patterns,
+    rebuilding the automaton.
+
+    \sa patterns()
+*/
+void QMultiByteArrayMatcher::setPatterns(const QList<QByteArray> &patterns)
+{
+    d = new QMultiByteArrayMatcherPrivate(patterns);
+}
+
+/*!
+    Returns the patterns that this matcher searches for.
+
+    \sa setPatterns()
+*/
+QList<QByteArray> QMultiByteArrayMatcher::patterns() const
+{
+    return d ? d->patterns : QList<QByteArray>();
+}
+
+/*!
+    Searches \a data from byte position \a from (default 0, i.e. from the
+    first byte) for any of the patterns(). Returns the position of the
+    leftmost occurrence, or -1 if none of the patterns occurs. If
+    \a patternIndex is not \nullptr, the index in patterns() of the pattern
+    found is stored there; if several patterns occur at the same position,
+    it is the lowest of their indexes.
+
+    This gives the same result as calling QByteArrayMatcher::indexIn() for
+    every pattern, and keeping the smallest position, but only needs one
+    pass over \a data.
+
+    \sa findAll()
+*/
+qsizetype QMultiByteArrayMatcher::indexIn(QByteArrayView data, qsizetype from,
+                                          qsizetype *patternIndex) const
+{
+    if (patternIndex)
+        *patternIndex = -1;
+    if (from < 0)
+        from = 0;
+    if (!d || d->automaton.isEmpty())
+        return -1;
+    const auto hit = d->automaton.findFirst(reinterpret_cast<const uchar *>(data.data()),
+                                            data.size(), from, identityFold);
+    if (patternIndex)
+        *patternIndex = hit.patternIndex;
+    return hit.position;
+}
+
+/*!
+    Searches \a data from byte position \a from (default 0, i.e. from the
+    first byte) for all the occurrences of all the patterns(), in a single
+    pass, and returns them sorted by position; occurrences at the same
+    position are sorted by pattern index. Occurrences may overlap.
+
+    \sa indexIn()
+*/
+QList<QMultiByteArrayMatcher::Match> QMultiByteArrayMatcher::findAll(QByteArrayView data,
+                                                                     qsizetype from) const
+{
+    QList<Match> matches;
+    if (from < 0)
+        from = 0;
+    if (!d || d->automaton.isEmpty())
+        return matches;
+    d->automaton.findAll(reinterpret_cast<const uchar *>(data.data()), data.size(), from,
+                         identityFold, [&matches](const auto &hit) {
+        matches.append({ hit.position, hit.length, hit.patternIndex });
+    });
+    std::sort(matches.begin(), matches.end(), [](const Match &lhs, const Match &rhs) {
+        return lhs.position < rhs.position
+                || (lhs.position == rhs.position && lhs.patternIndex < rhs.patternIndex);
+    });
+    return matches;
+}
+
 /*!
     \class QStaticByteArrayMatcherBase
     \since 5.9
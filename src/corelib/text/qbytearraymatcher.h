@@ -41,6 +41,8 @@
 #define QBYTEARRAYMATCHER_H
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -83,6 +85,41 @@ private:
     };
 };
 
+class QMultiByteArrayMatcherPrivate;
+
+class Q_CORE_EXPORT QMultiByteArrayMatcher
+{
+public:
+    struct Match {
+        qsizetype position;
+        qsizetype length;
+        qsizetype patternIndex;
+    };
+
+    QMultiByteArrayMatcher();
+    explicit QMultiByteArrayMatcher(const QList<QByteArray> &patterns);
+    QMultiByteArrayMatcher(const QMultiByteArrayMatcher &other);
+    QMultiByteArrayMatcher(QMultiByteArrayMatcher &&other) noexcept;
+    ~QMultiByteArrayMatcher();
+
+    QMultiByteArrayMatcher &operator=(const QMultiByteArrayMatcher &other);
+    QMultiByteArrayMatcher &operator=(QMultiByteArrayMatcher &&other) noexcept
+    { d.swap(other.d); return *this; }
+
+    void swap(QMultiByteArrayMatcher &other) noexcept { d.swap(other.d); }
+
+    void setPatterns(const QList<QByteArray> &patterns);
+    QList<QByteArray> patterns() const;
+
+    qsizetype indexIn(QByteArrayView data, qsizetype from = 0, qsizetype *patternIndex = nullptr) const;
+    QList<Match> findAll(QByteArrayView data, qsizetype from = 0) const;
+
+private:
+    QSharedDataPointer<QMultiByteArrayMatcherPrivate> d;
+};
+
+Q_DECLARE_SHARED(QMultiByteArrayMatcher)
+
 class QStaticByteArrayMatcherBase
 {
     alignas(16)
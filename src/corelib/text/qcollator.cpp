@@ -44,6 +44,9 @@
 
 #include "qdebug.h"
 
+#include <algorithm>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -354,6 +357,60 @@ int QCollator::compare(const QChar *s1, int len1, const QChar *s2, int len2) con
     \note Not supported with the C (a.k.a. POSIX) locale on Darwin.
  */
 
+/*!
+    \since 6.0
+
+    Sorts \a list in place, according to this collator.
+
+    The result is the same as sorting \a list with std::stable_sort() using
+    this collator as comparison function. For longer lists, a sort key is
+    created once per string and the strings are then ordered by their keys,
+    which avoids collating every string again for each comparison.
+
+    \sa sortKey(), compare()
+ */
+void QCollator::sort(QStringList &list) const
+{
+    // Below this size, the key generation costs more than it saves
+    constexpr qsizetype MinimumSortKeyListSize = 16;
+
+    if (list.size() < 2)
+        return;
+    if (d->dirty)
+        d->init();
+
+    bool useSortKeys = !d->isC() && list.size() >= MinimumSortKeyListSize;
+#if QT_CONFIG(icu) || defined(Q_OS_MACOS)
+    // Without a collator, compare() falls back to a comparison sort keys cannot express
+    useSortKeys = useSortKeys && d->collator != NoCollator;
+#endif
+    if (!useSortKeys) {
+        std::stable_sort(list.begin(), list.end(), [this](const QString &s1, const QString &s2) {
+            return compare(s1, s2) < 0;
+        });
+        return;
+    }
+
+    struct Entry {
+        QCollatorSortKey key;
+        qsizetype index;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(list.size());
+    for (qsizetype i = 0; i < list.size(); ++i)
+        entries.push_back(Entry{sortKey(list.at(i)), i});
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry &e1, const Entry &e2) {
+        return e1.key.compare(e2.key) < 0;
+    });
+
+    QStringList sorted;
+    sorted.reserve(list.size());
+    for (const Entry &entry : entries)
+        sorted.append(std::move(list[entry.index]));
+    list.swap(sorted);
+}
+
 /*!
     \class QCollatorSortKey
     \inmodule QtCore
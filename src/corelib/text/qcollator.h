@@ -119,6 +119,7 @@ public:
     { return compare(s1, s2) < 0; }
 
     QCollatorSortKey sortKey(const QString &string) const;
+    void sort(QStringList &list) const;
 
 private:
     QCollatorPrivate *d;
@@ -579,16 +579,6 @@ static const QLocaleData *findLocaleData(const QString &name)
     return QLocaleData::findLocaleData(lang, script, cntry);
 }
 
-static uint findLocaleOffset(const QString &name)
-{
-    QLocale::Language lang;
-    QLocale::Script script;
-    QLocale::Country cntry;
-    QLocalePrivate::getLangAndCountry(name, lang, script, cntry);
-
-    return QLocaleData::findLocaleOffset(lang, script, cntry);
-}
-
 QString qt_readEscapedFormatString(QStringView format, int *idx)
 {
     int &i = *idx;
@@ -800,15 +790,61 @@ static const int locale_data_size = sizeof(locale_data)/sizeof(QLocaleData) - 1;
 Q_GLOBAL_STATIC_WITH_ARGS(QSharedDataPointer<QLocalePrivate>, defaultLocalePrivate,
                           (QLocalePrivate::create(defaultData())))
 
+namespace {
+// Holds one QLocalePrivate, with default number options, per entry of
+// locale_data, so that constructing the same locale again doesn't allocate.
+// The cache keeps a reference to each entry until it is destroyed.
+struct QLocalePrivateCache
+{
+    QLocalePrivateCache()
+    {
+        for (auto &entry : entries)
+            entry.storeRelaxed(nullptr);
+    }
+    ~QLocalePrivateCache()
+    {
+        for (auto &entry : entries) {
+            QLocalePrivate *d = entry.loadRelaxed();
+            if (d && !d->ref.deref())
+                delete d;
+        }
+    }
+
+    QBasicAtomicPointer<QLocalePrivate> entries[locale_data_size];
+};
+}
+
+Q_GLOBAL_STATIC(QLocalePrivateCache, localePrivateCache)
+
+static QLocalePrivate *sharedLocalePrivate(const QLocaleData *data)
+{
+    const uint offset = data - locale_data;
+    Q_ASSERT(offset < uint(locale_data_size));
+    QLocalePrivateCache *cache = localePrivateCache();
+    if (!cache)
+        return QLocalePrivate::create(data, offset);
+
+    QBasicAtomicPointer<QLocalePrivate> &entry = cache->entries[offset];
+    QLocalePrivate *d = entry.loadAcquire();
+    if (!d) {
+        QLocalePrivate *created = QLocalePrivate::create(data, offset);
+        created->ref.storeRelaxed(1); // owned by the cache
+        if (entry.testAndSetOrdered(nullptr, created, d))
+            d = created;
+        else
+            delete created; // another thread got there first
+    }
+    return d;
+}
+
 static QLocalePrivate *localePrivateByName(const QString &name)
 {
     if (name == QLatin1String("C"))
         return c_private();
-    // TODO: Remove this version, and use offset everywhere
     const QLocaleData *data = findLocaleData(name);
-    return QLocalePrivate::create(data, findLocaleOffset(name),
-                                  data->m_language_id == QLocale::C
-                                  ? QLocale::OmitGroupSeparator : QLocale::DefaultNumberOptions);
+    if (data->m_language_id == QLocale::C)
+        return QLocalePrivate::create(data, data - locale_data, QLocale::OmitGroupSeparator);
+    return sharedLocalePrivate(data);
 }
 
 static QLocalePrivate *findLocalePrivate(QLocale::Language language, QLocale::Script script,
@@ -819,17 +855,15 @@ static QLocalePrivate *findLocalePrivate(QLocale::Language language, QLocale::Sc
 
     // TODO: Remove pointer, use index instead
     const QLocaleData *data = QLocaleData::findLocaleData(language, script, country);
-    const uint offset = QLocaleData::findLocaleOffset(language, script, country);
-
-    QLocale::NumberOptions numberOptions = QLocale::DefaultNumberOptions;
+    if (data->m_language_id != QLocale::C)
+        return sharedLocalePrivate(data);
 
     // If not found, should default to system
-    if (data->m_language_id == QLocale::C) {
-        if (defaultLocalePrivate.exists())
-            numberOptions = defaultLocalePrivate->data()->m_numberOptions;
-        data = defaultData();
-    }
-    return QLocalePrivate::create(data, offset, numberOptions);
+    const uint offset = data - locale_data;
+    QLocale::NumberOptions numberOptions = QLocale::DefaultNumberOptions;
+    if (defaultLocalePrivate.exists())
+        numberOptions = defaultLocalePrivate->data()->m_numberOptions;
+    return QLocalePrivate::create(defaultData(), offset, numberOptions);
 }
 
 QString QLocaleData::decimalPoint() const
@@ -3051,9 +3085,122 @@ QString QLocale::pmText() const
 
 // Another intrusion from QCalendar, using some of the tools above:
 
+QDateTimeFormatTokens QDateTimeFormatTokens::parse(QStringView format, bool date, bool time)
+{
+    QDateTimeFormatTokens result;
+    result.date = date;
+    result.time = time;
+    result.twelveHour = time && timeFormatContainsAP(format);
+
+    const auto appendText = [&result](const QString &text) {
+        if (text.isEmpty())
+            return;
+        if (!result.tokens.isEmpty() && result.tokens.last().field == 0)
+            result.tokens.last().text += text;
+        else
+            result.tokens.append({ text, 0, 0 });
+    };
+
+    int i = 0;
+    while (i < format.size()) {
+        if (format.at(i).unicode() == '\'') {
+            appendText(qt_readEscapedFormatString(format, &i));
+            continue;
+        }
+
+        const QChar c = format.at(i);
+        int repeat = qt_repeatCount(format.mid(i));
+        bool used = false;
+        if (date) {
+            switch (c.unicode()) {
+            case 'y':
+                used = true;
+                if (repeat >= 4)
+                    repeat = 4;
+                else if (repeat >= 2)
+                    repeat = 2;
+                else
+                    used = false;
+                break;
+            case 'M':
+            case 'd':
+                used = true;
+                repeat = qMin(repeat, 4);
+                break;
+            default:
+                break;
+            }
+        }
+        if (!used && time) {
+            switch (c.unicode()) {
+            case 'h':
+            case 'H':
+            case 'm':
+            case 's':
+                used = true;
+                repeat = qMin(repeat, 2);
+                break;
+            case 'a':
+                used = true;
+                repeat = format.mid(i + 1).startsWith(QLatin1Char('p')) ? 2 : 1;
+                break;
+            case 'A':
+                used = true;
+                repeat = format.mid(i + 1).startsWith(QLatin1Char('P')) ? 2 : 1;
+                break;
+            case 'z':
+                used = true;
+                repeat = (repeat >= 3) ? 3 : 1;
+                break;
+            case 't':
+                used = true;
+                repeat = 1;
+                break;
+            default:
+                break;
+            }
+        }
+        if (used)
+            result.tokens.append({ QString(), c.unicode(), repeat });
+        else
+            appendText(QString(repeat, c));
+        i += repeat;
+    }
+
+    return result;
+}
+
 QString QCalendarBackend::dateTimeToString(QStringView format, const QDateTime &datetime,
                                            QDate dateOnly, QTime timeOnly,
                                            const QLocale &locale) const
+{
+    bool formatDate = false;
+    bool formatTime = false;
+    if (datetime.isValid()) {
+        formatDate = true;
+        formatTime = true;
+    } else if (dateOnly.isValid()) {
+        formatDate = true;
+    } else if (timeOnly.isValid()) {
+        formatTime = true;
+    } else {
+        return QString();
+    }
+
+    return dateTimeToString(QDateTimeFormatTokens::parse(format, formatDate, formatTime),
+                            datetime, dateOnly, timeOnly, locale);
+}
+
+/*
+  Does the work of the virtual dateTimeToString(), with a format parsed by the
+  caller, so that formatting many date-times with the same format need only
+  parse it once. The \a format must have been parsed for the date and or time
+  that is passed.
+*/
+QString QCalendarBackend::dateTimeToString(const QDateTimeFormatTokens &format,
+                                           const QDateTime &datetime,
+                                           QDate dateOnly, QTime timeOnly,
+                                           const QLocale &locale) const
 {
     QDate date;
     QTime time;
@@ -3073,6 +3220,7 @@ QString QCalendarBackend::dateTimeToString(QStringView format, const QDateTime &
     } else {
         return QString();
     }
+    Q_ASSERT(format.date == formatDate && format.time == formatTime);
 
     QString result;
     int year = 0, month = 0, day = 0;
@@ -3085,200 +3233,151 @@ QString QCalendarBackend::dateTimeToString(QStringView format, const QDateTime &
         day = parts.day;
     }
 
-    int i = 0;
-    while (i < format.size()) {
-        if (format.at(i).unicode() == '\'') {
-            result.append(qt_readEscapedFormatString(format, &i));
-            continue;
-        }
+    for (const QDateTimeFormatTokens::Token &token : format.tokens) {
+        const int repeat = token.repeat;
+        switch (token.field) {
+        case 0:
+            result.append(token.text);
+            break;
 
-        const QChar c = format.at(i);
-        int repeat = qt_repeatCount(format.mid(i));
-        bool used = false;
-        if (formatDate) {
-            switch (c.unicode()) {
-            case 'y':
-                used = true;
-                if (repeat >= 4)
-                    repeat = 4;
-                else if (repeat >= 2)
-                    repeat = 2;
+        case 'y':
+            if (repeat == 4) {
+                const int len = (year < 0) ? 5 : 4;
+                result.append(locale.d->m_data->longLongToString(year, -1, 10, len,
+                                                                 QLocaleData::ZeroPadded));
+            } else {
+                result.append(locale.d->m_data->longLongToString(year % 100, -1, 10, 2,
+                                                                 QLocaleData::ZeroPadded));
+            }
+            break;
 
-                switch (repeat) {
-                case 4: {
-                    const int len = (year < 0) ? 5 : 4;
-                    result.append(locale.d->m_data->longLongToString(year, -1, 10, len,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                }
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(year % 100, -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                default:
-                    repeat = 1;
-                    result.append(c);
-                    break;
-                }
+        case 'M':
+            switch (repeat) {
+            case 1:
+                result.append(locale.d->m_data->longLongToString(month));
                 break;
-
-            case 'M':
-                used = true;
-                repeat = qMin(repeat, 4);
-                switch (repeat) {
-                case 1:
-                    result.append(locale.d->m_data->longLongToString(month));
-                    break;
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(month, -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                case 3:
-                    result.append(monthName(locale, month, year, QLocale::ShortFormat));
-                    break;
-                case 4:
-                    result.append(monthName(locale, month, year, QLocale::LongFormat));
-                    break;
-                }
+            case 2:
+                result.append(locale.d->m_data->longLongToString(month, -1, 10, 2,
+                                                                 QLocaleData::ZeroPadded));
                 break;
-
-            case 'd':
-                used = true;
-                repeat = qMin(repeat, 4);
-                switch (repeat) {
-                case 1:
-                    result.append(locale.d->m_data->longLongToString(day));
-                    break;
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(day, -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                case 3:
-                    result.append(locale.dayName(
-                                      dayOfWeek(date.toJulianDay()), QLocale::ShortFormat));
-                    break;
-                case 4:
-                    result.append(locale.dayName(
-                                      dayOfWeek(date.toJulianDay()), QLocale::LongFormat));
-                    break;
-                }
+            case 3:
+                result.append(monthName(locale, month, year, QLocale::ShortFormat));
+                break;
+            case 4:
+                result.append(monthName(locale, month, year, QLocale::LongFormat));
                 break;
+            }
+            break;
 
-            default:
+        case 'd':
+            switch (repeat) {
+            case 1:
+                result.append(locale.d->m_data->longLongToString(day));
+                break;
+            case 2:
+                result.append(locale.d->m_data->longLongToString(day, -1, 10, 2,
+                                                                 QLocaleData::ZeroPadded));
+                break;
+            case 3:
+                result.append(locale.dayName(
+                                  dayOfWeek(date.toJulianDay()), QLocale::ShortFormat));
+                break;
+            case 4:
+                result.append(locale.dayName(
+                                  dayOfWeek(date.toJulianDay()), QLocale::LongFormat));
                 break;
             }
-        }
-        if (!used && formatTime) {
-            switch (c.unicode()) {
-            case 'h': {
-                used = true;
-                repeat = qMin(repeat, 2);
-                int hour = time.hour();
-                if (timeFormatContainsAP(format)) {
-                    if (hour > 12)
-                        hour -= 12;
-                    else if (hour == 0)
-                        hour = 12;
-                }
+            break;
 
-                switch (repeat) {
-                case 1:
-                    result.append(locale.d->m_data->longLongToString(hour));
-                    break;
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(hour, -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                }
+        case 'h': {
+            int hour = time.hour();
+            if (format.twelveHour) {
+                if (hour > 12)
+                    hour -= 12;
+                else if (hour == 0)
+                    hour = 12;
+            }
+
+            switch (repeat) {
+            case 1:
+                result.append(locale.d->m_data->longLongToString(hour));
+                break;
+            case 2:
+                result.append(locale.d->m_data->longLongToString(hour, -1, 10, 2,
+                                                                 QLocaleData::ZeroPadded));
                 break;
             }
-            case 'H':
-                used = true;
-                repeat = qMin(repeat, 2);
-                switch (repeat) {
-                case 1:
-                    result.append(locale.d->m_data->longLongToString(time.hour()));
-                    break;
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(time.hour(), -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                }
+            break;
+        }
+        case 'H':
+            switch (repeat) {
+            case 1:
+                result.append(locale.d->m_data->longLongToString(time.hour()));
                 break;
-
-            case 'm':
-                used = true;
-                repeat = qMin(repeat, 2);
-                switch (repeat) {
-                case 1:
-                    result.append(locale.d->m_data->longLongToString(time.minute()));
-                    break;
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(time.minute(), -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                }
+            case 2:
+                result.append(locale.d->m_data->longLongToString(time.hour(), -1, 10, 2,
+                                                                 QLocaleData::ZeroPadded));
                 break;
+            }
+            break;
 
-            case 's':
-                used = true;
-                repeat = qMin(repeat, 2);
-                switch (repeat) {
-                case 1:
-                    result.append(locale.d->m_data->longLongToString(time.second()));
-                    break;
-                case 2:
-                    result.append(locale.d->m_data->longLongToString(time.second(), -1, 10, 2,
-                                                                     QLocaleData::ZeroPadded));
-                    break;
-                }
+        case 'm':
+            switch (repeat) {
+            case 1:
+                result.append(locale.d->m_data->longLongToString(time.minute()));
                 break;
-
-            case 'a':
-                used = true;
-                repeat = format.mid(i + 1).startsWith(QLatin1Char('p')) ? 2 : 1;
-                result.append(time.hour() < 12 ? locale.amText().toLower()
-                                               : locale.pmText().toLower());
+            case 2:
+                result.append(locale.d->m_data->longLongToString(time.minute(), -1, 10, 2,
+                                                                 QLocaleData::ZeroPadded));
                 break;
+            }
+            break;
 
-            case 'A':
-                used = true;
-                repeat = format.mid(i + 1).startsWith(QLatin1Char('P')) ? 2 : 1;
-                result.append(time.hour() < 12 ? locale.amText().toUpper()
-                                                : locale.pmText().toUpper());
+        case 's':
+            switch (repeat) {
+            case 1:
+                result.append(locale.d->m_data->longLongToString(time.second()));
                 break;
-
-            case 'z':
-                used = true;
-                repeat = (repeat >= 3) ? 3 : 1;
-
-                // note: the millisecond component is treated like the decimal part of the seconds
-                // so ms == 2 is always printed as "002", but ms == 200 can be either "2" or "200"
-                result.append(locale.d->m_data->longLongToString(time.msec(), -1, 10, 3,
+            case 2:
+                result.append(locale.d->m_data->longLongToString(time.second(), -1, 10, 2,
                                                                  QLocaleData::ZeroPadded));
-                if (repeat == 1) {
-                    if (result.endsWith(locale.zeroDigit()))
-                        result.chop(1);
-                    if (result.endsWith(locale.zeroDigit()))
-                        result.chop(1);
-                }
                 break;
+            }
+            break;
 
-            case 't':
-                used = true;
-                repeat = 1;
-                // If we have a QDateTime use the time spec otherwise use the current system tzname
-                result.append(formatDate ? datetime.timeZoneAbbreviation()
-                                         : QDateTime::currentDateTime().timeZoneAbbreviation());
-                break;
+        case 'a':
+            result.append(time.hour() < 12 ? locale.amText().toLower()
+                                           : locale.pmText().toLower());
+            break;
 
-            default:
-                break;
+        case 'A':
+            result.append(time.hour() < 12 ? locale.amText().toUpper()
+                                            : locale.pmText().toUpper());
+            break;
+
+        case 'z':
+            // note: the millisecond component is treated like the decimal part of the seconds
+            // so ms == 2 is always printed as "002", but ms == 200 can be either "2" or "200"
+            result.append(locale.d->m_data->longLongToString(time.msec(), -1, 10, 3,
+                                                             QLocaleData::ZeroPadded));
+            if (repeat == 1) {
+                if (result.endsWith(locale.zeroDigit()))
+                    result.chop(1);
+                if (result.endsWith(locale.zeroDigit()))
+                    result.chop(1);
             }
+            break;
+
+        case 't':
+            // If we have a QDateTime use the time spec otherwise use the current system tzname
+            result.append(formatDate ? datetime.timeZoneAbbreviation()
+                                     : QDateTime::currentDateTime().timeZoneAbbreviation());
+            break;
+
+        default:
+            Q_UNREACHABLE();
+            break;
         }
-        if (!used)
-            result.append(QString(repeat, c));
-        i += repeat;
     }
 
     return result;
@@ -3286,9 +3385,206 @@ QString QCalendarBackend::dateTimeToString(QStringView format, const QDateTime &
 
 // End of QCalendar intrustions
 
+/*!
+    \internal
+
+    Decides whether a number in DFSignificantDigits form is to be represented
+    in decimal form (rather than in exponent form). The number has
+    \a digitCount significant digits and the decimal point at \a decpt, as
+    reported by qt_doubleToAscii(); \a groupSeparatorCount is the number of
+    group separators the decimal form would contain.
+*/
+static bool useDecimalForm(int precision, int decpt, int digitCount, bool mustMarkDecimal,
+                           int minExponentDigits, int groupSeparatorCount)
+{
+    /* POSIX specifies sprintf() to follow fprintf(), whose 'g/G'
+       format says; with P = 6 if precision unspecified else 1 if
+       precision is 0 else precision; when 'e/E' would have exponent
+       X, use:
+         * 'f/F' if P > X >= -4, with precision P-1-X
+         * 'e/E' otherwise, with precision P-1
+       Helpfully, we already have mapped precision < 0 to 6 - except
+       for F.P.Shortest mode, which is its own story - and those of
+       our callers with unspecified precision either used 6 or -1
+       for it.
+    */
+    if (precision == QLocale::FloatingPointShortest) {
+        // Find out which representation is shorter.
+        // Set bias to everything added to exponent form but not
+        // decimal, minus the converse.
+
+        // Exponent adds separator, sign and digits:
+        int bias = 2 + minExponentDigits;
+        // Decimal form may get grouping separators inserted:
+        bias -= groupSeparatorCount;
+        // X = decpt - 1 needs two digits if decpt > 10:
+        if (decpt > 10 && minExponentDigits == 1)
+            ++bias;
+        // Assume digitCount < 95, so we can ignore the 3-digit
+        // exponent case (we'll set useDecimal false anyway).
+
+        if (!mustMarkDecimal) {
+            // Decimal separator is skipped if at end; adjust if
+            // that happens for only one form:
+            if (digitCount <= decpt && digitCount > 1)
+                ++bias; // decimal but not exponent
+            else if (digitCount == 1 && decpt <= 0)
+                --bias; // exponent but not decimal
+        }
+        // When 0 < decpt <= digitCount, the forms have equal digit
+        // counts, plus things bias has taken into account;
+        // otherwise decimal form's digit count is right-padded with
+        // zeros to decpt, when decpt is positive, otherwise it's
+        // left-padded with 1 - decpt zeros.
+        return decpt <= 0 ? 1 - decpt <= bias
+                          : decpt <= digitCount ? 0 <= bias
+                                                : decpt <= digitCount + bias;
+    }
+
+    // X == decpt - 1, POSIX's P; -4 <= X < P iff -4 < decpt <= P
+    Q_ASSERT(precision >= 0);
+    return decpt > -4 && decpt <= (precision ? precision : 1);
+}
+
+/*!
+    \internal
+
+    Formats \a d like doubleToString() does for the C locale, but straight
+    into the Latin-1 buffer \a out, without going through intermediate
+    QStrings: the C locale uses ASCII digits, a '.' decimal point and an 'e'
+    exponent separator, so there is nothing to convert after
+    qt_doubleToAscii() produced the digits.
+
+    Returns \c false, leaving \a out alone, if \a flags ask for digit
+    grouping, which is left to doubleToString().
+*/
+bool QLocaleData::doubleToCLocaleChars(CharBuff *out, double d, int precision, DoubleForm form,
+                                       int width, unsigned flags)
+{
+    if (flags & GroupDigits)
+        return false;
+
+    // Same as in doubleToString()
+    if (precision != QLocale::FloatingPointShortest && precision < 0)
+        precision = 6;
+    if (width < 0)
+        width = 0;
+
+    int decpt;
+    int bufSize = 1;
+    if (precision == QLocale::FloatingPointShortest)
+        bufSize += std::numeric_limits<double>::max_digits10;
+    else if (form == DFDecimal)
+        bufSize += wholePartSpace(qAbs(d)) + precision;
+    else // Add extra digit due to different interpretations of precision. Also, "nan" has to fit.
+        bufSize += qMax(2, precision) + 1;
+
+    QVarLengthArray<char> buf(bufSize);
+    int length;
+    bool negative = false;
+    qt_doubleToAscii(d, form, precision, buf.data(), bufSize, negative, length, decpt);
+
+    out->clear();
+    if (negative && !isZero(d))
+        out->append('-');
+    else if (flags & AlwaysShowSign)
+        out->append('+');
+    else if (flags & BlankBeforePositive)
+        out->append(' ');
+    const qsizetype prefixSize = out->size();
+
+    if (qstrncmp(buf.data(), "inf", 3) == 0 || qstrncmp(buf.data(), "nan", 3) == 0) {
+        out->append(buf.constData(), length);
+    } else {
+        const bool mustMarkDecimal = flags & ForcePoint;
+        const int minExponentDigits = flags & ZeroPadExponent ? 2 : 1;
+        PrecisionMode mode = PMDecimalDigits;
+        bool useDecimal = form == DFDecimal;
+        if (form == DFSignificantDigits) {
+            mode = (flags & AddTrailingZeroes) ? PMSignificantDigits : PMChopTrailingZeros;
+            useDecimal = useDecimalForm(precision, decpt, length, mustMarkDecimal,
+                                        minExponentDigits, 0);
+        }
+
+        // The digits, padded with zeros as decimalForm() and exponentForm() do
+        const char *digits = buf.constData();
+        int digitCount = length;
+        if (useDecimal) {
+            // The decimal point goes at index decpt of the padded digits
+            int leadingZeros = 0;
+            if (decpt < 0) {
+                leadingZeros = -decpt;
+                decpt = 0;
+            }
+            int paddedCount = qMax(leadingZeros + digitCount, decpt);
+            if (mode == PMDecimalDigits)
+                paddedCount = qMax(paddedCount, decpt + precision);
+            else if (mode == PMSignificantDigits)
+                paddedCount = qMax(paddedCount, precision);
+
+            QVarLengthArray<char, 64> padded(paddedCount);
+            char *p = padded.data();
+            p = std::fill_n(p, leadingZeros, '0');
+            p = std::copy_n(digits, digitCount, p);
+            std::fill(p, padded.data() + paddedCount, '0');
+
+            if (decpt == 0)
+                out->append('0');
+            out->append(padded.constData(), decpt);
+            if (mustMarkDecimal || decpt < paddedCount)
+                out->append('.');
+            out->append(padded.constData() + decpt, paddedCount - decpt);
+        } else {
+            int paddedCount = digitCount;
+            if (mode == PMDecimalDigits)
+                paddedCount = qMax(paddedCount, precision + 1);
+            else if (mode == PMSignificantDigits)
+                paddedCount = qMax(paddedCount, precision);
+
+            out->append(digits[0]);
+            if (mustMarkDecimal || paddedCount > 1)
+                out->append('.');
+            out->append(digits + 1, digitCount - 1);
+            for (int i = digitCount; i < paddedCount; ++i)
+                out->append('0');
+
+            out->append('e');
+            const int exponent = decpt - 1;
+            out->append(exponent < 0 ? '-' : '+');
+            char exponentDigits[16];
+            char *const end = exponentDigits + sizeof(exponentDigits);
+            char *p = end;
+            for (uint e = qAbs(exponent); e || p == end; e /= 10)
+                *--p = char('0' + e % 10);
+            for (int i = int(end - p); i < minExponentDigits; ++i)
+                out->append('0');
+            out->append(p, end - p);
+        }
+
+        // Pad with zeros. LeftAdjusted overrides ZeroPadded.
+        if (flags & ZeroPadded && !(flags & LeftAdjusted) && out->size() < width)
+            out->insert(out->begin() + prefixSize, width - out->size(), '0');
+    }
+
+    if (flags & CapitalEorX) {
+        for (qsizetype i = prefixSize; i < out->size(); ++i) {
+            char &ch = (*out)[i];
+            if (ch >= 'a' && ch <= 'z')
+                ch -= 'a' - 'A';
+        }
+    }
+    return true;
+}
+
 QString QLocaleData::doubleToString(double d, int precision, DoubleForm form,
                                     int width, unsigned flags) const
 {
+    if (this == c()) {
+        CharBuff buf;
+        if (doubleToCLocaleChars(&buf, d, precision, form, width, flags))
+            return QString::fromLatin1(buf.constData(), buf.size());
+    }
+
     // Undocumented: aside from F.P.Shortest, precision < 0 is treated as
     // default, 6 - same as printf().
     if (precision != QLocale::FloatingPointShortest && precision < 0)
@@ -3357,56 +3653,13 @@ QString QLocaleData::doubleToString(double d, int precision, DoubleForm form,
                 PrecisionMode mode = (flags & AddTrailingZeroes) ?
                             PMSignificantDigits : PMChopTrailingZeros;
 
-                /* POSIX specifies sprintf() to follow fprintf(), whose 'g/G'
-                   format says; with P = 6 if precision unspecified else 1 if
-                   precision is 0 else precision; when 'e/E' would have exponent
-                   X, use:
-                     * 'f/F' if P > X >= -4, with precision P-1-X
-                     * 'e/E' otherwise, with precision P-1
-                   Helpfully, we already have mapped precision < 0 to 6 - except
-                   for F.P.Shortest mode, which is its own story - and those of
-                   our callers with unspecified precision either used 6 or -1
-                   for it.
-                */
-                bool useDecimal;
-                if (precision == QLocale::FloatingPointShortest) {
-                    // Find out which representation is shorter.
-                    // Set bias to everything added to exponent form but not
-                    // decimal, minus the converse.
-
-                    // Exponent adds separator, sign and digits:
-                    int bias = 2 + minExponentDigits;
-                    // Decimal form may get grouping separators inserted:
-                    if (groupDigits && decpt >= m_grouping_top + m_grouping_least)
-                        bias -= (decpt - m_grouping_top - m_grouping_least) / m_grouping_higher + 1;
-                    // X = decpt - 1 needs two digits if decpt > 10:
-                    if (decpt > 10 && minExponentDigits == 1)
-                        ++bias;
-                    // Assume digitCount < 95, so we can ignore the 3-digit
-                    // exponent case (we'll set useDecimal false anyway).
-
-                    const int digitCount = digits.length() / zero.size();
-                    if (!mustMarkDecimal) {
-                        // Decimal separator is skipped if at end; adjust if
-                        // that happens for only one form:
-                        if (digitCount <= decpt && digitCount > 1)
-                            ++bias; // decimal but not exponent
-                        else if (digitCount == 1 && decpt <= 0)
-                            --bias; // exponent but not decimal
-                    }
-                    // When 0 < decpt <= digitCount, the forms have equal digit
-                    // counts, plus things bias has taken into account;
-                    // otherwise decimal form's digit count is right-padded with
-                    // zeros to decpt, when decpt is positive, otherwise it's
-                    // left-padded with 1 - decpt zeros.
-                    useDecimal = (decpt <= 0 ? 1 - decpt <= bias
-                                  : decpt <= digitCount ? 0 <= bias
-                                  : decpt <= digitCount + bias);
-                } else {
-                    // X == decpt - 1, POSIX's P; -4 <= X < P iff -4 < decpt <= P
-                    Q_ASSERT(precision >= 0);
-                    useDecimal = decpt > -4 && decpt <= (precision ? precision : 1);
-                }
+                // Decimal form may get grouping separators inserted:
+                int groupSeparatorCount = 0;
+                if (groupDigits && decpt >= m_grouping_top + m_grouping_least)
+                    groupSeparatorCount = (decpt - m_grouping_top - m_grouping_least) / m_grouping_higher + 1;
+                const bool useDecimal = useDecimalForm(precision, decpt, digits.length() / zero.size(),
+                                                       mustMarkDecimal, minExponentDigits,
+                                                       groupSeparatorCount);
 
                 numStr = useDecimal
                     ? decimalForm(std::move(digits), decpt, precision, mode,
@@ -3522,10 +3775,50 @@ QString QLocaleData::signPrefix(bool negative, unsigned flags) const
     return {};
 }
 
+/*!
+    \internal
+
+    Formats \a number the way the C locale does when there are no flags, no
+    precision and no field width to apply: an optional minus sign followed by
+    the ASCII digits in \a base. This is by far the most common case of
+    QString::number() and friends, so it is worth building the result in one
+    go instead of going through applyIntegerFormatting().
+*/
+static QString cLocaleIntegerToString(qulonglong number, bool negative, int base)
+{
+    // Length of MAX_ULLONG in base 2 is 64; plus room for the sign.
+    char16_t buff[65];
+    char16_t *const end = buff + sizeof(buff) / sizeof(buff[0]);
+    char16_t *p = end;
+    do {
+        const int c = number % base;
+        *--p = c < 10 ? u'0' + c : c - 10 + u'a';
+        number /= base;
+    } while (number != 0);
+    if (negative)
+        *--p = u'-';
+    return QString(reinterpret_cast<const QChar *>(p), end - p);
+}
+
+static bool isPlainCLocaleInteger(const QLocaleData *data, int precision, int width, unsigned flags)
+{
+    return data == QLocaleData::c() && flags == QLocaleData::NoFlags
+            && precision == -1 && width <= 0;
+}
+
 QString QLocaleData::longLongToString(qlonglong l, int precision,
                                       int base, int width, unsigned flags) const
 {
     bool negative = l < 0;
+    if (isPlainCLocaleInteger(this, precision, width, flags)) {
+        if (base != 10)
+            return cLocaleIntegerToString(qulonglong(l), false, base);
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_MSVC(4146)
+        return cLocaleIntegerToString(negative ? -qulonglong(l) : qulonglong(l), negative, base);
+QT_WARNING_POP
+    }
+
     if (base != 10) {
         // these are not supported by sprintf for octal and hex
         flags &= ~AlwaysShowSign;
@@ -3549,6 +3842,9 @@ QT_WARNING_POP
 QString QLocaleData::unsLongLongToString(qulonglong l, int precision,
                                          int base, int width, unsigned flags) const
 {
+    if (isPlainCLocaleInteger(this, precision, width, flags))
+        return cLocaleIntegerToString(l, false, base);
+
     const QString zero = zeroDigit();
     QString resultZero = base == 10 ? zero : QStringLiteral("0");
     return applyIntegerFormatting(l ? qulltoa(l, base, zero) : resultZero,
@@ -3612,6 +3908,35 @@ QString QLocaleData::applyIntegerFormatting(QString &&numStr, bool negative, int
     return prefix + (flags & CapitalEorX ? std::move(numStr).toUpper() : numStr);
 }
 
+/*!
+    \internal
+
+    Maps \a in the way numberToCLocale() does for the C locale, whose
+    symbols are all ASCII (plus U+2212 MINUS SIGN, always accepted as '-'):
+    this saves the lookups of each locale symbol in numericToCLocale().
+    Returns 0 for anything that ends a number.
+*/
+static inline char cLocaleNumericChar(QChar in)
+{
+    const char16_t c = in.unicode();
+    if ((c >= u'0' && c <= u'9') || (c >= u'a' && c <= u'z'))
+        return char(c);
+    if (c >= u'A' && c <= u'Z')
+        return char(c - u'A' + 'a');
+    switch (c) {
+    case u'+':
+    case u'-':
+    case u'.':
+    case u',':
+    case u';':
+    case u'%':
+        return char(c);
+    case u'\x2212':
+        return '-';
+    }
+    return 0;
+}
+
 /*
     Converts a number in locale to its representation in the C locale.
     Only has to guarantee that a string that is a correct representation of
@@ -3637,12 +3962,15 @@ bool QLocaleData::numberToCLocale(QStringView s, QLocale::NumberOptions number_o
     int last_separator_idx = -1;
     int start_of_digits_idx = -1;
     int exponent_idx = -1;
+    const bool isCLocale = this == c();
 
     while (idx < length) {
         const QStringView in = QStringView(uc + idx, uc[idx].isHighSurrogate() ? 2 : 1);
 
-        char out = numericToCLocale(in);
+        char out = isCLocale ? cLocaleNumericChar(in.front()) : numericToCLocale(in);
         if (out == 0) {
+            if (isCLocale)
+                break;
             const QChar simple = in.size() == 1 ? in.front() : QChar::Null;
             if (in == listSeparator())
                 out = ';';
@@ -232,6 +232,11 @@ public:
                            DoubleForm form = DFSignificantDigits,
                            int width = -1,
                            unsigned flags = NoFlags) const;
+    static bool doubleToCLocaleChars(CharBuff *out, double d,
+                                     int precision = -1,
+                                     DoubleForm form = DFSignificantDigits,
+                                     int width = -1,
+                                     unsigned flags = NoFlags);
     QString longLongToString(qint64 l, int precision = -1,
                              int base = 10,
                              int width = -1,
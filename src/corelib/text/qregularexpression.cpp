@@ -51,6 +51,10 @@
 #include <QtCore/qglobal.h>
 #include <QtCore/qatomic.h>
 #include <QtCore/qdatastream.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qshareddata.h>
+
+#include <memory>
 
 #define PCRE2_CODE_UNIT_WIDTH 16
 
@@ -721,6 +725,30 @@ static int convertToPcreOptions(QRegularExpression::MatchOptions matchOptions)
     return options;
 }
 
+/*
+    The result of compiling a pattern string with a given set of pattern
+    options. It gets shared by all the QRegularExpressionPrivate objects using
+    the same pattern string and options (see QRegularExpressionPatternCache).
+    Once compiled (and JIT-compiled), the PCRE code is read-only, so it can
+    be used for matching from any number of threads at the same time.
+*/
+struct QRegularExpressionCompiledPattern : QSharedData
+{
+    QRegularExpressionCompiledPattern() = default;
+    Q_DISABLE_COPY_MOVE(QRegularExpressionCompiledPattern)
+    ~QRegularExpressionCompiledPattern()
+    {
+        pcre2_code_free_16(code);
+    }
+
+    pcre2_code_16 *code = nullptr;
+    int errorCode = 0;
+    int errorOffset = -1;
+    int capturingCount = 0;
+    bool usingCrLfNewlines = false;
+    bool usingJOption = false;
+};
+
 struct QRegularExpressionPrivate : QSharedData
 {
     QRegularExpressionPrivate();
@@ -729,8 +757,6 @@ struct QRegularExpressionPrivate : QSharedData
 
     void cleanCompiledPattern();
     void compilePattern();
-    void getPatternInfo();
-    void optimizePattern();
 
     enum CheckSubjectStringOption {
         CheckSubjectString,
@@ -742,6 +768,9 @@ struct QRegularExpressionPrivate : QSharedData
                  CheckSubjectStringOption checkSubjectStringOption = CheckSubjectString,
                  const QRegularExpressionMatchPrivate *previous = nullptr) const;
 
+    QList<qsizetype> matchingIndexes(const QList<QStringView> &subjectViews,
+                                     QRegularExpression::MatchOptions matchOptions) const;
+
     int captureIndexForName(QStringView name) const;
 
     // sizeof(QSharedData) == 4, so start our members with an enum
@@ -753,9 +782,11 @@ struct QRegularExpressionPrivate : QSharedData
     // (right after a detach happened).
     mutable QMutex mutex;
 
-    // The PCRE code pointer is reference-counted by the QRegularExpressionPrivate
-    // objects themselves; when the private is copied (i.e. a detach happened)
-    // it is set to nullptr
+    // The compiled pattern is shared with all the other privates using the
+    // same pattern and pattern options; the members below are copied out of
+    // it, so that matching does not need to go through one more indirection.
+    // When the private is copied (i.e. a detach happened) it is reset.
+    QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> compiled;
     pcre2_code_16 *compiledPattern;
     int errorCode;
     int errorOffset;
@@ -847,8 +878,8 @@ QRegularExpressionPrivate::~QRegularExpressionPrivate()
     \internal
 
     Copies the private, which means copying only the pattern and the pattern
-    options. The compiledPattern pointer is NOT copied (we
-    do not own it any more), and in general all the members set when
+    options. The compiled pattern is NOT copied (the copy is about
+    to be changed by a setter), and in general all the members set when
     compiling a pattern are set to default values. isDirty is set back to true
     so that the pattern has to be recompiled again.
 */
@@ -871,7 +902,7 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
 */
 void QRegularExpressionPrivate::cleanCompiledPattern()
 {
-    pcre2_code_free_16(compiledPattern);
+    compiled.reset();
     compiledPattern = nullptr;
     errorCode = 0;
     errorOffset = -1;
@@ -879,71 +910,6 @@ void QRegularExpressionPrivate::cleanCompiledPattern()
     usingCrLfNewlines = false;
 }
 
-/*!
-    \internal
-*/
-void QRegularExpressionPrivate::compilePattern()
-{
-    const QMutexLocker lock(&mutex);
-
-    if (!isDirty)
-        return;
-
-    isDirty = false;
-    cleanCompiledPattern();
-
-    int options = convertToPcreOptions(patternOptions);
-    options |= PCRE2_UTF;
-
-    PCRE2_SIZE patternErrorOffset;
-    compiledPattern = pcre2_compile_16(reinterpret_cast<PCRE2_SPTR16>(pattern.utf16()),
-                                       pattern.length(),
-                                       options,
-                                       &errorCode,
-                                       &patternErrorOffset,
-                                       nullptr);
-
-    if (!compiledPattern) {
-        errorOffset = static_cast<int>(patternErrorOffset);
-        return;
-    } else {
-        // ignore whatever PCRE2 wrote into errorCode -- leave it to 0 to mean "no error"
-        errorCode = 0;
-    }
-
-    optimizePattern();
-    getPatternInfo();
-}
-
-/*!
-    \internal
-*/
-void QRegularExpressionPrivate::getPatternInfo()
-{
-    Q_ASSERT(compiledPattern);
-
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
-
-    // detect the settings for the newline
-    unsigned int patternNewlineSetting;
-    if (pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
-        // no option was specified in the regexp, grab PCRE build defaults
-        pcre2_config_16(PCRE2_CONFIG_NEWLINE, &patternNewlineSetting);
-    }
-
-    usingCrLfNewlines = (patternNewlineSetting == PCRE2_NEWLINE_CRLF) ||
-            (patternNewlineSetting == PCRE2_NEWLINE_ANY) ||
-            (patternNewlineSetting == PCRE2_NEWLINE_ANYCRLF);
-
-    unsigned int hasJOptionChanged;
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
-    if (Q_UNLIKELY(hasJOptionChanged)) {
-        qWarning("QRegularExpressionPrivate::getPatternInfo(): the pattern '%ls'\n    is using the (?J) option; duplicate capturing group names are not supported by Qt",
-                 qUtf16Printable(pattern));
-    }
-}
-
-
 /*
     Simple "smartpointer" wrapper around a pcre2_jit_stack_16, to be used with
     QThreadStorage.
@@ -987,6 +953,83 @@ static pcre2_jit_stack_16 *qtPcreCallback(void *)
     return nullptr;
 }
 
+/*
+    The per-thread state needed by pcre2_match_16: a match context (which
+    knows how to find the thread's JIT stack) and a match data block, large
+    enough for the pattern with the most capturing groups matched so far by
+    this thread. Reusing them saves two allocations and deallocations for
+    every match. pcre2_match_16 never calls back into Qt (other than to get
+    the JIT stack), so there is no reentrancy to worry about.
+*/
+class QPcreMatchResources
+{
+    Q_DISABLE_COPY(QPcreMatchResources)
+
+public:
+    /*!
+        \internal
+    */
+    QPcreMatchResources()
+        : context(pcre2_match_context_create_16(nullptr))
+    {
+        pcre2_jit_stack_assign_16(context, &qtPcreCallback, nullptr);
+    }
+    /*!
+        \internal
+    */
+    ~QPcreMatchResources()
+    {
+        if (data)
+            pcre2_match_data_free_16(data);
+        pcre2_match_context_free_16(context);
+    }
+
+    /*!
+        \internal
+
+        Returns a match data block with room for at least \a pairs pairs of
+        offsets (i.e. the number of capturing groups of the pattern, plus one).
+    */
+    pcre2_match_data_16 *matchData(int pairs)
+    {
+        if (pairs > capacity) {
+            if (data)
+                pcre2_match_data_free_16(data);
+            capacity = qMax(pairs, 16);
+            data = pcre2_match_data_create_16(capacity, nullptr);
+        }
+        return data;
+    }
+
+    pcre2_match_context_16 *context;
+
+private:
+    pcre2_match_data_16 *data = nullptr;
+    int capacity = 0;
+};
+
+Q_GLOBAL_STATIC(QThreadStorage<QPcreMatchResources *>, matchResources)
+
+/*!
+    \internal
+
+    Returns the match resources of the calling thread, creating them if
+    needed. If the thread storage has already been destroyed (i.e. we are
+    matching from a global destructor), a set of resources is created into
+    \a fallback instead.
+*/
+static QPcreMatchResources *threadMatchResources(std::unique_ptr<QPcreMatchResources> &fallback)
+{
+    QThreadStorage<QPcreMatchResources *> *storage = matchResources();
+    if (Q_UNLIKELY(!storage)) {
+        fallback.reset(new QPcreMatchResources);
+        return fallback.get();
+    }
+    if (!storage->hasLocalData())
+        storage->setLocalData(new QPcreMatchResources);
+    return storage->localData();
+}
+
 /*!
     \internal
 */
@@ -1012,19 +1055,169 @@ static bool isJitEnabled()
     The purpose of the function is to call pcre2_jit_compile_16, which
     JIT-compiles the pattern.
 
-    It gets called when a pattern is recompiled by us (in compilePattern()),
-    under mutex protection.
+    It gets called when a pattern is compiled by us (in compilePattern()),
+    before the compiled pattern gets published in the pattern cache.
 */
-void QRegularExpressionPrivate::optimizePattern()
+static void optimizePattern(QRegularExpressionCompiledPattern *compiled)
 {
-    Q_ASSERT(compiledPattern);
+    Q_ASSERT(compiled->code);
 
     static const bool enableJit = isJitEnabled();
 
     if (!enableJit)
         return;
 
-    pcre2_jit_compile_16(compiledPattern, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
+    pcre2_jit_compile_16(compiled->code, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
+}
+
+/*!
+    \internal
+*/
+static void getPatternInfo(QRegularExpressionCompiledPattern *compiled)
+{
+    Q_ASSERT(compiled->code);
+
+    pcre2_pattern_info_16(compiled->code, PCRE2_INFO_CAPTURECOUNT, &compiled->capturingCount);
+
+    // detect the settings for the newline
+    unsigned int patternNewlineSetting;
+    if (pcre2_pattern_info_16(compiled->code, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
+        // no option was specified in the regexp, grab PCRE build defaults
+        pcre2_config_16(PCRE2_CONFIG_NEWLINE, &patternNewlineSetting);
+    }
+
+    compiled->usingCrLfNewlines = (patternNewlineSetting == PCRE2_NEWLINE_CRLF) ||
+            (patternNewlineSetting == PCRE2_NEWLINE_ANY) ||
+            (patternNewlineSetting == PCRE2_NEWLINE_ANYCRLF);
+
+    unsigned int hasJOptionChanged;
+    pcre2_pattern_info_16(compiled->code, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
+    compiled->usingJOption = hasJOptionChanged;
+}
+
+/*!
+    \internal
+*/
+static QRegularExpressionCompiledPattern *
+compilePattern(const QString &pattern, QRegularExpression::PatternOptions patternOptions)
+{
+    auto compiled = new QRegularExpressionCompiledPattern;
+
+    int options = convertToPcreOptions(patternOptions);
+    options |= PCRE2_UTF;
+
+    PCRE2_SIZE patternErrorOffset;
+    compiled->code = pcre2_compile_16(reinterpret_cast<PCRE2_SPTR16>(pattern.utf16()),
+                                      pattern.length(),
+                                      options,
+                                      &compiled->errorCode,
+                                      &patternErrorOffset,
+                                      nullptr);
+
+    if (!compiled->code) {
+        compiled->errorOffset = static_cast<int>(patternErrorOffset);
+        return compiled;
+    }
+
+    // ignore whatever PCRE2 wrote into errorCode -- leave it to 0 to mean "no error"
+    compiled->errorCode = 0;
+
+    optimizePattern(compiled);
+    getPatternInfo(compiled);
+    return compiled;
+}
+
+namespace {
+struct QRegularExpressionPatternKey
+{
+    QString pattern;
+    QRegularExpression::PatternOptions patternOptions;
+
+    friend bool operator==(const QRegularExpressionPatternKey &lhs,
+                           const QRegularExpressionPatternKey &rhs) noexcept
+    {
+        return lhs.patternOptions == rhs.patternOptions && lhs.pattern == rhs.pattern;
+    }
+
+    friend size_t qHash(const QRegularExpressionPatternKey &key, size_t seed = 0) noexcept
+    {
+        return qHashMulti(seed, key.pattern, key.patternOptions);
+    }
+};
+
+/*
+    A process-wide cache of compiled patterns, keyed by pattern string and
+    pattern options. Applications very often build equal QRegularExpression
+    objects over and over again (for instance, temporaries passed to
+    QString::contains()), and every one of them would otherwise need to
+    compile and JIT-compile its pattern from scratch. The cache only keeps
+    the most recently used patterns; evicting a pattern simply drops the
+    cache's reference to it.
+*/
+class QRegularExpressionPatternCache
+{
+public:
+    using CompiledPatternPointer = QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern>;
+
+    CompiledPatternPointer compiledPattern(const QString &pattern,
+                                           QRegularExpression::PatternOptions patternOptions)
+    {
+        const QRegularExpressionPatternKey key{ pattern, patternOptions };
+        {
+            const QMutexLocker lock(&mutex);
+            if (const CompiledPatternPointer *cached = cache.object(key))
+                return *cached;
+        }
+
+        // Compile without holding the lock: compiling and JIT-compiling can
+        // be expensive, and other threads may want to use other patterns in
+        // the meanwhile. If another thread raced us, keep its result.
+        CompiledPatternPointer compiled(::compilePattern(pattern, patternOptions));
+
+        const QMutexLocker lock(&mutex);
+        if (const CompiledPatternPointer *cached = cache.object(key))
+            return *cached;
+        cache.insert(key, new CompiledPatternPointer(compiled));
+        return compiled;
+    }
+
+private:
+    QMutex mutex;
+    QCache<QRegularExpressionPatternKey, CompiledPatternPointer> cache{256};
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QRegularExpressionPatternCache, patternCache)
+
+/*!
+    \internal
+*/
+void QRegularExpressionPrivate::compilePattern()
+{
+    const QMutexLocker lock(&mutex);
+
+    if (!isDirty)
+        return;
+
+    isDirty = false;
+    cleanCompiledPattern();
+
+    if (QRegularExpressionPatternCache *cache = patternCache())
+        compiled = cache->compiledPattern(pattern, patternOptions);
+    else
+        compiled = QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern>(
+                    ::compilePattern(pattern, patternOptions));
+
+    compiledPattern = compiled->code;
+    errorCode = compiled->errorCode;
+    errorOffset = compiled->errorOffset;
+    capturingCount = compiled->capturingCount;
+    usingCrLfNewlines = compiled->usingCrLfNewlines;
+
+    if (Q_UNLIKELY(compiled->usingJOption)) {
+        qWarning("QRegularExpressionPrivate::getPatternInfo(): the pattern '%ls'\n    is using the (?J) option; duplicate capturing group names are not supported by Qt",
+                 qUtf16Printable(pattern));
+    }
 }
 
 /*!
@@ -1160,9 +1353,10 @@ void QRegularExpressionPrivate::doMatch(QRegularExpressionMatchPrivate *priv,
         previousMatchWasEmpty = true;
     }
 
-    pcre2_match_context_16 *matchContext = pcre2_match_context_create_16(nullptr);
-    pcre2_jit_stack_assign_16(matchContext, &qtPcreCallback, nullptr);
-    pcre2_match_data_16 *matchData = pcre2_match_data_create_from_pattern_16(compiledPattern, nullptr);
+    std::unique_ptr<QPcreMatchResources> localResources;
+    QPcreMatchResources *resources = threadMatchResources(localResources);
+    pcre2_match_context_16 *matchContext = resources->context;
+    pcre2_match_data_16 *matchData = resources->matchData(capturingCount + 1);
 
     const char16_t * const subjectUtf16 = priv->subject.utf16();
 
@@ -1257,9 +1451,49 @@ void QRegularExpressionPrivate::doMatch(QRegularExpressionMatchPrivate *priv,
             capturedOffsets[0] -= maximumLookBehind;
         }
     }
+}
+
+/*!
+    \internal
+
+    Matches the pattern against each of the \a subjectViews, from their
+    beginning, using the \a matchOptions; returns the indexes of the subjects
+    that contain a (normal) match.
+
+    This is the work horse of QRegularExpression::matchingIndexes(): unlike
+    doMatch(), it does not record any captured substring, so it does not need
+    to allocate anything but the returned list.
+*/
+QList<qsizetype> QRegularExpressionPrivate::matchingIndexes(const QList<QStringView> &subjectViews,
+                                                           QRegularExpression::MatchOptions matchOptions) const
+{
+    QList<qsizetype> indexes;
+
+    if (Q_UNLIKELY(!compiledPattern)) {
+        qWarning("QRegularExpressionPrivate::matchingIndexes(): called on an invalid QRegularExpression object");
+        return indexes;
+    }
+
+    const int pcreOptions = convertToPcreOptions(matchOptions);
+
+    std::unique_ptr<QPcreMatchResources> localResources;
+    QPcreMatchResources *resources = threadMatchResources(localResources);
+    pcre2_match_data_16 *matchData = resources->matchData(capturingCount + 1);
+
+    for (qsizetype i = 0, count = subjectViews.size(); i < count; ++i) {
+        const QStringView subject = subjectViews.at(i);
+        // PCRE2 refuses null subjects, even empty ones
+        const char16_t *subjectUtf16 = subject.isNull() ? u"" : subject.utf16();
+        const int result = safe_pcre2_match_16(compiledPattern,
+                                               reinterpret_cast<PCRE2_SPTR16>(subjectUtf16),
+                                               int(subject.length()),
+                                               0, pcreOptions,
+                                               matchData, resources->context);
+        if (result > 0)
+            indexes.append(i);
+    }
 
-    pcre2_match_data_free_16(matchData);
-    pcre2_match_context_free_16(matchContext);
+    return indexes;
 }
 
 /*!
@@ -1674,6 +1908,34 @@ QRegularExpressionMatchIterator QRegularExpression::globalMatch(QStringView subj
     return QRegularExpressionMatchIterator(*priv);
 }
 
+/*!
+    \since 6.0
+
+    Matches the regular expression against each of the given \a subjectViews,
+    starting from the beginning of each subject and honoring the given
+    \a matchOptions, and returns the (ascending) indexes inside
+    \a subjectViews of the subjects that contain a match.
+
+    This is equivalent to, but much faster than, calling match() on every
+    subject and checking QRegularExpressionMatch::hasMatch(): the pattern
+    is compiled just once, and no QRegularExpressionMatch objects are
+    created. It is therefore suited for filtering large numbers of strings,
+    for instance all the lines of a log file:
+
+    \snippet code/src_corelib_text_qregularexpression.cpp 34
+
+    Only normal matches are reported; captured substrings are not recorded.
+    Use match() on the subjects of interest to get them.
+
+    \sa match(), {normal matching}
+*/
+QList<qsizetype> QRegularExpression::matchingIndexes(const QList<QStringView> &subjectViews,
+                                                     MatchOptions matchOptions) const
+{
+    d.data()->compilePattern();
+    return d->matchingIndexes(subjectViews, matchOptions);
+}
+
 /*!
     \since 5.4
 
@@ -42,6 +42,7 @@
 #define QREGULAREXPRESSION_H
 
 #include <QtCore/qglobal.h>
+#include <QtCore/qlist.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qstringview.h>
 #include <QtCore/qshareddata.h>
@@ -138,6 +139,9 @@ public:
                                                 MatchType matchType       = NormalMatch,
                                                 MatchOptions matchOptions = NoMatchOption) const;
 
+    QList<qsizetype> matchingIndexes(const QList<QStringView> &subjectViews,
+                                     MatchOptions matchOptions = NoMatchOption) const;
+
     void optimize() const;
 
     enum WildcardConversionOption {
@@ -262,6 +262,147 @@ inline RetType UnrollTailLoop<0>::exec(Number, RetType returnIfExited, Functor1,
 }
 #endif
 
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(AVX2) && !defined(QT_BOOTSTRAPPED)
+#  define QT_STRING_DISPATCH_AVX2
+#endif
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(AVX512BW) && !defined(QT_BOOTSTRAPPED)
+#  define QT_STRING_DISPATCH_AVX512
+#endif
+
+/*
+ * Runtime-dispatched AVX2 and AVX-512 kernels for searching and counting in
+ * UTF-16 strings. The substring search compares the first and last
+ * characters of the needle against each position of a whole block of the
+ * haystack, and only compares the rest of the needle where both match.
+ */
+#ifdef QT_STRING_DISPATCH_AVX2
+static QT_FUNCTION_TARGET(AVX2)
+const char16_t *qustrchr_avx2(const char16_t *n, const char16_t *e, char16_t c) noexcept
+{
+    const __m256i mch = _mm256_set1_epi16(short(c));
+    for ( ; e - n >= 16; n += 16) {
+        __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(n));
+        uint mask = uint(_mm256_movemask_epi8(_mm256_cmpeq_epi16(data, mch)));
+        if (mask)
+            return n + qCountTrailingZeroBits(mask) / 2;
+    }
+    while (n != e && *n != c)
+        ++n;
+    return n;
+}
+
+static QT_FUNCTION_TARGET(AVX2)
+qsizetype qustrcount_avx2(const char16_t *n, const char16_t *e, char16_t c) noexcept
+{
+    qsizetype num = 0;
+    const __m256i mch = _mm256_set1_epi16(short(c));
+    for ( ; e - n >= 16; n += 16) {
+        __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(n));
+        uint mask = uint(_mm256_movemask_epi8(_mm256_cmpeq_epi16(data, mch)));
+        num += qPopulationCount(mask) / 2;
+    }
+    for ( ; n != e; ++n)
+        num += (*n == c);
+    return num;
+}
+
+static QT_FUNCTION_TARGET(AVX2)
+qsizetype qFindStringFirstLast_avx2(const char16_t *h, qsizetype l, qsizetype from,
+                                    const char16_t *needle, qsizetype sl) noexcept
+{
+    // positions [from, l - sl] are candidates
+    const char16_t *p = h + from;
+    const char16_t *end = h + l - sl + 1;
+    const __m256i first = _mm256_set1_epi16(short(needle[0]));
+    const __m256i last = _mm256_set1_epi16(short(needle[sl - 1]));
+    const size_t middle = size_t(sl - 2) * sizeof(char16_t);
+    for ( ; end - p >= 16; p += 16) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + sl - 1));
+        __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi16(blockFirst, first),
+                                      _mm256_cmpeq_epi16(blockLast, last));
+        uint mask = uint(_mm256_movemask_epi8(eq));
+        while (mask) {
+            uint bit = qCountTrailingZeroBits(mask);
+            const char16_t *candidate = p + bit / 2;
+            if (memcmp(candidate + 1, needle + 1, middle) == 0)
+                return candidate - h;
+            mask &= ~(3u << bit);
+        }
+    }
+    for ( ; p < end; ++p) {
+        if (p[0] == needle[0] && p[sl - 1] == needle[sl - 1]
+                && memcmp(p + 1, needle + 1, middle) == 0)
+            return p - h;
+    }
+    return -1;
+}
+#endif // QT_STRING_DISPATCH_AVX2
+
+#ifdef QT_STRING_DISPATCH_AVX512
+static QT_FUNCTION_TARGET(AVX512BW)
+const char16_t *qustrchr_avx512(const char16_t *n, const char16_t *e, char16_t c) noexcept
+{
+    const __m512i mch = _mm512_set1_epi16(short(c));
+    for ( ; e - n >= 32; n += 32) {
+        __mmask32 mask = _mm512_cmpeq_epi16_mask(_mm512_loadu_si512(n), mch);
+        if (mask)
+            return n + qCountTrailingZeroBits(uint(mask));
+    }
+    if (n != e) {
+        // masked loads don't fault on the unselected characters
+        const __mmask32 valid = __mmask32((1u << (e - n)) - 1);
+        __m512i data = _mm512_maskz_loadu_epi16(valid, n);
+        __mmask32 mask = _mm512_mask_cmpeq_epi16_mask(valid, data, mch);
+        if (mask)
+            return n + qCountTrailingZeroBits(uint(mask));
+    }
+    return e;
+}
+
+static QT_FUNCTION_TARGET(AVX512BW)
+qsizetype qustrcount_avx512(const char16_t *n, const char16_t *e, char16_t c) noexcept
+{
+    qsizetype num = 0;
+    const __m512i mch = _mm512_set1_epi16(short(c));
+    for ( ; e - n >= 32; n += 32)
+        num += qPopulationCount(uint(_mm512_cmpeq_epi16_mask(_mm512_loadu_si512(n), mch)));
+    if (n != e) {
+        const __mmask32 valid = __mmask32((1u << (e - n)) - 1);
+        __m512i data = _mm512_maskz_loadu_epi16(valid, n);
+        num += qPopulationCount(uint(_mm512_mask_cmpeq_epi16_mask(valid, data, mch)));
+    }
+    return num;
+}
+
+static QT_FUNCTION_TARGET(AVX512BW)
+qsizetype qFindStringFirstLast_avx512(const char16_t *h, qsizetype l, qsizetype from,
+                                      const char16_t *needle, qsizetype sl) noexcept
+{
+    const char16_t *p = h + from;
+    const char16_t *end = h + l - sl + 1;
+    const __m512i first = _mm512_set1_epi16(short(needle[0]));
+    const __m512i last = _mm512_set1_epi16(short(needle[sl - 1]));
+    const size_t middle = size_t(sl - 2) * sizeof(char16_t);
+    while (p < end) {
+        const __mmask32 valid = end - p >= 32 ? __mmask32(~0u)
+                                              : __mmask32((1u << (end - p)) - 1);
+        __m512i blockFirst = _mm512_maskz_loadu_epi16(valid, p);
+        __m512i blockLast = _mm512_maskz_loadu_epi16(valid, p + sl - 1);
+        uint mask = _mm512_mask_cmpeq_epi16_mask(_mm512_mask_cmpeq_epi16_mask(valid, blockFirst, first),
+                                                 blockLast, last);
+        while (mask) {
+            uint idx = qCountTrailingZeroBits(mask);
+            if (memcmp(p + idx + 1, needle + 1, middle) == 0)
+                return p + idx - h;
+            mask &= mask - 1;
+        }
+        p += 32;
+    }
+    return -1;
+}
+#endif // QT_STRING_DISPATCH_AVX512
+
 /*!
  * \internal
  *
@@ -275,6 +416,15 @@ const char16_t *QtPrivate::qustrchr(QStringView str, char16_t c) noexcept
     const char16_t *n = str.utf16();
     const char16_t *e = n + str.size();
 
+#ifdef QT_STRING_DISPATCH_AVX512
+    if (e - n >= 32 && qCpuHasFeature(AVX512BW))
+        return qustrchr_avx512(n, e, c);
+#endif
+#if defined(QT_STRING_DISPATCH_AVX2) && !defined(__AVX2__)
+    if (e - n >= 16 && qCpuHasFeature(AVX2))
+        return qustrchr_avx2(n, e, c);
+#endif
+
 #ifdef __SSE2__
     bool loops = true;
     // Using the PMOVMSKB instruction, we get two bits for each character
@@ -9634,11 +9784,28 @@ bool QtPrivate::isRightToLeft(QStringView string) noexcept
     return false;
 }
 
+// Returns true if findString() uses a vectorized search, which is faster than
+// QStringMatcher's skip table for any length of needle.
+static inline bool hasVectorizedFindString(Qt::CaseSensitivity cs) noexcept
+{
+    if (cs != Qt::CaseSensitive)
+        return false;
+#ifdef QT_STRING_DISPATCH_AVX512
+    if (qCpuHasFeature(AVX512BW))
+        return true;
+#endif
+#ifdef QT_STRING_DISPATCH_AVX2
+    if (qCpuHasFeature(AVX2))
+        return true;
+#endif
+    return false;
+}
+
 qsizetype QtPrivate::count(QStringView haystack, QStringView needle, Qt::CaseSensitivity cs) noexcept
 {
     qsizetype num = 0;
     qsizetype i = -1;
-    if (haystack.size() > 500 && needle.size() > 5) {
+    if (haystack.size() > 500 && needle.size() > 5 && !hasVectorizedFindString(cs)) {
         QStringMatcher matcher(needle, cs);
         while ((i = matcher.indexIn(haystack, i + 1)) != -1)
             ++num;
@@ -9653,8 +9820,18 @@ qsizetype QtPrivate::count(QStringView haystack, QChar ch, Qt::CaseSensitivity c
 {
     qsizetype num = 0;
     if (cs == Qt::CaseSensitive) {
-        for (QChar c : haystack) {
-            if (c == ch)
+        const char16_t *n = haystack.utf16();
+        const char16_t *e = n + haystack.size();
+#ifdef QT_STRING_DISPATCH_AVX512
+        if (qCpuHasFeature(AVX512BW))
+            return qustrcount_avx512(n, e, ch.unicode());
+#endif
+#ifdef QT_STRING_DISPATCH_AVX2
+        if (qCpuHasFeature(AVX2))
+            return qustrcount_avx2(n, e, ch.unicode());
+#endif
+        for ( ; n != e; ++n) {
+            if (*n == ch.unicode())
                 ++num;
         }
     } else {
@@ -9895,6 +10072,17 @@ qsizetype QtPrivate::findString(QStringView haystack0, qsizetype from, QStringVi
     if (sl == 1)
         return qFindChar(haystack0, needle0[0], from, cs);
 
+    if (cs == Qt::CaseSensitive) {
+#ifdef QT_STRING_DISPATCH_AVX512
+        if (qCpuHasFeature(AVX512BW))
+            return qFindStringFirstLast_avx512(haystack0.utf16(), l, from, needle0.utf16(), sl);
+#endif
+#ifdef QT_STRING_DISPATCH_AVX2
+        if (qCpuHasFeature(AVX2))
+            return qFindStringFirstLast_avx2(haystack0.utf16(), l, from, needle0.utf16(), sl);
+#endif
+    }
+
     /*
         We use the Boyer-Moore algorithm in cases where the overhead
         for the skip table should pay off, otherwise we use a simple
@@ -474,6 +474,419 @@ static void simdCompareAscii(const char8_t *&, const char8_t *, const char16_t *
 }
 #endif
 
+/*
+ * Vectorized handling of non-ASCII UTF-8.
+ *
+ * simdValidateUtf8() implements the lookup algorithm by Keiser and Lemire
+ * ("Validating UTF-8 In Less Than One Instruction Per Byte"): for every
+ * pair of adjacent bytes, three 16-entry tables indexed by the high and low
+ * nibble of the first byte and the high nibble of the second byte each yield
+ * a set of possible errors, and the sequence is invalid if one error is in
+ * all three sets. Continuation bytes required by three- and four-byte
+ * sequences are checked separately by looking two and three bytes back.
+ *
+ * simdDecodeNonAscii() and simdEncodeNonAscii() transcode runs of text where
+ * every character has the same two- or three-byte encoding, such as
+ * Cyrillic, Greek or CJK, eight characters at a time. They only ever consume
+ * complete and valid sequences, so anything else, including an incomplete
+ * sequence at the end of a chunk, is left to the scalar code and its State
+ * handling.
+ */
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(SSSE3) && !defined(QT_BOOTSTRAPPED)
+#  define QT_UTF8_SIMD_SSSE3
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64) // vqtbl1q is only available on Aarch64
+#  define QT_UTF8_SIMD_NEON
+#endif
+
+#if defined(QT_UTF8_SIMD_SSSE3) || defined(QT_UTF8_SIMD_NEON)
+namespace {
+enum Utf8LookupError : uchar {
+    TooShort = 1 << 0,          // lead byte not followed by a continuation byte
+    TooLong = 1 << 1,           // ASCII followed by a continuation byte
+    Overlong3 = 1 << 2,         // 11100000 100xxxxx
+    TooLarge = 1 << 3,          // 11110100 1001xxxx, 11110100 101xxxxx, 11110101+
+    Surrogate = 1 << 4,         // 11101101 101xxxxx
+    Overlong2 = 1 << 5,         // 1100000x 10xxxxxx
+    TooLarge1000 = 1 << 6,      // 11110101+ 1000xxxx
+    Overlong4 = 1 << 6,         // 11110000 1000xxxx
+    TwoConts = 1 << 7,          // continuation byte following a continuation byte
+    Carry = TooShort | TooLong | TwoConts
+};
+
+alignas(16) const uchar utf8Byte1High[16] = {
+    // 0xxxxxxx: ASCII
+    TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+    // 10xxxxxx: continuation
+    TwoConts, TwoConts, TwoConts, TwoConts,
+    // 1100xxxx, 1101xxxx: two-byte lead
+    TooShort | Overlong2,
+    TooShort,
+    // 1110xxxx: three-byte lead
+    TooShort | Overlong3 | Surrogate,
+    // 1111xxxx: four-byte lead
+    TooShort | TooLarge | TooLarge1000 | Overlong4
+};
+
+alignas(16) const uchar utf8Byte1Low[16] = {
+    Carry | Overlong3 | Overlong2 | Overlong4,                  // xxxx0000
+    Carry | Overlong2,                                          // xxxx0001
+    Carry,                                                      // xxxx0010
+    Carry,                                                      // xxxx0011
+    Carry | TooLarge,                                           // xxxx0100
+    Carry | TooLarge | TooLarge1000,                            // xxxx0101
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,                            // xxxx1000
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000 | Surrogate,                // xxxx1101
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000
+};
+
+alignas(16) const uchar utf8Byte2High[16] = {
+    // 0xxxxxxx: ASCII
+    TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+    // 1000xxxx
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+    // 1001xxxx
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+    // 101xxxxx
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+    // 11xxxxxx: lead
+    TooShort, TooShort, TooShort, TooShort
+};
+
+// a block ending in one of these is incomplete
+alignas(16) const uchar utf8IncompleteLimits[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+};
+} // unnamed namespace
+#endif
+
+#if defined(QT_UTF8_SIMD_SSSE3)
+static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(SSSE3)
+__m128i utf8BlockErrors_ssse3(__m128i input, __m128i prev) noexcept
+{
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    __m128i byte1High = _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble);
+    __m128i byte1Low = _mm_and_si128(prev1, nibble);
+    __m128i byte2High = _mm_and_si128(_mm_srli_epi16(input, 4), nibble);
+    byte1High = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte1High)), byte1High);
+    byte1Low = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte1Low)), byte1Low);
+    byte2High = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte2High)), byte2High);
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+    // the high bit is set where a third or fourth byte is required
+    const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+    __m128i must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(char(0xe0 - 0x80))),
+                                  _mm_subs_epu8(prev3, _mm_set1_epi8(char(0xf0 - 0x80))));
+    must23 = _mm_and_si128(must23, _mm_set1_epi8(char(0x80)));
+    return _mm_xor_si128(must23, special);
+}
+
+static QT_FUNCTION_TARGET(SSSE3)
+bool validateUtf8_ssse3(const uchar *src, const uchar *end) noexcept
+{
+    const __m128i incompleteLimits = _mm_load_si128(reinterpret_cast<const __m128i *>(utf8IncompleteLimits));
+    __m128i prev = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+    for ( ; end - src >= 16; src += 16) {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        if (_mm_movemask_epi8(input) == 0) {
+            // all ASCII: only an unfinished sequence in the previous block is an error
+            error = _mm_or_si128(error, _mm_subs_epu8(prev, incompleteLimits));
+        } else {
+            error = _mm_or_si128(error, utf8BlockErrors_ssse3(input, prev));
+        }
+        prev = input;
+    }
+
+    if (src != end) {
+        alignas(16) uchar tail[16] = {};
+        memcpy(tail, src, end - src);
+        const __m128i input = _mm_load_si128(reinterpret_cast<const __m128i *>(tail));
+        error = _mm_or_si128(error, utf8BlockErrors_ssse3(input, prev));
+        prev = input;
+    }
+    error = _mm_or_si128(error, _mm_subs_epu8(prev, incompleteLimits));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xffff;
+}
+
+static QT_FUNCTION_TARGET(SSSE3)
+void decodeNonAscii_ssse3(ushort *&dst, const uchar *&src, const uchar *end) noexcept
+{
+    const __m128i byte0 = _mm_setr_epi8(0, -1, 3, -1, 6, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i byte1 = _mm_setr_epi8(1, -1, 4, -1, 7, -1, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i byte2 = _mm_setr_epi8(2, -1, 5, -1, 8, -1, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    while (end - src >= 16) {
+        if ((src[0] & 0xf0) == 0xe0 && end - src >= 28) {
+            // eight three-byte sequences are 24 bytes, four in each half
+            const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 12));
+            const __m128i lead = _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, byte0), _mm_shuffle_epi8(hi, byte0));
+            const __m128i cont1 = _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, byte1), _mm_shuffle_epi8(hi, byte1));
+            const __m128i cont2 = _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, byte2), _mm_shuffle_epi8(hi, byte2));
+
+            __m128i ok = _mm_cmpeq_epi16(_mm_and_si128(lead, _mm_set1_epi16(0xf0)), _mm_set1_epi16(0xe0));
+            ok = _mm_and_si128(ok, _mm_cmpeq_epi16(_mm_and_si128(cont1, _mm_set1_epi16(0xc0)), _mm_set1_epi16(0x80)));
+            ok = _mm_and_si128(ok, _mm_cmpeq_epi16(_mm_and_si128(cont2, _mm_set1_epi16(0xc0)), _mm_set1_epi16(0x80)));
+
+            const __m128i uc = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_and_si128(lead, _mm_set1_epi16(0x0f)), 12),
+                                                         _mm_slli_epi16(_mm_and_si128(cont1, _mm_set1_epi16(0x3f)), 6)),
+                                            _mm_and_si128(cont2, _mm_set1_epi16(0x3f)));
+
+            // reject overlong forms (below U+0800) and surrogates
+            const __m128i high = _mm_and_si128(uc, _mm_set1_epi16(short(0xf800)));
+            const __m128i bad = _mm_or_si128(_mm_cmpeq_epi16(high, _mm_setzero_si128()),
+                                             _mm_cmpeq_epi16(high, _mm_set1_epi16(short(0xd800))));
+            if (_mm_movemask_epi8(_mm_andnot_si128(bad, ok)) != 0xffff)
+                return;
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), uc);
+            src += 24;
+            dst += 8;
+        } else if ((src[0] & 0xe0) == 0xc0 && end - src >= 16) {
+            // eight two-byte sequences: the lead byte is the low half of each 16-bit lane
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            const __m128i lead = _mm_and_si128(data, _mm_set1_epi16(0xff));
+            const __m128i cont = _mm_srli_epi16(data, 8);
+
+            __m128i ok = _mm_cmpeq_epi16(_mm_and_si128(lead, _mm_set1_epi16(0xe0)), _mm_set1_epi16(0xc0));
+            ok = _mm_and_si128(ok, _mm_cmpeq_epi16(_mm_and_si128(cont, _mm_set1_epi16(0xc0)), _mm_set1_epi16(0x80)));
+
+            const __m128i uc = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(lead, _mm_set1_epi16(0x1f)), 6),
+                                            _mm_and_si128(cont, _mm_set1_epi16(0x3f)));
+
+            // reject overlong forms (below U+0080)
+            const __m128i bad = _mm_cmpeq_epi16(_mm_and_si128(uc, _mm_set1_epi16(0x780)), _mm_setzero_si128());
+            if (_mm_movemask_epi8(_mm_andnot_si128(bad, ok)) != 0xffff)
+                return;
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), uc);
+            src += 16;
+            dst += 8;
+        } else {
+            return;
+        }
+    }
+}
+
+static QT_FUNCTION_TARGET(SSSE3)
+void encodeNonAscii_ssse3(uchar *&dst, const ushort *&src, const ushort *end) noexcept
+{
+    // the three bytes of the characters come from p01 = { byte0[0..7], byte1[0..7] }
+    // and p2 = { byte2[0..7], ... }; the first 16 bytes of output merge two shuffles
+    const __m128i firstFrom01 = _mm_setr_epi8(0, 8, -1, 1, 9, -1, 2, 10, -1, 3, 11, -1, 4, 12, -1, 5);
+    const __m128i firstFrom2 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+    const __m128i lastFrom01 = _mm_setr_epi8(13, -1, 6, 14, -1, 7, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i lastFrom2 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    while (end - src >= 8) {
+        const __m128i uc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i high = _mm_and_si128(uc, _mm_set1_epi16(short(0xf800)));
+        if (src[0] >= 0x800) {
+            // three bytes each, except for surrogates
+            const __m128i bad = _mm_or_si128(_mm_cmpeq_epi16(high, _mm_setzero_si128()),
+                                             _mm_cmpeq_epi16(high, _mm_set1_epi16(short(0xd800))));
+            if (_mm_movemask_epi8(bad))
+                return;
+
+            const __m128i byte0 = _mm_or_si128(_mm_srli_epi16(uc, 12), _mm_set1_epi16(0xe0));
+            const __m128i byte1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(uc, 6), _mm_set1_epi16(0x3f)),
+                                               _mm_set1_epi16(0x80));
+            const __m128i byte2 = _mm_or_si128(_mm_and_si128(uc, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80));
+            const __m128i p01 = _mm_packus_epi16(byte0, byte1);
+            const __m128i p2 = _mm_packus_epi16(byte2, byte2);
+
+            const __m128i first = _mm_or_si128(_mm_shuffle_epi8(p01, firstFrom01), _mm_shuffle_epi8(p2, firstFrom2));
+            const __m128i last = _mm_or_si128(_mm_shuffle_epi8(p01, lastFrom01), _mm_shuffle_epi8(p2, lastFrom2));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), first);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + 16), last);
+            dst += 24;
+        } else if (src[0] >= 0x80) {
+            // two bytes each: U+0080 to U+07FF
+            const __m128i bad = _mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(uc, _mm_set1_epi16(0x780)), _mm_setzero_si128()),
+                                             _mm_xor_si128(_mm_cmpeq_epi16(high, _mm_setzero_si128()),
+                                                           _mm_set1_epi8(char(0xff))));
+            if (_mm_movemask_epi8(bad))
+                return;
+
+            const __m128i byte0 = _mm_or_si128(_mm_srli_epi16(uc, 6), _mm_set1_epi16(0xc0));
+            const __m128i byte1 = _mm_or_si128(_mm_and_si128(uc, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_or_si128(byte0, _mm_slli_epi16(byte1, 8)));
+            dst += 16;
+        } else {
+            return;
+        }
+        src += 8;
+    }
+}
+
+static inline bool simdValidateUtf8(bool &valid, const uchar *src, const uchar *end)
+{
+    if (!qCpuHasFeature(SSSE3))
+        return false;
+    valid = validateUtf8_ssse3(src, end);
+    return true;
+}
+
+static inline void simdDecodeNonAscii(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    if (end - src >= 16 && qCpuHasFeature(SSSE3))
+        decodeNonAscii_ssse3(dst, src, end);
+}
+
+static inline void simdEncodeNonAscii(uchar *&dst, const ushort *&src, const ushort *end)
+{
+    if (end - src >= 8 && qCpuHasFeature(SSSE3))
+        encodeNonAscii_ssse3(dst, src, end);
+}
+#elif defined(QT_UTF8_SIMD_NEON)
+static inline uint8x16_t utf8BlockErrors(uint8x16_t input, uint8x16_t prev)
+{
+    const uint8x16_t nibble = vdupq_n_u8(0x0f);
+    const uint8x16_t prev1 = vextq_u8(prev, input, 15);
+    const uint8x16_t byte1High = vqtbl1q_u8(vld1q_u8(utf8Byte1High), vshrq_n_u8(prev1, 4));
+    const uint8x16_t byte1Low = vqtbl1q_u8(vld1q_u8(utf8Byte1Low), vandq_u8(prev1, nibble));
+    const uint8x16_t byte2High = vqtbl1q_u8(vld1q_u8(utf8Byte2High), vshrq_n_u8(input, 4));
+    const uint8x16_t special = vandq_u8(vandq_u8(byte1High, byte1Low), byte2High);
+
+    // the high bit is set where a third or fourth byte is required
+    const uint8x16_t prev2 = vextq_u8(prev, input, 14);
+    const uint8x16_t prev3 = vextq_u8(prev, input, 13);
+    uint8x16_t must23 = vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xe0 - 0x80)),
+                                 vqsubq_u8(prev3, vdupq_n_u8(0xf0 - 0x80)));
+    must23 = vandq_u8(must23, vdupq_n_u8(0x80));
+    return veorq_u8(must23, special);
+}
+
+static inline bool simdValidateUtf8(bool &valid, const uchar *src, const uchar *end)
+{
+    const uint8x16_t incompleteLimits = vld1q_u8(utf8IncompleteLimits);
+    uint8x16_t prev = vdupq_n_u8(0);
+    uint8x16_t error = vdupq_n_u8(0);
+    for ( ; end - src >= 16; src += 16) {
+        const uint8x16_t input = vld1q_u8(src);
+        if (vmaxvq_u8(input) < 0x80) {
+            // all ASCII: only an unfinished sequence in the previous block is an error
+            error = vorrq_u8(error, vqsubq_u8(prev, incompleteLimits));
+        } else {
+            error = vorrq_u8(error, utf8BlockErrors(input, prev));
+        }
+        prev = input;
+    }
+
+    if (src != end) {
+        uchar tail[16] = {};
+        memcpy(tail, src, end - src);
+        const uint8x16_t input = vld1q_u8(tail);
+        error = vorrq_u8(error, utf8BlockErrors(input, prev));
+        prev = input;
+    }
+    error = vorrq_u8(error, vqsubq_u8(prev, incompleteLimits));
+    valid = vmaxvq_u8(error) == 0;
+    return true;
+}
+
+static inline void simdDecodeNonAscii(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    while (end - src >= 16) {
+        if ((src[0] & 0xf0) == 0xe0 && end - src >= 24) {
+            // eight three-byte sequences, de-interleaved by the load
+            const uint8x8x3_t in = vld3_u8(src);
+            uint8x8_t ok = vceq_u8(vand_u8(in.val[0], vdup_n_u8(0xf0)), vdup_n_u8(0xe0));
+            ok = vand_u8(ok, vceq_u8(vand_u8(in.val[1], vdup_n_u8(0xc0)), vdup_n_u8(0x80)));
+            ok = vand_u8(ok, vceq_u8(vand_u8(in.val[2], vdup_n_u8(0xc0)), vdup_n_u8(0x80)));
+
+            uint16x8_t uc = vshlq_n_u16(vmovl_u8(vand_u8(in.val[0], vdup_n_u8(0x0f))), 12);
+            uc = vorrq_u16(uc, vshlq_n_u16(vmovl_u8(vand_u8(in.val[1], vdup_n_u8(0x3f))), 6));
+            uc = vorrq_u16(uc, vmovl_u8(vand_u8(in.val[2], vdup_n_u8(0x3f))));
+
+            // reject overlong forms (below U+0800) and surrogates
+            const uint16x8_t high = vandq_u16(uc, vdupq_n_u16(0xf800));
+            const uint16x8_t bad = vorrq_u16(vceqq_u16(high, vdupq_n_u16(0)), vceqq_u16(high, vdupq_n_u16(0xd800)));
+            if (vminv_u8(ok) != 0xff || vmaxvq_u16(bad) != 0)
+                return;
+
+            vst1q_u16(dst, uc);
+            src += 24;
+        } else if ((src[0] & 0xe0) == 0xc0) {
+            const uint8x8x2_t in = vld2_u8(src);
+            uint8x8_t ok = vceq_u8(vand_u8(in.val[0], vdup_n_u8(0xe0)), vdup_n_u8(0xc0));
+            ok = vand_u8(ok, vceq_u8(vand_u8(in.val[1], vdup_n_u8(0xc0)), vdup_n_u8(0x80)));
+            // reject overlong forms (below U+0080)
+            ok = vand_u8(ok, vcgt_u8(vand_u8(in.val[0], vdup_n_u8(0x1f)), vdup_n_u8(1)));
+            if (vminv_u8(ok) != 0xff)
+                return;
+
+            uint16x8_t uc = vshlq_n_u16(vmovl_u8(vand_u8(in.val[0], vdup_n_u8(0x1f))), 6);
+            uc = vorrq_u16(uc, vmovl_u8(vand_u8(in.val[1], vdup_n_u8(0x3f))));
+            vst1q_u16(dst, uc);
+            src += 16;
+        } else {
+            return;
+        }
+        dst += 8;
+    }
+}
+
+static inline void simdEncodeNonAscii(uchar *&dst, const ushort *&src, const ushort *end)
+{
+    while (end - src >= 8) {
+        const uint16x8_t uc = vld1q_u16(src);
+        const uint16x8_t high = vandq_u16(uc, vdupq_n_u16(0xf800));
+        if (src[0] >= 0x800) {
+            // three bytes each, except for surrogates
+            const uint16x8_t bad = vorrq_u16(vceqq_u16(high, vdupq_n_u16(0)), vceqq_u16(high, vdupq_n_u16(0xd800)));
+            if (vmaxvq_u16(bad) != 0)
+                return;
+
+            uint8x8x3_t out;
+            out.val[0] = vorr_u8(vmovn_u16(vshrq_n_u16(uc, 12)), vdup_n_u8(0xe0));
+            out.val[1] = vorr_u8(vand_u8(vmovn_u16(vshrq_n_u16(uc, 6)), vdup_n_u8(0x3f)), vdup_n_u8(0x80));
+            out.val[2] = vorr_u8(vand_u8(vmovn_u16(uc), vdup_n_u8(0x3f)), vdup_n_u8(0x80));
+            vst3_u8(dst, out);
+            dst += 24;
+        } else if (src[0] >= 0x80) {
+            // two bytes each: U+0080 to U+07FF
+            const uint16x8_t bad = vorrq_u16(vceqq_u16(vandq_u16(uc, vdupq_n_u16(0x780)), vdupq_n_u16(0)),
+                                             vtstq_u16(high, high));
+            if (vmaxvq_u16(bad) != 0)
+                return;
+
+            uint8x8x2_t out;
+            out.val[0] = vorr_u8(vmovn_u16(vshrq_n_u16(uc, 6)), vdup_n_u8(0xc0));
+            out.val[1] = vorr_u8(vand_u8(vmovn_u16(uc), vdup_n_u8(0x3f)), vdup_n_u8(0x80));
+            vst2_u8(dst, out);
+            dst += 16;
+        } else {
+            return;
+        }
+        src += 8;
+    }
+}
+#else
+static inline bool simdValidateUtf8(bool &, const uchar *, const uchar *)
+{
+    return false;
+}
+
+static inline void simdDecodeNonAscii(ushort *&, const uchar *&, const uchar *)
+{
+}
+
+static inline void simdEncodeNonAscii(uchar *&, const ushort *&, const ushort *)
+{
+}
+#endif
+
 enum { HeaderDone = 1 };
 
 QByteArray QUtf8::convertFromUnicode(const QChar *uc, qsizetype len)
@@ -489,6 +902,10 @@ QByteArray QUtf8::convertFromUnicode(const QChar *uc, qsizetype len)
         if (simdEncodeAscii(dst, nextAscii, src, end))
             break;
 
+        simdEncodeNonAscii(dst, src, end);
+        if (src == end)
+            break;
+
         do {
             ushort u = *src++;
             int res = QUtf8Functions::toUtf8<QUtf8BaseTraits>(u, dst, src, end);
@@ -556,6 +973,10 @@ char *QUtf8::convertFromUnicode(char *out, QStringView in, QStringConverter::Sta
         if (simdEncodeAscii(cursor, nextAscii, src, end))
             break;
 
+        simdEncodeNonAscii(cursor, src, end);
+        if (src == end)
+            break;
+
         do {
             ushort uc = *src++;
             int res = QUtf8Functions::toUtf8<QUtf8BaseTraits>(uc, cursor, src, end);
@@ -642,6 +1063,10 @@ QChar *QUtf8::convertToUnicode(QChar *buffer, const char *chars, qsizetype len)
             if (simdDecodeAscii(dst, nextAscii, src, end))
                 break;
 
+            simdDecodeNonAscii(dst, src, end);
+            if (src == end)
+                break;
+
             do {
                 uchar b = *src++;
                 int res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, dst, src, end);
@@ -741,8 +1166,13 @@ QChar *QUtf8::convertToUnicode(QChar *out, const char *chars, qsizetype len, QSt
     res = 0;
     const uchar *nextAscii = src;
     while (res >= 0 && src < end) {
-        if (src >= nextAscii && simdDecodeAscii(dst, nextAscii, src, end))
-            break;
+        if (src >= nextAscii) {
+            if (simdDecodeAscii(dst, nextAscii, src, end))
+                break;
+            simdDecodeNonAscii(dst, src, end);
+            if (src == end)
+                break;
+        }
 
         ch = *src++;
         res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(ch, dst, src, end);
@@ -795,6 +1225,11 @@ QUtf8::ValidUtf8Result QUtf8::isValidUtf8(const char *chars, qsizetype len)
         if (src == end)
             break;
 
+        // everything before src is ASCII or complete sequences
+        bool valid;
+        if (*src >= 0x80 && simdValidateUtf8(valid, src, end))
+            return { valid, false };
+
         do {
             uchar b = *src++;
             if ((b & 0x80) == 0)
@@ -337,7 +337,7 @@ struct QUtf8
         bool isValidUtf8;
         bool isValidAscii;
     };
-    static ValidUtf8Result isValidUtf8(const char *, qsizetype);
+    Q_CORE_EXPORT static ValidUtf8Result isValidUtf8(const char *, qsizetype);
     static int compareUtf8(const char *, qsizetype, const QChar *, qsizetype) noexcept;
     static int compareUtf8(const char *, qsizetype, QLatin1String s);
 };
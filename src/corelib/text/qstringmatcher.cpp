@@ -39,6 +39,10 @@
 ****************************************************************************/
 
 #include "qstringmatcher.h"
+#include "qstringlist.h"
+#include "qahocorasick_p.h"
+
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -336,6 +340,286 @@ qsizetype QStringMatcher::indexIn(QStringView str, qsizetype from) const
     \sa setCaseSensitivity()
 */
 
+/*!
+    \internal
+
+    Returns the case-folded \a ch, a code unit of the string [\a start, \a end).
+    Surrogate pairs are folded as a whole, so that both halves of the result
+    are consistent.
+*/
+static inline char16_t foldCaseCodeUnit(const char16_t *ch, const char16_t *start,
+                                        const char16_t *end)
+{
+    if (QChar::isHighSurrogate(*ch) && ch + 1 < end && QChar::isLowSurrogate(ch[1]))
+        return QChar::highSurrogate(foldCase(ch + 1, ch));
+    if (QChar::isLowSurrogate(*ch) && ch > start && QChar::isHighSurrogate(ch[-1]))
+        return QChar::lowSurrogate(foldCase(ch, start));
+    return foldCase(*ch);
+}
+
+class QMultiStringMatcherPrivate : public QSharedData
+{
+public:
+    QMultiStringMatcherPrivate(const QStringList &patterns, Qt::CaseSensitivity cs)
+        : patterns(patterns),
+          foldedPatterns(cs == Qt::CaseSensitive ? patterns : foldedCopy(patterns)),
+          automaton(automatonPatterns(foldedPatterns))
+    {
+    }
+
+    static QStringList foldedCopy(const QStringList &patterns)
+    {
+        QStringList result;
+        result.reserve(patterns.size());
+        for (const QString &pattern : patterns) {
+            QString folded(pattern.size(), Qt::Uninitialized);
+            const char16_t *begin = QStringView(pattern).utf16();
+            const char16_t *end = begin + pattern.size();
+            char16_t *out = reinterpret_cast<char16_t *>(folded.data());
+            for (const char16_t *ch = begin; ch != end; ++ch)
+                *out++ = foldCaseCodeUnit(ch, begin, end);
+            result.append(std::move(folded));
+        }
+        return result;
+    }
+
+    static QList<QAhoCorasickAutomaton<char16_t>::Pattern>
+    automatonPatterns(const QStringList &patterns)
+    {
+        QList<QAhoCorasickAutomaton<char16_t>::Pattern> result;
+        result.reserve(patterns.size());
+        for (const QString &pattern : patterns)
+            result.append({ QStringView(pattern).utf16(), pattern.size() });
+        return result;
+    }
+
+    template <typename F>
+    void withFold(QStringView str, Qt::CaseSensitivity cs, F f) const
+    {
+        const char16_t *begin = str.utf16();
+        const char16_t *end = begin + str.size();
+        if (cs == Qt::CaseSensitive)
+            f([](const char16_t *ch) { return *ch; });
+        else
+            f([begin, end](const char16_t *ch) { return foldCaseCodeUnit(ch, begin, end); });
+    }
+
+    const QStringList patterns;
+    // the automaton refers to these
+    const QStringList foldedPatterns;
+    const QAhoCorasickAutomaton<char16_t> automaton;
+};
+
+/*!
+    \class QMultiStringMatcher
+    \since 6.0
+    \inmodule QtCore
+    \brief The QMultiStringMatcher class holds a set of character sequences
+    that can be quickly matched, all at once, in a Unicode string.
+
+    \ingroup tools
+    \ingroup string-processing
+    \reentrant
+
+    This class is useful when you want to search strings for any of a
+    (possibly large) number of patterns, for instance to find out whether
+    a message contains any keyword from a list. Instead of searching for
+    each pattern in turn, as a list of QStringMatcher objects would,
+    QMultiStringMatcher builds an automaton (following the Aho-Corasick
+    algorithm) out of all the patterns when it is constructed, and then
+    finds the occurrences of all of them in a single pass over the string.
+    The cost of a search therefore depends on the length of the string and
+    on the number of occurrences, but not on the number of patterns.
+
+    Create the QMultiStringMatcher with the list of patterns you want to
+    search for. Then call indexIn() to find the leftmost occurrence of any
+    pattern, or findAll() to find all of them.
+
+    When matching case-insensitively, the patterns and the strings are
+    compared after simple (one to one) case folding of each character.
+
+    Empty patterns never match. Building the automaton takes time and
+    memory proportional to the total length of the patterns, so the
+    matcher only offers a benefit if it is reused for many searches.
+    Copies of a QMultiStringMatcher share the automaton.
+
+    \sa QStringMatcher, QMultiByteArrayMatcher
+*/
+
+/*!
+    \class QMultiStringMatcher::Match
+    \inmodule QtCore
+    \brief The Match struct describes an occurrence of a pattern.
+
+    \variable QMultiStringMatcher::Match::position
+    The position of the first character of the occurrence.
+
+    \variable QMultiStringMatcher::Match::length
+    The length of the occurrence, i.e. of the pattern.
+
+    \variable QMultiStringMatcher::Match::patternIndex
+    The index of the pattern in patterns().
+*/
+
+/*!
+    Constructs a matcher without patterns, that won't match anything.
+    Call setPatterns() to give it patterns to match.
+*/
+QMultiStringMatcher::QMultiStringMatcher()
+    = default;
+
+/*!
+    Constructs a matcher that will search for any of the \a patterns, with
+    case sensitivity \a cs.
+
+    Call indexIn() or findAll() to perform a search.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QStringList &patterns, Qt::CaseSensitivity cs)
+    : d(new QMultiStringMatcherPrivate(patterns, cs)), q_cs(cs)
+{
+}
+
+/*!
+    Constructs a copy of \a other. The two matchers share the automaton.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QMultiStringMatcher &other)
+    = default;
+
+/*!
+    Move-constructs a matcher from \a other. \a other is left without patterns.
+*/
+QMultiStringMatcher::QMultiStringMatcher(QMultiStringMatcher &&other) noexcept
+    = default;
+
+/*!
+    Destroys the matcher.
+*/
+QMultiStringMatcher::~QMultiStringMatcher()
+    = default;
+
+/*!
+    Assigns \a other to this matcher, and returns a reference to this matcher.
+*/
+QMultiStringMatcher &QMultiStringMatcher::operator=(const QMultiStringMatcher &other)
+    = default;
+
+/*!
+    \fn QMultiStringMatcher &QMultiStringMatcher::operator=(QMultiStringMatcher &&other)
+
+    Move-assigns \a other to this matcher, and returns a reference to this matcher.
+*/
+
+/*!
+    \fn void QMultiStringMatcher::swap(QMultiStringMatcher &other)
+
+    Swaps this matcher with \a other. This operation is very fast and never fails.
+*/
+
+/*!
+    Sets the patterns that this matcher will search for to \a patterns,
+    rebuilding the automaton.
+
+    \sa patterns(), setCaseSensitivity()
+*/
+void QMultiStringMatcher::setPatterns(const QStringList &patterns)
+{
+    d = new QMultiStringMatcherPrivate(patterns, q_cs);
+}
+
+/*!
+    Returns the patterns that this matcher searches for.
+
+    \sa setPatterns()
+*/
+QStringList QMultiStringMatcher::patterns() const
+{
+    return d ? d->patterns : QStringList();
+}
+
+/*!
+    Sets the case sensitivity of this matcher to \a cs, rebuilding the
+    automaton if needed.
+
+    \sa caseSensitivity(), setPatterns()
+*/
+void QMultiStringMatcher::setCaseSensitivity(Qt::CaseSensitivity cs)
+{
+    if (cs == q_cs)
+        return;
+    q_cs = cs;
+    if (d)
+        d = new QMultiStringMatcherPrivate(d->patterns, q_cs);
+}
+
+/*!
+    \fn Qt::CaseSensitivity QMultiStringMatcher::caseSensitivity() const
+
+    Returns the case sensitivity setting for this matcher.
+
+    \sa setCaseSensitivity()
+*/
+
+/*!
+    Searches the string \a str from character position \a from (default 0,
+    i.e. from the first character) for any of the patterns(). Returns the
+    position of the leftmost occurrence, or -1 if none of the patterns
+    occurs. If \a patternIndex is not \nullptr, the index in patterns() of
+    the pattern found is stored there; if several patterns occur at the
+    same position, it is the lowest of their indexes.
+
+    This gives the same result as calling QStringMatcher::indexIn() for
+    every pattern, and keeping the smallest position, but only needs one
+    pass over \a str.
+
+    \sa findAll()
+*/
+qsizetype QMultiStringMatcher::indexIn(QStringView str, qsizetype from,
+                                       qsizetype *patternIndex) const
+{
+    if (patternIndex)
+        *patternIndex = -1;
+    if (from < 0)
+        from = 0;
+    if (!d || d->automaton.isEmpty())
+        return -1;
+    QAhoCorasickAutomaton<char16_t>::Hit hit;
+    d->withFold(str, q_cs, [&](auto fold) {
+        hit = d->automaton.findFirst(str.utf16(), str.size(), from, fold);
+    });
+    if (patternIndex)
+        *patternIndex = hit.patternIndex;
+    return hit.position;
+}
+
+/*!
+    Searches the string \a str from character position \a from (default 0,
+    i.e. from the first character) for all the occurrences of all the
+    patterns(), in a single pass, and returns them sorted by position;
+    occurrences at the same position are sorted by pattern index.
+    Occurrences may overlap.
+
+    \sa indexIn()
+*/
+QList<QMultiStringMatcher::Match> QMultiStringMatcher::findAll(QStringView str,
+                                                               qsizetype from) const
+{
+    QList<Match> matches;
+    if (from < 0)
+        from = 0;
+    if (!d || d->automaton.isEmpty())
+        return matches;
+    d->withFold(str, q_cs, [&](auto fold) {
+        d->automaton.findAll(str.utf16(), str.size(), from, fold, [&matches](const auto &hit) {
+            matches.append({ hit.position, hit.length, hit.patternIndex });
+        });
+    });
+    std::sort(matches.begin(), matches.end(), [](const Match &lhs, const Match &rhs) {
+        return lhs.position < rhs.position
+                || (lhs.position == rhs.position && lhs.patternIndex < rhs.patternIndex);
+    });
+    return matches;
+}
+
 /*!
     \internal
 */
@@ -43,6 +43,8 @@
 
 #include <QtCore/qstring.h>
 #include <QtCore/qstringview.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -88,6 +90,50 @@ private:
     };
 };
 
+class QStringList;
+class QMultiStringMatcherPrivate;
+
+class Q_CORE_EXPORT QMultiStringMatcher
+{
+public:
+    struct Match {
+        qsizetype position;
+        qsizetype length;
+        qsizetype patternIndex;
+    };
+
+    QMultiStringMatcher();
+    explicit QMultiStringMatcher(const QStringList &patterns,
+                                 Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    QMultiStringMatcher(const QMultiStringMatcher &other);
+    QMultiStringMatcher(QMultiStringMatcher &&other) noexcept;
+    ~QMultiStringMatcher();
+
+    QMultiStringMatcher &operator=(const QMultiStringMatcher &other);
+    QMultiStringMatcher &operator=(QMultiStringMatcher &&other) noexcept
+    { swap(other); return *this; }
+
+    void swap(QMultiStringMatcher &other) noexcept
+    {
+        d.swap(other.d);
+        qSwap(q_cs, other.q_cs);
+    }
+
+    void setPatterns(const QStringList &patterns);
+    QStringList patterns() const;
+    void setCaseSensitivity(Qt::CaseSensitivity cs);
+    inline Qt::CaseSensitivity caseSensitivity() const { return q_cs; }
+
+    qsizetype indexIn(QStringView str, qsizetype from = 0, qsizetype *patternIndex = nullptr) const;
+    QList<Match> findAll(QStringView str, qsizetype from = 0) const;
+
+private:
+    QSharedDataPointer<QMultiStringMatcherPrivate> d;
+    Qt::CaseSensitivity q_cs = Qt::CaseSensitive;
+};
+
+Q_DECLARE_SHARED(QMultiStringMatcher)
+
 QT_END_NAMESPACE
 
 #endif // QSTRINGMATCHER_H
@@ -107,6 +107,26 @@ QT_BEGIN_NAMESPACE
                           [] (auto token) { use(token); });
     \endcode
 
+    With C++20, QStringTokenizer is a forward range. It can therefore also
+    be combined with the range adaptors of the standard library, which
+    transform, filter or truncate the sequence of tokens while it is
+    iterated, without ever storing the tokens in a container:
+
+    \code
+    auto fieldSizes = QStringTokenizer{line, u','}
+                    | std::views::filter([] (QStringView field) { return !field.isEmpty(); })
+                    | std::views::transform([] (QStringView field) { return field.size(); })
+                    | std::views::take(3);
+    for (qsizetype size : fieldSizes)
+        use(size);
+    \endcode
+
+    A QStringTokenizer that stores neither its string nor its separator (see
+    \l{Temporaries}) is cheap to copy and is a \c{std::ranges::view}.
+
+    To split very long strings using several threads, see
+    QtConcurrent::tokenize().
+
     \section1 End Sentinel
 
     The QStringTokenizer iterators cannot be used with classical STL
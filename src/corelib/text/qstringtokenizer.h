@@ -42,6 +42,10 @@
 #include <QtCore/qnamespace.h>
 #include <QtCore/qcontainerfwd.h>
 
+#if defined(__cpp_concepts) && __has_include(<ranges>)
+#  include <ranges>
+#endif
+
 QT_BEGIN_NAMESPACE
 
 template <typename, typename> class QStringBuilder;
@@ -94,8 +98,8 @@ public:
     using sentinel = iterator;
 #endif
     class iterator {
-        const QStringTokenizerBase *tokenizer;
-        next_result current;
+        const QStringTokenizerBase *tokenizer = nullptr;
+        next_result current = {};
         friend class QStringTokenizerBase;
         explicit iterator(const QStringTokenizerBase &t) noexcept
             : tokenizer{&t}, current{t.toFront()} {}
@@ -394,6 +398,21 @@ QStringTokenizer(Haystack&&, Needle&&, Qt::CaseSensitivity, Qt::SplitBehavior)
 
 #undef Q_TOK_RESULT
 
+QT_END_NAMESPACE
+
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+// A QStringTokenizer that doesn't own its haystack or needle is cheap to
+// copy, so it can be a view that the standard range adaptors store by value.
+namespace std::ranges {
+template <typename Haystack, typename Needle>
+inline constexpr bool enable_view<QT_PREPEND_NAMESPACE(QStringTokenizer)<Haystack, Needle>> =
+        !QT_PREPEND_NAMESPACE(QtPrivate)::Tok::is_owning_string_type<Haystack>::value
+        && !QT_PREPEND_NAMESPACE(QtPrivate)::Tok::is_owning_string_type<Needle>::value;
+} // namespace std::ranges
+#endif
+
+QT_BEGIN_NAMESPACE
+
 template <typename Haystack, typename Needle, typename...Flags>
 Q_REQUIRED_RESULT constexpr auto
 qTokenize(Haystack &&h, Needle &&n, Flags...flags)
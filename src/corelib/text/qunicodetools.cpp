@@ -723,6 +723,30 @@ static void getWhiteSpaces(const ushort *string, quint32 len, QCharAttributes *a
     }
 }
 
+// For pure ASCII text, which is by far the most common case, the grapheme
+// and white space attributes can be computed in one pass and without any
+// property lookups: the only grapheme cluster spanning two ASCII characters
+// is CR LF (GB3), everything else is separated by GB4, GB5 or GB999.
+static void getAsciiGraphemeBreaksAndWhiteSpaces(const ushort *string, quint32 len,
+                                                 QCharAttributes *attributes,
+                                                 CharAttributeOptions options)
+{
+    const bool graphemeBreaks = options & GraphemeBreaks;
+    const bool whiteSpaces = options & WhiteSpaces;
+    ushort last = 0;
+    for (quint32 i = 0; i != len; ++i) {
+        const ushort uc = string[i];
+        if (graphemeBreaks && !(uc == '\n' && last == '\r'))
+            attributes[i].graphemeBoundary = true;
+        if (whiteSpaces && QChar::isSpace(uc))
+            attributes[i].whiteSpace = true;
+        last = uc;
+    }
+
+    if (graphemeBreaks)
+        attributes[len].graphemeBoundary = true; // GB2
+}
+
 namespace Tailored {
 
 using CharAttributeFunction = void (*)(QChar::Script script, const ushort *text, uint from, uint len, QCharAttributes *attributes);
@@ -2221,7 +2245,12 @@ Q_CORE_EXPORT void initCharAttributes(const ushort *string, int length,
     if (!(options & DontClearAttributes))
         ::memset(attributes, 0, (length + 1) * sizeof(QCharAttributes));
 
-    if (options & GraphemeBreaks)
+    const bool ascii = (options & (GraphemeBreaks | WhiteSpaces))
+            && QtPrivate::isAscii(QStringView(reinterpret_cast<const QChar *>(string), length));
+    if (ascii)
+        getAsciiGraphemeBreaksAndWhiteSpaces(string, length, attributes, options);
+
+    if ((options & GraphemeBreaks) && !ascii)
         getGraphemeBreaks(string, length, attributes);
     if (options & WordBreaks)
         getWordBreaks(string, length, attributes);
@@ -2229,7 +2258,7 @@ Q_CORE_EXPORT void initCharAttributes(const ushort *string, int length,
         getSentenceBreaks(string, length, attributes);
     if (options & LineBreaks)
         getLineBreaks(string, length, attributes, options);
-    if (options & WhiteSpaces)
+    if ((options & WhiteSpaces) && !ascii)
         getWhiteSpaces(string, length, attributes);
 
     if (!qt_initcharattributes_default_algorithm_only) {
@@ -1,6 +1,7 @@
 # Qt text / string / character / unicode / byte array module
 
 HEADERS +=  \
+        text/qahocorasick_p.h \
         text/qbytearray.h \
         text/qbytearray_p.h \
         text/qbytearrayalgorithms.h \
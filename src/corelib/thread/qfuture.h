@@ -50,6 +50,16 @@
 #include <type_traits>
 #include <vector>
 
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#  if __has_include(<coroutine>)
+#    include <coroutine>
+#    include <memory>
+#    include <QtCore/qobject.h>
+#    include <QtCore/qpointer.h>
+#    define Q_FUTURE_COROUTINES 1
+#  endif
+#endif
+
 QT_REQUIRE_CONFIG(future);
 
 QT_BEGIN_NAMESPACE
@@ -312,6 +322,9 @@ private:
     friend class QtPrivate::FailureHandler;
 #endif
 
+    template<class U>
+    friend class QtPrivate::FutureAwaiter;
+
     using QFuturePrivate =
             std::conditional_t<std::is_same_v<T, void>, QFutureInterfaceBase, QFutureInterface<T>>;
 
@@ -407,6 +420,155 @@ QFuture<void> qToVoidFuture(const QFuture<T> &future)
 
 Q_DECLARE_SEQUENTIAL_ITERATOR(Future)
 
+#ifdef Q_FUTURE_COROUTINES
+
+namespace QtPrivate {
+
+// Owns a suspended coroutine until it is resumed, and destroys it if that
+// never happens, so that its frame and locals don't leak
+class CoroutineResumer
+{
+public:
+    explicit CoroutineResumer(std::coroutine_handle<> h) : handle(h) {}
+    ~CoroutineResumer()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+    void resume() { std::exchange(handle, nullptr).resume(); }
+
+private:
+    Q_DISABLE_COPY_MOVE(CoroutineResumer)
+    std::coroutine_handle<> handle;
+};
+
+template<class T>
+class FutureAwaiter
+{
+public:
+    explicit FutureAwaiter(QFuture<T> f, QObject *c = nullptr)
+        : future(std::move(f)), context(c)
+    {
+    }
+
+    bool await_ready() const { return !context && future.isFinished(); }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // Don't touch *this after setContinuation(): if the future is
+        // already finished, the coroutine is resumed from inside the call.
+        if (context) {
+            // The queued call takes over the coroutine; if the context is
+            // gone, or goes before the call is delivered, it is destroyed.
+            auto resumer = std::make_shared<CoroutineResumer>(handle);
+            QPointer<QObject> guard(context);
+            future.d.setContinuation([resumer, guard]() mutable {
+                auto owner = std::move(resumer);
+                if (guard)
+                    QMetaObject::invokeMethod(guard, [owner]() { owner->resume(); },
+                                              Qt::QueuedConnection);
+            });
+        } else {
+            future.d.setContinuation([handle]() { handle.resume(); });
+        }
+    }
+
+    T await_resume()
+    {
+        if constexpr (std::is_void_v<T>)
+            future.waitForFinished();
+        else if constexpr (std::is_copy_constructible_v<T>)
+            return future.result();
+        else
+            return future.takeResult();
+    }
+
+private:
+    QFuture<T> future;
+    QObject *context;
+};
+
+template<class T>
+class FutureCoroutinePromiseBase
+{
+public:
+    QFuture<T> get_return_object()
+    {
+        promise.reportStarted();
+        return promise.future();
+    }
+    ~FutureCoroutinePromiseBase()
+    {
+        // Destroyed without reaching co_return: the coroutine was abandoned
+        if (!promise.isFinished()) {
+            promise.reportCanceled();
+            promise.reportFinished();
+        }
+    }
+
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception()
+    {
+#ifndef QT_NO_EXCEPTIONS
+        promise.reportException(std::current_exception());
+#endif
+        promise.reportFinished();
+    }
+
+protected:
+    QFutureInterface<T> promise;
+};
+
+template<class T>
+class FutureCoroutinePromise : public FutureCoroutinePromiseBase<T>
+{
+public:
+    void return_value(T value)
+    {
+        this->promise.reportAndMoveResult(std::move(value));
+        this->promise.reportFinished();
+    }
+};
+
+template<>
+class FutureCoroutinePromise<void> : public FutureCoroutinePromiseBase<void>
+{
+public:
+    void return_void() { promise.reportFinished(); }
+};
+
+} // namespace QtPrivate
+
+template<class T>
+QtPrivate::FutureAwaiter<T> operator co_await(QFuture<T> future)
+{
+    return QtPrivate::FutureAwaiter<T>(std::move(future));
+}
+
+namespace QtFuture {
+
+template<class T>
+QtPrivate::FutureAwaiter<T> resumeOn(QObject *context, QFuture<T> future)
+{
+    return QtPrivate::FutureAwaiter<T>(std::move(future), context);
+}
+
+} // namespace QtFuture
+
+#endif // Q_FUTURE_COROUTINES
+
 QT_END_NAMESPACE
 
+#ifdef Q_FUTURE_COROUTINES
+// QFuture<T> can be used as the return type of a coroutine
+template<class T, class... Args>
+struct std::coroutine_traits<QT_PREPEND_NAMESPACE(QFuture)<T>, Args...>
+{
+    using promise_type = QT_PREPEND_NAMESPACE(QtPrivate)::FutureCoroutinePromise<T>;
+};
+#endif
+
 #endif // QFUTURE_H
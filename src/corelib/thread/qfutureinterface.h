@@ -71,6 +71,9 @@ class CanceledHandler;
 template<class Function, class ResultType>
 class FailureHandler;
 #endif
+
+template<class T>
+class FutureAwaiter;
 }
 
 class Q_CORE_EXPORT QFutureInterfaceBase
@@ -191,6 +194,9 @@ private:
     friend class QtPrivate::FailureHandler;
 #endif
 
+    template<class T>
+    friend class QtPrivate::FutureAwaiter;
+
 protected:
     void setContinuation(std::function<void()> func);
     void runContinuation() const;
@@ -49,6 +49,9 @@
 #include "qelapsedtimer.h"
 #include "private/qfreelist_p.h"
 #include "private/qlocking_p.h"
+#include <qtcore_tracepoints_p.h>
+
+#include <atomic>
 
 QT_BEGIN_NAMESPACE
 
@@ -62,6 +65,14 @@ QT_BEGIN_NAMESPACE
  *    are waiting, and the lock is not recursive.
  *  - when d_ptr == 0x2: We are locked for write and nobody is waiting. (no contention)
  *  - In any other case, d_ptr points to an actual QReadWriteLockPrivate.
+ *
+ * A lock constructed with DistributedReaders always points to a
+ * QReadWriteLockPrivate with readerCounters set. Readers then only increment
+ * the counter assigned to their thread and check writerState, so they never
+ * write to a cache line shared with the other readers. A writer announces
+ * itself by setting writerState to WriterWaiting, which makes new readers back
+ * off, and waits until the sum of all counters drops to zero before it takes
+ * the lock. This makes the lock writer-preferring.
  */
 
 namespace {
@@ -74,6 +85,8 @@ const auto dummyLockedForRead = reinterpret_cast<QReadWriteLockPrivate *>(quintp
 const auto dummyLockedForWrite = reinterpret_cast<QReadWriteLockPrivate *>(quintptr(StateLockedForWrite));
 inline bool isUncontendedLocked(const QReadWriteLockPrivate *d)
 { return quintptr(d) & StateMask; }
+inline bool isDistributed(const QReadWriteLockPrivate *d)
+{ return d && !isUncontendedLocked(d) && d->readerCounters; }
 }
 
 /*! \class QReadWriteLock
@@ -132,6 +145,24 @@ inline bool isUncontendedLocked(const QReadWriteLockPrivate *d)
     \sa QReadWriteLock()
 */
 
+/*!
+    \enum QReadWriteLock::ReaderMode
+    \since 6.0
+
+    \value SharedReaders All readers update a single shared counter. This
+    is the cheapest mode for locks that are rarely locked by several threads
+    at the same time.
+
+    \value DistributedReaders Readers update one of several counters,
+    chosen by their thread, so that concurrent readers do not contend on
+    the same cache line. Use this for read-mostly locks that are locked by
+    many threads at once. Locking for write is more expensive in this mode,
+    and a writer that is waiting for the lock prevents new readers from
+    acquiring it.
+
+    \sa QReadWriteLock()
+*/
+
 /*!
     \since 4.4
 
@@ -147,6 +178,27 @@ QReadWriteLock::QReadWriteLock(RecursionMode recursionMode)
     Q_ASSERT_X(!(quintptr(d_ptr.loadRelaxed()) & StateMask), "QReadWriteLock::QReadWriteLock", "bad d_ptr alignment");
 }
 
+/*!
+    \since 6.0
+
+    Constructs a QReadWriteLock object in the given \a recursionMode,
+    counting readers as specified by \a readerMode.
+
+    DistributedReaders is not supported for recursive locks, and is
+    ignored if \a recursionMode is Recursive.
+
+    \sa ReaderMode
+*/
+QReadWriteLock::QReadWriteLock(RecursionMode recursionMode, ReaderMode readerMode)
+    : QReadWriteLock(recursionMode)
+{
+    if (recursionMode == NonRecursive && readerMode == DistributedReaders) {
+        auto d = new QReadWriteLockPrivate;
+        d->readerCounters = new QReadWriteLockReaderCounters;
+        d_ptr.storeRelaxed(d);
+    }
+}
+
 /*!
     Destroys the QReadWriteLock object.
 
@@ -174,6 +226,11 @@ QReadWriteLock::~QReadWriteLock()
 */
 void QReadWriteLock::lockForRead()
 {
+    QReadWriteLockPrivate *d = d_ptr.loadRelaxed();
+    if (Q_UNLIKELY(isDistributed(d))) {
+        d->distributedLockForRead(-1);
+        return;
+    }
     if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForRead))
         return;
     tryLockForRead(-1);
@@ -221,8 +278,11 @@ bool QReadWriteLock::tryLockForRead()
 */
 bool QReadWriteLock::tryLockForRead(int timeout)
 {
+    QReadWriteLockPrivate *d = d_ptr.loadRelaxed();
+    if (Q_UNLIKELY(isDistributed(d)))
+        return d->distributedLockForRead(timeout);
+
     // Fast case: non contended:
-    QReadWriteLockPrivate *d;
     if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForRead, d))
         return true;
 
@@ -335,8 +395,11 @@ bool QReadWriteLock::tryLockForWrite()
 */
 bool QReadWriteLock::tryLockForWrite(int timeout)
 {
+    QReadWriteLockPrivate *d = d_ptr.loadRelaxed();
+    if (Q_UNLIKELY(isDistributed(d)))
+        return d->distributedLockForWrite(timeout);
+
     // Fast case: non contended:
-    QReadWriteLockPrivate *d;
     if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForWrite, d))
         return true;
 
@@ -393,6 +456,10 @@ bool QReadWriteLock::tryLockForWrite(int timeout)
 void QReadWriteLock::unlock()
 {
     QReadWriteLockPrivate *d = d_ptr.loadAcquire();
+    if (isDistributed(d)) {
+        d->distributedUnlock();
+        return;
+    }
     while (true) {
         Q_ASSERT_X(d, "QReadWriteLock::unlock()", "Cannot unlock an unlocked lock");
 
@@ -453,6 +520,11 @@ QReadWriteLock::StateForWaitCondition QReadWriteLock::stateForWaitCondition() co
 
     if (!d)
         return Unlocked;
+    if (d->readerCounters) {
+        if (d->writerState.loadRelaxed() == QReadWriteLockPrivate::WriterLocked)
+            return LockedForWrite;
+        return d->distributedReaderCount() ? LockedForRead : Unlocked;
+    }
     if (d->writerCount > 1)
         return RecursivelyLocked;
     else if (d->writerCount == 1)
@@ -469,6 +541,10 @@ bool QReadWriteLockPrivate::lockForRead(int timeout)
     if (timeout > 0)
         t.start();
 
+    QElapsedTimer contentionTimer;
+    if (Q_TRACE_ENABLED(QReadWriteLock_lock_contended) && (waitingWriters || writerCount))
+        contentionTimer.start();
+
     while (waitingWriters || writerCount) {
         if (timeout == 0)
             return false;
@@ -486,6 +562,9 @@ bool QReadWriteLockPrivate::lockForRead(int timeout)
     }
     readerCount++;
     Q_ASSERT(writerCount == 0);
+    if (contentionTimer.isValid()) {
+        Q_TRACE(QReadWriteLock_lock_contended, this, false, contentionTimer.nsecsElapsed());
+    }
     return true;
 }
 
@@ -497,6 +576,10 @@ bool QReadWriteLockPrivate::lockForWrite(int timeout)
     if (timeout > 0)
         t.start();
 
+    QElapsedTimer contentionTimer;
+    if (Q_TRACE_ENABLED(QReadWriteLock_lock_contended) && (readerCount || writerCount))
+        contentionTimer.start();
+
     while (readerCount || writerCount) {
         if (timeout == 0)
             return false;
@@ -522,6 +605,9 @@ bool QReadWriteLockPrivate::lockForWrite(int timeout)
     Q_ASSERT(writerCount == 0);
     Q_ASSERT(readerCount == 0);
     writerCount = 1;
+    if (contentionTimer.isValid()) {
+        Q_TRACE(QReadWriteLock_lock_contended, this, true, contentionTimer.nsecsElapsed());
+    }
     return true;
 }
 
@@ -600,6 +686,141 @@ void QReadWriteLockPrivate::recursiveUnlock()
     unlock();
 }
 
+static QReadWriteLockReaderCounters::Counter &readerCounter(QReadWriteLockReaderCounters *counters)
+{
+    static QBasicAtomicInt nextIndex = Q_BASIC_ATOMIC_INITIALIZER(0);
+    static thread_local const int index =
+            nextIndex.fetchAndAddRelaxed(1) % QReadWriteLockReaderCounters::Count;
+    return counters->counters[index];
+}
+
+int QReadWriteLockPrivate::distributedReaderCount() const
+{
+    // a thread may unlock using another counter than the one it locked
+    // with, only the sum is meaningful
+    int count = 0;
+    for (const auto &counter : readerCounters->counters)
+        count += counter.readers.loadAcquire();
+    return count;
+}
+
+bool QReadWriteLockPrivate::distributedLockForRead(int timeout)
+{
+    Q_ASSERT(readerCounters);
+    QReadWriteLockReaderCounters::Counter &counter = readerCounter(readerCounters);
+
+    QElapsedTimer t;
+    if (timeout > 0)
+        t.start();
+
+    while (true) {
+        counter.readers.ref();
+        // pairs with the fence in distributedLockForWrite(): either the writer
+        // sees our counter, or we see its state
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (writerState.loadAcquire() == NoWriter)
+            return true;
+
+        // a writer is waiting for the readers to leave, or holds the lock
+        counter.readers.deref();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto lock = qt_unique_lock(mutex);
+        writerCond.wakeAll();
+        while (writerState.loadRelaxed() != NoWriter) {
+            if (timeout == 0)
+                return false;
+            if (timeout > 0) {
+                auto elapsed = t.elapsed();
+                if (elapsed > timeout)
+                    return false;
+                waitingReaders++;
+                readerCond.wait(&mutex, QDeadlineTimer(timeout - elapsed));
+            } else {
+                waitingReaders++;
+                readerCond.wait(&mutex);
+            }
+            waitingReaders--;
+        }
+    }
+}
+
+bool QReadWriteLockPrivate::distributedLockForWrite(int timeout)
+{
+    Q_ASSERT(readerCounters);
+    auto lock = qt_unique_lock(mutex);
+
+    QElapsedTimer t;
+    if (timeout > 0)
+        t.start();
+
+    const auto waitForWriterCond = [&]() {
+        if (timeout == 0)
+            return false;
+        if (timeout > 0) {
+            auto elapsed = t.elapsed();
+            if (elapsed > timeout)
+                return false;
+            waitingWriters++;
+            writerCond.wait(&mutex, QDeadlineTimer(timeout - elapsed));
+        } else {
+            waitingWriters++;
+            writerCond.wait(&mutex);
+        }
+        waitingWriters--;
+        return true;
+    };
+
+    // wait for the other writers
+    while (writerState.loadRelaxed() != NoWriter) {
+        if (!waitForWriterCond())
+            return false;
+    }
+
+    // keep new readers out, then wait for the current ones to leave
+    writerState.storeRelaxed(WriterWaiting);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (distributedReaderCount() != 0) {
+        if (!waitForWriterCond()) {
+            writerState.storeRelease(NoWriter);
+            if (waitingReaders)
+                readerCond.wakeAll();
+            if (waitingWriters)
+                writerCond.wakeAll();
+            return false;
+        }
+    }
+
+    writerState.storeRelaxed(WriterLocked);
+    writerCount = 1;
+    return true;
+}
+
+void QReadWriteLockPrivate::distributedUnlock()
+{
+    Q_ASSERT(readerCounters);
+    // only the writer can observe WriterLocked: readers cannot hold the lock
+    // while it is set
+    if (writerState.loadRelaxed() == WriterLocked) {
+        auto lock = qt_unique_lock(mutex);
+        writerCount = 0;
+        writerState.storeRelease(NoWriter);
+        if (waitingWriters)
+            writerCond.wakeAll();
+        if (waitingReaders)
+            readerCond.wakeAll();
+        return;
+    }
+
+    readerCounter(readerCounters).readers.deref();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writerState.loadRelaxed() == WriterWaiting) {
+        // the writer may be waiting for us to leave
+        auto lock = qt_unique_lock(mutex);
+        writerCond.wakeAll();
+    }
+}
+
 // The freelist management
 namespace {
 struct FreeListConstants : QFreeListDefaultConstants {
@@ -53,8 +53,10 @@ class Q_CORE_EXPORT QReadWriteLock
 {
 public:
     enum RecursionMode { NonRecursive, Recursive };
+    enum ReaderMode { SharedReaders, DistributedReaders };
 
     explicit QReadWriteLock(RecursionMode recursionMode = NonRecursive);
+    QReadWriteLock(RecursionMode recursionMode, ReaderMode readerMode);
     ~QReadWriteLock();
 
     void lockForRead();
@@ -60,11 +60,22 @@ QT_REQUIRE_CONFIG(thread);
 
 QT_BEGIN_NAMESPACE
 
+// One reader counter per cache line, threads are spread over them
+struct QReadWriteLockReaderCounters
+{
+    enum { Count = 32 };
+    struct alignas(64) Counter {
+        QAtomicInt readers;
+    };
+    Counter counters[Count];
+};
+
 class QReadWriteLockPrivate
 {
 public:
     explicit QReadWriteLockPrivate(bool isRecursive = false)
         : recursive(isRecursive) {}
+    ~QReadWriteLockPrivate() { delete readerCounters; }
 
     QMutex mutex;
     QWaitCondition writerCond;
@@ -93,6 +104,17 @@ public:
     bool recursiveLockForWrite(int timeout);
     bool recursiveLockForRead(int timeout);
     void recursiveUnlock();
+
+    // Distributed reader counting (QReadWriteLock::DistributedReaders)
+    enum WriterState { NoWriter, WriterWaiting, WriterLocked };
+    QReadWriteLockReaderCounters *readerCounters = nullptr;
+    QAtomicInt writerState = NoWriter;
+
+    // called with the mutex unlocked
+    bool distributedLockForRead(int timeout);
+    bool distributedLockForWrite(int timeout);
+    void distributedUnlock();
+    int distributedReaderCount() const;
 };
 
 QT_END_NAMESPACE
@@ -109,7 +109,8 @@ bool ResultIteratorBase::canIncrementVectorIndex() const
 }
 
 ResultStoreBase::ResultStoreBase()
-    : insertIndex(0), resultCount(0), m_filterMode(false), filteredResults(0) { }
+    : insertIndex(0), resultCount(0), m_filterMode(false), filteredResults(0),
+      m_chunkKey(-1), m_chunkCapacity(0) { }
 
 ResultStoreBase::~ResultStoreBase()
 {
@@ -197,6 +198,53 @@ int ResultStoreBase::addResults(int index, const void *results, int vectorSize,
     }
 }
 
+// Returns the chunk that a result reported at \a index can be appended
+// to, or nullptr if it has to be stored on its own.
+void *ResultStoreBase::growableChunk(int index) const
+{
+    if (m_filterMode || m_chunkKey < 0 || m_results.isEmpty() || m_results.lastKey() != m_chunkKey)
+        return nullptr;
+    if (index != -1 && index != insertIndex)
+        return nullptr;
+
+    const ResultItem &chunk = m_results.last();
+    if (chunk.count() >= m_chunkCapacity)
+        return nullptr;
+    // a canceled result in between would leave a gap
+    if (m_chunkKey + chunk.count() != insertIndex - filteredResults)
+        return nullptr;
+    return const_cast<void *>(chunk.result);
+}
+
+// Accounts for a result appended to the chunk returned by growableChunk().
+int ResultStoreBase::chunkGrown()
+{
+    ResultItem &chunk = m_results.last();
+    if (resultCount == m_chunkKey + chunk.count())
+        ++resultCount;
+    ++chunk.m_count;
+    return insertIndex++;
+}
+
+// Returns the capacity to reserve for a new chunk starting at \a index,
+// or 0 if the result at \a index should not start one. Capacities grow
+// with the number of results so far, so that a future with a single
+// result does not reserve space for more.
+int ResultStoreBase::newChunkCapacity(int index) const
+{
+    if (m_filterMode || (index != -1 && index != insertIndex))
+        return 0;
+    return qBound(1, insertIndex, int(MaxChunkCapacity));
+}
+
+int ResultStoreBase::addChunk(int index, void *chunk, int capacity)
+{
+    const int storeIndex = addResults(index, chunk, 1, 1);
+    m_chunkKey = storeIndex - filteredResults;
+    m_chunkCapacity = capacity;
+    return storeIndex;
+}
+
 ResultIteratorBase ResultStoreBase::begin() const
 {
     return ResultIteratorBase(m_results.begin());
@@ -143,6 +143,14 @@ protected:
     void syncResultCount();
     int updateInsertIndex(int index, int _count);
 
+    // In-order results are appended to a growing QList instead of being
+    // allocated and inserted into m_results one by one.
+    enum { MaxChunkCapacity = 1024 };
+    void *growableChunk(int index) const;
+    int chunkGrown();
+    int newChunkCapacity(int index) const;
+    int addChunk(int index, void *chunk, int capacity);
+
     QMap<int, ResultItem> m_results;
     int insertIndex;     // The index where the next results(s) will be inserted.
     int resultCount;     // The number of consecutive results stored, starting at index 0.
@@ -151,6 +159,29 @@ protected:
     QMap<int, ResultItem> pendingResults;
     int filteredResults;
 
+    int m_chunkKey;      // key of the chunk in m_results that can still grow, or -1
+    int m_chunkCapacity; // capacity reserved for that chunk
+
+    template <typename T, typename U>
+    int addResultToChunk(int index, U &&result)
+    {
+        if (void *chunk = growableChunk(index)) {
+            static_cast<QList<T> *>(chunk)->append(std::forward<U>(result));
+            return chunkGrown();
+        }
+
+        const int capacity = newChunkCapacity(index);
+        if (capacity == 0)
+            return addResult(index, static_cast<void *>(new T(std::forward<U>(result))));
+
+        // Never grow past the reserved capacity: references to the results
+        // already in the chunk must stay valid.
+        auto chunk = new QList<T>;
+        chunk->reserve(capacity);
+        chunk->append(std::forward<U>(result));
+        return addChunk(index, chunk, capacity);
+    }
+
 public:
     template <typename T>
     int addResult(int index, const T *result)
@@ -158,13 +189,19 @@ public:
         if (result == nullptr)
             return addResult(index, static_cast<void *>(nullptr));
 
-        return addResult(index, static_cast<void *>(new T(*result)));
+        if constexpr (std::is_copy_constructible_v<T>)
+            return addResultToChunk<T>(index, *result);
+        else
+            return addResult(index, static_cast<void *>(new T(*result)));
     }
 
     template <typename T>
     int moveResult(int index, T &&result)
     {
-        return addResult(index, static_cast<void *>(new T(std::move_if_noexcept(result))));
+        if constexpr (std::is_copy_constructible_v<T>)
+            return addResultToChunk<T>(index, std::move_if_noexcept(result));
+        else
+            return addResult(index, static_cast<void *>(new T(std::move_if_noexcept(result))));
     }
 
     template<typename T>
@@ -207,6 +244,7 @@ public:
         }
         resultCount = 0;
         m_results.clear();
+        m_chunkKey = -1;
     }
 };
 
@@ -53,6 +53,43 @@
 
 QT_BEGIN_NAMESPACE
 
+/*
+  QPostEventList
+*/
+
+/*
+    \internal
+
+    Moves the events on the lock-free incoming stack into the sorted list,
+    in the order they were posted, and returns how many there were.
+*/
+int QPostEventList::mergeIncoming()
+{
+    IncomingEvent *node = incoming.fetchAndStoreAcquire(nullptr);
+    if (!node)
+        return 0;
+
+    // the stack is in reverse posting order
+    IncomingEvent *first = nullptr;
+    while (node) {
+        IncomingEvent *next = node->next;
+        node->next = first;
+        first = node;
+        node = next;
+    }
+
+    int merged = 0;
+    while (first) {
+        IncomingEvent *next = first->next;
+        addEvent(first->pe);
+        ++QObjectPrivate::get(first->pe.receiver)->postedEvents;
+        delete first;
+        first = next;
+        ++merged;
+    }
+    return merged;
+}
+
 /*
   QThreadData
 */
@@ -93,6 +130,7 @@ QThreadData::~QThreadData()
     thread.storeRelease(nullptr);
     delete t;
 
+    postEventList.mergeIncoming();
     for (int i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
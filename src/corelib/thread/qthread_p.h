@@ -107,8 +107,33 @@ public:
 
     QMutex mutex;
 
+    // Events posted from other threads are pushed onto this lock-free stack
+    // and merged into the sorted list by the next thread that takes the mutex.
+    struct IncomingEvent
+    {
+        QPostEvent pe;
+        IncomingEvent *next;
+    };
+    QAtomicPointer<IncomingEvent> incoming;
+    // number of threads currently between looking up the receiver's thread
+    // and pushing onto incoming; see QObject::moveToThread()
+    QAtomicInt activePushers;
+
     inline QPostEventList() : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0) { }
 
+    bool hasIncomingEvents() const { return incoming.loadAcquire() != nullptr; }
+
+    void pushIncoming(IncomingEvent *node)
+    {
+        IncomingEvent *head = incoming.loadRelaxed();
+        do {
+            node->next = head;
+        } while (!incoming.testAndSetRelease(head, node, head));
+    }
+
+    // must be called with the mutex held
+    int mergeIncoming();
+
     void addEvent(const QPostEvent &ev) {
         int priority = ev.priority;
         if (isEmpty() ||
@@ -255,7 +280,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return canWait && !postEventList.hasIncomingEvents();
     }
 
     // This class provides per-thread (by way of being a QThreadData
@@ -62,48 +62,30 @@ QT_BEGIN_NAMESPACE
 void qt_watch_adopted_thread(const HANDLE adoptedThreadHandle, QThread *qthread);
 DWORD WINAPI qt_adopted_thread_watcher_function(LPVOID);
 
-static DWORD qt_current_thread_data_tls_index = TLS_OUT_OF_INDEXES;
-void qt_create_tls()
-{
-    if (qt_current_thread_data_tls_index != TLS_OUT_OF_INDEXES)
-        return;
-    static QBasicMutex mutex;
-    QMutexLocker locker(&mutex);
-    if (qt_current_thread_data_tls_index != TLS_OUT_OF_INDEXES)
-        return;
-    qt_current_thread_data_tls_index = TlsAlloc();
-}
-
-static void qt_free_tls()
-{
-    if (qt_current_thread_data_tls_index != TLS_OUT_OF_INDEXES) {
-        TlsFree(qt_current_thread_data_tls_index);
-        qt_current_thread_data_tls_index = TLS_OUT_OF_INDEXES;
-    }
-}
-Q_DESTRUCTOR_FUNCTION(qt_free_tls)
+// Caching the thread data in a thread_local avoids a TlsGetValue() call
+// for every QThreadData::current(), and is reset for each new thread.
+static thread_local QThreadData *currentThreadData = nullptr;
 
 /*
     QThreadData
 */
 void QThreadData::clearCurrentThreadData()
 {
-    TlsSetValue(qt_current_thread_data_tls_index, 0);
+    currentThreadData = nullptr;
 }
 
 QThreadData *QThreadData::current(bool createIfNecessary)
 {
-    qt_create_tls();
-    QThreadData *threadData = reinterpret_cast<QThreadData *>(TlsGetValue(qt_current_thread_data_tls_index));
+    QThreadData *threadData = currentThreadData;
     if (!threadData && createIfNecessary) {
         threadData = new QThreadData;
         // This needs to be called prior to new AdoptedThread() to
         // avoid recursion.
-        TlsSetValue(qt_current_thread_data_tls_index, threadData);
+        currentThreadData = threadData;
         QT_TRY {
             threadData->thread = new QAdoptedThread(threadData);
         } QT_CATCH(...) {
-            TlsSetValue(qt_current_thread_data_tls_index, 0);
+            currentThreadData = nullptr;
             threadData->deref();
             threadData = 0;
             QT_RETHROW;
@@ -241,7 +223,7 @@ DWORD WINAPI qt_adopted_thread_watcher_function(LPVOID)
         qt_adopted_qthreads.remove(qthreadIndex);
     }
 
-    QThreadData *threadData = reinterpret_cast<QThreadData *>(TlsGetValue(qt_current_thread_data_tls_index));
+    QThreadData *threadData = currentThreadData;
     if (threadData)
         threadData->deref();
 
@@ -300,8 +282,7 @@ unsigned int __stdcall QT_ENSURE_STACK_ALIGNED_FOR_SSE QThreadPrivate::start(voi
     QThread *thr = reinterpret_cast<QThread *>(arg);
     QThreadData *data = QThreadData::get2(thr);
 
-    qt_create_tls();
-    TlsSetValue(qt_current_thread_data_tls_index, data);
+    currentThreadData = data;
     data->threadId.storeRelaxed(reinterpret_cast<Qt::HANDLE>(quintptr(GetCurrentThreadId())));
 
     QThread::setTerminationEnabled(false);
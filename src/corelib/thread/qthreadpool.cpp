@@ -57,11 +57,22 @@ public:
     void run() override;
     void registerThreadInactive();
 
+    QRunnable *popLocal();
+    QRunnable *stealLocal();
+    bool tryTakeLocal(QRunnable *runnable);
+
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+
+    // Runnables started from this thread while work stealing is enabled.
+    // The owner pops from the back, other pool threads steal from the front.
+    QBasicMutex localMutex;
+    QList<QRunnable *> localQueue;
 };
 
+static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+
 /*
     QThreadPool private class.
 */
@@ -81,6 +92,7 @@ QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
 */
 void QThreadPoolThread::run()
 {
+    currentPoolThread = this;
     QMutexLocker locker(&manager->mutex);
     for(;;) {
         QRunnable *r = runnable;
@@ -88,28 +100,30 @@ void QThreadPoolThread::run()
 
         do {
             if (r) {
-                const bool del = r->autoDelete();
-                Q_ASSERT(!del || r->ref == 1);
-
-
-                // run the task
+                // run the task, followed by everything it queued locally
                 locker.unlock();
+                do {
+                    const bool del = r->autoDelete();
+                    Q_ASSERT(!del || r->ref == 1);
+
 #ifndef QT_NO_EXCEPTIONS
-                try {
+                    try {
 #endif
-                    r->run();
+                        r->run();
 #ifndef QT_NO_EXCEPTIONS
-                } catch (...) {
-                    qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
-                             "This is not supported, exceptions thrown in worker threads must be\n"
-                             "caught before control returns to Qt Concurrent.");
-                    registerThreadInactive();
-                    throw;
-                }
+                    } catch (...) {
+                        qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
+                                 "This is not supported, exceptions thrown in worker threads must be\n"
+                                 "caught before control returns to Qt Concurrent.");
+                        registerThreadInactive();
+                        throw;
+                    }
 #endif
 
-                if (del)
-                    delete r;
+                    if (del)
+                        delete r;
+                    r = popLocal();
+                } while (r);
                 locker.relock();
             }
 
@@ -118,7 +132,9 @@ void QThreadPoolThread::run()
                 break;
 
             if (manager->queue.isEmpty()) {
-                r = nullptr;
+                r = manager->workStealing.loadRelaxed() ? manager->stealTask(this) : nullptr;
+                if (r)
+                    continue;
                 break;
             }
 
@@ -148,6 +164,7 @@ void QThreadPoolThread::run()
         }
         if (expired) {
             manager->expiredThreads.enqueue(this);
+            manager->spareCapacityHint.storeRelaxed(true);
             registerThreadInactive();
             break;
         }
@@ -160,6 +177,36 @@ void QThreadPoolThread::registerThreadInactive()
         manager->noActiveThreads.wakeAll();
 }
 
+/*
+    \internal
+
+    Takes the most recently queued runnable from this thread's local queue.
+    Only called by the thread itself.
+*/
+QRunnable *QThreadPoolThread::popLocal()
+{
+    QMutexLocker locker(&localMutex);
+    return localQueue.isEmpty() ? nullptr : localQueue.takeLast();
+}
+
+/*
+    \internal
+
+    Takes the oldest runnable from this thread's local queue on behalf of
+    another thread.
+*/
+QRunnable *QThreadPoolThread::stealLocal()
+{
+    QMutexLocker locker(&localMutex);
+    return localQueue.isEmpty() ? nullptr : localQueue.takeFirst();
+}
+
+bool QThreadPoolThread::tryTakeLocal(QRunnable *runnable)
+{
+    QMutexLocker locker(&localMutex);
+    return localQueue.removeOne(runnable);
+}
+
 
 /*
     \internal
@@ -222,6 +269,62 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
 }
 
+/*!
+    \internal
+
+    Queues \a runnable on the local queue of the pool thread \a thread, which
+    must be the calling thread. The shared mutex is only taken if another
+    thread may be available to pick up the work. Returns \c false if the local
+    queue is full, in which case the runnable has to go to the shared queue.
+*/
+bool QThreadPoolPrivate::enqueueLocalTask(QThreadPoolThread *thread, QRunnable *runnable)
+{
+    Q_ASSERT(thread == currentPoolThread && thread->manager == this);
+    {
+        QMutexLocker localLocker(&thread->localMutex);
+        if (thread->localQueue.size() >= QueuePage::MaxPageSize)
+            return false;
+        thread->localQueue.append(runnable);
+    }
+
+    // Threads set the hint before they look for work to steal, so either they
+    // see the runnable we just queued, or we see the hint.
+    if (!spareCapacityHint.loadAcquire())
+        return true;
+
+    QMutexLocker locker(&mutex);
+    if (!waitingThreads.isEmpty()) {
+        // the woken thread will steal from us
+        waitingThreads.takeFirst()->runnableReady.wakeOne();
+    } else if (activeThreadCount() < maxThreadCount) {
+        if (QRunnable *r = thread->stealLocal()) {
+            if (!tryStart(r))
+                enqueueTask(r);
+        }
+    } else {
+        spareCapacityHint.storeRelaxed(false);
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Takes a runnable from the local queue of any pool thread other than
+    \a thief. Must be called with the mutex held.
+*/
+QRunnable *QThreadPoolPrivate::stealTask(QThreadPoolThread *thief)
+{
+    spareCapacityHint.storeRelease(true);
+    for (QThreadPoolThread *thread : qAsConst(allThreads)) {
+        if (thread == thief)
+            continue;
+        if (QRunnable *r = thread->stealLocal())
+            return r;
+    }
+    return nullptr;
+}
+
 int QThreadPoolPrivate::activeThreadCount() const
 {
     return (allThreads.count()
@@ -281,6 +384,7 @@ void QThreadPoolPrivate::reset()
     allThreadsCopy.swap(allThreads);
     expiredThreads.clear();
     waitingThreads.clear();
+    spareCapacityHint.storeRelaxed(true);
     mutex.unlock();
 
     for (QThreadPoolThread *thread: qAsConst(allThreadsCopy)) {
@@ -338,6 +442,19 @@ void QThreadPoolPrivate::clear()
     }
     qDeleteAll(queue);
     queue.clear();
+
+    QList<QRunnable *> localRunnables;
+    for (QThreadPoolThread *thread : qAsConst(allThreads)) {
+        while (QRunnable *r = thread->stealLocal())
+            localRunnables.append(r);
+    }
+    locker.unlock();
+    for (QRunnable *r : qAsConst(localRunnables)) {
+        if (r->autoDelete()) {
+            Q_ASSERT(r->ref == 1);
+            delete r;
+        }
+    }
 }
 
 /*!
@@ -379,6 +496,16 @@ bool QThreadPool::tryTake(QRunnable *runnable)
         }
     }
 
+    for (QThreadPoolThread *thread : qAsConst(d->allThreads)) {
+        if (thread->tryTakeLocal(runnable)) {
+            if (runnable->autoDelete()) {
+                Q_ASSERT(runnable->ref == 1);
+                --runnable->ref; // undo ++ref in start()
+            }
+            return true;
+        }
+    }
+
     return false;
 }
 
@@ -507,12 +634,18 @@ void QThreadPool::start(QRunnable *runnable, int priority)
         return;
 
     Q_D(QThreadPool);
-    QMutexLocker locker(&d->mutex);
     if (runnable->autoDelete()) {
         Q_ASSERT(runnable->ref == 0);
         ++runnable->ref;
     }
 
+    if (priority == 0 && d->workStealing.loadRelaxed()
+            && currentPoolThread && currentPoolThread->manager == d
+            && d->enqueueLocalTask(currentPoolThread, runnable)) {
+        return;
+    }
+
+    QMutexLocker locker(&d->mutex);
     if (!d->tryStart(runnable)) {
         d->enqueueTask(runnable, priority);
 
@@ -657,6 +790,7 @@ void QThreadPool::setMaxThreadCount(int maxThreadCount)
         return;
 
     d->maxThreadCount = maxThreadCount;
+    d->spareCapacityHint.storeRelaxed(true);
     d->tryToStartMoreThreads();
 }
 
@@ -722,6 +856,39 @@ uint QThreadPool::stackSize() const
     return d->stackSize;
 }
 
+/*! \property QThreadPool::workStealingEnabled
+    \since 6.0
+
+    This property holds whether runnables started from within the pool's own
+    threads are queued on a per-thread queue instead of the shared run queue.
+
+    When enabled, calling start() with the default priority from a runnable
+    that is executed by this thread pool puts the new runnable on a queue that
+    belongs to the calling thread. The thread runs its queued runnables itself
+    once the current one returns, most recently queued first, while idle pool
+    threads take the oldest entries from other threads' queues. This avoids
+    contention on the shared queue when many small runnables are spawned from
+    inside the pool, as happens for example with nested calls to
+    QtConcurrent::run().
+
+    Runnables started from other threads, with a non-zero priority, or with
+    tryStart() always use the shared queue. Runnables on a per-thread queue are
+    run before the ones on the shared queue, regardless of their priority.
+
+    The default value is \c false.
+*/
+void QThreadPool::setWorkStealingEnabled(bool enabled)
+{
+    Q_D(QThreadPool);
+    d->workStealing.storeRelaxed(enabled);
+}
+
+bool QThreadPool::isWorkStealingEnabled() const
+{
+    Q_D(const QThreadPool);
+    return d->workStealing.loadRelaxed();
+}
+
 /*!
     Releases a thread previously reserved by a call to reserveThread().
 
@@ -739,6 +906,7 @@ void QThreadPool::releaseThread()
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
     --d->reservedThreads;
+    d->spareCapacityHint.storeRelaxed(true);
     d->tryToStartMoreThreads();
 }
 
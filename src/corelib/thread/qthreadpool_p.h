@@ -170,6 +170,9 @@ public:
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
 
+    bool enqueueLocalTask(QThreadPoolThread *thread, QRunnable *runnable);
+    QRunnable *stealTask(QThreadPoolThread *thief);
+
     mutable QMutex mutex;
     QSet<QThreadPoolThread *> allThreads;
     QQueue<QThreadPoolThread *> waitingThreads;
@@ -182,6 +185,10 @@ public:
     int reservedThreads = 0;
     int activeThreads = 0;
     uint stackSize = 0;
+    QAtomicInteger<bool> workStealing = false;
+    // Set whenever a thread may have become available; cleared only with the
+    // mutex held once enqueueLocalTask() found no thread to hand work over to.
+    QAtomicInteger<bool> spareCapacityHint = true;
 };
 
 QT_END_NAMESPACE
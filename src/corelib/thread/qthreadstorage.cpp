@@ -73,6 +73,7 @@ typedef QList<void (*)(void *)> DestructorMap;
 Q_GLOBAL_STATIC(DestructorMap, destructors)
 
 QThreadStorageData::QThreadStorageData(void (*func)(void *))
+    : destructor(func)
 {
     QMutexLocker locker(&destructorsMutex);
     DestructorMap *destr = destructors();
@@ -150,11 +151,8 @@ void **QThreadStorageData::set(void *p)
                 value,
                 data->thread.loadRelaxed());
 
-        QMutexLocker locker(&destructorsMutex);
-        DestructorMap *destr = destructors();
-        void (*destructor)(void *) = destr ? destr->value(id) : nullptr;
-        locker.unlock();
-
+        // This storage owns id, so its own destructor applies; only
+        // finish() needs the global table, for storages it cannot see.
         void *q = value;
         value = nullptr;
 
@@ -58,6 +58,7 @@ public:
 
     static void finish(void**);
     int id;
+    void (*destructor)(void *);
 };
 
 #if !defined(QT_MOC_CPP)
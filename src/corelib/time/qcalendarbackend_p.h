@@ -62,6 +62,25 @@ QT_BEGIN_NAMESPACE
 
 // Locale-related parts, mostly handled in ../text/qlocale.cpp
 
+// A date-time format string, split into fields and literal text:
+struct QDateTimeFormatTokens
+{
+    struct Token
+    {
+        QString text; // Literal text, when field is 0
+        char16_t field = 0; // The format letter
+        int repeat = 0; // How many times it appeared
+    };
+
+    QList<Token> tokens;
+    bool date = false; // Parsed for formatting a date
+    bool time = false; // Parsed for formatting a time
+    bool twelveHour = false; // The format has an AM/PM field
+
+    static QDateTimeFormatTokens parse(QStringView format, bool date, bool time);
+};
+Q_DECLARE_TYPEINFO(QDateTimeFormatTokens::Token, Q_MOVABLE_TYPE);
+
 struct QCalendarLocale {
     quint16 m_language_id, m_script_id, m_country_id;
 
@@ -128,6 +147,8 @@ public:
     virtual QString dateTimeToString(QStringView format, const QDateTime &datetime,
                                      QDate dateOnly, QTime timeOnly,
                                      const QLocale &locale) const;
+    QString dateTimeToString(const QDateTimeFormatTokens &format, const QDateTime &datetime,
+                             QDate dateOnly, QTime timeOnly, const QLocale &locale) const;
 
     // Calendar enumeration by name:
     static QStringList availableCalendars();
@@ -142,6 +163,8 @@ protected:
     bool registerAlias(const QString &name);
 
 private:
+    // QDateTimeFormat's access to the backend of its QCalendar:
+    friend class QDateTimeFormat;
     // QCalendar's access to its registry:
     static const QCalendarBackend *fromName(QStringView name);
     static const QCalendarBackend *fromName(QLatin1String name);
@@ -2401,6 +2401,90 @@ int QDateTimeParser::startsWithLocalTimeZone(QStringView name)
 }
 #endif // datetimeparser
 
+#if QT_CONFIG(timezone) && defined(Q_OS_UNIX) && !defined(Q_OS_DARWIN) \
+    && (!defined(Q_OS_ANDROID) || defined(Q_OS_ANDROID_EMBEDDED))
+/*
+  A period of UTC time throughout which the platform's local time has a fixed
+  offset, along with what the platform reported for it. Each thread remembers
+  the last one it saw, so that qt_mktime() and qt_localtime() can answer
+  repeated queries near the same time without calling into the C library.
+
+  The bounds of the period come from the transition table of the system
+  QTimeZone for the current value of TZ. It is only remembered when the system
+  QTimeZone and the C library agree on the offset and DST status at the time
+  that was converted.
+*/
+namespace {
+struct LocalTimeSpan
+{
+    QByteArray tz; // The value of TZ when the span was found
+    bool hasTz = false;
+    QTimeZone zone;
+    qint64 start = 0; // UTC msecs, inclusive
+    qint64 end = 0; // UTC msecs, exclusive
+    int offset = 0; // Seconds ahead of UTC
+    QDateTimePrivate::DaylightStatus daylightStatus = QDateTimePrivate::UnknownDaylightTime;
+    QString abbreviation;
+
+    bool tzUnchanged() const
+    {
+        const char *current = ::getenv("TZ");
+        return current ? hasTz && tz == current : !hasTz;
+    }
+};
+} // namespace
+
+static thread_local LocalTimeSpan localTimeSpan;
+
+static void msecsToTime(qint64 msecs, QDate *date, QTime *time);
+
+// Returns the span containing the given UTC msecs, or null if not known
+static const LocalTimeSpan *findLocalTimeSpan(qint64 utcMSecs)
+{
+    const LocalTimeSpan &span = localTimeSpan;
+    if (utcMSecs < span.start || utcMSecs >= span.end || !span.tzUnchanged())
+        return nullptr;
+    return &span;
+}
+
+// Called just after the C library converted between utcMSecs and local
+// date and time, with the given DST status
+static void updateLocalTimeSpan(qint64 utcMSecs, QDate localDate, QTime localTime,
+                                QDateTimePrivate::DaylightStatus daylightStatus)
+{
+    LocalTimeSpan &span = localTimeSpan;
+    span.start = span.end = 0;
+    if (!span.tzUnchanged()) {
+        const char *current = ::getenv("TZ");
+        span.hasTz = current != nullptr;
+        span.tz = current;
+        span.zone = QTimeZone::systemTimeZone();
+    }
+    if (!span.zone.isValid() || daylightStatus == QDateTimePrivate::UnknownDaylightTime)
+        return;
+
+    const qint64 localMSecs = (localDate.toJulianDay() - JULIAN_DAY_FOR_EPOCH) * MSECS_PER_DAY
+                              + localTime.msecsSinceStartOfDay();
+    const int offset = int((localMSecs - utcMSecs) / 1000);
+    const QDateTime at = QDateTime::fromMSecsSinceEpoch(utcMSecs, Qt::UTC);
+    if (span.zone.offsetFromUtc(at) != offset
+        || span.zone.isDaylightTime(at) != (daylightStatus == QDateTimePrivate::DaylightTime)) {
+        return;
+    }
+
+    const QTimeZone::OffsetData previous = span.zone.previousTransition(at.addMSecs(1));
+    const QTimeZone::OffsetData next = span.zone.nextTransition(at);
+    span.start = previous.atUtc.isValid() ? qMax(previous.atUtc.toMSecsSinceEpoch(), qint64(0)) : 0;
+    span.end = next.atUtc.isValid()
+            ? qMin(next.atUtc.toMSecsSinceEpoch(), qint64(TIME_T_MAX) * 1000 + 1)
+            : qint64(TIME_T_MAX) * 1000 + 1;
+    span.offset = offset;
+    span.daylightStatus = daylightStatus;
+    span.abbreviation = qt_tzname(daylightStatus);
+}
+#define QT_LOCALTIME_SPAN_CACHE
+#endif
+
 // Calls the platform variant of mktime for the given date, time and daylightStatus,
 // and updates the date, time, daylightStatus and abbreviation with the returned values
 // If the date falls outside the 1970 to 2037 range supported by mktime / time_t
@@ -2413,6 +2497,29 @@ static qint64 qt_mktime(QDate *date, QTime *time, QDateTimePrivate::DaylightStat
     int yy, mm, dd;
     date->getDate(&yy, &mm, &dd);
 
+#ifdef QT_LOCALTIME_SPAN_CACHE
+    {
+        const LocalTimeSpan &span = localTimeSpan;
+        const qint64 localMSecs = (date->toJulianDay() - JULIAN_DAY_FOR_EPOCH) * MSECS_PER_DAY
+                                  + time->msecsSinceStartOfDay();
+        const qint64 utcMSecs = localMSecs - span.offset * 1000;
+        // Stay a day clear of the transitions, so a local time in a gap or
+        // overlap is never resolved here:
+        if (utcMSecs - span.start >= MSECS_PER_DAY && span.end - utcMSecs > MSECS_PER_DAY
+            && (!daylightStatus || *daylightStatus == QDateTimePrivate::UnknownDaylightTime
+                || *daylightStatus == span.daylightStatus)
+            && findLocalTimeSpan(utcMSecs)) {
+            if (daylightStatus)
+                *daylightStatus = span.daylightStatus;
+            if (abbreviation)
+                *abbreviation = span.abbreviation;
+            if (ok)
+                *ok = true;
+            return utcMSecs;
+        }
+    }
+#endif
+
     // All other platforms provide standard C library time functions
     tm local;
     memset(&local, 0, sizeof(local)); // tm_[wy]day plus any non-standard fields
@@ -2457,6 +2564,12 @@ static qint64 qt_mktime(QDate *date, QTime *time, QDateTimePrivate::DaylightStat
             if (abbreviation)
                 *abbreviation = qt_tzname(QDateTimePrivate::StandardTime);
         }
+#ifdef QT_LOCALTIME_SPAN_CACHE
+        updateLocalTimeSpan(qint64(secsSinceEpoch) * 1000 + msec, *date, *time,
+                            local.tm_isdst > 0 ? QDateTimePrivate::DaylightTime
+                            : local.tm_isdst == 0 ? QDateTimePrivate::StandardTime
+                            : QDateTimePrivate::UnknownDaylightTime);
+#endif
     } else if (yy == 1969 && mm == 12 && dd == 31
                && time->second() == MSECS_PER_DAY - 1) {
         // There was, of course, a last second in 1969, at time_t(-1); we won't
@@ -2488,6 +2601,15 @@ static bool qt_localtime(qint64 msecsSinceEpoch, QDate *localDate, QTime *localT
     const time_t secsSinceEpoch = msecsSinceEpoch / 1000;
     const int msec = msecsSinceEpoch % 1000;
 
+#ifdef QT_LOCALTIME_SPAN_CACHE
+    if (const LocalTimeSpan *span = findLocalTimeSpan(msecsSinceEpoch)) {
+        msecsToTime(msecsSinceEpoch + span->offset * 1000, localDate, localTime);
+        if (daylightStatus)
+            *daylightStatus = span->daylightStatus;
+        return true;
+    }
+#endif
+
     tm local;
     bool valid = false;
 
@@ -2524,6 +2646,12 @@ static bool qt_localtime(qint64 msecsSinceEpoch, QDate *localDate, QTime *localT
             else
                 *daylightStatus = QDateTimePrivate::StandardTime;
         }
+#ifdef QT_LOCALTIME_SPAN_CACHE
+        updateLocalTimeSpan(msecsSinceEpoch, *localDate, *localTime,
+                            local.tm_isdst > 0 ? QDateTimePrivate::DaylightTime
+                            : local.tm_isdst == 0 ? QDateTimePrivate::StandardTime
+                            : QDateTimePrivate::UnknownDaylightTime);
+#endif
         return true;
     } else {
         *localDate = QDate();
@@ -0,0 +1,224 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qdatetimeformat.h"
+
+#include "qdatetime.h"
+#include "private/qcalendarbackend_p.h"
+#if QT_CONFIG(datetimeparser)
+#include "private/qdatetimeparser_p.h"
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QDateTimeFormatPrivate : public QSharedData
+{
+public:
+    QDateTimeFormatPrivate(const QString &format, QCalendar cal)
+        : format(format), calendar(cal)
+#if QT_CONFIG(datetimeparser)
+        , parser(QMetaType::QDateTime, QDateTimeParser::FromString, cal)
+#endif
+    {
+    }
+
+    QString format;
+    QCalendar calendar;
+    const QCalendarBackend *backend = nullptr;
+    QDateTimeFormatTokens tokens;
+#if QT_CONFIG(datetimeparser)
+    QDateTimeParser parser;
+    bool parserValid = false;
+#endif
+};
+
+/*!
+    \class QDateTimeFormat
+    \inmodule QtCore
+    \since 6.0
+    \reentrant
+    \brief The QDateTimeFormat class holds a date-time format string, parsed
+    once for repeated use.
+
+    \ingroup shared
+
+    QDateTime::toString() and QDateTime::fromString() parse their format
+    string each time they are called. When many date-times are formatted or
+    parsed with the same format, as when writing or reading time stamps in a
+    log, a QDateTimeFormat can be created once and used instead:
+
+    \snippet code/src_corelib_time_qdatetimeformat.cpp 0
+
+    The format string uses the same expressions as QDateTime::toString(), and
+    toString() and fromString() give the same results as the QDateTime
+    functions given the same format and calendar.
+
+    \sa QDateTime::toString(), QDateTime::fromString(), QLocale::toString()
+*/
+
+/*!
+    Constructs an empty format, which formats every date-time as an empty
+    string and parses none.
+
+    \sa isEmpty()
+*/
+QDateTimeFormat::QDateTimeFormat() noexcept
+{
+}
+
+/*!
+    Constructs a date-time format from the \a format string, for date-times
+    in the calendar \a cal.
+
+    \sa QDateTime::toString()
+*/
+QDateTimeFormat::QDateTimeFormat(const QString &format, QCalendar cal)
+    : d(new QDateTimeFormatPrivate(format, cal))
+{
+    d->backend = QCalendarBackend::fromName(cal.name());
+    d->tokens = QDateTimeFormatTokens::parse(format, true, true);
+#if QT_CONFIG(datetimeparser)
+    d->parser.setDefaultLocale(QLocale::c());
+    d->parserValid = d->parser.parseFormat(format);
+#endif
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QDateTimeFormat::QDateTimeFormat(const QDateTimeFormat &other) = default;
+
+/*!
+    Destroys the format.
+*/
+QDateTimeFormat::~QDateTimeFormat() = default;
+
+/*!
+    Assigns \a other to this format and returns a reference to it.
+*/
+QDateTimeFormat &QDateTimeFormat::operator=(const QDateTimeFormat &other) = default;
+
+/*!
+    \fn QDateTimeFormat &QDateTimeFormat::operator=(QDateTimeFormat &&other)
+
+    Move-assigns \a other to this format instance.
+*/
+
+/*!
+    \fn void QDateTimeFormat::swap(QDateTimeFormat &other)
+
+    Swaps this format with \a other. This operation is very fast and never
+    fails.
+*/
+
+/*!
+    Returns \c true if the format string is empty.
+*/
+bool QDateTimeFormat::isEmpty() const
+{
+    return !d || d->format.isEmpty();
+}
+
+/*!
+    Returns the format string this format was constructed from.
+*/
+QString QDateTimeFormat::format() const
+{
+    return d ? d->format : QString();
+}
+
+/*!
+    Returns the calendar in which this format reads and writes dates.
+*/
+QCalendar QDateTimeFormat::calendar() const
+{
+    return d ? d->calendar : QCalendar();
+}
+
+/*!
+    Returns \a dateTime as a string in this format, using English (C locale)
+    names for months and days.
+
+    Returns an empty string if \a dateTime is invalid.
+
+    \sa QDateTime::toString(), fromString()
+*/
+QString QDateTimeFormat::toString(const QDateTime &dateTime) const
+{
+    return toString(dateTime, QLocale::c());
+}
+
+/*!
+    \overload
+
+    Returns \a dateTime as a string in this format, using the month and day
+    names, digits and AM/PM texts of \a locale.
+
+    \sa QLocale::toString()
+*/
+QString QDateTimeFormat::toString(const QDateTime &dateTime, const QLocale &locale) const
+{
+    if (!d || !d->backend)
+        return QString();
+    return d->backend->dateTimeToString(d->tokens, dateTime, QDate(), QTime(), locale);
+}
+
+/*!
+    Returns the QDateTime represented by \a string in this format, or an
+    invalid date-time if \a string can't be parsed.
+
+    \sa QDateTime::fromString(), toString()
+*/
+QDateTime QDateTimeFormat::fromString(const QString &string) const
+{
+#if QT_CONFIG(datetimeparser)
+    if (d && d->parserValid) {
+        // The parser keeps state while parsing, so use a copy of it
+        const QDateTimeParser parser = d->parser;
+        QDateTime datetime;
+        if (parser.fromString(string, &datetime))
+            return datetime;
+    }
+#else
+    Q_UNUSED(string);
+#endif
+    return QDateTime();
+}
+
+QT_END_NAMESPACE
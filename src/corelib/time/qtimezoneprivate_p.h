@@ -298,6 +298,10 @@ struct QTzTimeZoneCacheEntry
     QList<QTzTransitionRule> m_tranRules;
     QList<QByteArray> m_abbreviations;
     QByteArray m_posixRule;
+    // m_posixRule expanded, valid for forMSecsSinceEpoch in [start, end):
+    QList<QTzTransitionTime> m_posixTranTimes;
+    qint64 m_posixTranStart = 0;
+    qint64 m_posixTranEnd = 0;
 };
 
 class Q_AUTOTEST_EXPORT QTzTimeZonePrivate final : public QTimeZonePrivate
@@ -352,6 +356,12 @@ private:
 #endif
     QTzTimeZoneCacheEntry cached_data;
     QList<QTzTransitionTime> tranCache() const { return cached_data.m_tranTimes; }
+    QList<QTzTransitionTime> posixTranCache() const { return cached_data.m_posixTranTimes; }
+    bool posixTranCacheCovers(qint64 atMSecsSinceEpoch) const
+    {
+        return atMSecsSinceEpoch >= cached_data.m_posixTranStart
+            && atMSecsSinceEpoch < cached_data.m_posixTranEnd;
+    }
 };
 #endif // Q_OS_UNIX
 
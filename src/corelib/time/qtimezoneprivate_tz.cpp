@@ -837,6 +837,64 @@ QTzTimeZoneCacheEntry QTzTimeZoneCache::findEntry(const QByteArray &ianaId)
     return ret;
 }
 
+/*
+  Expands the POSIX rule into transitions for the years after the last listed
+  transition, up to the end of this century, so that data() and friends can
+  binary-search them instead of re-parsing the rule on each call.
+
+  Each year's transitions are computed independently, so the expanded list
+  gives the same answers as getPosixTransitions() for any time whose year and
+  both neighbouring years are in it. We thus expand one extra year at each end
+  and only claim to cover the years in between.
+*/
+static void expandPosixTransitions(QTzTimeZoneCacheEntry *entry)
+{
+    Q_ASSERT(!entry->m_posixRule.isEmpty());
+    const int firstYear = entry->m_tranTimes.isEmpty() ? 1970
+        : qMax(1970, QDateTime::fromMSecsSinceEpoch(entry->m_tranTimes.last().atMSecsSinceEpoch,
+                                                    Qt::UTC).date().year());
+    const int lastYear = 2100;
+    if (firstYear > lastYear)
+        return;
+
+    const QList<QTimeZonePrivate::Data> posixTrans =
+            calculatePosixTransitions(entry->m_posixRule, firstYear - 1, lastYear + 1, 0);
+    if (posixTrans.size() < 2) // No DST, so nothing worth caching
+        return;
+
+    QList<QTzTransitionTime> tranTimes;
+    tranTimes.reserve(posixTrans.size());
+    for (const QTimeZonePrivate::Data &data : posixTrans) {
+        const QByteArray abbreviation = data.abbreviation.toUtf8();
+        int abbreviationIndex = entry->m_abbreviations.indexOf(abbreviation);
+        if (abbreviationIndex == -1) {
+            abbreviationIndex = entry->m_abbreviations.size();
+            entry->m_abbreviations.append(abbreviation);
+        }
+        QTzTransitionRule rule;
+        rule.stdOffset = data.standardTimeOffset;
+        rule.dstOffset = data.daylightTimeOffset;
+        rule.abbreviationIndex = quint8(abbreviationIndex);
+        int ruleIndex = entry->m_tranRules.indexOf(rule);
+        if (ruleIndex == -1) {
+            ruleIndex = entry->m_tranRules.size();
+            entry->m_tranRules.append(rule);
+        }
+        // Indices are stored as quint8:
+        if (abbreviationIndex > 255 || ruleIndex > 255)
+            return;
+
+        QTzTransitionTime tran;
+        tran.atMSecsSinceEpoch = data.atMSecsSinceEpoch;
+        tran.ruleIndex = quint8(ruleIndex);
+        tranTimes.append(tran);
+    }
+
+    entry->m_posixTranTimes = std::move(tranTimes);
+    entry->m_posixTranStart = QDateTime(QDate(firstYear, 1, 1), QTime(0, 0), Qt::UTC).toMSecsSinceEpoch();
+    entry->m_posixTranEnd = QDateTime(QDate(lastYear + 1, 1, 1), QTime(0, 0), Qt::UTC).toMSecsSinceEpoch();
+}
+
 QTzTimeZoneCacheEntry QTzTimeZoneCache::fetchEntry(const QByteArray &ianaId)
 {
     QMutexLocker locker(&m_mutex);
@@ -848,6 +906,8 @@ QTzTimeZoneCacheEntry QTzTimeZoneCache::fetchEntry(const QByteArray &ianaId)
 
     // ... or build a new entry from scratch
     QTzTimeZoneCacheEntry ret = findEntry(ianaId);
+    if (!ret.m_posixRule.isEmpty())
+        expandPosixTransitions(&ret);
     m_cache[ianaId] = ret;
     return ret;
 }
@@ -1022,6 +1082,18 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::data(qint64 forMSecsSinceEpoch) const
     // and we have a POSIX rule, then use it:
     if (!cached_data.m_posixRule.isEmpty()
         && (tranCache().isEmpty() || tranCache().last().atMSecsSinceEpoch < forMSecsSinceEpoch)) {
+        if (posixTranCacheCovers(forMSecsSinceEpoch)) {
+            const QList<QTzTransitionTime> posixTrans = posixTranCache();
+            auto it = std::partition_point(posixTrans.cbegin(), posixTrans.cend(),
+                                           [forMSecsSinceEpoch] (const QTzTransitionTime &at) {
+                                               return at.atMSecsSinceEpoch <= forMSecsSinceEpoch;
+                                           });
+            if (it > posixTrans.cbegin()) {
+                Data data = dataForTzTransition(*--it);
+                data.atMSecsSinceEpoch = forMSecsSinceEpoch;
+                return data;
+            }
+        }
         QList<QTimeZonePrivate::Data> posixTrans = getPosixTransitions(forMSecsSinceEpoch);
         auto it = std::partition_point(posixTrans.cbegin(), posixTrans.cend(),
                                        [forMSecsSinceEpoch] (const QTimeZonePrivate::Data &at) {
@@ -1060,6 +1132,15 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::nextTransition(qint64 afterMSecsSince
     // and we have a POSIX rule, then use it:
     if (!cached_data.m_posixRule.isEmpty()
         && (tranCache().isEmpty() || tranCache().last().atMSecsSinceEpoch < afterMSecsSinceEpoch)) {
+        if (posixTranCacheCovers(afterMSecsSinceEpoch)) {
+            const QList<QTzTransitionTime> posixTrans = posixTranCache();
+            auto it = std::partition_point(posixTrans.cbegin(), posixTrans.cend(),
+                                           [afterMSecsSinceEpoch] (const QTzTransitionTime &at) {
+                                               return at.atMSecsSinceEpoch <= afterMSecsSinceEpoch;
+                                           });
+            if (it != posixTrans.cend())
+                return dataForTzTransition(*it);
+        }
         QList<QTimeZonePrivate::Data> posixTrans = getPosixTransitions(afterMSecsSinceEpoch);
         auto it = std::partition_point(posixTrans.cbegin(), posixTrans.cend(),
                                        [afterMSecsSinceEpoch] (const QTimeZonePrivate::Data &at) {
@@ -1083,6 +1164,15 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::previousTransition(qint64 beforeMSecs
     // and we have a POSIX rule, then use it:
     if (!cached_data.m_posixRule.isEmpty()
         && (tranCache().isEmpty() || tranCache().last().atMSecsSinceEpoch < beforeMSecsSinceEpoch)) {
+        if (posixTranCacheCovers(beforeMSecsSinceEpoch)) {
+            const QList<QTzTransitionTime> posixTrans = posixTranCache();
+            auto it = std::partition_point(posixTrans.cbegin(), posixTrans.cend(),
+                                           [beforeMSecsSinceEpoch] (const QTzTransitionTime &at) {
+                                               return at.atMSecsSinceEpoch < beforeMSecsSinceEpoch;
+                                           });
+            if (it > posixTrans.cbegin())
+                return dataForTzTransition(*--it);
+        }
         QList<QTimeZonePrivate::Data> posixTrans = getPosixTransitions(beforeMSecsSinceEpoch);
         auto it = std::partition_point(posixTrans.cbegin(), posixTrans.cend(),
                                        [beforeMSecsSinceEpoch] (const QTimeZonePrivate::Data &at) {
@@ -65,6 +65,11 @@ qtConfig(timezone) {
     }
 }
 
+qtConfig(datestring) {
+    HEADERS += time/qdatetimeformat.h
+    SOURCES += time/qdatetimeformat.cpp
+}
+
 qtConfig(datetimeparser) {
     HEADERS += time/qdatetimeparser_p.h
     SOURCES += time/qdatetimeparser.cpp
@@ -0,0 +1,191 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qarenascope_p.h"
+
+#include <cstddef>
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+static thread_local QArenaScopePrivate *currentArena = nullptr;
+
+QArenaScopePrivate::QArenaScopePrivate(qsizetype chunkSize) noexcept
+    : previous(currentArena),
+      chunkSize(size_t(qMax(chunkSize, qsizetype(1024))))
+{
+    currentArena = this;
+}
+
+QArenaScopePrivate::~QArenaScopePrivate()
+{
+    Q_ASSERT(currentArena == this);
+    currentArena = previous;
+    while (Chunk *chunk = chunks) {
+        chunks = chunk->next;
+        ::free(chunk);
+    }
+}
+
+QArenaScopePrivate *QArenaScopePrivate::current() noexcept
+{
+    return currentArena;
+}
+
+/*!
+    \internal
+
+    Returns \a size bytes, aligned like memory returned by malloc(), or
+    \nullptr if out of memory.
+*/
+void *QArenaScopePrivate::allocate(size_t size) noexcept
+{
+    constexpr size_t alignment = alignof(std::max_align_t);
+    constexpr size_t headerSize = (sizeof(Chunk) + alignment - 1) & ~(alignment - 1);
+    size = (size + alignment - 1) & ~(alignment - 1);
+
+    if (size_t(end - next) < size) {
+        // blocks larger than a quarter of a chunk get a chunk of their own,
+        // so that they don't waste the rest of the current one
+        const bool dedicated = size > chunkSize / 4;
+        const size_t allocSize = headerSize + (dedicated ? size : chunkSize);
+        Chunk *chunk = static_cast<Chunk *>(::malloc(allocSize));
+        if (!chunk)
+            return nullptr;
+        chunk->size = allocSize;
+        char *data = reinterpret_cast<char *>(chunk) + headerSize;
+        if (dedicated && chunks) {
+            chunk->next = chunks->next;
+            chunks->next = chunk;
+            bytesAllocated += qsizetype(size);
+            return data;
+        }
+        chunk->next = chunks;
+        chunks = chunk;
+        next = data;
+        end = reinterpret_cast<char *>(chunk) + allocSize;
+    }
+
+    void *result = next;
+    next += size;
+    bytesAllocated += qsizetype(size);
+    return result;
+}
+
+/*!
+    \class QArenaScope
+    \inmodule QtCore
+    \since 6.0
+    \brief The QArenaScope class serves the memory of Qt containers from a
+    bump allocator while it exists.
+
+    \ingroup tools
+
+    While a QArenaScope exists, the memory for the data of the QString,
+    QByteArray and QList objects that are created or grow in the thread that
+    created the scope is taken from large chunks owned by the scope.
+    Allocating from the chunks is very cheap, and freeing such data does
+    nothing: all the chunks are released at once when the scope is destroyed.
+
+    This is useful for processing large inputs into many short-lived
+    objects, for instance when parsing a log file line by line:
+
+    \code
+    for (const QByteArray &chunk : chunks) {
+        QArenaScope arena;
+        const QList<QByteArray> lines = chunk.split('\n');
+        for (const QByteArray &line : lines)
+            process(QString::fromUtf8(line));
+    }
+    \endcode
+
+    \warning No data allocated while the scope is active may be used after
+    the scope has been destroyed. Copying a container only shares its data,
+    so results that must outlive the scope have to be stored in containers
+    whose capacity was reserved before the scope was created, or in
+    non-container types. For the same reason, avoid calling functions that
+    may cache containers in global data for the first time within a scope.
+
+    Scopes can be nested; the innermost scope of the thread is used.
+    A scope must be destroyed by the thread that created it, in the reverse
+    order of creation.
+*/
+
+/*!
+    \enum QArenaScope::anonymous
+
+    \value DefaultChunkSize The default size, in bytes, of the chunks
+    allocated by a scope.
+*/
+
+/*!
+    Creates an arena scope for the current thread, which allocates memory in
+    chunks of \a chunkSize bytes.
+*/
+QArenaScope::QArenaScope(qsizetype chunkSize)
+    : d(new QArenaScopePrivate(chunkSize))
+{
+}
+
+/*!
+    Destroys the scope, and releases all the memory allocated from it.
+*/
+QArenaScope::~QArenaScope()
+{
+    delete d;
+}
+
+/*!
+    Returns the number of bytes allocated from this scope so far, including
+    the data that has been freed in the meantime.
+*/
+qsizetype QArenaScope::bytesAllocated() const noexcept
+{
+    return d->bytesAllocated;
+}
+
+/*!
+    Returns \c true if an arena scope is active in the current thread.
+*/
+bool QArenaScope::isActive() noexcept
+{
+    return QArenaScopePrivate::current() != nullptr;
+}
+
+QT_END_NAMESPACE
@@ -39,6 +39,7 @@
 ****************************************************************************/
 
 #include <QtCore/qarraydata.h>
+#include <QtCore/private/qarenascope_p.h>
 #include <QtCore/private/qnumeric_p.h>
 #include <QtCore/private/qtools_p.h>
 #include <QtCore/qmath.h>
@@ -165,6 +166,119 @@ static QArrayData *allocateData(qsizetype allocSize, uint options)
     return header;
 }
 
+static QArrayData *allocateArenaData(QArenaScopePrivate *arena, qsizetype allocSize, uint options)
+{
+    QArrayData *header = static_cast<QArrayData *>(arena->allocate(size_t(allocSize)));
+    if (header) {
+        header->ref_.storeRelaxed(1);
+        header->flags = options | QArenaScopePrivate::ArenaBlockFlag;
+        header->alloc = 0;
+    }
+    return header;
+}
+
+#if QT_CONFIG(arraydata_cache)
+/*
+ * Small blocks holding QByteArray and QString data are allocated in a few
+ * size classes and recycled through a per-thread cache, so that creating and
+ * destroying short strings rarely goes through malloc() and free(). The size
+ * class of such a block is kept in the high bits of its flags;
+ * reallocateUnaligned() clears them, as the block size changes.
+ */
+namespace {
+enum {
+    CachedBlockGranularity = 32,
+    CachedBlockClasses = 4,
+    MaxCachedBlockSize = CachedBlockGranularity * CachedBlockClasses,
+    MaxCachedBlocksPerClass = 64
+};
+constexpr uint CachedBlockClassShift = 28;
+constexpr uint CachedBlockClassMask = 0x7u << CachedBlockClassShift;
+
+struct CachedBlock
+{
+    CachedBlock *next;
+};
+
+// Trivially destructible, so that blocks freed while the thread exits can
+// still see that the cache has been disabled.
+struct ArrayDataCache
+{
+    CachedBlock *blocks[CachedBlockClasses];
+    int count[CachedBlockClasses];
+    bool cleanupRegistered;
+    bool disabled;
+};
+
+thread_local ArrayDataCache arrayDataCache;
+
+struct ArrayDataCacheCleanup
+{
+    ~ArrayDataCacheCleanup()
+    {
+        ArrayDataCache &cache = arrayDataCache;
+        cache.disabled = true;
+        for (int i = 0; i < CachedBlockClasses; ++i) {
+            while (CachedBlock *block = cache.blocks[i]) {
+                cache.blocks[i] = block->next;
+                ::free(block);
+            }
+            cache.count[i] = 0;
+        }
+    }
+};
+} // unnamed namespace
+
+static inline bool isCacheable(qsizetype allocSize, qsizetype objectSize, qsizetype alignment)
+{
+    return allocSize > 0 && allocSize <= MaxCachedBlockSize
+            && objectSize <= 2 && alignment <= qsizetype(alignof(QArrayData));
+}
+
+static QArrayData *allocateCachedData(qsizetype allocSize, uint options)
+{
+    const uint sizeClass = uint(allocSize - 1) / CachedBlockGranularity;
+    ArrayDataCache &cache = arrayDataCache;
+    void *block = cache.blocks[sizeClass];
+    if (block) {
+        cache.blocks[sizeClass] = cache.blocks[sizeClass]->next;
+        --cache.count[sizeClass];
+    } else {
+        block = ::malloc(size_t(sizeClass + 1) * CachedBlockGranularity);
+    }
+
+    QArrayData *header = static_cast<QArrayData *>(block);
+    if (header) {
+        header->ref_.storeRelaxed(1);
+        header->flags = options | ((sizeClass + 1) << CachedBlockClassShift);
+        header->alloc = 0;
+    }
+    return header;
+}
+
+static bool recycleCachedData(QArrayData *data)
+{
+    const uint sizeClass = (data->flags & CachedBlockClassMask) >> CachedBlockClassShift;
+    if (!sizeClass)
+        return false;
+
+    ArrayDataCache &cache = arrayDataCache;
+    if (cache.disabled || cache.count[sizeClass - 1] >= MaxCachedBlocksPerClass)
+        return false;
+    if (!cache.cleanupRegistered) {
+        static thread_local ArrayDataCacheCleanup cleanup;
+        Q_UNUSED(cleanup);
+        cache.cleanupRegistered = true;
+    }
+
+    CachedBlock *block = reinterpret_cast<CachedBlock *>(data);
+    block->next = cache.blocks[sizeClass - 1];
+    cache.blocks[sizeClass - 1] = block;
+    ++cache.count[sizeClass - 1];
+    return true;
+}
+#endif // QT_CONFIG(arraydata_cache)
+
 void *QArrayData::allocate(QArrayData **dptr, qsizetype objectSize, qsizetype alignment,
         qsizetype capacity, ArrayOptions options) noexcept
 {
@@ -190,7 +304,15 @@ void *QArrayData::allocate(QArrayData **dptr, qsizetype objectSize, qsizetype al
     Q_ASSERT(headerSize > 0);
 
     qsizetype allocSize = calculateBlockSize(capacity, objectSize, headerSize, options);
-    QArrayData *header = allocateData(allocSize, options);
+    QArrayData *header;
+    if (QArenaScopePrivate *arena = QArenaScopePrivate::current(); arena && allocSize > 0)
+        header = allocateArenaData(arena, allocSize, options);
+#if QT_CONFIG(arraydata_cache)
+    else if (isCacheable(allocSize, objectSize, alignment))
+        header = allocateCachedData(allocSize, options);
+#endif
+    else
+        header = allocateData(allocSize, options);
     void *data = nullptr;
     if (header) {
         // find where offset should point to so that data() is aligned to alignment bytes
@@ -211,9 +333,33 @@ QArrayData::reallocateUnaligned(QArrayData *data, void *dataPointer,
     qsizetype headerSize = sizeof(QArrayData);
     qsizetype allocSize = calculateBlockSize(capacity, objectSize, headerSize, options);
     qptrdiff offset = dataPointer ? reinterpret_cast<char *>(dataPointer) - reinterpret_cast<char *>(data) : headerSize;
-    QArrayData *header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
+    QArenaScopePrivate *arena = QArenaScopePrivate::current();
+    const bool fromArena = data && (data->flags & QArenaScopePrivate::ArenaBlockFlag);
+    const bool toArena = arena && (fromArena || !data);
+    QArrayData *header;
+    if (fromArena) {
+        // arena blocks can't be resized in place: copy into a new block
+        header = static_cast<QArrayData *>(toArena ? arena->allocate(size_t(allocSize))
+                                                   : ::malloc(size_t(allocSize)));
+        if (header) {
+            const qsizetype oldSize = offset + data->alloc * objectSize;
+            ::memcpy(static_cast<void *>(header), data, size_t(qMin(oldSize, allocSize)));
+        }
+    } else if (toArena) {
+        header = static_cast<QArrayData *>(arena->allocate(size_t(allocSize)));
+        if (header)
+            header->ref_.storeRelaxed(1);
+    } else {
+        header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
+    }
     if (header) {
-        header->flags = options;
+#if QT_CONFIG(arraydata_cache)
+        header->flags = uint(options) & ~(CachedBlockClassMask | QArenaScopePrivate::ArenaBlockFlag);
+#else
+        header->flags = uint(options) & ~QArenaScopePrivate::ArenaBlockFlag;
+#endif
+        if (toArena)
+            header->flags |= QArenaScopePrivate::ArenaBlockFlag;
         header->alloc = uint(capacity);
         dataPointer = reinterpret_cast<char *>(header) + offset;
     }
@@ -229,6 +375,12 @@ void QArrayData::deallocate(QArrayData *data, qsizetype objectSize,
     Q_UNUSED(objectSize);
     Q_UNUSED(alignment);
 
+    if (data && (data->flags & QArenaScopePrivate::ArenaBlockFlag))
+        return; // released with the arena
+#if QT_CONFIG(arraydata_cache)
+    if (data && recycleCachedData(data))
+        return;
+#endif
     ::free(data);
 }
 
@@ -562,17 +562,27 @@ quint32 QBitArray::toUInt32(QSysInfo::Endian endianness, bool *ok) const noexcep
     \sa operator&(), operator|=(), operator^=(), operator~()
 */
 
+// Applies \a op to \a n bytes of \a dst and \a src, storing the result in
+// \a dst. The bytes are processed 64 bits at a time where possible.
+template <typename Op>
+static inline void bitwiseOperation(uchar *dst, const uchar *src, int n, Op op)
+{
+    for (; n >= 8; n -= 8, dst += 8, src += 8)
+        qToUnaligned(op(qFromUnaligned<quint64>(dst), qFromUnaligned<quint64>(src)), dst);
+    for (; n > 0; --n, ++dst, ++src)
+        *dst = uchar(op(*dst, *src));
+}
+
 QBitArray &QBitArray::operator&=(const QBitArray &other)
 {
     resize(qMax(size(), other.size()));
     uchar *a1 = reinterpret_cast<uchar*>(d.data()) + 1;
     const uchar *a2 = reinterpret_cast<const uchar*>(other.d.constData()) + 1;
-    int n = other.d.size() -1 ;
+    int n = qMax(other.d.size() - 1, 0);
     int p = d.size() - 1 - n;
-    while (n-- > 0)
-        *a1++ &= *a2++;
-    while (p-- > 0)
-        *a1++ = 0;
+    bitwiseOperation(a1, a2, n, [](auto x, auto y) { return x & y; });
+    if (p > 0)
+        memset(a1 + n, 0, p);
     return *this;
 }
 
@@ -597,8 +607,7 @@ QBitArray &QBitArray::operator|=(const QBitArray &other)
     uchar *a1 = reinterpret_cast<uchar*>(d.data()) + 1;
     const uchar *a2 = reinterpret_cast<const uchar *>(other.d.constData()) + 1;
     int n = other.d.size() - 1;
-    while (n-- > 0)
-        *a1++ |= *a2++;
+    bitwiseOperation(a1, a2, n, [](auto x, auto y) { return x | y; });
     return *this;
 }
 
@@ -623,8 +632,7 @@ QBitArray &QBitArray::operator^=(const QBitArray &other)
     uchar *a1 = reinterpret_cast<uchar*>(d.data()) + 1;
     const uchar *a2 = reinterpret_cast<const uchar *>(other.d.constData()) + 1;
     int n = other.d.size() - 1;
-    while (n-- > 0)
-        *a1++ ^= *a2++;
+    bitwiseOperation(a1, a2, n, [](auto x, auto y) { return x ^ y; });
     return *this;
 }
 
@@ -646,6 +654,8 @@ QBitArray QBitArray::operator~() const
     uchar *a2 = reinterpret_cast<uchar*>(a.d.data()) + 1;
     int n = d.size() - 1;
 
+    for (; n >= 8; n -= 8, a1 += 8, a2 += 8)
+        qToUnaligned(~qFromUnaligned<quint64>(a1), a2);
     while (n-- > 0)
         *a2++ = ~*a1++;
 
@@ -0,0 +1,278 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QCONCURRENTCACHE_P_H
+#define QCONCURRENTCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of a number of Qt sources files.  This header file may change from
+// version to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qreadwritelock.h>
+#include <QtCore/qsharedpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+// A cache that can be shared between threads without an external lock.
+//
+// Entries are spread over ShardCount independent segments by hash, each
+// with its own lock and its own share of the cost budget. Lookups take
+// the segment's lock for reading only: eviction uses the CLOCK algorithm,
+// so a hit sets a per-entry reference bit (if not already set) instead of
+// relinking a list. Objects are handed out as QSharedPointer so that an
+// entry evicted by another thread stays alive while it is in use.
+//
+// object(), contains() and remove() accept any type that compares equal
+// to Key and hashes like it, e.g. QStringView for a QString key or
+// QByteArrayView for a QByteArray key, so no temporary key is allocated.
+template <class Key, class T, int ShardCount = 16>
+class QConcurrentCache
+{
+    static_assert(ShardCount > 0, "QConcurrentCache needs at least one shard");
+
+    struct Node
+    {
+        Key key;
+        size_t hash;
+        QSharedPointer<T> object;
+        int cost;
+        qsizetype slot;
+        mutable QBasicAtomicInt referenced;
+    };
+
+    struct alignas(64) Shard
+    {
+        mutable QReadWriteLock lock;
+        QMultiHash<size_t, Node *> index;
+        QList<Node *> clock;
+        qsizetype hand = 0;
+        int total = 0;
+
+        ~Shard() { clear(); }
+
+        template <typename K>
+        Node *find(const K &key, size_t hash) const
+        {
+            const auto range = index.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if ((*it)->key == key)
+                    return *it;
+            }
+            return nullptr;
+        }
+
+        void unlink(Node *n)
+        {
+            const auto range = index.equal_range(n->hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (*it == n) {
+                    index.erase(it);
+                    break;
+                }
+            }
+            // keep the clock dense: move the last entry into the freed slot
+            Node *last = clock.takeLast();
+            if (last != n) {
+                clock[n->slot] = last;
+                last->slot = n->slot;
+            }
+            if (hand >= clock.size())
+                hand = 0;
+            total -= n->cost;
+            delete n;
+        }
+
+        void trim(int budget)
+        {
+            while (total > budget && !clock.isEmpty()) {
+                Node *n = clock.at(hand);
+                if (n->referenced.loadRelaxed()) {
+                    // second chance
+                    n->referenced.storeRelaxed(0);
+                    hand = (hand + 1) % clock.size();
+                } else {
+                    unlink(n);
+                }
+            }
+        }
+
+        void clear()
+        {
+            qDeleteAll(clock);
+            clock.clear();
+            index.clear();
+            hand = 0;
+            total = 0;
+        }
+    };
+
+    Shard shards[ShardCount];
+    QAtomicInt mx;
+    const size_t seed;
+
+    template <typename K>
+    size_t hashOf(const K &key) const { return qHash(key, seed); }
+    // the low bits select the bucket inside the shard's own hash
+    static size_t shardIndex(size_t hash) { return ((hash >> 16) ^ (hash >> 8)) % ShardCount; }
+    Shard &shardFor(size_t hash) { return shards[shardIndex(hash)]; }
+    const Shard &shardFor(size_t hash) const { return shards[shardIndex(hash)]; }
+
+public:
+    explicit QConcurrentCache(int maxCost = 100)
+        : mx(maxCost), seed(size_t(qGlobalQHashSeed()))
+    {}
+    Q_DISABLE_COPY(QConcurrentCache)
+
+    // The budget is split evenly between the shards, so a single shard
+    // holds at most maxCost() / ShardCount worth of objects.
+    int maxCost() const noexcept { return mx.loadRelaxed(); }
+    void setMaxCost(int m)
+    {
+        mx.storeRelaxed(m);
+        for (Shard &shard : shards) {
+            QWriteLocker locker(&shard.lock);
+            shard.trim(m / ShardCount);
+        }
+    }
+
+    int totalCost() const
+    {
+        int total = 0;
+        for (const Shard &shard : shards) {
+            QReadLocker locker(&shard.lock);
+            total += shard.total;
+        }
+        return total;
+    }
+
+    qsizetype size() const
+    {
+        qsizetype count = 0;
+        for (const Shard &shard : shards) {
+            QReadLocker locker(&shard.lock);
+            count += shard.clock.size();
+        }
+        return count;
+    }
+
+    void clear()
+    {
+        for (Shard &shard : shards) {
+            QWriteLocker locker(&shard.lock);
+            shard.clear();
+        }
+    }
+
+    // Takes ownership of \a object. Returns false (and deletes the object)
+    // if \a cost exceeds the budget of a single shard.
+    bool insert(const Key &key, T *object, int cost = 1)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        const int budget = maxCost() / ShardCount;
+        QWriteLocker locker(&shard.lock);
+        if (Node *old = shard.find(key, hash))
+            shard.unlink(old);
+        if (cost > budget) {
+            locker.unlock();
+            delete object;
+            return false;
+        }
+        shard.trim(budget - cost);
+
+        Node *n = new Node{key, hash, QSharedPointer<T>(object), cost, shard.clock.size(),
+                           Q_BASIC_ATOMIC_INITIALIZER(0)};
+        shard.clock.append(n);
+        shard.index.insert(hash, n);
+        shard.total += cost;
+        return true;
+    }
+
+    template <typename K>
+    QSharedPointer<T> object(const K &key) const
+    {
+        const size_t hash = hashOf(key);
+        const Shard &shard = shardFor(hash);
+        QReadLocker locker(&shard.lock);
+        const Node *n = shard.find(key, hash);
+        if (!n)
+            return QSharedPointer<T>();
+        // avoid dirtying the cache line on repeated hits
+        if (!n->referenced.loadRelaxed())
+            n->referenced.storeRelaxed(1);
+        return n->object;
+    }
+
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        const size_t hash = hashOf(key);
+        const Shard &shard = shardFor(hash);
+        QReadLocker locker(&shard.lock);
+        return shard.find(key, hash) != nullptr;
+    }
+
+    template <typename K>
+    bool remove(const K &key)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QWriteLocker locker(&shard.lock);
+        Node *n = shard.find(key, hash);
+        if (!n)
+            return false;
+        shard.unlink(n);
+        return true;
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTCACHE_P_H
@@ -490,7 +490,8 @@ bool QCryptographicHash::addData(QIODevice* device)
     if (!device->isOpen())
         return false;
 
-    char buffer[1024];
+    // as large as QIODevice's read buffer, so reads go straight into ours
+    char buffer[16 * 1024];
     int length;
 
     while ((length = device->read(buffer,sizeof(buffer))) > 0)
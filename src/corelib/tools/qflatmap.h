@@ -37,21 +37,10 @@
 **
 ****************************************************************************/
 
-#ifndef QFLATMAP_P_H
-#define QFLATMAP_P_H
-
-//
-//  W A R N I N G
-//  -------------
-//
-// This file is not part of the Qt API.  It exists for the convenience
-// of a number of Qt sources files.  This header file may change from
-// version to version without notice, or even be removed.
-//
-// We mean it.
-//
-
-#include "qlist.h"
+#ifndef QFLATMAP_H
+#define QFLATMAP_H
+
+#include <QtCore/qlist.h>
 
 #include <algorithm>
 #include <functional>
@@ -64,19 +53,6 @@
 
 QT_BEGIN_NAMESPACE
 
-/*
-  QFlatMap provides an associative container backed by sorted sequential
-  containers. By default, QList is used.
-
-  Keys and values are stored in two separate containers. This provides improved
-  cache locality for key iteration and makes keys() and values() fast
-  operations.
-
-  One can customize the underlying container type by passing the KeyContainer
-  and MappedContainer template arguments:
-      QFlatMap<float, int, std::less<float>, std::vector<float>, std::vector<int>>
-*/
-
 namespace Qt {
 
 struct OrderedUniqueRange_t {};
@@ -417,7 +393,7 @@ private:
     struct is_marked_transparent_type : std::false_type { };
 
     template <class X>
-    struct is_marked_transparent_type<X, typename X::is_transparent> : std::true_type { };
+    struct is_marked_transparent_type<X, std::void_t<typename X::is_transparent>> : std::true_type { };
 
     template <class X>
     using is_marked_transparent = typename std::enable_if<
@@ -614,13 +590,13 @@ public:
 
     bool remove(const Key &key)
     {
-        auto it = binary_find(key);
-        if (it != end()) {
-            c.keys.erase(toKeysIterator(it));
-            c.values.erase(toValuesIterator(it));
-            return true;
-        }
-        return false;
+        return do_remove(binary_find(key));
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    bool remove(const X &key)
+    {
+        return do_remove(binary_find(key));
     }
 
     iterator erase(iterator it)
@@ -631,13 +607,13 @@ public:
 
     T take(const Key &key)
     {
-        auto it = binary_find(key);
-        if (it != end()) {
-            T result = std::move(it.value());
-            erase(it);
-            return result;
-        }
-        return {};
+        return do_take(binary_find(key));
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    T take(const X &key)
+    {
+        return do_take(binary_find(key));
     }
 
     bool contains(const Key &key) const
@@ -645,18 +621,38 @@ public:
         return binary_find(key) != end();
     }
 
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    bool contains(const X &key) const
+    {
+        return binary_find(key) != end();
+    }
+
     T value(const Key &key, const T &defaultValue) const
     {
         auto it = binary_find(key);
         return it == end() ? defaultValue : it.value();
     }
 
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    T value(const X &key, const T &defaultValue) const
+    {
+        auto it = binary_find(key);
+        return it == end() ? defaultValue : it.value();
+    }
+
     T value(const Key &key) const
     {
         auto it = binary_find(key);
         return it == end() ? T() : it.value();
     }
 
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    T value(const X &key) const
+    {
+        auto it = binary_find(key);
+        return it == end() ? T() : it.value();
+    }
+
     T &operator[](const Key &key)
     {
         auto it = lower_bound(key);
@@ -700,7 +696,7 @@ public:
         auto it = lower_bound(key);
         if (it == end() || key_compare::operator()(key, it.key())) {
             c.values.insert(toValuesIterator(it), value);
-            return { c.keys.insert(it, std::move(key)), true };
+            return { fromKeysIterator(c.keys.insert(toKeysIterator(it), std::move(key))), true };
         } else {
             *toValuesIterator(it) = value;
             return {it, false};
@@ -712,7 +708,7 @@ public:
         auto it = lower_bound(key);
         if (it == end() || key_compare::operator()(key, it.key())) {
             c.values.insert(toValuesIterator(it), std::move(value));
-            return { c.keys.insert(it, key), true };
+            return { fromKeysIterator(c.keys.insert(toKeysIterator(it), key)), true };
         } else {
             *toValuesIterator(it) = std::move(value);
             return {it, false};
@@ -814,6 +810,18 @@ public:
         return binary_find(k);
     }
 
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    iterator find(const X &k)
+    {
+        return binary_find(k);
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    const_iterator find(const X &k) const
+    {
+        return binary_find(k);
+    }
+
     key_compare key_comp() const noexcept
     {
         return static_cast<key_compare>(*this);
@@ -904,12 +912,34 @@ private:
         makeUnique();
     }
 
-    iterator binary_find(const Key &key)
+    bool do_remove(iterator it)
+    {
+        if (it != end()) {
+            c.keys.erase(toKeysIterator(it));
+            c.values.erase(toValuesIterator(it));
+            return true;
+        }
+        return false;
+    }
+
+    T do_take(iterator it)
+    {
+        if (it != end()) {
+            T result = std::move(it.value());
+            erase(it);
+            return result;
+        }
+        return {};
+    }
+
+    template <class X>
+    iterator binary_find(const X &key)
     {
         return { &c, const_cast<const full_map_t *>(this)->binary_find(key).i };
     }
 
-    const_iterator binary_find(const Key &key) const
+    template <class X>
+    const_iterator binary_find(const X &key) const
     {
         auto it = lower_bound(key);
         if (it != end()) {
@@ -949,26 +979,27 @@ private:
         }
     }
 
+    // Removes all but the last of each run of equivalent keys, in one pass.
+    // The keys must be sorted.
     void makeUnique()
     {
-        if (c.keys.size() < 2)
+        const size_type s = c.keys.size();
+        if (s < 2)
             return;
-        auto k = std::end(c.keys) - 1;
-        auto i = k - 1;
-        for (;;) {
-            if (key_compare::operator()(*i, *k) || key_compare::operator()(*k, *i)) {
-                if (i == std::begin(c.keys))
-                    break;
-                --i;
-                --k;
-            } else {
-                c.values.erase(std::begin(c.values) + std::distance(std::begin(c.keys), i));
-                i = c.keys.erase(i);
-                if (i == std::begin(c.keys))
-                    break;
-                k = i + 1;
+        size_type out = 0;
+        for (size_type i = 0; i < s; ++i) {
+            if (i + 1 < s && !key_compare::operator()(c.keys[i], c.keys[i + 1]))
+                continue;
+            if (out != i) {
+                c.keys[out] = std::move(c.keys[i]);
+                c.values[out] = std::move(c.values[i]);
             }
+            ++out;
         }
+        if (out == s)
+            return;
+        c.keys.erase(std::begin(c.keys) + out, std::end(c.keys));
+        c.values.erase(std::begin(c.values) + out, std::end(c.values));
         c.keys.shrink_to_fit();
         c.values.shrink_to_fit();
     }
@@ -978,4 +1009,4 @@ private:
 
 QT_END_NAMESPACE
 
-#endif // QFLATMAP_P_H
+#endif // QFLATMAP_H
@@ -46,6 +46,7 @@
 #include <QtCore/qlist.h>
 #include <QtCore/qmath.h>
 #include <QtCore/qrefcount.h>
+#include <QtCore/qsimd.h>
 
 #include <initializer_list>
 
@@ -243,14 +244,22 @@ constexpr bool isRelocatable()
 // actual storage space for the Nodes (the 'entries' member) or 0xff (UnusedEntry) to flag that the bucket is empty.
 // As we have only 128 entries per Span, the offset array can be represented using an unsigned char. This trick makes the hash
 // table have a very small memory overhead compared to many other implementations.
+//
+// In addition, each bucket has a tag byte holding the top 7 bits of the hash of its key, or 0x80 (UnusedTag) if the bucket
+// is empty. Lookups compare the tags of a whole group of GroupSize buckets at once (using SSE2 or NEON where available), and
+// only compare the keys of the buckets whose tags match, up to the first empty bucket.
 template<typename Node>
 struct Span {
     enum {
         NEntries = 128,
         LocalBucketMask = (NEntries - 1),
-        UnusedEntry = 0xff
+        UnusedEntry = 0xff,
+        UnusedTag = 0x80,
+        GroupSize = 16,
+        GroupMask = (GroupSize - 1)
     };
     static_assert ((NEntries & LocalBucketMask) == 0, "EntriesPerSpan must be a power of two.");
+    static_assert ((NEntries % GroupSize) == 0, "EntriesPerSpan must be a multiple of the group size.");
 
     // Entry is a slot available for storing a Node. The Span holds a pointer to
     // an array of Entries. Upon construction of the array, those entries are
@@ -265,14 +274,56 @@ struct Span {
         Node &node() { return *reinterpret_cast<Node *>(&storage); }
     };
 
+    alignas(GroupSize) unsigned char tags[NEntries];
     unsigned char offsets[NEntries];
     Entry *entries = nullptr;
     unsigned char allocated = 0;
     unsigned char nextFree = 0;
     Span() noexcept
     {
+        memset(tags, UnusedTag, sizeof(tags));
         memset(offsets, UnusedEntry, sizeof(offsets));
     }
+
+    static constexpr unsigned char tagForHash(size_t hash) noexcept
+    {
+        // the low bits select the bucket, so take the tag from the high bits
+        return static_cast<unsigned char>(hash >> (8 * sizeof(size_t) - 7));
+    }
+
+    struct GroupMatch {
+        uint matches; // bit i is set if bucket group + i has the tag
+        uint unused; // bit i is set if bucket group + i is empty
+    };
+    GroupMatch matchGroup(size_t group, unsigned char tag) const noexcept
+    {
+        Q_ASSERT((group & GroupMask) == 0);
+        const unsigned char *t = tags + group;
+#if QT_COMPILER_USES(sse2)
+        const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(t));
+        const uint matches = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(char(tag))));
+        // UnusedTag is the only tag with the high bit set
+        const uint unused = _mm_movemask_epi8(v);
+        return { matches, unused };
+#elif QT_COMPILER_USES(neon) && defined(Q_PROCESSOR_ARM_64)
+        static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8x16_t v = vld1q_u8(t);
+        const uint8x16_t b = vld1q_u8(bits);
+        const uint8x16_t m = vandq_u8(vceqq_u8(v, vdupq_n_u8(tag)), b);
+        const uint8x16_t u = vandq_u8(vceqq_u8(v, vdupq_n_u8(UnusedTag)), b);
+        const uint matches = vaddv_u8(vget_low_u8(m)) | (uint(vaddv_u8(vget_high_u8(m))) << 8);
+        const uint unused = vaddv_u8(vget_low_u8(u)) | (uint(vaddv_u8(vget_high_u8(u))) << 8);
+        return { matches, unused };
+#else
+        GroupMatch m = { 0, 0 };
+        for (uint i = 0; i < GroupSize; ++i) {
+            m.matches |= uint(t[i] == tag) << i;
+            m.unused |= uint(t[i] == UnusedTag) << i;
+        }
+        return m;
+#endif
+    }
+
     ~Span()
     {
         freeData();
@@ -290,16 +341,18 @@ struct Span {
             entries = nullptr;
         }
     }
-    Node *insert(size_t i)
+    Node *insert(size_t i, unsigned char tag)
     {
         Q_ASSERT(i <= NEntries);
         Q_ASSERT(offsets[i] == UnusedEntry);
+        Q_ASSERT(tag < UnusedTag);
         if (nextFree == allocated)
             addStorage();
         unsigned char entry = nextFree;
         Q_ASSERT(entry < allocated);
         nextFree = entries[entry].nextFree();
         offsets[i] = entry;
+        tags[i] = tag;
         return &entries[entry].node();
     }
     void erase(size_t bucket) noexcept(std::is_nothrow_destructible<Node>::value)
@@ -309,6 +362,7 @@ struct Span {
 
         unsigned char entry = offsets[bucket];
         offsets[bucket] = UnusedEntry;
+        tags[bucket] = UnusedTag;
 
         entries[entry].node().~Node();
         entries[entry].nextFree() = nextFree;
@@ -318,6 +372,10 @@ struct Span {
     {
         return offsets[i];
     }
+    unsigned char tag(size_t i) const noexcept
+    {
+        return tags[i];
+    }
     bool hasNode(size_t i) const noexcept
     {
         return (offsets[i] != UnusedEntry);
@@ -354,6 +412,8 @@ struct Span {
         Q_ASSERT(offsets[to] == UnusedEntry);
         offsets[to] = offsets[from];
         offsets[from] = UnusedEntry;
+        tags[to] = tags[from];
+        tags[from] = UnusedTag;
     }
     void moveFromSpan(Span &fromSpan, size_t fromIndex, size_t to) noexcept(std::is_nothrow_move_constructible_v<Node>)
     {
@@ -365,11 +425,13 @@ struct Span {
             addStorage();
         Q_ASSERT(nextFree < allocated);
         offsets[to] = nextFree;
+        tags[to] = fromSpan.tags[fromIndex];
         Entry &toEntry = entries[nextFree];
         nextFree = toEntry.nextFree();
 
         size_t fromOffset = fromSpan.offsets[fromIndex];
         fromSpan.offsets[fromIndex] = UnusedEntry;
+        fromSpan.tags[fromIndex] = UnusedTag;
         Entry &fromEntry = fromSpan.entries[fromOffset];
 
         if constexpr (isRelocatable<Node>()) {
@@ -450,16 +512,23 @@ struct Data
         bool resized = numBuckets != other.numBuckets;
         size_t nSpans = (numBuckets + Span::LocalBucketMask) / Span::NEntries;
         spans = new Span[nSpans];
+        size_t otherNSpans = (other.numBuckets + Span::LocalBucketMask) / Span::NEntries;
 
-        for (size_t s = 0; s < nSpans; ++s) {
+        for (size_t s = 0; s < otherNSpans; ++s) {
             const Span &span = other.spans[s];
             for (size_t index = 0; index < Span::NEntries; ++index) {
                 if (!span.hasNode(index))
                     continue;
                 const Node &n = span.at(index);
-                iterator it = resized ? find(n.key) : iterator{ this, s*Span::NEntries + index };
+                unsigned char tag = span.tag(index);
+                iterator it{ this, s*Span::NEntries + index };
+                if (resized) {
+                    size_t hash = qHash(n.key, seed);
+                    tag = Span::tagForHash(hash);
+                    it = find(n.key, hash);
+                }
                 Q_ASSERT(it.isUnused());
-                Node *newNode = spans[it.span()].insert(it.index());
+                Node *newNode = spans[it.span()].insert(it.index(), tag);
                 new (newNode) Node(n);
             }
         }
@@ -521,9 +590,10 @@ struct Data
                 if (!span.hasNode(index))
                     continue;
                 Node &n = span.at(index);
-                iterator it = find(n.key);
+                size_t hash = qHash(n.key, seed);
+                iterator it = find(n.key, hash);
                 Q_ASSERT(it.isUnused());
-                Node *newNode = spans[it.span()].insert(it.index());
+                Node *newNode = spans[it.span()].insert(it.index(), Span::tagForHash(hash));
                 new (newNode) Node(std::move(n));
             }
             span.freeData();
@@ -549,27 +619,41 @@ struct Data
     }
 
     iterator find(const Key &key) const noexcept
+    {
+        return find(key, qHash(key, seed));
+    }
+
+    iterator find(const Key &key, size_t hash) const noexcept
     {
         Q_ASSERT(numBuckets > 0);
-        size_t hash = qHash(key, seed);
+        const unsigned char tag = Span::tagForHash(hash);
         size_t bucket = GrowthPolicy::bucketForHash(numBuckets, hash);
-        // loop over the buckets until we find the entry we search for
+        // loop over the groups of buckets until we find the entry we search for
         // or an empty slot, in which case we know the entry doesn't exist
         while (true) {
             // Split the bucket into the indexex of span array, and the local
             // offset inside the span
             size_t span = bucket / Span::NEntries;
             size_t index = bucket & Span::LocalBucketMask;
-            Span &s = spans[span];
-            size_t offset = s.offset(index);
-            if (offset == Span::UnusedEntry) {
-                return iterator{ this, bucket };
-            } else {
-                Node &n = s.atOffset(offset);
-                if (n.key == key)
-                    return iterator{ this, bucket };
+            size_t skip = index & Span::GroupMask;
+            const Span &s = spans[span];
+            auto [matches, unused] = s.matchGroup(index - skip, tag);
+            matches >>= skip;
+            unused >>= skip;
+            // only the buckets before the first empty one are part of the probe sequence
+            if (unused)
+                matches &= (1u << qCountTrailingZeroBits(unused)) - 1;
+            while (matches) {
+                size_t candidate = index + qCountTrailingZeroBits(matches);
+                if (s.atOffset(s.offset(candidate)).key == key)
+                    return iterator{ this, bucket + (candidate - index) };
+                matches &= matches - 1;
             }
-            bucket = nextBucket(bucket);
+            if (unused)
+                return iterator{ this, bucket + qCountTrailingZeroBits(unused) };
+            bucket += Span::GroupSize - skip;
+            if (bucket == numBuckets)
+                bucket = 0;
         }
     }
 
@@ -592,9 +676,10 @@ struct Data
     {
         if (shouldGrow())
             rehash(size + 1);
-        iterator it = find(key);
+        size_t hash = qHash(key, seed);
+        iterator it = find(key, hash);
         if (it.isUnused()) {
-            spans[it.span()].insert(it.index());
+            spans[it.span()].insert(it.index(), Span::tagForHash(hash));
             ++size;
             return { it, false };
         }
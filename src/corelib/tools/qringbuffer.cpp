@@ -330,6 +330,33 @@ qint64 QRingBuffer::peek(char *data, qint64 maxLength, qint64 pos) const
     return readSoFar;
 }
 
+/*!
+    \internal
+
+    Fills \a chunks with views on up to \a maxCount leading chunks of
+    the buffer, covering at most \a maxLength bytes, and returns the
+    number of views stored. The views stay valid until the buffer is
+    next modified.
+*/
+int QRingBuffer::peekChunks(QByteArrayView *chunks, int maxCount, qint64 maxLength) const
+{
+    Q_ASSERT(maxCount >= 0 && maxLength >= 0);
+
+    int count = 0;
+    for (const QRingChunk &chunk : buffers) {
+        if (count == maxCount || maxLength == 0)
+            break;
+
+        const qint64 blockLength = qMin(qint64(chunk.size()), maxLength);
+        if (blockLength == 0)
+            continue;
+        chunks[count++] = QByteArrayView(chunk.data(), blockLength);
+        maxLength -= blockLength;
+    }
+
+    return count;
+}
+
 /*!
     \internal
 
@@ -142,6 +142,7 @@ public:
     void error(const QString &message);
 
     bool appendVariantInternal(const QVariant &arg);
+    bool appendFixedArray(const QVariant &arg, const char *signature);
     bool appendRegisteredType(const QVariant &arg);
     bool appendCrossMarshalling(QDBusDemarshaller *arg);
 
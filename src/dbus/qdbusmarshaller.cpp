@@ -54,6 +54,18 @@ static void qIterAppend(DBusMessageIter *it, QByteArray *ba, int type, const voi
         q_dbus_message_iter_append_basic(it, type, arg);
 }
 
+template <typename T>
+static void qIterAppendFixedArray(DBusMessageIter *it, int element, const void *data)
+{
+    const QList<T> &list = *static_cast<const QList<T> *>(data);
+    const T *cdata = list.constData();
+    const char signature[2] = { char(element), 0 };
+    DBusMessageIter subiterator;
+    q_dbus_message_iter_open_container(it, DBUS_TYPE_ARRAY, signature, &subiterator);
+    q_dbus_message_iter_append_fixed_array(&subiterator, element, &cdata, list.size());
+    q_dbus_message_iter_close_container(it, &subiterator);
+}
+
 QDBusMarshaller::~QDBusMarshaller()
 {
     close();
@@ -495,7 +507,8 @@ bool QDBusMarshaller::appendVariantInternal(const QVariant &arg)
             return true;
 
         default:
-            ;
+            if (appendFixedArray(arg, signature))
+                return true;
         }
         Q_FALLTHROUGH();
 
@@ -524,6 +537,35 @@ bool QDBusMarshaller::appendVariantInternal(const QVariant &arg)
     return true;
 }
 
+bool QDBusMarshaller::appendFixedArray(const QVariant &arg, const char *signature)
+{
+    // Lists of fixed size types have the same memory layout as their D-Bus
+    // representation, so append them in one go instead of going through the
+    // registered marshalling operator element by element.
+    if (ba || signature[1] == '\0' || signature[2] != '\0')
+        return false;
+
+    const int id = arg.userType();
+    const int element = signature[1];
+    if (element == DBUS_TYPE_INT16 && id == qMetaTypeId<QList<short> >())
+        qIterAppendFixedArray<short>(&iterator, element, arg.constData());
+    else if (element == DBUS_TYPE_UINT16 && id == qMetaTypeId<QList<ushort> >())
+        qIterAppendFixedArray<ushort>(&iterator, element, arg.constData());
+    else if (element == DBUS_TYPE_INT32 && id == qMetaTypeId<QList<int> >())
+        qIterAppendFixedArray<int>(&iterator, element, arg.constData());
+    else if (element == DBUS_TYPE_UINT32 && id == qMetaTypeId<QList<uint> >())
+        qIterAppendFixedArray<uint>(&iterator, element, arg.constData());
+    else if (element == DBUS_TYPE_INT64 && id == qMetaTypeId<QList<qlonglong> >())
+        qIterAppendFixedArray<qlonglong>(&iterator, element, arg.constData());
+    else if (element == DBUS_TYPE_UINT64 && id == qMetaTypeId<QList<qulonglong> >())
+        qIterAppendFixedArray<qulonglong>(&iterator, element, arg.constData());
+    else if (element == DBUS_TYPE_DOUBLE && id == qMetaTypeId<QList<double> >())
+        qIterAppendFixedArray<double>(&iterator, element, arg.constData());
+    else
+        return false;
+    return true;
+}
+
 bool QDBusMarshaller::appendRegisteredType(const QVariant &arg)
 {
     ref.ref();                  // reference up
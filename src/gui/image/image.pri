@@ -7,6 +7,7 @@ HEADERS += \
         image/qbitmap.h \
         image/qimage.h \
         image/qimage_p.h \
+        image/qimagecache_p.h \
         image/qimageiohandler.h \
         image/qimagereader.h \
         image/qimagereaderwriterhelpers_p.h \
@@ -34,6 +35,7 @@ SOURCES += \
         image/qbitmap.cpp \
         image/qimage.cpp \
         image/qimage_conversions.cpp \
+        image/qimagecache.cpp \
         image/qimageiohandler.cpp \
         image/qimagereader.cpp \
         image/qimagereaderwriterhelpers.cpp \
@@ -50,6 +50,7 @@
 #include <QtCore/qmath.h>
 #include <QtCore/QList>
 #include <QtCore/QDir>
+#include <QtCore/QDirIterator>
 #if QT_CONFIG(settings)
 #include <QtCore/QSettings>
 #endif
@@ -340,6 +341,45 @@ QList<const char *> QIconCacheGtkReader::lookup(QStringView name)
     return ret;
 }
 
+/*!
+    \internal
+    Index of the png and svg files in the subdirectories of a theme directory
+    that has no usable icon-theme.cache. Each subdirectory is listed once, so
+    that looking up icon names afterwards does not stat every candidate file.
+    A lookup returns, for each subdirectory containing the icon, its index in
+    the theme's key list shifted left by 2, or'ed with the file types found.
+*/
+class QIconDirIndex
+{
+public:
+    enum FileType { Png = 0x1, Svg = 0x2 };
+
+    QIconDirIndex(const QString &themeDir, const QList<QIconDirInfo> &subDirs);
+    QList<quint32> lookup(QStringView name) const { return m_entries.value(name.toString()); }
+
+private:
+    QHash<QString, QList<quint32>> m_entries;
+};
+
+QIconDirIndex::QIconDirIndex(const QString &themeDir, const QList<QIconDirInfo> &subDirs)
+{
+    const QStringList nameFilters{QStringLiteral("*.png"), QStringLiteral("*.svg")};
+    for (int j = 0; j < subDirs.size(); ++j) {
+        QDirIterator it(themeDir + subDirs.at(j).path, nameFilters,
+                        QDir::Files | QDir::CaseSensitive);
+        while (it.hasNext()) {
+            it.next();
+            const QString fileName = it.fileName();
+            const quint32 type = fileName.endsWith(QLatin1String(".png")) ? Png : Svg;
+            QList<quint32> &entries = m_entries[fileName.left(fileName.size() - 4)];
+            if (!entries.isEmpty() && (entries.last() >> 2) == quint32(j))
+                entries.last() |= type;
+            else
+                entries.append(quint32(j) << 2 | type);
+        }
+    }
+}
+
 QIconTheme::QIconTheme(const QString &themeName)
         : m_valid(false)
 {
@@ -354,6 +394,7 @@ QIconTheme::QIconTheme(const QString &themeName)
         if (themeDirInfo.isDir()) {
             m_contentDirs << themeDir;
             m_gtkCaches << QSharedPointer<QIconCacheGtkReader>::create(themeDir);
+            m_dirIndexes << QSharedPointer<QIconDirIndex>();
         }
 
         if (!m_valid) {
@@ -453,6 +494,7 @@ QThemeIconInfo QIconLoader::findIconHelper(const QString &themeName,
         // Add all relevant files
         for (int i = 0; i < contentDirs.size(); ++i) {
             QList<QIconDirInfo> subDirs = theme.keyList();
+            QString contentDir = contentDirs.at(i) + QLatin1Char('/');
 
             // Try to reduce the amount of subDirs by looking in the GTK+ cache in order to save
             // a massive amount of file stat (especially if the icon is not there)
@@ -473,9 +515,33 @@ QThemeIconInfo QIconLoader::findIconHelper(const QString &themeName,
                         }
                     }
                 }
+            } else {
+                // Without a cache, list the theme's subdirectories once and look
+                // the icon up in that listing instead of probing for every file
+                QSharedPointer<QIconDirIndex> &index = theme.m_dirIndexes[i];
+                if (!index)
+                    index = QSharedPointer<QIconDirIndex>::create(contentDir, subDirs);
+                const QList<quint32> result = index->lookup(iconNameFallback);
+                for (quint32 entry : result) {
+                    const QIconDirInfo &dirInfo = subDirs.at(entry >> 2);
+                    const QString subDir = contentDir + dirInfo.path + QLatin1Char('/');
+                    if (entry & QIconDirIndex::Png) {
+                        PixmapEntry *iconEntry = new PixmapEntry;
+                        iconEntry->dir = dirInfo;
+                        iconEntry->filename = subDir + pngIconName;
+                        // Notice we ensure that pixmap entries always come before
+                        // scalable to preserve search order afterwards
+                        info.entries.prepend(iconEntry);
+                    } else if (m_supportsSvg && (entry & QIconDirIndex::Svg)) {
+                        ScalableEntry *iconEntry = new ScalableEntry;
+                        iconEntry->dir = dirInfo;
+                        iconEntry->filename = subDir + svgIconName;
+                        info.entries.append(iconEntry);
+                    }
+                }
+                continue;
             }
 
-            QString contentDir = contentDirs.at(i) + QLatin1Char('/');
             for (int j = 0; j < subDirs.size() ; ++j) {
                 const QIconDirInfo &dirInfo = subDirs.at(j);
                 const QString subDir = contentDir + dirInfo.path + QLatin1Char('/');
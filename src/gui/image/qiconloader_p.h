@@ -149,6 +149,7 @@ private:
 };
 
 class QIconCacheGtkReader;
+class QIconDirIndex;
 
 class QIconTheme
 {
@@ -166,6 +167,7 @@ private:
     bool m_valid;
 public:
     QList<QSharedPointer<QIconCacheGtkReader>> m_gtkCaches;
+    QList<QSharedPointer<QIconDirIndex>> m_dirIndexes; // built on demand, when there is no GTK+ cache
 };
 
 class Q_GUI_EXPORT QIconLoader
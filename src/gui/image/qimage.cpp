@@ -94,6 +94,36 @@ static inline bool isLocked(QImageData *data)
     }
 
 
+// Runs processSegment(start, end) over [0, count), where the work covers nbytes bytes of
+// image data. Large images are split into segments that are processed in parallel on
+// the thread pool.
+template <typename Function>
+static void processInSegments(int count, qsizetype nbytes, Function processSegment)
+{
+#if QT_CONFIG(thread) && !defined(Q_OS_WASM)
+    int segments = nbytes / (1<<16);
+    segments = std::min(segments, count);
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    if (segments > 1 && !threadPool->contains(QThread::currentThread())) {
+        QSemaphore semaphore;
+        int start = 0;
+        for (int i = 0; i < segments; ++i) {
+            int n = (count - start) / (segments - i);
+            threadPool->start([&, start, n]() {
+                processSegment(start, start + n);
+                semaphore.release(1);
+            });
+            start += n;
+        }
+        semaphore.acquire(segments);
+        return;
+    }
+#else
+    Q_UNUSED(nbytes);
+#endif
+    processSegment(0, count);
+}
+
 static QImage rotated90(const QImage &src);
 static QImage rotated180(const QImage &src);
 static QImage rotated270(const QImage &src);
@@ -4418,6 +4448,15 @@ QImage QImage::smoothScaled(int w, int h) const {
     return src;
 }
 
+// The 90 and 270 degree rotations work on tiles; keep each parallel band of
+// source columns a whole number of tiles wide.
+enum { RotationBandWidth = 32 };
+
+static inline int bands(int width)
+{
+    return (width + RotationBandWidth - 1) / RotationBandWidth;
+}
+
 static QImage rotated90(const QImage &image)
 {
     QImage out(image.height(), image.width(), image.format());
@@ -4428,7 +4467,17 @@ static QImage rotated90(const QImage &image)
     int h = image.height();
     const MemRotateFunc memrotate = qMemRotateFunctions[qPixelLayouts[image.format()].bpp][2];
     if (memrotate) {
-        memrotate(image.constBits(), w, h, image.bytesPerLine(), out.bits(), out.bytesPerLine());
+        // Column band [x0, x1) of the source becomes rows [x0, x1) of the result
+        const int bytesPerPixel = image.depth() / 8;
+        const qsizetype sbpl = image.bytesPerLine();
+        const qsizetype dbpl = out.bytesPerLine();
+        const uchar *src = image.constBits();
+        uchar *dest = out.bits();
+        processInSegments(bands(w), image.sizeInBytes(), [&](int b0, int b1) {
+            const int x0 = b0 * RotationBandWidth;
+            const int x1 = qMin(b1 * RotationBandWidth, w);
+            memrotate(src + x0 * bytesPerPixel, x1 - x0, h, sbpl, dest + x0 * dbpl, dbpl);
+        });
     } else {
         for (int y=0; y<h; ++y) {
             if (image.colorCount())
@@ -4454,7 +4503,14 @@ static QImage rotated180(const QImage &image)
         out.setColorTable(image.colorTable());
     int w = image.width();
     int h = image.height();
-    memrotate(image.constBits(), w, h, image.bytesPerLine(), out.bits(), out.bytesPerLine());
+    // Row band [y0, y1) of the source becomes rows [h - y1, h - y0) of the result
+    const qsizetype sbpl = image.bytesPerLine();
+    const qsizetype dbpl = out.bytesPerLine();
+    const uchar *src = image.constBits();
+    uchar *dest = out.bits();
+    processInSegments(h, image.sizeInBytes(), [&](int y0, int y1) {
+        memrotate(src + y0 * sbpl, w, y1 - y0, sbpl, dest + (h - y1) * dbpl, dbpl);
+    });
     return out;
 }
 
@@ -4468,7 +4524,17 @@ static QImage rotated270(const QImage &image)
     int h = image.height();
     const MemRotateFunc memrotate = qMemRotateFunctions[qPixelLayouts[image.format()].bpp][0];
     if (memrotate) {
-        memrotate(image.constBits(), w, h, image.bytesPerLine(), out.bits(), out.bytesPerLine());
+        // Column band [x0, x1) of the source becomes rows [w - x1, w - x0) of the result
+        const int bytesPerPixel = image.depth() / 8;
+        const qsizetype sbpl = image.bytesPerLine();
+        const qsizetype dbpl = out.bytesPerLine();
+        const uchar *src = image.constBits();
+        uchar *dest = out.bits();
+        processInSegments(bands(w), image.sizeInBytes(), [&](int b0, int b1) {
+            const int x0 = b0 * RotationBandWidth;
+            const int x1 = qMin(b1 * RotationBandWidth, w);
+            memrotate(src + x0 * bytesPerPixel, x1 - x0, h, sbpl, dest + (w - x1) * dbpl, dbpl);
+        });
     } else {
         for (int y=0; y<h; ++y) {
             if (image.colorCount())
@@ -4613,13 +4679,20 @@ QImage QImage::transformed(const QTransform &matrix, Qt::TransformationMode mode
         Q_ASSERT(sImage.devicePixelRatio() == 1);
         Q_ASSERT(sImage.devicePixelRatio() == dImage.devicePixelRatio());
 
-        QPainter p(&dImage);
-        if (mode == Qt::SmoothTransformation) {
-            p.setRenderHint(QPainter::Antialiasing);
-            p.setRenderHint(QPainter::SmoothPixmapTransform);
-        }
-        p.setTransform(mat);
-        p.drawImage(QPoint(0, 0), sImage);
+        // Paint bands of rows of the result in parallel, each through its own painter
+        // on an image that shares the result's memory.
+        uchar *dbits = dImage.bits();
+        const qsizetype dbpl = dImage.bytesPerLine();
+        processInSegments(hd, dImage.sizeInBytes(), [&](int y0, int y1) {
+            QImage band(dbits + y0 * dbpl, wd, y1 - y0, dbpl, target_format);
+            QPainter p(&band);
+            if (mode == Qt::SmoothTransformation) {
+                p.setRenderHint(QPainter::Antialiasing);
+                p.setRenderHint(QPainter::SmoothPixmapTransform);
+            }
+            p.setTransform(mat * QTransform::fromTranslate(0, -y0));
+            p.drawImage(QPoint(0, 0), sImage);
+        });
     } else {
         bool invertible;
         mat = mat.inverted(&invertible);                // invert matrix
@@ -4792,25 +4865,7 @@ void QImage::applyColorTransform(const QColorTransform &transform)
         };
     }
 
-#if QT_CONFIG(thread) && !defined(Q_OS_WASM)
-    int segments = sizeInBytes() / (1<<16);
-    segments = std::min(segments, height());
-    QThreadPool *threadPool = QThreadPool::globalInstance();
-    if (segments > 1 && !threadPool->contains(QThread::currentThread())) {
-        QSemaphore semaphore;
-        int y = 0;
-        for (int i = 0; i < segments; ++i) {
-            int yn = (height() - y) / (segments - i);
-            threadPool->start([&, y, yn]() {
-                transformSegment(y, y + yn);
-                semaphore.release(1);
-            });
-            y += yn;
-        }
-        semaphore.acquire(segments);
-    } else
-#endif
-        transformSegment(0, height());
+    processInSegments(height(), sizeInBytes(), transformSegment);
 
     if (oldFormat != format())
         *this = std::move(*this).convertToFormat(oldFormat);
@@ -165,6 +165,36 @@ extern void QT_FASTCALL storeRGB32FromARGB32PM_neon(uchar *dest, const uint *src
                                                     const QList<QRgb> *, QDitherInfo *);
 #endif
 
+// Runs convertSegment(yStart, yEnd) over all rows of an image of nbytes bytes, splitting
+// large images into segments of rows that are converted in parallel on the thread pool.
+template <typename Function>
+static void convertInSegments(int height, qsizetype nbytes, Function convertSegment)
+{
+#ifdef QT_USE_THREAD_PARALLEL_IMAGE_CONVERSIONS
+    int segments = nbytes / (1<<16);
+    segments = std::min(segments, height);
+
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    if (segments <= 1 || threadPool->contains(QThread::currentThread()))
+        return convertSegment(0, height);
+
+    QSemaphore semaphore;
+    int y = 0;
+    for (int i = 0; i < segments; ++i) {
+        int yn = (height - y) / (segments - i);
+        threadPool->start([&, y, yn]() {
+            convertSegment(y, y + yn);
+            semaphore.release(1);
+        });
+        y += yn;
+    }
+    semaphore.acquire(segments);
+#else
+    Q_UNUSED(nbytes);
+    convertSegment(0, height);
+#endif
+}
+
 void convert_generic(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags flags)
 {
     // Cannot be used with indexed formats.
@@ -233,28 +263,7 @@ void convert_generic(QImageData *dest, const QImageData *src, Qt::ImageConversio
         }
     };
 
-#ifdef QT_USE_THREAD_PARALLEL_IMAGE_CONVERSIONS
-    int segments = src->nbytes / (1<<16);
-    segments = std::min(segments, src->height);
-
-    QThreadPool *threadPool = QThreadPool::globalInstance();
-    if (segments <= 1 || threadPool->contains(QThread::currentThread()))
-        return convertSegment(0, src->height);
-
-    QSemaphore semaphore;
-    int y = 0;
-    for (int i = 0; i < segments; ++i) {
-        int yn = (src->height - y) / (segments - i);
-        threadPool->start([&, y, yn]() {
-            convertSegment(y, y + yn);
-            semaphore.release(1);
-        });
-        y += yn;
-    }
-    semaphore.acquire(segments);
-#else
-    convertSegment(0, src->height);
-#endif
+    convertInSegments(src->height, src->nbytes, convertSegment);
 }
 
 void convert_generic_to_rgb64(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags)
@@ -288,28 +297,7 @@ void convert_generic_to_rgb64(QImageData *dest, const QImageData *src, Qt::Image
             destData += dest->bytes_per_line;
         }
     };
-#ifdef QT_USE_THREAD_PARALLEL_IMAGE_CONVERSIONS
-    int segments = src->nbytes / (1<<16);
-    segments = std::min(segments, src->height);
-
-    QThreadPool *threadPool = QThreadPool::globalInstance();
-    if (segments <= 1 || threadPool->contains(QThread::currentThread()))
-        return convertSegment(0, src->height);
-
-    QSemaphore semaphore;
-    int y = 0;
-    for (int i = 0; i < segments; ++i) {
-        int yn = (src->height - y) / (segments - i);
-        threadPool->start([&, y, yn]() {
-            convertSegment(y, y + yn);
-            semaphore.release(1);
-        });
-        y += yn;
-    }
-    semaphore.acquire(segments);
-#else
-    convertSegment(0, src->height);
-#endif
+    convertInSegments(src->height, src->nbytes, convertSegment);
 }
 
 bool convert_generic_inplace(QImageData *data, QImage::Format dst_format, Qt::ImageConversionFlags flags)
@@ -544,6 +532,10 @@ Q_GUI_EXPORT void QT_FASTCALL qt_convert_rgb888_to_rgbx8888(quint32 *dest_data,
 
 typedef void (QT_FASTCALL *Rgb888ToRgbConverter)(quint32 *dst, const uchar *src, int len);
 
+#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_SSSE3)
+extern void QT_FASTCALL qt_convert_rgb888_to_rgb32_ssse3(quint32 *dst, const uchar *src, int len);
+#endif
+
 template <bool rgbx>
 static void convert_RGB888_to_RGB(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags)
 {
@@ -555,18 +547,80 @@ static void convert_RGB888_to_RGB(QImageData *dest, const QImageData *src, Qt::I
     Q_ASSERT(src->width == dest->width);
     Q_ASSERT(src->height == dest->height);
 
-    const uchar *src_data = (uchar *) src->data;
-    quint32 *dest_data = (quint32 *) dest->data;
-
     Rgb888ToRgbConverter line_converter= rgbx ? qt_convert_rgb888_to_rgbx8888 : qt_convert_rgb888_to_rgb32;
+#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_SSSE3)
+    if (!rgbx && qCpuHasFeature(SSSE3))
+        line_converter = qt_convert_rgb888_to_rgb32_ssse3;
+#endif
 
-    for (int i = 0; i < src->height; ++i) {
-        line_converter(dest_data, src_data, src->width);
-        src_data += src->bytes_per_line;
-        dest_data = (quint32 *)((uchar*)dest_data + dest->bytes_per_line);
+    auto convertSegment = [=](int yStart, int yEnd) {
+        const uchar *src_data = src->data + src->bytes_per_line * yStart;
+        uchar *dest_data = dest->data + dest->bytes_per_line * yStart;
+        for (int i = yStart; i < yEnd; ++i) {
+            line_converter(reinterpret_cast<quint32 *>(dest_data), src_data, src->width);
+            src_data += src->bytes_per_line;
+            dest_data += dest->bytes_per_line;
+        }
+    };
+    convertInSegments(src->height, dest->nbytes, convertSegment);
+}
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+// Convert a scanline of 32-bit pixels with the color bytes in memory order (src)
+// to 24-bit pixels (dst), optionally swapping the first and the third byte.
+template <bool rgbswap>
+static void QT_FASTCALL qt_convert_rgb32_to_rgb888(uchar *dst, const quint32 *src, int len)
+{
+    const uchar *src_data = reinterpret_cast<const uchar *>(src);
+    for (int i = 0; i < len; ++i) {
+        dst[0] = src_data[rgbswap ? 2 : 0];
+        dst[1] = src_data[1];
+        dst[2] = src_data[rgbswap ? 0 : 2];
+        src_data += 4;
+        dst += 3;
     }
 }
 
+typedef void (QT_FASTCALL *RgbToRgb888Converter)(uchar *dst, const quint32 *src, int len);
+
+#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_SSSE3)
+extern void QT_FASTCALL qt_convert_rgb32_to_rgb888_ssse3(uchar *dst, const quint32 *src, int len);
+extern void QT_FASTCALL qt_convert_rgbx8888_to_rgb888_ssse3(uchar *dst, const quint32 *src, int len);
+#endif
+
+// Converts the opaque or unpremultiplied 32-bit formats to RGB888 and BGR888 by
+// dropping the alpha byte. rgbswap is true if the byte order of the color channels
+// is reversed, as it is between RGB32 and RGB888.
+template <bool rgbswap>
+static void convert_RGB_to_RGB888(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags)
+{
+    Q_ASSERT(dest->format == QImage::Format_RGB888 || dest->format == QImage::Format_BGR888);
+    if (rgbswap ^ (dest->format == QImage::Format_BGR888))
+        Q_ASSERT(src->format == QImage::Format_RGB32 || src->format == QImage::Format_ARGB32);
+    else
+        Q_ASSERT(src->format == QImage::Format_RGBX8888 || src->format == QImage::Format_RGBA8888);
+    Q_ASSERT(src->width == dest->width);
+    Q_ASSERT(src->height == dest->height);
+
+    RgbToRgb888Converter line_converter = qt_convert_rgb32_to_rgb888<rgbswap>;
+#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_SSSE3)
+    if (qCpuHasFeature(SSSE3))
+        line_converter = rgbswap ? qt_convert_rgb32_to_rgb888_ssse3 : qt_convert_rgbx8888_to_rgb888_ssse3;
+#endif
+
+    auto convertSegment = [=](int yStart, int yEnd) {
+        const uchar *src_data = src->data + src->bytes_per_line * yStart;
+        uchar *dest_data = dest->data + dest->bytes_per_line * yStart;
+        for (int i = yStart; i < yEnd; ++i) {
+            line_converter(dest_data, reinterpret_cast<const quint32 *>(src_data), src->width);
+            src_data += src->bytes_per_line;
+            dest_data += dest->bytes_per_line;
+        }
+    };
+    convertInSegments(src->height, src->nbytes, convertSegment);
+}
+#endif
+
 static void convert_ARGB_to_RGBx(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags)
 {
     Q_ASSERT(src->format == QImage::Format_ARGB32);
@@ -1268,19 +1322,22 @@ static void convert_gray16_to_RGBA64(QImageData *dest, const QImageData *src, Qt
 
     const qsizetype sbpl = src->bytes_per_line;
     const qsizetype dbpl = dest->bytes_per_line;
-    const uchar *src_data = src->data;
-    uchar *dest_data = dest->data;
 
-    for (int i = 0; i < src->height; ++i) {
-        const quint16 *src_line = reinterpret_cast<const quint16 *>(src_data);
-        QRgba64 *dest_line = reinterpret_cast<QRgba64 *>(dest_data);
-        for (int j = 0; j < src->width; ++j) {
-            quint16 s = src_line[j];
-            dest_line[j] = qRgba64(s, s, s, 0xFFFF);
+    auto convertSegment = [=](int yStart, int yEnd) {
+        const uchar *src_data = src->data + sbpl * yStart;
+        uchar *dest_data = dest->data + dbpl * yStart;
+        for (int i = yStart; i < yEnd; ++i) {
+            const quint16 *src_line = reinterpret_cast<const quint16 *>(src_data);
+            QRgba64 *dest_line = reinterpret_cast<QRgba64 *>(dest_data);
+            for (int j = 0; j < src->width; ++j) {
+                quint16 s = src_line[j];
+                dest_line[j] = qRgba64(s, s, s, 0xFFFF);
+            }
+            src_data += sbpl;
+            dest_data += dbpl;
         }
-        src_data += sbpl;
-        dest_data += dbpl;
-    }
+    };
+    convertInSegments(src->height, dest->nbytes, convertSegment);
 }
 
 static void convert_RGBA64_to_gray16(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags)
@@ -1293,19 +1350,22 @@ static void convert_RGBA64_to_gray16(QImageData *dest, const QImageData *src, Qt
 
     const qsizetype sbpl = src->bytes_per_line;
     const qsizetype dbpl = dest->bytes_per_line;
-    const uchar *src_data = src->data;
-    uchar *dest_data = dest->data;
 
-    for (int i = 0; i < src->height; ++i) {
-        const QRgba64 *src_line = reinterpret_cast<const QRgba64 *>(src_data);
-        quint16 *dest_line = reinterpret_cast<quint16 *>(dest_data);
-        for (int j = 0; j < src->width; ++j) {
-            QRgba64 s = src_line[j].unpremultiplied();
-            dest_line[j] = qGray(s.red(), s.green(), s.blue());
+    auto convertSegment = [=](int yStart, int yEnd) {
+        const uchar *src_data = src->data + sbpl * yStart;
+        uchar *dest_data = dest->data + dbpl * yStart;
+        for (int i = yStart; i < yEnd; ++i) {
+            const QRgba64 *src_line = reinterpret_cast<const QRgba64 *>(src_data);
+            quint16 *dest_line = reinterpret_cast<quint16 *>(dest_data);
+            for (int j = 0; j < src->width; ++j) {
+                QRgba64 s = src_line[j].unpremultiplied();
+                dest_line[j] = qGray(s.red(), s.green(), s.blue());
+            }
+            src_data += sbpl;
+            dest_data += dbpl;
         }
-        src_data += sbpl;
-        dest_data += dbpl;
-    }
+    };
+    convertInSegments(src->height, src->nbytes, convertSegment);
 }
 
 static QList<QRgb> fix_color_table(const QList<QRgb> &ctbl, QImage::Format format)
@@ -2404,19 +2464,18 @@ static void qInitImageConversions()
     qimage_inplace_converter_map[QImage::Format_BGR888][QImage::Format_RGB888] =
             convert_rgbswap_generic_inplace;
 
-    // Now architecture specific conversions:
-#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_SSSE3)
-    if (qCpuHasFeature(SSSE3)) {
-        extern void convert_RGB888_to_RGB32_ssse3(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags);
-        qimage_converter_map[QImage::Format_RGB888][QImage::Format_RGB32] = convert_RGB888_to_RGB32_ssse3;
-        qimage_converter_map[QImage::Format_RGB888][QImage::Format_ARGB32] = convert_RGB888_to_RGB32_ssse3;
-        qimage_converter_map[QImage::Format_RGB888][QImage::Format_ARGB32_Premultiplied] = convert_RGB888_to_RGB32_ssse3;
-        qimage_converter_map[QImage::Format_BGR888][QImage::Format_RGBX8888] = convert_RGB888_to_RGB32_ssse3;
-        qimage_converter_map[QImage::Format_BGR888][QImage::Format_RGBA8888] = convert_RGB888_to_RGB32_ssse3;
-        qimage_converter_map[QImage::Format_BGR888][QImage::Format_RGBA8888_Premultiplied] = convert_RGB888_to_RGB32_ssse3;
-    }
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    qimage_converter_map[QImage::Format_RGB32][QImage::Format_RGB888] = convert_RGB_to_RGB888<true>;
+    qimage_converter_map[QImage::Format_RGB32][QImage::Format_BGR888] = convert_RGB_to_RGB888<false>;
+    qimage_converter_map[QImage::Format_ARGB32][QImage::Format_RGB888] = convert_RGB_to_RGB888<true>;
+    qimage_converter_map[QImage::Format_ARGB32][QImage::Format_BGR888] = convert_RGB_to_RGB888<false>;
+    qimage_converter_map[QImage::Format_RGBX8888][QImage::Format_RGB888] = convert_RGB_to_RGB888<false>;
+    qimage_converter_map[QImage::Format_RGBX8888][QImage::Format_BGR888] = convert_RGB_to_RGB888<true>;
+    qimage_converter_map[QImage::Format_RGBA8888][QImage::Format_RGB888] = convert_RGB_to_RGB888<false>;
+    qimage_converter_map[QImage::Format_RGBA8888][QImage::Format_BGR888] = convert_RGB_to_RGB888<true>;
 #endif
 
+    // Now architecture specific conversions:
 #if defined(__ARM_NEON__)
     extern void convert_RGB888_to_RGB32_neon(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags);
     qimage_converter_map[QImage::Format_RGB888][QImage::Format_RGB32] = convert_RGB888_to_RGB32_neon;
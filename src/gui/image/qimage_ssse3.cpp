@@ -119,26 +119,54 @@ Q_GUI_EXPORT void QT_FASTCALL qt_convert_rgb888_to_rgb32_ssse3(quint32 *dst, con
     }
 }
 
-void convert_RGB888_to_RGB32_ssse3(QImageData *dest, const QImageData *src, Qt::ImageConversionFlags)
+// Convert a scanline of 32-bit pixels (src) to 24-bit pixels (dst) by dropping
+// the fourth byte of each pixel, optionally swapping the first and the third byte.
+// src must be at least len * 4 bytes
+// dst must be at least len * 3 bytes
+template <bool rgbswap>
+static inline void convert_rgb32_to_rgb888_ssse3(uchar *dst, const quint32 *src, int len)
 {
-    Q_ASSERT(src->format == QImage::Format_RGB888 || src->format == QImage::Format_BGR888);
-    if (src->format == QImage::Format_BGR888)
-        Q_ASSERT(dest->format == QImage::Format_RGBX8888 || dest->format == QImage::Format_RGBA8888 || dest->format == QImage::Format_RGBA8888_Premultiplied);
-    else
-        Q_ASSERT(dest->format == QImage::Format_RGB32 || dest->format == QImage::Format_ARGB32 || dest->format == QImage::Format_ARGB32_Premultiplied);
-    Q_ASSERT(src->width == dest->width);
-    Q_ASSERT(src->height == dest->height);
-
-    const uchar *src_data = (uchar *) src->data;
-    quint32 *dest_data = (quint32 *) dest->data;
-
-    for (int i = 0; i < src->height; ++i) {
-        qt_convert_rgb888_to_rgb32_ssse3(dest_data, src_data, src->width);
-        src_data += src->bytes_per_line;
-        dest_data = (quint32 *)((uchar*)dest_data + dest->bytes_per_line);
+    const __m128i shuffleMask = rgbswap
+            ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+            : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    int i = 0;
+    // Each iteration shuffles 4 vectors of 4 pixels into 12 bytes each, and
+    // stores them as 3 full vectors.
+    for (; i < len - 15; i += 16) {
+        const __m128i *srcVectorPtr = reinterpret_cast<const __m128i *>(src + i);
+        const __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128(srcVectorPtr), shuffleMask);
+        const __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128(srcVectorPtr + 1), shuffleMask);
+        const __m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128(srcVectorPtr + 2), shuffleMask);
+        const __m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128(srcVectorPtr + 3), shuffleMask);
+
+        __m128i *dstVectorPtr = reinterpret_cast<__m128i *>(dst);
+        _mm_storeu_si128(dstVectorPtr, _mm_or_si128(v0, _mm_slli_si128(v1, 12)));
+        _mm_storeu_si128(dstVectorPtr + 1, _mm_or_si128(_mm_srli_si128(v1, 4), _mm_slli_si128(v2, 8)));
+        _mm_storeu_si128(dstVectorPtr + 2, _mm_or_si128(_mm_srli_si128(v2, 8), _mm_slli_si128(v3, 4)));
+        dst += 48;
+    }
+
+    const uchar *src_data = reinterpret_cast<const uchar *>(src + i);
+    SIMD_EPILOGUE(i, len, 15) {
+        dst[0] = src_data[rgbswap ? 2 : 0];
+        dst[1] = src_data[1];
+        dst[2] = src_data[rgbswap ? 0 : 2];
+        src_data += 4;
+        dst += 3;
     }
 }
 
+void QT_FASTCALL qt_convert_rgb32_to_rgb888_ssse3(uchar *dst, const quint32 *src, int len)
+{
+    convert_rgb32_to_rgb888_ssse3<true>(dst, src, len);
+}
+
+void QT_FASTCALL qt_convert_rgbx8888_to_rgb888_ssse3(uchar *dst, const quint32 *src, int len)
+{
+    convert_rgb32_to_rgb888_ssse3<false>(dst, src, len);
+}
+
 QT_END_NAMESPACE
 
 #endif // QT_COMPILER_SUPPORTS_SSSE3
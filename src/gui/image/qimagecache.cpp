@@ -0,0 +1,266 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qimagecache_p.h"
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QImageCache
+    \inmodule QtGui
+    \internal
+
+    \brief The QImageCache class is a thread-safe, size-limited cache of
+    images.
+
+    Unlike QPixmapCache, which is only usable from the GUI thread, a
+    QImageCache can be populated and queried from any thread, so that
+    images can be decoded and cached by worker threads and later picked
+    up by the GUI thread.
+
+    Entries are distributed over a fixed number of shards by the hash of
+    their key, each guarded by its own mutex, so that threads working on
+    different keys rarely contend. The cost of an image is accounted in
+    kilobytes like for QPixmapCache, and the total over all shards is
+    kept below cacheLimit(). When an insertion exceeds the limit, the
+    least recently used entries of the affected shard are evicted first,
+    then those of the other shards.
+
+    Evicted images are reported to the callback set with
+    setEvictionCallback(). The callback is invoked without any lock held,
+    on the thread that caused the eviction, and may call back into the
+    cache. Entries removed by remove(), clear() or replaced by insert()
+    are not reported.
+*/
+
+static inline int cost(const QImage &image)
+{
+    // make sure to do a 64bit calculation
+    const qint64 costKb = static_cast<qint64>(image.width()) *
+            image.height() * image.depth() / (8 * 1024);
+    const qint64 costMax = std::numeric_limits<int>::max();
+    // a small image should have at least a cost of 1(kb)
+    return static_cast<int>(qBound(1LL, costKb, costMax));
+}
+
+/*!
+    Constructs an empty cache that holds up to \a cacheLimit kilobytes of
+    images.
+*/
+QImageCache::QImageCache(int cacheLimit)
+    : limit(cacheLimit), used(0)
+{
+}
+
+/*!
+    Destroys the cache. Eviction callbacks are not invoked for the
+    remaining entries.
+*/
+QImageCache::~QImageCache()
+{
+}
+
+/*!
+    Returns the cache limit in kilobytes.
+*/
+int QImageCache::cacheLimit() const
+{
+    return limit.loadRelaxed();
+}
+
+/*!
+    Sets the cache limit to \a kb kilobytes, evicting entries if the
+    cache currently uses more than that.
+*/
+void QImageCache::setCacheLimit(int kb)
+{
+    limit.storeRelaxed(kb);
+
+    std::list<Entry> evicted;
+    for (Shard &shard : shards) {
+        if (used.loadRelaxed() <= kb)
+            break;
+        QMutexLocker locker(&shard.mutex);
+        trim(shard, 0, &evicted);
+    }
+    notifyEvicted(evicted);
+}
+
+/*!
+    Returns the sum of the costs of all cached images, in kilobytes.
+*/
+int QImageCache::totalUsed() const
+{
+    return used.loadRelaxed();
+}
+
+/*!
+    Sets \a callback to be invoked for every entry evicted to stay below
+    the cache limit.
+
+    This function is not thread-safe; set the callback before the cache
+    is shared with other threads.
+*/
+void QImageCache::setEvictionCallback(const EvictionCallback &callback)
+{
+    evictionCallback = callback;
+}
+
+/*!
+    Looks for an image cached under \a key. If found, assigns it to
+    \a image, marks the entry as most recently used and returns \c true;
+    otherwise returns \c false.
+*/
+bool QImageCache::find(const QString &key, QImage *image)
+{
+    Shard &shard = shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    const auto it = shard.index.constFind(key);
+    if (it == shard.index.constEnd())
+        return false;
+    shard.entries.splice(shard.entries.begin(), shard.entries, it.value());
+    if (image)
+        *image = it.value()->image;
+    return true;
+}
+
+/*!
+    Inserts a copy of \a image under \a key, replacing any image already
+    cached under that key. Returns \c false if \a image alone exceeds the
+    cache limit, in which case it is not cached.
+*/
+bool QImageCache::insert(const QString &key, const QImage &image)
+{
+    const int c = cost(image);
+    if (c > limit.loadRelaxed()) {
+        remove(key);
+        return false;
+    }
+
+    Shard &shard = shardFor(key);
+    std::list<Entry> evicted;
+    {
+        QMutexLocker locker(&shard.mutex);
+        const auto it = shard.index.constFind(key);
+        if (it != shard.index.constEnd()) {
+            shard.used -= it.value()->cost;
+            used.fetchAndSubRelaxed(it.value()->cost);
+            shard.entries.erase(it.value());
+        }
+        shard.entries.push_front(Entry{key, image, c});
+        shard.index.insert(key, shard.entries.begin());
+        shard.used += c;
+        used.fetchAndAddRelaxed(c);
+        trim(shard, 1, &evicted);
+    }
+
+    // The shard of the new entry alone could not make room; take the
+    // least recently used entries of the other shards.
+    for (Shard &other : shards) {
+        if (used.loadRelaxed() <= limit.loadRelaxed())
+            break;
+        if (&other == &shard)
+            continue;
+        QMutexLocker locker(&other.mutex);
+        trim(other, 0, &evicted);
+    }
+
+    notifyEvicted(evicted);
+    return true;
+}
+
+/*!
+    Removes the image cached under \a key, if any.
+*/
+void QImageCache::remove(const QString &key)
+{
+    Shard &shard = shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    const auto it = shard.index.constFind(key);
+    if (it == shard.index.constEnd())
+        return;
+    shard.used -= it.value()->cost;
+    used.fetchAndSubRelaxed(it.value()->cost);
+    shard.entries.erase(it.value());
+    shard.index.remove(key);
+}
+
+/*!
+    Removes all images from the cache.
+*/
+void QImageCache::clear()
+{
+    for (Shard &shard : shards) {
+        QMutexLocker locker(&shard.mutex);
+        used.fetchAndSubRelaxed(shard.used);
+        shard.used = 0;
+        shard.index.clear();
+        shard.entries.clear();
+    }
+}
+
+/*!
+    \internal
+
+    Moves the least recently used entries of \a shard, keeping at least
+    \a keep of them, to \a evicted until the cache fits its limit. The
+    shard's mutex must be held.
+*/
+void QImageCache::trim(Shard &shard, size_t keep, std::list<Entry> *evicted)
+{
+    while (used.loadRelaxed() > limit.loadRelaxed() && shard.entries.size() > keep) {
+        const auto last = std::prev(shard.entries.end());
+        shard.index.remove(last->key);
+        shard.used -= last->cost;
+        used.fetchAndSubRelaxed(last->cost);
+        evicted->splice(evicted->end(), shard.entries, last);
+    }
+}
+
+void QImageCache::notifyEvicted(const std::list<Entry> &evicted)
+{
+    if (!evictionCallback)
+        return;
+    for (const Entry &entry : evicted)
+        evictionCallback(entry.key, entry.image);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QIMAGECACHE_P_H
+#define QIMAGECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. This header
+// file may change from version to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtGui/private/qtguiglobal_p.h>
+#include <QtGui/qimage.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qstring.h>
+
+#include <functional>
+#include <list>
+
+QT_BEGIN_NAMESPACE
+
+class Q_GUI_EXPORT QImageCache
+{
+public:
+    using EvictionCallback = std::function<void(const QString &key, const QImage &image)>;
+
+    explicit QImageCache(int cacheLimit = 10240);
+    ~QImageCache();
+
+    int cacheLimit() const;
+    void setCacheLimit(int kb);
+    int totalUsed() const;
+
+    void setEvictionCallback(const EvictionCallback &callback);
+
+    bool find(const QString &key, QImage *image);
+    bool insert(const QString &key, const QImage &image);
+    void remove(const QString &key);
+    void clear();
+
+private:
+    Q_DISABLE_COPY_MOVE(QImageCache)
+
+    struct Entry {
+        QString key;
+        QImage image;
+        int cost;
+    };
+    struct Shard {
+        QMutex mutex;
+        std::list<Entry> entries; // most recently used first
+        QHash<QString, std::list<Entry>::iterator> index;
+        int used = 0;
+    };
+    enum { ShardCount = 16 };
+
+    Shard &shardFor(const QString &key) { return shards[qHash(key) % ShardCount]; }
+    void trim(Shard &shard, size_t keep, std::list<Entry> *evicted);
+    void notifyEvicted(const std::list<Entry> &evicted);
+
+    Shard shards[ShardCount];
+    QAtomicInt limit;
+    QAtomicInt used;
+    EvictionCallback evictionCallback;
+};
+
+QT_END_NAMESPACE
+
+#endif // QIMAGECACHE_P_H
@@ -146,6 +146,10 @@
 #include <qsize.h>
 #include <qcolor.h>
 #include <qvariant.h>
+#if QT_CONFIG(future)
+#include <qbuffer.h>
+#include <qthreadpool.h>
+#endif
 
 // factory loader
 #include <qcoreapplication.h>
@@ -1328,6 +1332,77 @@ bool QImageReader::read(QImage *image)
     return true;
 }
 
+#if QT_CONFIG(future)
+/*!
+    \since 6.0
+
+    Reads the next image from the device on a thread of the global
+    QThreadPool and returns a QFuture that becomes ready with the decoded
+    image. On failure, the result is a null QImage.
+
+    The format, clip rect, scaled size, scaled clip rect, quality,
+    background color and transformation settings in effect at the time of
+    the call are used for decoding. Changing them afterwards does not
+    affect the pending read, and error() and errorString() are not
+    updated by it.
+
+    Because QIODevice is not thread-safe, the remaining contents of the
+    device are read into memory before this function returns, unless the
+    reader was constructed with a file name and has not been used yet; in
+    that case the worker thread opens the file itself.
+
+    \sa read(), QFuture
+*/
+QFuture<QImage> QImageReader::readAsync()
+{
+    QFutureInterface<QImage> promise;
+    promise.reportStarted();
+    QFuture<QImage> future = promise.future();
+
+    QString file;
+    QByteArray data;
+    if (d->deleteDevice && !d->handler && qobject_cast<QFile *>(d->device))
+        file = fileName();
+    else if (d->device && (d->device->isOpen() || d->device->open(QIODevice::ReadOnly)))
+        data = d->device->readAll();
+
+    const QByteArray format = d->format;
+    const bool autoDetect = d->autoDetectImageFormat;
+    const bool ignoresFormat = d->ignoresFormatAndExtension;
+    const QRect clipRect = d->clipRect;
+    const QSize scaledSize = d->scaledSize;
+    const QRect scaledClipRect = d->scaledClipRect;
+    const int quality = d->quality;
+    const auto autoTransform = d->autoTransform;
+    const QColor backgroundColor = this->backgroundColor();
+
+    QThreadPool::globalInstance()->start([=]() mutable {
+        QBuffer buffer(&data);
+        QImageReader reader;
+        if (!file.isEmpty())
+            reader.setFileName(file);
+        else
+            reader.setDevice(&buffer);
+        reader.setFormat(format);
+        reader.d->autoDetectImageFormat = autoDetect;
+        reader.d->ignoresFormatAndExtension = ignoresFormat;
+        reader.d->clipRect = clipRect;
+        reader.d->scaledSize = scaledSize;
+        reader.d->scaledClipRect = scaledClipRect;
+        reader.d->quality = quality;
+        reader.d->autoTransform = autoTransform;
+        if (backgroundColor.isValid())
+            reader.setBackgroundColor(backgroundColor);
+
+        if (!promise.isCanceled())
+            promise.reportResult(reader.read());
+        promise.reportFinished();
+    });
+
+    return future;
+}
+#endif // QT_CONFIG(future)
+
 /*!
    For image formats that support animation, this function steps over the
    current image, returning true if successful or false if there is no
@@ -45,6 +45,9 @@
 #include <QtCore/qcoreapplication.h>
 #include <QtGui/qimage.h>
 #include <QtGui/qimageiohandler.h>
+#if QT_CONFIG(future)
+#include <QtCore/qfuture.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -123,6 +126,9 @@ public:
     bool canRead() const;
     QImage read();
     bool read(QImage *image);
+#if QT_CONFIG(future)
+    QFuture<QImage> readAsync();
+#endif
 
     bool jumpToNextImage();
     bool jumpToImage(int imageNumber);
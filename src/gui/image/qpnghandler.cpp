@@ -107,13 +107,14 @@ public:
     };
 
     QPngHandlerPrivate(QPngHandler *qq)
-        : gamma(0.0), fileGamma(0.0), quality(50), compression(50), colorSpaceState(Undefined), png_ptr(nullptr), info_ptr(nullptr), end_info(nullptr), state(Ready), q(qq)
+        : gamma(0.0), fileGamma(0.0), quality(50), compression(50), optimizedWrite(false), colorSpaceState(Undefined), png_ptr(nullptr), info_ptr(nullptr), end_info(nullptr), state(Ready), q(qq)
     { }
 
     float gamma;
     float fileGamma;
     int quality; // quality is used for backward compatibility, maps to compression
     int compression;
+    bool optimizedWrite;
     QString description;
     QSize scaledSize;
     QStringList readTexts;
@@ -170,6 +171,7 @@ public:
     void setLooping(int loops=0); // 0 == infinity
     void setFrameDelay(int msecs);
     void setGamma(float);
+    void setOptimizedWrite(bool);
 
     bool writeImage(const QImage& img, int x, int y);
     bool writeImage(const QImage& img, int compression_in, const QString &description, int x, int y);
@@ -187,6 +189,7 @@ private:
     int looping;
     int ms_delay;
     float gamma;
+    bool optimized_write;
 };
 
 extern "C" {
@@ -786,7 +789,8 @@ QPNGImageWriter::QPNGImageWriter(QIODevice* iod) :
     disposal(Unspecified),
     looping(-1),
     ms_delay(-1),
-    gamma(0.0)
+    gamma(0.0),
+    optimized_write(false)
 {
 }
 
@@ -814,6 +818,11 @@ void QPNGImageWriter::setGamma(float g)
     gamma = g;
 }
 
+void QPNGImageWriter::setOptimizedWrite(bool enable)
+{
+    optimized_write = enable;
+}
+
 static void set_text(const QImage &image, png_structp png_ptr, png_infop info_ptr,
                      const QString &description)
 {
@@ -917,6 +926,16 @@ bool QPNGImageWriter::writeImage(const QImage& image, int compression_in, const
         png_set_compression_level(png_ptr, compression);
     }
 
+    // libpng's adaptive filtering tries every filter on every row, which
+    // dominates the encoding time when zlib runs at its fastest levels.
+    // Use a single cheap filter there unless an optimized write was asked for.
+    if (optimized_write) {
+        png_set_compression_mem_level(png_ptr, 9);
+    } else if (compression >= 0 && compression < 3) {
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE,
+                       compression == 0 ? PNG_FILTER_NONE : PNG_FILTER_SUB);
+    }
+
     png_set_write_fn(png_ptr, (void*)this, qpiw_write_fn, qpiw_flush_fn);
 
 
@@ -1125,26 +1144,24 @@ bool QPNGImageWriter::writeImage(const QImage& image, int compression_in, const
             delete [] row_pointers;
         }
         break;
-    case QImage::Format_RGBA64_Premultiplied:
-        {
-            QImage row;
-            png_bytep row_pointers[1];
-            for (int y=0; y<height; y++) {
-                row = image.copy(0, y, width, 1).convertToFormat(QImage::Format_RGBA64);
-                row_pointers[0] = const_cast<png_bytep>(row.constScanLine(0));
-                png_write_rows(png_ptr, row_pointers, 1);
-            }
-        }
-        break;
     default:
         {
-            QImage::Format fmt = image.hasAlphaChannel() ? QImage::Format_ARGB32 : QImage::Format_RGB32;
-            QImage row;
-            png_bytep row_pointers[1];
-            for (int y=0; y<height; y++) {
-                row = image.copy(0, y, width, 1).convertToFormat(fmt);
-                row_pointers[0] = const_cast<png_bytep>(row.constScanLine(0));
-                png_write_rows(png_ptr, row_pointers, 1);
+            QImage::Format fmt;
+            if (image.format() == QImage::Format_RGBA64_Premultiplied)
+                fmt = QImage::Format_RGBA64;
+            else
+                fmt = image.hasAlphaChannel() ? QImage::Format_ARGB32 : QImage::Format_RGB32;
+            // Convert in strips of rows to avoid both a full copy of the
+            // image and an allocation per row.
+            const int stripHeight = 32;
+            QImage strip;
+            png_bytep row_pointers[stripHeight];
+            for (int y = 0; y < height; y += stripHeight) {
+                const int rows = qMin(stripHeight, height - y);
+                strip = image.copy(0, y, width, rows).convertToFormat(fmt);
+                for (int i = 0; i < rows; ++i)
+                    row_pointers[i] = const_cast<png_bytep>(strip.constScanLine(i));
+                png_write_rows(png_ptr, row_pointers, rows);
             }
         }
         break;
@@ -1159,7 +1176,8 @@ bool QPNGImageWriter::writeImage(const QImage& image, int compression_in, const
 }
 
 static bool write_png_image(const QImage &image, QIODevice *device,
-                            int compression, int quality, float gamma, const QString &description)
+                            int compression, int quality, float gamma, bool optimizedWrite,
+                            const QString &description)
 {
     // quality is used for backward compatibility, maps to compression
 
@@ -1173,6 +1191,7 @@ static bool write_png_image(const QImage &image, QIODevice *device,
         compression = (compression * 9) / 91; // map [0,100] -> [0,9]
 
     writer.setGamma(gamma);
+    writer.setOptimizedWrite(optimizedWrite);
     return writer.writeImage(image, compression, description);
 }
 
@@ -1220,7 +1239,8 @@ bool QPngHandler::read(QImage *image)
 
 bool QPngHandler::write(const QImage &image)
 {
-    return write_png_image(image, device(), d->compression, d->quality, d->gamma, d->description);
+    return write_png_image(image, device(), d->compression, d->quality, d->gamma, d->optimizedWrite,
+                           d->description);
 }
 
 bool QPngHandler::supportsOption(ImageOption option) const
@@ -1230,6 +1250,7 @@ bool QPngHandler::supportsOption(ImageOption option) const
         || option == ImageFormat
         || option == Quality
         || option == CompressionRatio
+        || option == OptimizedWrite
         || option == Size
         || option == ScaledSize;
 }
@@ -1247,6 +1268,8 @@ QVariant QPngHandler::option(ImageOption option) const
         return d->quality;
     else if (option == CompressionRatio)
         return d->compression;
+    else if (option == OptimizedWrite)
+        return d->optimizedWrite;
     else if (option == Description)
         return d->description;
     else if (option == Size)
@@ -1267,6 +1290,8 @@ void QPngHandler::setOption(ImageOption option, const QVariant &value)
         d->quality = value.toInt();
     else if (option == CompressionRatio)
         d->compression = value.toInt();
+    else if (option == OptimizedWrite)
+        d->optimizedWrite = value.toBool();
     else if (option == Description)
         d->description = value.toString();
     else if (option == ScaledSize)
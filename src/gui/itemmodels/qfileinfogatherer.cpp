@@ -40,6 +40,10 @@
 #include "qfileinfogatherer_p.h"
 #include <qdebug.h>
 #include <qdiriterator.h>
+#if QT_CONFIG(thread)
+#include <qsemaphore.h>
+#include <qthreadpool.h>
+#endif
 #include <private/qfileinfo_p.h>
 #ifndef Q_OS_WIN
 #  include <unistd.h>
@@ -360,6 +364,43 @@ QExtendedInformation QFileInfoGatherer::getInfo(const QFileInfo &fileInfo) const
     return info;
 }
 
+// Number of directory entries that are stat()ed together
+static const int StatBatchSize = 128;
+
+/*
+    Calls stat() on the \a count file infos in \a infos. On network file
+    systems every stat() is a round trip to the server, so chunks of the
+    batch are stat()ed in parallel on the global thread pool.
+*/
+static void statFileInfos(QFileInfo *infos, qsizetype count)
+{
+    const qsizetype chunkSize = 16;
+    const qsizetype chunks = (count + chunkSize - 1) / chunkSize;
+    auto statChunk = [infos, count](qsizetype chunk) {
+        const qsizetype end = qMin(count, (chunk + 1) * chunkSize);
+        for (qsizetype i = chunk * chunkSize; i < end; ++i)
+            infos[i].stat();
+    };
+
+#if QT_CONFIG(thread)
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    if (chunks > 1 && !threadPool->contains(QThread::currentThread())) {
+        QSemaphore semaphore;
+        for (qsizetype chunk = 1; chunk < chunks; ++chunk) {
+            threadPool->start([&, chunk]() {
+                statChunk(chunk);
+                semaphore.release(1);
+            });
+        }
+        statChunk(0);
+        semaphore.acquire(int(chunks - 1));
+        return;
+    }
+#endif
+    for (qsizetype chunk = 0; chunk < chunks; ++chunk)
+        statChunk(chunk);
+}
+
 /*
     Get specific file info's, batch the files so update when we have 100
     items and every 200ms after that
@@ -393,31 +434,40 @@ void QFileInfoGatherer::getFileInfos(const QString &path, const QStringList &fil
 
     QElapsedTimer base;
     base.start();
-    QFileInfo fileInfo;
     bool firstTime = true;
     QList<QPair<QString, QFileInfo>> updatedFiles;
-    QStringList filesToCheck = files;
+    QFileInfoList batch;
+    batch.reserve(StatBatchSize);
 
     QStringList allFiles;
     if (files.isEmpty()) {
         QDirIterator dirIt(path, QDir::AllEntries | QDir::System | QDir::Hidden);
         while (!abort.loadRelaxed() && dirIt.hasNext()) {
-            dirIt.next();
-            fileInfo = dirIt.fileInfo();
-            fileInfo.stat();
-            allFiles.append(fileInfo.fileName());
-            fetch(fileInfo, base, firstTime, updatedFiles, path);
+            batch.clear();
+            while (batch.count() < StatBatchSize && dirIt.hasNext()) {
+                dirIt.next();
+                batch.append(dirIt.fileInfo());
+            }
+            statFileInfos(batch.data(), batch.count());
+            for (const QFileInfo &fileInfo : qAsConst(batch)) {
+                allFiles.append(fileInfo.fileName());
+                fetch(fileInfo, base, firstTime, updatedFiles, path);
+            }
         }
     }
     if (!allFiles.isEmpty())
         emit newListOfFiles(path, allFiles);
 
-    QStringList::const_iterator filesIt = filesToCheck.constBegin();
-    while (!abort.loadRelaxed() && filesIt != filesToCheck.constEnd()) {
-        fileInfo.setFile(path + QDir::separator() + *filesIt);
-        ++filesIt;
-        fileInfo.stat();
-        fetch(fileInfo, base, firstTime, updatedFiles, path);
+    QStringList::const_iterator filesIt = files.constBegin();
+    while (!abort.loadRelaxed() && filesIt != files.constEnd()) {
+        batch.clear();
+        while (batch.count() < StatBatchSize && filesIt != files.constEnd()) {
+            batch.append(QFileInfo(path + QDir::separator() + *filesIt));
+            ++filesIt;
+        }
+        statFileInfos(batch.data(), batch.count());
+        for (const QFileInfo &fileInfo : qAsConst(batch))
+            fetch(fileInfo, base, firstTime, updatedFiles, path);
     }
     if (!updatedFiles.isEmpty())
         emit updates(path, updatedFiles);
@@ -278,7 +278,7 @@ void QStandardItemPrivate::setItemData(const QMap<int, QVariant> &roles)
         if the matching role is not contained in roles, the new value if it is and
         if the new value is an invalid QVariant, it will be removed.
     */
-    QList<QStandardItemData> newValues;
+    Values newValues;
     newValues.reserve(values.size());
     roleMapStandardItemDataUnion(roles.keyValueBegin(),
                                  roles.keyValueEnd(),
@@ -286,7 +286,7 @@ void QStandardItemPrivate::setItemData(const QMap<int, QVariant> &roles)
                                  std::back_inserter(newValues), ByNormalizedRole());
 
     if (newValues != values) {
-        values.swap(newValues);
+        values = std::move(newValues);
         if (model) {
             QList<int> roleKeys;
             roleKeys.reserve(roles.size() + 1);
@@ -314,7 +314,7 @@ void QStandardItemPrivate::setItemData(const QMap<int, QVariant> &roles)
 const QMap<int, QVariant> QStandardItemPrivate::itemData() const
 {
     QMap<int, QVariant> result;
-    QList<QStandardItemData>::const_iterator it;
+    Values::const_iterator it;
     for (it = values.cbegin(); it != values.cend(); ++it){
         // Qt::UserRole - 1 is used internally to store the flags
         if (it->role != Qt::UserRole - 1)
@@ -920,9 +920,11 @@ void QStandardItem::setData(const QVariant &value, int role)
 {
     Q_D(QStandardItem);
     role = (role == Qt::EditRole) ? Qt::DisplayRole : role;
-    const QList<int> roles((role == Qt::DisplayRole) ?
-                                QList<int>({Qt::DisplayRole, Qt::EditRole}) :
-                                QList<int>({role}));
+    // only build the list of changed roles when there is a model to tell
+    const auto roles = [role]() {
+        return (role == Qt::DisplayRole) ? QList<int>({Qt::DisplayRole, Qt::EditRole})
+                                         : QList<int>({role});
+    };
     for (auto it = d->values.begin(); it != d->values.end(); ++it) {
         if ((*it).role == role) {
             if (value.isValid()) {
@@ -935,13 +937,13 @@ void QStandardItem::setData(const QVariant &value, int role)
                 d->values.erase(it);
             }
             if (d->model)
-                d->model->d_func()->itemChanged(this, roles);
+                d->model->d_func()->itemChanged(this, roles());
             return;
         }
     }
     d->values.append(QStandardItemData(role, value));
     if (d->model)
-        d->model->d_func()->itemChanged(this, roles);
+        d->model->d_func()->itemChanged(this, roles());
 }
 
 /*!
@@ -2035,7 +2037,7 @@ int QStandardItem::type() const
 void QStandardItem::read(QDataStream &in)
 {
     Q_D(QStandardItem);
-    in >> d->values;
+    QtPrivate::readArrayBasedContainer(in, d->values);
     qint32 flags;
     in >> flags;
     setFlags(Qt::ItemFlags(flags));
@@ -2050,7 +2052,7 @@ void QStandardItem::read(QDataStream &in)
 void QStandardItem::write(QDataStream &out) const
 {
     Q_D(const QStandardItem);
-    out << d->values;
+    QtPrivate::writeSequentialContainer(out, d->values);
     out << flags();
 }
 
@@ -58,6 +58,7 @@
 #include <QtCore/qpair.h>
 #include <QtCore/qstack.h>
 #include <QtCore/qvariant.h>
+#include <QtCore/qvarlengtharray.h>
 #include <QtCore/qdebug.h>
 
 QT_REQUIRE_CONFIG(standarditemmodel);
@@ -188,9 +189,13 @@ public:
 
     void sortChildren(int column, Qt::SortOrder order);
 
+    // Most items hold only a couple of roles, typically the text and the
+    // flags, so keep those inline instead of in a separate allocation.
+    typedef QVarLengthArray<QStandardItemData, 2> Values;
+
     QStandardItemModel *model;
     QStandardItem *parent;
-    QList<QStandardItemData> values;
+    Values values;
     QList<QStandardItem *> children;
     int rows;
     int columns;
@@ -1400,6 +1400,8 @@ void QGuiApplicationPrivate::addQtOptions(QList<QCommandLineOption> *options)
 
 void QGuiApplicationPrivate::createPlatformIntegration()
 {
+    Q_TRACE_SCOPE(QGuiApplicationPrivate_createPlatformIntegration);
+
     QHighDpiScaling::initHighDpiScaling();
 
     // Load the platform integration
@@ -3196,6 +3198,8 @@ void QGuiApplicationPrivate::processExposeEvent(QWindowSystemInterfacePrivate::E
     QWindowPrivate *p = qt_window_private(window);
 
     if (!p->receivedExpose) {
+        Q_TRACE(QGuiApplicationPrivate_processExposeEvent_first, window);
+
         if (p->resizeEventPending) {
             // as a convenience for plugins, send a resize event before the first expose event if they haven't done so
             // window->geometry() should have a valid size as soon as a handle exists.
@@ -758,21 +758,35 @@ QRect QPlatformWindow::initialGeometry(const QWindow *w, const QRect &initialGeo
 
     The default implementation posts an UpdateRequest event to the
     window after 5 ms. The additional time is there to give the event
-    loop a bit of idle time to gather system events.
+    loop a bit of idle time to gather system events. If the previous
+    update request was delivered less than one refresh interval of the
+    screen ago, the event is delayed until that interval has passed,
+    so that the window does not render frames faster than they can be
+    shown and queue them up in the swap chain.
 
 */
 void QPlatformWindow::requestUpdate()
 {
     Q_D(QPlatformWindow);
 
+    static bool customUpdateInterval = false;
     static int updateInterval = []() {
-        bool ok = false;
-        int customUpdateInterval = qEnvironmentVariableIntValue("QT_QPA_UPDATE_IDLE_TIME", &ok);
-        return ok ? customUpdateInterval : 5;
+        int interval = qEnvironmentVariableIntValue("QT_QPA_UPDATE_IDLE_TIME", &customUpdateInterval);
+        return customUpdateInterval ? interval : 5;
     }();
 
+    int interval = updateInterval;
+    if (!customUpdateInterval && d->lastUpdateRequestDelivery.isValid()) {
+        const QPlatformScreen *platformScreen = screen();
+        const qreal refreshRate = platformScreen ? platformScreen->refreshRate() : 0;
+        if (refreshRate > 0) {
+            const qint64 remaining = qRound64(1000 / refreshRate) - d->lastUpdateRequestDelivery.elapsed();
+            interval = qMax(interval, int(qMin(remaining, qint64(1000))));
+        }
+    }
+
     Q_ASSERT(!d->updateTimer.isActive());
-    d->updateTimer.start(updateInterval, Qt::PreciseTimer, window());
+    d->updateTimer.start(interval, Qt::PreciseTimer, window());
 }
 
 /*!
@@ -796,6 +810,9 @@ void QPlatformWindow::deliverUpdateRequest()
 {
     Q_ASSERT(hasPendingUpdateRequest());
 
+    Q_D(QPlatformWindow);
+    d->lastUpdateRequestDelivery.start();
+
     QWindow *w = window();
     QWindowPrivate *wp = qt_window_private(w);
     wp->updateRequestPending = false;
@@ -53,6 +53,7 @@
 
 #include <QtGui/private/qtguiglobal_p.h>
 #include <QtCore/qbasictimer.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qrect.h>
 
 QT_BEGIN_NAMESPACE
@@ -64,6 +65,7 @@ class QPlatformWindowPrivate
 public:
     QRect rect;
     QBasicTimer updateTimer;
+    QElapsedTimer lastUpdateRequestDelivery;
 };
 
 // ----------------- QPlatformInterface -----------------
@@ -401,7 +401,7 @@ bool QShortcutMap::hasShortcutForKeySequence(const QKeySequence &seq) const
     auto it = std::lower_bound(d->sequences.cbegin(), itEnd, entry);
 
     for (;it != itEnd; ++it) {
-        if (matches(entry.keyseq, (*it).keyseq) == QKeySequence::ExactMatch && (*it).correctContext() && (*it).enabled) {
+        if ((*it).enabled && matches(entry.keyseq, (*it).keyseq) == QKeySequence::ExactMatch && (*it).correctContext()) {
             return true;
         }
     }
@@ -452,20 +452,24 @@ QKeySequence::SequenceMatch QShortcutMap::find(QKeyEvent *e, int ignoredModifier
                 break;
             tempRes = matches(entry.keyseq, (*it).keyseq);
             oneKSResult = qMax(oneKSResult, tempRes);
-            if (tempRes != QKeySequence::NoMatch && (*it).correctContext()) {
-                if (tempRes == QKeySequence::ExactMatch) {
-                    if ((*it).enabled)
+            // Context matching can be expensive, so it's only done when the
+            // entry can still change the outcome.
+            if (tempRes == QKeySequence::ExactMatch) {
+                if ((*it).enabled) {
+                    if ((*it).correctContext())
                         d->identicals.append(&*it);
-                    else
-                        identicalDisabledFound = true;
-                } else if (tempRes == QKeySequence::PartialMatch) {
-                    // We don't need partials, if we have identicals
-                    if (d->identicals.size())
-                        break;
-                    // We only care about enabled partials, so we don't consume
-                    // key events when all partials are disabled!
-                    partialFound |= (*it).enabled;
+                } else if (!identicalDisabledFound && (*it).correctContext()) {
+                    identicalDisabledFound = true;
                 }
+            } else if (tempRes == QKeySequence::PartialMatch) {
+                // We don't need partials, if we have identicals. Exact
+                // matches sort before partial ones, so none can follow.
+                if (d->identicals.size())
+                    break;
+                // We only care about enabled partials, so we don't consume
+                // key events when all partials are disabled!
+                if (!partialFound && (*it).enabled && (*it).correctContext())
+                    partialFound = true;
             }
             ++it;
             // If we got a valid match on this run, there might still be more keys to check against,
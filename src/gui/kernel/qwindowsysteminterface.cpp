@@ -72,16 +72,77 @@ extern QPointer<QWindow> qt_last_mouse_receiver;
 
 // ------------------- QWindowSystemInterfacePrivate -------------------
 
+/*
+    Merges \a ev into the still unprocessed event \a last if both are mouse
+    moves or touch updates for the same window that differ only in their
+    positions, so that only the most recent state gets delivered.
+*/
+static bool mergeHighFrequencyEvent(QWindowSystemInterfacePrivate::WindowSystemEvent *last,
+                                    const QWindowSystemInterfacePrivate::WindowSystemEvent *ev)
+{
+    if (last->type != ev->type)
+        return false;
+
+    switch (ev->type) {
+    case QWindowSystemInterfacePrivate::Mouse: {
+        auto *lastMouse = static_cast<QWindowSystemInterfacePrivate::MouseEvent *>(last);
+        auto *mouse = static_cast<const QWindowSystemInterfacePrivate::MouseEvent *>(ev);
+        if (mouse->buttonType != QEvent::MouseMove || lastMouse->buttonType != QEvent::MouseMove
+                || mouse->window != lastMouse->window || mouse->device != lastMouse->device
+                || mouse->buttons != lastMouse->buttons || mouse->modifiers != lastMouse->modifiers
+                || mouse->source != lastMouse->source || mouse->nonClientArea != lastMouse->nonClientArea) {
+            return false;
+        }
+        lastMouse->localPos = mouse->localPos;
+        lastMouse->globalPos = mouse->globalPos;
+        lastMouse->timestamp = mouse->timestamp;
+        return true;
+    }
+    case QWindowSystemInterfacePrivate::Touch: {
+        auto *lastTouch = static_cast<QWindowSystemInterfacePrivate::TouchEvent *>(last);
+        auto *touch = static_cast<const QWindowSystemInterfacePrivate::TouchEvent *>(ev);
+        if (touch->touchType != QEvent::TouchUpdate || lastTouch->touchType != QEvent::TouchUpdate
+                || touch->window != lastTouch->window || touch->device != lastTouch->device
+                || touch->modifiers != lastTouch->modifiers
+                || touch->points.count() != lastTouch->points.count()) {
+            return false;
+        }
+        for (int i = 0; i < touch->points.count(); ++i) {
+            const QEventPoint &p = touch->points.at(i);
+            const QEventPoint &lastP = lastTouch->points.at(i);
+            if (p.id() != lastP.id() || p.state() != lastP.state())
+                return false;
+        }
+        lastTouch->points = touch->points;
+        lastTouch->timestamp = touch->timestamp;
+        return true;
+    }
+    default:
+        break;
+    }
+    return false;
+}
+
 /*
     Handles a window system event asynchronously by posting the event to Qt Gui.
 
     This function posts the event on the window system event queue and wakes the
     Gui event dispatcher. Qt Gui will then handle the event asynchonously at a
     later point.
+
+    When Qt::AA_CompressHighFrequencyEvents is set, a mouse move or touch update
+    that directly follows an equivalent, not yet processed event is merged into
+    that event instead of being queued separately.
 */
 template<>
 bool QWindowSystemInterfacePrivate::handleWindowSystemEvent<QWindowSystemInterface::AsynchronousDelivery>(WindowSystemEvent *ev)
 {
+    if ((ev->type == Mouse || ev->type == Touch)
+            && QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents)
+            && windowSystemEventQueue.mergeWithLast(ev, mergeHighFrequencyEvent)) {
+        delete ev;
+        return true;
+    }
     windowSystemEventQueue.append(ev);
     if (QAbstractEventDispatcher *dispatcher = QGuiApplicationPrivate::qt_qpa_core_dispatcher())
         dispatcher->wakeUp();
@@ -499,6 +499,8 @@ public:
         }
         void append(WindowSystemEvent *e)
         { const QMutexLocker locker(&mutex); impl.append(e); }
+        bool mergeWithLast(const WindowSystemEvent *e, bool (*merge)(WindowSystemEvent *, const WindowSystemEvent *))
+        { const QMutexLocker locker(&mutex); return !impl.empty() && merge(impl.last(), e); }
         int count() const
         { const QMutexLocker locker(&mutex); return impl.count(); }
         WindowSystemEvent *peekAtFirstOfType(EventType t) const
@@ -162,9 +162,11 @@ public:
 #ifndef QT_NO_VECTOR3D
     QVector3D map(const QVector3D& point) const;
     QVector3D mapVector(const QVector3D& vector) const;
+    void map(const QVector3D *points, QVector3D *results, qsizetype count) const;
 #endif
 #ifndef QT_NO_VECTOR4D
     QVector4D map(const QVector4D& point) const;
+    void map(const QVector4D *points, QVector4D *results, qsizetype count) const;
 #endif
     QRect mapRect(const QRect& rect) const;
     QRectF mapRect(const QRectF& rect) const;
@@ -18,6 +18,7 @@ HEADERS += \
         painting/qcolortrc_p.h \
         painting/qcolortrclut_p.h \
         painting/qcosmeticstroker_p.h \
+        painting/qcoveragerasterizer_p.h \
         painting/qdatabuffer_p.h \
         painting/qdrawhelper_p.h \
         painting/qdrawhelper_x86_p.h \
@@ -80,6 +81,7 @@ SOURCES += \
         painting/qcolortrclut.cpp \
         painting/qcompositionfunctions.cpp \
         painting/qcosmeticstroker.cpp \
+        painting/qcoveragerasterizer.cpp \
         painting/qdrawhelper.cpp \
         painting/qemulationpaintengine.cpp \
         painting/qgrayraster.c \
@@ -142,7 +144,9 @@ gcc:equals(QT_GCC_MAJOR_VERSION, 5) {
     SSSE3_SOURCES += painting/qdrawhelper_ssse3.cpp
     SSE4_1_SOURCES += painting/qdrawhelper_sse4.cpp \
                       painting/qimagescale_sse4.cpp
-    ARCH_HASWELL_SOURCES += painting/qdrawhelper_avx2.cpp
+    ARCH_HASWELL_SOURCES += painting/qdrawhelper_avx2.cpp \
+                            painting/qimagescale_avx2.cpp
+    AVX512BW_SOURCES += painting/qdrawhelper_avx512.cpp
 
     NEON_SOURCES += painting/qdrawhelper_neon.cpp painting/qimagescale_neon.cpp
     NEON_HEADERS += painting/qdrawhelper_neon_p.h
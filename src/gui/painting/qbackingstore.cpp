@@ -51,6 +51,8 @@
 
 #include <private/qhighdpiscaling_p.h>
 
+#include <qtgui_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
 class QBackingStorePrivate
@@ -242,6 +244,7 @@ void QBackingStore::flush(const QRegion &region, QWindow *window, const QPoint &
 
     Q_ASSERT(window == topLevelWindow || topLevelWindow->isAncestorOf(window, QWindow::ExcludeTransients));
 
+    Q_TRACE_SCOPE(QBackingStore_flush, window, region.boundingRect());
     handle()->flush(window, QHighDpi::toNativeLocalRegion(region, window),
                                             QHighDpi::toNativeLocalPosition(offset, window));
 }
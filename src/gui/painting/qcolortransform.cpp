@@ -577,6 +577,29 @@ static void storeOpaque(QRgb *dst, const QRgb *src, const QColorVector *buffer,
 static void storePremultiplied(QRgba64 *dst, const QRgba64 *src, const QColorVector *buffer, const qsizetype len,
                                const QColorTransformPrivate *d_ptr)
 {
+#if defined(__SSE2__)
+    const __m128 v4080 = _mm_set1_ps(4080.f);
+    const __m128 iFF00 = _mm_set1_ps(1.0f / (255 * 256));
+    for (qsizetype i = 0; i < len; ++i) {
+        const int a = src[i].alpha();
+        __m128 vf = _mm_loadu_ps(&buffer[i].x);
+        __m128i v = _mm_cvtps_epi32(_mm_mul_ps(vf, v4080));
+        const int ridx = _mm_extract_epi16(v, 0);
+        const int gidx = _mm_extract_epi16(v, 2);
+        const int bidx = _mm_extract_epi16(v, 4);
+        v = _mm_setr_epi32(d_ptr->colorSpaceOut->lut[0]->m_fromLinear[ridx],
+                           d_ptr->colorSpaceOut->lut[1]->m_fromLinear[gidx],
+                           d_ptr->colorSpaceOut->lut[2]->m_fromLinear[bidx], 0);
+        vf = _mm_mul_ps(_mm_cvtepi32_ps(v), _mm_mul_ps(_mm_set1_ps(a), iFF00));
+        v = _mm_cvtps_epi32(vf);
+        // There is no unsigned 32 to 16 bit pack in SSE2, so bias into the signed range
+        v = _mm_sub_epi32(v, _mm_set1_epi32(0x8000));
+        v = _mm_packs_epi32(v, v);
+        v = _mm_add_epi16(v, _mm_set1_epi16(short(0x8000)));
+        v = _mm_insert_epi16(v, a, 3);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+#else
     for (qsizetype i = 0; i < len; ++i) {
         const int a = src[i].alpha();
         const float fa = a / (255.0f * 256.0f);
@@ -585,29 +608,66 @@ static void storePremultiplied(QRgba64 *dst, const QRgba64 *src, const QColorVec
         const float b = d_ptr->colorSpaceOut->lut[2]->m_fromLinear[int(buffer[i].z * 4080.0f + 0.5f)];
         dst[i] = qRgba64(r * fa + 0.5f, g * fa + 0.5f, b * fa + 0.5f, a);
     }
+#endif
 }
 
+#if defined(__SSE2__)
+// Looks up the 16-bit output values of one pixel in the output TRC tables,
+// with the alpha lane left zero.
+static inline __m128i lookupRgb16(const QColorVector &c, const QColorTransformPrivate *d_ptr)
+{
+    const __m128 v4080 = _mm_set1_ps(4080.f);
+    __m128 vf = _mm_loadu_ps(&c.x);
+    __m128i v = _mm_cvtps_epi32(_mm_mul_ps(vf, v4080));
+    const int ridx = _mm_extract_epi16(v, 0);
+    const int gidx = _mm_extract_epi16(v, 2);
+    const int bidx = _mm_extract_epi16(v, 4);
+    v = _mm_setzero_si128();
+    v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[0]->m_fromLinear[ridx], 0);
+    v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[1]->m_fromLinear[gidx], 1);
+    v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[2]->m_fromLinear[bidx], 2);
+    // Expand 0-65280 to 0-65535, as QColorTrcLut::u16FromLinearF32() does
+    return _mm_add_epi16(v, _mm_srli_epi16(v, 8));
+}
+#endif
+
 static void storeUnpremultiplied(QRgba64 *dst, const QRgba64 *src, const QColorVector *buffer, const qsizetype len,
                                  const QColorTransformPrivate *d_ptr)
 {
+#if defined(__SSE2__)
+    for (qsizetype i = 0; i < len; ++i) {
+        __m128i v = lookupRgb16(buffer[i], d_ptr);
+        v = _mm_insert_epi16(v, src[i].alpha(), 3);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+#else
     for (qsizetype i = 0; i < len; ++i) {
          const int r = d_ptr->colorSpaceOut->lut[0]->u16FromLinearF32(buffer[i].x);
          const int g = d_ptr->colorSpaceOut->lut[1]->u16FromLinearF32(buffer[i].y);
          const int b = d_ptr->colorSpaceOut->lut[2]->u16FromLinearF32(buffer[i].z);
          dst[i] = qRgba64(r, g, b, src[i].alpha());
     }
+#endif
 }
 
 static void storeOpaque(QRgba64 *dst, const QRgba64 *src, const QColorVector *buffer, const qsizetype len,
                         const QColorTransformPrivate *d_ptr)
 {
     Q_UNUSED(src);
+#if defined(__SSE2__)
+    for (qsizetype i = 0; i < len; ++i) {
+        __m128i v = lookupRgb16(buffer[i], d_ptr);
+        v = _mm_insert_epi16(v, 0xFFFF, 3);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+#else
     for (qsizetype i = 0; i < len; ++i) {
         const int r = d_ptr->colorSpaceOut->lut[0]->u16FromLinearF32(buffer[i].x);
         const int g = d_ptr->colorSpaceOut->lut[1]->u16FromLinearF32(buffer[i].y);
         const int b = d_ptr->colorSpaceOut->lut[2]->u16FromLinearF32(buffer[i].z);
         dst[i] = qRgba64(r, g, b, 0xFFFF);
     }
+#endif
 }
 
 static constexpr qsizetype WorkBlockSize = 256;
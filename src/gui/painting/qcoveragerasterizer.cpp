@@ -0,0 +1,368 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qcoveragerasterizer_p.h"
+
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/private/qsimd_p.h>
+
+#include <cmath>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QCoverageRasterizer
+
+    An antialiasing rasterizer that accumulates the signed area covered by
+    each edge into a buffer of floats, one per pixel, and then turns each row
+    into coverage with a prefix sum. This is the approach popularized by
+    font-rs. Unlike the cell based gray raster, the cost does not depend on
+    how many edges cross a scanline, so it is faster for complex paths, at the
+    price of touching every pixel of the bounding rectangle.
+
+    The coverage is computed the same way as by the gray raster: the absolute
+    winding area clamped to one for the non-zero rule, and folded modulo two
+    for the odd-even rule.
+*/
+
+namespace {
+
+// The buffer is the bounding rectangle of the outline, clipped, with two extra
+// columns for the area that spills over to the right of the last pixel.
+class CoverageAccumulator
+{
+public:
+    CoverageAccumulator(int width, int height)
+        : m_width(width), m_height(height), m_stride(width + 2),
+          m_buffer(m_stride * height)
+    {
+        memset(m_buffer.data(), 0, m_buffer.size() * sizeof(float));
+    }
+
+    void addLine(float x0, float y0, float x1, float y1);
+    void emitSpans(int dx, int dy, bool oddEven, ProcessSpans callback, void *userData);
+
+private:
+    void accumulateLine(float x0, float y0, float x1, float y1);
+
+    int m_width;
+    int m_height;
+    int m_stride;
+    QVarLengthArray<float, 4096> m_buffer;
+};
+
+// Splits the line where it crosses the left and right edges, so that the
+// parts outside are replaced by vertical lines on the edge: to the left they
+// still cover everything to their right, to the right they cover nothing.
+void CoverageAccumulator::addLine(float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1)
+        return;
+
+    const float edges[2] = { 0, float(m_width) };
+    float t[4] = { 0, 0, 0, 1 };
+    int n = 1;
+    for (float edge : edges) {
+        if ((x0 < edge) != (x1 < edge))
+            t[n++] = (edge - x0) / (x1 - x0);
+    }
+    if (n == 3 && t[1] > t[2])
+        std::swap(t[1], t[2]);
+    t[n] = 1;
+
+    float px = x0;
+    float py = y0;
+    for (int i = 1; i <= n; ++i) {
+        const float nx = (i == n) ? x1 : x0 + (x1 - x0) * t[i];
+        const float ny = (i == n) ? y1 : y0 + (y1 - y0) * t[i];
+        accumulateLine(qBound(0.f, px, edges[1]), py, qBound(0.f, nx, edges[1]), ny);
+        px = nx;
+        py = ny;
+    }
+}
+
+void CoverageAccumulator::accumulateLine(float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1)
+        return;
+
+    float dir = 1;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1;
+    }
+    if (y1 <= 0 || y0 >= m_height)
+        return;
+
+    const float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    if (y0 < 0)
+        x -= y0 * dxdy;
+    const int yStart = qMax(0, int(y0));
+    const int yEnd = qMin(m_height, int(std::ceil(y1)));
+
+    for (int y = yStart; y < yEnd; ++y) {
+        float *row = m_buffer.data() + y * m_stride;
+        const float dy = qMin(float(y + 1), y1) - qMax(float(y), y0);
+        const float xNext = x + dxdy * dy;
+        const float d = dy * dir;
+        const float xl = qMin(x, xNext);
+        const float xr = qMax(x, xNext);
+        const float xlFloor = std::floor(xl);
+        const int xli = int(xlFloor);
+        const float xrCeil = std::ceil(xr);
+        const int xri = int(xrCeil);
+        if (xri <= xli + 1) {
+            // The line stays within one pixel on this row
+            const float xmf = 0.5f * (x + xNext) - xlFloor;
+            row[xli] += d - d * xmf;
+            row[xli + 1] += d * xmf;
+        } else {
+            const float s = 1 / (xr - xl);
+            const float xlf = xl - xlFloor;
+            const float a0 = 0.5f * s * (1 - xlf) * (1 - xlf);
+            const float xrf = xr - xrCeil + 1;
+            const float am = 0.5f * s * xrf * xrf;
+            row[xli] += d * a0;
+            if (xri == xli + 2) {
+                row[xli + 1] += d * (1 - a0 - am);
+            } else {
+                const float a1 = s * (1.5f - xlf);
+                row[xli + 1] += d * (a1 - a0);
+                for (int xi = xli + 2; xi < xri - 1; ++xi)
+                    row[xi] += d * s;
+                const float a2 = a1 + (xri - xli - 3) * s;
+                row[xri - 1] += d * (1 - a2 - am);
+            }
+            row[xri] += d * am;
+        }
+        x = xNext;
+    }
+}
+
+static inline int coverageFromArea(float area, bool oddEven)
+{
+    area = std::abs(area);
+    if (oddEven) {
+        area = std::fmod(area, 2.f);
+        if (area > 1)
+            area = 2 - area;
+    } else if (area > 1) {
+        area = 1;
+    }
+    return int(area * 255 + 0.5f);
+}
+
+void CoverageAccumulator::emitSpans(int dx, int dy, bool oddEven, ProcessSpans callback, void *userData)
+{
+    enum { SpanBufferSize = 256 };
+    QT_FT_Span spans[SpanBufferSize];
+    int spanCount = 0;
+
+    QVarLengthArray<uchar, 1024> coverage(m_width);
+    for (int y = 0; y < m_height; ++y) {
+        const float *row = m_buffer.constData() + y * m_stride;
+        uchar *c = coverage.data();
+        int x = 0;
+#if defined(__SSE2__)
+        if (!oddEven) {
+            // Prefix sum four areas at a time, carrying the last sum over
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            const __m128 one = _mm_set1_ps(1.f);
+            const __m128 scale = _mm_set1_ps(255.f);
+            const __m128 half = _mm_set1_ps(0.5f);
+            __m128 carry = _mm_setzero_ps();
+            for (; x + 4 <= m_width; x += 4) {
+                __m128 v = _mm_loadu_ps(row + x);
+                v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+                v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+                v = _mm_add_ps(v, carry);
+                carry = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+                const __m128 a = _mm_min_ps(_mm_and_ps(v, absMask), one);
+                __m128i ci = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(a, scale), half));
+                ci = _mm_packs_epi32(ci, ci);
+                ci = _mm_packus_epi16(ci, ci);
+                const int packed = _mm_cvtsi128_si32(ci);
+                memcpy(c + x, &packed, 4);
+            }
+            float area = _mm_cvtss_f32(carry);
+            for (; x < m_width; ++x) {
+                area += row[x];
+                c[x] = coverageFromArea(area, false);
+            }
+        } else
+#endif
+        {
+            float area = 0;
+            for (; x < m_width; ++x) {
+                area += row[x];
+                c[x] = coverageFromArea(area, oddEven);
+            }
+        }
+
+        // Merge runs of equal coverage into spans
+        x = 0;
+        while (x < m_width) {
+            const uchar value = c[x];
+            int end = x + 1;
+            while (end < m_width && c[end] == value)
+                ++end;
+            if (value) {
+                QT_FT_Span &span = spans[spanCount++];
+                span.x = short(x + dx);
+                span.len = ushort(end - x);
+                span.y = short(y + dy);
+                span.coverage = value;
+                if (spanCount == SpanBufferSize) {
+                    callback(spanCount, spans, userData);
+                    spanCount = 0;
+                }
+            }
+            x = end;
+        }
+    }
+    if (spanCount)
+        callback(spanCount, spans, userData);
+}
+
+} // unnamed namespace
+
+static inline QPointF fromFixed(const QT_FT_Vector &v, int dx, int dy)
+{
+    return QPointF(v.x / 64. - dx, v.y / 64. - dy);
+}
+
+/*!
+    \internal
+
+    Renders the antialiased \a outline, clipped to \a clipRect, and passes the
+    resulting spans to \a callback along with \a userData.
+
+    Returns \c false without rendering anything if the outline can't be handled
+    here, because it uses conic segments or its clipped bounding rectangle is
+    too large for the buffer. The caller should then use the gray raster.
+*/
+bool QCoverageRasterizer::rasterize(const QT_FT_Outline *outline, const QRect &clipRect,
+                                    ProcessSpans callback, void *userData)
+{
+    if (outline->n_points <= 0 || outline->n_contours <= 0)
+        return true;
+
+    QT_FT_Pos xMin = outline->points[0].x;
+    QT_FT_Pos xMax = xMin;
+    QT_FT_Pos yMin = outline->points[0].y;
+    QT_FT_Pos yMax = yMin;
+    for (int i = 0; i < outline->n_points; ++i) {
+        if (QT_FT_CURVE_TAG(outline->tags[i]) == QT_FT_CURVE_TAG_CONIC)
+            return false;
+        xMin = qMin(xMin, outline->points[i].x);
+        xMax = qMax(xMax, outline->points[i].x);
+        yMin = qMin(yMin, outline->points[i].y);
+        yMax = qMax(yMax, outline->points[i].y);
+    }
+
+    const QRect bounds = QRect(QPoint(xMin >> 6, yMin >> 6), QPoint((xMax + 63) >> 6, (yMax + 63) >> 6))
+                         .intersected(clipRect);
+    if (bounds.isEmpty())
+        return true;
+
+    // Keep the buffer within 16 MB; larger fills are better served by the gray raster
+    if (qint64(bounds.width() + 2) * bounds.height() > 4 * 1024 * 1024)
+        return false;
+
+    const int dx = bounds.x();
+    const int dy = bounds.y();
+    CoverageAccumulator accumulator(bounds.width(), bounds.height());
+
+    int first = 0;
+    for (int contour = 0; contour < outline->n_contours; ++contour) {
+        const int last = outline->contours[contour];
+        if (last < first || last >= outline->n_points
+            || QT_FT_CURVE_TAG(outline->tags[first]) != QT_FT_CURVE_TAG_ON)
+            return false;
+
+        QPointF current = fromFixed(outline->points[first], dx, dy);
+        const QPointF start = current;
+        int i = first + 1;
+        while (i <= last) {
+            if (QT_FT_CURVE_TAG(outline->tags[i]) == QT_FT_CURVE_TAG_ON) {
+                const QPointF p = fromFixed(outline->points[i], dx, dy);
+                accumulator.addLine(current.x(), current.y(), p.x(), p.y());
+                current = p;
+                ++i;
+                continue;
+            }
+
+            // Cubic: two control points followed by an end point, which
+            // is the start of the contour if the contour ends here
+            if (i + 1 > last)
+                return false;
+            const QPointF c1 = fromFixed(outline->points[i], dx, dy);
+            const QPointF c2 = fromFixed(outline->points[i + 1], dx, dy);
+            const QPointF end = i + 2 <= last ? fromFixed(outline->points[i + 2], dx, dy) : start;
+
+            // Flatten to within about a tenth of a pixel
+            const QPointF dd1 = current - 2 * c1 + c2;
+            const QPointF dd2 = c1 - 2 * c2 + end;
+            const qreal dd = qMax(std::hypot(dd1.x(), dd1.y()), std::hypot(dd2.x(), dd2.y()));
+            const int segments = qBound(1, int(std::ceil(std::sqrt(dd * 7.5))), 256);
+            QPointF p0 = current;
+            for (int s = 1; s <= segments; ++s) {
+                const qreal t = qreal(s) / segments;
+                const qreal mt = 1 - t;
+                const QPointF p = mt * mt * mt * current + 3 * mt * mt * t * c1
+                                  + 3 * mt * t * t * c2 + t * t * t * end;
+                accumulator.addLine(p0.x(), p0.y(), p.x(), p.y());
+                p0 = p;
+            }
+            current = end;
+            i += 3;
+        }
+        // Contours are implicitly closed
+        accumulator.addLine(current.x(), current.y(), start.x(), start.y());
+        first = last + 1;
+    }
+
+    accumulator.emitSpans(dx, dy, outline->flags & QT_FT_OUTLINE_EVEN_ODD_FILL, callback, userData);
+    return true;
+}
+
+QT_END_NAMESPACE
@@ -5314,6 +5314,29 @@ static void qInitDrawhelperFunctions()
     }
 #endif
 
+#if defined(QT_COMPILER_SUPPORTS_AVX512BW)
+    if (qCpuHasFeature(AVX512BW)) {
+        extern void qt_blend_argb32_on_argb32_avx512(uchar *destPixels, int dbpl,
+                                                     const uchar *srcPixels, int sbpl,
+                                                     int w, int h, int const_alpha);
+        qBlendFunctions[QImage::Format_RGB32][QImage::Format_ARGB32_Premultiplied] = qt_blend_argb32_on_argb32_avx512;
+        qBlendFunctions[QImage::Format_ARGB32_Premultiplied][QImage::Format_ARGB32_Premultiplied] = qt_blend_argb32_on_argb32_avx512;
+        qBlendFunctions[QImage::Format_RGBX8888][QImage::Format_RGBA8888_Premultiplied] = qt_blend_argb32_on_argb32_avx512;
+        qBlendFunctions[QImage::Format_RGBA8888_Premultiplied][QImage::Format_RGBA8888_Premultiplied] = qt_blend_argb32_on_argb32_avx512;
+
+        extern void QT_FASTCALL comp_func_SourceOver_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha);
+        extern void QT_FASTCALL comp_func_DestinationOver_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha);
+        extern void QT_FASTCALL comp_func_SourceIn_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha);
+        extern void QT_FASTCALL comp_func_DestinationIn_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha);
+        extern void QT_FASTCALL comp_func_solid_SourceOver_avx512(uint *destPixels, int length, uint color, uint const_alpha);
+        qt_functionForMode_C[QPainter::CompositionMode_SourceOver] = comp_func_SourceOver_avx512;
+        qt_functionForMode_C[QPainter::CompositionMode_DestinationOver] = comp_func_DestinationOver_avx512;
+        qt_functionForMode_C[QPainter::CompositionMode_SourceIn] = comp_func_SourceIn_avx512;
+        qt_functionForMode_C[QPainter::CompositionMode_DestinationIn] = comp_func_DestinationIn_avx512;
+        qt_functionForModeSolid_C[QPainter::CompositionMode_SourceOver] = comp_func_solid_SourceOver_avx512;
+    }
+#endif
+
 #endif // SSE2
 
 #if defined(__ARM_NEON__)
@@ -0,0 +1,288 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qdrawhelper_p.h"
+#include "qdrawhelper_x86_p.h"
+#include "qdrawingprimitive_sse2_p.h"
+
+#if defined(QT_COMPILER_SUPPORTS_AVX512BW)
+
+QT_BEGIN_NAMESPACE
+
+// Vectorized blend functions:
+
+// See BYTE_MUL_AVX2 for details. alphaChannel holds the alpha for each pixel
+// in both of its 16-bit halves.
+static inline __m512i Q_DECL_VECTORCALL BYTE_MUL_AVX512(__m512i pixelVector, __m512i alphaChannel)
+{
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i half = _mm512_set1_epi16(0x80);
+
+    __m512i pixelVectorAG = _mm512_srli_epi16(pixelVector, 8);
+    __m512i pixelVectorRB = _mm512_and_si512(pixelVector, colorMask);
+
+    pixelVectorAG = _mm512_mullo_epi16(pixelVectorAG, alphaChannel);
+    pixelVectorRB = _mm512_mullo_epi16(pixelVectorRB, alphaChannel);
+
+    pixelVectorRB = _mm512_add_epi16(pixelVectorRB, _mm512_srli_epi16(pixelVectorRB, 8));
+    pixelVectorAG = _mm512_add_epi16(pixelVectorAG, _mm512_srli_epi16(pixelVectorAG, 8));
+    pixelVectorRB = _mm512_add_epi16(pixelVectorRB, half);
+    pixelVectorAG = _mm512_add_epi16(pixelVectorAG, half);
+
+    pixelVectorRB = _mm512_srli_epi16(pixelVectorRB, 8);
+    pixelVectorAG = _mm512_andnot_si512(colorMask, pixelVectorAG);
+
+    return _mm512_or_si512(pixelVectorAG, pixelVectorRB);
+}
+
+// See INTERPOLATE_PIXEL_255_AVX2 for details.
+static inline __m512i Q_DECL_VECTORCALL
+INTERPOLATE_PIXEL_255_AVX512(__m512i srcVector, __m512i alphaChannel, __m512i dstVector, __m512i oneMinusAlphaChannel)
+{
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i half = _mm512_set1_epi16(0x80);
+
+    const __m512i srcVectorAG = _mm512_srli_epi16(srcVector, 8);
+    const __m512i dstVectorAG = _mm512_srli_epi16(dstVector, 8);
+    const __m512i srcVectorRB = _mm512_and_si512(srcVector, colorMask);
+    const __m512i dstVectorRB = _mm512_and_si512(dstVector, colorMask);
+    __m512i finalAG = _mm512_add_epi16(_mm512_mullo_epi16(srcVectorAG, alphaChannel),
+                                       _mm512_mullo_epi16(dstVectorAG, oneMinusAlphaChannel));
+    __m512i finalRB = _mm512_add_epi16(_mm512_mullo_epi16(srcVectorRB, alphaChannel),
+                                       _mm512_mullo_epi16(dstVectorRB, oneMinusAlphaChannel));
+    finalAG = _mm512_add_epi16(finalAG, _mm512_srli_epi16(finalAG, 8));
+    finalRB = _mm512_add_epi16(finalRB, _mm512_srli_epi16(finalRB, 8));
+    finalAG = _mm512_add_epi16(finalAG, half);
+    finalRB = _mm512_add_epi16(finalRB, half);
+    finalAG = _mm512_andnot_si512(colorMask, finalAG);
+    finalRB = _mm512_srli_epi16(finalRB, 8);
+
+    return _mm512_or_si512(finalAG, finalRB);
+}
+
+// Returns the alpha of each pixel in both of its 16-bit halves.
+static inline __m512i Q_DECL_VECTORCALL alphaChannel_avx512(__m512i pixelVector)
+{
+    const __m512i alpha = _mm512_srli_epi32(pixelVector, 24);
+    return _mm512_or_si512(alpha, _mm512_slli_epi32(alpha, 16));
+}
+
+static inline __m512i Q_DECL_VECTORCALL invAlphaChannel_avx512(__m512i pixelVector)
+{
+    return _mm512_sub_epi16(_mm512_set1_epi16(0xff), alphaChannel_avx512(pixelVector));
+}
+
+// Same as qt_div_255 on each 16-bit element.
+static inline __m512i Q_DECL_VECTORCALL div255_avx512(__m512i x)
+{
+    x = _mm512_add_epi16(x, _mm512_srli_epi16(x, 8));
+    x = _mm512_add_epi16(x, _mm512_set1_epi16(0x80));
+    return _mm512_srli_epi16(x, 8);
+}
+
+// Masks never need a prologue or an epilogue loop with AVX-512: the last
+// (partial) vector of a span is simply loaded and stored with a mask.
+static inline __mmask16 epilogueMask_avx512(int count)
+{
+    return count >= 16 ? __mmask16(0xffff) : __mmask16((1U << count) - 1);
+}
+
+template <typename Operation>
+static inline void compositionLoop_avx512(uint *dst, const uint *src, int length, Operation operation)
+{
+    for (int x = 0; x < length; x += 16) {
+        const __mmask16 mask = epilogueMask_avx512(length - x);
+        const __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+        const __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+        _mm512_mask_storeu_epi32(&dst[x], mask, operation(dstVector, srcVector));
+    }
+}
+
+template <typename Operation>
+static inline void solidCompositionLoop_avx512(uint *dst, int length, Operation operation)
+{
+    for (int x = 0; x < length; x += 16) {
+        const __mmask16 mask = epilogueMask_avx512(length - x);
+        const __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+        _mm512_mask_storeu_epi32(&dst[x], mask, operation(dstVector));
+    }
+}
+
+/*
+  result = s + d * sia
+  dest = s * ca + d * (1 - sa*ca)
+*/
+void QT_FASTCALL comp_func_SourceOver_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    Q_ASSERT(const_alpha < 256);
+
+    const __m512i alphaMask = _mm512_set1_epi32(0xff000000);
+    if (const_alpha == 255) {
+        for (int x = 0; x < length; x += 16) {
+            const __mmask16 mask = epilogueMask_avx512(length - x);
+            const __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+            const __mmask16 translucent = _mm512_mask_test_epi32_mask(mask, srcVector, alphaMask);
+            if (!translucent)
+                continue;
+            const __mmask16 opaque = _mm512_mask_cmpeq_epi32_mask(
+                        mask, _mm512_and_si512(srcVector, alphaMask), alphaMask);
+            if (opaque == mask) {
+                _mm512_mask_storeu_epi32(&dst[x], mask, srcVector);
+                continue;
+            }
+            __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+            dstVector = BYTE_MUL_AVX512(dstVector, invAlphaChannel_avx512(srcVector));
+            dstVector = _mm512_add_epi8(dstVector, srcVector);
+            _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+        }
+    } else {
+        const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+        for (int x = 0; x < length; x += 16) {
+            const __mmask16 mask = epilogueMask_avx512(length - x);
+            __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+            if (!_mm512_mask_test_epi32_mask(mask, srcVector, alphaMask))
+                continue;
+            srcVector = BYTE_MUL_AVX512(srcVector, constAlphaVector);
+            __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+            dstVector = BYTE_MUL_AVX512(dstVector, invAlphaChannel_avx512(srcVector));
+            dstVector = _mm512_add_epi8(dstVector, srcVector);
+            _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+        }
+    }
+}
+
+void QT_FASTCALL comp_func_solid_SourceOver_avx512(uint *dst, int length, uint color, uint const_alpha)
+{
+    if ((const_alpha & qAlpha(color)) == 255) {
+        qt_memfill32(dst, color, length);
+        return;
+    }
+    if (const_alpha != 255)
+        color = BYTE_MUL(color, const_alpha);
+
+    const __m512i colorVector = _mm512_set1_epi32(color);
+    const __m512i minusAlphaOfColorVector = _mm512_set1_epi16(qAlpha(~color));
+    solidCompositionLoop_avx512(dst, length, [=](__m512i dstVector) {
+        return _mm512_add_epi8(colorVector, BYTE_MUL_AVX512(dstVector, minusAlphaOfColorVector));
+    });
+}
+
+/*
+  result = d + s * dia
+  dest = d + s * dia * ca
+*/
+void QT_FASTCALL comp_func_DestinationOver_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    if (const_alpha == 255) {
+        compositionLoop_avx512(dst, src, length, [](__m512i dstVector, __m512i srcVector) {
+            srcVector = BYTE_MUL_AVX512(srcVector, invAlphaChannel_avx512(dstVector));
+            return _mm512_add_epi8(srcVector, dstVector);
+        });
+    } else {
+        const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+        compositionLoop_avx512(dst, src, length, [=](__m512i dstVector, __m512i srcVector) {
+            srcVector = BYTE_MUL_AVX512(srcVector, constAlphaVector);
+            srcVector = BYTE_MUL_AVX512(srcVector, invAlphaChannel_avx512(dstVector));
+            return _mm512_add_epi8(srcVector, dstVector);
+        });
+    }
+}
+
+/*
+  result = s * da
+  dest = s * da * ca + d * cia
+*/
+void QT_FASTCALL comp_func_SourceIn_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    if (const_alpha == 255) {
+        compositionLoop_avx512(dst, src, length, [](__m512i dstVector, __m512i srcVector) {
+            return BYTE_MUL_AVX512(srcVector, alphaChannel_avx512(dstVector));
+        });
+    } else {
+        const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+        const __m512i constInvAlphaVector = _mm512_set1_epi16(255 - const_alpha);
+        compositionLoop_avx512(dst, src, length, [=](__m512i dstVector, __m512i srcVector) {
+            srcVector = BYTE_MUL_AVX512(srcVector, constAlphaVector);
+            return INTERPOLATE_PIXEL_255_AVX512(srcVector, alphaChannel_avx512(dstVector),
+                                                dstVector, constInvAlphaVector);
+        });
+    }
+}
+
+/*
+  result = d * sa
+  dest = d * (sa * ca + cia)
+*/
+void QT_FASTCALL comp_func_DestinationIn_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    if (const_alpha == 255) {
+        compositionLoop_avx512(dst, src, length, [](__m512i dstVector, __m512i srcVector) {
+            return BYTE_MUL_AVX512(dstVector, alphaChannel_avx512(srcVector));
+        });
+    } else {
+        const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+        const __m512i constInvAlphaVector = _mm512_set1_epi16(255 - const_alpha);
+        compositionLoop_avx512(dst, src, length, [=](__m512i dstVector, __m512i srcVector) {
+            __m512i alpha = _mm512_mullo_epi16(alphaChannel_avx512(srcVector), constAlphaVector);
+            alpha = _mm512_add_epi16(div255_avx512(alpha), constInvAlphaVector);
+            return BYTE_MUL_AVX512(dstVector, alpha);
+        });
+    }
+}
+
+void qt_blend_argb32_on_argb32_avx512(uchar *destPixels, int dbpl,
+                                      const uchar *srcPixels, int sbpl,
+                                      int w, int h,
+                                      int const_alpha)
+{
+    if (const_alpha == 0)
+        return;
+    const_alpha = const_alpha == 256 ? 255 : (const_alpha * 255) >> 8;
+    for (int y = 0; y < h; ++y) {
+        comp_func_SourceOver_avx512(reinterpret_cast<uint *>(destPixels),
+                                    reinterpret_cast<const uint *>(srcPixels), w, const_alpha);
+        destPixels += dbpl;
+        srcPixels += sbpl;
+    }
+}
+
+QT_END_NAMESPACE
+
+#endif
@@ -289,6 +289,15 @@ void qt_qimageScaleAARGBA_down_xy_sse4(QImageScaleInfo *isi, unsigned int *dest,
                                        int dw, int dh, int dow, int sow);
 #endif
 
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+template<bool RGB>
+void qt_qimageScaleAARGBA_down_x_up_y_avx2(QImageScaleInfo *isi, unsigned int *dest,
+                                           int dw, int dh, int dow, int sow);
+template<bool RGB>
+void qt_qimageScaleAARGBA_down_xy_avx2(QImageScaleInfo *isi, unsigned int *dest,
+                                       int dw, int dh, int dow, int sow);
+#endif
+
 #if defined(__ARM_NEON__)
 template<bool RGB>
 void qt_qimageScaleAARGBA_up_x_down_y_neon(QImageScaleInfo *isi, unsigned int *dest,
@@ -390,6 +399,11 @@ static void qt_qimageScaleAARGBA(QImageScaleInfo *isi, unsigned int *dest,
     }
     /* if we're scaling down horizontally */
     else if (isi->xup_yup == 2) {
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+        if (qCpuHasFeature(ArchHaswell))
+            qt_qimageScaleAARGBA_down_x_up_y_avx2<false>(isi, dest, dw, dh, dow, sow);
+        else
+#endif
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
         if (qCpuHasFeature(SSE4_1))
             qt_qimageScaleAARGBA_down_x_up_y_sse4<false>(isi, dest, dw, dh, dow, sow);
@@ -403,6 +417,11 @@ static void qt_qimageScaleAARGBA(QImageScaleInfo *isi, unsigned int *dest,
     }
     /* if we're scaling down horizontally & vertically */
     else {
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+        if (qCpuHasFeature(ArchHaswell))
+            qt_qimageScaleAARGBA_down_xy_avx2<false>(isi, dest, dw, dh, dow, sow);
+        else
+#endif
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
         if (qCpuHasFeature(SSE4_1))
             qt_qimageScaleAARGBA_down_xy_sse4<false>(isi, dest, dw, dh, dow, sow);
@@ -819,6 +838,11 @@ static void qt_qimageScaleAARGB(QImageScaleInfo *isi, unsigned int *dest,
     }
     /* if we're scaling down horizontally */
     else if (isi->xup_yup == 2) {
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+        if (qCpuHasFeature(ArchHaswell))
+            qt_qimageScaleAARGBA_down_x_up_y_avx2<true>(isi, dest, dw, dh, dow, sow);
+        else
+#endif
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
         if (qCpuHasFeature(SSE4_1))
             qt_qimageScaleAARGBA_down_x_up_y_sse4<true>(isi, dest, dw, dh, dow, sow);
@@ -832,6 +856,11 @@ static void qt_qimageScaleAARGB(QImageScaleInfo *isi, unsigned int *dest,
     }
     /* if we're scaling down horizontally & vertically */
     else {
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+        if (qCpuHasFeature(ArchHaswell))
+            qt_qimageScaleAARGBA_down_xy_avx2<true>(isi, dest, dw, dh, dow, sow);
+        else
+#endif
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
         if (qCpuHasFeature(SSE4_1))
             qt_qimageScaleAARGBA_down_xy_sse4<true>(isi, dest, dw, dh, dow, sow);
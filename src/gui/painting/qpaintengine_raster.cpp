@@ -62,6 +62,7 @@
 #include <private/qimage_p.h>
 #include <private/qstatictext_p.h>
 #include <private/qcosmeticstroker_p.h>
+#include <private/qcoveragerasterizer_p.h>
 #include <private/qdrawhelper_p.h>
 #include <private/qmemrotate_p.h>
 #include <private/qpixellayout_p.h>
@@ -74,6 +75,16 @@
 #include <limits.h>
 #include <algorithm>
 
+#if QT_CONFIG(thread)
+#include <qsemaphore.h>
+#include <qthreadpool.h>
+#ifdef Q_OS_WASM
+// WebAssembly has threads; however we can't block the main thread.
+#else
+#define QT_USE_THREAD_PARALLEL_FILLS
+#endif
+#endif
+
 #ifdef Q_OS_WIN
 #  include <qvarlengtharray.h>
 #  include <private/qfontengine_p.h>
@@ -85,6 +96,39 @@
 
 QT_BEGIN_NAMESPACE
 
+/*
+    Runs \a function(yStart, yEnd) over the rows [0, height) of a rectangle
+    covering \a bytes bytes of the destination, splitting large rectangles in
+    horizontal segments that are processed in parallel on the global thread
+    pool. The rows of the destination must be independent of each other.
+*/
+template <typename Function>
+static void qt_parallelForRows(int height, qsizetype bytes, Function function)
+{
+#ifdef QT_USE_THREAD_PARALLEL_FILLS
+    int segments = int(std::min<qsizetype>(bytes / (1 << 18), height));
+
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    if (segments <= 1 || threadPool->contains(QThread::currentThread()))
+        return function(0, height);
+
+    QSemaphore semaphore;
+    int y = 0;
+    for (int i = 0; i < segments; ++i) {
+        int yn = (height - y) / (segments - i);
+        threadPool->start([&, y, yn]() {
+            function(y, y + yn);
+            semaphore.release(1);
+        });
+        y += yn;
+    }
+    semaphore.acquire(segments);
+#else
+    Q_UNUSED(bytes);
+    function(0, height);
+#endif
+}
+
 class QRectVectorPath : public QVectorPath {
 public:
     inline void set(const QRect &r) {
@@ -1023,10 +1067,23 @@ void QRasterPaintEnginePrivate::drawImage(const QPointF &pt,
     // call the blend function...
     int dstSize = rasterBuffer->bytesPerPixel();
     qsizetype dstBPL = rasterBuffer->bytesPerLine();
-    func(rasterBuffer->buffer() + x * dstSize + y * dstBPL, dstBPL,
-         srcBits, srcBPL,
-         iw, ih,
-         alpha);
+    uchar *dstBits = rasterBuffer->buffer() + x * dstSize + y * dstBPL;
+    const qsizetype bytes = qsizetype(iw) * dstSize * ih;
+
+    // Blending an image onto itself has to happen row by row from the top
+    const uchar *dstEnd = dstBits + (ih - 1) * dstBPL + iw * dstSize;
+    const uchar *srcEnd = srcBits + (ih - 1) * srcBPL + iw * srcSize;
+    if (srcBits < dstEnd && dstBits < srcEnd) {
+        func(dstBits, dstBPL, srcBits, srcBPL, iw, ih, alpha);
+        return;
+    }
+
+    qt_parallelForRows(ih, bytes, [=](int yStart, int yEnd) {
+        func(dstBits + yStart * dstBPL, dstBPL,
+             srcBits + yStart * srcBPL, srcBPL,
+             iw, yEnd - yStart,
+             alpha);
+    });
 }
 
 void QRasterPaintEnginePrivate::blitImage(const QPointF &pt,
@@ -1093,15 +1150,18 @@ void QRasterPaintEnginePrivate::blitImage(const QPointF &pt,
     // blit..
     int dstSize = rasterBuffer->bytesPerPixel();
     qsizetype dstBPL = rasterBuffer->bytesPerLine();
-    const uint *src = (const uint *) srcBits;
-    uint *dst = reinterpret_cast<uint *>(rasterBuffer->buffer() + x * dstSize + y * dstBPL);
+    uchar *dstBits = rasterBuffer->buffer() + x * dstSize + y * dstBPL;
 
     const int len = iw * (qt_depthForFormat(rasterBuffer->format) >> 3);
-    for (int y = 0; y < ih; ++y) {
-        memcpy(dst, src, len);
-        dst = (quint32 *)(((uchar *) dst) + dstBPL);
-        src = (const quint32 *)(((const uchar *) src) + srcBPL);
-    }
+    qt_parallelForRows(ih, qsizetype(len) * ih, [=](int yStart, int yEnd) {
+        const uchar *src = srcBits + yStart * srcBPL;
+        uchar *dst = dstBits + yStart * dstBPL;
+        for (int y = yStart; y < yEnd; ++y) {
+            memcpy(dst, src, len);
+            dst += dstBPL;
+            src += srcBPL;
+        }
+    });
 }
 
 
@@ -1507,7 +1567,11 @@ static void fillRect_normalized(const QRect &r, QSpanData *data,
                                || (mode == QPainter::CompositionMode_SourceOver
                                    && data->solidColor.isOpaque())))
         {
-            data->fillRect(data->rasterBuffer, x1, y1, width, height, data->solidColor);
+            const qsizetype bytes = qsizetype(width) * data->rasterBuffer->bytesPerPixel() * height;
+            qt_parallelForRows(height, bytes, [=](int yStart, int yEnd) {
+                data->fillRect(data->rasterBuffer, x1, y1 + yStart, width, yEnd - yStart,
+                               data->solidColor);
+            });
             return;
         }
     }
@@ -3664,6 +3728,11 @@ void QRasterPaintEnginePrivate::rasterize(QT_FT_Outline *outline,
         return;
     }
 
+    if ((s->renderHints & QPainter::AnalyticAntialiasing)
+        && QCoverageRasterizer::rasterize(outline, deviceRect, callback, userData)) {
+        return;
+    }
+
     // Initial size for raster pool is MINIMUM_POOL_SIZE so as to
     // minimize memory reallocations. However if initial size for
     // raster pool is changed for lower value, reallocations will
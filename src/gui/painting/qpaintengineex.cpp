@@ -159,6 +159,28 @@ struct StrokeHandler {
     QDataBuffer<QPainterPath::ElementType> types;
 };
 
+// The stroke of a path that is drawn repeatedly with the same solid pen and
+// transform scale, attached to the path's QVectorPath cache.
+struct QStrokeCacheData {
+    qreal width;
+    qreal miterLimit;
+    qreal scale;
+    Qt::PenCapStyle capStyle;
+    Qt::PenJoinStyle joinStyle;
+    bool forceOpen;
+    uint flags;
+    QList<qreal> pts;
+    QList<QPainterPath::ElementType> types;
+
+    static void cleanup(QPaintEngineEx *, void *data)
+    {
+        delete static_cast<QStrokeCacheData *>(data);
+    }
+};
+
+// Paths with fewer elements are cheap enough to stroke every time.
+static const int qt_stroke_cache_min_elements = 64;
+
 
 QPaintEngineExPrivate::QPaintEngineExPrivate()
     : dasher(&stroker),
@@ -442,6 +464,42 @@ void QPaintEngineEx::stroke(const QVectorPath &path, const QPen &pen)
     if (d->activeStroker == &d->stroker)
         d->stroker.setForceOpen(path.hasExplicitOpen());
 
+    // Solid, non-cosmetic strokes only depend on the path, the pen and the
+    // scale of the transform, so they can be reused when the same path is
+    // drawn again. Like the OpenGL engine does for fills, the path is tagged
+    // as cacheable the first time and the stroke is stored the second time.
+    // Only the raster engine, whose QVectorPath cache slots are otherwise
+    // unused, does this.
+    QStrokeCacheData *strokeCache = nullptr;
+    qreal scale = 1;
+    if (type() == QPaintEngine::Raster && d->activeStroker == &d->stroker
+        && path.elementCount() >= qt_stroke_cache_min_elements
+        && !qt_pen_is_cosmetic(pen, state()->renderHints)) {
+        if (path.isCacheable()) {
+            qt_scaleForTransform(state()->matrix, &scale);
+            QVectorPath::CacheEntry *entry = path.lookupCacheData(this);
+            if (!entry)
+                entry = path.addCacheData(this, new QStrokeCacheData, QStrokeCacheData::cleanup);
+            strokeCache = static_cast<QStrokeCacheData *>(entry->data);
+            if (!strokeCache->types.isEmpty()
+                && strokeCache->width == d->stroker.strokeWidth()
+                && strokeCache->miterLimit == d->stroker.miterLimit()
+                && strokeCache->scale == scale
+                && strokeCache->capStyle == d->stroker.capStyle()
+                && strokeCache->joinStyle == d->stroker.joinStyle()
+                && strokeCache->forceOpen == path.hasExplicitOpen()) {
+                QVectorPath strokePath(strokeCache->pts.constData(),
+                                       strokeCache->types.size(),
+                                       strokeCache->types.constData(),
+                                       strokeCache->flags);
+                fill(strokePath, pen.brush());
+                return;
+            }
+        } else {
+            path.makeCacheable();
+        }
+    }
+
     const QPainterPath::ElementType *types = path.elements();
     const qreal *points = path.points();
     int pointCount = path.elementCount();
@@ -511,6 +569,20 @@ void QPaintEngineEx::stroke(const QVectorPath &path, const QPen &pen)
         if (!d->strokeHandler->types.size()) // an empty path...
             return;
 
+        if (strokeCache) {
+            strokeCache->width = d->stroker.strokeWidth();
+            strokeCache->miterLimit = d->stroker.miterLimit();
+            strokeCache->scale = scale;
+            strokeCache->capStyle = d->stroker.capStyle();
+            strokeCache->joinStyle = d->stroker.joinStyle();
+            strokeCache->forceOpen = path.hasExplicitOpen();
+            strokeCache->flags = flags;
+            strokeCache->pts = QList<qreal>(d->strokeHandler->pts.data(),
+                                            d->strokeHandler->pts.data() + d->strokeHandler->pts.size());
+            strokeCache->types = QList<QPainterPath::ElementType>(d->strokeHandler->types.data(),
+                                                                  d->strokeHandler->types.data() + d->strokeHandler->types.size());
+        }
+
         QVectorPath strokePath(d->strokeHandler->pts.data(),
                                d->strokeHandler->types.size(),
                                d->strokeHandler->types.data(),
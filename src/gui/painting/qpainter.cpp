@@ -1441,6 +1441,13 @@ void QPainterPrivate::updateState(QPainterState *newState)
     JPEG compression.
     This value was added in Qt 5.13.
 
+    \value AnalyticAntialiasing Together with Antialiasing, indicates that the
+    raster paint engine should fill paths with a rasterizer that accumulates
+    exact area coverage into a buffer covering the bounding rectangle of the
+    path. This is usually faster for complex paths with many edges per
+    scanline, and slower for large, simple ones. Other paint engines ignore
+    this hint. This value was added in Qt 6.0.
+
     \sa renderHints(), setRenderHint(), {QPainter#Rendering
     Quality}{Rendering Quality}, {Concentric Circles Example}
 
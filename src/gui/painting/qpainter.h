@@ -89,6 +89,7 @@ public:
         SmoothPixmapTransform = 0x04,
         Qt4CompatiblePainting = 0x20,
         LosslessImageRendering = 0x40,
+        AnalyticAntialiasing = 0x80,
     };
     Q_FLAG(RenderHint)
 
@@ -1542,6 +1542,7 @@ bool QPdfEngine::begin(QPaintDevice *pdev)
 
     d->pages.clear();
     d->imageCache.clear();
+    d->imageContentCache.clear();
     d->alphaCache.clear();
 
     setActive(true);
@@ -2836,6 +2837,27 @@ int QPdfEnginePrivate::addImage(const QImage &img, bool *bitmap, bool lossless,
     if(object)
         return object;
 
+    // Images loaded or copied anew for every page have a new cache key each
+    // time; identify them by their contents so they are only embedded once.
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    {
+        const int header[] = { img.width(), img.height(), int(img.format()),
+                               int(*bitmap), int(lossless) };
+        hash.addData(reinterpret_cast<const char *>(header), sizeof(header));
+        const QList<QRgb> colorTable = img.colorTable();
+        hash.addData(reinterpret_cast<const char *>(colorTable.constData()),
+                     colorTable.size() * sizeof(QRgb));
+        const int bytesPerLine = (img.width() * img.depth() + 7) / 8;
+        for (int y = 0; y < img.height(); ++y)
+            hash.addData(reinterpret_cast<const char *>(img.constScanLine(y)), bytesPerLine);
+    }
+    const QByteArray contentKey = hash.result();
+    object = imageContentCache.value(contentKey);
+    if (object) {
+        imageCache.insert(serial_no, object);
+        return object;
+    }
+
     QImage image = img;
     QImage::Format format = image.format();
 
@@ -2966,6 +2988,7 @@ int QPdfEnginePrivate::addImage(const QImage &img, bool *bitmap, bool lossless,
                             maskObject, softMaskObject, dct);
     }
     imageCache.insert(serial_no, object);
+    imageContentCache.insert(contentKey, object);
     return object;
 }
 
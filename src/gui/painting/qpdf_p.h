@@ -343,6 +343,7 @@ private:
     int pageRoot, embeddedfilesRoot, namesRoot, catalog, info, graphicsState, patternColorSpace;
     QList<uint> pages;
     QHash<qint64, uint> imageCache;
+    QHash<QByteArray, uint> imageContentCache;
     QHash<QPair<uint, uint>, uint > alphaCache;
     QList<AttachmentInfo> fileCache;
     QByteArray xmpDocumentMetadata;
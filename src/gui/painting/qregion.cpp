@@ -2615,6 +2615,33 @@ static void miSubtractO(QRegionPrivate &dest, const QRect *r1, const QRect *r1En
  *-----------------------------------------------------------------------
  */
 
+/*
+ * Subtracting one rectangle from another is by far the most common case
+ * (e.g. removing an opaque child from its parent's exposed area). The
+ * result has at most three bands and four rectangles, and the bands can
+ * never be coalesced, so write them out directly instead of going through
+ * miRegionOp.
+ */
+static void SubtractRectFromRect(const QRect &m, const QRect &s, QRegionPrivate &dest)
+{
+    const QRect i = qt_rect_intersect_normalized(m, s);
+    Q_ASSERT(!i.isEmpty());
+    Q_ASSERT(i != m);
+
+    dest.rects.resize(4);
+    QRect *r = dest.rects.data();
+    int n = 0;
+    if (m.top() < i.top())
+        r[n++].setCoords(m.left(), m.top(), m.right(), i.top() - 1);
+    if (m.left() < i.left())
+        r[n++].setCoords(m.left(), i.top(), i.left() - 1, i.bottom());
+    if (i.right() < m.right())
+        r[n++].setCoords(i.right() + 1, i.top(), m.right(), i.bottom());
+    if (i.bottom() < m.bottom())
+        r[n++].setCoords(m.left(), i.bottom() + 1, m.right(), m.bottom());
+    dest.numRects = n;
+}
+
 static void SubtractRegion(QRegionPrivate *regM, QRegionPrivate *regS,
                            QRegionPrivate &dest)
 {
@@ -2624,6 +2651,12 @@ static void SubtractRegion(QRegionPrivate *regM, QRegionPrivate *regS,
     Q_ASSERT(!regS->contains(*regM));
     Q_ASSERT(!EqualRegion(regM, regS));
 
+    if (regM->numRects == 1 && regS->numRects == 1) {
+        SubtractRectFromRect(regM->extents, regS->extents, dest);
+        miSetExtents(dest);
+        return;
+    }
+
     miRegionOp(dest, regM, regS, miSubtractO, miSubtractNonO1, nullptr);
 
     /*
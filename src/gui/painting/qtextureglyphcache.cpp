@@ -332,14 +332,16 @@ void QImageTextureGlyphCache::fillTexture(const Coord &c, glyph_t g, QFixed subP
 
     if (m_format == QFontEngine::Format_A32
         || m_format == QFontEngine::Format_ARGB) {
-        QImage ref(m_image.bits() + (c.x * 4 + c.y * m_image.bytesPerLine()),
-                   qMin(mask.width(), c.w), qMin(mask.height(), c.h), m_image.bytesPerLine(),
-                   m_image.format());
-        QPainter p(&ref);
-        p.setCompositionMode(QPainter::CompositionMode_Source);
-        p.fillRect(0, 0, c.w, c.h, QColor(0,0,0,0)); // TODO optimize this
-        p.drawImage(0, 0, mask);
-        p.end();
+        // Copy the rows directly instead of going through a QPainter for
+        // every glyph; this is hit for every new glyph while scrolling.
+        if (mask.format() != m_image.format())
+            mask.convertTo(m_image.format());
+        const int mw = qMin(mask.width(), c.w);
+        const int mh = qMin(mask.height(), c.h);
+        uchar *d = m_image.bits();
+        const qsizetype dbpl = m_image.bytesPerLine();
+        for (int y = 0; y < mh; ++y)
+            memcpy(d + (c.y + y) * dbpl + c.x * 4, mask.constScanLine(y), mw * 4);
     } else if (m_format == QFontEngine::Format_Mono) {
         if (mask.depth() > 1) {
             // TODO optimize this
@@ -388,16 +390,8 @@ void QImageTextureGlyphCache::fillTexture(const Coord &c, glyph_t g, QFixed subP
                 }
             }
         } else if (mask.depth() == 8) {
-            for (int y = 0; y < c.h; ++y) {
-                uchar *dest = d + (c.y + y) *dbpl + c.x;
-                if (y < mh) {
-                    const uchar *src = mask.constScanLine(y);
-                    for (int x = 0; x < c.w; ++x) {
-                        if (x < mw)
-                            dest[x] = src[x];
-                    }
-                }
-            }
+            for (int y = 0; y < mh; ++y)
+                memcpy(d + (c.y + y) * dbpl + c.x, mask.constScanLine(y), mw);
         }
     }
 
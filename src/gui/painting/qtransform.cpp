@@ -1367,6 +1367,41 @@ static QPolygonF mapProjective(const QTransform &transform, const QPolygonF &pol
     \sa QTransform::map()
 */
 
+static inline qreal &pointX(QPointF &p) { return p.rx(); }
+static inline qreal &pointY(QPointF &p) { return p.ry(); }
+static inline qreal pointX(const QPointF &p) { return p.x(); }
+static inline qreal pointY(const QPointF &p) { return p.y(); }
+static inline qreal &pointX(QPainterPath::Element &e) { return e.x; }
+static inline qreal &pointY(QPainterPath::Element &e) { return e.y; }
+
+/*
+    Maps \a count points from \a src to \a dst (which may be the same) with
+    the affine transformation \a t of \a m. Unlike the MAP macro, this
+    checks the transformation type once for the whole array, which keeps
+    the loops free of branches.
+*/
+template <typename Src, typename Dst>
+static void mapAffine(const QTransform &m, QTransform::TransformationType t,
+                      Src *src, Dst *dst, qsizetype count)
+{
+    Q_ASSERT(t >= QTransform::TxScale && t < QTransform::TxProject);
+    const qreal m11 = m.m11(), m12 = m.m12(), m21 = m.m21(), m22 = m.m22();
+    const qreal dx = m.dx(), dy = m.dy();
+    if (t == QTransform::TxScale) {
+        for (qsizetype i = 0; i < count; ++i) {
+            pointX(dst[i]) = m11 * pointX(src[i]) + dx;
+            pointY(dst[i]) = m22 * pointY(src[i]) + dy;
+        }
+    } else {
+        for (qsizetype i = 0; i < count; ++i) {
+            const qreal x = pointX(src[i]);
+            const qreal y = pointY(src[i]);
+            pointX(dst[i]) = m11 * x + m21 * y + dx;
+            pointY(dst[i]) = m12 * x + m22 * y + dy;
+        }
+    }
+}
+
 /*!
     \fn QPolygonF QTransform::map(const QPolygonF &polygon) const
     \overload
@@ -1385,14 +1420,8 @@ QPolygonF QTransform::map(const QPolygonF &a) const
         return mapProjective(*this, a);
 
     int size = a.size();
-    int i;
     QPolygonF p(size);
-    const QPointF *da = a.constData();
-    QPointF *dp = p.data();
-
-    for(i = 0; i < size; ++i) {
-        MAP(da[i].xp, da[i].yp, dp[i].xp, dp[i].yp);
-    }
+    mapAffine(*this, t, a.constData(), p.data(), size);
     return p;
 }
 
@@ -1641,10 +1670,8 @@ QPainterPath QTransform::map(const QPainterPath &path) const
     } else {
         copy.detach();
         // Full xform
-        for (int i=0; i<path.elementCount(); ++i) {
-            QPainterPath::Element &e = copy.d_ptr->elements[i];
-            MAP(e.x, e.y, e.x, e.y);
-        }
+        QPainterPath::Element *e = copy.d_ptr->elements.data();
+        mapAffine(*this, t, e, e, path.elementCount());
     }
 
     return copy;
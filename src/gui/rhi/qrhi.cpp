@@ -38,6 +38,8 @@
 #include <qmath.h>
 #include <QLoggingCategory>
 
+#include <qtgui_tracepoints_p.h>
+
 #include "qrhinull_p_p.h"
 #ifndef QT_NO_OPENGL
 #include "qrhigles2_p_p.h"
@@ -608,6 +610,12 @@ Q_LOGGING_CATEGORY(QRHI_LOG_INFO, "qt.rhi.general")
     the 1 byte per component formats QRhiTexture::R8 and
     QRhiTexture::RED_OR_ALPHA8 are supported as well. Backends other than
     OpenGL can be expected to return true for this feature.
+
+    \value SwapChainDamageRegion Indicates that the damage region set via
+    QRhiSwapChain::setDamageRegion() is passed on to the windowing system when
+    presenting. With Vulkan this requires the \c VK_KHR_incremental_present
+    device extension. When reported as false, the damage region is ignored and
+    every present is treated as a full update.
  */
 
 /*!
@@ -3877,6 +3885,37 @@ QRhiResource::Type QRhiSwapChain::resourceType() const
     \sa surfacePixelSize()
   */
 
+/*!
+    \fn QRegion QRhiSwapChain::damageRegion() const
+
+    \return the damage region for the frame that is currently being recorded.
+
+    \sa setDamageRegion()
+ */
+
+/*!
+    \fn void QRhiSwapChain::setDamageRegion(const QRegion &region)
+
+    Sets the \a region, in pixels with the origin at the top-left corner of
+    the surface, that has changed compared to the previously presented frame.
+
+    The backend passes the region on to the presentation engine when the
+    frame is presented in QRhi::endFrame(), so that the compositor or display
+    controller only needs to update the changed parts of the screen. This can
+    save considerable power and memory bandwidth for mostly static content.
+    The contents of the swapchain images are not preserved between frames,
+    so the entire frame must still be rendered.
+
+    The region applies to the current frame only and is reset after
+    endFrame(). An empty region, which is the default, means that the whole
+    surface is damaged.
+
+    \note This is a hint and is only honored when
+    QRhi::isFeatureSupported() reports QRhi::SwapChainDamageRegion.
+
+    \sa damageRegion()
+ */
+
 /*!
     \fn QSize QRhiSwapChain::surfacePixelSize()
 
@@ -5567,6 +5606,53 @@ bool QRhi::isDeviceLost() const
     return d->isDeviceLost();
 }
 
+/*!
+    \return a binary data blob with data collected from the
+    QRhiGraphicsPipeline and QRhiComputePipeline successfully created during
+    the lifetime of this QRhi.
+
+    By saving and then, in subsequent runs of the same application, reloading
+    the cache data, pipeline and shader creation times can potentially be
+    reduced. What exactly the cache and its serialized version includes is not
+    specified, is always specific to the backend used, and in some cases also
+    dependent on the particular implementation of the graphics API.
+
+    With Vulkan this maps directly to the contents of the \c VkPipelineCache.
+    The returned data is prefixed with a header identifying the physical
+    device and driver, so that setPipelineCacheData() can safely reject data
+    saved on a different system. Other backends currently do not support
+    pipeline cache serialization and return an empty QByteArray.
+
+    A typical place to store the data is a file under
+    QStandardPaths::CacheLocation, with the file name containing the
+    backend's name so that caches from different backends do not clash.
+
+    \sa setPipelineCacheData()
+ */
+QByteArray QRhi::pipelineCacheData()
+{
+    return d->pipelineCacheData();
+}
+
+/*!
+    Loads \a data into the pipeline cache, when applicable.
+
+    This function should be called right after create(), before creating any
+    graphics or compute pipelines, to give the backend the chance to reuse the
+    data when compiling them.
+
+    Data that was not generated by the same backend on the same device and
+    driver version is ignored with a warning. Invalid or stale data is never
+    fatal: at worst the pipelines are compiled from scratch, as they would be
+    without a cache.
+
+    \sa pipelineCacheData()
+ */
+void QRhi::setPipelineCacheData(const QByteArray &data)
+{
+    d->setPipelineCacheData(data);
+}
+
 /*!
     \return a new graphics pipeline resource.
 
@@ -5763,9 +5849,11 @@ QRhi::FrameOpResult QRhi::beginFrame(QRhiSwapChain *swapChain, BeginFrameFlags f
     if (d->inFrame)
         qWarning("Attempted to call beginFrame() within a still active frame; ignored");
 
+    Q_TRACE(QRhi_beginFrame_entry, swapChain);
     QRhi::FrameOpResult r = !d->inFrame ? d->beginFrame(swapChain, flags) : FrameOpSuccess;
     if (r == FrameOpSuccess)
         d->inFrame = true;
+    Q_TRACE(QRhi_beginFrame_exit, int(r));
 
     return r;
 }
@@ -5798,12 +5886,15 @@ QRhi::FrameOpResult QRhi::endFrame(QRhiSwapChain *swapChain, EndFrameFlags flags
     if (!d->inFrame)
         qWarning("Attempted to call endFrame() without an active frame; ignored");
 
+    Q_TRACE(QRhi_endFrame_entry, swapChain);
     QRhi::FrameOpResult r = d->inFrame ? d->endFrame(swapChain, flags) : FrameOpSuccess;
     d->inFrame = false;
+    swapChain->setDamageRegion(QRegion());
     // deleteLater is a high level QRhi concept the backends know
     // nothing about - handle it here.
     qDeleteAll(d->pendingDeleteResources);
     d->pendingDeleteResources.clear();
+    Q_TRACE(QRhi_endFrame_exit, int(r));
 
     return r;
 }
@@ -56,6 +56,7 @@
 #include <QThread>
 #include <QColor>
 #include <QImage>
+#include <QRegion>
 #include <functional>
 #include <array>
 #include <private/qshader_p.h>
@@ -1268,6 +1269,9 @@ public:
 
     QSize currentPixelSize() const { return m_currentPixelSize; }
 
+    QRegion damageRegion() const { return m_damageRegion; }
+    void setDamageRegion(const QRegion &region) { m_damageRegion = region; }
+
     virtual QRhiCommandBuffer *currentFrameCommandBuffer() = 0;
     virtual QRhiRenderTarget *currentFrameRenderTarget() = 0;
     virtual QSize surfacePixelSize() = 0;
@@ -1282,6 +1286,7 @@ protected:
     int m_sampleCount = 1;
     QRhiRenderPassDescriptor *m_renderPassDesc = nullptr;
     QSize m_currentPixelSize;
+    QRegion m_damageRegion;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QRhiSwapChain::Flags)
@@ -1460,7 +1465,8 @@ public:
         RenderToNonBaseMipLevel,
         UIntAttributes,
         ScreenSpaceDerivatives,
-        ReadBackAnyTextureFormat
+        ReadBackAnyTextureFormat,
+        SwapChainDamageRegion
     };
 
     enum BeginFrameFlag {
@@ -1567,6 +1573,9 @@ public:
 
     bool isDeviceLost() const;
 
+    QByteArray pipelineCacheData();
+    void setPipelineCacheData(const QByteArray &data);
+
 protected:
     QRhi();
 
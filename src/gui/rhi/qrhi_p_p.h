@@ -163,6 +163,8 @@ public:
     virtual bool makeThreadLocalNativeContextCurrent() = 0;
     virtual void releaseCachedResources() = 0;
     virtual bool isDeviceLost() const = 0;
+    virtual QByteArray pipelineCacheData() = 0;
+    virtual void setPipelineCacheData(const QByteArray &data) = 0;
 
     bool isCompressedFormat(QRhiTexture::Format format) const;
     void compressedFormatInfo(QRhiTexture::Format format, const QSize &size,
@@ -456,6 +458,47 @@ private:
     int curBinding = -1;
 };
 
+// A growable list of trivially copyable command structs. Unlike a QList,
+// reset() keeps both the storage and the elements, and get() hands out a
+// reference to the next slot, so recording a command is a pointer bump
+// instead of constructing a temporary and copying it in. The caller is
+// expected to fill in every field it relies on.
+template<typename T, int GROW = 1024>
+class QRhiBackendCommandList
+{
+public:
+    QRhiBackendCommandList() = default;
+    ~QRhiBackendCommandList() { delete[] v; }
+    inline void reset() { p = 0; }
+    inline bool isEmpty() const { return p == 0; }
+    inline int count() const { return p; }
+    inline T &get() {
+        if (p == a) {
+            a += GROW;
+            T *nv = new T[a];
+            if (v) {
+                memcpy(static_cast<void *>(nv), static_cast<const void *>(v), p * sizeof(T));
+                delete[] v;
+            }
+            v = nv;
+        }
+        return v[p++];
+    }
+    inline void unget() { --p; }
+    inline T *begin() { return v; }
+    inline T *end() { return v + p; }
+    inline const T *cbegin() const { return v; }
+    inline const T *cend() const { return v + p; }
+    inline const T *begin() const { return v; }
+    inline const T *end() const { return v + p; }
+
+private:
+    Q_DISABLE_COPY(QRhiBackendCommandList)
+    T *v = nullptr;
+    int a = 0;
+    int p = 0;
+};
+
 class QRhiGlobalObjectIdGenerator
 {
 public:
@@ -531,6 +531,8 @@ bool QRhiD3D11::isFeatureSupported(QRhi::Feature feature) const
         return true;
     case QRhi::ReadBackAnyTextureFormat:
         return true;
+    case QRhi::SwapChainDamageRegion:
+        return false;
     default:
         Q_UNREACHABLE();
         return false;
@@ -586,6 +588,16 @@ bool QRhiD3D11::isDeviceLost() const
     return deviceLost;
 }
 
+QByteArray QRhiD3D11::pipelineCacheData()
+{
+    return QByteArray();
+}
+
+void QRhiD3D11::setPipelineCacheData(const QByteArray &data)
+{
+    Q_UNUSED(data);
+}
+
 QRhiRenderBuffer *QRhiD3D11::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                 int sampleCount, QRhiRenderBuffer::Flags flags,
                                                 QRhiTexture::Format backingFormatHint)
@@ -153,6 +153,10 @@ QT_BEGIN_NAMESPACE
 #define GL_RG                             0x8227
 #endif
 
+#ifndef GL_UNPACK_ROW_LENGTH
+#define GL_UNPACK_ROW_LENGTH              0x0CF2
+#endif
+
 #ifndef GL_R16
 #define GL_R16                            0x822A
 #endif
@@ -532,6 +536,9 @@ bool QRhiGles2::create(QRhi::Flags flags)
     caps.uintAttributes = caps.ctxMajor >= 3; // 3.0 or ES 3.0
     caps.screenSpaceDerivatives = f->hasOpenGLExtension(QOpenGLExtensions::StandardDerivatives);
 
+    // GL_UNPACK_ROW_LENGTH is core in desktop OpenGL and OpenGL ES 3.0
+    caps.unpackRowLength = !caps.gles || caps.ctxMajor >= 3;
+
     // TO DO: We could also check for ARB_texture_multisample but it is not
     // currently in QOpenGLExtensions
     // 3.0 or ES 3.1
@@ -910,6 +917,8 @@ bool QRhiGles2::isFeatureSupported(QRhi::Feature feature) const
         return caps.screenSpaceDerivatives;
     case QRhi::ReadBackAnyTextureFormat:
         return false;
+    case QRhi::SwapChainDamageRegion:
+        return false;
     default:
         Q_UNREACHABLE();
         return false;
@@ -971,6 +980,16 @@ bool QRhiGles2::isDeviceLost() const
     return contextLost;
 }
 
+QByteArray QRhiGles2::pipelineCacheData()
+{
+    return QByteArray();
+}
+
+void QRhiGles2::setPipelineCacheData(const QByteArray &data)
+{
+    Q_UNUSED(data);
+}
+
 QRhiRenderBuffer *QRhiGles2::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                 int sampleCount, QRhiRenderBuffer::Flags flags,
                                                 QRhiTexture::Format backingFormatHint)
@@ -1543,11 +1562,21 @@ void QRhiGles2::enqueueSubresUpload(QGles2Texture *texD, QGles2CommandBuffer *cb
         QSize size = img.size();
         QGles2CommandBuffer::Command cmd;
         cmd.cmd = QGles2CommandBuffer::Command::SubImage;
+        int rowLength = 0;
+        qsizetype srcOffset = 0;
         if (!subresDesc.sourceSize().isEmpty() || !subresDesc.sourceTopLeft().isNull()) {
             const QPoint sp = subresDesc.sourceTopLeft();
             if (!subresDesc.sourceSize().isEmpty())
                 size = subresDesc.sourceSize();
-            img = img.copy(sp.x(), sp.y(), size.width(), size.height());
+            const int bpp = img.depth() / 8;
+            if (caps.unpackRowLength && bpp > 0 && img.bytesPerLine() % bpp == 0) {
+                // Upload straight from the source image, instead of copying
+                // out the sub-rectangle first.
+                rowLength = int(img.bytesPerLine() / bpp);
+                srcOffset = sp.y() * img.bytesPerLine() + sp.x() * bpp;
+            } else {
+                img = img.copy(sp.x(), sp.y(), size.width(), size.height());
+            }
         }
         cmd.args.subImage.target = texD->target;
         cmd.args.subImage.texture = texD->texture;
@@ -1560,7 +1589,8 @@ void QRhiGles2::enqueueSubresUpload(QGles2Texture *texD, QGles2CommandBuffer *cb
         cmd.args.subImage.glformat = texD->glformat;
         cmd.args.subImage.gltype = texD->gltype;
         cmd.args.subImage.rowStartAlign = 4;
-        cmd.args.subImage.data = cbD->retainImage(img);
+        cmd.args.subImage.rowLength = rowLength;
+        cmd.args.subImage.data = static_cast<const uchar *>(cbD->retainImage(img)) + srcOffset;
         cbD->commands.append(cmd);
     } else if (!rawData.isEmpty() && isCompressed) {
         if (!texD->compressedAtlasBuilt && (texD->flags() & QRhiTexture::UsedAsCompressedAtlas)) {
@@ -1635,6 +1665,7 @@ void QRhiGles2::enqueueSubresUpload(QGles2Texture *texD, QGles2CommandBuffer *cb
         // requirement) is 4. QImage guarantees 4 byte aligned
         // row starts, but our raw data here does not.
         cmd.args.subImage.rowStartAlign = (bpl & 3) ? 1 : 4;
+        cmd.args.subImage.rowLength = 0;
         cmd.args.subImage.data = cbD->retainData(rawData);
         cbD->commands.append(cmd);
     } else {
@@ -2473,6 +2504,8 @@ void QRhiGles2::executeCommandBuffer(QRhiCommandBuffer *cb)
             f->glBindTexture(cmd.args.subImage.target, cmd.args.subImage.texture);
             if (cmd.args.subImage.rowStartAlign != 4)
                 f->glPixelStorei(GL_UNPACK_ALIGNMENT, cmd.args.subImage.rowStartAlign);
+            if (cmd.args.subImage.rowLength != 0)
+                f->glPixelStorei(GL_UNPACK_ROW_LENGTH, cmd.args.subImage.rowLength);
             f->glTexSubImage2D(cmd.args.subImage.faceTarget, cmd.args.subImage.level,
                                cmd.args.subImage.dx, cmd.args.subImage.dy,
                                cmd.args.subImage.w, cmd.args.subImage.h,
@@ -2480,6 +2513,8 @@ void QRhiGles2::executeCommandBuffer(QRhiCommandBuffer *cb)
                                cmd.args.subImage.data);
             if (cmd.args.subImage.rowStartAlign != 4)
                 f->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            if (cmd.args.subImage.rowLength != 0)
+                f->glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
             break;
         case QGles2CommandBuffer::Command::CompressedImage:
             f->glBindTexture(cmd.args.compressedImage.target, cmd.args.compressedImage.texture);
@@ -2758,6 +2793,24 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
     int texUnit = 0;
     QVarLengthArray<float, 256> packedFloatArray;
 
+    // Uniform values are part of the program object and persist across
+    // draw calls, so a glUniform call can be skipped when the program
+    // already has the value. With many small draws this saves most of the
+    // uniform traffic, since typically only a few values change per draw.
+    QGles2UniformState *uniformState = maybeGraphicsPs ? QRHI_RES(QGles2GraphicsPipeline, maybeGraphicsPs)->uniformState
+                                                       : QRHI_RES(QGles2ComputePipeline, maybeComputePs)->uniformState;
+    auto needsUniformUpdate = [uniformState](int location, int componentCount, const void *src) {
+        if (location < 0 || location > QGles2UniformState::MAX_TRACKED_LOCATION)
+            return true;
+        QGles2UniformState &state(uniformState[location]);
+        const size_t byteSize = size_t(componentCount) * sizeof(quint32);
+        if (state.componentCount == componentCount && !memcmp(state.v, src, byteSize))
+            return false;
+        state.componentCount = componentCount;
+        memcpy(state.v, src, byteSize);
+        return true;
+    };
+
     for (int i = 0, ie = srbD->m_bindings.count(); i != ie; ++i) {
         const QRhiShaderResourceBinding::Data *b = srbD->m_bindings.at(i).data();
 
@@ -2807,7 +2860,8 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
                     {
                         const int elemCount = uniform.arrayDim;
                         if (elemCount < 1) {
-                            f->glUniform1f(uniform.glslLocation, *reinterpret_cast<const float *>(src));
+                            if (needsUniformUpdate(uniform.glslLocation, 1, src))
+                                f->glUniform1f(uniform.glslLocation, *reinterpret_cast<const float *>(src));
                         } else {
                             // input is 16 bytes per element as per std140, have to convert to packed
                             packedFloatArray.resize(elemCount);
@@ -2820,7 +2874,8 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
                     {
                         const int elemCount = uniform.arrayDim;
                         if (elemCount < 1) {
-                            f->glUniform2fv(uniform.glslLocation, 1, reinterpret_cast<const float *>(src));
+                            if (needsUniformUpdate(uniform.glslLocation, 2, src))
+                                f->glUniform2fv(uniform.glslLocation, 1, reinterpret_cast<const float *>(src));
                         } else {
                             packedFloatArray.resize(elemCount * 2);
                             qrhi_std140_to_packed(packedFloatArray.data(), 2, elemCount, src);
@@ -2832,7 +2887,8 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
                     {
                         const int elemCount = uniform.arrayDim;
                         if (elemCount < 1) {
-                            f->glUniform3fv(uniform.glslLocation, 1, reinterpret_cast<const float *>(src));
+                            if (needsUniformUpdate(uniform.glslLocation, 3, src))
+                                f->glUniform3fv(uniform.glslLocation, 1, reinterpret_cast<const float *>(src));
                         } else {
                             packedFloatArray.resize(elemCount * 3);
                             qrhi_std140_to_packed(packedFloatArray.data(), 3, elemCount, src);
@@ -2841,7 +2897,8 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
                     }
                         break;
                     case QShaderDescription::Vec4:
-                        f->glUniform4fv(uniform.glslLocation, qMax(1, uniform.arrayDim), reinterpret_cast<const float *>(src));
+                        if (uniform.arrayDim > 0 || needsUniformUpdate(uniform.glslLocation, 4, src))
+                            f->glUniform4fv(uniform.glslLocation, qMax(1, uniform.arrayDim), reinterpret_cast<const float *>(src));
                         break;
                     case QShaderDescription::Mat2:
                         f->glUniformMatrix2fv(uniform.glslLocation, 1, GL_FALSE, reinterpret_cast<const float *>(src));
@@ -2861,40 +2918,52 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
                         f->glUniformMatrix4fv(uniform.glslLocation, 1, GL_FALSE, reinterpret_cast<const float *>(src));
                         break;
                     case QShaderDescription::Int:
-                        f->glUniform1i(uniform.glslLocation, *reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 1, src))
+                            f->glUniform1i(uniform.glslLocation, *reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Int2:
-                        f->glUniform2iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 2, src))
+                            f->glUniform2iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Int3:
-                        f->glUniform3iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 3, src))
+                            f->glUniform3iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Int4:
-                        f->glUniform4iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 4, src))
+                            f->glUniform4iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Uint:
-                        f->glUniform1ui(uniform.glslLocation, *reinterpret_cast<const quint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 1, src))
+                            f->glUniform1ui(uniform.glslLocation, *reinterpret_cast<const quint32 *>(src));
                         break;
                     case QShaderDescription::Uint2:
-                        f->glUniform2uiv(uniform.glslLocation, 1, reinterpret_cast<const quint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 2, src))
+                            f->glUniform2uiv(uniform.glslLocation, 1, reinterpret_cast<const quint32 *>(src));
                         break;
                     case QShaderDescription::Uint3:
-                        f->glUniform3uiv(uniform.glslLocation, 1, reinterpret_cast<const quint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 3, src))
+                            f->glUniform3uiv(uniform.glslLocation, 1, reinterpret_cast<const quint32 *>(src));
                         break;
                     case QShaderDescription::Uint4:
-                        f->glUniform4uiv(uniform.glslLocation, 1, reinterpret_cast<const quint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 4, src))
+                            f->glUniform4uiv(uniform.glslLocation, 1, reinterpret_cast<const quint32 *>(src));
                         break;
                     case QShaderDescription::Bool: // a glsl bool is 4 bytes, like (u)int
-                        f->glUniform1i(uniform.glslLocation, *reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 1, src))
+                            f->glUniform1i(uniform.glslLocation, *reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Bool2:
-                        f->glUniform2iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 2, src))
+                            f->glUniform2iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Bool3:
-                        f->glUniform3iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 3, src))
+                            f->glUniform3iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
                         break;
                     case QShaderDescription::Bool4:
-                        f->glUniform4iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
+                        if (needsUniformUpdate(uniform.glslLocation, 4, src))
+                            f->glUniform4iv(uniform.glslLocation, 1, reinterpret_cast<const qint32 *>(src));
                         break;
                     default:
                         qWarning("Uniform with buffer binding %d, buffer offset %d has unsupported type %d",
@@ -2935,7 +3004,8 @@ void QRhiGles2::bindShaderResources(QRhiGraphicsPipeline *maybeGraphicsPs, QRhiC
                             texD->samplerState = samplerD->d;
                         }
 
-                        f->glUniform1i(sampler.glslLocation + elem, texUnit);
+                        if (needsUniformUpdate(sampler.glslLocation + elem, 1, &texUnit))
+                            f->glUniform1i(sampler.glslLocation + elem, texUnit);
                         ++texUnit;
                     }
                 }
@@ -4238,6 +4308,7 @@ bool QGles2GraphicsPipeline::create()
     drawMode = toGlTopology(m_topology);
 
     program = rhiD->f->glCreateProgram();
+    memset(uniformState, 0, sizeof(uniformState));
 
     QByteArray diskCacheKey;
     QRhiGles2::DiskCacheResult diskCacheResult = rhiD->tryLoadFromDiskCache(m_shaderStages.constData(),
@@ -4333,6 +4404,7 @@ bool QGles2ComputePipeline::create()
         return false;
 
     program = rhiD->f->glCreateProgram();
+    memset(uniformState, 0, sizeof(uniformState));
     QShaderDescription csDesc;
 
     QByteArray diskCacheKey;
@@ -269,6 +269,17 @@ Q_DECLARE_TYPEINFO(QGles2SamplerDescription, Q_MOVABLE_TYPE);
 using QGles2UniformDescriptionVector = QVarLengthArray<QGles2UniformDescription, 8>;
 using QGles2SamplerDescriptionVector = QVarLengthArray<QGles2SamplerDescription, 4>;
 
+// The last value set via glUniform* for a non-array uniform of up to 4
+// components, used to skip redundant uniform updates for a program.
+struct QGles2UniformState
+{
+    static const int MAX_TRACKED_LOCATION = 1023;
+    int componentCount;
+    quint32 v[4];
+};
+
+Q_DECLARE_TYPEINFO(QGles2UniformState, Q_PRIMITIVE_TYPE);
+
 struct QGles2GraphicsPipeline : public QRhiGraphicsPipeline
 {
     QGles2GraphicsPipeline(QRhiImplementation *rhi);
@@ -280,6 +291,7 @@ struct QGles2GraphicsPipeline : public QRhiGraphicsPipeline
     GLenum drawMode = GL_TRIANGLES;
     QGles2UniformDescriptionVector uniforms;
     QGles2SamplerDescriptionVector samplers;
+    QGles2UniformState uniformState[QGles2UniformState::MAX_TRACKED_LOCATION + 1];
     uint generation = 0;
     friend class QRhiGles2;
 };
@@ -294,6 +306,7 @@ struct QGles2ComputePipeline : public QRhiComputePipeline
     GLuint program = 0;
     QGles2UniformDescriptionVector uniforms;
     QGles2SamplerDescriptionVector samplers;
+    QGles2UniformState uniformState[QGles2UniformState::MAX_TRACKED_LOCATION + 1];
     uint generation = 0;
     friend class QRhiGles2;
 };
@@ -453,6 +466,7 @@ struct QGles2CommandBuffer : public QRhiCommandBuffer
                 GLenum glformat;
                 GLenum gltype;
                 int rowStartAlign;
+                int rowLength;
                 const void *data; // must come from retainImage()
             } subImage;
             struct {
@@ -783,6 +797,8 @@ public:
     bool makeThreadLocalNativeContextCurrent() override;
     void releaseCachedResources() override;
     bool isDeviceLost() const override;
+    QByteArray pipelineCacheData() override;
+    void setPipelineCacheData(const QByteArray &data) override;
 
     bool ensureContext(QSurface *surface = nullptr) const;
     void executeDeferredReleases();
@@ -870,7 +886,8 @@ public:
               nonBaseLevelFramebufferTexture(false),
               texelFetch(false),
               uintAttributes(true),
-              screenSpaceDerivatives(false)
+              screenSpaceDerivatives(false),
+              unpackRowLength(false)
         { }
         int ctxMajor;
         int ctxMinor;
@@ -907,6 +924,7 @@ public:
         uint texelFetch : 1;
         uint uintAttributes : 1;
         uint screenSpaceDerivatives : 1;
+        uint unpackRowLength : 1;
     } caps;
     QGles2SwapChain *currentSwapChain = nullptr;
     QList<GLint> supportedCompressedFormats;
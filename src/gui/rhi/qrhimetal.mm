@@ -568,6 +568,8 @@ bool QRhiMetal::isFeatureSupported(QRhi::Feature feature) const
         return true;
     case QRhi::ReadBackAnyTextureFormat:
         return true;
+    case QRhi::SwapChainDamageRegion:
+        return false;
     default:
         Q_UNREACHABLE();
         return false;
@@ -622,6 +624,16 @@ bool QRhiMetal::isDeviceLost() const
     return false;
 }
 
+QByteArray QRhiMetal::pipelineCacheData()
+{
+    return QByteArray();
+}
+
+void QRhiMetal::setPipelineCacheData(const QByteArray &data)
+{
+    Q_UNUSED(data);
+}
+
 QRhiRenderBuffer *QRhiMetal::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                 int sampleCount, QRhiRenderBuffer::Flags flags,
                                                 QRhiTexture::Format backingFormatHint)
@@ -292,6 +292,8 @@ public:
     bool makeThreadLocalNativeContextCurrent() override;
     void releaseCachedResources() override;
     bool isDeviceLost() const override;
+    QByteArray pipelineCacheData() override;
+    void setPipelineCacheData(const QByteArray &data) override;
 
     void simulateTextureUpload(const QRhiResourceUpdateBatchPrivate::TextureOp &u);
     void simulateTextureCopy(const QRhiResourceUpdateBatchPrivate::TextureOp &u);
@@ -37,6 +37,7 @@
 #include "qrhiprofiler_p_p.h"
 #include "qrhi_p_p.h"
 #include <QtCore/qiodevice.h>
+#include <qtgui_tracepoints_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -116,6 +117,13 @@ QT_BEGIN_NAMESPACE
     unspecified string and \c value is a number. If \c key starts with \c F, it
     indicates the value is a float. Otherwise assume that the value is a
     qint64.
+
+    In addition, when Qt is built with tracing support, the timings of each
+    individual frame and the memory allocator statistics are also reported via
+    the \c QRhiProfiler_frameTime, \c QRhiProfiler_gpuFrameTime, and \c
+    QRhiProfiler_vmemStat tracepoints. Unlike the stream entries, which are
+    aggregated over frameTimingWriteInterval() frames, these make single frame
+    hitches visible in system-level tracing tools.
  */
 
 /*!
@@ -524,7 +532,11 @@ void QRhiProfilerPrivate::endSwapChainFrame(QRhiSwapChain *sc, int frameCount)
         return;
     }
 
-    scd.frameToFrameSamples.append(scd.frameToFrameTimer.restart());
+    const qint64 frameToFrameTime = scd.frameToFrameTimer.restart();
+    const qint64 beginToEndTime = scd.beginToEndTimer.elapsed();
+    Q_TRACE(QRhiProfiler_frameTime, sc, frameToFrameTime, beginToEndTime);
+
+    scd.frameToFrameSamples.append(frameToFrameTime);
     if (scd.frameToFrameSamples.count() >= frameTimingWriteInterval) {
         calcTiming(&scd.frameToFrameSamples,
                    &scd.frameToFrameTime.minTime, &scd.frameToFrameTime.maxTime, &scd.frameToFrameTime.avgTime);
@@ -538,7 +550,7 @@ void QRhiProfilerPrivate::endSwapChainFrame(QRhiSwapChain *sc, int frameCount)
         }
     }
 
-    scd.beginToEndSamples.append(scd.beginToEndTimer.elapsed());
+    scd.beginToEndSamples.append(beginToEndTime);
     if (scd.beginToEndSamples.count() >= frameTimingWriteInterval) {
         calcTiming(&scd.beginToEndSamples,
                    &scd.beginToEndFrameTime.minTime, &scd.beginToEndFrameTime.maxTime, &scd.beginToEndFrameTime.avgTime);
@@ -555,6 +567,8 @@ void QRhiProfilerPrivate::endSwapChainFrame(QRhiSwapChain *sc, int frameCount)
 
 void QRhiProfilerPrivate::swapChainFrameGpuTime(QRhiSwapChain *sc, float gpuTime)
 {
+    Q_TRACE(QRhiProfiler_gpuFrameTime, sc, gpuTime);
+
     Sc &scd(swapchains[sc]);
     scd.gpuFrameSamples.append(gpuTime);
     if (scd.gpuFrameSamples.count() >= frameTimingWriteInterval) {
@@ -591,8 +605,10 @@ void QRhiProfilerPrivate::releaseReadbackBuffer(qint64 id)
     endEntry();
 }
 
-void QRhiProfilerPrivate::vmemStat(uint realAllocCount, uint subAllocCount, quint32 totalSize, quint32 unusedSize)
+void QRhiProfilerPrivate::vmemStat(uint realAllocCount, uint subAllocCount, quint64 totalSize, quint64 unusedSize)
 {
+    Q_TRACE(QRhiProfiler_vmemStat, realAllocCount, subAllocCount, totalSize, unusedSize);
+
     if (!outputDevice)
         return;
 
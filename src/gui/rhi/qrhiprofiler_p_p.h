@@ -82,7 +82,7 @@ public:
     void newReadbackBuffer(qint64 id, QRhiResource *src, quint32 size);
     void releaseReadbackBuffer(qint64 id);
 
-    void vmemStat(uint realAllocCount, uint subAllocCount, quint32 totalSize, quint32 unusedSize);
+    void vmemStat(uint realAllocCount, uint subAllocCount, quint64 totalSize, quint64 unusedSize);
 
     void startEntry(QRhiProfiler::StreamOp op, qint64 timestamp, QRhiResource *res);
     void writeInt(const char *key, qint64 v);
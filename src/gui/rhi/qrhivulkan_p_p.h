@@ -533,12 +533,12 @@ struct QVkCommandBuffer : public QRhiCommandBuffer
             } executeSecondary;
         } args;
     };
-    QList<Command> commands;
+    QRhiBackendCommandList<Command> commands;
     QVarLengthArray<QRhiPassResourceTracker, 8> passResTrackers;
     int currentPassResTrackerIndex;
 
     void resetCommands() {
-        commands.clear();
+        commands.reset();
         resetPools();
 
         passResTrackers.clear();
@@ -743,6 +743,8 @@ public:
     bool makeThreadLocalNativeContextCurrent() override;
     void releaseCachedResources() override;
     bool isDeviceLost() const override;
+    QByteArray pipelineCacheData() override;
+    void setPipelineCacheData(const QByteArray &data) override;
 
     VkResult createDescriptorPool(VkDescriptorPool *pool);
     bool allocateDescriptorSet(VkDescriptorSetAllocateInfo *allocInfo, VkDescriptorSet *result, int *resultPoolIndex);
@@ -767,7 +769,7 @@ public:
                                    bool preserveDs,
                                    QRhiRenderBuffer *depthStencilBuffer,
                                    QRhiTexture *depthTexture);
-    bool ensurePipelineCache();
+    bool ensurePipelineCache(const void *initialData = nullptr, size_t initialDataSize = 0);
     VkShaderModule createShader(const QByteArray &spirv);
 
     void prepareNewFrame(QRhiCommandBuffer *cb);
@@ -841,6 +843,7 @@ public:
 
     bool debugMarkersAvailable = false;
     bool vertexAttribDivisorAvailable = false;
+    bool incrementalPresentAvailable = false;
     PFN_vkCmdDebugMarkerBeginEXT vkCmdDebugMarkerBegin = nullptr;
     PFN_vkCmdDebugMarkerEndEXT vkCmdDebugMarkerEnd = nullptr;
     PFN_vkCmdDebugMarkerInsertEXT vkCmdDebugMarkerInsert = nullptr;
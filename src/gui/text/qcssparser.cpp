@@ -1917,6 +1917,11 @@ void StyleSheet::buildIndexes(Qt::CaseSensitivity nameCaseSensitivity)
             }
 
             const BasicSelector &sel = selector.basicSelectors.at(selector.basicSelectors.count() - 1);
+            const auto classSelector = std::find_if(sel.attributeSelectors.cbegin(), sel.attributeSelectors.cend(),
+                                                    [](const AttributeSelector &a) {
+                return a.valueMatchCriterium == AttributeSelector::MatchIncludes
+                        && a.name == QLatin1String("class");
+            });
 
             if (!sel.ids.isEmpty()) {
                 StyleRule nr;
@@ -1933,6 +1938,12 @@ void StyleSheet::buildIndexes(Qt::CaseSensitivity nameCaseSensitivity)
                 if (nameCaseSensitivity == Qt::CaseInsensitive)
                     name = std::move(name).toLower();
                 nameIndex.insert(name, nr);
+            } else if (classSelector != sel.attributeSelectors.cend()) {
+                StyleRule nr;
+                nr.selectors += selector;
+                nr.declarations = rule.declarations;
+                nr.order = i;
+                classIndex.insert(classSelector->value, nr);
             } else {
                 universalsSelectors += selector;
             }
@@ -2144,6 +2155,20 @@ QList<StyleRule> StyleSelector::styleRulesForNode(NodePtr node)
                 }
             }
         }
+        if (!styleSheet.classIndex.isEmpty()) {
+            const QString classes = attribute(node, QLatin1String("class"));
+            const auto classNames = QStringView{classes}.split(u' ', Qt::SkipEmptyParts);
+            for (int i = 0; i < classNames.count(); i++) {
+                const QString className = classNames.at(i).toString();
+                if (classNames.indexOf(classNames.at(i)) != i)
+                    continue; // each rule must be matched only once
+                QMultiHash<QString, StyleRule>::const_iterator it = styleSheet.classIndex.constFind(className);
+                while (it != styleSheet.classIndex.constEnd() && it.key() == className) {
+                    matchRule(node, it.value(), styleSheet.origin, styleSheet.depth, &weightedRules);
+                    ++it;
+                }
+            }
+        }
         if (!medium.isEmpty()) {
             for (int i = 0; i < styleSheet.mediaRules.count(); ++i) {
                 if (styleSheet.mediaRules.at(i).media.contains(medium, Qt::CaseInsensitive)) {
@@ -644,6 +644,7 @@ struct StyleSheet
     int depth; // applicable only for inline style sheets
     QMultiHash<QString, StyleRule> nameIndex;
     QMultiHash<QString, StyleRule> idIndex;
+    QMultiHash<QString, StyleRule> classIndex;
 
     Q_GUI_EXPORT void buildIndexes(Qt::CaseSensitivity nameCaseSensitivity = Qt::CaseSensitive);
 };
@@ -725,6 +725,7 @@ static void initializeDb()
 
     // init by asking for the platformfontdb for the first time or after invalidation
     if (!db->count) {
+        Q_TRACE_SCOPE(QFontDatabase_initializeDb);
         QGuiApplicationPrivate::platformIntegration()->fontDatabase()->populateFontDatabase();
         for (int i = 0; i < db->applicationFonts.count(); i++) {
             if (!db->applicationFonts.at(i).properties.isEmpty())
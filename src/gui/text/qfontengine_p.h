@@ -334,6 +334,7 @@ public:
 
     mutable Holder font_; // \ NOTE: Declared before m_glyphCaches, so font_, face_
     mutable Holder face_; // / are destroyed _after_ m_glyphCaches is destroyed.
+    mutable Holder shapingCache_; // shaped runs, see QTextEngine::shapeTextWithHarfbuzzNG()
 
     struct FaceData {
         void *user_data;
@@ -201,7 +201,7 @@ QList<int> QFontSubset::getReverseMap() const
 {
     QList<int> reverseMap(0x10000, 0);
     for (uint uc = 0; uc < 0x10000; ++uc) {
-        int idx = glyph_indices.indexOf(fontEngine->glyphIndex(uc));
+        int idx = glyph_index_map.value(fontEngine->glyphIndex(uc), -1);
         if (idx >= 0 && !reverseMap.at(idx))
             reverseMap[idx] = uc;
     }
@@ -302,11 +302,13 @@ QByteArray QFontSubset::createToUnicodeMap() const
 
 int QFontSubset::addGlyph(int index)
 {
-    int idx = glyph_indices.indexOf(index);
-    if (idx < 0) {
-        idx = glyph_indices.size();
-        glyph_indices.append(index);
-    }
+    auto it = glyph_index_map.constFind(index);
+    if (it != glyph_index_map.constEnd())
+        return it.value();
+
+    const int idx = glyph_indices.size();
+    glyph_indices.append(index);
+    glyph_index_map.insert(index, idx);
     return idx;
 }
 
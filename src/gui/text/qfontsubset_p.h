@@ -87,6 +87,7 @@ public:
     bool noEmbed;
     QFontEngine *fontEngine;
     QList<int> glyph_indices;
+    QHash<int, int> glyph_index_map; // glyph index -> position in glyph_indices
     mutable int downloaded_glyphs;
     mutable bool standard_font;
     int nGlyphs() const { return glyph_indices.size(); }
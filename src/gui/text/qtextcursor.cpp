@@ -1456,8 +1456,8 @@ void QTextCursor::insertText(const QString &text, const QTextCharFormat &_format
         int formatIdx = formats->indexForFormat(format);
         Q_ASSERT(formats->format(formatIdx).isCharFormat());
 
-        QTextBlockFormat blockFmt = blockFormat();
-
+        const int blockFormatIdx = formats->indexForFormat(blockFormat());
+        Q_ASSERT(formats->format(blockFormatIdx).isBlockFormat());
 
         int textStart = d->priv->text.length();
         int blockStart = 0;
@@ -1490,7 +1490,11 @@ void QTextCursor::insertText(const QString &text, const QTextCharFormat &_format
                 if (blockEnd > blockStart)
                     d->priv->insert(d->position, textStart + blockStart, blockEnd - blockStart, formatIdx);
 
-                d->insertBlock(blockFmt, format);
+                // Turn the line break that was appended along with the text into
+                // the block separator, instead of appending one per block.
+                d->priv->text[textStart + i] = QChar::ParagraphSeparator;
+                d->priv->insertBlockAt(d->position, textStart + i, blockFormatIdx, formatIdx);
+                d->currentCharFormat = -1;
                 blockStart = i + 1;
             }
         }
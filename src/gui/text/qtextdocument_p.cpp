@@ -402,10 +402,28 @@ int QTextDocumentPrivate::insertBlock(QChar blockSeparator,
     Q_ASSERT(pos >= 0 && (pos < fragments.length() || (pos == 0 && fragments.length() == 0)));
     Q_ASSERT(isValidBlockSeparator(blockSeparator));
 
-    beginEditBlock();
-
-    int strPos = text.length();
+    const int strPos = text.length();
     text.append(blockSeparator);
+    return insertBlockAt(pos, strPos, blockFormat, charFormat, op);
+}
+
+/*!
+    \internal
+
+    Inserts a block at \a pos whose separator is already stored at \a strPos
+    in the text buffer, so that bulk insertions can reuse the separators of
+    the inserted text instead of appending new ones.
+*/
+int QTextDocumentPrivate::insertBlockAt(int pos, int strPos, int blockFormat, int charFormat,
+                                        QTextUndoCommand::Operation op)
+{
+    Q_ASSERT(formats.format(blockFormat).isBlockFormat());
+    Q_ASSERT(formats.format(charFormat).isCharFormat());
+    Q_ASSERT(pos >= 0 && (pos < fragments.length() || (pos == 0 && fragments.length() == 0)));
+    Q_ASSERT(strPos >= 0 && strPos < text.length());
+    Q_ASSERT(isValidBlockSeparator(text.at(strPos)));
+
+    beginEditBlock();
 
     int ob = blocks.findNode(pos);
     bool atBlockEnd = true;
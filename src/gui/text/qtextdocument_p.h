@@ -181,6 +181,8 @@ public:
     int insertBlock(int pos, int blockFormat, int charFormat, QTextUndoCommand::Operation = QTextUndoCommand::MoveCursor);
     int insertBlock(QChar blockSeparator, int pos, int blockFormat, int charFormat,
                      QTextUndoCommand::Operation op = QTextUndoCommand::MoveCursor);
+    int insertBlockAt(int pos, int strPos, int blockFormat, int charFormat,
+                      QTextUndoCommand::Operation op = QTextUndoCommand::MoveCursor);
 
     void move(int from, int to, int length, QTextUndoCommand::Operation = QTextUndoCommand::MoveCursor);
     void remove(int pos, int length, QTextUndoCommand::Operation = QTextUndoCommand::MoveCursor);
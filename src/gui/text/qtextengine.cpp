@@ -1601,9 +1601,68 @@ void QTextEngine::shapeText(int item) const
 QT_BEGIN_INCLUDE_NAMESPACE
 
 #include "qharfbuzzng_p.h"
+#include <QtCore/qcache.h>
 
 QT_END_INCLUDE_NAMESPACE
 
+namespace {
+// Shaping results are cached per font engine, keyed on the text of the run
+// and everything else that is passed to HarfBuzz, so that re-laying out the
+// same text (e.g. on resize, or repeated labels and list items) does not
+// shape it again.
+struct ShapingCacheKey
+{
+    QString text;
+    uint script : 16;
+    uint rtl : 1;
+    uint kerning : 1;
+    uint dontLigate : 1;
+    uint designMetrics : 1;
+
+    bool operator==(const ShapingCacheKey &other) const noexcept
+    {
+        return script == other.script && rtl == other.rtl && kerning == other.kerning
+                && dontLigate == other.dontLigate && designMetrics == other.designMetrics
+                && text == other.text;
+    }
+};
+
+size_t qHash(const ShapingCacheKey &key, size_t seed = 0) noexcept
+{
+    const uint flags = key.script | (key.rtl << 16) | (key.kerning << 17)
+            | (key.dontLigate << 18) | (key.designMetrics << 19);
+    return qHashMulti(seed, key.text, flags);
+}
+
+struct ShapedGlyph
+{
+    uint glyph;
+    uint cluster;
+    hb_position_t xAdvance;
+    hb_position_t xOffset;
+    hb_position_t yOffset;
+};
+
+using ShapedRun = QList<ShapedGlyph>;
+using ShapingCache = QCache<ShapingCacheKey, ShapedRun>;
+
+enum {
+    MaxCachedRunLength = 256,
+    ShapingCacheSize = 16384 // in glyphs, per font engine
+};
+
+ShapingCache *shapingCacheForEngine(QFontEngine *fontEngine)
+{
+    if (!fontEngine->shapingCache_) {
+        fontEngine->shapingCache_ = QFontEngine::Holder(new ShapingCache(ShapingCacheSize),
+                                                        [](void *cache) {
+            delete static_cast<ShapingCache *>(cache);
+        });
+    }
+    return static_cast<ShapingCache *>(fontEngine->shapingCache_.get());
+}
+} // unnamed namespace
+
 int QTextEngine::shapeTextWithHarfbuzzNG(const QScriptItem &si,
                                          const ushort *string,
                                          int itemLength,
@@ -1637,61 +1696,89 @@ int QTextEngine::shapeTextWithHarfbuzzNG(const QScriptItem &si,
         QFontEngine *actualFontEngine = fontEngine->type() != QFontEngine::Multi ? fontEngine
                                                                                  : static_cast<QFontEngineMulti *>(fontEngine)->engine(engineIdx);
 
+        // Ligatures are incompatible with custom letter spacing, so when a letter spacing is set,
+        // we disable them for writing systems where they are purely cosmetic.
+        bool scriptRequiresOpenType = ((script >= QChar::Script_Syriac && script <= QChar::Script_Sinhala)
+                                     || script == QChar::Script_Khmer || script == QChar::Script_Nko);
+
+        bool dontLigate = hasLetterSpacing && !scriptRequiresOpenType;
+
+        ShapingCache *cache = nullptr;
+        ShapingCacheKey key;
+        ShapedRun shapedRun;
+        if (item_length <= MaxCachedRunLength) {
+            cache = shapingCacheForEngine(actualFontEngine);
+            key.text = QString(reinterpret_cast<const QChar *>(string) + item_pos, item_length);
+            key.script = script;
+            key.rtl = HB_DIRECTION_IS_BACKWARD(props.direction);
+            key.kerning = kerningEnabled;
+            key.dontLigate = dontLigate;
+            key.designMetrics = option.useDesignMetrics();
+            if (const ShapedRun *cached = cache->object(key))
+                shapedRun = *cached;
+        }
+
+        if (shapedRun.isEmpty()) {
+            // prepare buffer
+            hb_buffer_clear_contents(buffer);
+            hb_buffer_add_utf16(buffer, reinterpret_cast<const uint16_t *>(string) + item_pos, item_length, 0, item_length);
+
+            hb_buffer_set_segment_properties(buffer, &props);
+
+            uint buffer_flags = HB_BUFFER_FLAG_DEFAULT;
+            // Symbol encoding used to encode various crap in the 32..255 character code range,
+            // and thus might override U+00AD [SHY]; avoid hiding default ignorables
+            if (Q_UNLIKELY(actualFontEngine->symbol))
+                buffer_flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
+            hb_buffer_set_flags(buffer, hb_buffer_flags_t(buffer_flags));
+
+
+            // shape
+            {
+                hb_font_t *hb_font = hb_qt_font_get_for_engine(actualFontEngine);
+                Q_ASSERT(hb_font);
+                hb_qt_font_set_use_design_metrics(hb_font, option.useDesignMetrics() ? uint(QFontEngine::DesignMetrics) : 0); // ###
+
+                const hb_feature_t features[5] = {
+                    { HB_TAG('k','e','r','n'), !!kerningEnabled, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
+                    { HB_TAG('l','i','g','a'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
+                    { HB_TAG('c','l','i','g'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
+                    { HB_TAG('d','l','i','g'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
+                    { HB_TAG('h','l','i','g'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END }
+                };
+                const int num_features = dontLigate ? 5 : 1;
+
+                // whitelist cross-platforms shapers only
+                static const char *shaper_list[] = {
+                    "graphite2",
+                    "ot",
+                    "fallback",
+                    nullptr
+                };
+
+                bool shapedOk = hb_shape_full(hb_font, buffer, features, num_features, shaper_list);
+                if (Q_UNLIKELY(!shapedOk)) {
+                    hb_buffer_destroy(buffer);
+                    return 0;
+                }
 
-        // prepare buffer
-        hb_buffer_clear_contents(buffer);
-        hb_buffer_add_utf16(buffer, reinterpret_cast<const uint16_t *>(string) + item_pos, item_length, 0, item_length);
-
-        hb_buffer_set_segment_properties(buffer, &props);
-
-        uint buffer_flags = HB_BUFFER_FLAG_DEFAULT;
-        // Symbol encoding used to encode various crap in the 32..255 character code range,
-        // and thus might override U+00AD [SHY]; avoid hiding default ignorables
-        if (Q_UNLIKELY(actualFontEngine->symbol))
-            buffer_flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
-        hb_buffer_set_flags(buffer, hb_buffer_flags_t(buffer_flags));
-
-
-        // shape
-        {
-            hb_font_t *hb_font = hb_qt_font_get_for_engine(actualFontEngine);
-            Q_ASSERT(hb_font);
-            hb_qt_font_set_use_design_metrics(hb_font, option.useDesignMetrics() ? uint(QFontEngine::DesignMetrics) : 0); // ###
-
-            // Ligatures are incompatible with custom letter spacing, so when a letter spacing is set,
-            // we disable them for writing systems where they are purely cosmetic.
-            bool scriptRequiresOpenType = ((script >= QChar::Script_Syriac && script <= QChar::Script_Sinhala)
-                                         || script == QChar::Script_Khmer || script == QChar::Script_Nko);
-
-            bool dontLigate = hasLetterSpacing && !scriptRequiresOpenType;
-            const hb_feature_t features[5] = {
-                { HB_TAG('k','e','r','n'), !!kerningEnabled, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
-                { HB_TAG('l','i','g','a'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
-                { HB_TAG('c','l','i','g'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
-                { HB_TAG('d','l','i','g'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
-                { HB_TAG('h','l','i','g'), false, HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END }
-            };
-            const int num_features = dontLigate ? 5 : 1;
-
-            // whitelist cross-platforms shapers only
-            static const char *shaper_list[] = {
-                "graphite2",
-                "ot",
-                "fallback",
-                nullptr
-            };
-
-            bool shapedOk = hb_shape_full(hb_font, buffer, features, num_features, shaper_list);
-            if (Q_UNLIKELY(!shapedOk)) {
-                hb_buffer_destroy(buffer);
-                return 0;
+                if (Q_UNLIKELY(HB_DIRECTION_IS_BACKWARD(props.direction)))
+                    hb_buffer_reverse(buffer);
             }
 
-            if (Q_UNLIKELY(HB_DIRECTION_IS_BACKWARD(props.direction)))
-                hb_buffer_reverse(buffer);
+            const uint num_glyphs = hb_buffer_get_length(buffer);
+            const hb_glyph_info_t *infos = hb_buffer_get_glyph_infos(buffer, nullptr);
+            const hb_glyph_position_t *positions = hb_buffer_get_glyph_positions(buffer, nullptr);
+            shapedRun.resize(num_glyphs);
+            for (uint i = 0; i < num_glyphs; ++i) {
+                shapedRun[i] = { infos[i].codepoint, infos[i].cluster, positions[i].x_advance,
+                                 positions[i].x_offset, positions[i].y_offset };
+            }
+            if (cache && num_glyphs > 0)
+                cache->insert(key, new ShapedRun(shapedRun), num_glyphs);
         }
 
-        const uint num_glyphs = hb_buffer_get_length(buffer);
+        const uint num_glyphs = shapedRun.size();
         // ensure we have enough space for shaped glyphs and metrics
         if (Q_UNLIKELY(num_glyphs == 0 || !ensureSpace(glyphs_shaped + num_glyphs))) {
             hb_buffer_destroy(buffer);
@@ -1702,19 +1789,18 @@ int QTextEngine::shapeTextWithHarfbuzzNG(const QScriptItem &si,
         QGlyphLayout g = availableGlyphs(&si).mid(glyphs_shaped, num_glyphs);
         ushort *log_clusters = logClusters(&si) + item_pos;
 
-        hb_glyph_info_t *infos = hb_buffer_get_glyph_infos(buffer, nullptr);
-        hb_glyph_position_t *positions = hb_buffer_get_glyph_positions(buffer, nullptr);
         uint str_pos = 0;
         uint last_cluster = ~0u;
         uint last_glyph_pos = glyphs_shaped;
-        for (uint i = 0; i < num_glyphs; ++i, ++infos, ++positions) {
-            g.glyphs[i] = infos->codepoint;
+        for (uint i = 0; i < num_glyphs; ++i) {
+            const ShapedGlyph &shaped = shapedRun.at(i);
+            g.glyphs[i] = shaped.glyph;
 
-            g.advances[i] = QFixed::fromFixed(positions->x_advance);
-            g.offsets[i].x = QFixed::fromFixed(positions->x_offset);
-            g.offsets[i].y = QFixed::fromFixed(positions->y_offset);
+            g.advances[i] = QFixed::fromFixed(shaped.xAdvance);
+            g.offsets[i].x = QFixed::fromFixed(shaped.xOffset);
+            g.offsets[i].y = QFixed::fromFixed(shaped.yOffset);
 
-            uint cluster = infos->cluster;
+            uint cluster = shaped.cluster;
             if (Q_LIKELY(last_cluster != cluster)) {
                 g.attributes[i].clusterStart = true;
 
@@ -396,7 +396,11 @@ static inline bool requiresOpenType(int writingSystem)
             || writingSystem == QFontDatabase::Khmer || writingSystem == QFontDatabase::Nko);
 }
 
-static void populateFromPattern(FcPattern *pattern, QFontDatabasePrivate::ApplicationFont *applicationFont = nullptr)
+// When requestedFamily is set, only the fonts registered under that family
+// name are registered, so that populating one family lazily does not mark
+// the other families of the pattern as populated with a subset of their styles.
+static void populateFromPattern(FcPattern *pattern, QFontDatabasePrivate::ApplicationFont *applicationFont = nullptr,
+                                const QString &requestedFamily = QString())
 {
     QString familyName;
     QString familyNameLang;
@@ -518,7 +522,14 @@ static void populateFromPattern(FcPattern *pattern, QFontDatabasePrivate::Applic
         applicationFont->properties.append(properties);
     }
 
-    QPlatformFontDatabase::registerFont(familyName,styleName,QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,fontFile);
+    const auto isRequested = [&requestedFamily](const QString &name) {
+        return requestedFamily.isEmpty() || name.compare(requestedFamily, Qt::CaseInsensitive) == 0;
+    };
+
+    if (isRequested(familyName))
+        QPlatformFontDatabase::registerFont(familyName,styleName,QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,fontFile);
+    else
+        delete fontFile;
 //        qDebug() << familyName << (const char *)foundry_value << weight << style << &writingSystems << scalable << true << pixel_size;
 
     for (int k = 1; FcPatternGetString(pattern, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
@@ -539,6 +550,8 @@ static void populateFromPattern(FcPattern *pattern, QFontDatabasePrivate::Applic
             altFamilyNameLang = familyNameLang;
 
         if (familyNameLang == altFamilyNameLang && altStyleName != styleName) {
+            if (!isRequested(altFamilyName))
+                continue;
             if (applicationFont != nullptr) {
                 QFontDatabasePrivate::ApplicationFont::Properties properties;
                 properties.familyName = altFamilyName;
@@ -549,45 +562,99 @@ static void populateFromPattern(FcPattern *pattern, QFontDatabasePrivate::Applic
 
                 applicationFont->properties.append(properties);
             }
-            FontFile *altFontFile = new FontFile(*fontFile);
+            FontFile *altFontFile = new FontFile;
+            altFontFile->fileName = QString::fromLocal8Bit((const char *)file_value);
+            altFontFile->indexValue = indexValue;
             QPlatformFontDatabase::registerFont(altFamilyName, altStyleName, QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,altFontFile);
-        } else {
+        } else if (requestedFamily.isEmpty()) {
             QPlatformFontDatabase::registerAliasToFontFamily(familyName, altFamilyName);
         }
     }
 
 }
 
-void QFontconfigDatabase::populateFontDatabase()
+// Registers the family names of a pattern listed with only the family and
+// style objects, mirroring the registrations done by populateFromPattern().
+static void registerFamiliesFromPattern(FcPattern *pattern)
 {
-    FcInit();
-    FcFontSet  *fonts;
-
-    {
-        FcObjectSet *os = FcObjectSetCreate();
-        FcPattern *pattern = FcPatternCreate();
-        const char *properties [] = {
-            FC_FAMILY, FC_STYLE, FC_WEIGHT, FC_SLANT,
-            FC_SPACING, FC_FILE, FC_INDEX,
-            FC_LANG, FC_CHARSET, FC_FOUNDRY, FC_SCALABLE, FC_PIXEL_SIZE,
-            FC_WIDTH, FC_FAMILYLANG,
+    FcChar8 *value = nullptr;
+    if (FcPatternGetString(pattern, FC_FAMILY, 0, &value) != FcResultMatch)
+        return;
+    const QString familyName = QString::fromUtf8((const char *)value);
+    QPlatformFontDatabase::registerFontFamily(familyName);
+
+    QString styleName;
+    if (FcPatternGetString(pattern, FC_STYLE, 0, &value) == FcResultMatch)
+        styleName = QString::fromUtf8((const char *)value);
+    QString familyNameLang;
+    if (FcPatternGetString(pattern, FC_FAMILYLANG, 0, &value) == FcResultMatch)
+        familyNameLang = QString::fromUtf8((const char *)value);
+
+    for (int k = 1; FcPatternGetString(pattern, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
+        const QString altFamilyName = QString::fromUtf8((const char *)value);
+        QString altStyleName = styleName;
+        if (FcPatternGetString(pattern, FC_STYLE, k, &value) == FcResultMatch)
+            altStyleName = QString::fromUtf8((const char *)value);
+        QString altFamilyNameLang = familyNameLang;
+        if (FcPatternGetString(pattern, FC_FAMILYLANG, k, &value) == FcResultMatch)
+            altFamilyNameLang = QString::fromUtf8((const char *)value);
+
+        if (familyNameLang == altFamilyNameLang && altStyleName != styleName)
+            QPlatformFontDatabase::registerFontFamily(altFamilyName);
+        else
+            QPlatformFontDatabase::registerAliasToFontFamily(familyName, altFamilyName);
+    }
+}
+
+static FcFontSet *listFonts(FcPattern *pattern, bool familiesOnly)
+{
+    FcObjectSet *os = FcObjectSetCreate();
+    const char *properties [] = {
+        FC_FAMILY, FC_STYLE, FC_FAMILYLANG,
+        FC_WEIGHT, FC_SLANT,
+        FC_SPACING, FC_FILE, FC_INDEX,
+        FC_LANG, FC_CHARSET, FC_FOUNDRY, FC_SCALABLE, FC_PIXEL_SIZE,
+        FC_WIDTH,
 #if FC_VERSION >= 20297
-            FC_CAPABILITY,
+        FC_CAPABILITY,
 #endif
-            (const char *)nullptr
-        };
-        const char **p = properties;
-        while (*p) {
-            FcObjectSetAdd(os, *p);
-            ++p;
-        }
-        fonts = FcFontList(nullptr, pattern, os);
-        FcObjectSetDestroy(os);
-        FcPatternDestroy(pattern);
-    }
+        (const char *)nullptr
+    };
+    const int familyProperties = 3;
+    const char **p = properties;
+    for (int i = 0; *p && (!familiesOnly || i < familyProperties); ++i, ++p)
+        FcObjectSetAdd(os, *p);
+    FcFontSet *fonts = FcFontList(nullptr, pattern, os);
+    FcObjectSetDestroy(os);
+    return fonts;
+}
 
-    for (int i = 0; i < fonts->nfont; i++)
-        populateFromPattern(fonts->fonts[i]);
+// With QT_FONTCONFIG_LAZY_POPULATE set, populateFontDatabase() only
+// registers the family names, and the styles, files and writing systems of
+// a family are listed when the family is first used. Converting the charset
+// and language set of every installed font dominates the start-up cost on
+// systems with many fonts.
+static bool lazyPopulation()
+{
+    static const bool lazy = qEnvironmentVariableIntValue("QT_FONTCONFIG_LAZY_POPULATE") > 0;
+    return lazy;
+}
+
+void QFontconfigDatabase::populateFontDatabase()
+{
+    FcInit();
+
+    const bool lazy = lazyPopulation();
+    FcPattern *pattern = FcPatternCreate();
+    FcFontSet *fonts = listFonts(pattern, lazy);
+    FcPatternDestroy(pattern);
+
+    for (int i = 0; i < fonts->nfont; i++) {
+        if (lazy)
+            registerFamiliesFromPattern(fonts->fonts[i]);
+        else
+            populateFromPattern(fonts->fonts[i]);
+    }
 
     FcFontSetDestroy (fonts);
 
@@ -624,6 +691,20 @@ void QFontconfigDatabase::populateFontDatabase()
 //    QApplication::setFont(font);
 }
 
+void QFontconfigDatabase::populateFamily(const QString &familyName)
+{
+    FcPattern *pattern = FcPatternCreate();
+    const QByteArray family = familyName.toUtf8();
+    FcPatternAddString(pattern, FC_FAMILY, (const FcChar8 *)family.constData());
+    FcFontSet *fonts = listFonts(pattern, false);
+    FcPatternDestroy(pattern);
+
+    for (int i = 0; i < fonts->nfont; i++)
+        populateFromPattern(fonts->fonts[i], nullptr, familyName);
+
+    FcFontSetDestroy(fonts);
+}
+
 void QFontconfigDatabase::invalidate()
 {
     // Clear app fonts.
@@ -62,6 +62,7 @@ class Q_GUI_EXPORT QFontconfigDatabase : public QFreeTypeFontDatabase
 {
 public:
     void populateFontDatabase() override;
+    void populateFamily(const QString &familyName) override;
     void invalidate() override;
     QFontEngineMulti *fontEngineMulti(QFontEngine *fontEngine, QChar::Script script) override;
     QFontEngine *fontEngine(const QFontDef &fontDef, void *handle) override;
@@ -20,6 +20,8 @@ HEADERS += \
     access/qnetworkreplyimpl_p.h \
     access/qnetworkreplydataimpl_p.h \
     access/qnetworkreplyfileimpl_p.h \
+    access/qnetworkreplytimings.h \
+    access/qnetworkreplytimings_p.h \
     access/qabstractnetworkcache_p.h \
     access/qabstractnetworkcache.h \
     access/qnetworkfile_p.h \
@@ -41,6 +43,7 @@ SOURCES += \
     access/qnetworkreplyimpl.cpp \
     access/qnetworkreplydataimpl.cpp \
     access/qnetworkreplyfileimpl.cpp \
+    access/qnetworkreplytimings.cpp \
     access/qabstractnetworkcache.cpp \
     access/qnetworkfile.cpp \
     access/qhsts.cpp \
@@ -99,6 +102,7 @@ qtConfig(http) {
         access/qhttpprotocolhandler.cpp \
         access/qhttpthreaddelegate.cpp \
         access/qnetworkreplyhttpimpl.cpp \
+        access/qhttp1configuration.cpp \
         access/qhttp2configuration.cpp
 
     HEADERS += \
@@ -115,6 +119,7 @@ qtConfig(http) {
         access/qhttpprotocolhandler_p.h \
         access/qhttpthreaddelegate_p.h \
         access/qnetworkreplyhttpimpl_p.h \
+        access/qhttp1configuration.h \
         access/qhttp2configuration.h
 
     qtConfig(brotli) {
@@ -45,6 +45,7 @@
 #include <cstddef>
 #include <cstring>
 #include <limits>
+#include <utility>
 
 
 QT_BEGIN_NAMESPACE
@@ -86,67 +87,14 @@ int compare(const QByteArray &lhs, const QByteArray &rhs)
 
 } // unnamed namespace
 
-FieldLookupTable::SearchEntry::SearchEntry()
-    : field(),
-      chunk(),
-      offset(),
-      table()
-{
-}
-
-FieldLookupTable::SearchEntry::SearchEntry(const HeaderField *f,
-                                           const Chunk *c,
-                                           quint32 o,
-                                           const FieldLookupTable *t)
-    : field(f),
-      chunk(c),
-      offset(o),
-      table(t)
-{
-    Q_ASSERT(field);
-}
-
-bool FieldLookupTable::SearchEntry::operator < (const SearchEntry &rhs)const
-{
-    Q_ASSERT(field);
-    Q_ASSERT(rhs.field);
-
-    int cmp = compare(field->name, rhs.field->name);
-    if (cmp)
-        return cmp < 0;
-
-    cmp = compare(field->value, rhs.field->value);
-    if (cmp)
-        return cmp < 0;
-
-    if (!chunk) // 'this' is not in the searchIndex.
-        return rhs.chunk;
-
-    if (!rhs.chunk) // not in the searchIndex.
-        return false;
-
-    Q_ASSERT(table);
-    Q_ASSERT(rhs.table == table);
-
-    const quint32 leftChunkIndex = table->indexOfChunk(chunk);
-    const quint32 rightChunkIndex = rhs.table->indexOfChunk(rhs.chunk);
-
-    // Later added - smaller is chunk index (since we push_front).
-    if (leftChunkIndex != rightChunkIndex)
-        return leftChunkIndex > rightChunkIndex;
-
-    // Later added - smaller is offset.
-    return offset > rhs.offset;
-}
-
 FieldLookupTable::FieldLookupTable(quint32 maxSize, bool use)
     : maxTableSize(maxSize),
       tableCapacity(maxSize),
-      useIndex(use),
+      head(),
       nDynamic(),
-      begin(),
-      end(),
-      dataSize()
+      dataSize(),
+      nextSequence(),
+      useIndex(use)
 {
 }
 
@@ -165,26 +113,21 @@ bool FieldLookupTable::prependField(const QByteArray &name, const QByteArray &va
     while (nDynamic && tableCapacity - dataSize < entrySize.second)
         evictEntry();
 
-    if (!begin) {
-        // Either no more space or empty table ...
-        chunks.push_front(ChunkPtr(new Chunk(ChunkSize)));
-        end += ChunkSize;
-        begin = ChunkSize;
-    }
-
-    --begin;
+    if (nDynamic == ring.size())
+        growRing();
 
+    head = head ? head - 1 : quint32(ring.size() - 1);
     dataSize += entrySize.second;
     ++nDynamic;
 
-    auto &newField = front();
+    HeaderField &newField = ring[head];
     newField.name = name;
     newField.value = value;
 
+    const quint64 sequence = nextSequence++;
     if (useIndex) {
-        const auto result = searchIndex.insert(frontKey());
-        Q_UNUSED(result);
-        Q_ASSERT(result.second);
+        fieldIndex.insert(newField, sequence);
+        nameIndex.insert(newField.name, sequence);
     }
 
     return true;
@@ -195,30 +138,30 @@ void FieldLookupTable::evictEntry()
     if (!nDynamic)
         return;
 
-    Q_ASSERT(end != begin);
+    HeaderField &field = dynamicEntry(nDynamic - 1);
 
     if (useIndex) {
-        const auto res = searchIndex.erase(backKey());
-        Q_UNUSED(res);
-        Q_ASSERT(res == 1);
+        // The oldest entry; if a key still refers to it, there is no
+        // newer entry with the same key:
+        const quint64 sequence = nextSequence - nDynamic;
+        const auto fieldPos = fieldIndex.find(field);
+        Q_ASSERT(fieldPos != fieldIndex.end());
+        if (fieldPos.value() == sequence)
+            fieldIndex.erase(fieldPos);
+        const auto namePos = nameIndex.find(field.name);
+        Q_ASSERT(namePos != nameIndex.end());
+        if (namePos.value() == sequence)
+            nameIndex.erase(namePos);
     }
 
-    const HeaderField &field = back();
     const auto entrySize = entry_size(field);
     Q_ASSERT(entrySize.first);
     Q_ASSERT(dataSize >= entrySize.second);
     dataSize -= entrySize.second;
 
+    // Release the strings now rather than when the slot is reused:
+    field = HeaderField();
     --nDynamic;
-    --end;
-
-    if (end == begin) {
-        Q_ASSERT(chunks.size() == 1);
-        end = ChunkSize;
-        begin = end;
-    } else if (!(end % ChunkSize)) {
-        chunks.pop_back();
-    }
 }
 
 quint32 FieldLookupTable::numberOfEntries() const
@@ -243,10 +186,10 @@ quint32 FieldLookupTable::dynamicDataSize() const
 
 void FieldLookupTable::clearDynamicTable()
 {
-    searchIndex.clear();
-    chunks.clear();
-    begin = 0;
-    end = 0;
+    fieldIndex.clear();
+    nameIndex.clear();
+    ring.clear();
+    head = 0;
     nDynamic = 0;
     dataSize = 0;
 }
@@ -273,13 +216,9 @@ quint32 FieldLookupTable::indexOf(const QByteArray &name, const QByteArray &valu
         return 0;
     }
 
-    const SearchEntry key(&field, nullptr, 0, this);
-    const auto pos = searchIndex.lower_bound(key);
-    if (pos != searchIndex.end()) {
-        const HeaderField &found = *pos->field;
-        if (found.name == name && found.value == value)
-            return keyToIndex(*pos);
-    }
+    const auto pos = fieldIndex.constFind(field);
+    if (pos != fieldIndex.cend())
+        return sequenceToIndex(pos.value());
 
     return 0;
 }
@@ -301,13 +240,9 @@ quint32 FieldLookupTable::indexOf(const QByteArray &name) const
         return 0;
     }
 
-    const SearchEntry key(&field, nullptr, 0, this);
-    const auto pos = searchIndex.lower_bound(key);
-    if (pos != searchIndex.end()) {
-        const HeaderField &found = *pos->field;
-        if (found.name == name)
-            return keyToIndex(*pos);
-    }
+    const auto pos = nameIndex.constFind(name);
+    if (pos != nameIndex.cend())
+        return sequenceToIndex(pos.value());
 
     return 0;
 }
@@ -327,11 +262,7 @@ bool FieldLookupTable::field(quint32 index, QByteArray *name, QByteArray *value)
         return true;
     }
 
-    index = index - 1 - quint32(table.size()) + begin;
-    const auto chunkIndex = index / ChunkSize;
-    Q_ASSERT(chunkIndex < chunks.size());
-    const auto offset = index % ChunkSize;
-    const HeaderField &found = (*chunks[chunkIndex])[offset];
+    const HeaderField &found = dynamicEntry(index - 1 - quint32(table.size()));
     *name = found.name;
     *value = found.value;
 
@@ -341,79 +272,65 @@ bool FieldLookupTable::field(quint32 index, QByteArray *name, QByteArray *value)
 bool FieldLookupTable::fieldName(quint32 index, QByteArray *dst) const
 {
     Q_ASSERT(dst);
-    return field(index, dst, &dummyDst);
+
+    if (!indexIsValid(index))
+        return false;
+
+    const auto &table = staticPart();
+    if (index - 1 < table.size())
+        *dst = table[index - 1].name;
+    else
+        *dst = dynamicEntry(index - 1 - quint32(table.size())).name;
+
+    return true;
 }
 
 bool FieldLookupTable::fieldValue(quint32 index, QByteArray *dst) const
 {
     Q_ASSERT(dst);
-    return field(index, &dummyDst, dst);
-}
 
-const HeaderField &FieldLookupTable::front() const
-{
-    Q_ASSERT(nDynamic && begin != end && chunks.size());
-    return (*chunks[0])[begin];
-}
-
-HeaderField &FieldLookupTable::front()
-{
-    Q_ASSERT(nDynamic && begin != end && chunks.size());
-    return (*chunks[0])[begin];
-}
+    if (!indexIsValid(index))
+        return false;
 
-const HeaderField &FieldLookupTable::back() const
-{
-    Q_ASSERT(nDynamic && end && end != begin);
+    const auto &table = staticPart();
+    if (index - 1 < table.size())
+        *dst = table[index - 1].value;
+    else
+        *dst = dynamicEntry(index - 1 - quint32(table.size())).value;
 
-    const quint32 absIndex = end - 1;
-    const quint32 chunkIndex = absIndex / ChunkSize;
-    Q_ASSERT(chunkIndex < chunks.size());
-    const quint32 offset = absIndex % ChunkSize;
-    return (*chunks[chunkIndex])[offset];
+    return true;
 }
 
-quint32 FieldLookupTable::indexOfChunk(const Chunk *chunk) const
+HeaderField &FieldLookupTable::dynamicEntry(quint32 position)
 {
-    Q_ASSERT(chunk);
-
-    for (size_type i = 0; i < chunks.size(); ++i) {
-        if (chunks[i].get() == chunk)
-            return quint32(i);
-    }
-
-    Q_UNREACHABLE();
-    return 0;
+    Q_ASSERT(position < nDynamic);
+    return ring[(head + position) % ring.size()];
 }
 
-quint32 FieldLookupTable::keyToIndex(const SearchEntry &key) const
+const HeaderField &FieldLookupTable::dynamicEntry(quint32 position) const
 {
-    Q_ASSERT(key.chunk);
-
-    const auto chunkIndex = indexOfChunk(key.chunk);
-    const auto offset = key.offset;
-    Q_ASSERT(offset < ChunkSize);
-    Q_ASSERT(chunkIndex || offset >= begin);
-
-    return quint32(offset + chunkIndex * ChunkSize - begin + 1 + staticPart().size());
+    Q_ASSERT(position < nDynamic);
+    return ring[(head + position) % ring.size()];
 }
 
-FieldLookupTable::SearchEntry FieldLookupTable::frontKey() const
+quint32 FieldLookupTable::sequenceToIndex(quint64 sequence) const
 {
-    Q_ASSERT(chunks.size() && end != begin);
-    return SearchEntry(&front(), chunks.front().get(), begin, this);
+    Q_ASSERT(sequence < nextSequence && nextSequence - sequence <= nDynamic);
+    // The newest entry (sequence nextSequence - 1) is the first one after
+    // the static part:
+    return quint32(nextSequence - sequence) + quint32(staticPart().size());
 }
 
-FieldLookupTable::SearchEntry FieldLookupTable::backKey() const
+void FieldLookupTable::growRing()
 {
-    Q_ASSERT(chunks.size() && end != begin);
-
-    const HeaderField &field = back();
-    const quint32 absIndex = end - 1;
-    const auto offset = absIndex % ChunkSize;
-    const auto chunk = chunks[absIndex / ChunkSize].get();
-
-    return SearchEntry(&field, chunk, offset, this);
+    // Every entry takes at least 32 octets, so a table of DefaultSize
+    // never has more than 128 of them; start small and double:
+    const std::size_t newSize = ring.empty() ? std::size_t(16) : ring.size() * 2;
+    std::vector<HeaderField> newRing(newSize);
+    for (quint32 i = 0; i < nDynamic; ++i)
+        newRing[i] = std::move(dynamicEntry(i));
+    ring.swap(newRing);
+    head = 0;
 }
 
 bool FieldLookupTable::updateDynamicTableSize(quint32 size)
@@ -53,12 +53,10 @@
 
 #include <QtCore/qbytearray.h>
 #include <QtCore/qglobal.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qpair.h>
 
 #include <vector>
-#include <memory>
-#include <deque>
-#include <set>
 
 QT_BEGIN_NAMESPACE
 
@@ -86,6 +84,11 @@ struct Q_AUTOTEST_EXPORT HeaderField
     QByteArray value;
 };
 
+inline size_t qHash(const HeaderField &field, size_t seed = 0) noexcept
+{
+    return qHashMulti(seed, field.name, field.value);
+}
+
 using HeaderSize = QPair<bool, quint32>;
 
 HeaderSize entry_size(const QByteArray &name, const QByteArray &value);
@@ -113,34 +116,28 @@ inline HeaderSize entry_size(const HeaderField &entry)
 
     Static table is an immutable vector.
 
-    Dynamic part is implemented in a way similar to std::deque -
-    it's a vector of pointers to chunks. Each chunk is a vector of
-    (name|value) pairs. Once allocated with a fixed size, chunk
-    never re-allocates its data, so entries' addresses do not change.
-    We add new chunks prepending them to the front of a vector,
-    in each chunk we fill (name|value) pairs starting from the back
-    of the chunk (this simplifies item eviction/FIFO).
-    Given a 'linear' index we can find a chunk number and
-    offset in this chunk - random access.
+    Dynamic part is a ring buffer of (name|value) pairs: new entries
+    are prepended by moving the ring's head back, evicted ones are
+    dropped from its tail. Given a 'linear' index, the position in
+    the ring is one addition and a modulo away - random access. The
+    ring grows by doubling when full, which re-linearizes it; entries
+    are never moved otherwise.
 
     Lookup in a static part is straightforward:
     it's an (immutable) vector, data is sorted,
     contains no duplicates, we use binary search comparing string values.
 
     To provide a lookup in dynamic table faster than a linear search,
-    we have an std::set of 'SearchEntries', where each entry contains:
-     - a pointer to a (name|value) pair (to compare
-       name|value strings).
-     - a pointer to a chunk containing this pair and
-     - an offset within this chunk - to calculate a
-       'linear' index.
-
-    Entries in a table can be duplicated (HPACK, 2.3.2),
-    if we evict an entry, we must update our index removing
-    the exactly right key, thus keys in this set are sorted
-    by name|value pairs first, and then by chunk index/offset
-    (so that NewSearchEntryKey < OldSearchEntry even if strings
-    are equal).
+    we have two hashes mapping (name|value) pairs and names to the
+    sequence number of the newest entry having them. Entries are
+    numbered in the order they are inserted, so a sequence number
+    translates into a 'linear' index by subtracting it from the number
+    of the newest entry.
+
+    Entries in a table can be duplicated (HPACK, 2.3.2). When we evict
+    an entry, it is the oldest one: if a hash still maps its key to its
+    own sequence number, no newer entry has this key and we remove the
+    key; otherwise a newer duplicate owns the key and we leave it alone.
 */
 
 class Q_AUTOTEST_EXPORT FieldLookupTable
@@ -148,7 +145,6 @@ class Q_AUTOTEST_EXPORT FieldLookupTable
 public:
     enum
     {
-        ChunkSize = 16,
         DefaultSize = 4096 // Recommended by HTTP2.
     };
 
@@ -185,47 +181,22 @@ private:
     // the HPACK bit stream (HPACK, 6.3).
     quint32 tableCapacity;
 
-    using Chunk = std::vector<HeaderField>;
-    using ChunkPtr = std::unique_ptr<Chunk>;
-    std::deque<ChunkPtr> chunks;
-    using size_type = std::deque<ChunkPtr>::size_type;
-
-    struct SearchEntry;
-    friend struct SearchEntry;
-
-    struct SearchEntry
-    {
-        SearchEntry();
-        SearchEntry(const HeaderField *f, const Chunk *c,
-                    quint32 o, const FieldLookupTable *t);
-
-        const HeaderField *field;
-        const Chunk *chunk;
-        const quint32 offset;
-        const FieldLookupTable *table;
-
-        bool operator < (const SearchEntry &rhs) const;
-    };
-
-    bool useIndex;
-    std::set<SearchEntry> searchIndex;
-
-    SearchEntry frontKey() const;
-    SearchEntry backKey() const;
-
-    bool fieldAt(quint32 index, HeaderField *field) const;
-
-    const HeaderField &front() const;
-    HeaderField &front();
-    const HeaderField &back() const;
-
+    // The ring of dynamic entries, the newest one at 'head':
+    std::vector<HeaderField> ring;
+    quint32 head;
     quint32 nDynamic;
-    quint32 begin;
-    quint32 end;
     quint32 dataSize;
+    // Sequence number the next inserted entry gets:
+    quint64 nextSequence;
+
+    bool useIndex;
+    QHash<HeaderField, quint64> fieldIndex;
+    QHash<QByteArray, quint64> nameIndex;
 
-    quint32 indexOfChunk(const Chunk *chunk) const;
-    quint32 keyToIndex(const SearchEntry &key) const;
+    HeaderField &dynamicEntry(quint32 position);
+    const HeaderField &dynamicEntry(quint32 position) const;
+    quint32 sequenceToIndex(quint64 sequence) const;
+    void growRing();
 
     enum class CompareMode {
         nameOnly,
@@ -234,8 +205,6 @@ private:
 
     static std::vector<HeaderField>::const_iterator findInStaticPart(const HeaderField &field, CompareMode mode);
 
-    mutable QByteArray dummyDst;
-
     Q_DISABLE_COPY_MOVE(FieldLookupTable)
 };
 
@@ -479,11 +479,10 @@ bool FrameWriter::writeHEADERS(QAbstractSocket &socket, quint32 sizeLimit)
         if (chunkSize + offset == buffer.size())
             continuationWriter.addFlag(FrameFlag::END_HEADERS);
         continuationWriter.setPayloadSize(chunkSize);
-        if (!continuationWriter.write(socket))
-            return false;
-        written = socket.write(reinterpret_cast<const char *>(&buffer[offset]),
-                               chunkSize);
-        if (written != qint64(chunkSize))
+        const auto &header = continuationWriter.outboundFrame().buffer;
+        written = socket.writeChunks({QByteArrayView(&header[0], frameHeaderSize),
+                                      QByteArrayView(&buffer[offset], chunkSize)});
+        if (written != qint64(frameHeaderSize + chunkSize))
             return false;
 
         offset += chunkSize;
@@ -512,16 +511,11 @@ bool FrameWriter::writeDATA(QAbstractSocket &socket, quint32 sizeLimit,
     for (quint32 offset = 0; offset != size;) {
         const auto chunkSize = std::min(size - offset, sizeLimit);
         setPayloadSize(chunkSize);
-        // Frame's header first:
-        if (!write(socket))
+        // Frame's header and payload (if any), in one go:
+        const auto written = socket.writeChunks({QByteArrayView(&frame.buffer[0], frame.buffer.size()),
+                                                 QByteArrayView(src + offset, chunkSize)});
+        if (written != qint64(frame.buffer.size() + chunkSize))
             return false;
-        // Payload (if any):
-        if (chunkSize) {
-            const auto written = socket.write(reinterpret_cast<const char*>(src + offset),
-                                              chunkSize);
-            if (written != qint64(chunkSize))
-                return false;
-        }
 
         offset += chunkSize;
     }
@@ -415,7 +415,8 @@ bool padding_is_valid(quint32 chunk, quint32 nBits)
 }
 
 HuffmanDecoder::HuffmanDecoder()
-    : minCodeLength()
+    : minCodeLength(),
+      maxCodeLength()
 {
     const auto nCodes = sizeof staticHuffmanCodeTable / sizeof staticHuffmanCodeTable[0];
 
@@ -430,6 +431,8 @@ HuffmanDecoder::HuffmanDecoder()
     });
 
     minCodeLength = symbols.back().bitLength; // The shortest one, currently it's 5.
+    maxCodeLength = symbols.front().bitLength; // The longest one, currently it's 30.
+    Q_ASSERT(maxCodeLength <= 32);
 
     // TODO: add a verification - Huffman codes
     // within a given bit length range also
@@ -492,9 +495,21 @@ HuffmanDecoder::HuffmanDecoder()
 
 bool HuffmanDecoder::decodeStream(BitIStream &inputStream, QByteArray &outputBuffer)
 {
+    // No code is shorter than minCodeLength, which bounds the output:
+    const quint64 inputBits = inputStream.bitLength() - inputStream.streamOffset();
+    outputBuffer.reserve(outputBuffer.size() + int(inputBits / minCodeLength));
+
+    // Instead of peeking 32 bits for every symbol, we peek 64 bits and
+    // decode from this window as long as it still holds a code of the
+    // maximum length:
+    quint64 window = 0;
+    quint64 windowBits = 0;
     while (true) {
-        quint32 chunk = 0;
-        const quint32 readBits = inputStream.peekBits(inputStream.streamOffset(), 32, &chunk);
+        if (windowBits < maxCodeLength)
+            windowBits = inputStream.peekBits(inputStream.streamOffset(), 64, &window);
+
+        const quint32 chunk = quint32(window >> 32);
+        const quint32 readBits = quint32(std::min<quint64>(windowBits, 32));
         if (!readBits)
             return !inputStream.hasMoreBits();
 
@@ -531,6 +546,8 @@ bool HuffmanDecoder::decodeStream(BitIStream &inputStream, QByteArray &outputBuf
 
         outputBuffer.append(entry.byteValue);
         inputStream.skipBits(entry.bitLength);
+        window <<= entry.bitLength;
+        windowBits -= entry.bitLength;
     }
 
     return false;
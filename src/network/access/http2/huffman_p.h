@@ -157,6 +157,7 @@ private:
     std::vector<PrefixTable> prefixTables;
     std::vector<PrefixTableEntry> tableData;
     quint32 minCodeLength;
+    quint32 maxCodeLength;
 };
 
 bool huffman_decode_string(BitIStream &inputStream, QByteArray *outputBuffer);
@@ -381,6 +381,51 @@ qsizetype QDecompressHelper::read(char *data, qsizetype maxSize)
     return bytesRead;
 }
 
+/*!
+    \internal
+    Decompresses all the data fed so far and appends it to \a out.
+    Returns the number of bytes appended, or -1 on error.
+
+    The decoder writes straight into blocks that are then moved
+    into \a out, and each block is filled before the next one is
+    started, so the data is not copied again and \a out is not left
+    with a lot of small, mostly empty blocks.
+*/
+qsizetype QDecompressHelper::read(QByteDataBuffer *out)
+{
+    Q_ASSERT(out);
+    // Compressed HTTP bodies typically expand by a factor of 3 to 10.
+    constexpr qint64 MinBlockSize = 4 * 1024;
+    constexpr qint64 MaxBlockSize = 256 * 1024;
+    const qint64 blockSize = qBound(MinBlockSize, 4 * encodedBytesAvailable(), MaxBlockSize);
+
+    qsizetype total = 0;
+    QByteArray block;
+    qsizetype filled = 0;
+    while (hasData()) {
+        if (block.isEmpty())
+            block.resize(blockSize);
+        const qsizetype bytesRead = read(block.data() + filled, block.size() - filled);
+        if (bytesRead < 0)
+            return -1;
+        filled += bytesRead;
+        if (filled == block.size()) {
+            total += filled;
+            out->append(std::move(block));
+            block = QByteArray();
+            filled = 0;
+        }
+    }
+    if (filled > 0) {
+        block.resize(filled);
+        if (filled < block.capacity() / 2)
+            block.squeeze();
+        total += filled;
+        out->append(std::move(block));
+    }
+    return total;
+}
+
 /*!
     \internal
     Returns true if there are encoded bytes left or there is some
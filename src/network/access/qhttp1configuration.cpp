@@ -0,0 +1,171 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qhttp1configuration.h"
+
+#include "private/qhttpnetworkconnection_p.h"
+
+#include "qdebug.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QHttp1Configuration
+    \brief The QHttp1Configuration class controls HTTP/1 parameters and settings.
+    \since 6.0
+
+    \reentrant
+    \inmodule QtNetwork
+    \ingroup network
+    \ingroup shared
+
+    QHttp1Configuration controls HTTP/1 parameters and settings that
+    QNetworkAccessManager will use to send requests and process responses.
+
+    Currently this is limited to the number of simultaneous connections
+    QNetworkAccessManager opens to a single host. Requests to the same
+    host that ask for a different number of connections are sent over
+    separate sets of connections.
+
+    \note The configuration must be set before the first request
+    was sent to a given host.
+
+    \sa QNetworkRequest::setHttp1Configuration(), QNetworkRequest::http1Configuration(), QNetworkAccessManager
+*/
+
+class QHttp1ConfigurationPrivate : public QSharedData
+{
+public:
+    unsigned numberOfConnectionsPerHost = QHttpNetworkConnectionPrivate::defaultHttpChannelCount;
+};
+
+/*!
+    Default constructs a QHttp1Configuration object.
+
+    Such a configuration allows six connections per host, which is the
+    number QNetworkAccessManager has always been using.
+*/
+QHttp1Configuration::QHttp1Configuration()
+    : d(new QHttp1ConfigurationPrivate)
+{
+}
+
+/*!
+    Copy-constructs this QHttp1Configuration.
+*/
+QHttp1Configuration::QHttp1Configuration(const QHttp1Configuration &) = default;
+
+/*!
+    Move-constructs this QHttp1Configuration from \a other
+*/
+QHttp1Configuration::QHttp1Configuration(QHttp1Configuration &&other) noexcept
+{
+    swap(other);
+}
+
+/*!
+    Copy-assigns to this QHttp1Configuration.
+*/
+QHttp1Configuration &QHttp1Configuration::operator=(const QHttp1Configuration &) = default;
+
+/*!
+    Move-assigns to this QHttp1Configuration.
+*/
+QHttp1Configuration &QHttp1Configuration::operator=(QHttp1Configuration &&) noexcept = default;
+
+/*!
+    Destructor.
+*/
+QHttp1Configuration::~QHttp1Configuration()
+{
+}
+
+/*!
+    Sets the number of connections (minimum: 1; maximum: 255)
+    QNetworkAccessManager will open to a single host to \a amount.
+    Returns \c false and leaves the configuration unchanged if
+    \a amount is out of range.
+
+    \sa numberOfConnectionsPerHost
+*/
+bool QHttp1Configuration::setNumberOfConnectionsPerHost(unsigned amount)
+{
+    if (amount == 0 || amount > 255) {
+        qWarning("QHttp1Configuration::setNumberOfConnectionsPerHost: invalid number of connections: %u",
+                 amount);
+        return false;
+    }
+
+    d->numberOfConnectionsPerHost = amount;
+    return true;
+}
+
+/*!
+    Returns the number of connections QNetworkAccessManager will open
+    to a single host. The default is 6.
+
+    \sa setNumberOfConnectionsPerHost
+*/
+unsigned QHttp1Configuration::numberOfConnectionsPerHost() const
+{
+    return d->numberOfConnectionsPerHost;
+}
+
+/*!
+    Swaps this configuration with the \a other configuration.
+*/
+void QHttp1Configuration::swap(QHttp1Configuration &other) noexcept
+{
+    d.swap(other.d);
+}
+
+/*!
+    Returns \c true if \a lhs and \a rhs have the same set of HTTP/1
+    parameters.
+*/
+bool operator==(const QHttp1Configuration &lhs, const QHttp1Configuration &rhs)
+{
+    if (lhs.d == rhs.d)
+        return true;
+
+    return lhs.d->numberOfConnectionsPerHost == rhs.d->numberOfConnectionsPerHost;
+}
+
+QT_END_NAMESPACE
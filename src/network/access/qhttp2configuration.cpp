@@ -104,6 +104,8 @@ public:
     unsigned streamWindowSize = Http2::defaultSessionWindowSize;
 
     unsigned maxFrameSize = Http2::minPayloadLimit; // Initial (default) value of 16Kb.
+    // Percentage of a receive window consumed before we send WINDOW_UPDATE.
+    unsigned windowUpdateThreshold = 50;
 
     bool pushEnabled = false;
     // TODO: for now those two below are noop.
@@ -120,6 +122,7 @@ public:
         \li Window size for connection-level flow control is 65535 octets
         \li Window size for stream-level flow control is 65535 octets
         \li Frame size is 16384 octets
+        \li WINDOW_UPDATE frames are sent when half of a window was consumed
     \endlist
 */
 QHttp2Configuration::QHttp2Configuration()
@@ -286,6 +289,46 @@ unsigned QHttp2Configuration::maxFrameSize() const
     return d->maxFrameSize;
 }
 
+/*!
+    \since 6.0
+
+    Sets the share of a receive window, in \a percent, that the server
+    must have consumed before QNetworkAccessManager sends a WINDOW_UPDATE
+    frame to replenish it. This applies to the connection-level window
+    and to each stream's window. \a percent must be between 1 and 100.
+
+    A higher threshold means fewer WINDOW_UPDATE frames, which matters
+    when many streams receive data on the same connection, at the cost of
+    letting the windows run lower before they are reopened; combine it
+    with larger window sizes to keep the server from stalling.
+
+    \sa windowUpdateThreshold(), setStreamReceiveWindowSize(),
+        setSessionReceiveWindowSize()
+*/
+bool QHttp2Configuration::setWindowUpdateThreshold(unsigned percent)
+{
+    if (!percent || percent > 100) {
+        qCWarning(QT_HTTP2) << "Invalid window update threshold";
+        return false;
+    }
+
+    d->windowUpdateThreshold = percent;
+    return true;
+}
+
+/*!
+    \since 6.0
+
+    Returns the share of a receive window, in percent, that must be
+    consumed before a WINDOW_UPDATE frame is sent. The default is 50.
+
+    \sa setWindowUpdateThreshold()
+*/
+unsigned QHttp2Configuration::windowUpdateThreshold() const
+{
+    return d->windowUpdateThreshold;
+}
+
 /*!
     Swaps this configuration with the \a other configuration.
 */
@@ -306,7 +349,8 @@ bool operator==(const QHttp2Configuration &lhs, const QHttp2Configuration &rhs)
     return lhs.d->pushEnabled == rhs.d->pushEnabled
            && lhs.d->huffmanCompressionEnabled == rhs.d->huffmanCompressionEnabled
            && lhs.d->sessionWindowSize == rhs.d->sessionWindowSize
-           && lhs.d->streamWindowSize == rhs.d->streamWindowSize;
+           && lhs.d->streamWindowSize == rhs.d->streamWindowSize
+           && lhs.d->windowUpdateThreshold == rhs.d->windowUpdateThreshold;
 }
 
 QT_END_NAMESPACE
@@ -79,6 +79,9 @@ public:
     bool setMaxFrameSize(unsigned size);
     unsigned maxFrameSize() const;
 
+    bool setWindowUpdateThreshold(unsigned percent);
+    unsigned windowUpdateThreshold() const;
+
     void swap(QHttp2Configuration &other) noexcept;
 
 private:
@@ -61,6 +61,7 @@
 #include <qcoreapplication.h>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 QT_BEGIN_NAMESPACE
@@ -181,6 +182,12 @@ QHttp2ProtocolHandler::QHttp2ProtocolHandler(QHttpNetworkConnectionChannel *chan
     maxSessionReceiveWindowSize = h2Config.sessionReceiveWindowSize();
     pushPromiseEnabled = h2Config.serverPushEnabled();
     streamInitialReceiveWindowSize = h2Config.streamReceiveWindowSize();
+    const auto windowUpdateLimit = [&h2Config](qint32 windowSize) {
+        // With a threshold of 100%, wait until the window is exhausted.
+        return qMax(qint32(qint64(windowSize) * (100 - h2Config.windowUpdateThreshold()) / 100), 1);
+    };
+    sessionWindowUpdateLimit = windowUpdateLimit(maxSessionReceiveWindowSize);
+    streamWindowUpdateLimit = windowUpdateLimit(streamInitialReceiveWindowSize);
     encoder.setCompressStrings(h2Config.huffmanCompressionEnabled());
 
     if (!channel->ssl && m_connection->connectionType() != QHttpNetworkConnection::ConnectionTypeHTTP2Direct) {
@@ -401,12 +408,16 @@ bool QHttp2ProtocolHandler::sendRequest()
         it = requests.erase(it);
 
         Stream &newStream = activeStreams[newStreamID];
+        QNetworkReplyTimings &timings = newStream.reply()->d_func()->timings;
+        m_channel->takeConnectionTimings(&timings);
         if (!sendHEADERS(newStream)) {
             finishStreamWithError(newStream, QNetworkReply::UnknownNetworkError,
                                   QLatin1String("failed to send HEADERS frame(s)"));
             deleteActiveStream(newStreamID);
             continue;
         }
+        if (!newStream.data())
+            QNetworkReplyTimingsPrivate::record(timings, QNetworkReplyTimings::RequestSent);
 
         if (newStream.data() && !sendDATA(newStream)) {
             finishStreamWithError(newStream, QNetworkReply::UnknownNetworkError,
@@ -547,6 +558,7 @@ bool QHttp2ProtocolHandler::sendDATA(Stream &stream)
         frameWriter.start(FrameType::DATA, FrameFlag::END_STREAM, stream.streamID);
         frameWriter.setPayloadSize(0);
         frameWriter.write(*m_socket);
+        QNetworkReplyTimingsPrivate::record(replyPrivate->timings, QNetworkReplyTimings::RequestSent);
         stream.state = Stream::halfClosedLocal;
         stream.data()->disconnect(this);
         removeFromSuspended(stream.streamID);
@@ -566,6 +578,28 @@ bool QHttp2ProtocolHandler::sendWINDOW_UPDATE(quint32 streamID, quint32 delta)
     return frameWriter.write(*m_socket);
 }
 
+void QHttp2ProtocolHandler::queueWINDOW_UPDATE(quint32 streamID, quint32 delta)
+{
+    // With many streams receiving data, replenishing each window from its
+    // own queued call would mean a separate event and socket write per
+    // frame. Instead we sum up what is due and write one batch.
+    if (queuedWindowUpdates.isEmpty())
+        QMetaObject::invokeMethod(this, "sendQueuedWINDOW_UPDATEs", Qt::QueuedConnection);
+    queuedWindowUpdates[streamID] += delta;
+}
+
+void QHttp2ProtocolHandler::sendQueuedWINDOW_UPDATEs()
+{
+    const auto updates = std::exchange(queuedWindowUpdates, {});
+    for (auto it = updates.cbegin(), end = updates.cend(); it != end; ++it) {
+        // Streams that were finished in the meantime need no more data.
+        if (it.key() != connectionStreamID && !activeStreams.contains(it.key()))
+            continue;
+        if (!sendWINDOW_UPDATE(it.key(), it.value()))
+            return;
+    }
+}
+
 bool QHttp2ProtocolHandler::sendRST_STREAM(quint32 streamID, quint32 errorCode)
 {
     Q_ASSERT(m_socket);
@@ -618,19 +652,15 @@ void QHttp2ProtocolHandler::handleDATA()
             if (inboundFrame.flags().testFlag(FrameFlag::END_STREAM)) {
                 finishStream(stream);
                 deleteActiveStream(stream.streamID);
-            } else if (stream.recvWindow < streamInitialReceiveWindowSize / 2) {
-                QMetaObject::invokeMethod(this, "sendWINDOW_UPDATE", Qt::QueuedConnection,
-                                          Q_ARG(quint32, stream.streamID),
-                                          Q_ARG(quint32, streamInitialReceiveWindowSize - stream.recvWindow));
+            } else if (stream.recvWindow < streamWindowUpdateLimit) {
+                queueWINDOW_UPDATE(stream.streamID, streamInitialReceiveWindowSize - stream.recvWindow);
                 stream.recvWindow = streamInitialReceiveWindowSize;
             }
         }
     }
 
-    if (sessionReceiveWindowSize < maxSessionReceiveWindowSize / 2) {
-        QMetaObject::invokeMethod(this, "sendWINDOW_UPDATE", Qt::QueuedConnection,
-                                  Q_ARG(quint32, connectionStreamID),
-                                  Q_ARG(quint32, maxSessionReceiveWindowSize - sessionReceiveWindowSize));
+    if (sessionReceiveWindowSize < sessionWindowUpdateLimit) {
+        queueWINDOW_UPDATE(connectionStreamID, maxSessionReceiveWindowSize - sessionReceiveWindowSize);
         sessionReceiveWindowSize = maxSessionReceiveWindowSize;
     }
 }
@@ -1121,6 +1151,7 @@ void QHttp2ProtocolHandler::updateStream(Stream &stream, const HPack::HttpHeader
     }
 
     const auto httpReplyPrivate = httpReply->d_func();
+    QNetworkReplyTimingsPrivate::record(httpReplyPrivate->timings, QNetworkReplyTimings::ResponseStart);
 
     // For HTTP/1 'location' is handled (and redirect URL set) when a protocol
     // handler emits channel->allDone(). Http/2 protocol handler never emits
@@ -1208,21 +1239,14 @@ void QHttp2ProtocolHandler::updateStream(Stream &stream, const Frame &frame,
 
         replyPrivate->totalProgress += length;
 
-        const QByteArray wrapped(data, length);
+        QByteArray wrapped(data, length);
         if (httpRequest.d->autoDecompress && replyPrivate->isCompressed()) {
             Q_ASSERT(replyPrivate->decompressHelper.isValid());
 
-            replyPrivate->decompressHelper.feed(wrapped);
-            while (replyPrivate->decompressHelper.hasData()) {
-                QByteArray output(4 * 1024, Qt::Uninitialized);
-                qint64 read = replyPrivate->decompressHelper.read(output.data(), output.size());
-                if (read > 0) {
-                    output.resize(read);
-                    replyPrivate->responseData.append(std::move(output));
-                }
-            }
+            replyPrivate->decompressHelper.feed(std::move(wrapped));
+            replyPrivate->decompressHelper.read(&replyPrivate->responseData);
         } else {
-            replyPrivate->responseData.append(wrapped);
+            replyPrivate->responseData.append(std::move(wrapped));
         }
 
         if (replyPrivate->shouldEmitSignals()) {
@@ -1251,6 +1275,7 @@ void QHttp2ProtocolHandler::finishStream(Stream &stream, Qt::ConnectionType conn
         if (stream.data())
             stream.data()->disconnect(this);
 
+        QNetworkReplyTimingsPrivate::record(httpReply->d_func()->timings, QNetworkReplyTimings::ResponseEnd);
         if (connectionType == Qt::DirectConnection)
             emit httpReply->finished();
         else
@@ -69,6 +69,7 @@
 #include <QtCore/qobject.h>
 #include <QtCore/qflags.h>
 #include <QtCore/qhash.h>
+#include <QtCore/qmap.h>
 
 #include <vector>
 #include <limits>
@@ -112,6 +113,8 @@ private:
     bool sendHEADERS(Stream &stream);
     bool sendDATA(Stream &stream);
     Q_INVOKABLE bool sendWINDOW_UPDATE(quint32 streamID, quint32 delta);
+    void queueWINDOW_UPDATE(quint32 streamID, quint32 delta);
+    Q_INVOKABLE void sendQueuedWINDOW_UPDATEs();
     bool sendRST_STREAM(quint32 streamID, quint32 errorCoder);
     bool sendGOAWAY(quint32 errorCode);
 
@@ -202,6 +205,15 @@ private:
     // from QHttp2Configuration. Again, signed - can become negative.
     qint32 streamInitialReceiveWindowSize = Http2::defaultSessionWindowSize;
 
+    // When a receive window drops below these, we replenish it; computed
+    // from QHttp2Configuration::windowUpdateThreshold(), by default half
+    // of the window:
+    qint32 sessionWindowUpdateLimit = Http2::defaultSessionWindowSize / 2;
+    qint32 streamWindowUpdateLimit = Http2::defaultSessionWindowSize / 2;
+    // WINDOW_UPDATE frames due, by stream ID; collected while we handle
+    // incoming frames and sent together once we return to the event loop:
+    QMap<quint32, quint32> queuedWindowUpdates;
+
     // These are our peer's receive window sizes, they will be updated by the
     // peer's SETTINGS and WINDOW_UPDATE frames, defaults presumed to be 64Kb.
     qint32 sessionSendWindowSize = Http2::defaultSessionWindowSize;
@@ -133,6 +133,9 @@ void QHttpNetworkConnectionChannel::init()
     QObject::connect(socket, SIGNAL(connected()),
                      this, SLOT(_q_connected()),
                      Qt::DirectConnection);
+    QObject::connect(socket, SIGNAL(hostFound()),
+                     this, SLOT(_q_hostFound()),
+                     Qt::DirectConnection);
     QObject::connect(socket, SIGNAL(readyRead()),
                      this, SLOT(_q_readyRead()),
                      Qt::DirectConnection);
@@ -331,6 +334,11 @@ bool QHttpNetworkConnectionChannel::ensureConnection()
         state = QHttpNetworkConnectionChannel::ConnectingState;
         pendingEncrypt = ssl;
 
+        connectionTimings = QNetworkReplyTimings();
+        connectionTimingsPending = true;
+        QNetworkReplyTimingsPrivate::record(connectionTimings, QNetworkReplyTimings::DomainLookupStart);
+        QNetworkReplyTimingsPrivate::record(connectionTimings, QNetworkReplyTimings::ConnectStart);
+
         // reset state
         pipeliningSupported = PipeliningSupportUnknown;
         authenticationCredentialsSent = false;
@@ -457,6 +465,8 @@ void QHttpNetworkConnectionChannel::allDone()
         return;
     }
 
+    QNetworkReplyTimingsPrivate::record(reply->d_func()->timings, QNetworkReplyTimings::ResponseEnd);
+
     // For clear text HTTP/2 we tried to upgrade from HTTP/1.1 to HTTP/2; for
     // ConnectionTypeHTTP2Direct we can never be here in case of failure
     // (after an attempt to read HTTP/1.1 as HTTP/2 frames) or we have a normal
@@ -909,6 +919,11 @@ void QHttpNetworkConnectionChannel::_q_connected()
     // not sure yet if it helps, but it makes sense
     socket->setSocketOption(QAbstractSocket::KeepAliveOption, 1);
 
+    if (ssl || pendingEncrypt)
+        QNetworkReplyTimingsPrivate::record(connectionTimings, QNetworkReplyTimings::SecureConnectionStart);
+    else
+        QNetworkReplyTimingsPrivate::record(connectionTimings, QNetworkReplyTimings::ConnectEnd);
+
     pipeliningSupported = QHttpNetworkConnectionChannel::PipeliningSupportUnknown;
 
     if (QNetworkStatusMonitor::isEnabled()) {
@@ -965,6 +980,21 @@ void QHttpNetworkConnectionChannel::_q_connected()
 }
 
 
+void QHttpNetworkConnectionChannel::_q_hostFound()
+{
+    QNetworkReplyTimingsPrivate::record(connectionTimings, QNetworkReplyTimings::DomainLookupEnd);
+    QNetworkReplyTimingsPrivate::update(connectionTimings, QNetworkReplyTimings::ConnectStart);
+}
+
+void QHttpNetworkConnectionChannel::takeConnectionTimings(QNetworkReplyTimings *replyTimings)
+{
+    // replies sent over an already established connection don't get any
+    if (!connectionTimingsPending)
+        return;
+    QNetworkReplyTimingsPrivate::copyConnectionMilestones(*replyTimings, connectionTimings);
+    connectionTimingsPending = false;
+}
+
 void QHttpNetworkConnectionChannel::_q_error(QAbstractSocket::SocketError socketError)
 {
     if (!socket)
@@ -1185,6 +1215,8 @@ void QHttpNetworkConnectionChannel::_q_encrypted()
     QSslSocket *sslSocket = qobject_cast<QSslSocket *>(socket);
     Q_ASSERT(sslSocket);
 
+    QNetworkReplyTimingsPrivate::record(connectionTimings, QNetworkReplyTimings::ConnectEnd);
+
     if (!protocolHandler && connection->connectionType() != QHttpNetworkConnection::ConnectionTypeHTTP2Direct) {
         // ConnectionTypeHTTP2Direct does not rely on ALPN/NPN to negotiate HTTP/2,
         // after establishing a secure connection we immediately start sending
@@ -67,6 +67,7 @@
 
 #include <private/qhttpnetworkconnection_p.h>
 #include <private/qabstractprotocolhandler_p.h>
+#include <private/qnetworkreplytimings_p.h>
 
 #ifndef QT_NO_SSL
 #    include <QtNetwork/qsslsocket.h>
@@ -155,6 +156,12 @@ public:
 
     QAbstractSocket::NetworkLayerProtocol networkLayerPreference;
 
+    // Milestones of setting up the current connection; they are handed to
+    // the first reply sent over it.
+    QNetworkReplyTimings connectionTimings;
+    bool connectionTimingsPending = false;
+    void takeConnectionTimings(QNetworkReplyTimings *replyTimings);
+
     void setConnection(QHttpNetworkConnection *c);
     QPointer<QHttpNetworkConnection> connection;
 
@@ -192,6 +199,7 @@ public:
     void _q_readyRead(); // pending data to read
     void _q_disconnected(); // disconnected from host
     void _q_connected(); // start sending request
+    void _q_hostFound(); // host lookup done, TCP connect starts
     void _q_error(QAbstractSocket::SocketError); // error from socket
 #ifndef QT_NO_NETWORKPROXY
     void _q_proxyAuthenticationRequired(const QNetworkProxy &proxy, QAuthenticator *auth); // from transparent proxy
@@ -298,6 +298,11 @@ qint64 QHttpNetworkReply::removedContentLength() const
     return d_func()->removedContentLength;
 }
 
+QNetworkReplyTimings QHttpNetworkReply::timings() const
+{
+    return d_func()->timings;
+}
+
 bool QHttpNetworkReply::isRedirecting() const
 {
     return d_func()->isRedirecting();
@@ -684,8 +689,9 @@ qint64 QHttpNetworkReplyPrivate::readBody(QAbstractSocket *socket, QByteDataBuff
 {
     qint64 bytes = 0;
 
-    // for compressed data we'll allocate a temporary one that we then decompress
-    QByteDataBuffer *tempOutDataBuffer = (autoDecompress ? new QByteDataBuffer : out);
+    // for compressed data we read into a temporary buffer that we then decompress
+    QByteDataBuffer compressedBuffer;
+    QByteDataBuffer *tempOutDataBuffer = (autoDecompress ? &compressedBuffer : out);
 
 
     if (isChunked()) {
@@ -703,21 +709,12 @@ qint64 QHttpNetworkReplyPrivate::readBody(QAbstractSocket *socket, QByteDataBuff
 
     // This is true if there is compressed encoding and we're supposed to use it.
     if (autoDecompress) {
-        QScopedPointer holder(tempOutDataBuffer);
         if (!decompressHelper.isValid())
             return -1;
 
-        decompressHelper.feed(std::move(*tempOutDataBuffer));
-        while (decompressHelper.hasData()) {
-            QByteArray output(4 * 1024, Qt::Uninitialized);
-            qint64 read = decompressHelper.read(output.data(), output.size());
-            if (read < 0) {
-                return -1;
-            } else if (read > 0) {
-                output.resize(read);
-                out->append(std::move(output));
-            }
-        }
+        decompressHelper.feed(std::move(compressedBuffer));
+        if (decompressHelper.read(out) < 0)
+            return -1;
     }
 
     contentRead += bytes;
@@ -148,6 +148,8 @@ public:
 
     bool isRedirecting() const;
 
+    QNetworkReplyTimings timings() const;
+
     QHttpNetworkConnection* connection();
 
     QUrl redirectUrl() const;
@@ -269,6 +271,8 @@ public:
     QByteDataBuffer responseData; // uncompressed body
     bool requestIsPrepared;
 
+    QNetworkReplyTimings timings;
+
     bool pipeliningUsed;
     bool h2Used;
     bool downstreamLimited;
@@ -106,6 +106,8 @@ void QHttpProtocolHandler::_q_receiveReply()
                 m_channel->handleUnexpectedEOF();
                 return;
             }
+            if (statusBytes > 0)
+                QNetworkReplyTimingsPrivate::record(m_reply->d_func()->timings, QNetworkReplyTimings::ResponseStart);
             bytes += statusBytes;
             m_channel->lastStatus = m_reply->d_func()->statusCode;
             break;
@@ -291,6 +293,10 @@ bool QHttpProtocolHandler::sendRequest()
         replyPrivate->connectionChannel = m_channel;
         replyPrivate->autoDecompress = m_channel->request.d->autoDecompress;
         replyPrivate->pipeliningUsed = false;
+        m_channel->takeConnectionTimings(&replyPrivate->timings);
+        // the request might be sent again, e.g. after a reconnect
+        QNetworkReplyTimingsPrivate::reset(replyPrivate->timings, QNetworkReplyTimings::RequestSent);
+        QNetworkReplyTimingsPrivate::reset(replyPrivate->timings, QNetworkReplyTimings::ResponseStart);
 
         // if the url contains authentication parameters, use the new ones
         // both channels will use the new authentication parameters
@@ -409,6 +415,7 @@ bool QHttpProtocolHandler::sendRequest()
 
     case QHttpNetworkConnectionChannel::WaitingState:
     {
+        QNetworkReplyTimingsPrivate::record(m_reply->d_func()->timings, QNetworkReplyTimings::RequestSent);
         QNonContiguousByteDevice* uploadByteDevice = m_channel->request.uploadByteDevice();
         if (uploadByteDevice) {
             QObject::disconnect(uploadByteDevice, SIGNAL(readyRead()), m_channel, SLOT(_q_uploadDataReadyRead()));
@@ -123,7 +123,8 @@ static QNetworkReply::NetworkError statusCodeFromHttp(int httpStatusCode, const
 }
 
 
-static QByteArray makeCacheKey(QUrl &url, QNetworkProxy *proxy, const QString &peerVerifyName)
+static QByteArray makeCacheKey(QUrl &url, QNetworkProxy *proxy, const QString &peerVerifyName,
+                               unsigned connectionCount)
 {
     QString result;
     QUrl copy = url;
@@ -173,6 +174,10 @@ static QByteArray makeCacheKey(QUrl &url, QNetworkProxy *proxy, const QString &p
 #endif
     if (!peerVerifyName.isEmpty())
         result += QLatin1Char(':') + peerVerifyName;
+    // Connections with a non-default number of channels are not shared
+    // with requests wanting the default.
+    if (connectionCount != unsigned(QHttpNetworkConnectionPrivate::defaultHttpChannelCount))
+        result += QLatin1Char('#') + QString::number(connectionCount);
     return "http-connection:" + std::move(result).toLatin1();
 }
 
@@ -181,9 +186,10 @@ class QNetworkAccessCachedHttpConnection: public QHttpNetworkConnection,
 {
     // Q_OBJECT
 public:
-    QNetworkAccessCachedHttpConnection(const QString &hostName, quint16 port, bool encrypt,
+    QNetworkAccessCachedHttpConnection(quint16 connectionCount, const QString &hostName, quint16 port,
+                                       bool encrypt,
                                        QHttpNetworkConnection::ConnectionType connectionType)
-        : QHttpNetworkConnection(hostName, port, encrypt, connectionType)
+        : QHttpNetworkConnection(connectionCount, hostName, port, encrypt, nullptr, connectionType)
     {
         setExpires(true);
         setShareable(true);
@@ -312,22 +318,27 @@ void QHttpThreadDelegate::startRequest()
         }
     }
 
+    const unsigned connectionCount = http1Parameters.numberOfConnectionsPerHost();
+
 #ifndef QT_NO_NETWORKPROXY
     if (transparentProxy.type() != QNetworkProxy::NoProxy)
-        cacheKey = makeCacheKey(urlCopy, &transparentProxy, httpRequest.peerVerifyName());
+        cacheKey = makeCacheKey(urlCopy, &transparentProxy, httpRequest.peerVerifyName(),
+                                connectionCount);
     else if (cacheProxy.type() != QNetworkProxy::NoProxy)
-        cacheKey = makeCacheKey(urlCopy, &cacheProxy, httpRequest.peerVerifyName());
+        cacheKey = makeCacheKey(urlCopy, &cacheProxy, httpRequest.peerVerifyName(),
+                                connectionCount);
     else
 #endif
-        cacheKey = makeCacheKey(urlCopy, nullptr, httpRequest.peerVerifyName());
+        cacheKey = makeCacheKey(urlCopy, nullptr, httpRequest.peerVerifyName(),
+                                connectionCount);
 
     // the http object is actually a QHttpNetworkConnection
     httpConnection = static_cast<QNetworkAccessCachedHttpConnection *>(connections.localData()->requestEntryNow(cacheKey));
     if (!httpConnection) {
         // no entry in cache; create an object
         // the http object is actually a QHttpNetworkConnection
-        httpConnection = new QNetworkAccessCachedHttpConnection(urlCopy.host(), urlCopy.port(), ssl,
-                                                                connectionType);
+        httpConnection = new QNetworkAccessCachedHttpConnection(connectionCount, urlCopy.host(),
+                                                                urlCopy.port(), ssl, connectionType);
         if (connectionType == QHttpNetworkConnection::ConnectionTypeHTTP2
             || connectionType == QHttpNetworkConnection::ConnectionTypeHTTP2Direct) {
             httpConnection->setHttp2Parameters(http2Parameters);
@@ -522,6 +533,7 @@ void QHttpThreadDelegate::finishedSlot()
     if (httpRequest.isFollowRedirects() && httpReply->isRedirecting())
         emit redirected(httpReply->redirectUrl(), httpReply->statusCode(), httpReply->request().redirectCount() - 1);
 
+    emit timingsChanged(httpReply->timings());
     emit downloadFinished();
 
     QMetaObject::invokeMethod(httpReply, "deleteLater", Qt::QueuedConnection);
@@ -546,6 +558,7 @@ void QHttpThreadDelegate::synchronousFinishedSlot()
     }
 
     synchronousDownloadData = httpReply->readAll();
+    incomingTimings = httpReply->timings();
 
     QMetaObject::invokeMethod(httpReply, "deleteLater", Qt::QueuedConnection);
     QMetaObject::invokeMethod(synchronousRequestLoop, "quit", Qt::QueuedConnection);
@@ -566,6 +579,7 @@ void QHttpThreadDelegate::finishedWithErrorSlot(QNetworkReply::NetworkError erro
         emit sslConfigurationChanged(httpReply->sslConfiguration());
 #endif
     emit error(errorCode,detail);
+    emit timingsChanged(httpReply->timings());
     emit downloadFinished();
 
 
@@ -587,6 +601,7 @@ void QHttpThreadDelegate::synchronousFinishedWithErrorSlot(QNetworkReply::Networ
     incomingErrorDetail = detail;
 
     synchronousDownloadData = httpReply->readAll();
+    incomingTimings = httpReply->timings();
 
     QMetaObject::invokeMethod(httpReply, "deleteLater", Qt::QueuedConnection);
     QMetaObject::invokeMethod(synchronousRequestLoop, "quit", Qt::QueuedConnection);
@@ -635,6 +650,7 @@ void QHttpThreadDelegate::headerChangedSlot()
     removedContentLength = httpReply->removedContentLength();
     isHttp2Used = httpReply->isHttp2Used();
 
+    emit timingsChanged(httpReply->timings());
     emit downloadMetaData(incomingHeaders,
                           incomingStatusCode,
                           incomingReasonPhrase,
@@ -62,6 +62,7 @@
 #include <QNetworkReply>
 #include "qhttpnetworkrequest_p.h"
 #include "qhttpnetworkconnection_p.h"
+#include "qhttp1configuration.h"
 #include "qhttp2configuration.h"
 #include <QSharedPointer>
 #include <QScopedPointer>
@@ -117,6 +118,8 @@ public:
     qint64 removedContentLength;
     QNetworkReply::NetworkError incomingErrorCode;
     QString incomingErrorDetail;
+    QNetworkReplyTimings incomingTimings;
+    QHttp1Configuration http1Parameters;
     QHttp2Configuration http2Parameters;
 
 protected:
@@ -148,6 +151,7 @@ signals:
     void error(QNetworkReply::NetworkError, const QString &);
     void downloadFinished();
     void redirected(const QUrl &url, int httpStatus, int maxRedirectsRemainig);
+    void timingsChanged(const QNetworkReplyTimings &timings);
 
 public slots:
     // This are called via QueuedConnection from user thread
@@ -52,6 +52,10 @@ enum ExpiryTimeEnum {
     ExpiryTime = 120
 };
 
+enum IdleEntriesEnum {
+    DefaultMaxIdleEntries = 64
+};
+
 namespace {
     struct Receiver
     {
@@ -103,7 +107,7 @@ void QNetworkAccessCache::CacheableObject::setShareable(bool enable)
 }
 
 QNetworkAccessCache::QNetworkAccessCache()
-    : oldest(nullptr), newest(nullptr)
+    : oldest(nullptr), newest(nullptr), idleCount(0), idleLimit(DefaultMaxIdleEntries)
 {
 }
 
@@ -132,6 +136,47 @@ void QNetworkAccessCache::clear()
     timer.stop();
 
     oldest = newest = nullptr;
+    idleCount = 0;
+}
+
+/*!
+    Sets the maximum number of idle entries that can wait in the expiry
+    list to \a count. When an entry released by its last user would exceed
+    this limit, the least recently used idle entries are disposed of.
+    A negative \a count means no limit.
+ */
+void QNetworkAccessCache::setMaxIdleEntries(int count)
+{
+    idleLimit = count;
+    if (evictIdleEntries())
+        updateTimer();
+}
+
+int QNetworkAccessCache::maxIdleEntries() const
+{
+    return idleLimit;
+}
+
+/*!
+    Disposes of the oldest idle entries until there are no more than
+    maxIdleEntries() of them. Returns \c true if any entry was removed.
+ */
+bool QNetworkAccessCache::evictIdleEntries()
+{
+    if (idleLimit < 0)
+        return false;
+
+    bool evicted = false;
+    while (oldest && idleCount > idleLimit) {
+        Node *node = oldest;
+        unlinkEntry(node->key);
+        node->object->key.clear();
+        node->object->dispose();
+        hash.remove(node->key);
+        delete node;
+        evicted = true;
+    }
+    return evicted;
 }
 
 /*!
@@ -160,6 +205,7 @@ void QNetworkAccessCache::linkEntry(const QByteArray &key)
 
     node->timestamp = QDateTime::currentDateTimeUtc().addSecs(ExpiryTime);
     newest = node;
+    ++idleCount;
 }
 
 /*!
@@ -172,6 +218,10 @@ bool QNetworkAccessCache::unlinkEntry(const QByteArray &key)
     if (!node)
         return false;
 
+    if (node != oldest && !node->older && !node->newer)
+        return false; // not in the list
+
+    --idleCount;
     bool wasOldest = false;
     if (node == oldest) {
         oldest = node->newer;
@@ -230,6 +280,7 @@ void QNetworkAccessCache::timerEvent(QTimerEvent *)
         hash.remove(oldest->key); // oldest gets deleted
         delete oldest;
         oldest = next;
+        --idleCount;
     }
 
     // fixup the list
@@ -346,10 +397,13 @@ void QNetworkAccessCache::releaseEntry(const QByteArray &key)
 
     if (!--node->useCount) {
         // no objects waiting; add it back to the expiry list
-        if (node->object->expires)
+        bool evicted = false;
+        if (node->object->expires) {
             linkEntry(key);
+            evicted = evictIdleEntries(); // may delete node
+        }
 
-        if (oldest == node)
+        if (evicted || oldest == node)
             updateTimer();
     }
 }
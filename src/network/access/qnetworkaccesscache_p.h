@@ -102,6 +102,9 @@ public:
     void releaseEntry(const QByteArray &key);
     void removeEntry(const QByteArray &key);
 
+    void setMaxIdleEntries(int count);
+    int maxIdleEntries() const;
+
 signals:
     void entryReady(QNetworkAccessCache::CacheableObject *);
 
@@ -113,11 +116,14 @@ private:
     NodeHash hash;
     Node *oldest;
     Node *newest;
+    int idleCount;
+    int idleLimit;
 
     QBasicTimer timer;
 
     void linkEntry(const QByteArray &key);
     bool unlinkEntry(const QByteArray &key);
+    bool evictIdleEntries();
     void updateTimer();
     bool emitEntryReady(Node *node, QObject *target, const char *member);
 };
@@ -422,6 +422,7 @@ QNetworkAccessManager::QNetworkAccessManager(QObject *parent)
 #endif
     qRegisterMetaType<QNetworkReply::NetworkError>();
     qRegisterMetaType<QSharedPointer<char> >();
+    qRegisterMetaType<QNetworkReplyTimings>();
 }
 
 /*!
@@ -1632,17 +1633,70 @@ QThread * QNetworkAccessManagerPrivate::createThread()
     return thread;
 }
 
+static int httpThreadCount()
+{
+    // QT_NETWORK_HTTP_THREADS=N spreads the HTTP work of a manager over N
+    // threads instead of doing everything in the manager's single thread.
+    static const int count = qBound(1, qEnvironmentVariableIntValue("QT_NETWORK_HTTP_THREADS"), 16);
+    return count;
+}
+
+/*!
+    \internal
+
+    Returns the thread that does the HTTP work for \a url. By default this is
+    the manager's thread. With more than one HTTP thread all requests for the
+    same scheme, host and port still end up in the same thread, as that is
+    where the (thread-local) connection cache keeps their connections.
+*/
+QThread * QNetworkAccessManagerPrivate::createHttpThread(const QUrl &url)
+{
+    const int count = httpThreadCount();
+    if (count == 1)
+        return createThread();
+
+    // Same normalization as the connection cache key: preconnect requests
+    // must warm up a connection in the thread the real request will use.
+    const QString scheme = url.scheme();
+    const bool isEncrypted = scheme == QLatin1String("https")
+                             || scheme == QLatin1String("preconnect-https");
+    const size_t seed = qHash(url.port(isEncrypted ? 443 : 80), qHash(url.host()));
+    const int index = int(qHash(isEncrypted, seed) % uint(count));
+    if (index == 0)
+        return createThread();
+
+    if (httpThreads.isEmpty())
+        httpThreads.resize(count - 1, nullptr);
+    QThread *&httpThread = httpThreads[index - 1];
+    if (!httpThread) {
+        httpThread = new QThread;
+        httpThread->setObjectName(QStringLiteral("QNetworkAccessManager thread %1").arg(index));
+        httpThread->start();
+    }
+    return httpThread;
+}
+
+static void destroyAccessThread(QThread *thread)
+{
+    thread->quit();
+    thread->wait(QDeadlineTimer(5000));
+    if (thread->isFinished())
+        delete thread;
+    else
+        QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
+}
+
 void QNetworkAccessManagerPrivate::destroyThread()
 {
     if (thread) {
-        thread->quit();
-        thread->wait(QDeadlineTimer(5000));
-        if (thread->isFinished())
-            delete thread;
-        else
-            QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
+        destroyAccessThread(thread);
         thread = nullptr;
     }
+    for (QThread *httpThread : qAsConst(httpThreads)) {
+        if (httpThread)
+            destroyAccessThread(httpThread);
+    }
+    httpThreads.clear();
 }
 
 #if QT_CONFIG(http)
@@ -92,6 +92,7 @@ public:
     ~QNetworkAccessManagerPrivate();
 
     QThread * createThread();
+    QThread * createHttpThread(const QUrl &url);
     void destroyThread();
 
     void _q_replyFinished(QNetworkReply *reply);
@@ -136,6 +137,8 @@ public:
     QNetworkCookieJar *cookieJar;
 
     QThread *thread;
+    // Extra HTTP threads, see createHttpThread()
+    QList<QThread *> httpThreads;
 
 
 #ifndef QT_NO_NETWORKPROXY
@@ -45,6 +45,8 @@
 #include "QtCore/qdatetime.h"
 #if QT_CONFIG(topleveldomain)
 #include "private/qtldurl_p.h"
+
+#include <algorithm>
 #else
 QT_BEGIN_NAMESPACE
 static bool qIsEffectiveTLD(QStringView domain)
@@ -128,7 +130,7 @@ QNetworkCookieJar::~QNetworkCookieJar()
 */
 QList<QNetworkCookie> QNetworkCookieJar::allCookies() const
 {
-    return d_func()->allCookies;
+    return d_func()->allCookies();
 }
 
 /*!
@@ -143,7 +145,7 @@ QList<QNetworkCookie> QNetworkCookieJar::allCookies() const
 void QNetworkCookieJar::setAllCookies(const QList<QNetworkCookie> &cookieList)
 {
     Q_D(QNetworkCookieJar);
-    d->allCookies = cookieList;
+    d->setAllCookies(cookieList);
 }
 
 static inline bool isParentPath(const QString &path, const QString &reference)
@@ -233,50 +235,61 @@ QList<QNetworkCookie> QNetworkCookieJar::cookiesForUrl(const QUrl &url) const
 
     Q_D(const QNetworkCookieJar);
     const QDateTime now = QDateTime::currentDateTimeUtc();
-    QList<QNetworkCookie> result;
+    const QString host = url.host();
+    const QString path = url.path();
     bool isEncrypted = url.scheme() == QLatin1String("https");
 
-    // scan our cookies for something that matches
-    QList<QNetworkCookie>::ConstIterator it = d->allCookies.constBegin(),
-                                        end = d->allCookies.constEnd();
-    for ( ; it != end; ++it) {
-        if (!isParentDomain(url.host(), it->domain()))
-            continue;
-        if (!isParentPath(url.path(), it->path()))
-            continue;
-        if (!(*it).isSessionCookie() && (*it).expirationDate() < now)
-            continue;
-        if ((*it).isSecure() && !isEncrypted)
+    // only cookies set for the host itself or one of its parent domains
+    // can match, so look those up instead of scanning every cookie
+    QList<const QNetworkCookieJarPrivate::IndexedCookie *> matches;
+    qsizetype labelStart = 0;
+    while (labelStart >= 0) {
+        const QString domain = host.mid(labelStart);
+        const auto bucket = d->cookiesByDomain.constFind(domain);
+        labelStart = host.indexOf(QLatin1Char('.'), labelStart);
+        if (labelStart >= 0)
+            ++labelStart;
+        if (bucket == d->cookiesByDomain.cend())
             continue;
 
-        QString domain = it->domain();
-        if (domain.startsWith(QLatin1Char('.'))) /// Qt6?: remove when compliant with RFC6265
-            domain = domain.mid(1);
 #if QT_CONFIG(topleveldomain)
-        if (qIsEffectiveTLD(domain) && url.host() != domain)
+        if (qIsEffectiveTLD(domain) && host != domain)
             continue;
 #else
-        if (!domain.contains(QLatin1Char('.')) && url.host() != domain)
+        if (!domain.contains(QLatin1Char('.')) && host != domain)
             continue;
 #endif // topleveldomain
 
-        // insert this cookie into result, sorted by path
-        QList<QNetworkCookie>::Iterator insertIt = result.begin();
-        while (insertIt != result.end()) {
-            if (insertIt->path().length() < it->path().length()) {
-                // insert here
-                insertIt = result.insert(insertIt, *it);
-                break;
-            } else {
-                ++insertIt;
-            }
+        for (const QNetworkCookieJarPrivate::IndexedCookie &entry : *bucket) {
+            const QNetworkCookie &cookie = entry.cookie;
+            if (!isParentDomain(host, cookie.domain()))
+                continue;
+            if (!isParentPath(path, cookie.path()))
+                continue;
+            if (!cookie.isSessionCookie() && cookie.expirationDate() < now)
+                continue;
+            if (cookie.isSecure() && !isEncrypted)
+                continue;
+            matches.append(&entry);
         }
-
-        // this is the shortest path yet, just append
-        if (insertIt == result.end())
-            result += *it;
     }
 
+    // sort by path, longest first; cookies with paths of the same length
+    // keep the order in which they were added to the jar
+    std::sort(matches.begin(), matches.end(),
+              [](const QNetworkCookieJarPrivate::IndexedCookie *lhs,
+                 const QNetworkCookieJarPrivate::IndexedCookie *rhs) {
+        const qsizetype lhsLength = lhs->cookie.path().length();
+        const qsizetype rhsLength = rhs->cookie.path().length();
+        if (lhsLength != rhsLength)
+            return lhsLength > rhsLength;
+        return lhs->serial < rhs->serial;
+    });
+
+    QList<QNetworkCookie> result;
+    result.reserve(matches.size());
+    for (const QNetworkCookieJarPrivate::IndexedCookie *entry : qAsConst(matches))
+        result.append(entry->cookie);
     return result;
 }
 
@@ -299,7 +312,7 @@ bool QNetworkCookieJar::insertCookie(const QNetworkCookie &cookie)
     deleteCookie(cookie);
 
     if (!isDeletion) {
-        d->allCookies += cookie;
+        d->append(cookie);
         return true;
     }
     return false;
@@ -333,14 +346,7 @@ bool QNetworkCookieJar::updateCookie(const QNetworkCookie &cookie)
 bool QNetworkCookieJar::deleteCookie(const QNetworkCookie &cookie)
 {
     Q_D(QNetworkCookieJar);
-    QList<QNetworkCookie>::Iterator it;
-    for (it = d->allCookies.begin(); it != d->allCookies.end(); ++it) {
-        if (it->hasSameIdentifier(cookie)) {
-            d->allCookies.erase(it);
-            return true;
-        }
-    }
-    return false;
+    return d->remove(cookie);
 }
 
 /*!
@@ -372,4 +378,64 @@ bool QNetworkCookieJar::validateCookie(const QNetworkCookie &cookie, const QUrl
     return !qIsEffectiveTLD(domain);
 }
 
+/*!
+    \internal
+    Returns the key under which cookies for \a domain are indexed: the
+    domain without its leading dot.
+*/
+QString QNetworkCookieJarPrivate::indexKey(const QString &domain)
+{
+    return domain.startsWith(QLatin1Char('.')) ? domain.mid(1) : domain;
+}
+
+QList<QNetworkCookie> QNetworkCookieJarPrivate::allCookies() const
+{
+    QList<const IndexedCookie *> entries;
+    entries.reserve(cookieCount);
+    for (const QList<IndexedCookie> &bucket : cookiesByDomain) {
+        for (const IndexedCookie &entry : bucket)
+            entries.append(&entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](const IndexedCookie *lhs, const IndexedCookie *rhs) {
+        return lhs->serial < rhs->serial;
+    });
+
+    QList<QNetworkCookie> result;
+    result.reserve(entries.size());
+    for (const IndexedCookie *entry : qAsConst(entries))
+        result.append(entry->cookie);
+    return result;
+}
+
+void QNetworkCookieJarPrivate::setAllCookies(const QList<QNetworkCookie> &cookieList)
+{
+    cookiesByDomain.clear();
+    cookieCount = 0;
+    for (const QNetworkCookie &cookie : cookieList)
+        append(cookie);
+}
+
+void QNetworkCookieJarPrivate::append(const QNetworkCookie &cookie)
+{
+    cookiesByDomain[indexKey(cookie.domain())].append({ nextSerial++, cookie });
+    ++cookieCount;
+}
+
+bool QNetworkCookieJarPrivate::remove(const QNetworkCookie &cookie)
+{
+    const auto bucket = cookiesByDomain.find(indexKey(cookie.domain()));
+    if (bucket == cookiesByDomain.end())
+        return false;
+    for (auto it = bucket->begin(); it != bucket->end(); ++it) {
+        if (it->cookie.hasSameIdentifier(cookie)) {
+            bucket->erase(it);
+            if (bucket->isEmpty())
+                cookiesByDomain.erase(bucket);
+            --cookieCount;
+            return true;
+        }
+    }
+    return false;
+}
+
 QT_END_NAMESPACE
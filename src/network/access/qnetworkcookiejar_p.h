@@ -55,15 +55,34 @@
 #include "private/qobject_p.h"
 #include "qnetworkcookie.h"
 
+#include <QtCore/qhash.h>
+
 QT_BEGIN_NAMESPACE
 
 class QNetworkCookieJarPrivate: public QObjectPrivate
 {
 public:
-    QList<QNetworkCookie> allCookies;
+    struct IndexedCookie
+    {
+        quint64 serial; // insertion order, allCookies() is sorted by it
+        QNetworkCookie cookie;
+    };
+
+    static QString indexKey(const QString &domain);
+    QList<QNetworkCookie> allCookies() const;
+    void setAllCookies(const QList<QNetworkCookie> &cookieList);
+    void append(const QNetworkCookie &cookie);
+    bool remove(const QNetworkCookie &cookie);
+
+    // the cookies keyed by their domain without the leading dot, so that
+    // cookiesForUrl() only needs to look at the host and its parent domains
+    QHash<QString, QList<IndexedCookie>> cookiesByDomain;
+    quint64 nextSerial = 0;
+    qsizetype cookieCount = 0;
 
     Q_DECLARE_PUBLIC(QNetworkCookieJar)
 };
+Q_DECLARE_TYPEINFO(QNetworkCookieJarPrivate::IndexedCookie, Q_MOVABLE_TYPE);
 
 QT_END_NAMESPACE
 
@@ -53,6 +53,9 @@
 #include <qcryptographichash.h>
 #include <qdebug.h>
 
+#include <algorithm>
+#include <vector>
+
 #define CACHE_POSTFIX QLatin1String(".d")
 #define PREPARED_SLASH QLatin1String("prepared/")
 #define CACHE_VERSION 8
@@ -150,6 +153,7 @@ void QNetworkDiskCache::setCacheDirectory(const QString &cacheDir)
 
     d->dataDirectory = d->cacheDirectory + DATA_DIR + QString::number(CACHE_VERSION) + QLatin1Char('/');
     d->prepareLayout();
+    d->invalidateIndex();
 }
 
 /*!
@@ -275,6 +279,7 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
             qWarning() << "QNetworkDiskCache: couldn't remove the cache file " << fileName;
             return;
         }
+        index.remove(fileName);
     }
 
     if (currentCacheSize > 0)
@@ -294,9 +299,10 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
         && cacheItem->file->error() == QFile::NoError) {
         cacheItem->file->setAutoRemove(false);
         // ### use atomic rename rather then remove & rename
-        if (cacheItem->file->rename(fileName))
+        if (cacheItem->file->rename(fileName)) {
             currentCacheSize += cacheItem->file->size();
-        else
+            indexFile(fileName, cacheItem->file->size());
+        } else
             cacheItem->file->setAutoRemove(true);
     }
     if (cacheItem->metaData.url() == lastItem.metaData.url())
@@ -345,6 +351,7 @@ bool QNetworkDiskCachePrivate::removeFile(const QString &file)
     qint64 size = info.size();
     if (QFile::remove(file)) {
         currentCacheSize -= size;
+        index.remove(file);
         return true;
     }
     return false;
@@ -431,6 +438,7 @@ QIODevice *QNetworkDiskCache::data(const QUrl &url)
             }
         }
     }
+    d->touchFile(d->cacheFileName(url));
     buffer->open(QBuffer::ReadOnly);
     return buffer.take();
 }
@@ -501,17 +509,20 @@ void QNetworkDiskCache::setMaximumCacheSize(qint64 size)
 
     When the current size of the cache is greater than the maximumCacheSize()
     older cache files are removed until the total size is less then 90% of
-    maximumCacheSize() starting with the oldest ones first using the file
-    creation date to determine how old a cache file is.
+    maximumCacheSize() starting with the least recently used ones first. Files
+    that have not been accessed since the cache directory was set are ordered
+    by their creation date.
+
+    The cache directory is only scanned the first time this function needs to
+    know about the files on disk; afterwards QNetworkDiskCache keeps track of
+    the files it writes, reads and removes itself.
 
     Subclasses can reimplement this function to change the order that cache
     files are removed taking into account information in the application
     knows about that QNetworkDiskCache does not, for example the number of times
     a cache is accessed.
 
-    \note cacheSize() calls expire if the current cache size is unknown.
 
-    \sa maximumCacheSize(), fileMetaData()
  */
 qint64 QNetworkDiskCache::expire()
 {
@@ -527,58 +538,127 @@ qint64 QNetworkDiskCache::expire()
     // close file handle to prevent "in use" error when QFile::remove() is called
     d->lastItem.reset();
 
-    QDir::Filters filters = QDir::AllDirs | QDir:: Files | QDir::NoDotAndDotDot;
-    QDirIterator it(cacheDirectory(), filters, QDirIterator::Subdirectories);
+    if (!d->indexValid)
+        d->buildIndex();
 
-    QMultiMap<QDateTime, QString> cacheItems;
+    struct Candidate {
+        qint64 lastAccess;
+        qint64 size;
+        QString fileName;
+    };
+    std::vector<Candidate> cacheItems;
+    cacheItems.reserve(d->index.size());
     qint64 totalSize = 0;
-    while (it.hasNext()) {
-        QString path = it.next();
-        QFileInfo info = it.fileInfo();
-        QString fileName = info.fileName();
-        if (fileName.endsWith(CACHE_POSTFIX)) {
-            const QDateTime birthTime = info.fileTime(QFile::FileBirthTime);
-            cacheItems.insert(birthTime.isValid() ? birthTime
-                              : info.fileTime(QFile::FileMetadataChangeTime), path);
-            totalSize += info.size();
-        }
+    for (auto it = d->index.cbegin(), end = d->index.cend(); it != end; ++it) {
+        cacheItems.push_back({ it.value().lastAccess, it.value().size, it.key() });
+        totalSize += it.value().size;
+    }
+    for (const QCacheItem *item : qAsConst(d->inserting)) {
+        if (item && item->file)
+            totalSize += item->file->size();
     }
+    std::sort(cacheItems.begin(), cacheItems.end(), [](const Candidate &lhs, const Candidate &rhs) {
+        return lhs.lastAccess < rhs.lastAccess;
+    });
 
     int removedFiles = 0;
     qint64 goal = (maximumCacheSize() * 9) / 10;
-    QMultiMap<QDateTime, QString>::const_iterator i = cacheItems.constBegin();
-    while (i != cacheItems.constEnd()) {
+    for (const Candidate &candidate : cacheItems) {
         if (totalSize < goal)
             break;
-        QString name = i.value();
-        QFile file(name);
-
-        if (name.contains(PREPARED_SLASH)) {
-            for (QCacheItem *item : qAsConst(d->inserting)) {
-                if (item && item->file && item->file->fileName() == name) {
-                    delete item->file;
-                    item->file = nullptr;
-                    break;
-                }
-            }
-        }
-
-        qint64 size = file.size();
-        file.remove();
-        totalSize -= size;
+        QFile::remove(candidate.fileName);
+        d->index.remove(candidate.fileName);
+        totalSize -= candidate.size;
         ++removedFiles;
-        ++i;
+    }
+
+    // files that are still being written to are the newest of all, so they
+    // are only dropped when removing everything else did not free enough space
+    for (QCacheItem *item : qAsConst(d->inserting)) {
+        if (totalSize < goal)
+            break;
+        if (item && item->file) {
+            totalSize -= item->file->size();
+            delete item->file;
+            item->file = nullptr;
+            ++removedFiles;
+        }
     }
 #if defined(QNETWORKDISKCACHE_DEBUG)
     if (removedFiles > 0) {
         qDebug() << "QNetworkDiskCache::expire()"
                 << "Removed:" << removedFiles
-                << "Kept:" << cacheItems.count() - removedFiles;
+                << "Kept:" << d->index.count();
     }
+#else
+    Q_UNUSED(removedFiles);
 #endif
     return totalSize;
 }
 
+/*!
+    Scans the cache directory once and records every cache file in the
+    index. Files that are still being written to are left out; they are
+    added once they are stored.
+ */
+void QNetworkDiskCachePrivate::buildIndex()
+{
+    index.clear();
+
+    QDir::Filters filters = QDir::AllDirs | QDir:: Files | QDir::NoDotAndDotDot;
+    QDirIterator it(cacheDirectory, filters, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QString path = it.next();
+        QFileInfo info = it.fileInfo();
+        QString fileName = info.fileName();
+        if (!fileName.endsWith(CACHE_POSTFIX))
+            continue;
+        if (path.contains(PREPARED_SLASH)) {
+            const auto isInserting = [&path](const QCacheItem *item) {
+                return item && item->file && item->file->fileName() == path;
+            };
+            if (std::any_of(inserting.cbegin(), inserting.cend(), isInserting))
+                continue;
+        }
+        const QDateTime birthTime = info.fileTime(QFile::FileBirthTime);
+        const qint64 created = (birthTime.isValid() ? birthTime
+                                : info.fileTime(QFile::FileMetadataChangeTime)).toMSecsSinceEpoch();
+        index.insert(path, { info.size(), created });
+        lastAccessStamp = qMax(lastAccessStamp, created);
+    }
+    indexValid = true;
+}
+
+void QNetworkDiskCachePrivate::invalidateIndex()
+{
+    index.clear();
+    indexValid = false;
+    currentCacheSize = -1;
+}
+
+void QNetworkDiskCachePrivate::indexFile(const QString &fileName, qint64 size)
+{
+    if (indexValid)
+        index.insert(fileName, { size, nextAccessStamp() });
+}
+
+void QNetworkDiskCachePrivate::touchFile(const QString &fileName)
+{
+    const auto it = index.find(fileName);
+    if (it != index.end())
+        it->lastAccess = nextAccessStamp();
+}
+
+/*!
+    Returns a strictly increasing access time, so that entries used in
+    quick succession still expire in the order they were used.
+ */
+qint64 QNetworkDiskCachePrivate::nextAccessStamp()
+{
+    lastAccessStamp = qMax(QDateTime::currentMSecsSinceEpoch(), lastAccessStamp + 1);
+    return lastAccessStamp;
+}
+
 /*!
     \reimp
 */
@@ -94,6 +94,13 @@ public:
     bool canCompress() const;
 };
 
+struct QCacheIndexEntry
+{
+    qint64 size;
+    qint64 lastAccess;
+};
+Q_DECLARE_TYPEINFO(QCacheIndexEntry, Q_PRIMITIVE_TYPE);
+
 class QNetworkDiskCachePrivate : public QAbstractNetworkCachePrivate
 {
 public:
@@ -101,6 +108,8 @@ public:
         : QAbstractNetworkCachePrivate()
         , maximumCacheSize(1024 * 1024 * 50)
         , currentCacheSize(-1)
+        , lastAccessStamp(0)
+        , indexValid(false)
         {}
 
     static QString uniqueFileName(const QUrl &url);
@@ -111,6 +120,12 @@ public:
     void prepareLayout();
     static quint32 crc32(const char *data, uint len);
 
+    void buildIndex();
+    void invalidateIndex();
+    void indexFile(const QString &fileName, qint64 size);
+    void touchFile(const QString &fileName);
+    qint64 nextAccessStamp();
+
     mutable QCacheItem lastItem;
     QString cacheDirectory;
     QString dataDirectory;
@@ -118,6 +133,12 @@ public:
     qint64 currentCacheSize;
 
     QHash<QIODevice*, QCacheItem*> inserting;
+
+    // all cache files on disk, keyed by their path, so that expire() does
+    // not have to walk the cache directory every time it is called
+    QHash<QString, QCacheIndexEntry> index;
+    qint64 lastAccessStamp;
+    bool indexValid;
     Q_DECLARE_PUBLIC(QNetworkDiskCache)
 };
 
@@ -691,6 +691,21 @@ QVariant QNetworkReply::attribute(QNetworkRequest::Attribute code) const
     return d_func()->attributes.value(code);
 }
 
+/*!
+    \since 6.0
+
+    Returns the timing breakdown of this reply: when the host name lookup,
+    the connection setup, the request and the response happened. Some
+    milestones are only filled in as the request progresses, so the returned
+    object is complete only after finished() has been emitted.
+
+    \sa QNetworkReplyTimings
+*/
+QNetworkReplyTimings QNetworkReply::timings() const
+{
+    return d_func()->timings;
+}
+
 #if QT_CONFIG(ssl)
 /*!
     Returns the SSL configuration and state associated with this
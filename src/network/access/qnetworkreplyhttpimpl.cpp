@@ -60,6 +60,9 @@
 
 #include "qnetworkcookiejar.h"
 #include "qnetconmonitor_p.h"
+#include "qnetworkreplytimings_p.h"
+
+#include <qtnetwork_tracepoints_p.h>
 
 #include <string.h>             // for strchr
 
@@ -179,6 +182,7 @@ QNetworkReplyHttpImpl::QNetworkReplyHttpImpl(QNetworkAccessManager* const manage
     d->operation = operation;
     d->outgoingData = outgoingData;
     d->url = request.url();
+    QNetworkReplyTimingsPrivate::record(d->timings, QNetworkReplyTimings::RequestStart);
 #ifndef QT_NO_SSL
     if (request.url().scheme() == QLatin1String("https"))
         d->sslConfiguration.reset(new QSslConfiguration(request.sslConfiguration()));
@@ -615,9 +619,9 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
         QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
         thread->start();
     } else {
-        // We use the manager-global thread.
-        // At some point we could switch to having multiple threads if it makes sense.
-        thread = managerPrivate->createThread();
+        // We use the manager-global thread, or one of the manager's HTTP
+        // threads if it has more than one.
+        thread = managerPrivate->createHttpThread(newHttpRequest.url());
     }
 
     QUrl url = newHttpRequest.url();
@@ -774,7 +778,8 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
 
     // Create the HTTP thread delegate
     QHttpThreadDelegate *delegate = new QHttpThreadDelegate;
-    // Propagate Http/2 settings:
+    // Propagate Http/1 and Http/2 settings:
+    delegate->http1Parameters = request.http1Configuration();
     delegate->http2Parameters = request.http2Configuration();
 
     // For the synchronous HTTP, this is the normal way the delegate gets deleted
@@ -835,6 +840,9 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
         QObject::connect(delegate, SIGNAL(downloadProgress(qint64,qint64)),
                 q, SLOT(replyDownloadProgressSlot(qint64,qint64)),
                 Qt::QueuedConnection);
+        QObject::connect(delegate, SIGNAL(timingsChanged(QNetworkReplyTimings)),
+                q, SLOT(replyTimingsChanged(QNetworkReplyTimings)),
+                Qt::QueuedConnection);
         QObject::connect(delegate, SIGNAL(error(QNetworkReply::NetworkError,QString)),
                 q, SLOT(httpError(QNetworkReply::NetworkError,QString)),
                 Qt::QueuedConnection);
@@ -930,6 +938,7 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
     // Send an signal to the delegate so it starts working in the other thread
     if (synchronous) {
         emit q->startHttpRequestSynchronously(); // This one is BlockingQueuedConnection, so it will return when all work is done
+        replyTimingsChanged(delegate->incomingTimings);
 
         if (delegate->incomingErrorCode != QNetworkReply::NoError) {
             replyDownloadMetaData
@@ -1197,6 +1206,10 @@ void QNetworkReplyHttpImplPrivate::followRedirect()
 
     if (managerPrivate->thread)
         managerPrivate->thread->disconnect();
+    for (QThread *httpThread : qAsConst(managerPrivate->httpThreads)) {
+        if (httpThread)
+            httpThread->disconnect();
+    }
 
     QMetaObject::invokeMethod(
             q, [this]() { postRequest(redirectRequest); }, Qt::QueuedConnection);
@@ -1332,6 +1345,12 @@ void QNetworkReplyHttpImplPrivate::replyDownloadMetaData(const QList<QPair<QByte
     _q_metaDataChanged();
 }
 
+void QNetworkReplyHttpImplPrivate::replyTimingsChanged(const QNetworkReplyTimings &httpTimings)
+{
+    // keep our RequestStart, which also covers earlier redirects
+    QNetworkReplyTimingsPrivate::merge(timings, httpTimings);
+}
+
 void QNetworkReplyHttpImplPrivate::replyDownloadProgressSlot(qint64 bytesReceived,  qint64 bytesTotal)
 {
     Q_Q(QNetworkReplyHttpImpl);
@@ -1998,6 +2017,15 @@ void QNetworkReplyHttpImplPrivate::finished()
     state = Finished;
     q->setFinished(true);
 
+    QNetworkReplyTimingsPrivate::record(timings, QNetworkReplyTimings::ResponseEnd);
+    Q_TRACE(QNetworkReplyHttpImpl_finished, url,
+            timings.nsecsBetween(QNetworkReplyTimings::DomainLookupStart, QNetworkReplyTimings::DomainLookupEnd),
+            timings.nsecsBetween(QNetworkReplyTimings::ConnectStart, QNetworkReplyTimings::ConnectEnd),
+            timings.nsecsBetween(QNetworkReplyTimings::SecureConnectionStart, QNetworkReplyTimings::ConnectEnd),
+            timings.nsecsBetween(QNetworkReplyTimings::RequestSent, QNetworkReplyTimings::ResponseStart),
+            timings.nsecsBetween(QNetworkReplyTimings::ResponseStart, QNetworkReplyTimings::ResponseEnd),
+            timings.nsecsSinceStart(QNetworkReplyTimings::ResponseEnd));
+
     if (totalSize.isNull() || totalSize == -1) {
         emit q->downloadProgress(bytesDownloaded, bytesDownloaded);
     } else {
@@ -0,0 +1,215 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qnetworkreplytimings.h"
+#include "qnetworkreplytimings_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QNetworkReplyTimings
+    \brief The QNetworkReplyTimings class holds the timing breakdown of a network request.
+    \since 6.0
+
+    \reentrant
+    \inmodule QtNetwork
+    \ingroup network
+    \ingroup shared
+
+    QNetworkReplyTimings records when a request that was sent through
+    QNetworkAccessManager reached the different stages of its life time,
+    modeled after the \l{https://www.w3.org/TR/resource-timing-2/}
+    {W3C Resource Timing} API. The milestones are measured with a monotonic
+    clock and are reported in nanoseconds relative to
+    QNetworkReplyTimings::RequestStart.
+
+    Milestones that a request did not go through are not recorded: if the
+    request was sent over a connection that had already been established
+    for an earlier request, there are no DNS, connect or TLS milestones, and
+    a reply that was loaded from the cache has only RequestStart and
+    ResponseEnd.
+
+    Currently only HTTP and HTTPS replies record their timings.
+
+    \sa QNetworkReply::timings()
+*/
+
+/*!
+    \enum QNetworkReplyTimings::Milestone
+
+    \value RequestStart The request was handed to QNetworkAccessManager.
+    \value DomainLookupStart A host name lookup for a new connection started.
+    \value DomainLookupEnd The host name lookup finished.
+    \value ConnectStart A new connection to the server was started.
+    \value SecureConnectionStart The TCP connection was established and the
+           TLS handshake started.
+    \value ConnectEnd The connection, including the TLS handshake if any,
+           was established.
+    \value RequestSent The request, including its body, was handed to the
+           socket.
+    \value ResponseStart The first byte of the response arrived.
+    \value ResponseEnd The last byte of the response arrived.
+*/
+
+/*!
+    Default constructs a QNetworkReplyTimings object without any milestones.
+*/
+QNetworkReplyTimings::QNetworkReplyTimings()
+    : d(new QNetworkReplyTimingsPrivate)
+{
+}
+
+/*!
+    Copy-constructs this QNetworkReplyTimings.
+*/
+QNetworkReplyTimings::QNetworkReplyTimings(const QNetworkReplyTimings &) = default;
+
+/*!
+    Move-constructs this QNetworkReplyTimings from \a other
+*/
+QNetworkReplyTimings::QNetworkReplyTimings(QNetworkReplyTimings &&other) noexcept
+{
+    swap(other);
+}
+
+/*!
+    Copy-assigns to this QNetworkReplyTimings.
+*/
+QNetworkReplyTimings &QNetworkReplyTimings::operator=(const QNetworkReplyTimings &) = default;
+
+/*!
+    Move-assigns to this QNetworkReplyTimings.
+*/
+QNetworkReplyTimings &QNetworkReplyTimings::operator=(QNetworkReplyTimings &&) noexcept = default;
+
+/*!
+    Destructor.
+*/
+QNetworkReplyTimings::~QNetworkReplyTimings()
+{
+}
+
+/*!
+    Returns \c true if the RequestStart milestone was recorded, so that the
+    other milestones can be related to it.
+*/
+bool QNetworkReplyTimings::isValid() const
+{
+    return hasMilestone(RequestStart);
+}
+
+/*!
+    Returns \c true if the request reached \a milestone.
+*/
+bool QNetworkReplyTimings::hasMilestone(Milestone milestone) const
+{
+    return d->timestamps[milestone] != -1;
+}
+
+/*!
+    Returns the number of nanoseconds between RequestStart and \a milestone,
+    or -1 if either of them was not recorded.
+*/
+qint64 QNetworkReplyTimings::nsecsSinceStart(Milestone milestone) const
+{
+    return nsecsBetween(RequestStart, milestone);
+}
+
+/*!
+    Returns the number of nanoseconds between \a from and \a to, or -1 if
+    either of them was not recorded.
+
+    For example, \c{nsecsBetween(RequestSent, ResponseStart)} is the time the
+    server took to answer, and \c{nsecsBetween(ResponseStart, ResponseEnd)}
+    the time spent downloading the content.
+*/
+qint64 QNetworkReplyTimings::nsecsBetween(Milestone from, Milestone to) const
+{
+    if (!hasMilestone(from) || !hasMilestone(to))
+        return -1;
+    return qMax(qint64(0), d->timestamps[to] - d->timestamps[from]);
+}
+
+/*!
+    Swaps this timings object with \a other
+*/
+void QNetworkReplyTimings::swap(QNetworkReplyTimings &other) noexcept
+{
+    d.swap(other.d);
+}
+
+void QNetworkReplyTimingsPrivate::record(QNetworkReplyTimings &timings,
+                                         QNetworkReplyTimings::Milestone milestone)
+{
+    if (!timings.hasMilestone(milestone))
+        timings.d->timestamps[milestone] = now();
+}
+
+void QNetworkReplyTimingsPrivate::update(QNetworkReplyTimings &timings,
+                                         QNetworkReplyTimings::Milestone milestone)
+{
+    timings.d->timestamps[milestone] = now();
+}
+
+void QNetworkReplyTimingsPrivate::reset(QNetworkReplyTimings &timings,
+                                        QNetworkReplyTimings::Milestone milestone)
+{
+    if (timings.hasMilestone(milestone))
+        timings.d->timestamps[milestone] = -1;
+}
+
+void QNetworkReplyTimingsPrivate::copyConnectionMilestones(QNetworkReplyTimings &to,
+                                                           const QNetworkReplyTimings &from)
+{
+    for (int i = QNetworkReplyTimings::DomainLookupStart; i <= QNetworkReplyTimings::ConnectEnd; ++i) {
+        if (from.d->timestamps[i] != -1)
+            to.d->timestamps[i] = from.d->timestamps[i];
+    }
+}
+
+void QNetworkReplyTimingsPrivate::merge(QNetworkReplyTimings &to, const QNetworkReplyTimings &from)
+{
+    for (int i = QNetworkReplyTimings::RequestStart + 1; i < MilestoneCount; ++i) {
+        if (from.d->timestamps[i] != -1)
+            to.d->timestamps[i] = from.d->timestamps[i];
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QNETWORKREPLYTIMINGS_H
+#define QNETWORKREPLYTIMINGS_H
+
+#include <QtNetwork/qtnetworkglobal.h>
+
+#include <QtCore/qshareddata.h>
+#include <QtCore/qmetatype.h>
+
+QT_BEGIN_NAMESPACE
+
+class QNetworkReplyTimingsPrivate;
+class Q_NETWORK_EXPORT QNetworkReplyTimings
+{
+public:
+    enum Milestone {
+        RequestStart,
+        DomainLookupStart,
+        DomainLookupEnd,
+        ConnectStart,
+        SecureConnectionStart,
+        ConnectEnd,
+        RequestSent,
+        ResponseStart,
+        ResponseEnd
+    };
+
+    QNetworkReplyTimings();
+    QNetworkReplyTimings(const QNetworkReplyTimings &other);
+    QNetworkReplyTimings(QNetworkReplyTimings &&other) noexcept;
+    QNetworkReplyTimings &operator = (const QNetworkReplyTimings &other);
+    QNetworkReplyTimings &operator = (QNetworkReplyTimings &&other) noexcept;
+
+    ~QNetworkReplyTimings();
+
+    bool isValid() const;
+    bool hasMilestone(Milestone milestone) const;
+    qint64 nsecsSinceStart(Milestone milestone) const;
+    qint64 nsecsBetween(Milestone from, Milestone to) const;
+
+    void swap(QNetworkReplyTimings &other) noexcept;
+
+private:
+    friend class QNetworkReplyTimingsPrivate;
+
+    QSharedDataPointer<QNetworkReplyTimingsPrivate> d;
+};
+
+Q_DECLARE_SHARED(QNetworkReplyTimings)
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QNetworkReplyTimings)
+
+#endif // QNETWORKREPLYTIMINGS_H
@@ -0,0 +1,92 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QNETWORKREPLYTIMINGS_P_H
+#define QNETWORKREPLYTIMINGS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the Network Access API.  This header file may change from
+// version to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtNetwork/private/qtnetworkglobal_p.h>
+#include "qnetworkreplytimings.h"
+
+#include <QtCore/qdeadlinetimer.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+class QNetworkReplyTimingsPrivate : public QSharedData
+{
+public:
+    enum { MilestoneCount = QNetworkReplyTimings::ResponseEnd + 1 };
+
+    QNetworkReplyTimingsPrivate()
+    {
+        std::fill(std::begin(timestamps), std::end(timestamps), qint64(-1));
+    }
+
+    // monotonic clock shared by all threads, in nanoseconds
+    static qint64 now() { return QDeadlineTimer::current(Qt::PreciseTimer).deadlineNSecs(); }
+
+    // Records \a milestone at the current time, unless it was recorded already
+    static void record(QNetworkReplyTimings &timings, QNetworkReplyTimings::Milestone milestone);
+    // Unconditionally sets \a milestone to the current time
+    static void update(QNetworkReplyTimings &timings, QNetworkReplyTimings::Milestone milestone);
+    static void reset(QNetworkReplyTimings &timings, QNetworkReplyTimings::Milestone milestone);
+    // Copies the DNS and connect milestones of a connection into a reply
+    static void copyConnectionMilestones(QNetworkReplyTimings &to, const QNetworkReplyTimings &from);
+    // Copies all milestones that are set in \a from into \a to, except RequestStart
+    static void merge(QNetworkReplyTimings &to, const QNetworkReplyTimings &from);
+
+    qint64 timestamps[MilestoneCount];
+};
+
+QT_END_NAMESPACE
+
+#endif // QNETWORKREPLYTIMINGS_P_H
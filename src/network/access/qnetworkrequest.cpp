@@ -43,6 +43,7 @@
 #include "qnetworkcookie.h"
 #include "qsslconfiguration.h"
 #if QT_CONFIG(http) || defined(Q_CLANG_QDOC)
+#include "qhttp1configuration.h"
 #include "qhttp2configuration.h"
 #include "private/http2protocol_p.h"
 #endif
@@ -439,6 +440,7 @@ public:
 #endif
         peerVerifyName = other.peerVerifyName;
 #if QT_CONFIG(http)
+        h1Configuration = other.h1Configuration;
         h2Configuration = other.h2Configuration;
 #endif
         transferTimeout = other.transferTimeout;
@@ -453,6 +455,7 @@ public:
             maxRedirectsAllowed == other.maxRedirectsAllowed &&
             peerVerifyName == other.peerVerifyName
 #if QT_CONFIG(http)
+            && h1Configuration == other.h1Configuration
             && h2Configuration == other.h2Configuration
 #endif
             && transferTimeout == other.transferTimeout
@@ -468,6 +471,7 @@ public:
     int maxRedirectsAllowed;
     QString peerVerifyName;
 #if QT_CONFIG(http)
+    QHttp1Configuration h1Configuration;
     QHttp2Configuration h2Configuration;
 #endif
     int transferTimeout;
@@ -852,6 +856,36 @@ void QNetworkRequest::setPeerVerifyName(const QString &peerName)
 }
 
 #if QT_CONFIG(http) || defined(Q_CLANG_QDOC)
+/*!
+    \since 6.0
+
+    Returns the current parameters that QNetworkAccessManager is
+    using for the underlying HTTP/1 connection of this request.
+
+    \sa setHttp1Configuration
+*/
+QHttp1Configuration QNetworkRequest::http1Configuration() const
+{
+    return d->h1Configuration;
+}
+
+/*!
+    \since 6.0
+
+    Sets request's HTTP/1 parameters from \a configuration.
+
+    \note The configuration must be set prior to making a request.
+    \note Requests to the same host share a set of connections only
+    if they ask for the same number of connections per host; a request
+    with a different number gets a set of connections of its own.
+
+    \sa http1Configuration, QNetworkAccessManager, QHttp1Configuration
+*/
+void QNetworkRequest::setHttp1Configuration(const QHttp1Configuration &configuration)
+{
+    d->h1Configuration = configuration;
+}
+
 /*!
     \since 5.14
 
@@ -49,6 +49,7 @@
 QT_BEGIN_NAMESPACE
 
 class QSslConfiguration;
+class QHttp1Configuration;
 class QHttp2Configuration;
 
 class QNetworkRequestPrivate;
@@ -177,6 +178,9 @@ public:
     QString peerVerifyName() const;
     void setPeerVerifyName(const QString &peerName);
 #if QT_CONFIG(http) || defined(Q_CLANG_QDOC)
+    QHttp1Configuration http1Configuration() const;
+    void setHttp1Configuration(const QHttp1Configuration &configuration);
+
     QHttp2Configuration http2Configuration() const;
     void setHttp2Configuration(const QHttp2Configuration &configuration);
 #endif // QT_CONFIG(http) || defined(Q_CLANG_QDOC)
@@ -824,7 +824,10 @@ int QHostInfo::lookupHostImpl(const QString &name,
         if (manager->cache.isEnabled()) {
             // check cache first
             bool valid = false;
-            QHostInfo info = manager->cache.get(name, &valid);
+            bool needsRefresh = false;
+            QHostInfo info = manager->cache.get(name, &valid, &needsRefresh);
+            if (needsRefresh)
+                manager->scheduleRefresh(name);
             if (valid) {
                 info.setLookupId(id);
                 QHostInfoResult result(receiver, slotObj);
@@ -868,9 +871,10 @@ void QHostInfoRunnable::run()
     // it here too because it might have been cache saved by another QHostInfoRunnable
     // in the meanwhile while this QHostInfoRunnable was scheduled but not running
     if (manager->cache.isEnabled()) {
-        // check the cache first
+        // check the cache first, unless we were started to freshen it
         bool valid = false;
-        hostInfo = manager->cache.get(toBeLookedUp, &valid);
+        if (!refresh)
+            hostInfo = manager->cache.get(toBeLookedUp, &valid);
         if (!valid) {
             // not in cache, we need to do the lookup and store the result in the cache
             hostInfo = QHostInfoAgent::fromName(toBeLookedUp);
@@ -1020,6 +1024,17 @@ void QHostInfoLookupManager::scheduleLookup(QHostInfoRunnable *r)
     rescheduleWithMutexHeld();
 }
 
+// called by QHostInfo when a cached entry is about to expire
+void QHostInfoLookupManager::scheduleRefresh(const QString &name)
+{
+    // nobody is waiting for the result: the runnable only puts the fresh
+    // answer into the cache, so that callers keep getting hits instead of
+    // all blocking on a new lookup once the entry has expired
+    QHostInfoRunnable *runnable = new QHostInfoRunnable(name, nextId(), nullptr, nullptr);
+    runnable->refresh = true;
+    scheduleLookup(runnable);
+}
+
 // called by QHostInfo
 void QHostInfoLookupManager::abortLookup(int id)
 {
@@ -1085,7 +1100,10 @@ QHostInfo qt_qhostinfo_lookup(const QString &name, QObject *receiver, const char
     // check cache
     QHostInfoLookupManager* manager = theHostInfoLookupManager();
     if (manager && manager->cache.isEnabled()) {
-        QHostInfo info = manager->cache.get(name, valid);
+        bool needsRefresh = false;
+        QHostInfo info = manager->cache.get(name, valid, &needsRefresh);
+        if (needsRefresh)
+            manager->scheduleRefresh(name);
         if (*valid) {
             return info;
         }
@@ -1123,30 +1141,48 @@ void qt_qhostinfo_cache_inject(const QString &hostname, const QHostInfo &resolut
 
     manager->cache.put(hostname, resolution);
 }
+
+void qt_qhostinfo_set_cache_ages(int maxAge, int refreshAge)
+{
+    QHostInfoLookupManager* manager = theHostInfoLookupManager();
+    if (manager)
+        manager->cache.setAges(maxAge, refreshAge);
+}
 #endif
 
-// cache for 60 seconds
+// cache for 60 seconds, start refreshing after 45 seconds
 // cache 128 items
-QHostInfoCache::QHostInfoCache() : max_age(60), enabled(true), cache(128)
+QHostInfoCache::QHostInfoCache()
+    : max_age(60 * 1000), refresh_age(45 * 1000), enabled(true), cache(128)
 {
 #ifdef QT_QHOSTINFO_CACHE_DISABLED_BY_DEFAULT
     enabled.store(false, std::memory_order_relaxed);
 #endif
 }
 
-QHostInfo QHostInfoCache::get(const QString &name, bool *valid)
+/*
+    Returns the cached result for \a name and sets \a valid if it has not
+    expired yet. If \a needsRefresh is given, it is set to true, once per
+    entry, when the entry is still valid but older than refresh_age; the
+    caller is then expected to schedule a lookup that freshens the cache.
+*/
+QHostInfo QHostInfoCache::get(const QString &name, bool *valid, bool *needsRefresh)
 {
     QMutexLocker locker(&this->mutex);
 
     *valid = false;
+    if (needsRefresh)
+        *needsRefresh = false;
     if (QHostInfoCacheElement *element = cache.object(name)) {
-        if (element->age.elapsed() < max_age*1000)
+        const qint64 age = element->age.elapsed();
+        if (age < max_age) {
             *valid = true;
+            if (needsRefresh && age >= refresh_age && !element->refreshScheduled) {
+                element->refreshScheduled = true;
+                *needsRefresh = true;
+            }
+        }
         return element->info;
-
-        // FIXME idea:
-        // if too old but not expired, trigger a new lookup
-        // to freshen our cache
     }
 
     return QHostInfo();
@@ -1167,6 +1203,14 @@ void QHostInfoCache::put(const QString &name, const QHostInfo &info)
     cache.insert(name, element); // cache will take ownership
 }
 
+// this function is currently only used for the auto tests
+void QHostInfoCache::setAges(int maxAge, int refreshAge)
+{
+    QMutexLocker locker(&this->mutex);
+    max_age = maxAge;
+    refresh_age = refreshAge;
+}
+
 void QHostInfoCache::clear()
 {
     QMutexLocker locker(&this->mutex);
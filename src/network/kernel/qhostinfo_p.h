@@ -150,14 +150,14 @@ QHostInfo Q_NETWORK_EXPORT qt_qhostinfo_lookup(const QString &name, QObject *rec
 void Q_AUTOTEST_EXPORT qt_qhostinfo_clear_cache();
 void Q_AUTOTEST_EXPORT qt_qhostinfo_enable_cache(bool e);
 void Q_AUTOTEST_EXPORT qt_qhostinfo_cache_inject(const QString &hostname, const QHostInfo &resolution);
+void Q_AUTOTEST_EXPORT qt_qhostinfo_set_cache_ages(int maxAge, int refreshAge);
 
 class QHostInfoCache
 {
 public:
     QHostInfoCache();
-    const int max_age; // seconds
 
-    QHostInfo get(const QString &name, bool *valid);
+    QHostInfo get(const QString &name, bool *valid, bool *needsRefresh = nullptr);
     void put(const QString &name, const QHostInfo &info);
     void clear();
 
@@ -165,11 +165,15 @@ public:
     // this function is currently only used for the auto tests
     // and not usable by public API
     void setEnabled(bool e) { enabled.store(e, std::memory_order_relaxed); }
+    void setAges(int maxAge, int refreshAge);
 private:
+    int max_age; // milliseconds
+    int refresh_age; // milliseconds
     std::atomic<bool> enabled;
     struct QHostInfoCacheElement {
         QHostInfo info;
         QElapsedTimer age;
+        bool refreshScheduled = false;
     };
     QCache<QString,QHostInfoCacheElement> cache;
     QMutex mutex;
@@ -186,6 +190,7 @@ public:
 
     QString toBeLookedUp;
     int id;
+    bool refresh = false; // bypass the cache, only update it
     QHostInfoResult resultEmitter;
 };
 
@@ -200,6 +205,7 @@ public:
 
     // called from QHostInfo
     void scheduleLookup(QHostInfoRunnable *r);
+    void scheduleRefresh(const QString &name);
     void abortLookup(int id);
 
     // called from QHostInfoRunnable
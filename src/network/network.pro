@@ -14,6 +14,9 @@ msvc:equals(QT_ARCH, i386): QMAKE_LFLAGS += /BASE:0x64000000
 
 QMAKE_DOCS = $$PWD/doc/qtnetwork.qdocconf
 
+TRACEPOINT_PROVIDER = $$PWD/qtnetwork.tracepoints
+CONFIG += qt_tracepoints
+
 include(access/access.pri)
 include(kernel/kernel.pri)
 include(socket/socket.pri)
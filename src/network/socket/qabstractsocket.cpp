@@ -219,6 +219,27 @@
     \sa error(), errorString(), {Creating Custom Qt Types}
 */
 
+/*!
+    \fn void QAbstractSocket::writeBufferFull()
+    \since 6.0
+
+    This signal is emitted when the data waiting to be written reaches
+    writeBufferSize() bytes. It is not emitted again before
+    writeBufferDrained() was emitted.
+
+    \sa setWriteBufferSize(), bytesToWrite()
+*/
+
+/*!
+    \fn void QAbstractSocket::writeBufferDrained()
+    \since 6.0
+
+    This signal is emitted after writeBufferFull(), when the data waiting
+    to be written has dropped to writeBufferLowWaterMark() bytes.
+
+    \sa setWriteBufferLowWaterMark(), bytesWritten()
+*/
+
 /*!
     \fn void QAbstractSocket::stateChanged(QAbstractSocket::SocketState socketState)
 
@@ -470,6 +491,7 @@
 #include "private/qhostinfo_p.h"
 
 #include <qabstracteventdispatcher.h>
+#include <qfile.h>
 #include <qhostaddress.h>
 #include <qhostinfo.h>
 #include <qmetaobject.h>
@@ -480,6 +502,9 @@
 #include <qvarlengtharray.h>
 
 #include <private/qthread_p.h>
+#ifdef Q_OS_LINUX
+#include <private/qcore_unix_p.h>
+#endif
 
 #ifdef QABSTRACTSOCKET_DEBUG
 #include <qdebug.h>
@@ -500,6 +525,8 @@
 QT_BEGIN_NAMESPACE
 
 static const int DefaultConnectTimeout = 30000;
+// RFC 8305, section 5: "Connection Attempt Delay"
+static const int ConnectionAttemptDelay = 250;
 
 #if defined QABSTRACTSOCKET_DEBUG
 QT_BEGIN_INCLUDE_NAMESPACE
@@ -552,6 +579,33 @@ static bool isProxyError(QAbstractSocket::SocketError error)
     }
 }
 
+/*
+    Reorders \a addresses so that the address families alternate, starting
+    with the family of the first (most preferred) address, as recommended by
+    RFC 8305, section 4. The order within each family is kept.
+*/
+static QList<QHostAddress> interleaveAddressFamilies(const QList<QHostAddress> &addresses)
+{
+    if (addresses.size() < 3)
+        return addresses;
+
+    const QAbstractSocket::NetworkLayerProtocol preferred = addresses.first().protocol();
+    QList<QHostAddress> first;
+    QList<QHostAddress> second;
+    for (const QHostAddress &address : addresses)
+        (address.protocol() == preferred ? first : second).append(address);
+
+    QList<QHostAddress> result;
+    result.reserve(addresses.size());
+    for (qsizetype i = 0; i < qMax(first.size(), second.size()); ++i) {
+        if (i < first.size())
+            result.append(first.at(i));
+        if (i < second.size())
+            result.append(second.at(i));
+    }
+    return result;
+}
+
 /*! \internal
 
     Constructs a QAbstractSocketPrivate. Initializes all members.
@@ -568,9 +622,13 @@ QAbstractSocketPrivate::QAbstractSocketPrivate()
       socketEngine(nullptr),
       cachedSocketDescriptor(-1),
       readBufferMaxSize(0),
+      writeBufferMaxSize(0),
+      writeBufferLowWaterMark(0),
+      writeBufferAboveHighWater(false),
       isBuffered(false),
       hasPendingData(false),
       connectTimer(nullptr),
+      racingReceiver(this),
       hostLookupId(-1),
       socketType(QAbstractSocket::UnknownSocketType),
       state(QAbstractSocket::UnconnectedState),
@@ -587,6 +645,7 @@ QAbstractSocketPrivate::QAbstractSocketPrivate()
 */
 QAbstractSocketPrivate::~QAbstractSocketPrivate()
 {
+    releasePendingFile();
 }
 
 /*! \internal
@@ -600,6 +659,8 @@ void QAbstractSocketPrivate::resetSocketLayer()
 #endif
 
     hasPendingData = false;
+    releasePendingFile();
+    writeBufferAboveHighWater = false;
     if (socketEngine) {
         socketEngine->close();
         socketEngine->disconnect();
@@ -609,6 +670,21 @@ void QAbstractSocketPrivate::resetSocketLayer()
     }
     if (connectTimer)
         connectTimer->stop();
+    cancelRacingAttempt();
+}
+
+/*! \internal
+
+    Drops the file queued by QAbstractSocket::sendFile(), if any, and
+    closes the descriptor duplicated for it.
+*/
+void QAbstractSocketPrivate::releasePendingFile()
+{
+#ifdef Q_OS_LINUX
+    if (pendingFile.fd != -1)
+        qt_safe_close(pendingFile.fd);
+#endif
+    pendingFile = PendingFile();
 }
 
 /*! \internal
@@ -816,7 +892,9 @@ void QAbstractSocketPrivate::connectionNotification()
 
 /*! \internal
 
-    Writes one pending data block in the write buffer to the socket.
+    Writes one pending data block in the write buffer to the socket,
+    or the next part of the file queued by sendFile() once the data
+    written before it has gone out.
 
     It is usually invoked by canWriteNotification after one or more
     calls to write().
@@ -826,7 +904,7 @@ void QAbstractSocketPrivate::connectionNotification()
 bool QAbstractSocketPrivate::writeToSocket()
 {
     Q_Q(QAbstractSocket);
-    if (!socketEngine || !socketEngine->isValid() || (writeBuffer.isEmpty()
+    if (!socketEngine || !socketEngine->isValid() || (!hasPendingWrites()
         && socketEngine->bytesToWrite() == 0)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocketPrivate::writeToSocket() nothing to do: valid ? %s, writeBuffer.isEmpty() ? %s",
@@ -844,11 +922,23 @@ bool QAbstractSocketPrivate::writeToSocket()
         return false;
     }
 
-    qint64 nextSize = writeBuffer.nextDataBlockSize();
-    const char *ptr = writeBuffer.readPointer();
-
-    // Attempt to write it all in one chunk.
-    qint64 written = nextSize ? socketEngine->write(ptr, nextSize) : Q_INT64_C(0);
+    const bool sendingFile = hasPendingFile() && pendingFile.bufferedBefore == 0;
+    qint64 written;
+    if (sendingFile) {
+        written = socketEngine->sendFile(pendingFile.fd, pendingFile.offset, pendingFile.remaining);
+    } else {
+        // Hand several blocks to the engine at once, so that it can use a
+        // vectored write.
+        QByteArrayView blocks[16];
+        const int blockCount = writeBuffer.peekChunks(blocks, int(std::size(blocks)),
+                hasPendingFile() ? pendingFile.bufferedBefore : writeBuffer.size());
+        if (blockCount > 1)
+            written = socketEngine->writeChunks(blocks, blockCount);
+        else if (blockCount == 1)
+            written = socketEngine->write(blocks[0].data(), blocks[0].size());
+        else
+            written = 0;
+    }
     if (written < 0) {
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug() << "QAbstractSocketPrivate::writeToSocket() write error, aborting."
@@ -867,13 +957,22 @@ bool QAbstractSocketPrivate::writeToSocket()
 
     if (written > 0) {
         // Remove what we wrote so far.
-        writeBuffer.free(written);
+        if (sendingFile) {
+            pendingFile.offset += written;
+            pendingFile.remaining -= written;
+            if (!hasPendingFile())
+                releasePendingFile();
+        } else {
+            writeBuffer.free(written);
+            if (hasPendingFile())
+                pendingFile.bufferedBefore -= written;
+        }
 
         // Emit notifications.
         emitBytesWritten(written);
     }
 
-    if (writeBuffer.isEmpty() && socketEngine && !socketEngine->bytesToWrite())
+    if (!hasPendingWrites() && socketEngine && !socketEngine->bytesToWrite())
         socketEngine->setWriteNotificationEnabled(false);
     if (state == QAbstractSocket::ClosingState)
         q->disconnectFromHost();
@@ -891,7 +990,7 @@ bool QAbstractSocketPrivate::flush()
 {
     bool dataWasWritten = false;
 
-    while (!allWriteBuffersEmpty() && writeToSocket())
+    while ((!allWriteBuffersEmpty() || hasPendingFile()) && writeToSocket())
         dataWasWritten = true;
 
     return dataWasWritten;
@@ -1029,6 +1128,17 @@ void QAbstractSocketPrivate::_q_startConnecting(const QHostInfo &hostInfo)
     qDebug("QAbstractSocketPrivate::_q_startConnecting(hostInfo == %s)", s.toLatin1().constData());
 #endif
 
+    // Race the connection attempts if we can run a second socket engine
+    // next to the first one; a bound socket or a proxy can't be duplicated.
+    connectionRacing = q->socketType() == QAbstractSocket::TcpSocket
+            && cachedSocketDescriptor == -1
+#ifndef QT_NO_NETWORKPROXY
+            && proxyInUse.type() == QNetworkProxy::NoProxy
+#endif
+            && threadData.loadRelaxed()->hasEventDispatcher();
+    if (connectionRacing)
+        addresses = interleaveAddressFamilies(addresses);
+
     // Try all addresses twice.
     addresses += addresses;
 
@@ -1149,6 +1259,7 @@ void QAbstractSocketPrivate::_q_connectToNextAddress()
         // Wait for a write notification that will eventually call
         // _q_testConnection().
         socketEngine->setWriteNotificationEnabled(true);
+        scheduleRacingAttempt();
         break;
     } while (state != QAbstractSocket::ConnectedState);
 }
@@ -1180,6 +1291,10 @@ void QAbstractSocketPrivate::_q_testConnection()
             addresses.clear();
     }
 
+    // continue with the attempt that is racing this one, if any
+    if (adoptRacingAttempt())
+        return;
+
 #if defined(QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocketPrivate::_q_testConnection() connection failed,"
            " checking for alternative addresses");
@@ -1205,6 +1320,9 @@ void QAbstractSocketPrivate::_q_abortConnectionAttempt()
 
     connectTimer->stop();
 
+    if (adoptRacingAttempt())
+        return;
+
     if (addresses.isEmpty()) {
         state = QAbstractSocket::UnconnectedState;
         setError(QAbstractSocket::SocketTimeoutError,
@@ -1216,6 +1334,172 @@ void QAbstractSocketPrivate::_q_abortConnectionAttempt()
     }
 }
 
+/*! \internal
+
+    Starts the timer that launches a racing connection attempt to the
+    next candidate address if the pending attempt has not completed
+    within ConnectionAttemptDelay milliseconds.
+*/
+void QAbstractSocketPrivate::scheduleRacingAttempt()
+{
+    Q_Q(QAbstractSocket);
+    if (!connectionRacing || racingEngine || addresses.isEmpty())
+        return;
+
+    if (!racingTimer) {
+        racingTimer = new QTimer(q);
+        racingTimer->setSingleShot(true);
+        QObject::connect(racingTimer, &QTimer::timeout, q, [this]() { startRacingAttempt(); },
+                         Qt::DirectConnection);
+    }
+    racingTimer->start(ConnectionAttemptDelay);
+}
+
+/*! \internal
+
+    Starts a second connection attempt to the next pending address,
+    in parallel to the one in socketEngine.
+*/
+void QAbstractSocketPrivate::startRacingAttempt()
+{
+#ifdef QT_NO_NETWORKPROXY
+    static const QNetworkProxy &proxyInUse = *(QNetworkProxy *)0;
+#endif
+    Q_Q(QAbstractSocket);
+    if (state != QAbstractSocket::ConnectingState || !socketEngine || racingEngine)
+        return;
+
+    while (!addresses.isEmpty()) {
+        // the second round of retries is left to the sequential fallback
+        if (addresses.first() == host)
+            return;
+
+        const QHostAddress candidate = addresses.takeFirst();
+        QAbstractSocketEngine *engine =
+                QAbstractSocketEngine::createSocketEngine(socketType, proxyInUse, q);
+        if (!engine)
+            return;
+        if (!engine->initialize(socketType, candidate.protocol())) {
+            delete engine;
+            continue;
+        }
+
+        // carry over the options set on the pending attempt
+        static const QAbstractSocketEngine::SocketOption options[] = {
+            QAbstractSocketEngine::ReceiveBufferSocketOption,
+            QAbstractSocketEngine::SendBufferSocketOption,
+            QAbstractSocketEngine::LowDelayOption,
+            QAbstractSocketEngine::KeepAliveOption,
+            QAbstractSocketEngine::TypeOfServiceOption
+        };
+        for (QAbstractSocketEngine::SocketOption option : options) {
+            const int value = socketEngine->option(option);
+            if (value != -1)
+                engine->setOption(option, value);
+        }
+        engine->setReceiver(&racingReceiver);
+
+#if defined(QABSTRACTSOCKET_DEBUG)
+        qDebug("QAbstractSocketPrivate::startRacingAttempt(), connecting to %s:%i, %d left to try",
+               candidate.toString().toLatin1().constData(), port, addresses.count());
+#endif
+        racingEngine = engine;
+        racingHost = candidate;
+        if (engine->connectToHost(candidate, port)) {
+            testRacingAttempt();
+            return;
+        }
+        if (engine->state() == QAbstractSocket::ConnectingState) {
+            engine->setWriteNotificationEnabled(true);
+            return;
+        }
+        cancelRacingAttempt();
+    }
+}
+
+/*! \internal
+
+    Called when the racing connection attempt completed. If it succeeded,
+    it replaces the pending attempt in socketEngine; otherwise the next
+    candidate address is tried.
+*/
+void QAbstractSocketPrivate::testRacingAttempt()
+{
+    Q_Q(QAbstractSocket);
+    if (!racingEngine)
+        return;
+
+    if (racingEngine->state() != QAbstractSocket::ConnectedState) {
+#if defined(QABSTRACTSOCKET_DEBUG)
+        qDebug("QAbstractSocketPrivate::testRacingAttempt(), connection to %s failed",
+               racingHost.toString().toLatin1().constData());
+#endif
+        cancelRacingAttempt();
+        startRacingAttempt();
+        return;
+    }
+
+    // the racing attempt won
+    if (connectTimer)
+        connectTimer->stop();
+    QAbstractSocketEngine *winner = std::exchange(racingEngine, nullptr);
+    if (socketEngine) {
+        socketEngine->close();
+        socketEngine->disconnect();
+        delete socketEngine;
+    }
+    socketEngine = winner;
+    socketEngine->setReceiver(this);
+    host = racingHost;
+
+    fetchConnectionParameters();
+    if (pendingClose) {
+        q->disconnectFromHost();
+        pendingClose = false;
+    }
+}
+
+/*! \internal
+
+    Called when the attempt in socketEngine failed. If a racing attempt
+    is still pending, makes it the primary one and returns \c true.
+*/
+bool QAbstractSocketPrivate::adoptRacingAttempt()
+{
+    if (!racingEngine)
+        return false;
+
+    if (socketEngine) {
+        socketEngine->close();
+        socketEngine->disconnect();
+        delete socketEngine;
+    }
+    socketEngine = std::exchange(racingEngine, nullptr);
+    socketEngine->setReceiver(this);
+    host = racingHost;
+
+    if (connectTimer)
+        connectTimer->start(DefaultConnectTimeout);
+    scheduleRacingAttempt();
+    return true;
+}
+
+/*! \internal
+
+    Drops the racing connection attempt, if any.
+*/
+void QAbstractSocketPrivate::cancelRacingAttempt()
+{
+    if (racingTimer)
+        racingTimer->stop();
+    if (racingEngine) {
+        racingEngine->close();
+        racingEngine->disconnect();
+        delete racingEngine;
+        racingEngine = nullptr;
+    }
+}
+
 /*! \internal
 
     Reads data from the socket layer into the read buffer. Returns
@@ -1315,6 +1599,32 @@ void QAbstractSocketPrivate::emitBytesWritten(qint64 bytes, int channel)
     }
     // channelBytesWritten() can be emitted recursively - even for the same channel.
     emit q->channelBytesWritten(channel, bytes);
+
+    updateWriteBufferLevel();
+}
+
+/*! \internal
+
+    Emits writeBufferFull() when the data waiting to be written reaches
+    the write buffer size, and writeBufferDrained() when it has since
+    dropped to the low-water mark. Call after data was queued or sent.
+*/
+void QAbstractSocketPrivate::updateWriteBufferLevel()
+{
+    Q_Q(QAbstractSocket);
+    if (!writeBufferMaxSize)
+        return;
+
+    const qint64 pending = q->bytesToWrite();
+    if (!writeBufferAboveHighWater) {
+        if (pending >= writeBufferMaxSize) {
+            writeBufferAboveHighWater = true;
+            emit q->writeBufferFull();
+        }
+    } else if (pending <= writeBufferLowWaterMark) {
+        writeBufferAboveHighWater = false;
+        emit q->writeBufferDrained();
+    }
 }
 
 /*! \internal
@@ -1325,6 +1635,7 @@ void QAbstractSocketPrivate::fetchConnectionParameters()
 {
     Q_Q(QAbstractSocket);
 
+    cancelRacingAttempt();
     peerName = hostName;
     if (socketEngine) {
         if (q->isReadable()) {
@@ -1647,6 +1958,13 @@ bool QAbstractSocket::isValid() const
     At any point, the socket can emit errorOccurred() to signal that an error
     occurred.
 
+    If the lookup returned several addresses and the connection is not
+    made through a proxy, a TCP socket used with an event loop tries them
+    alternating between IPv6 and IPv4 and, since Qt 6.0, starts a second
+    connection attempt to the next address when the pending one has not
+    completed within 250 milliseconds (RFC 8305). The first attempt to
+    succeed is kept and the other one is dropped.
+
     \a hostName may be an IP address in string form (e.g.,
     "43.195.83.32"), or it may be a host name (e.g.,
     "example.com"). QAbstractSocket will do a lookup only if
@@ -1774,7 +2092,8 @@ void QAbstractSocket::connectToHost(const QHostAddress &address, quint16 port,
 */
 qint64 QAbstractSocket::bytesToWrite() const
 {
-    const qint64 pendingBytes = QIODevice::bytesToWrite();
+    Q_D(const QAbstractSocket);
+    const qint64 pendingBytes = QIODevice::bytesToWrite() + d->pendingFile.remaining;
 #if defined(QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocket::bytesToWrite() == %lld", pendingBytes);
 #endif
@@ -2200,7 +2519,7 @@ bool QAbstractSocket::waitForReadyRead(int msecs)
 
         bool readyToRead = false;
         bool readyToWrite = false;
-        if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, true, !d->writeBuffer.isEmpty(),
+        if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, true, d->hasPendingWrites(),
                                                qt_subtract_from_timeout(msecs, stopWatch.elapsed()))) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForReadyRead(%i) failed (%i, %s)",
@@ -2252,7 +2571,7 @@ bool QAbstractSocket::waitForBytesWritten(int msecs)
         return false;
     }
 
-    if (d->writeBuffer.isEmpty())
+    if (!d->hasPendingWrites())
         return false;
 
     QElapsedTimer stopWatch;
@@ -2269,7 +2588,7 @@ bool QAbstractSocket::waitForBytesWritten(int msecs)
         bool readyToWrite = false;
         if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite,
                                   !d->readBufferMaxSize || d->buffer.size() < d->readBufferMaxSize,
-                                  !d->writeBuffer.isEmpty(),
+                                  d->hasPendingWrites(),
                                   qt_subtract_from_timeout(msecs, stopWatch.elapsed()))) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForBytesWritten(%i) failed (%i, %s)",
@@ -2349,7 +2668,7 @@ bool QAbstractSocket::waitForDisconnected(int msecs)
         bool readyToRead = false;
         bool readyToWrite = false;
         if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, state() == ConnectedState,
-                                               !d->writeBuffer.isEmpty(),
+                                               d->hasPendingWrites(),
                                                qt_subtract_from_timeout(msecs, stopWatch.elapsed()))) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForReadyRead(%i) failed (%i, %s)",
@@ -2416,6 +2735,98 @@ bool QAbstractSocket::flush()
     return d_func()->flush();
 }
 
+/*!
+    \since 6.0
+
+    Queues \a length bytes of \a file, starting at \a offset, for
+    transmission after any data already written to the socket. If \a
+    length is negative or extends past the end of the file, everything
+    from \a offset to the end of the file is sent. Returns the number
+    of bytes queued, or -1 if an error occurred.
+
+    \a file must be open for reading and must not be sequential. Its
+    current position is left unchanged, and it may be closed or
+    destroyed as soon as this function returns.
+
+    On platforms that support it (currently Linux), a connected TCP
+    socket that is not encrypted hands the file to the kernel, which
+    copies it to the network without passing it through the
+    application; bytesToWrite() includes the bytes still to be sent.
+    In all other cases the contents are read and written as if by
+    write(). Either way, bytesWritten() is emitted as the data leaves
+    the socket, and flush(), waitForBytesWritten() and
+    disconnectFromHost() take the queued file into account.
+
+    \sa write(), bytesWritten()
+*/
+qint64 QAbstractSocket::sendFile(QFile *file, qint64 offset, qint64 length)
+{
+    Q_D(QAbstractSocket);
+    if (!file || !file->isReadable() || file->isSequential()) {
+        qWarning("QAbstractSocket::sendFile: file is not open for random-access reading");
+        return -1;
+    }
+    if (!isWritable()) {
+        qWarning("QAbstractSocket::sendFile: device not open for writing");
+        return -1;
+    }
+    if (d->state == UnconnectedState) {
+        d->setError(UnknownSocketError, tr("Socket is not connected"));
+        return -1;
+    }
+
+    const qint64 fileSize = file->size();
+    if (offset < 0 || offset > fileSize) {
+        qWarning("QAbstractSocket::sendFile: offset %lld is out of range", offset);
+        return -1;
+    }
+    if (length < 0 || length > fileSize - offset)
+        length = fileSize - offset;
+    if (length == 0)
+        return 0;
+
+#ifdef Q_OS_LINUX
+    // Only one file can be in flight; later ones are copied behind it.
+    if (d->state == ConnectedState && d->socketType == TcpSocket && !d->hasPendingFile()
+        && d->socketEngine && d->socketEngine->canSendFile() && file->handle() != -1) {
+        if (file->isWritable())
+            file->flush();
+        const int fd = qt_safe_dup(file->handle());
+        if (fd != -1) {
+            d->pendingFile.fd = fd;
+            d->pendingFile.offset = offset;
+            d->pendingFile.remaining = length;
+            d->pendingFile.bufferedBefore = d->writeBuffer.size();
+            d->socketEngine->setWriteNotificationEnabled(true);
+            d->updateWriteBufferLevel();
+            return length;
+        }
+    }
+#endif
+
+    const qint64 oldPos = file->pos();
+    if (!file->seek(offset))
+        return -1;
+
+    qint64 queued = 0;
+    while (queued < length) {
+        const QByteArray chunk = file->read(qMin(length - queued, qint64(QABSTRACTSOCKET_BUFFERSIZE)));
+        if (chunk.isEmpty())
+            break;
+        const qint64 written = write(chunk);
+        if (written < 0) {
+            if (!queued)
+                queued = -1;
+            break;
+        }
+        queued += written;
+        if (written < chunk.size())
+            break;
+    }
+    file->seek(oldPos);
+    return queued;
+}
+
 /*! \reimp
 */
 qint64 QAbstractSocket::readData(char *data, qint64 maxSize)
@@ -2469,7 +2880,7 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
     }
 
     if (!d->isBuffered && d->socketType == TcpSocket
-        && d->socketEngine && d->writeBuffer.isEmpty()) {
+        && d->socketEngine && !d->hasPendingWrites()) {
         // This code is for the new Unbuffered QTcpSocket use case
         qint64 written = size ? d->socketEngine->write(data, size) : Q_INT64_C(0);
         if (written < 0) {
@@ -2479,6 +2890,7 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
             d->writeBuffer.append(data + written, size - written);
             written = size;
             d->socketEngine->setWriteNotificationEnabled(true);
+            d->updateWriteBufferLevel();
         }
 
 #if defined (QABSTRACTSOCKET_DEBUG)
@@ -2514,6 +2926,7 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
 
     if (d->socketEngine && !d->writeBuffer.isEmpty())
         d->socketEngine->setWriteNotificationEnabled(true);
+    d->updateWriteBufferLevel();
 
 #if defined (QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocket::writeData(%p \"%s\", %lli) == %lli", data,
@@ -2523,6 +2936,50 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
     return written;
 }
 
+/*!
+    \since 6.0
+    \reimp
+*/
+qint64 QAbstractSocket::writeChunksData(const QByteArrayView *chunks, qsizetype count)
+{
+    Q_D(QAbstractSocket);
+    if (d->state == QAbstractSocket::UnconnectedState || d->isBuffered
+        || d->socketType != TcpSocket || !d->socketEngine || d->hasPendingWrites()) {
+        return QIODevice::writeChunksData(chunks, count);
+    }
+
+    // Unbuffered QTcpSocket: write all chunks with one call and buffer
+    // whatever the socket did not take, as writeData() does.
+    qint64 total = 0;
+    for (qsizetype i = 0; i < count; ++i)
+        total += chunks[i].size();
+
+    qint64 written = total ? d->socketEngine->writeChunks(chunks, count) : Q_INT64_C(0);
+    if (written < 0) {
+        d->setError(d->socketEngine->error(), d->socketEngine->errorString());
+        return written;
+    }
+    if (written < total) {
+        qint64 skip = written;
+        for (qsizetype i = 0; i < count; ++i) {
+            const qint64 size = chunks[i].size();
+            if (skip >= size) {
+                skip -= size;
+                continue;
+            }
+            d->writeBuffer.append(chunks[i].data() + skip, size - skip);
+            skip = 0;
+        }
+        d->socketEngine->setWriteNotificationEnabled(true);
+        d->updateWriteBufferLevel();
+    }
+
+#if defined (QABSTRACTSOCKET_DEBUG)
+    qDebug("QAbstractSocket::writeChunksData(%p, %lld) == %lld", chunks, qint64(count), total);
+#endif
+    return total; // actually written + what has been buffered
+}
+
 /*!
     \since 4.1
 
@@ -2700,7 +3157,7 @@ void QAbstractSocket::disconnectFromHost()
 
         // Wait for pending data to be written.
         if (d->socketEngine && d->socketEngine->isValid() && (!d->allWriteBuffersEmpty()
-            || d->socketEngine->bytesToWrite() > 0)) {
+            || d->hasPendingFile() || d->socketEngine->bytesToWrite() > 0)) {
             d->socketEngine->setWriteNotificationEnabled(true);
 
 #if defined(QABSTRACTSOCKET_DEBUG)
@@ -2790,6 +3247,87 @@ void QAbstractSocket::setReadBufferSize(qint64 size)
     }
 }
 
+/*!
+    \since 6.0
+
+    Returns the high-water mark of the socket's outgoing data, in bytes.
+
+    A size of 0 (the default) means that no mark is set, and
+    writeBufferFull() is never emitted.
+
+    \sa setWriteBufferSize(), writeBufferLowWaterMark(), bytesToWrite()
+*/
+qint64 QAbstractSocket::writeBufferSize() const
+{
+    return d_func()->writeBufferMaxSize;
+}
+
+/*!
+    \since 6.0
+
+    Sets the high-water mark of the socket's outgoing data to \a size
+    bytes.
+
+    When the data that write() has accepted but that has not yet been
+    handed to the operating system, as reported by bytesToWrite(), grows
+    to \a size bytes or more, the socket emits writeBufferFull(). Once it
+    has dropped to writeBufferLowWaterMark() bytes, the socket emits
+    writeBufferDrained(), and is ready to report the next high-water
+    crossing.
+
+    The mark is advisory: write() keeps accepting data above it. Its
+    purpose is to let the code producing the data stop before memory use
+    grows without bound, for instance when a peer reads more slowly than
+    data arrives for it. A proxy that relays from one socket to another
+    can stop reading from the source when the destination emits
+    writeBufferFull() and resume when it emits writeBufferDrained().
+    If the source has a limited readBufferSize(), it then stops reading
+    from the network too, which in turn slows down the sender.
+
+    A \a size of 0 removes the mark.
+
+    \sa writeBufferSize(), setWriteBufferLowWaterMark(), setReadBufferSize()
+*/
+void QAbstractSocket::setWriteBufferSize(qint64 size)
+{
+    Q_D(QAbstractSocket);
+    d->writeBufferMaxSize = qMax(size, Q_INT64_C(0));
+    if (!d->writeBufferMaxSize)
+        d->writeBufferAboveHighWater = false;
+}
+
+/*!
+    \since 6.0
+
+    Returns the low-water mark of the socket's outgoing data, in bytes.
+    The default is 0, meaning that writeBufferDrained() is emitted once
+    all data was written.
+
+    \sa setWriteBufferLowWaterMark(), writeBufferSize()
+*/
+qint64 QAbstractSocket::writeBufferLowWaterMark() const
+{
+    return d_func()->writeBufferLowWaterMark;
+}
+
+/*!
+    \since 6.0
+
+    Sets the low-water mark of the socket's outgoing data to \a size
+    bytes. After writeBufferFull() was emitted, writeBufferDrained() is
+    emitted once bytesToWrite() drops to \a size bytes or fewer.
+
+    A mark below the write buffer size lets a producer resume while data
+    is still queued, so that the socket never runs empty, without
+    toggling on every write.
+
+    \sa writeBufferLowWaterMark(), setWriteBufferSize()
+*/
+void QAbstractSocket::setWriteBufferLowWaterMark(qint64 size)
+{
+    d_func()->writeBufferLowWaterMark = qMax(size, Q_INT64_C(0));
+}
+
 /*!
     Returns the state of the socket.
 
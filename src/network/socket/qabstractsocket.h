@@ -50,6 +50,7 @@
 QT_BEGIN_NAMESPACE
 
 
+class QFile;
 class QHostAddress;
 #ifndef QT_NO_NETWORKPROXY
 class QNetworkProxy;
@@ -168,6 +169,11 @@ public:
     qint64 readBufferSize() const;
     virtual void setReadBufferSize(qint64 size);
 
+    qint64 writeBufferSize() const;
+    void setWriteBufferSize(qint64 size);
+    qint64 writeBufferLowWaterMark() const;
+    void setWriteBufferLowWaterMark(qint64 size);
+
     void abort();
 
     virtual qintptr socketDescriptor() const;
@@ -185,6 +191,7 @@ public:
     void close() override;
     bool isSequential() const override;
     bool flush();
+    qint64 sendFile(QFile *file, qint64 offset = 0, qint64 length = -1);
 
     // for synchronous access
     virtual bool waitForConnected(int msecs = 30000);
@@ -205,6 +212,8 @@ Q_SIGNALS:
     void disconnected();
     void stateChanged(QAbstractSocket::SocketState);
     void errorOccurred(QAbstractSocket::SocketError);
+    void writeBufferFull();
+    void writeBufferDrained();
 #ifndef QT_NO_NETWORKPROXY
     void proxyAuthenticationRequired(const QNetworkProxy &proxy, QAuthenticator *authenticator);
 #endif
@@ -214,6 +223,7 @@ protected:
     qint64 readLineData(char *data, qint64 maxlen) override;
     qint64 skipData(qint64 maxSize) override;
     qint64 writeData(const char *data, qint64 len) override;
+    qint64 writeChunksData(const QByteArrayView *chunks, qsizetype count) override;
 
     void setSocketState(SocketState state);
     void setSocketError(SocketError socketError);
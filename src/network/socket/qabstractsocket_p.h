@@ -96,6 +96,31 @@ public:
     void _q_testConnection();
     void _q_abortConnectionAttempt();
 
+    // Connection racing (Happy Eyeballs, RFC 8305): while a connection
+    // attempt is pending, a second one to the next candidate address is
+    // started and whichever of the two completes first is kept.
+    class RacingAttemptReceiver : public QAbstractSocketEngineReceiver
+    {
+    public:
+        explicit RacingAttemptReceiver(QAbstractSocketPrivate *d) : d(d) {}
+        void readNotification() override {}
+        void writeNotification() override {}
+        void closeNotification() override {}
+        void exceptionNotification() override {}
+        void connectionNotification() override { d->testRacingAttempt(); }
+#ifndef QT_NO_NETWORKPROXY
+        void proxyAuthenticationRequired(const QNetworkProxy &, QAuthenticator *) override {}
+#endif
+    private:
+        QAbstractSocketPrivate *d;
+    };
+
+    void startRacingAttempt();
+    void testRacingAttempt();
+    bool adoptRacingAttempt();
+    void cancelRacingAttempt();
+    void scheduleRacingAttempt();
+
     bool emittedReadyRead;
     bool emittedBytesWritten;
 
@@ -139,16 +164,39 @@ public:
     virtual bool writeToSocket();
     void emitReadyRead(int channel = 0);
     void emitBytesWritten(qint64 bytes, int channel = 0);
+    void updateWriteBufferLevel();
+
+    // A file queued by sendFile(). Its contents are sent after the first
+    // bufferedBefore bytes of writeBuffer, which were written before it.
+    struct PendingFile {
+        int fd = -1;
+        qint64 offset = 0;
+        qint64 remaining = 0;
+        qint64 bufferedBefore = 0;
+    };
+    PendingFile pendingFile;
+    inline bool hasPendingFile() const { return pendingFile.remaining > 0; }
+    inline bool hasPendingWrites() const { return !writeBuffer.isEmpty() || hasPendingFile(); }
+    void releasePendingFile();
 
     void setError(QAbstractSocket::SocketError errorCode, const QString &errorString);
     void setErrorAndEmit(QAbstractSocket::SocketError errorCode, const QString &errorString);
 
     qint64 readBufferMaxSize;
+    qint64 writeBufferMaxSize;
+    qint64 writeBufferLowWaterMark;
+    bool writeBufferAboveHighWater;
     bool isBuffered;
     bool hasPendingData;
 
     QTimer *connectTimer;
 
+    RacingAttemptReceiver racingReceiver;
+    QAbstractSocketEngine *racingEngine = nullptr;
+    QHostAddress racingHost;
+    QTimer *racingTimer = nullptr;
+    bool connectionRacing = false;
+
     int hostLookupId;
 
     QAbstractSocket::SocketType socketType;
@@ -269,6 +269,106 @@ int QAbstractSocketEngine::outboundStreamCount() const
     return d_func()->outboundStreamCount;
 }
 
+/*!
+    Reads up to \a count pending datagrams, each into the payload of one
+    of \a datagrams, whose size gives the most that will be stored, and
+    fills their headers according to \a options. Payloads are truncated
+    to the received size. Returns the number of datagrams read, -2 if
+    none was pending, or -1 if an error occurred.
+
+    The default implementation calls readDatagram() once per datagram.
+*/
+int QAbstractSocketEngine::readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                                         PacketHeaderOptions options)
+{
+    int received = 0;
+    while (received < count) {
+        if (received && !hasPendingDatagrams())
+            break;
+        QNetworkDatagramPrivate *datagram = datagrams[received];
+        const qint64 ret = readDatagram(datagram->data.data(), datagram->data.size(),
+                                        &datagram->header, options);
+        if (ret < 0) {
+            if (received)
+                break;
+            return int(ret);
+        }
+        datagram->data.truncate(ret);
+        ++received;
+    }
+    return received;
+}
+
+/*!
+    Sends the \a count datagrams in \a datagrams. Returns the number of
+    datagrams sent, -2 if the socket could not take any right now, or -1
+    if an error occurred before anything was sent.
+
+    The default implementation calls writeDatagram() once per datagram.
+*/
+int QAbstractSocketEngine::writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count)
+{
+    int sent = 0;
+    for (; sent < count; ++sent) {
+        const QNetworkDatagramPrivate *datagram = datagrams[sent];
+        const qint64 ret = writeDatagram(datagram->data.constData(), datagram->data.size(),
+                                         datagram->header);
+        if (ret < 0)
+            return sent ? sent : int(ret);
+    }
+    return sent;
+}
+
+/*!
+    Writes the \a count buffers in \a chunks to the socket, in order.
+    Returns the total number of bytes written, or -1 if an error occurred
+    before anything was written. The default implementation calls write()
+    for each buffer and stops at the first one that is only partially
+    written.
+*/
+qint64 QAbstractSocketEngine::writeChunks(const QByteArrayView *chunks, qsizetype count)
+{
+    qint64 written = 0;
+    for (qsizetype i = 0; i < count; ++i) {
+        if (chunks[i].isEmpty())
+            continue;
+        const qint64 ret = write(chunks[i].data(), chunks[i].size());
+        if (ret < 0)
+            return written ? written : ret;
+        written += ret;
+        if (ret < chunks[i].size())
+            break;
+    }
+    return written;
+}
+
+/*!
+    Returns \c true if this engine can transmit file contents with
+    sendFile() without copying them through user space; otherwise
+    returns \c false. The default implementation returns \c false.
+*/
+bool QAbstractSocketEngine::canSendFile() const
+{
+    return false;
+}
+
+/*!
+    Writes up to \a len bytes of the file open on \a fileDescriptor,
+    starting at \a offset, to the socket. Returns the number of bytes
+    written, 0 if the socket cannot accept data right now, or -1 if an
+    error occurred. The default implementation fails with
+    QAbstractSocket::UnsupportedSocketOperationError.
+*/
+qint64 QAbstractSocketEngine::sendFile(qintptr fileDescriptor, qint64 offset, qint64 len)
+{
+    Q_UNUSED(fileDescriptor);
+    Q_UNUSED(offset);
+    Q_UNUSED(len);
+    setError(QAbstractSocket::UnsupportedSocketOperationError,
+             QAbstractSocket::tr("Operation on socket is not supported"));
+    return -1;
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qabstractsocketengine_p.cpp"
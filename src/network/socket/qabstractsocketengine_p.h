@@ -107,7 +107,8 @@ public:
         ReceivePacketInformation,
         ReceiveHopLimit,
         MaxStreamsSocketOption,
-        PathMtuInformation
+        PathMtuInformation,
+        PortReusable
     };
 
     enum PacketHeaderOption {
@@ -159,8 +160,15 @@ public:
     virtual qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader *header = nullptr,
                                 PacketHeaderOptions = WantNone) = 0;
     virtual qint64 writeDatagram(const char *data, qint64 len, const QIpPacketHeader &header) = 0;
+    virtual int readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                              PacketHeaderOptions options = WantNone);
+    virtual int writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count);
     virtual qint64 bytesToWrite() const = 0;
 
+    virtual qint64 writeChunks(const QByteArrayView *chunks, qsizetype count);
+    virtual bool canSendFile() const;
+    virtual qint64 sendFile(qintptr fileDescriptor, qint64 offset, qint64 len);
+
     virtual int option(SocketOption option) const = 0;
     virtual bool setOption(SocketOption option, int value) = 0;
 
@@ -146,6 +146,46 @@ QT_BEGIN_NAMESPACE
     \sa setSocketDescriptor()
 */
 
+/*!
+    \fn bool QLocalSocket::writeFileDescriptors(const QByteArray &data, const QList<int> &descriptors)
+    \since 6.0
+
+    Writes \a data to the socket and passes the file \a descriptors to the
+    peer along with it, using the \c SCM_RIGHTS mechanism of Unix domain
+    sockets. This makes it possible to hand over a memfd or a shared memory
+    segment instead of copying its contents through the socket.
+
+    The descriptors are duplicated, so the caller keeps ownership of
+    \a descriptors and may close them as soon as this function returns.
+    \a data must not be empty. Returns \c true if the data was queued for
+    writing; otherwise returns \c false.
+
+    The peer receives the descriptors no later than \a data, and can obtain
+    them with takeFileDescriptors().
+
+    \note This function is only available on Unix platforms.
+
+    \sa takeFileDescriptors(), write()
+*/
+
+/*!
+    \fn QList<int> QLocalSocket::takeFileDescriptors()
+    \since 6.0
+
+    Returns the file descriptors that have been received from the peer
+    since the last call, in the order they were sent, and transfers their
+    ownership to the caller. A descriptor becomes available as soon as the
+    data it was sent with has been received, possibly before that data has
+    been read from the socket.
+
+    Descriptors that have not been taken when the socket is closed are
+    closed with it.
+
+    \note This function is only available on Unix platforms.
+
+    \sa writeFileDescriptors()
+*/
+
 /*!
     \fn qint64 QLocalSocket::readData(char *data, qint64 c)
     \reimp
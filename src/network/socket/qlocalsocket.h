@@ -108,6 +108,11 @@ public:
                              OpenMode openMode = ReadWrite);
     qintptr socketDescriptor() const;
 
+#if (defined(Q_OS_UNIX) && !defined(QT_LOCALSOCKET_TCP)) || defined(Q_CLANG_QDOC)
+    bool writeFileDescriptors(const QByteArray &data, const QList<int> &descriptors);
+    QList<int> takeFileDescriptors();
+#endif
+
     LocalSocketState state() const;
     bool waitForBytesWritten(int msecs = 30000) override;
     bool waitForConnected(int msecs = 30000);
@@ -75,6 +75,10 @@ QT_REQUIRE_CONFIG(localserver);
 
 QT_BEGIN_NAMESPACE
 
+#if !defined(Q_OS_WIN) && !defined(QT_LOCALSOCKET_TCP)
+class QNativeSocketEngine;
+#endif
+
 #if !defined(Q_OS_WIN) || defined(QT_LOCALSOCKET_TCP)
 class QLocalUnixSocket : public QTcpSocket
 {
@@ -146,6 +150,8 @@ public:
     void _q_connectToSocket();
     void _q_abortConnectionAttempt();
     void cancelDelayedConnect();
+    QNativeSocketEngine *socketEngine() const;
+    void enableDescriptorPassing();
     QSocketNotifier *delayConnect;
     QTimer *connectTimer;
     int connectingSocket;
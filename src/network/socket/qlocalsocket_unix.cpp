@@ -40,6 +40,8 @@
 #include "qlocalsocket.h"
 #include "qlocalsocket_p.h"
 #include "qnet_unix_p.h"
+#include "qabstractsocket_p.h"
+#include "qnativesocketengine_p.h"
 
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -327,6 +329,7 @@ void QLocalSocketPrivate::_q_connectToSocket()
     fullServerName = connectingPathName;
     if (unixSocket.setSocketDescriptor(connectingSocket,
         QAbstractSocket::ConnectedState, connectingOpenMode)) {
+        enableDescriptorPassing();
         q->QIODevice::open(connectingOpenMode | QIODevice::Unbuffered);
         q->emit connected();
     } else {
@@ -359,8 +362,53 @@ bool QLocalSocket::setSocketDescriptor(qintptr socketDescriptor,
     }
     QIODevice::open(openMode);
     d->state = socketState;
-    return d->unixSocket.setSocketDescriptor(socketDescriptor,
-                                             newSocketState, openMode);
+    if (!d->unixSocket.setSocketDescriptor(socketDescriptor, newSocketState, openMode))
+        return false;
+    d->enableDescriptorPassing();
+    return true;
+}
+
+QNativeSocketEngine *QLocalSocketPrivate::socketEngine() const
+{
+    const QObject *socket = &unixSocket;
+    auto socketPrivate = static_cast<const QAbstractSocketPrivate *>(QObjectPrivate::get(socket));
+    return qobject_cast<QNativeSocketEngine *>(socketPrivate->socketEngine);
+}
+
+void QLocalSocketPrivate::enableDescriptorPassing()
+{
+    // Must happen before the first read, or the kernel discards descriptors
+    // the peer sends us.
+    if (QNativeSocketEngine *engine = socketEngine())
+        engine->setReceiveFileDescriptors(true);
+}
+
+bool QLocalSocket::writeFileDescriptors(const QByteArray &data, const QList<int> &descriptors)
+{
+    Q_D(QLocalSocket);
+    if (data.isEmpty()) {
+        qWarning("QLocalSocket::writeFileDescriptors: Descriptors must be sent with data");
+        return false;
+    }
+    QNativeSocketEngine *engine = d->socketEngine();
+    if (!engine || state() != ConnectedState || !isWritable()) {
+        qWarning("QLocalSocket::writeFileDescriptors: Socket is not connected");
+        return false;
+    }
+    if (!engine->queueFileDescriptors(descriptors)) {
+        setErrorString(d->generateErrorString(SocketResourceError,
+                                              QLatin1String("QLocalSocket::writeFileDescriptors")));
+        return false;
+    }
+    return write(data) == data.size();
+}
+
+QList<int> QLocalSocket::takeFileDescriptors()
+{
+    Q_D(QLocalSocket);
+    if (QNativeSocketEngine *engine = d->socketEngine())
+        return engine->takeReceivedFileDescriptors();
+    return QList<int>();
 }
 
 void QLocalSocketPrivate::_q_abortConnectionAttempt()
@@ -122,6 +122,9 @@
 
 #include <private/qthread_p.h>
 #include <private/qobject_p.h>
+#ifdef Q_OS_UNIX
+#  include <private/qcore_unix_p.h>
+#endif
 
 #if !defined(QT_NO_NETWORKPROXY)
 # include "qnetworkproxy.h"
@@ -918,6 +921,144 @@ qint64 QNativeSocketEngine::write(const char *data, qint64 size)
     return d->nativeWrite(data, size);
 }
 
+/*!
+    Reads up to \a count pending datagrams into \a datagrams, with a
+    single recvmmsg() call on Linux. See
+    QAbstractSocketEngine::readDatagrams().
+*/
+int QNativeSocketEngine::readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                                       PacketHeaderOptions options)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::readDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::readDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+#ifdef Q_OS_LINUX
+    if (d->socketType == QAbstractSocket::UdpSocket)
+        return d->nativeReceiveDatagrams(datagrams, count, options);
+#endif
+    return QAbstractSocketEngine::readDatagrams(datagrams, count, options);
+}
+
+/*!
+    Sends the \a count datagrams in \a datagrams, with a single
+    sendmmsg() call on Linux. See QAbstractSocketEngine::writeDatagrams().
+*/
+int QNativeSocketEngine::writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::writeDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+#ifdef Q_OS_LINUX
+    if (d->socketType == QAbstractSocket::UdpSocket)
+        return d->nativeSendDatagrams(datagrams, count);
+#endif
+    return QAbstractSocketEngine::writeDatagrams(datagrams, count);
+}
+
+/*!
+    Writes the \a count buffers in \a chunks to the socket with a
+    single vectored call where the platform supports it. Returns the
+    total number of bytes written, or -1 if an error occurred.
+*/
+qint64 QNativeSocketEngine::writeChunks(const QByteArrayView *chunks, qsizetype count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeChunks(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::writeChunks(), QAbstractSocket::ConnectedState, -1);
+#ifndef Q_OS_WIN
+    if (d->socketType != QAbstractSocket::UdpSocket)
+        return d->nativeWriteChunks(chunks, count);
+#endif
+    return QAbstractSocketEngine::writeChunks(chunks, count);
+}
+
+/*!
+    Returns \c true if sendFile() can hand file contents to the kernel
+    directly on this platform.
+*/
+bool QNativeSocketEngine::canSendFile() const
+{
+#ifdef Q_OS_LINUX
+    return true;
+#else
+    return false;
+#endif
+}
+
+/*!
+    Writes up to \a size bytes of the file open on \a fileDescriptor,
+    starting at \a offset, to the socket without copying them through
+    user space. The file's own position is not changed. Returns the
+    number of bytes written, 0 if the socket would block, or -1 if an
+    error occurred.
+*/
+qint64 QNativeSocketEngine::sendFile(qintptr fileDescriptor, qint64 offset, qint64 size)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::sendFile(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::sendFile(), QAbstractSocket::ConnectedState, -1);
+    Q_CHECK_TYPE(QNativeSocketEngine::sendFile(), QAbstractSocket::TcpSocket, -1);
+#ifdef Q_OS_LINUX
+    return d->nativeSendFile(int(fileDescriptor), offset, size);
+#else
+    return QAbstractSocketEngine::sendFile(fileDescriptor, offset, size);
+#endif
+}
+
+#ifdef Q_OS_UNIX
+/*!
+    Enables or disables receiving file descriptors sent with SCM_RIGHTS on
+    a local socket. Unless this is enabled, descriptors sent by the peer are
+    closed by the kernel when the data they were attached to is read.
+
+    \sa takeReceivedFileDescriptors()
+*/
+void QNativeSocketEngine::setReceiveFileDescriptors(bool enable)
+{
+    Q_D(QNativeSocketEngine);
+    d->receiveDescriptors = enable;
+}
+
+/*!
+    Queues duplicates of \a descriptors to be sent to the peer with the
+    next data written to the socket. Returns \c false if the descriptors
+    could not be duplicated.
+*/
+bool QNativeSocketEngine::queueFileDescriptors(const QList<int> &descriptors)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::queueFileDescriptors(), false);
+    Q_CHECK_TYPE(QNativeSocketEngine::queueFileDescriptors(), QAbstractSocket::TcpSocket, false);
+
+    QList<int> duplicates;
+    duplicates.reserve(descriptors.size());
+    for (int fd : descriptors) {
+        const int copy = qt_safe_dup(fd);
+        if (copy == -1) {
+            for (int copied : qAsConst(duplicates))
+                qt_safe_close(copied);
+            d->setError(QAbstractSocket::SocketResourceError,
+                        QNativeSocketEnginePrivate::ResourceErrorString);
+            return false;
+        }
+        duplicates.append(copy);
+    }
+    d->outgoingDescriptors += duplicates;
+    return true;
+}
+
+/*!
+    Returns the file descriptors received since the last call, in the order
+    they were sent. The caller takes ownership of them.
+*/
+QList<int> QNativeSocketEngine::takeReceivedFileDescriptors()
+{
+    Q_D(QNativeSocketEngine);
+    return std::exchange(d->receivedDescriptors, QList<int>());
+}
+#endif // Q_OS_UNIX
 
 qint64 QNativeSocketEngine::bytesToWrite() const
 {
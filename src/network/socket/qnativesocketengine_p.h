@@ -147,6 +147,16 @@ public:
     qint64 read(char *data, qint64 maxlen) override;
     qint64 write(const char *data, qint64 len) override;
 
+    qint64 writeChunks(const QByteArrayView *chunks, qsizetype count) override;
+    bool canSendFile() const override;
+    qint64 sendFile(qintptr fileDescriptor, qint64 offset, qint64 len) override;
+
+#ifdef Q_OS_UNIX
+    void setReceiveFileDescriptors(bool enable);
+    bool queueFileDescriptors(const QList<int> &descriptors);
+    QList<int> takeReceivedFileDescriptors();
+#endif
+
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
     bool joinMulticastGroup(const QHostAddress &groupAddress,
@@ -164,6 +174,9 @@ public:
     qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader * = nullptr,
                         PacketHeaderOptions = WantNone) override;
     qint64 writeDatagram(const char *data, qint64 len, const QIpPacketHeader &) override;
+    int readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                      PacketHeaderOptions = WantNone) override;
+    int writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count) override;
     qint64 bytesToWrite() const override;
 
 #if 0   // currently unused
@@ -212,6 +225,14 @@ public:
 
     QSocketNotifier *readNotifier, *writeNotifier, *exceptNotifier;
 
+#ifdef Q_OS_UNIX
+    // SCM_RIGHTS descriptor passing on local sockets; we own all of these
+    QList<int> outgoingDescriptors;
+    QList<int> receivedDescriptors;
+    bool receiveDescriptors = false;
+    void closeDescriptors();
+#endif
+
 #if defined(Q_OS_WIN)
     LPFN_WSASENDMSG sendmsg;
     LPFN_WSARECVMSG recvmsg;
@@ -277,8 +298,19 @@ public:
     qint64 nativeReceiveDatagram(char *data, qint64 maxLength, QIpPacketHeader *header,
                                  QAbstractSocketEngine::PacketHeaderOptions options);
     qint64 nativeSendDatagram(const char *data, qint64 length, const QIpPacketHeader &header);
+#ifdef Q_OS_LINUX
+    int nativeReceiveDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                               QAbstractSocketEngine::PacketHeaderOptions options);
+    int nativeSendDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count);
+#endif
     qint64 nativeRead(char *data, qint64 maxLength);
     qint64 nativeWrite(const char *data, qint64 length);
+#ifndef Q_OS_WIN
+    qint64 nativeWriteChunks(const QByteArrayView *chunks, qsizetype count);
+#endif
+#ifdef Q_OS_LINUX
+    qint64 nativeSendFile(int fileDescriptor, qint64 offset, qint64 length);
+#endif
     int nativeSelect(int timeout, bool selectForRead) const;
     int nativeSelect(int timeout, bool checkRead, bool checkWrite,
                      bool *selectForRead, bool *selectForWrite) const;
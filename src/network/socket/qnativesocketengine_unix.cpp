@@ -58,8 +58,13 @@
 #ifdef Q_OS_BSD4
 #include <net/if_dl.h>
 #endif
-#ifdef Q_OS_INTEGRITY
 #include <sys/uio.h>
+#include <limits.h>
+#ifndef IOV_MAX
+#  define IOV_MAX 16 // the POSIX minimum
+#endif
+#ifdef Q_OS_LINUX
+#include <sys/sendfile.h>
 #endif
 
 #if defined QNATIVESOCKETENGINE_DEBUG
@@ -240,6 +245,12 @@ static void convertToLevelAndOption(QNativeSocketEngine::SocketOption opt,
 #endif
         }
         break;
+
+    case QNativeSocketEngine::PortReusable:
+#ifdef SO_REUSEPORT
+        n = SO_REUSEPORT;
+#endif
+        break;
     }
 }
 
@@ -396,7 +407,8 @@ bool QNativeSocketEnginePrivate::setOption(QNativeSocketEngine::SocketOption opt
 #endif
             return false;
         }
-        if (::fcntl(socketDescriptor, F_SETFL, flags | O_NONBLOCK) == -1) {
+        // accepted sockets are already non-blocking
+        if ((flags & O_NONBLOCK) == 0 && ::fcntl(socketDescriptor, F_SETFL, flags | O_NONBLOCK) == -1) {
 #ifdef QNATIVESOCKETENGINE_DEBUG
             perror("QNativeSocketEnginePrivate::setOption(): fcntl(F_SETFL) failed");
 #endif
@@ -628,7 +640,9 @@ bool QNativeSocketEnginePrivate::nativeListen(int backlog)
 
 int QNativeSocketEnginePrivate::nativeAccept()
 {
-    int acceptedDescriptor = qt_safe_accept(socketDescriptor, nullptr, nullptr);
+    // where accept4() is available, this sets both O_NONBLOCK and FD_CLOEXEC
+    // atomically, so the QTcpSocket that adopts the descriptor need not
+    int acceptedDescriptor = qt_safe_accept(socketDescriptor, nullptr, nullptr, O_NONBLOCK);
     if (acceptedDescriptor == -1) {
         switch (errno) {
         case EBADF:
@@ -935,173 +949,122 @@ qint64 QNativeSocketEnginePrivate::nativePendingDatagramSize() const
     return qint64(recvResult);
 }
 
-qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxSize, QIpPacketHeader *header,
-                                                         QAbstractSocketEngine::PacketHeaderOptions options)
+// we use quintptr to force the alignment
+struct QDatagramReceiveControl
 {
-    // we use quintptr to force the alignment
-    quintptr cbuf[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
+    quintptr buffer[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
 #if !defined(IP_PKTINFO) && defined(IP_RECVIF) && defined(Q_OS_BSD4)
-                   + CMSG_SPACE(sizeof(sockaddr_dl))
+                     + CMSG_SPACE(sizeof(sockaddr_dl))
 #endif
 #ifndef QT_NO_SCTP
-                   + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
+                     + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
 #endif
-                   + sizeof(quintptr) - 1) / sizeof(quintptr)];
-
-    struct msghdr msg;
-    struct iovec vec;
-    qt_sockaddr aa;
-    char c;
-    memset(&msg, 0, sizeof(msg));
-    memset(&aa, 0, sizeof(aa));
-
-    // we need to receive at least one byte, even if our user isn't interested in it
-    vec.iov_base = maxSize ? data : &c;
-    vec.iov_len = maxSize ? maxSize : 1;
-    msg.msg_iov = &vec;
-    msg.msg_iovlen = 1;
-    if (options & QAbstractSocketEngine::WantDatagramSender) {
-        msg.msg_name = &aa;
-        msg.msg_namelen = sizeof(aa);
-    }
-    if (options & (QAbstractSocketEngine::WantDatagramHopLimit | QAbstractSocketEngine::WantDatagramDestination
-                   | QAbstractSocketEngine::WantStreamNumber)) {
-        msg.msg_control = cbuf;
-        msg.msg_controllen = sizeof(cbuf);
-    }
+                     + sizeof(quintptr) - 1) / sizeof(quintptr)];
+};
 
-    ssize_t recvResult = 0;
-    do {
-        recvResult = ::recvmsg(socketDescriptor, &msg, 0);
-    } while (recvResult == -1 && errno == EINTR);
-
-    if (recvResult == -1) {
-        switch (errno) {
-#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
-        case EWOULDBLOCK:
+struct QDatagramSendControl
+{
+    quintptr buffer[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
+#ifndef QT_NO_SCTP
+                     + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
 #endif
-        case EAGAIN:
-            // No datagram was available for reading
-            recvResult = -2;
-            break;
-        case ECONNREFUSED:
-            setError(QAbstractSocket::ConnectionRefusedError, ConnectionRefusedErrorString);
-            break;
-        default:
-            setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+                     + sizeof(quintptr) - 1) / sizeof(quintptr)];
+};
+
+/*
+    Fills \a header from the sender address \a aa and the ancillary
+    data of the received message \a msg.
+*/
+static void qt_parseDatagramHeader(msghdr *msg, const qt_sockaddr *aa, quint16 localPort,
+                                   QIpPacketHeader *header)
+{
+    qt_socket_getPortAndAddress(aa, &header->senderPort, &header->senderAddress);
+    header->destinationPort = localPort;
+    header->endOfRecord = (msg->msg_flags & MSG_EOR) != 0;
+
+    // parse the ancillary data
+    struct cmsghdr *cmsgptr;
+    QT_WARNING_PUSH
+    QT_WARNING_DISABLE_CLANG("-Wsign-compare")
+    for (cmsgptr = CMSG_FIRSTHDR(msg); cmsgptr != nullptr;
+         cmsgptr = CMSG_NXTHDR(msg, cmsgptr)) {
+        QT_WARNING_POP
+        if (cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_PKTINFO
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in6_pktinfo))) {
+            in6_pktinfo *info = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(reinterpret_cast<quint8 *>(&info->ipi6_addr));
+            header->ifindex = info->ipi6_ifindex;
+            if (header->ifindex)
+                header->destinationAddress.setScopeId(QString::number(info->ipi6_ifindex));
         }
-        if (header)
-            header->clear();
-    } else if (options != QAbstractSocketEngine::WantNone) {
-        Q_ASSERT(header);
-        qt_socket_getPortAndAddress(&aa, &header->senderPort, &header->senderAddress);
-        header->destinationPort = localPort;
-        header->endOfRecord = (msg.msg_flags & MSG_EOR) != 0;
-
-        // parse the ancillary data
-        struct cmsghdr *cmsgptr;
-        QT_WARNING_PUSH
-        QT_WARNING_DISABLE_CLANG("-Wsign-compare")
-        for (cmsgptr = CMSG_FIRSTHDR(&msg); cmsgptr != nullptr;
-             cmsgptr = CMSG_NXTHDR(&msg, cmsgptr)) {
-            QT_WARNING_POP
-            if (cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_PKTINFO
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in6_pktinfo))) {
-                in6_pktinfo *info = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(reinterpret_cast<quint8 *>(&info->ipi6_addr));
-                header->ifindex = info->ipi6_ifindex;
-                if (header->ifindex)
-                    header->destinationAddress.setScopeId(QString::number(info->ipi6_ifindex));
-            }
 
 #ifdef IP_PKTINFO
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_PKTINFO
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_pktinfo))) {
-                in_pktinfo *info = reinterpret_cast<in_pktinfo *>(CMSG_DATA(cmsgptr));
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_PKTINFO
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_pktinfo))) {
+            in_pktinfo *info = reinterpret_cast<in_pktinfo *>(CMSG_DATA(cmsgptr));
 
-                header->destinationAddress.setAddress(ntohl(info->ipi_addr.s_addr));
-                header->ifindex = info->ipi_ifindex;
-            }
+            header->destinationAddress.setAddress(ntohl(info->ipi_addr.s_addr));
+            header->ifindex = info->ipi_ifindex;
+        }
 #else
 #  ifdef IP_RECVDSTADDR
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVDSTADDR
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_addr))) {
-                in_addr *addr = reinterpret_cast<in_addr *>(CMSG_DATA(cmsgptr));
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVDSTADDR
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_addr))) {
+            in_addr *addr = reinterpret_cast<in_addr *>(CMSG_DATA(cmsgptr));
 
-                header->destinationAddress.setAddress(ntohl(addr->s_addr));
-            }
+            header->destinationAddress.setAddress(ntohl(addr->s_addr));
+        }
 #  endif
 #  if defined(IP_RECVIF) && defined(Q_OS_BSD4)
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVIF
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sockaddr_dl))) {
-                sockaddr_dl *sdl = reinterpret_cast<sockaddr_dl *>(CMSG_DATA(cmsgptr));
-                header->ifindex = sdl->sdl_index;
-            }
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVIF
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sockaddr_dl))) {
+            sockaddr_dl *sdl = reinterpret_cast<sockaddr_dl *>(CMSG_DATA(cmsgptr));
+            header->ifindex = sdl->sdl_index;
+        }
 #  endif
 #endif
 
-            if (cmsgptr->cmsg_len == CMSG_LEN(sizeof(int))
-                    && ((cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_HOPLIMIT)
-                        || (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_TTL))) {
-                static_assert(sizeof(header->hopLimit) == sizeof(int));
-                memcpy(&header->hopLimit, CMSG_DATA(cmsgptr), sizeof(header->hopLimit));
-            }
+        if (cmsgptr->cmsg_len == CMSG_LEN(sizeof(int))
+                && ((cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_HOPLIMIT)
+                    || (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_TTL))) {
+            static_assert(sizeof(header->hopLimit) == sizeof(int));
+            memcpy(&header->hopLimit, CMSG_DATA(cmsgptr), sizeof(header->hopLimit));
+        }
 
 #ifndef QT_NO_SCTP
-            if (cmsgptr->cmsg_level == IPPROTO_SCTP && cmsgptr->cmsg_type == SCTP_SNDRCV
-                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sctp_sndrcvinfo))) {
-                sctp_sndrcvinfo *rcvInfo = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
+        if (cmsgptr->cmsg_level == IPPROTO_SCTP && cmsgptr->cmsg_type == SCTP_SNDRCV
+            && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sctp_sndrcvinfo))) {
+            sctp_sndrcvinfo *rcvInfo = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
 
-                header->streamNumber = int(rcvInfo->sinfo_stream);
-            }
-#endif
+            header->streamNumber = int(rcvInfo->sinfo_stream);
         }
-    }
-
-#if defined (QNATIVESOCKETENGINE_DEBUG)
-    qDebug("QNativeSocketEnginePrivate::nativeReceiveDatagram(%p \"%s\", %lli, %s, %i) == %lli",
-           data, qt_prettyDebug(data, qMin(recvResult, ssize_t(16)), recvResult).data(), maxSize,
-           (recvResult != -1 && options != QAbstractSocketEngine::WantNone)
-           ? header->senderAddress.toString().toLatin1().constData() : "(unknown)",
-           (recvResult != -1 && options != QAbstractSocketEngine::WantNone)
-           ? header->senderPort : 0, (qint64) recvResult);
 #endif
-
-    return qint64((maxSize || recvResult < 0) ? recvResult : Q_INT64_C(0));
+    }
 }
 
-qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
+/*
+    Sets the destination of \a msg to the one in \a header, storing it in
+    \a aa, and adds the ancillary data for the other fields of \a header
+    to \a control.
+*/
+static void qt_prepareDatagramHeader(QNativeSocketEnginePrivate *d, msghdr *msg, qt_sockaddr *aa,
+                                     QDatagramSendControl *control, const QIpPacketHeader &header)
 {
-    // we use quintptr to force the alignment
-    quintptr cbuf[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
-#ifndef QT_NO_SCTP
-                   + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
-#endif
-                   + sizeof(quintptr) - 1) / sizeof(quintptr)];
-
-    struct cmsghdr *cmsgptr = reinterpret_cast<struct cmsghdr *>(cbuf);
-    struct msghdr msg;
-    struct iovec vec;
-    qt_sockaddr aa;
-
-    memset(&msg, 0, sizeof(msg));
-    memset(&aa, 0, sizeof(aa));
-    vec.iov_base = const_cast<char *>(data);
-    vec.iov_len = len;
-    msg.msg_iov = &vec;
-    msg.msg_iovlen = 1;
-    msg.msg_control = &cbuf;
+    struct cmsghdr *cmsgptr = reinterpret_cast<struct cmsghdr *>(control->buffer);
+    memset(aa, 0, sizeof(*aa));
+    msg->msg_control = control->buffer;
+    msg->msg_controllen = 0;
 
     if (header.destinationPort != 0) {
-        msg.msg_name = &aa.a;
-        setPortAndAddress(header.destinationPort, header.destinationAddress,
-                          &aa, &msg.msg_namelen);
+        msg->msg_name = &aa->a;
+        d->setPortAndAddress(header.destinationPort, header.destinationAddress,
+                             aa, &msg->msg_namelen);
     }
 
-    if (msg.msg_namelen == sizeof(aa.a6)) {
+    if (msg->msg_namelen == sizeof(aa->a6)) {
         if (header.hopLimit != -1) {
-            msg.msg_controllen += CMSG_SPACE(sizeof(int));
+            msg->msg_controllen += CMSG_SPACE(sizeof(int));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(int));
             cmsgptr->cmsg_level = IPPROTO_IPV6;
             cmsgptr->cmsg_type = IPV6_HOPLIMIT;
@@ -1111,7 +1074,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
         if (header.ifindex != 0 || !header.senderAddress.isNull()) {
             struct in6_pktinfo *data = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
             memset(data, 0, sizeof(*data));
-            msg.msg_controllen += CMSG_SPACE(sizeof(*data));
+            msg->msg_controllen += CMSG_SPACE(sizeof(*data));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(*data));
             cmsgptr->cmsg_level = IPPROTO_IPV6;
             cmsgptr->cmsg_type = IPV6_PKTINFO;
@@ -1123,7 +1086,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
         }
     } else {
         if (header.hopLimit != -1) {
-            msg.msg_controllen += CMSG_SPACE(sizeof(int));
+            msg->msg_controllen += CMSG_SPACE(sizeof(int));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(int));
             cmsgptr->cmsg_level = IPPROTO_IP;
             cmsgptr->cmsg_type = IP_TTL;
@@ -1145,7 +1108,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
             data->s_addr = htonl(header.senderAddress.toIPv4Address());
 #  endif
             cmsgptr->cmsg_level = IPPROTO_IP;
-            msg.msg_controllen += CMSG_SPACE(sizeof(*data));
+            msg->msg_controllen += CMSG_SPACE(sizeof(*data));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(*data));
             cmsgptr = reinterpret_cast<cmsghdr *>(reinterpret_cast<char *>(cmsgptr) + CMSG_SPACE(sizeof(*data)));
         }
@@ -1156,7 +1119,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     if (header.streamNumber != -1) {
         struct sctp_sndrcvinfo *data = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
         memset(data, 0, sizeof(*data));
-        msg.msg_controllen += CMSG_SPACE(sizeof(sctp_sndrcvinfo));
+        msg->msg_controllen += CMSG_SPACE(sizeof(sctp_sndrcvinfo));
         cmsgptr->cmsg_len = CMSG_LEN(sizeof(sctp_sndrcvinfo));
         cmsgptr->cmsg_level = IPPROTO_SCTP;
         cmsgptr->cmsg_type =  SCTP_SNDRCV;
@@ -1165,8 +1128,89 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     }
 #endif
 
-    if (msg.msg_controllen == 0)
-        msg.msg_control = nullptr;
+    if (msg->msg_controllen == 0)
+        msg->msg_control = nullptr;
+}
+
+qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxSize, QIpPacketHeader *header,
+                                                         QAbstractSocketEngine::PacketHeaderOptions options)
+{
+    QDatagramReceiveControl cbuf;
+
+    struct msghdr msg;
+    struct iovec vec;
+    qt_sockaddr aa;
+    char c;
+    memset(&msg, 0, sizeof(msg));
+    memset(&aa, 0, sizeof(aa));
+
+    // we need to receive at least one byte, even if our user isn't interested in it
+    vec.iov_base = maxSize ? data : &c;
+    vec.iov_len = maxSize ? maxSize : 1;
+    msg.msg_iov = &vec;
+    msg.msg_iovlen = 1;
+    if (options & QAbstractSocketEngine::WantDatagramSender) {
+        msg.msg_name = &aa;
+        msg.msg_namelen = sizeof(aa);
+    }
+    if (options & (QAbstractSocketEngine::WantDatagramHopLimit | QAbstractSocketEngine::WantDatagramDestination
+                   | QAbstractSocketEngine::WantStreamNumber)) {
+        msg.msg_control = cbuf.buffer;
+        msg.msg_controllen = sizeof(cbuf.buffer);
+    }
+
+    ssize_t recvResult = 0;
+    do {
+        recvResult = ::recvmsg(socketDescriptor, &msg, 0);
+    } while (recvResult == -1 && errno == EINTR);
+
+    if (recvResult == -1) {
+        switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            // No datagram was available for reading
+            recvResult = -2;
+            break;
+        case ECONNREFUSED:
+            setError(QAbstractSocket::ConnectionRefusedError, ConnectionRefusedErrorString);
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+        }
+        if (header)
+            header->clear();
+    } else if (options != QAbstractSocketEngine::WantNone) {
+        Q_ASSERT(header);
+        qt_parseDatagramHeader(&msg, &aa, localPort, header);
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeReceiveDatagram(%p \"%s\", %lli, %s, %i) == %lli",
+           data, qt_prettyDebug(data, qMin(recvResult, ssize_t(16)), recvResult).data(), maxSize,
+           (recvResult != -1 && options != QAbstractSocketEngine::WantNone)
+           ? header->senderAddress.toString().toLatin1().constData() : "(unknown)",
+           (recvResult != -1 && options != QAbstractSocketEngine::WantNone)
+           ? header->senderPort : 0, (qint64) recvResult);
+#endif
+
+    return qint64((maxSize || recvResult < 0) ? recvResult : Q_INT64_C(0));
+}
+
+qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
+{
+    QDatagramSendControl cbuf;
+    struct msghdr msg;
+    struct iovec vec;
+    qt_sockaddr aa;
+
+    memset(&msg, 0, sizeof(msg));
+    vec.iov_base = const_cast<char *>(data);
+    vec.iov_len = len;
+    msg.msg_iov = &vec;
+    msg.msg_iovlen = 1;
+    qt_prepareDatagramHeader(this, &msg, &aa, &cbuf, header);
     ssize_t sentBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
 
     if (sentBytes < 0) {
@@ -1198,6 +1242,139 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     return qint64(sentBytes);
 }
 
+#ifdef Q_OS_LINUX
+// the number of datagrams moved by one recvmmsg() or sendmmsg() call
+static const int MaxDatagramBatch = 64;
+
+int QNativeSocketEnginePrivate::nativeReceiveDatagrams(QNetworkDatagramPrivate * const *datagrams,
+                                                       int count,
+                                                       QAbstractSocketEngine::PacketHeaderOptions options)
+{
+    count = qMin(count, MaxDatagramBatch);
+    if (count <= 0)
+        return 0;
+
+    const bool wantSender = options & QAbstractSocketEngine::WantDatagramSender;
+    const bool wantControl = options & (QAbstractSocketEngine::WantDatagramHopLimit
+                                        | QAbstractSocketEngine::WantDatagramDestination
+                                        | QAbstractSocketEngine::WantStreamNumber);
+    mmsghdr msgs[MaxDatagramBatch];
+    iovec vecs[MaxDatagramBatch];
+    qt_sockaddr addrs[MaxDatagramBatch];
+    QDatagramReceiveControl cbufs[MaxDatagramBatch];
+    char c;
+
+    memset(msgs, 0, count * sizeof(mmsghdr));
+    for (int i = 0; i < count; ++i) {
+        QByteArray &data = datagrams[i]->data;
+        msghdr &msg = msgs[i].msg_hdr;
+        // we need to receive at least one byte, even if our user isn't interested in it
+        vecs[i].iov_base = data.isEmpty() ? &c : data.data();
+        vecs[i].iov_len = data.isEmpty() ? 1 : size_t(data.size());
+        msg.msg_iov = &vecs[i];
+        msg.msg_iovlen = 1;
+        if (wantSender) {
+            memset(&addrs[i], 0, sizeof(qt_sockaddr));
+            msg.msg_name = &addrs[i];
+            msg.msg_namelen = sizeof(qt_sockaddr);
+        }
+        if (wantControl) {
+            msg.msg_control = cbufs[i].buffer;
+            msg.msg_controllen = sizeof(cbufs[i].buffer);
+        }
+    }
+
+    int received;
+    EINTR_LOOP(received, ::recvmmsg(socketDescriptor, msgs, uint(count), 0, nullptr));
+
+    if (received < 0) {
+        switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            // No datagram was available for reading
+            received = -2;
+            break;
+        case ECONNREFUSED:
+            setError(QAbstractSocket::ConnectionRefusedError, ConnectionRefusedErrorString);
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+        }
+        return received;
+    }
+
+    for (int i = 0; i < received; ++i) {
+        QNetworkDatagramPrivate *datagram = datagrams[i];
+        datagram->data.truncate(qMin(qsizetype(msgs[i].msg_len), datagram->data.size()));
+        if (options != QAbstractSocketEngine::WantNone)
+            qt_parseDatagramHeader(&msgs[i].msg_hdr, &addrs[i], localPort, &datagram->header);
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeReceiveDatagrams(%p, %i) == %i",
+           datagrams, count, received);
+#endif
+
+    return received;
+}
+
+int QNativeSocketEnginePrivate::nativeSendDatagrams(const QNetworkDatagramPrivate * const *datagrams,
+                                                    int count)
+{
+    count = qMin(count, MaxDatagramBatch);
+    if (count <= 0)
+        return 0;
+
+    mmsghdr msgs[MaxDatagramBatch];
+    iovec vecs[MaxDatagramBatch];
+    qt_sockaddr addrs[MaxDatagramBatch];
+    QDatagramSendControl cbufs[MaxDatagramBatch];
+
+    memset(msgs, 0, count * sizeof(mmsghdr));
+    for (int i = 0; i < count; ++i) {
+        const QNetworkDatagramPrivate *datagram = datagrams[i];
+        msghdr &msg = msgs[i].msg_hdr;
+        vecs[i].iov_base = const_cast<char *>(datagram->data.constData());
+        vecs[i].iov_len = size_t(datagram->data.size());
+        msg.msg_iov = &vecs[i];
+        msg.msg_iovlen = 1;
+        qt_prepareDatagramHeader(this, &msg, &addrs[i], &cbufs[i], datagram->header);
+    }
+
+    int sent;
+    qt_ignore_sigpipe();
+    EINTR_LOOP(sent, ::sendmmsg(socketDescriptor, msgs, uint(count), MSG_NOSIGNAL));
+
+    if (sent < 0) {
+        switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            sent = -2;
+            break;
+        case EMSGSIZE:
+            setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+            break;
+        case ECONNRESET:
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, SendDatagramErrorString);
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeSendDatagrams(%p, %i) == %i",
+           datagrams, count, sent);
+#endif
+
+    return sent;
+}
+#endif // Q_OS_LINUX
+
 bool QNativeSocketEnginePrivate::fetchConnectionParameters()
 {
     localPort = 0;
@@ -1327,12 +1504,32 @@ void QNativeSocketEnginePrivate::nativeClose()
 #endif
 
     qt_safe_close(socketDescriptor);
+    closeDescriptors();
+}
+
+// Linux's SCM_MAX_FD; other systems accept at least as many
+static const int MaxDescriptorsPerMessage = 253;
+
+void QNativeSocketEnginePrivate::closeDescriptors()
+{
+    for (int fd : qAsConst(outgoingDescriptors))
+        qt_safe_close(fd);
+    for (int fd : qAsConst(receivedDescriptors))
+        qt_safe_close(fd);
+    outgoingDescriptors.clear();
+    receivedDescriptors.clear();
 }
 
 qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
 {
     Q_Q(QNativeSocketEngine);
 
+    // descriptors have to travel in a sendmsg() control message
+    if (!outgoingDescriptors.isEmpty()) {
+        const QByteArrayView chunk(data, qsizetype(len));
+        return nativeWriteChunks(&chunk, 1);
+    }
+
     ssize_t writtenBytes;
     writtenBytes = qt_safe_write_nosignal(socketDescriptor, data, len);
 
@@ -1363,6 +1560,117 @@ qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
 
     return qint64(writtenBytes);
 }
+
+qint64 QNativeSocketEnginePrivate::nativeWriteChunks(const QByteArrayView *chunks, qsizetype count)
+{
+    Q_Q(QNativeSocketEngine);
+
+    QVarLengthArray<iovec, 16> vec;
+    for (qsizetype i = 0; i < count && vec.size() < IOV_MAX; ++i) {
+        if (chunks[i].isEmpty())
+            continue;
+        iovec v;
+        v.iov_base = const_cast<char *>(chunks[i].data());
+        v.iov_len = size_t(chunks[i].size());
+        vec.append(v);
+    }
+    if (vec.isEmpty())
+        return 0;
+
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = vec.data();
+    msg.msg_iovlen = vec.size();
+
+    union {
+        cmsghdr header;
+        char buffer[CMSG_SPACE(MaxDescriptorsPerMessage * sizeof(int))];
+    } control;
+    const int descriptorCount = qMin(int(outgoingDescriptors.size()), MaxDescriptorsPerMessage);
+    if (descriptorCount) {
+        memset(&control, 0, sizeof(control));
+        msg.msg_control = control.buffer;
+        msg.msg_controllen = CMSG_SPACE(descriptorCount * sizeof(int));
+        cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(descriptorCount * sizeof(int));
+        memcpy(CMSG_DATA(cmsg), outgoingDescriptors.constData(), descriptorCount * sizeof(int));
+    }
+
+    ssize_t writtenBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
+    if (writtenBytes > 0 && descriptorCount) {
+        // the peer has its own copies now
+        for (int i = 0; i < descriptorCount; ++i)
+            qt_safe_close(outgoingDescriptors.at(i));
+        outgoingDescriptors.remove(0, descriptorCount);
+    }
+    if (writtenBytes < 0) {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+        case EAGAIN:
+            writtenBytes = 0;
+            break;
+        default:
+            setError(QAbstractSocket::UnknownSocketError, WriteErrorString);
+            break;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteChunks(%p, %lld) == %lld",
+           chunks, qint64(count), qint64(writtenBytes));
+#endif
+
+    return qint64(writtenBytes);
+}
+
+#ifdef Q_OS_LINUX
+qint64 QNativeSocketEnginePrivate::nativeSendFile(int fileDescriptor, qint64 offset, qint64 len)
+{
+    Q_Q(QNativeSocketEngine);
+
+    // sendfile() transfers at most 0x7ffff000 bytes per call anyway
+    const size_t chunk = size_t(qMin(len, qint64(0x7ffff000)));
+    off_t fileOffset = offset;
+    ssize_t sentBytes;
+    qt_ignore_sigpipe();
+    EINTR_LOOP(sentBytes, ::sendfile(socketDescriptor, fileDescriptor, &fileOffset, chunk));
+
+    if (sentBytes < 0) {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+        case EAGAIN:
+            sentBytes = 0;
+            break;
+        default:
+            setError(QAbstractSocket::UnknownSocketError, WriteErrorString);
+            break;
+        }
+    } else if (sentBytes == 0 && len > 0) {
+        // the file is shorter than it was when the transfer was queued
+        setError(QAbstractSocket::UnknownSocketError, WriteErrorString);
+        sentBytes = -1;
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeSendFile(%d, %lld, %lld) == %lld",
+           fileDescriptor, offset, len, qint64(sentBytes));
+#endif
+
+    return qint64(sentBytes);
+}
+#endif
+
 /*
 */
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
@@ -1374,7 +1682,46 @@ qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
     }
 
     ssize_t r = 0;
-    r = qt_safe_read(socketDescriptor, data, maxSize);
+    if (receiveDescriptors) {
+        // read() would make the kernel discard any descriptors sent to us
+        iovec vec;
+        vec.iov_base = data;
+        vec.iov_len = size_t(maxSize);
+        union {
+            cmsghdr header;
+            char buffer[CMSG_SPACE(MaxDescriptorsPerMessage * sizeof(int))];
+        } control;
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &vec;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.buffer;
+        msg.msg_controllen = sizeof(control.buffer);
+
+        int flags = 0;
+#ifdef MSG_CMSG_CLOEXEC
+        flags |= MSG_CMSG_CLOEXEC;
+#endif
+        r = qt_safe_recvmsg(socketDescriptor, &msg, flags);
+        if (r >= 0) {
+            for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+                if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+                    continue;
+                const int count = int((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+                const uchar *fds = reinterpret_cast<const uchar *>(CMSG_DATA(cmsg));
+                for (int i = 0; i < count; ++i) {
+                    int fd;
+                    memcpy(&fd, fds + i * sizeof(int), sizeof(int));
+#ifndef MSG_CMSG_CLOEXEC
+                    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+                    receivedDescriptors.append(fd);
+                }
+            }
+        }
+    } else {
+        r = qt_safe_read(socketDescriptor, data, maxSize);
+    }
 
     if (r < 0) {
         r = -1;
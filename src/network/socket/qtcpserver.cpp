@@ -124,6 +124,7 @@ QTcpServerPrivate::QTcpServerPrivate()
  , socketEngine(nullptr)
  , serverSocketError(QAbstractSocket::UnknownSocketError)
  , maxConnections(30)
+ , portSharing(false)
 {
 }
 
@@ -325,6 +326,12 @@ bool QTcpServer::listen(const QHostAddress &address, quint16 port)
 
     d->configureCreatedSocket();
 
+    if (d->portSharing && !d->socketEngine->setOption(QAbstractSocketEngine::PortReusable, 1)) {
+        d->serverSocketError = QAbstractSocket::UnsupportedSocketOperationError;
+        d->serverSocketErrorString = tr("Port sharing is not supported");
+        return false;
+    }
+
     if (!d->socketEngine->bind(addr, port)) {
         d->serverSocketError = d->socketEngine->error();
         d->serverSocketErrorString = d->socketEngine->errorString();
@@ -589,6 +596,8 @@ QTcpSocket *QTcpServer::nextPendingConnection()
     to the other thread and create the QTcpSocket object there and
     use its setSocketDescriptor() method.
 
+    \note On Unix, the \a socketDescriptor is already in non-blocking mode.
+
     \sa newConnection(), nextPendingConnection(), addPendingConnection()
 */
 void QTcpServer::incomingConnection(qintptr socketDescriptor)
@@ -649,6 +658,47 @@ int QTcpServer::maxPendingConnections() const
     return d_func()->maxConnections;
 }
 
+/*!
+    \since 6.0
+
+    Sets whether listen() lets other sockets listen on the same address
+    and port to \a enabled. This must be set before calling listen(); by
+    default, it is disabled.
+
+    With port sharing, a server can spread the cost of accepting
+    connections over several threads: instead of accepting in one thread
+    and passing the descriptors on with QTcpSocket::setSocketDescriptor(),
+    create a QTcpServer with port sharing enabled in each worker thread
+    and have each listen on the same port. The operating system then
+    distributes incoming connections among the listening sockets, and
+    each connection is accepted and handled in the event loop of the
+    thread that owns the server.
+
+    On Unix, this is equivalent to the SO_REUSEPORT socket option; on
+    Linux, only sockets created by processes of the same user may share a
+    port. On systems without SO_REUSEPORT, such as Windows, and when the
+    server uses a proxy, listen() fails with
+    QAbstractSocket::UnsupportedSocketOperationError.
+
+    \sa isPortSharingEnabled(), listen()
+*/
+void QTcpServer::setPortSharingEnabled(bool enabled)
+{
+    d_func()->portSharing = enabled;
+}
+
+/*!
+    \since 6.0
+
+    Returns \c true if port sharing is enabled; otherwise returns \c false.
+
+    \sa setPortSharingEnabled()
+*/
+bool QTcpServer::isPortSharingEnabled() const
+{
+    return d_func()->portSharing;
+}
+
 /*!
     Returns an error code for the last error that occurred.
 
@@ -102,11 +102,16 @@
 #include "qnetworkdatagram.h"
 #include "qnetworkinterface.h"
 #include "qabstractsocket_p.h"
+#include "private/qnetworkdatagram_p.h"
+#include <qvarlengtharray.h>
 
 QT_BEGIN_NAMESPACE
 
 #ifndef QT_NO_UDPSOCKET
 
+// the most datagrams handed to the socket engine at once
+static const int DatagramBatchSize = 64;
+
 #define QT_CHECK_BOUND(function, a) do { \
     if (!isValid()) { \
         qWarning(function" called on a QUdpSocket when not in QUdpSocket::BoundState"); \
@@ -431,6 +436,137 @@ qint64 QUdpSocket::writeDatagram(const QNetworkDatagram &datagram)
     return sent;
 }
 
+/*!
+    \since 6.0
+
+    Sends the \a count datagrams in the array \a datagrams, each to the
+    destination and with the options set on it, as writeDatagram() would.
+    Returns the number of datagrams sent, which may be less than \a count
+    if the socket's send buffer filled up, or -1 if an error occurred
+    before anything was sent. bytesWritten() is emitted for each datagram.
+
+    On Linux, the datagrams are passed to the kernel in batches with
+    sendmmsg(), which saves a system call per datagram.
+
+    \sa writeDatagram(), receiveDatagrams()
+*/
+int QUdpSocket::writeDatagrams(const QNetworkDatagram *datagrams, int count)
+{
+    Q_D(QUdpSocket);
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::writeDatagrams(%p, %i)", datagrams, count);
+#endif
+    if (count <= 0)
+        return 0;
+    if (!d->doEnsureInitialized(QHostAddress::Any, 0, datagrams[0].destinationAddress()))
+        return -1;
+    if (state() == UnconnectedState)
+        bind();
+
+    QVarLengthArray<const QNetworkDatagramPrivate *, DatagramBatchSize> batch;
+    int total = 0;
+    while (total < count) {
+        batch.clear();
+        for (int i = total; i < count && batch.size() < DatagramBatchSize; ++i)
+            batch.append(datagrams[i].d);
+
+        const int sent = d->socketEngine->writeDatagrams(batch.constData(), int(batch.size()));
+        if (sent < 0) {
+            if (total)
+                break;
+            if (sent == -2) {
+                // Socket engine reports EAGAIN. Treat as a temporary error.
+                d->setErrorAndEmit(QAbstractSocket::TemporaryError,
+                                   tr("Unable to send a datagram"));
+            } else {
+                d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+            }
+            return -1;
+        }
+        for (int i = 0; i < sent; ++i)
+            emit bytesWritten(batch.at(i)->data.size());
+        total += sent;
+        if (sent < batch.size())
+            break;
+    }
+    d->cachedSocketDescriptor = d->socketEngine->socketDescriptor();
+    return total;
+}
+
+/*!
+    \since 6.0
+
+    Receives up to \a maxCount pending datagrams into the array \a
+    datagrams, storing at most \a maxSize bytes of each, along with the
+    sender, destination and hop limit as receiveDatagram() does. Returns
+    the number of datagrams received, 0 if none was pending, or -1 if an
+    error occurred.
+
+    The entries of \a datagrams act as a buffer pool: the payload storage
+    of an entry is reused when it is not shared and already large enough,
+    so a caller that keeps the same array across calls, and does not keep
+    copies of the payloads, receives without allocating memory. The
+    payloads of entries past the returned count are emptied.
+
+    On Linux, the datagrams are fetched from the kernel in batches with
+    recvmmsg(), which saves a system call per datagram.
+
+    \sa receiveDatagram(), writeDatagrams(), hasPendingDatagrams()
+*/
+int QUdpSocket::receiveDatagrams(QNetworkDatagram *datagrams, int maxCount, qint64 maxSize)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::receiveDatagrams(%p, %i, %lld)", datagrams, maxCount, maxSize);
+#endif
+    QT_CHECK_BOUND("QUdpSocket::receiveDatagrams()", -1);
+    if (maxCount <= 0 || maxSize < 0)
+        return 0;
+
+    QVarLengthArray<QNetworkDatagramPrivate *, DatagramBatchSize> batch;
+    int total = 0;
+    int prepared = 0;
+    bool failed = false;
+    while (total < maxCount) {
+        batch.clear();
+        for (int i = total; i < maxCount && batch.size() < DatagramBatchSize; ++i) {
+            QNetworkDatagram &datagram = datagrams[i];
+            if (!datagram.d)
+                datagram.d = new QNetworkDatagramPrivate;
+            QByteArray &payload = datagram.d->data;
+            if (payload.isDetached() && payload.capacity() >= maxSize)
+                payload.resize(maxSize);
+            else
+                payload = QByteArray(maxSize, Qt::Uninitialized);
+            datagram.d->header.clear();
+            batch.append(datagram.d);
+        }
+        prepared = qMax(prepared, total + int(batch.size()));
+
+        const int received = d->socketEngine->readDatagrams(batch.constData(), int(batch.size()),
+                                                            QAbstractSocketEngine::WantAll);
+        if (received < 0) {
+            failed = (received == -1 && total == 0);
+            break;
+        }
+        total += received;
+        if (received < batch.size())
+            break;
+    }
+
+    for (int i = total; i < prepared; ++i)
+        datagrams[i].d->data.truncate(0);
+
+    d->hasPendingData = false;
+    d->socketEngine->setReadNotificationEnabled(true);
+    if (failed) {
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+        return -1;
+    }
+    return total;
+}
+
 /*!
     \since 5.8
 
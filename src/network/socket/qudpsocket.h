@@ -76,11 +76,13 @@ public:
     qint64 pendingDatagramSize() const;
     QNetworkDatagram receiveDatagram(qint64 maxSize = -1);
     qint64 readDatagram(char *data, qint64 maxlen, QHostAddress *host = nullptr, quint16 *port = nullptr);
+    int receiveDatagrams(QNetworkDatagram *datagrams, int maxCount, qint64 maxSize);
 
     qint64 writeDatagram(const QNetworkDatagram &datagram);
     qint64 writeDatagram(const char *data, qint64 len, const QHostAddress &host, quint16 port);
     inline qint64 writeDatagram(const QByteArray &datagram, const QHostAddress &host, quint16 port)
         { return writeDatagram(datagram.constData(), datagram.size(), host, port); }
+    int writeDatagrams(const QNetworkDatagram *datagrams, int count);
 
 private:
     Q_DISABLE_COPY_MOVE(QUdpSocket)
@@ -50,6 +50,8 @@
 #include "private/qsslsocket_openssl_symbols_p.h"
 #include "private/qssldiffiehellmanparameters_p.h"
 
+#include <QtCore/qmutex.h>
+
 #include <vector>
 
 QT_BEGIN_NAMESPACE
@@ -78,6 +80,98 @@ extern "C" int q_ssl_sess_set_new_cb(SSL *context, SSL_SESSION *session);
 // Defined in qsslsocket.cpp
 QList<QSslCipher> q_getDefaultDtlsCiphers();
 
+namespace {
+
+// Contexts that trust the same set of CA certificates share one X509_STORE.
+// Filling a store from a long CA list is a large part of the cost of creating
+// a context, and OpenSSL only reads the store once the context is set up. The
+// cache holds a reference to each of its stores and every context another
+// one, so evicting an entry never invalidates a store that is still in use.
+class QSslCertificateStoreCache
+{
+public:
+    ~QSslCertificateStoreCache()
+    {
+        for (const Entry &entry : qAsConst(entries))
+            q_X509_STORE_free(entry.store);
+    }
+
+    // Returns a new reference to a store for caCertificates, or nullptr.
+    X509_STORE *acquire(const QList<QSslCertificate> &caCertificates, bool loadOnDemand)
+    {
+        QMutexLocker locker(&mutex);
+        for (qsizetype i = entries.size() - 1; i >= 0; --i) {
+            const Entry &entry = entries.at(i);
+            if (entry.loadOnDemand == loadOnDemand && entry.caCertificates == caCertificates) {
+                X509_STORE *store = entry.store;
+                entries.move(i, entries.size() - 1);
+                q_X509_STORE_up_ref(store);
+                return store;
+            }
+        }
+
+        X509_STORE *store = createStore(caCertificates, loadOnDemand);
+        if (!store)
+            return nullptr;
+
+        if (entries.size() == MaxEntries) {
+            q_X509_STORE_free(entries.constFirst().store);
+            entries.removeFirst();
+        }
+        entries.append({caCertificates, loadOnDemand, store});
+        q_X509_STORE_up_ref(store);
+        return store;
+    }
+
+private:
+    static X509_STORE *createStore(const QList<QSslCertificate> &caCertificates, bool loadOnDemand)
+    {
+        X509_STORE *store = q_X509_STORE_new();
+        if (!store)
+            return nullptr;
+
+        for (const QSslCertificate &caCertificate : caCertificates)
+            q_X509_STORE_add_cert(store, (X509 *)caCertificate.handle());
+
+        if (loadOnDemand) {
+            // tell OpenSSL the directories where to look up the root certs on demand
+            const QList<QByteArray> unixDirs = QSslSocketPrivate::unixRootCertDirectories();
+            int success = 1;
+            for (const QByteArray &unixDir : unixDirs) {
+#if OPENSSL_VERSION_MAJOR < 3
+                if ((success = q_X509_STORE_load_locations(store, nullptr, unixDir.constData())) != 1)
+                    break;
+#else
+                if ((success = q_X509_STORE_load_path(store, unixDir.constData())) != 1)
+                    break;
+#endif // OPENSSL_VERSION_MAJOR
+            }
+            if (success != 1) {
+                const auto qtErrors = QSslSocketBackendPrivate::getErrorsFromOpenSsl();
+                qCWarning(lcSsl) << "An error encountered while to set root certificates location:"
+                                  << qtErrors;
+            }
+        }
+        return store;
+    }
+
+    struct Entry
+    {
+        QList<QSslCertificate> caCertificates;
+        bool loadOnDemand;
+        X509_STORE *store;
+    };
+
+    enum { MaxEntries = 8 };
+
+    QMutex mutex;
+    QList<Entry> entries; // least recently used first
+};
+
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QSslCertificateStoreCache, certificateStoreCache)
+
 static inline QString msgErrorSettingBackendConfig(const QString &why)
 {
     return QSslSocket::tr("Error when setting the OpenSSL configuration (%1)").arg(why);
@@ -483,8 +577,10 @@ init_context:
 
     const QDateTime now = QDateTime::currentDateTimeUtc();
 
-    // Add all our CAs to this store.
+    // Collect all our CAs for this context's store.
+    QList<QSslCertificate> validCaCertificates;
     const auto caCertificates = sslContext->sslConfiguration.caCertificates();
+    validCaCertificates.reserve(caCertificates.size());
     for (const QSslCertificate &caCertificate : caCertificates) {
         // From https://www.openssl.org/docs/ssl/SSL_CTX_load_verify_locations.html:
         //
@@ -497,32 +593,22 @@ init_context:
         // certificates mixed with valid ones.
         //
         // See also: QSslSocketBackendPrivate::verify()
-        if (caCertificate.expiryDate() >= now) {
-            q_X509_STORE_add_cert(q_SSL_CTX_get_cert_store(sslContext->ctx), (X509 *)caCertificate.handle());
-        }
+        if (caCertificate.expiryDate() >= now)
+            validCaCertificates.append(caCertificate);
     }
 
-    if (QSslSocketPrivate::s_loadRootCertsOnDemand && allowRootCertOnDemandLoading) {
-        // tell OpenSSL the directories where to look up the root certs on demand
-        const QList<QByteArray> unixDirs = QSslSocketPrivate::unixRootCertDirectories();
-        int success = 1;
-#if OPENSSL_VERSION_MAJOR < 3
-        for (const QByteArray &unixDir : unixDirs) {
-            if ((success = q_SSL_CTX_load_verify_locations(sslContext->ctx, nullptr, unixDir.constData())) != 1)
-                break;
-        }
-#else
-        for (const QByteArray &unixDir : unixDirs) {
-            if ((success = q_SSL_CTX_load_verify_dir(sslContext->ctx, unixDir.constData())) != 1)
-                break;
-        }
-#endif // OPENSSL_VERSION_MAJOR
-        if (success != 1) {
-            const auto qtErrors = QSslSocketBackendPrivate::getErrorsFromOpenSsl();
-            qCWarning(lcSsl) << "An error encountered while to set root certificates location:"
-                              << qtErrors;
-        }
+    // The expired certificates are filtered out before the lookup, so a store
+    // built earlier is not reused once one of its CAs has expired.
+    const bool loadOnDemand = QSslSocketPrivate::s_loadRootCertsOnDemand && allowRootCertOnDemandLoading;
+    X509_STORE *certStore = certificateStoreCache()->acquire(validCaCertificates, loadOnDemand);
+    if (!certStore) {
+        sslContext->errorStr = QSslSocket::tr("Error creating SSL context (%1)").arg(
+            QSslSocketBackendPrivate::getErrorsFromOpenSsl());
+        sslContext->errorCode = QSslError::UnspecifiedError;
+        return;
     }
+    // Takes over our reference and releases the context's default store.
+    q_SSL_CTX_set_cert_store(sslContext->ctx, certStore);
 
     if (!sslContext->sslConfiguration.localCertificate().isNull()) {
         // Require a private key as well.
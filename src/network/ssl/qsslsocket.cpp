@@ -423,6 +423,8 @@ public:
     QList<QSslEllipticCurve> supportedEllipticCurves;
     QExplicitlySharedDataPointer<QSslConfigurationPrivate> config;
     QExplicitlySharedDataPointer<QSslConfigurationPrivate> dtlsConfig;
+    int sessionCacheCapacity = 64;
+    int sessionCacheTimeout = 7200;
 };
 Q_GLOBAL_STATIC(QSslSocketGlobalData, globalData)
 
@@ -1546,6 +1548,81 @@ QString QSslSocket::sslLibraryBuildVersionString()
     return QSslSocketPrivate::sslLibraryBuildVersionString();
 }
 
+/*!
+    \since 6.0
+
+    Returns the maximum number of TLS sessions kept in the process-wide
+    session cache. The default is 64.
+
+    Client sockets store the sessions of their successful handshakes in
+    this cache, keyed by peer name, port, server name and the parts of
+    the configuration that affect verification. A later client socket
+    connecting to the same server with an equivalent configuration
+    resumes one of these sessions instead of doing a full handshake,
+    even if it does not share a QSslConfiguration or a
+    QNetworkAccessManager with the first one. TLS 1.3 session tickets are
+    cached as they arrive. The cache is thread-safe.
+
+    Sessions from handshakes that reported errors are only cached if the
+    socket does not verify its peer. Sockets with
+    QSsl::SslOptionDisableSessionSharing set do not use the cache.
+
+    \note This cache is only implemented by the OpenSSL backend.
+
+    \sa setSessionCacheCapacity(), sessionCacheTimeout(), QSslConfiguration::sessionTicket()
+*/
+int QSslSocket::sessionCacheCapacity()
+{
+    const QMutexLocker locker(&globalData()->mutex);
+    return globalData()->sessionCacheCapacity;
+}
+
+/*!
+    \since 6.0
+
+    Sets the maximum number of TLS sessions kept in the process-wide
+    session cache to \a capacity. When the cache is full, the least
+    recently used session is dropped. A \a capacity of 0 disables the
+    cache and drops all sessions stored in it.
+
+    \sa sessionCacheCapacity(), setSessionCacheTimeout()
+*/
+void QSslSocket::setSessionCacheCapacity(int capacity)
+{
+    const QMutexLocker locker(&globalData()->mutex);
+    globalData()->sessionCacheCapacity = qMax(capacity, 0);
+}
+
+/*!
+    \since 6.0
+
+    Returns the time, in seconds, a TLS session is kept in the
+    process-wide session cache. The default is 7200 seconds. A session
+    is dropped earlier if the server's ticket lifetime hint is shorter.
+
+    \sa setSessionCacheTimeout(), sessionCacheCapacity()
+*/
+int QSslSocket::sessionCacheTimeout()
+{
+    const QMutexLocker locker(&globalData()->mutex);
+    return globalData()->sessionCacheTimeout;
+}
+
+/*!
+    \since 6.0
+
+    Sets the time, in seconds, a TLS session is kept in the process-wide
+    session cache to \a seconds. The new timeout applies to sessions
+    cached from then on.
+
+    \sa sessionCacheTimeout(), setSessionCacheCapacity()
+*/
+void QSslSocket::setSessionCacheTimeout(int seconds)
+{
+    const QMutexLocker locker(&globalData()->mutex);
+    globalData()->sessionCacheTimeout = qMax(seconds, 0);
+}
+
 /*!
     Starts a delayed SSL handshake for a client connection. This
     function can be called when the socket is in the \l ConnectedState
@@ -1816,10 +1893,14 @@ qint64 QSslSocket::writeData(const char *data, qint64 len)
 #ifdef QSSLSOCKET_DEBUG
     qCDebug(lcSsl) << "QSslSocket::writeData(" << (void *)data << ',' << len << ')';
 #endif
-    if (d->mode == UnencryptedMode && !d->autoStartHandshake)
-        return d->plainSocket->write(data, len);
+    if (d->mode == UnencryptedMode && !d->autoStartHandshake) {
+        const qint64 written = d->plainSocket->write(data, len);
+        d->updateWriteBufferLevel();
+        return written;
+    }
 
     d->write(data, len);
+    d->updateWriteBufferLevel();
 
     // make sure we flush to the plain socket's buffer
     if (!d->flushTriggered) {
@@ -2379,6 +2460,7 @@ void QSslSocketPrivate::_q_bytesWrittenSlot(qint64 written)
         emit q->bytesWritten(written);
     else
         emit q->encryptedBytesWritten(written);
+    updateWriteBufferLevel();
     if (state == QAbstractSocket::ClosingState && writeBuffer.isEmpty())
         q->disconnectFromHost();
 }
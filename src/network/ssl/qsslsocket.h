@@ -163,6 +163,11 @@ public:
     static long sslLibraryBuildVersionNumber();
     static QString sslLibraryBuildVersionString();
 
+    static int sessionCacheCapacity();
+    static void setSessionCacheCapacity(int capacity);
+    static int sessionCacheTimeout();
+    static void setSessionCacheTimeout(int seconds);
+
     void ignoreSslErrors(const QList<QSslError> &errors);
     void continueInterruptedHandshake();
 
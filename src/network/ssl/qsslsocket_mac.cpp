@@ -579,6 +579,7 @@ void QSslSocketBackendPrivate::transmit()
                 emittedBytesWritten = false;
             }
             emit q->channelBytesWritten(0, totalBytesWritten);
+            updateWriteBufferLevel();
         }
     }
 
@@ -58,6 +58,7 @@
 #include "qssl_p.h"
 #include "qsslsocket_openssl_p.h"
 #include "qsslsocket_openssl_symbols_p.h"
+#include "qtlssessioncache_openssl_p.h"
 #include "qsslsocket.h"
 #include "qsslcertificate_p.h"
 #include "qsslcipher_p.h"
@@ -403,8 +404,74 @@ int qt_OCSP_status_server_callback(SSL *ssl, void *ocspRequest)
 
 #endif // ocsp
 
+// The write BIO installed once the handshake is done (see
+// QSslSocketBackendPrivate::useSocketWriteBio()). It hands the encrypted
+// records straight to the plain socket.
+static int q_ssl_socket_bio_write(BIO *bio, const char *src, int bytesToWrite)
+{
+    q_BIO_clear_retry_flags(bio);
+
+    auto socketPrivate = static_cast<QSslSocketBackendPrivate *>(q_BIO_get_data(bio));
+    Q_ASSERT(socketPrivate);
+    const int written = socketPrivate->writeToPlainSocket(src, bytesToWrite);
+    if (written == 0)
+        q_BIO_set_retry_write(bio);
+    return written;
+}
+
+static long q_ssl_socket_bio_ctrl(BIO *bio, int cmd, long num, void *ptr)
+{
+    Q_UNUSED(bio);
+    Q_UNUSED(num);
+    Q_UNUSED(ptr);
+
+    // The plain socket does its own buffering, so there is nothing to flush.
+    // Like any other sink BIO we return 0 for the commands we do not know.
+    return cmd == BIO_CTRL_FLUSH ? 1 : 0;
+}
+
+static int q_ssl_socket_bio_create(BIO *bio)
+{
+    q_BIO_set_init(bio, 1);
+    return 1;
+}
+
+static int q_ssl_socket_bio_destroy(BIO *bio)
+{
+    Q_UNUSED(bio);
+    return 1;
+}
+
 } // extern "C"
 
+namespace {
+
+class SocketWriteBioMethod
+{
+public:
+    SocketWriteBioMethod()
+        : method(q_BIO_meth_new(BIO_TYPE_SOURCE_SINK, "qsslsocketbio"))
+    {
+        if (method) {
+            q_BIO_meth_set_create(method, q_ssl_socket_bio_create);
+            q_BIO_meth_set_destroy(method, q_ssl_socket_bio_destroy);
+            q_BIO_meth_set_write(method, q_ssl_socket_bio_write);
+            q_BIO_meth_set_ctrl(method, q_ssl_socket_bio_ctrl);
+        }
+    }
+    ~SocketWriteBioMethod()
+    {
+        if (method)
+            q_BIO_meth_free(method);
+    }
+
+    BIO_METHOD *const method;
+};
+
+} // Unnamed namespace
+
+Q_GLOBAL_STATIC(SocketWriteBioMethod, socketWriteBioMethod)
+
 QSslSocketBackendPrivate::QSslSocketBackendPrivate()
     : ssl(nullptr),
       readBio(nullptr),
@@ -719,6 +786,7 @@ bool QSslSocketBackendPrivate::initSslContext()
         return false;
     }
 
+    QByteArray serverName;
     if (configuration.protocol != QSsl::UnknownProtocol && mode == QSslSocket::SslClientMode) {
         // Set server hostname on TLS extension. RFC4366 section 3.1 requires it in ACE format.
         QString tlsHostName = verificationPeerName.isEmpty() ? q->peerName() : verificationPeerName;
@@ -735,9 +803,23 @@ bool QSslSocketBackendPrivate::initSslContext()
                 ace.chop(1);
             if (!q_SSL_ctrl(ssl, SSL_CTRL_SET_TLSEXT_HOSTNAME, TLSEXT_NAMETYPE_host_name, ace.data()))
                 qCWarning(lcSsl, "could not set SSL_CTRL_SET_TLSEXT_HOSTNAME, Server Name Indication disabled");
+            else
+                serverName = ace;
         }
     }
 
+    // Fall back to the process-wide session cache if the context has no
+    // session of its own to resume.
+    sessionCacheKey.clear();
+    if (mode == QSslSocket::SslClientMode
+        && !(configuration.sslOptions & QSsl::SslOptionDisableSessionSharing)
+        && QSslSocket::sessionCacheCapacity() > 0) {
+        sessionCacheKey = QTlsSessionCache::makeKey(q->peerName(), q->peerPort(), serverName,
+                                                    configuration);
+        if (!q_SSL_get_session(ssl))
+            QTlsSessionCache::instance()->resumeSession(sessionCacheKey, ssl);
+    }
+
     // Clear the session.
     errorList.clear();
 
@@ -756,6 +838,9 @@ bool QSslSocketBackendPrivate::initSslContext()
 
     // Assign the bios.
     q_SSL_set_bio(ssl, readBio, writeBio);
+    writeBioIsSocket = false;
+    socketWritesSuppressed = false;
+    plainSocketWriteFailed = false;
 
     if (mode == QSslSocket::SslClientMode)
         q_SSL_set_connect_state(ssl);
@@ -826,6 +911,7 @@ void QSslSocketBackendPrivate::destroySslContext()
             // We do not send a shutdown alert here. Just mark the session as
             // resumable for qhttpnetworkconnection's "optimization", otherwise
             // OpenSSL won't start a session resumption.
+            socketWritesSuppressed = true;
             if (q_SSL_shutdown(ssl) != 1) {
                 // Some error may be queued, clear it.
                 const auto errors = getErrorsFromOpenSsl();
@@ -1138,6 +1224,12 @@ void QSslSocketBackendPrivate::transmit()
                         //write can result in a want_read error, possibly due to renegotiation - not an error - stop transmitting
                         transmitting = false;
                         break;
+                    } else if (plainSocketWriteFailed) {
+                        //plain socket write fails if it was in the pending close state.
+                        logAndClearErrorQueue();
+                        const ScopedBool bg(inSetAndEmitError, true);
+                        setErrorAndEmit(plainSocket->error(), plainSocket->errorString());
+                        return;
                     } else {
                         // ### Better error handling.
                         const ScopedBool bg(inSetAndEmitError, true);
@@ -1168,6 +1260,7 @@ void QSslSocketBackendPrivate::transmit()
                     emittedBytesWritten = false;
                 }
                 emit q->channelBytesWritten(0, totalBytesWritten);
+                updateWriteBufferLevel();
             }
         }
 
@@ -1194,6 +1287,11 @@ void QSslSocketBackendPrivate::transmit()
             transmitting = true;
         }
 
+        // From now on OpenSSL can write the encrypted records to the socket
+        // itself, saving the round trip through the memory BIO.
+        if (connectionEncrypted && !writeBioIsSocket && q_BIO_pending(writeBio) <= 0)
+            useSocketWriteBio();
+
         // Check if we've got any data to be read from the socket.
         if (!connectionEncrypted || !readBufferMaxSize || buffer.size() < readBufferMaxSize)
             while ((pendingBytes = plainSocket->bytesAvailable()) > 0) {
@@ -1602,6 +1700,10 @@ int QSslSocketBackendPrivate::handleNewSessionTicket(SSL *connection)
 
     Q_ASSERT(connection);
 
+    // Tickets arriving after the handshake replace what continueHandshake() stored.
+    if (connectionEncrypted)
+        storeSessionInCache();
+
     if (q->sslConfiguration().testSslOption(QSsl::SslOptionDisableSessionPersistence)) {
         // We silently ignore, do nothing, remove from cache.
         return 0;
@@ -1647,6 +1749,39 @@ int QSslSocketBackendPrivate::handleNewSessionTicket(SSL *connection)
     return 0;
 }
 
+void QSslSocketBackendPrivate::storeSessionInCache()
+{
+    if (sessionCacheKey.isEmpty())
+        return;
+
+    // Resuming skips verification, so only sessions that a verifying socket
+    // would have accepted on its own get into the cache.
+    const bool doVerifyPeer = configuration.peerVerifyMode == QSslSocket::VerifyPeer
+                              || (configuration.peerVerifyMode == QSslSocket::AutoVerifyPeer
+                                  && mode == QSslSocket::SslClientMode);
+    if (doVerifyPeer && !sslErrors.isEmpty())
+        return;
+
+    // Nor is the identity behind a pre-shared key part of the cache key.
+    if (sessionCipher().authenticationMethod() == QLatin1String("PSK"))
+        return;
+
+    SSL_SESSION *session = q_SSL_get1_session(ssl);
+    if (!session)
+        return;
+
+#ifdef TLS1_3_VERSION
+    // With TLS 1.3 the session only becomes resumable once a ticket arrived.
+    if (!q_SSL_SESSION_is_resumable(session)) {
+        q_SSL_SESSION_free(session);
+        return;
+    }
+#endif // TLS1_3_VERSION
+
+    QTlsSessionCache::instance()->insert(sessionCacheKey, session,
+                                         int(q_SSL_SESSION_get_ticket_lifetime_hint(session)));
+}
+
 bool QSslSocketBackendPrivate::checkSslErrors()
 {
     Q_Q(QSslSocket);
@@ -2050,6 +2185,46 @@ int QSslSocketBackendPrivate::emitErrorFromCallback(X509_STORE_CTX *ctx)
     return !handshakeInterrupted;
 }
 
+void QSslSocketBackendPrivate::useSocketWriteBio()
+{
+    Q_ASSERT(ssl);
+    Q_ASSERT(!writeBioIsSocket);
+
+    BIO_METHOD *method = socketWriteBioMethod()->method;
+    BIO *socketBio = method ? q_BIO_new(method) : nullptr;
+    if (!socketBio) {
+        // Not fatal, we just keep going through the memory BIO.
+        logAndClearErrorQueue();
+        return;
+    }
+
+    q_BIO_set_data(socketBio, this);
+    // The read BIO is unchanged, so this only replaces (and frees) the
+    // memory BIO we have just drained.
+    q_SSL_set_bio(ssl, readBio, socketBio);
+    writeBio = socketBio;
+    writeBioIsSocket = true;
+}
+
+int QSslSocketBackendPrivate::writeToPlainSocket(const char *data, int size)
+{
+    // Data the memory BIO would have held but never sent is dropped.
+    if (socketWritesSuppressed || !plainSocket->isValid()
+        || plainSocket->openMode() == QIODevice::NotOpen) {
+        return size;
+    }
+
+    const qint64 written = plainSocket->write(data, size);
+#ifdef QSSLSOCKET_DEBUG
+    qCDebug(lcSsl) << "QSslSocketBackendPrivate::writeToPlainSocket: wrote" << size << "encrypted bytes to the socket" << written << "actual.";
+#endif
+    if (written < 0) {
+        plainSocketWriteFailed = true;
+        return -1;
+    }
+    return int(written);
+}
+
 void QSslSocketBackendPrivate::trySendFatalAlert()
 {
     Q_ASSERT(pendingFatalAlert);
@@ -2186,6 +2361,7 @@ void QSslSocketBackendPrivate::continueHandshake()
             }
         }
     }
+    storeSessionInCache();
 
 #if !defined(OPENSSL_NO_NEXTPROTONEG)
 
@@ -150,6 +150,7 @@ public:
     void continueHandshake() override;
     bool checkSslErrors();
     void storePeerCertificates();
+    void storeSessionInCache();
     int handleNewSessionTicket(SSL *context);
     unsigned int tlsPskClientCallback(const char *hint, char *identity, unsigned int max_identity_len, unsigned char *psk, unsigned int max_psk_len);
     unsigned int tlsPskServerCallback(const char *identity, unsigned char *psk, unsigned int max_psk_len);
@@ -162,6 +163,9 @@ public:
     bool checkOcspStatus();
 #endif
 
+    void useSocketWriteBio();
+    int writeToPlainSocket(const char *data, int size);
+
     void alertMessageSent(int encoded);
     void alertMessageReceived(int encoded);
 
@@ -169,6 +173,9 @@ public:
     void trySendFatalAlert();
 
     bool pendingFatalAlert = false;
+    bool writeBioIsSocket = false;
+    bool socketWritesSuppressed = false;
+    bool plainSocketWriteFailed = false;
     bool errorsReportedFromCallback = false;
 
     // This decription will go to setErrorAndEmit(SslHandshakeError, ocspErrorDescription)
@@ -177,6 +184,9 @@ public:
     QList<QSslError> ocspErrors;
     QByteArray ocspResponseDer;
 
+    // Key into QTlsSessionCache, empty if the cache is not used
+    QByteArray sessionCacheKey;
+
     Q_AUTOTEST_EXPORT static long setupOpenSslOptions(QSsl::SslProtocol protocol, QSsl::SslOptions sslOptions);
     static QSslCipher QSslCipher_from_SSL_CIPHER(const SSL_CIPHER *cipher);
     static QList<QSslCertificate> STACKOFX509_to_QSslCertificates(STACK_OF(X509) *x509);
@@ -314,6 +314,20 @@ extern "C"
 {
 
 typedef int (*CookieVerifyCallback)(SSL *, const unsigned char *, unsigned);
+
+}
+
+int q_DTLSv1_listen(SSL *s, BIO_ADDR *client);
+BIO_ADDR *q_BIO_ADDR_new();
+void q_BIO_ADDR_free(BIO_ADDR *ap);
+
+#endif // dtls
+
+// API we need for a custom BIO (the dgram BIO in QDtls and the socket
+// write BIO in QSslSocket):
+extern "C"
+{
+
 typedef int (*DgramWriteCallback) (BIO *, const char *, int);
 typedef int (*DgramReadCallback) (BIO *, char *, int);
 typedef int (*DgramPutsCallback) (BIO *, const char *);
@@ -323,12 +337,6 @@ typedef int (*DgramDestroyCallback) (BIO *);
 
 }
 
-int q_DTLSv1_listen(SSL *s, BIO_ADDR *client);
-BIO_ADDR *q_BIO_ADDR_new();
-void q_BIO_ADDR_free(BIO_ADDR *ap);
-
-// API we need for a custom dgram BIO:
-
 BIO_METHOD *q_BIO_meth_new(int type, const char *name);
 void q_BIO_meth_free(BIO_METHOD *biom);
 int q_BIO_meth_set_write(BIO_METHOD *biom, DgramWriteCallback);
@@ -338,8 +346,6 @@ int q_BIO_meth_set_ctrl(BIO_METHOD *biom, DgramCtrlCallback);
 int q_BIO_meth_set_create(BIO_METHOD *biom, DgramCreateCallback);
 int q_BIO_meth_set_destroy(BIO_METHOD *biom, DgramDestroyCallback);
 
-#endif // dtls
-
 void q_BIO_set_data(BIO *a, void *ptr);
 void *q_BIO_get_data(BIO *a);
 void q_BIO_set_init(BIO *a, int init);
@@ -498,6 +504,7 @@ int q_SSL_CTX_use_PrivateKey(SSL_CTX *a, EVP_PKEY *b);
 int q_SSL_CTX_use_RSAPrivateKey(SSL_CTX *a, RSA *b);
 int q_SSL_CTX_use_PrivateKey_file(SSL_CTX *a, const char *b, int c);
 X509_STORE *q_SSL_CTX_get_cert_store(const SSL_CTX *a);
+void q_SSL_CTX_set_cert_store(SSL_CTX *a, X509_STORE *b);
 SSL_CONF_CTX *q_SSL_CONF_CTX_new();
 void q_SSL_CONF_CTX_free(SSL_CONF_CTX *a);
 void q_SSL_CONF_CTX_set_ssl_ctx(SSL_CONF_CTX *a, SSL_CTX *b);
@@ -566,6 +573,7 @@ ASN1_OBJECT *q_X509_NAME_ENTRY_get_object(X509_NAME_ENTRY *a);
 EVP_PKEY *q_X509_PUBKEY_get(X509_PUBKEY *a);
 void q_X509_STORE_free(X509_STORE *store);
 X509_STORE *q_X509_STORE_new();
+int q_X509_STORE_up_ref(X509_STORE *store);
 int q_X509_STORE_add_cert(X509_STORE *ctx, X509 *x);
 void q_X509_STORE_CTX_free(X509_STORE_CTX *storeCtx);
 int q_X509_STORE_CTX_init(X509_STORE_CTX *ctx, X509_STORE *store,
@@ -631,8 +639,10 @@ void q_GENERAL_NAME_free(GENERAL_NAME *a);
 
 #if OPENSSL_VERSION_MAJOR < 3
 int q_SSL_CTX_load_verify_locations(SSL_CTX *ctx, const char *CAfile, const char *CApath);
+int q_X509_STORE_load_locations(X509_STORE *store, const char *CAfile, const char *CApath);
 #else
 int q_SSL_CTX_load_verify_dir(SSL_CTX *ctx, const char *CApath);
+int q_X509_STORE_load_path(X509_STORE *store, const char *CApath);
 #endif // OPENSSL_VERSION_MAJOR
 
 int q_i2d_SSL_SESSION(SSL_SESSION *in, unsigned char **pp);
@@ -1299,6 +1299,7 @@ void QSslSocketBackendPrivate::transmit()
                 emittedBytesWritten = false;
             }
             emit q->channelBytesWritten(0, totalBytesWritten);
+            updateWriteBufferLevel();
         }
     }
 
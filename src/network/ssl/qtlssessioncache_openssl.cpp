@@ -0,0 +1,177 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtNetwork/qsslsocket.h>
+
+#include "private/qtlssessioncache_openssl_p.h"
+#include "private/qsslconfiguration_p.h"
+#include "private/qsslsocket_openssl_symbols_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+Q_GLOBAL_STATIC(QTlsSessionCache, tlsSessionCache)
+
+QTlsSessionCache *QTlsSessionCache::instance()
+{
+    return tlsSessionCache();
+}
+
+QTlsSessionCache::~QTlsSessionCache()
+{
+    clear();
+}
+
+/*
+    Builds the key a session is stored under. Besides the peer, it contains
+    everything that decides whether a handshake with this configuration would
+    have been accepted: resuming a session skips certificate verification and
+    client authentication, so a session must never be reused by a socket that
+    verifies differently or presents a different certificate.
+*/
+QByteArray QTlsSessionCache::makeKey(const QString &peerName, quint16 port,
+                                     const QByteArray &serverName,
+                                     const QSslConfigurationPrivate &configuration)
+{
+    size_t seed = 0;
+    seed = qHashMulti(seed, int(configuration.protocol), int(configuration.peerVerifyMode),
+                      configuration.peerVerifyDepth);
+    seed = qHashRange(configuration.caCertificates.cbegin(),
+                      configuration.caCertificates.cend(), seed);
+    seed = qHashRange(configuration.localCertificateChain.cbegin(),
+                      configuration.localCertificateChain.cend(), seed);
+    seed = qHashRange(configuration.nextAllowedProtocols.cbegin(),
+                      configuration.nextAllowedProtocols.cend(), seed);
+
+    QByteArray key = peerName.toUtf8();
+    key += ':' + QByteArray::number(port) + ':' + serverName + ':'
+           + QByteArray::number(quint64(seed), 16);
+    return key;
+}
+
+/*
+    Sets the session cached under \a key, if any, on \a ssl. Returns true if
+    a session was found; whether the server accepts it is only known after
+    the handshake.
+*/
+bool QTlsSessionCache::resumeSession(const QByteArray &key, SSL *ssl)
+{
+    Q_ASSERT(ssl);
+    const QMutexLocker locker(&mutex);
+
+    removeExpired();
+    trim(QSslSocket::sessionCacheCapacity());
+
+    const auto it = entries.find(key);
+    if (it == entries.end())
+        return false;
+
+    it->lastUsed = ++useCounter;
+    // SSL_set_session() takes its own reference.
+    return q_SSL_set_session(ssl, it->session) == 1;
+}
+
+/*
+    Stores \a session under \a key, replacing any session stored there
+    before. Takes ownership of the reference the caller holds on \a session.
+*/
+void QTlsSessionCache::insert(const QByteArray &key, SSL_SESSION *session, int lifetimeHint)
+{
+    Q_ASSERT(session);
+    const QMutexLocker locker(&mutex);
+
+    const int capacity = QSslSocket::sessionCacheCapacity();
+    qint64 timeout = QSslSocket::sessionCacheTimeout();
+    if (lifetimeHint > 0)
+        timeout = std::min<qint64>(timeout, lifetimeHint);
+    if (!capacity || !timeout) {
+        q_SSL_SESSION_free(session);
+        trim(capacity);
+        return;
+    }
+
+    removeExpired();
+
+    const auto it = entries.find(key);
+    if (it != entries.end()) {
+        // Even if it is the same session, the caller brought its own reference.
+        q_SSL_SESSION_free(it->session);
+        entries.erase(it);
+    }
+    trim(capacity - 1);
+
+    entries.insert(key, { session, QDeadlineTimer(timeout * 1000), ++useCounter });
+}
+
+void QTlsSessionCache::clear()
+{
+    const QMutexLocker locker(&mutex);
+    for (const Entry &entry : qAsConst(entries))
+        q_SSL_SESSION_free(entry.session);
+    entries.clear();
+}
+
+void QTlsSessionCache::removeExpired()
+{
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->expiry.hasExpired()) {
+            q_SSL_SESSION_free(it->session);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Drops the least recently used sessions until at most \a size are left.
+void QTlsSessionCache::trim(qsizetype size)
+{
+    while (entries.size() > std::max<qsizetype>(size, 0)) {
+        const auto lessRecentlyUsed = [](const Entry &lhs, const Entry &rhs) {
+            return lhs.lastUsed < rhs.lastUsed;
+        };
+        const auto oldest = std::min_element(entries.begin(), entries.end(), lessRecentlyUsed);
+        q_SSL_SESSION_free(oldest->session);
+        entries.erase(oldest);
+    }
+}
+
+QT_END_NAMESPACE
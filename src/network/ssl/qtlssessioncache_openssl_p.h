@@ -0,0 +1,103 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QTLSSESSIONCACHE_OPENSSL_P_H
+#define QTLSSESSIONCACHE_OPENSSL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtNetwork/private/qtnetworkglobal_p.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+
+#include <openssl/ssl.h>
+
+QT_BEGIN_NAMESPACE
+
+class QSslConfigurationPrivate;
+
+// Process-wide cache of client sessions, shared by all QSslSockets
+// regardless of the QSslContext they use. Limits are taken from
+// QSslSocket::sessionCacheCapacity() and QSslSocket::sessionCacheTimeout().
+class QTlsSessionCache
+{
+public:
+    static QTlsSessionCache *instance();
+
+    ~QTlsSessionCache();
+
+    static QByteArray makeKey(const QString &peerName, quint16 port, const QByteArray &serverName,
+                              const QSslConfigurationPrivate &configuration);
+
+    bool resumeSession(const QByteArray &key, SSL *ssl);
+    void insert(const QByteArray &key, SSL_SESSION *session, int lifetimeHint);
+    void clear();
+
+private:
+    struct Entry
+    {
+        SSL_SESSION *session;
+        QDeadlineTimer expiry;
+        quint64 lastUsed;
+    };
+
+    void removeExpired();
+    void trim(qsizetype size);
+
+    QMutex mutex;
+    QHash<QByteArray, Entry> entries;
+    quint64 useCounter = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QTLSSESSIONCACHE_OPENSSL_P_H
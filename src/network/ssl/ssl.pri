@@ -75,7 +75,8 @@ qtConfig(ssl) {
     qtConfig(openssl) {
         HEADERS += ssl/qsslcontext_openssl_p.h \
                    ssl/qsslsocket_openssl_p.h \
-                   ssl/qsslsocket_openssl_symbols_p.h
+                   ssl/qsslsocket_openssl_symbols_p.h \
+                   ssl/qtlssessioncache_openssl_p.h
         SOURCES += ssl/qsslsocket_openssl_symbols.cpp \
                    ssl/qssldiffiehellmanparameters_openssl.cpp \
                    ssl/qsslcertificate_openssl.cpp \
@@ -83,6 +84,7 @@ qtConfig(ssl) {
                    ssl/qsslkey_openssl.cpp \
                    ssl/qsslsocket_openssl.cpp \
                    ssl/qsslcontext_openssl.cpp \
+                   ssl/qtlssessioncache_openssl.cpp \
 
         qtConfig(dtls) {
             HEADERS += ssl/qdtls_openssl_p.h
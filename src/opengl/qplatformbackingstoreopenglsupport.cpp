@@ -314,6 +314,25 @@ void QPlatformBackingStoreOpenGLSupport::composeAndFlush(QWindow *window, const
     context->swapBuffers(window);
 }
 
+// Uploading the dirty rectangles one by one only pays off when they cover
+// noticeably less than their bounding rectangle.
+static QList<QRect> textureUploadRects(const QRegion &dirtyRegion, const QRect &imageRect)
+{
+    const QRegion region = dirtyRegion & imageRect;
+    const QRect bounds = region.boundingRect();
+    if (bounds.isEmpty())
+        return {};
+
+    if (region.rectCount() > 1) {
+        qint64 area = 0;
+        for (const QRect &rect : region)
+            area += qint64(rect.width()) * rect.height();
+        if (area * 2 < qint64(bounds.width()) * bounds.height())
+            return QList<QRect>(region.begin(), region.end());
+    }
+    return { bounds };
+}
+
 GLuint QPlatformBackingStoreOpenGLSupport::toTexture(const QRegion &dirtyRegion, QSize *textureSize, QPlatformBackingStore::TextureFlags *flags) const
 {
     Q_ASSERT(textureSize);
@@ -379,6 +398,19 @@ GLuint QPlatformBackingStoreOpenGLSupport::toTexture(const QRegion &dirtyRegion,
 
     *textureSize = imageSize;
 
+    QOpenGLFunctions *funcs = ctx->functions();
+
+    if (needsConversion && !resized) {
+        // Convert only the dirty parts, not the entire backingstore image.
+        funcs->glBindTexture(GL_TEXTURE_2D, textureId);
+        for (const QRect &rect : textureUploadRects(dirtyRegion, image.rect())) {
+            const QImage subImage = image.copy(rect).convertToFormat(QImage::Format_RGBA8888);
+            funcs->glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x(), rect.y(), rect.width(), rect.height(), GL_RGBA, pixelType,
+                                   subImage.constBits());
+        }
+        return textureId;
+    }
+
     if (needsConversion)
         image = image.convertToFormat(QImage::Format_RGBA8888);
 
@@ -388,8 +420,6 @@ GLuint QPlatformBackingStoreOpenGLSupport::toTexture(const QRegion &dirtyRegion,
     const qsizetype strideInPixels = image.bytesPerLine() / bytesPerPixel;
     const bool hasUnpackRowLength = !ctx->isOpenGLES() || ctx->format().majorVersion() >= 3;
 
-    QOpenGLFunctions *funcs = ctx->functions();
-
     if (hasUnpackRowLength) {
         funcs->glPixelStorei(GL_UNPACK_ROW_LENGTH, strideInPixels);
     } else if (strideInPixels != image.width()) {
@@ -418,12 +448,15 @@ GLuint QPlatformBackingStoreOpenGLSupport::toTexture(const QRegion &dirtyRegion,
     } else {
         funcs->glBindTexture(GL_TEXTURE_2D, textureId);
         QRect imageRect = image.rect();
-        QRect rect = dirtyRegion.boundingRect() & imageRect;
 
         if (hasUnpackRowLength) {
-            funcs->glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x(), rect.y(), rect.width(), rect.height(), GL_RGBA, pixelType,
-                                   image.constScanLine(rect.y()) + rect.x() * bytesPerPixel);
+            for (const QRect &rect : textureUploadRects(dirtyRegion, imageRect)) {
+                funcs->glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x(), rect.y(), rect.width(), rect.height(), GL_RGBA, pixelType,
+                                       image.constScanLine(rect.y()) + rect.x() * bytesPerPixel);
+            }
         } else {
+            QRect rect = dirtyRegion.boundingRect() & imageRect;
+
             // if the rect is wide enough it's cheaper to just
             // extend it instead of doing an image copy
             if (rect.width() >= imageRect.width() / 2) {
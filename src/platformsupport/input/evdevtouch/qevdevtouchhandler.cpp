@@ -52,6 +52,10 @@
 
 #include <mutex>
 
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
 #ifdef Q_OS_FREEBSD
 #include <dev/evdev/input.h>
 #else
@@ -166,6 +170,10 @@ public:
     bool m_filtered;
     int m_prediction;
 
+    // A non-zero value makes the reader thread run with SCHED_FIFO at this
+    // priority, so that events are picked up promptly on a loaded system.
+    int m_realtimePriority;
+
     // When filtering is enabled, protect the access to current and last
     // timeStamp and touchPoints, as these are being read on the gui thread.
     QMutex m_mutex;
@@ -180,7 +188,7 @@ QEvdevTouchScreenData::QEvdevTouchScreenData(QEvdevTouchScreenHandler *q_ptr, co
       hw_range_y_min(0), hw_range_y_max(0),
       hw_pressure_min(0), hw_pressure_max(0),
       m_forceToActiveWindow(false), m_typeB(false), m_singleTouch(false),
-      m_filtered(false), m_prediction(0)
+      m_filtered(false), m_prediction(0), m_realtimePriority(0)
 {
     for (const QString &arg : args) {
         if (arg == QStringLiteral("force_window"))
@@ -189,6 +197,8 @@ QEvdevTouchScreenData::QEvdevTouchScreenData(QEvdevTouchScreenHandler *q_ptr, co
             m_filtered = true;
         else if (arg.startsWith(QStringLiteral("prediction=")))
             m_prediction = arg.mid(11).toInt();
+        else if (arg.startsWith(QStringLiteral("rtprio=")))
+            m_realtimePriority = arg.mid(7).toInt();
     }
 }
 
@@ -813,6 +823,15 @@ void QEvdevTouchScreenHandlerThread::run()
 {
     m_handler = new QEvdevTouchScreenHandler(m_device, m_spec);
 
+    if (const int priority = m_handler->d->m_realtimePriority) {
+        sched_param param;
+        param.sched_priority = priority;
+        if (int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param))
+            qWarning("evdevtouch: Cannot set real-time priority %d: %s", priority, strerror(error));
+        else
+            qCDebug(qLcEvdevTouch, "evdevtouch: Reader thread running with SCHED_FIFO priority %d", priority);
+    }
+
     if (m_handler->isFiltered())
         connect(m_handler, &QEvdevTouchScreenHandler::touchPointsUpdated, this, &QEvdevTouchScreenHandlerThread::scheduleTouchPointUpdate);
 
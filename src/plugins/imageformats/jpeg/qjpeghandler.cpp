@@ -74,6 +74,11 @@ extern "C" {
 #endif
 }
 
+// libjpeg-turbo can skip and crop scanlines without decoding what lies outside the clip rect
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && LIBJPEG_TURBO_VERSION_NUMBER >= 2000000
+#  define QT_JPEG_PARTIAL_DECODING
+#endif
+
 QT_BEGIN_NAMESPACE
 QT_WARNING_DISABLE_GCC("-Wclobbered")
 
@@ -374,6 +379,21 @@ static bool read_jpeg_image(QImage *outImage,
 
             (void) jpeg_start_decompress(info);
 
+            // Offset of the clip rect in the decoded scanlines.
+            int clipX = clip.x();
+#ifdef QT_JPEG_PARTIAL_DECODING
+            if (clip.width() < int(info->output_width)) {
+                // Only decode the iMCU columns covering the clip rect. The
+                // library widens the cropped region to iMCU boundaries.
+                JDIMENSION xoffset = clip.x();
+                JDIMENSION width = clip.width();
+                jpeg_crop_scanline(info, &xoffset, &width);
+                clipX = clip.x() - int(xoffset);
+            }
+            if (clip.y() > 0)
+                (void) jpeg_skip_scanlines(info, clip.y());
+#endif
+
             while (info->output_scanline < info->output_height) {
                 int y = int(info->output_scanline) - clip.y();
                 if (y >= clip.height())
@@ -385,12 +405,12 @@ static bool read_jpeg_image(QImage *outImage,
                     continue;   // Haven't reached the starting line yet.
 
                 if (info->output_components == 3) {
-                    uchar *in = rows[0] + clip.x() * 3;
+                    uchar *in = rows[0] + clipX * 3;
                     QRgb *out = (QRgb*)outImage->scanLine(y);
                     converter(out, in, clip.width());
                 } else if (info->out_color_space == JCS_CMYK) {
                     // Convert CMYK->RGB.
-                    uchar *in = rows[0] + clip.x() * 4;
+                    uchar *in = rows[0] + clipX * 4;
                     QRgb *out = (QRgb*)outImage->scanLine(y);
                     for (int i = 0; i < clip.width(); ++i) {
                         int k = in[3];
@@ -401,7 +421,7 @@ static bool read_jpeg_image(QImage *outImage,
                 } else if (info->output_components == 1) {
                     // Grayscale.
                     memcpy(outImage->scanLine(y),
-                           rows[0] + clip.x(), clip.width());
+                           rows[0] + clipX, clip.width());
                 }
             }
         } else {
@@ -51,6 +51,8 @@
 #include <QtDeviceDiscoverySupport/private/qdevicediscovery_p.h>
 
 #include <gbm.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -154,4 +156,58 @@ QEglFSWindow *QEglFSKmsGbmIntegration::createWindow(QWindow *window) const
     return new QEglFSKmsGbmWindow(window, this);
 }
 
+static bool setOverlayPlane(QScreen *screen, uint planeId, uint framebufferId,
+                            const QRect &source, const QRect &target)
+{
+    if (!screen || !screen->handle())
+        return false;
+    auto *s = static_cast<QEglFSKmsGbmScreen *>(screen->handle());
+    return s->setOverlayPlane(planeId, framebufferId, source, target);
+}
+
+// Wraps a single-plane dmabuf into a KMS framebuffer that can be shown on an
+// overlay plane without any copy or GPU composition. The framebuffer is to be
+// released with drmModeRmFB() on the "dri_fd" native resource.
+static uint addDmaBufFramebuffer(QScreen *screen, int dmabufFd, const QSize &size,
+                                 uint drmFormat, uint pitch, uint offset)
+{
+    if (!screen || !screen->handle())
+        return 0;
+    auto *s = static_cast<QEglFSKmsGbmScreen *>(screen->handle());
+    const int fd = s->device()->fd();
+
+    uint32_t handle = 0;
+    if (drmPrimeFDToHandle(fd, dmabufFd, &handle)) {
+        qErrnoWarning("Could not import dmabuf");
+        return 0;
+    }
+
+    const uint32_t handles[4] = { handle, 0, 0, 0 };
+    const uint32_t pitches[4] = { pitch, 0, 0, 0 };
+    const uint32_t offsets[4] = { offset, 0, 0, 0 };
+    uint32_t framebufferId = 0;
+    if (drmModeAddFB2(fd, uint32_t(size.width()), uint32_t(size.height()), drmFormat,
+                      handles, pitches, offsets, &framebufferId, 0)) {
+        qErrnoWarning("Could not create framebuffer for dmabuf");
+        framebufferId = 0;
+    }
+
+    // The framebuffer holds its own reference to the buffer.
+    drm_gem_close gemClose;
+    memset(&gemClose, 0, sizeof(gemClose));
+    gemClose.handle = handle;
+    drmIoctl(fd, DRM_IOCTL_GEM_CLOSE, &gemClose);
+
+    return framebufferId;
+}
+
+QFunctionPointer QEglFSKmsGbmIntegration::platformFunction(const QByteArray &function) const
+{
+    if (function == QByteArrayLiteral("EglFSKmsSetOverlayPlane"))
+        return QFunctionPointer(setOverlayPlane);
+    if (function == QByteArrayLiteral("EglFSKmsAddDmaBufFramebuffer"))
+        return QFunctionPointer(addDmaBufFramebuffer);
+    return nullptr;
+}
+
 QT_END_NAMESPACE
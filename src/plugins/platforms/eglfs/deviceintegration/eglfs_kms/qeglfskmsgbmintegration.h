@@ -63,6 +63,8 @@ public:
     void presentBuffer(QPlatformSurface *surface) override;
     QEglFSWindow *createWindow(QWindow *window) const override;
 
+    QFunctionPointer platformFunction(const QByteArray &function) const override;
+
 protected:
     QKmsDevice *createDevice() override;
 
@@ -51,6 +51,7 @@
 #include <QtFbSupport/private/qfbvthandler_p.h>
 
 #include <errno.h>
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -338,6 +339,26 @@ void QEglFSKmsGbmScreen::flip()
             static uint blendOp = uint(qEnvironmentVariableIntValue("QT_QPA_EGLFS_KMS_BLEND_OP"));
             if (blendOp)
                 drmModeAtomicAddProperty(request, op.eglfs_plane->id, op.eglfs_plane->blendOpPropertyId, blendOp);
+
+            // Overlay plane changes are latched together with this flip.
+            QMutexLocker locker(&m_overlayMutex);
+            for (const OverlayPlane &overlay : qAsConst(m_pendingOverlayPlanes)) {
+                const QKmsPlane &plane(overlay.plane);
+                const bool enable = overlay.framebufferId != 0;
+                drmModeAtomicAddProperty(request, plane.id, plane.framebufferPropertyId, overlay.framebufferId);
+                drmModeAtomicAddProperty(request, plane.id, plane.crtcPropertyId, enable ? op.crtc_id : 0);
+                if (!enable)
+                    continue;
+                drmModeAtomicAddProperty(request, plane.id, plane.srcXPropertyId, overlay.source.x() << 16);
+                drmModeAtomicAddProperty(request, plane.id, plane.srcYPropertyId, overlay.source.y() << 16);
+                drmModeAtomicAddProperty(request, plane.id, plane.srcwidthPropertyId, overlay.source.width() << 16);
+                drmModeAtomicAddProperty(request, plane.id, plane.srcheightPropertyId, overlay.source.height() << 16);
+                drmModeAtomicAddProperty(request, plane.id, plane.crtcXPropertyId, overlay.target.x());
+                drmModeAtomicAddProperty(request, plane.id, plane.crtcYPropertyId, overlay.target.y());
+                drmModeAtomicAddProperty(request, plane.id, plane.crtcwidthPropertyId, overlay.target.width());
+                drmModeAtomicAddProperty(request, plane.id, plane.crtcheightPropertyId, overlay.target.height());
+            }
+            m_pendingOverlayPlanes.clear();
         }
 #endif
     } else {
@@ -389,6 +410,44 @@ void QEglFSKmsGbmScreen::flip()
 #endif
 }
 
+// Shows the KMS framebuffer framebufferId on the overlay plane planeId of this
+// screen's output, scaling the source rectangle of the framebuffer to the
+// target rectangle in screen coordinates. A framebufferId of 0 disables the
+// plane. The change is committed atomically together with the next flip.
+// Can be called from any thread.
+bool QEglFSKmsGbmScreen::setOverlayPlane(uint32_t planeId, uint32_t framebufferId,
+                                         const QRect &source, const QRect &target)
+{
+    if (m_headless || !device()->hasAtomicSupport()) {
+        qWarning("Overlay planes require atomic modesetting support");
+        return false;
+    }
+
+    const auto it = std::find_if(m_output.available_planes.cbegin(), m_output.available_planes.cend(),
+                                 [planeId](const QKmsPlane &plane) { return plane.id == planeId; });
+    if (it == m_output.available_planes.cend() || it->type != QKmsPlane::OverlayPlane
+            || (m_output.eglfs_plane && m_output.eglfs_plane->id == planeId)) {
+        qWarning("Plane %u is not an overlay plane available for screen %s", planeId, qPrintable(name()));
+        return false;
+    }
+
+    OverlayPlane overlay;
+    overlay.plane = *it;
+    overlay.framebufferId = framebufferId;
+    overlay.source = source;
+    overlay.target = target;
+
+    QMutexLocker locker(&m_overlayMutex);
+    for (OverlayPlane &pending : m_pendingOverlayPlanes) {
+        if (pending.plane.id == planeId) {
+            pending = overlay;
+            return true;
+        }
+    }
+    m_pendingOverlayPlanes.append(overlay);
+    return true;
+}
+
 void QEglFSKmsGbmScreen::flipFinished()
 {
     if (m_cloneSource) {
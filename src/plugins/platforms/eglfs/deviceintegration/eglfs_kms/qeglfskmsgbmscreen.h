@@ -70,6 +70,9 @@ public:
 
     void flip();
 
+    bool setOverlayPlane(uint32_t planeId, uint32_t framebufferId,
+                         const QRect &source, const QRect &target);
+
 private:
     void flipFinished();
     void ensureModeSet(uint32_t fb);
@@ -99,6 +102,15 @@ private:
         bool cloneFlipPending = false;
     };
     QList<CloneDestination> m_cloneDests;
+
+    struct OverlayPlane {
+        QKmsPlane plane;
+        uint32_t framebufferId = 0;
+        QRect source;
+        QRect target;
+    };
+    QMutex m_overlayMutex;
+    QList<OverlayPlane> m_pendingOverlayPlanes;
 };
 
 QT_END_NAMESPACE
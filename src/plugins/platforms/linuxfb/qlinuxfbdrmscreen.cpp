@@ -59,7 +59,7 @@ QT_BEGIN_NAMESPACE
 
 Q_LOGGING_CATEGORY(qLcFbDrm, "qt.qpa.fb")
 
-static const int BUFFER_COUNT = 2;
+static const int MAX_BUFFER_COUNT = 3;
 
 class QLinuxFbDevice : public QKmsDevice
 {
@@ -75,12 +75,12 @@ public:
     };
 
     struct Output {
-        Output() : backFb(0), flipped(false) { }
+        Output() : backFb(0), flipPending(false) { }
         QKmsOutput kmsOutput;
-        Framebuffer fb[BUFFER_COUNT];
-        QRegion dirty[BUFFER_COUNT];
+        Framebuffer fb[MAX_BUFFER_COUNT];
+        QRegion dirty[MAX_BUFFER_COUNT];
         int backFb;
-        bool flipped;
+        bool flipPending;
         QSize currentRes() const {
             const drmModeModeInfo &modeInfo(kmsOutput.modes[kmsOutput.mode]);
             return QSize(modeInfo.hdisplay, modeInfo.vdisplay);
@@ -97,7 +97,9 @@ public:
     void setMode();
 
     void swapBuffers(Output *output);
+    void waitForFlip(Output *output);
 
+    int bufferCount() const { return m_bufferCount; }
     int outputCount() const { return m_outputs.count(); }
     Output *output(int idx) { return &m_outputs[idx]; }
 
@@ -116,11 +118,15 @@ private:
                                 unsigned int tv_sec, unsigned int tv_usec, void *user_data);
 
     QList<Output> m_outputs;
+    int m_bufferCount;
 };
 
 QLinuxFbDevice::QLinuxFbDevice(QKmsScreenConfig *screenConfig)
     : QKmsDevice(screenConfig, QStringLiteral("/dev/dri/card0"))
 {
+    bool ok = false;
+    const int bufferCount = qEnvironmentVariableIntValue("QT_QPA_FB_DRM_BUFFERS", &ok);
+    m_bufferCount = ok ? qBound(2, bufferCount, MAX_BUFFER_COUNT) : 2;
 }
 
 bool QLinuxFbDevice::open()
@@ -296,12 +302,13 @@ bool QLinuxFbDevice::createFramebuffer(QLinuxFbDevice::Output *output, int buffe
 void QLinuxFbDevice::createFramebuffers()
 {
     for (Output &output : m_outputs) {
-        for (int i = 0; i < BUFFER_COUNT; ++i) {
+        for (int i = 0; i < m_bufferCount; ++i) {
             if (!createFramebuffer(&output, i))
                 return;
         }
-        output.backFb = 0;
-        output.flipped = false;
+        // fb[0] is scanned out by setMode(), start rendering into the next one
+        output.backFb = 1;
+        output.flipPending = false;
     }
 }
 
@@ -325,7 +332,8 @@ void QLinuxFbDevice::destroyFramebuffer(QLinuxFbDevice::Output *output, int buff
 void QLinuxFbDevice::destroyFramebuffers()
 {
     for (Output &output : m_outputs) {
-        for (int i = 0; i < BUFFER_COUNT; ++i)
+        waitForFlip(&output);
+        for (int i = 0; i < m_bufferCount; ++i)
             destroyFramebuffer(&output, i);
     }
 }
@@ -355,19 +363,27 @@ void QLinuxFbDevice::pageFlipHandler(int fd, unsigned int sequence,
     Q_UNUSED(tv_usec);
 
     Output *output = static_cast<Output *>(user_data);
-    output->backFb = (output->backFb + 1) % BUFFER_COUNT;
+    output->flipPending = false;
 }
 
 void QLinuxFbDevice::swapBuffers(Output *output)
 {
+    // Only one flip can be queued per CRTC.
+    waitForFlip(output);
+
     Framebuffer &fb(output->fb[output->backFb]);
     if (drmModePageFlip(fd(), output->kmsOutput.crtc_id, fb.fb, DRM_MODE_PAGE_FLIP_EVENT, output) == -1) {
         qErrnoWarning(errno, "Page flip failed");
         return;
     }
 
-    const int fbIdx = output->backFb;
-    while (output->backFb == fbIdx) {
+    output->flipPending = true;
+    output->backFb = (output->backFb + 1) % m_bufferCount;
+}
+
+void QLinuxFbDevice::waitForFlip(Output *output)
+{
+    while (output->flipPending) {
         drmEventContext drmEvent;
         memset(&drmEvent, 0, sizeof(drmEvent));
         drmEvent.version = 2;
@@ -375,7 +391,10 @@ void QLinuxFbDevice::swapBuffers(Output *output)
         drmEvent.page_flip_handler = pageFlipHandler;
         // Blocks until there is something to read on the drm fd
         // and calls back pageFlipHandler once the flip completes.
-        drmHandleEvent(fd(), &drmEvent);
+        if (drmHandleEvent(fd(), &drmEvent) == -1) {
+            qErrnoWarning(errno, "Failed to wait for page flip");
+            output->flipPending = false;
+        }
     }
 }
 
@@ -433,12 +452,18 @@ QRegion QLinuxFbDrmScreen::doRedraw()
 
     QLinuxFbDevice::Output *output(m_device->output(0));
 
-    for (int i = 0; i < BUFFER_COUNT; ++i)
+    for (int i = 0; i < m_device->bufferCount(); ++i)
         output->dirty[i] += dirty;
 
     if (output->fb[output->backFb].wrapper.isNull())
         return dirty;
 
+    // With two buffers the back buffer stays on screen until the pending
+    // flip completes. With three there is always a free one to render
+    // into, and the wait is deferred to the next swapBuffers().
+    if (m_device->bufferCount() < 3)
+        m_device->waitForFlip(output);
+
     QPainter pntr(&output->fb[output->backFb].wrapper);
     // Image has alpha but no need for blending at this stage.
     // Do not waste time with the default SourceOver.
@@ -532,6 +532,199 @@ void QRfbRawEncoder::write()
     socket->flush();
 }
 
+QRfbZrleEncoder::QRfbZrleEncoder(QVncClient *s)
+    : QRfbEncoder(s)
+{
+    memset(&stream, 0, sizeof(stream));
+    streamValid = (deflateInit(&stream, Z_DEFAULT_COMPRESSION) == Z_OK);
+    if (!streamValid)
+        qWarning("QRfbZrleEncoder: Could not initialize zlib stream");
+}
+
+QRfbZrleEncoder::~QRfbZrleEncoder()
+{
+    if (streamValid)
+        deflateEnd(&stream);
+}
+
+void QRfbZrleEncoder::write()
+{
+    QTcpSocket *socket = client->clientSocket();
+    const QRfbPixelFormat &format = client->pixelFormat();
+    const int bytesPerPixel = client->clientBytesPerPixel();
+
+    // ZRLE sends 32 bpp true color pixels as three byte CPIXELs when the
+    // color bits fit in either the lower or the upper three bytes.
+    int cpixelOffset = 0;
+    int cpixelSize = bytesPerPixel;
+    if (format.trueColor && format.bitsPerPixel == 32 && format.depth <= 24) {
+        const int highestBit = qMax(format.redShift + format.redBits,
+                                    qMax(format.greenShift + format.greenBits,
+                                         format.blueShift + format.blueBits));
+        const int lowestBit = qMin(format.redShift,
+                                   qMin(format.greenShift, format.blueShift));
+        if (highestBit <= 24) {
+            cpixelSize = 3;
+            cpixelOffset = format.bigEndian ? 1 : 0;
+        } else if (lowestBit >= 8) {
+            cpixelSize = 3;
+            cpixelOffset = format.bigEndian ? 0 : 1;
+        }
+    }
+
+    const QRegion rgn = client->dirtyRegion();
+    qCDebug(lcVnc) << "QRfbZrleEncoder::write()" << rgn;
+
+    const auto rectsInRegion = rgn.rectCount();
+
+    {
+        const char tmp[2] = { 0, 0 }; // msg type, padding
+        socket->write(tmp, sizeof(tmp));
+    }
+
+    {
+        const quint16 count = htons(rectsInRegion);
+        socket->write((char *)&count, sizeof(count));
+    }
+
+    if (rectsInRegion <= 0)
+        return;
+
+    const QImage screenImage = client->server()->screenImage();
+    const qsizetype linestep = screenImage.bytesPerLine();
+    const int screenBytesPerPixel = screenImage.depth() / 8;
+
+    for (const QRect &tileRect: rgn) {
+        const QRfbRect rect(tileRect.x(), tileRect.y(),
+                            tileRect.width(), tileRect.height());
+        rect.write(socket);
+
+        const quint32 encoding = htonl(16); // ZRLE encoding
+        socket->write((char *)&encoding, sizeof(encoding));
+
+        tileData.resize(0);
+        for (int ty = 0; ty < rect.h; ty += TileSize) {
+            const int th = qMin(int(TileSize), rect.h - ty);
+            for (int tx = 0; tx < rect.w; tx += TileSize) {
+                const int tw = qMin(int(TileSize), rect.w - tx);
+                const int bstep = tw * bytesPerPixel;
+                if (pixelBuffer.size() < bstep * th)
+                    pixelBuffer.resize(bstep * th);
+
+                const uchar *screendata = screenImage.scanLine(rect.y + ty)
+                                          + (rect.x + tx) * screenBytesPerPixel;
+                char *b = pixelBuffer.data();
+                for (int i = 0; i < th; ++i) {
+                    if (client->doPixelConversion())
+                        client->convertPixels(b, (const char*)screendata, tw);
+                    else
+                        memcpy(b, screendata, bstep);
+                    screendata += linestep;
+                    b += bstep;
+                }
+
+                encodeTile((const uchar *)pixelBuffer.constData(), tw, th,
+                           bytesPerPixel, cpixelOffset, cpixelSize);
+            }
+        }
+
+        stream.next_in = reinterpret_cast<Bytef *>(tileData.data());
+        stream.avail_in = uInt(tileData.size());
+        int compressedSize = 0;
+        do {
+            if (compressed.size() - compressedSize < 1024)
+                compressed.resize(compressedSize + int(deflateBound(&stream, stream.avail_in)) + 1024);
+            stream.next_out = reinterpret_cast<Bytef *>(compressed.data()) + compressedSize;
+            stream.avail_out = uInt(compressed.size() - compressedSize);
+            deflate(&stream, Z_SYNC_FLUSH);
+            compressedSize = compressed.size() - int(stream.avail_out);
+        } while (stream.avail_out == 0);
+
+        const quint32 length = htonl(compressedSize);
+        socket->write((char *)&length, sizeof(length));
+        socket->write(compressed.constData(), compressedSize);
+
+        if (socket->state() == QAbstractSocket::UnconnectedState)
+            break;
+    }
+    socket->flush();
+}
+
+void QRfbZrleEncoder::encodeTile(const uchar *pixels, int width, int height,
+                                 int bytesPerPixel, int cpixelOffset, int cpixelSize)
+{
+    const int count = width * height;
+    const auto cpixel = [&](int i) {
+        quint32 c = 0;
+        memcpy(&c, pixels + i * bytesPerPixel + cpixelOffset, cpixelSize);
+        return c;
+    };
+
+    quint32 palette[MaxPaletteSize];
+    int paletteSize = 0;
+    const auto paletteIndex = [&](quint32 c) {
+        int i = 0;
+        while (i < paletteSize && palette[i] != c)
+            ++i;
+        return i;
+    };
+
+    // collect the palette, giving up as soon as it overflows
+    quint32 last = cpixel(0);
+    palette[paletteSize++] = last;
+    for (int i = 1; i < count && paletteSize <= MaxPaletteSize; ++i) {
+        const quint32 c = cpixel(i);
+        if (c == last)
+            continue;
+        last = c;
+        if (paletteIndex(c) == paletteSize) {
+            if (paletteSize == MaxPaletteSize) {
+                ++paletteSize;
+                break;
+            }
+            palette[paletteSize++] = c;
+        }
+    }
+
+    if (paletteSize == 1) {
+        // solid tile
+        tileData.append(char(1));
+        tileData.append(reinterpret_cast<const char *>(&palette[0]), cpixelSize);
+    } else if (paletteSize <= MaxPaletteSize) {
+        // packed palette, each row padded to a whole byte
+        tileData.append(char(paletteSize));
+        for (int i = 0; i < paletteSize; ++i)
+            tileData.append(reinterpret_cast<const char *>(&palette[i]), cpixelSize);
+
+        const int bits = paletteSize == 2 ? 1 : paletteSize <= 4 ? 2 : 4;
+        for (int y = 0; y < height; ++y) {
+            quint8 byte = 0;
+            int usedBits = 0;
+            for (int x = 0; x < width; ++x) {
+                byte = (byte << bits) | paletteIndex(cpixel(y * width + x));
+                usedBits += bits;
+                if (usedBits == 8) {
+                    tileData.append(char(byte));
+                    byte = 0;
+                    usedBits = 0;
+                }
+            }
+            if (usedBits)
+                tileData.append(char(byte << (8 - usedBits)));
+        }
+    } else {
+        // raw CPIXELs
+        tileData.append(char(0));
+        if (cpixelSize == bytesPerPixel) {
+            tileData.append(reinterpret_cast<const char *>(pixels), count * bytesPerPixel);
+        } else {
+            for (int i = 0; i < count; ++i)
+                tileData.append(reinterpret_cast<const char *>(pixels) + i * bytesPerPixel + cpixelOffset,
+                                cpixelSize);
+        }
+    }
+}
+
 #if QT_CONFIG(cursor)
 QVncClientCursor::QVncClientCursor()
 {
@@ -47,6 +47,8 @@
 #include <QtCore/qvarlengtharray.h>
 #include <qpa/qplatformcursor.h>
 
+#include <zlib.h>
+
 QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(lcVnc)
@@ -205,6 +207,7 @@ public:
     QRfbEncoder(QVncClient *s) : client(s) {}
     virtual ~QRfbEncoder() {}
 
+    virtual qint32 encoding() const = 0;
     virtual void write() = 0;
 
 protected:
@@ -216,12 +219,38 @@ class QRfbRawEncoder : public QRfbEncoder
 public:
     QRfbRawEncoder(QVncClient *s) : QRfbEncoder(s) {}
 
+    qint32 encoding() const override { return 0; }
     void write() override;
 
 private:
     QByteArray buffer;
 };
 
+class QRfbZrleEncoder : public QRfbEncoder
+{
+public:
+    QRfbZrleEncoder(QVncClient *s);
+    ~QRfbZrleEncoder();
+
+    bool isValid() const { return streamValid; }
+    qint32 encoding() const override { return 16; }
+    void write() override;
+
+private:
+    enum { TileSize = 64, MaxPaletteSize = 16 };
+
+    void encodeTile(const uchar *pixels, int width, int height,
+                    int bytesPerPixel, int cpixelOffset, int cpixelSize);
+
+    // The zlib stream lives as long as the connection; the client keeps
+    // a single inflate context for every ZRLE rectangle it receives.
+    z_stream stream;
+    bool streamValid;
+    QByteArray pixelBuffer;
+    QByteArray tileData;
+    QByteArray compressed;
+};
+
 template <class SRC> class QRfbHextileEncoder;
 
 template <class SRC>
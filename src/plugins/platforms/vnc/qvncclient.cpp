@@ -498,11 +498,6 @@ void QVncClient::setEncodings()
             m_handleMsg = false;
     }
 
-    if (m_encoder) {
-        delete m_encoder;
-        m_encoder = nullptr;
-    }
-
     enum Encodings {
         Raw = 0,
         CopyRect = 1,
@@ -516,6 +511,9 @@ void QVncClient::setEncodings()
 
     if (m_encodingsPending && (unsigned)m_clientSocket->bytesAvailable() >=
                                 m_encodingsPending * sizeof(quint32)) {
+        // encodings are listed in the client's order of preference
+        qint32 preferredEncoding = Raw;
+        bool preferredEncodingFound = false;
         for (int i = 0; i < m_encodingsPending; ++i) {
             qint32 enc;
             m_clientSocket->read((char *)&enc, sizeof(qint32));
@@ -523,11 +521,8 @@ void QVncClient::setEncodings()
             qCDebug(lcVnc, "QVncServer::setEncodings: %d", enc);
             switch (enc) {
             case Raw:
-                if (!m_encoder) {
-                    m_encoder = new QRfbRawEncoder(this);
-                    qCDebug(lcVnc, "QVncServer::setEncodings: using raw");
-                }
-               break;
+                preferredEncodingFound = true;
+                break;
             case CopyRect:
                 m_supportCopyRect = true;
                 break;
@@ -544,6 +539,10 @@ void QVncClient::setEncodings()
                 break;
             case ZRLE:
                 m_supportZRLE = true;
+                if (!preferredEncodingFound) {
+                    preferredEncoding = ZRLE;
+                    preferredEncodingFound = true;
+                }
                 break;
             case Cursor:
                 m_supportCursor = true;
@@ -558,6 +557,26 @@ void QVncClient::setEncodings()
         }
         m_handleMsg = false;
         m_encodingsPending = 0;
+
+        // keep a ZRLE encoder across SetEncodings messages, its zlib
+        // stream has to stay in sync with the client
+        if (!m_encoder || m_encoder->encoding() != preferredEncoding) {
+            delete m_encoder;
+            m_encoder = nullptr;
+            if (preferredEncoding == ZRLE) {
+                QRfbZrleEncoder *encoder = new QRfbZrleEncoder(this);
+                if (encoder->isValid()) {
+                    m_encoder = encoder;
+                    qCDebug(lcVnc, "QVncServer::setEncodings: using ZRLE");
+                } else {
+                    delete encoder;
+                }
+            }
+            if (!m_encoder) {
+                m_encoder = new QRfbRawEncoder(this);
+                qCDebug(lcVnc, "QVncServer::setEncodings: using raw");
+            }
+        }
     }
 
     if (!m_encoder) {
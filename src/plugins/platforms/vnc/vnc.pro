@@ -9,6 +9,8 @@ qtHaveModule(input_support-private): \
 
 DEFINES += QT_NO_FOREACH
 
+include($$PWD/../../../3rdparty/zlib_dependency.pri)
+
 SOURCES = \
     main.cpp \
     qvncintegration.cpp \
@@ -100,8 +100,21 @@ bool QWasmEventDispatcher::processEvents(QEventLoop::ProcessEventsFlags flags)
     // app exit time. However, the browser expects that we return
     // control to it periodically, also after initial setup in main().
 
-    // EventLoopExec for nested event loops is not supported.
-    Q_ASSERT(!m_hasMainLoop);
+    // Nested event loops, e.g. from QDialog::exec(), can only be supported
+    // with asyncify, which lets us yield to the browser without returning.
+    if (m_hasMainLoop) {
+#ifdef QT_HAVE_EMSCRIPTEN_ASYNCIFY
+        QUnixEventDispatcherQPA::processEvents(flags & ~QEventLoop::EventLoopExec);
+        // Suspend until the browser has delivered input and run the main
+        // loop callback; QEventLoop::exec() calls us again after that.
+        emscripten_sleep(1);
+        return true;
+#else
+        qFatal("Nested event loops are not supported on WebAssembly without asyncify. "
+               "Use an asynchronous API such as QDialog::open() instead of exec(), or "
+               "configure with \"-device-option EMSCRIPTEN_ASYNCIFY=1\".");
+#endif
+    }
     m_hasMainLoop = true;
 
     // Call emscripten_set_main_loop_arg() with a callback which processes
@@ -736,9 +736,12 @@ void QXcbBackingStoreImage::put(xcb_drawable_t dst, const QRegion &region, const
         const QRect source = bounds.translated(offset);
 
         // First clip in backingstore-local coordinates, and upload
-        // the changed parts of the backingstore to the server.
-        setClip(source);
-        flushPixmap(source);
+        // the changed parts of the backingstore to the server. Only the
+        // flushed region is uploaded, anything else that was painted stays
+        // pending until it is flushed itself.
+        const QRegion sourceRegion = region.translated(offset);
+        setClip(sourceRegion);
+        flushPixmap(sourceRegion);
 
         // Then clip in window local coordinates, and copy the updated
         // parts of the backingstore image server-side to the window.
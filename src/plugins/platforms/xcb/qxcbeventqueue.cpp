@@ -45,6 +45,8 @@
 #include <QtCore/QMutex>
 #include <QtCore/QDebug>
 
+#include <xcb/xinput.h>
+
 QT_BEGIN_NAMESPACE
 
 static QBasicMutex qAppExiting;
@@ -76,6 +78,15 @@ static bool dispatcherOwnerDestructing = false;
     for a long time, we might run out of nodes in the pool. Then we create nodes
     on a heap. These will be automatically "garbage collected" out of the linked
     list, once the main thread stops blocking.
+
+    Batching:
+
+    The reader thread publishes the tail node once per batch of events read
+    from the connection, and wakes up the dispatcher only if the main thread
+    has flushed the queue since the previous wake-up. While a batch is not yet
+    published, a motion event that is immediately followed by one that
+    QXcbConnection::compressEvent() would let supersede it is replaced in
+    place, so high-rate pointer traffic does not grow the queue.
 */
 
 QXcbEventQueue::QXcbEventQueue(QXcbConnection *connection)
@@ -180,6 +191,8 @@ void QXcbEventQueue::dequeueNode()
 
 void QXcbEventQueue::flushBufferedEvents()
 {
+    // Events published after this point need a new wake-up.
+    m_wakeUpPending.exchange(false, std::memory_order_acq_rel);
     m_flushedTail = m_tail.load(std::memory_order_acquire);
 }
 
@@ -214,14 +227,18 @@ void QXcbEventQueue::run()
     xcb_generic_event_t *event = nullptr;
     xcb_connection_t *connection = m_connection->xcb_connection();
     QXcbEventNode *tail = m_head;
+    QXcbEventNode *publishedTail = m_head;
 
-    auto enqueueEvent = [&tail, this](xcb_generic_event_t *event) {
-        if (!isCloseConnectionEvent(event)) {
+    auto enqueueEvent = [&tail, &publishedTail, this](xcb_generic_event_t *event) {
+        if (isCloseConnectionEvent(event)) {
+            free(event);
+        } else if (tail != publishedTail && isSupersededBy(tail->event, event)) {
+            // the main thread cannot see this node yet, so it is safe to reuse it
+            free(tail->event);
+            tail->event = event;
+        } else {
             tail->next = qXcbEventNodeFactory(event);
             tail = tail->next;
-            m_tail.store(tail, std::memory_order_release);
-        } else {
-            free(event);
         }
     };
 
@@ -231,9 +248,16 @@ void QXcbEventQueue::run()
         while (!m_closeConnectionDetected && (event = xcb_poll_for_queued_event(connection)))
             enqueueEvent(event);
 
+        const bool published = tail != publishedTail;
+        if (published) {
+            m_tail.store(tail, std::memory_order_release);
+            publishedTail = tail;
+        }
+
         m_newEventsCondition.wakeOne();
         m_newEventsMutex.unlock();
-        wakeUpDispatcher();
+        if (published && !m_wakeUpPending.exchange(true, std::memory_order_acq_rel))
+            wakeUpDispatcher();
     }
 
     if (!m_closeConnectionDetected) {
@@ -397,4 +421,38 @@ bool QXcbEventQueue::isCloseConnectionEvent(const xcb_generic_event_t *event)
     return m_closeConnectionDetected;
 }
 
+// Called from the reader thread. Only covers the cases where
+// QXcbConnection::compressEvent() would drop \a event anyway because of \a next.
+bool QXcbEventQueue::isSupersededBy(const xcb_generic_event_t *event,
+                                    const xcb_generic_event_t *next) const
+{
+    if (!event || !QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents))
+        return false;
+
+    const uint responseType = event->response_type & ~0x80;
+    if (responseType != (next->response_type & ~0x80))
+        return false;
+
+    if (responseType == XCB_MOTION_NOTIFY)
+        return true;
+
+    if (responseType == XCB_GE_GENERIC && m_connection->hasXInput2()) {
+        auto *e = const_cast<xcb_generic_event_t *>(event);
+        auto *n = const_cast<xcb_generic_event_t *>(next);
+        // tablet motion is only compressed on request, and checking whether
+        // the source is a tablet is not possible from this thread
+        if (m_connection->isXIType(e, XCB_INPUT_MOTION))
+            return QCoreApplication::testAttribute(Qt::AA_CompressTabletEvents)
+                    && m_connection->isXIType(n, XCB_INPUT_MOTION);
+        if (m_connection->isXIType(e, XCB_INPUT_TOUCH_UPDATE)
+                && m_connection->isXIType(n, XCB_INPUT_TOUCH_UPDATE)) {
+            auto *touch = reinterpret_cast<const xcb_input_touch_update_event_t *>(event);
+            auto *nextTouch = reinterpret_cast<const xcb_input_touch_update_event_t *>(next);
+            return touch->detail % INT_MAX == nextTouch->detail % INT_MAX;
+        }
+    }
+
+    return false;
+}
+
 QT_END_NAMESPACE
@@ -115,11 +115,13 @@ private:
 
     void sendCloseConnectionEvent() const;
     bool isCloseConnectionEvent(const xcb_generic_event_t *event);
+    bool isSupersededBy(const xcb_generic_event_t *event, const xcb_generic_event_t *next) const;
 
     QXcbEventNode *m_head = nullptr;
     QXcbEventNode *m_flushedTail = nullptr;
     std::atomic<QXcbEventNode *> m_tail { nullptr };
     std::atomic_uint m_nodesRestored { 0 };
+    std::atomic_bool m_wakeUpPending { false };
 
     QXcbConnection *m_connection = nullptr;
     bool m_closeConnectionDetected = false;
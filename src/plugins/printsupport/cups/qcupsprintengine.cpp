@@ -46,6 +46,9 @@
 #include <qfile.h>
 #include <qdebug.h>
 #include <qbuffer.h>
+#if QT_CONFIG(thread)
+#include <qthreadpool.h>
+#endif
 #include "private/qcups_p.h" // Only needed for PPK_CupsOptions
 #include <QtGui/qpagelayout.h>
 
@@ -201,7 +204,6 @@ void QCupsPrintEnginePrivate::closePrintDevice()
 
         // Set up print options.
         QList<QPair<QByteArray, QByteArray> > options;
-        QList<cups_option_t> cupsOptStruct;
 
         options.append(QPair<QByteArray, QByteArray>("media", m_pageLayout.pageSize().key().toLocal8Bit()));
 
@@ -238,24 +240,37 @@ void QCupsPrintEnginePrivate::closePrintDevice()
             it += 2;
         }
 
-        const int numOptions = options.size();
-        cupsOptStruct.reserve(numOptions);
-        for (int c = 0; c < numOptions; ++c) {
-            cups_option_t opt;
-            opt.name = options[c].first.data();
-            opt.value = options[c].second.data();
-            cupsOptStruct.append(opt);
-        }
-
         // Print the file
         // Cups expect the printer original name without instance, the full name is used only to retrieve the configuration
         const auto parts = QStringView{printerName}.split(QLatin1Char('/'));
-        const auto printerOriginalName = parts.at(0);
-        cups_option_t* optPtr = cupsOptStruct.size() ? &cupsOptStruct.first() : 0;
-        cupsPrintFile(printerOriginalName.toLocal8Bit().constData(), tempFile.toLocal8Bit().constData(),
-                      title.toLocal8Bit().constData(), cupsOptStruct.size(), optPtr);
+        const QByteArray printerOriginalName = parts.at(0).toLocal8Bit();
+        const QByteArray jobTitle = title.toLocal8Bit();
+
+        // Handing the spool file to cupsd copies all of it, which takes a
+        // while for large documents; don't block the calling thread on it.
+        // QCoreApplication waits for the global thread pool before exiting.
+        auto submit = [printerOriginalName, tempFile, jobTitle, options]() mutable {
+            QList<cups_option_t> cupsOptStruct;
+            const int numOptions = options.size();
+            cupsOptStruct.reserve(numOptions);
+            for (int c = 0; c < numOptions; ++c) {
+                cups_option_t opt;
+                opt.name = options[c].first.data();
+                opt.value = options[c].second.data();
+                cupsOptStruct.append(opt);
+            }
+
+            cups_option_t* optPtr = cupsOptStruct.size() ? &cupsOptStruct.first() : 0;
+            cupsPrintFile(printerOriginalName.constData(), tempFile.toLocal8Bit().constData(),
+                          jobTitle.constData(), cupsOptStruct.size(), optPtr);
 
-        QFile::remove(tempFile);
+            QFile::remove(tempFile);
+        };
+#if QT_CONFIG(thread)
+        QThreadPool::globalInstance()->start(submit);
+#else
+        submit();
+#endif
     }
 }
 
@@ -55,6 +55,7 @@
 #include <qvarlengtharray.h>
 #include <QDebug>
 #include <QSqlQuery>
+#include <QtSql/private/qsqlcolumns_p.h>
 #include <QtSql/private/qsqldriver_p.h>
 #include <QtSql/private/qsqlresult_p.h>
 
@@ -175,6 +176,7 @@ protected:
     bool reset(const QString &query) override;
     QVariant data(int field) override;
     bool isNull(int field) override;
+    bool fetchColumns(int rowCount, QSqlColumns &columns) override;
     int size() override;
     int numRowsAffected() override;
     QSqlRecord record() const override;
@@ -1296,6 +1298,75 @@ QVariant QODBCResult::data(int field)
     return d->fieldCache[field];
 }
 
+bool QODBCResult::fetchColumns(int rowCount, QSqlColumns &columns)
+{
+    Q_D(QODBCResult);
+    if (!isActive())
+        return false;
+
+    QSqlColumnsPrivate *c = QSqlColumnsPrivate::get(columns);
+    c->init(d->rInf, numericalPrecisionPolicy());
+    c->reserve(rowCount);
+    const int count = c->columns.size();
+
+    while (c->rowCount < rowCount) {
+        if (!(at() == QSql::BeforeFirstRow ? fetchFirst() : fetchNext()))
+            break;
+        // columns are retrieved in order, so SQLGetData() is only called
+        // once per column as some drivers require
+        for (int i = 0; i < count; ++i) {
+            SQLRETURN r;
+            SQLLEN lengthIndicator = 0;
+            switch (c->columns.at(i).type) {
+            case QSqlColumns::Int64: {
+                SQLBIGINT lngbuf = 0;
+                r = SQLGetData(d->hStmt, i + 1, SQL_C_SBIGINT, (SQLPOINTER)&lngbuf,
+                               sizeof(lngbuf), &lengthIndicator);
+                if ((r == SQL_SUCCESS || r == SQL_SUCCESS_WITH_INFO) && lengthIndicator != SQL_NULL_DATA)
+                    c->appendInt64(i, qint64(lngbuf));
+                else
+                    c->appendNull(i);
+                break;
+            }
+            case QSqlColumns::Double: {
+                SQLDOUBLE dblbuf = 0;
+                r = SQLGetData(d->hStmt, i + 1, SQL_C_DOUBLE, (SQLPOINTER)&dblbuf,
+                               0, &lengthIndicator);
+                if ((r == SQL_SUCCESS || r == SQL_SUCCESS_WITH_INFO) && lengthIndicator != SQL_NULL_DATA)
+                    c->appendDouble(i, double(dblbuf));
+                else
+                    c->appendNull(i);
+                break;
+            }
+            case QSqlColumns::Text: {
+                const QSqlField info = d->rInf.field(i);
+                if (info.metaType().id() == QMetaType::QString) {
+                    const QString str = qGetStringData(d->hStmt, i, info.length(), d->unicode);
+                    if (str.isNull())
+                        c->appendNull(i);
+                    else
+                        c->appendBytes(i, str.toUtf8());
+                } else {
+                    d->fieldCacheIdx = i;
+                    c->appendValue(i, data(i));
+                }
+                break;
+            }
+            case QSqlColumns::Blob:
+                c->appendValue(i, qGetBinaryData(d->hStmt, i));
+                break;
+            case QSqlColumns::Invalid:
+                break;
+            }
+        }
+        c->finishRow();
+    }
+    // the field cache does not hold the values of the current row
+    d->clearValues();
+    d->fieldCacheIdx = count;
+    return c->rowCount > 0;
+}
+
 bool QODBCResult::isNull(int field)
 {
     Q_D(const QODBCResult);
@@ -51,6 +51,8 @@
 #include <qsocketnotifier.h>
 #include <qstringlist.h>
 #include <qlocale.h>
+#include <qvarlengtharray.h>
+#include <QtSql/private/qsqlcolumns_p.h>
 #include <QtSql/private/qsqlresult_p.h>
 #include <QtSql/private/qsqldriver_p.h>
 #include <QtCore/private/qlocale_tools_p.h>
@@ -136,6 +138,7 @@ protected:
     bool nextResult() override;
     QVariant data(int i) override;
     bool isNull(int field) override;
+    bool fetchColumns(int rowCount, QSqlColumns &columns) override;
     bool reset(const QString &query) override;
     int size() override;
     int numRowsAffected() override;
@@ -143,6 +146,7 @@ protected:
     QVariant lastInsertId() const override;
     bool prepare(const QString &query) override;
     bool exec() override;
+    bool execBatch(bool arrayBind) override;
 };
 
 class QPSQLDriverPrivate final : public QSqlDriverPrivate
@@ -410,6 +414,23 @@ static QVariant::Type qDecodePSQLType(int t)
     return type;
 }
 
+static double qDecodePSQLDouble(const char *val, bool *ok)
+{
+    double dbl = qstrtod(val, nullptr, ok);
+    if (!*ok) {
+        *ok = true;
+        if (qstricmp(val, "NaN") == 0)
+            dbl = qQNaN();
+        else if (qstricmp(val, "Infinity") == 0)
+            dbl = qInf();
+        else if (qstricmp(val, "-Infinity") == 0)
+            dbl = -qInf();
+        else
+            *ok = false;
+    }
+    return dbl;
+}
+
 void QPSQLResultPrivate::deallocatePreparedStmt()
 {
     if (drv_d_func()) {
@@ -654,17 +675,9 @@ QVariant QPSQLResult::data(int i)
                 return QString::fromLatin1(val);
         }
         bool ok;
-        double dbl = qstrtod(val, nullptr, &ok);
-        if (!ok) {
-            if (qstricmp(val, "NaN") == 0)
-                dbl = qQNaN();
-            else if (qstricmp(val, "Infinity") == 0)
-                dbl = qInf();
-            else if (qstricmp(val, "-Infinity") == 0)
-                dbl = -qInf();
-            else
-                return QVariant();
-        }
+        double dbl = qDecodePSQLDouble(val, &ok);
+        if (!ok)
+            return QVariant();
         if (ptype == QNUMERICOID) {
             if (numericalPrecisionPolicy() == QSql::LowPrecisionInt64)
                 return QVariant((qlonglong)dbl);
@@ -708,6 +721,79 @@ QVariant QPSQLResult::data(int i)
     return QVariant();
 }
 
+bool QPSQLResult::fetchColumns(int rowCount, QSqlColumns &columns)
+{
+    Q_D(QPSQLResult);
+    if (!isActive())
+        return false;
+
+    QSqlColumnsPrivate *c = QSqlColumnsPrivate::get(columns);
+    c->init(record(), numericalPrecisionPolicy());
+    c->reserve(rowCount);
+    const int count = c->columns.size();
+    QVarLengthArray<int> ptypes(count);
+    for (int i = 0; i < count; ++i)
+        ptypes[i] = PQftype(d->result, i);
+    const bool isUtf8 = d->drv_d_func()->isUtf8;
+
+    while (c->rowCount < rowCount && fetchNext()) {
+        const int currentRow = isForwardOnly() ? 0 : at();
+        for (int i = 0; i < count; ++i) {
+            if (PQgetisnull(d->result, currentRow, i)) {
+                c->appendNull(i);
+                continue;
+            }
+            const char *val = PQgetvalue(d->result, currentRow, i);
+            switch (c->columns.at(i).type) {
+            case QSqlColumns::Int64:
+                if (ptypes[i] == QBOOLOID) {
+                    c->appendInt64(i, val[0] == 't');
+                } else if (qDecodePSQLType(ptypes[i]) == QVariant::Double) {
+                    // numeric with a LowPrecisionInt policy
+                    bool ok;
+                    c->appendInt64(i, qint64(qDecodePSQLDouble(val, &ok)));
+                } else {
+                    bool ok;
+                    c->appendInt64(i, qstrtoll(val, nullptr, 10, &ok));
+                }
+                break;
+            case QSqlColumns::Double: {
+                bool ok;
+                const double dbl = qDecodePSQLDouble(val, &ok);
+                if (ok)
+                    c->appendDouble(i, dbl);
+                else
+                    c->appendNull(i);
+                break;
+            }
+            case QSqlColumns::Text:
+                if (isUtf8 && qDecodePSQLType(ptypes[i]) == QVariant::String) {
+                    // pass the server's text through without decoding it
+                    c->appendBytes(i, QByteArrayView(val, PQgetlength(d->result, currentRow, i)));
+                } else {
+                    c->appendValue(i, data(i));
+                }
+                break;
+            case QSqlColumns::Blob: {
+                size_t len;
+                unsigned char *data = PQunescapeBytea(reinterpret_cast<const unsigned char *>(val), &len);
+                if (!data) {
+                    c->appendNull(i);
+                    break;
+                }
+                c->appendBytes(i, QByteArrayView(reinterpret_cast<const char *>(data), qsizetype(len)));
+                qPQfreemem(data);
+                break;
+            }
+            case QSqlColumns::Invalid:
+                break;
+            }
+        }
+        c->finishRow();
+    }
+    return c->rowCount > 0;
+}
+
 bool QPSQLResult::isNull(int field)
 {
     Q_D(const QPSQLResult);
@@ -938,6 +1024,89 @@ bool QPSQLResult::exec()
     return d->processResults();
 }
 
+bool QPSQLResult::execBatch(bool arrayBind)
+{
+    Q_D(QPSQLResult);
+    if (!d->preparedQueriesEnabled)
+        return QSqlResult::execBatch(arrayBind);
+
+    const QList<QVariant> values = boundValues();
+    if (values.isEmpty())
+        return false;
+
+    cleanup();
+    setLastError(QSqlError());
+
+    QList<QVariantList> columns;
+    columns.reserve(values.count());
+    for (const QVariant &value : values) {
+        columns.append(value.toList());
+        if (columns.last().count() != columns.first().count()) {
+            setLastError(QSqlError(QCoreApplication::translate("QPSQLResult",
+                                   "Parameter count mismatch"), QString(), QSqlError::StatementError));
+            return false;
+        }
+    }
+
+    // Send the EXECUTE statements of many rows in one query string, so
+    // that the batch costs one round trip per chunk instead of per row.
+    // Unless a transaction is already open, the whole batch runs in one.
+    QPSQLDriverPrivate *drv = d->drv_d_func();
+    const bool implicitTransaction = PQtransactionStatus(drv->connection) == PQTRANS_IDLE;
+    if (implicitTransaction) {
+        PGresult *result = drv->exec("BEGIN");
+        const bool begun = PQresultStatus(result) == PGRES_COMMAND_OK;
+        if (!begun) {
+            setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                                    "Could not begin transaction"), QSqlError::TransactionError, drv, result));
+        }
+        PQclear(result);
+        if (!begun)
+            return false;
+    }
+
+    static const int maxQueryLength = 1 << 20;
+    const QString execute = QStringLiteral("EXECUTE ") + d->preparedStmtId + QStringLiteral(" (");
+    const int rowCount = columns.first().count();
+    QList<QVariant> row(columns.count());
+    QString query;
+    bool ok = true;
+    for (int i = 0; i < rowCount && ok; ++i) {
+        for (int j = 0; j < columns.count(); ++j)
+            row[j] = columns.at(j).at(i);
+        query += execute + qCreateParamString(row, driver()) + QStringLiteral(");");
+        if (query.size() < maxQueryLength && i + 1 < rowCount)
+            continue;
+
+        PQclear(d->result);
+        d->result = drv->exec(query);
+        query.clear();
+        const int status = PQresultStatus(d->result);
+        if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK) {
+            setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                                    "Unable to execute batch"), QSqlError::StatementError, drv, d->result));
+            ok = false;
+        }
+    }
+
+    if (implicitTransaction) {
+        PGresult *result = drv->exec(ok ? "COMMIT" : "ROLLBACK");
+        if (ok && PQresultStatus(result) != PGRES_COMMAND_OK) {
+            setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                                    "Could not commit transaction"), QSqlError::TransactionError, drv, result));
+            ok = false;
+        }
+        PQclear(result);
+    }
+
+    if (!ok) {
+        PQclear(d->result);
+        d->result = nullptr;
+        return false;
+    }
+    return d->processResults();
+}
+
 ///////////////////////////////////////////////////////////////////
 
 bool QPSQLDriverPrivate::setEncodingUtf8()
@@ -48,14 +48,15 @@
 #include <qsqlindex.h>
 #include <qsqlquery.h>
 #include <QtSql/private/qsqlcachedresult_p.h>
+#include <QtSql/private/qsqlcolumns_p.h>
 #include <QtSql/private/qsqldriver_p.h>
 #include <qstringlist.h>
 #include <qvariant.h>
+#include <qvarlengtharray.h>
 #if QT_CONFIG(regularexpression)
 #include <qcache.h>
 #include <qregularexpression.h>
 #endif
-#include <QScopedValueRollback>
 
 #if defined Q_OS_WIN
 # include <qt_windows.h>
@@ -113,6 +114,53 @@ static QSqlError qMakeError(sqlite3 *access, const QString &descr, QSqlError::Er
                      type, QString::number(errorCode));
 }
 
+// binds value to the parameter at index; QString and QByteArray values
+// are not copied and must outlive the statement's next step
+static int qBindValue(sqlite3_stmt *stmt, int index, const QVariant &value)
+{
+    if (value.isNull())
+        return sqlite3_bind_null(stmt, index);
+
+    switch (value.userType()) {
+    case QVariant::ByteArray: {
+        const QByteArray *ba = static_cast<const QByteArray*>(value.constData());
+        return sqlite3_bind_blob(stmt, index, ba->constData(), ba->size(), SQLITE_STATIC);
+    }
+    case QVariant::Int:
+    case QVariant::Bool:
+        return sqlite3_bind_int(stmt, index, value.toInt());
+    case QVariant::Double:
+        return sqlite3_bind_double(stmt, index, value.toDouble());
+    case QVariant::UInt:
+    case QVariant::LongLong:
+        return sqlite3_bind_int64(stmt, index, value.toLongLong());
+    case QVariant::DateTime: {
+        const QDateTime dateTime = value.toDateTime();
+        const QString str = dateTime.toString(Qt::ISODateWithMs);
+        return sqlite3_bind_text16(stmt, index, str.utf16(),
+                                   str.size() * sizeof(ushort), SQLITE_TRANSIENT);
+    }
+    case QVariant::Time: {
+        const QTime time = value.toTime();
+        const QString str = time.toString(u"hh:mm:ss.zzz");
+        return sqlite3_bind_text16(stmt, index, str.utf16(),
+                                   str.size() * sizeof(ushort), SQLITE_TRANSIENT);
+    }
+    case QVariant::String: {
+        // lifetime of string == lifetime of its qvariant
+        const QString *str = static_cast<const QString*>(value.constData());
+        return sqlite3_bind_text16(stmt, index, str->utf16(),
+                                   (str->size()) * sizeof(QChar), SQLITE_STATIC);
+    }
+    default: {
+        QString str = value.toString();
+        // SQLITE_TRANSIENT makes sure that sqlite buffers the data
+        return sqlite3_bind_text16(stmt, index, str.utf16(),
+                                   (str.size()) * sizeof(QChar), SQLITE_TRANSIENT);
+    }
+    }
+}
+
 class QSQLiteResultPrivate;
 
 class QSQLiteResult : public QSqlCachedResult
@@ -127,6 +175,7 @@ public:
 
 protected:
     bool gotoNext(QSqlCachedResult::ValueCache& row, int idx) override;
+    bool appendNextRow(QSqlColumnsPrivate &columns) override;
     bool reset(const QString &query) override;
     bool prepare(const QString &query) override;
     bool execBatch(bool arrayBind) override;
@@ -144,7 +193,12 @@ class QSQLiteDriverPrivate : public QSqlDriverPrivate
     Q_DECLARE_PUBLIC(QSQLiteDriver)
 
 public:
-    inline QSQLiteDriverPrivate() : QSqlDriverPrivate(QSqlDriver::SQLite) {}
+    enum { DefaultStatementCacheSize = 32 };
+
+    inline QSQLiteDriverPrivate() : QSqlDriverPrivate(QSqlDriver::SQLite)
+    {
+        statementCache.setDeleter([](void *stmt) { sqlite3_finalize(static_cast<sqlite3_stmt *>(stmt)); });
+    }
     sqlite3 *access = nullptr;
     QList<QSQLiteResult *> results;
     QStringList notificationid;
@@ -160,11 +214,17 @@ public:
     using QSqlCachedResultPrivate::QSqlCachedResultPrivate;
     void cleanup();
     bool fetchNext(QSqlCachedResult::ValueCache &values, int idx, bool initialFetch);
+    bool fetchNext(QSqlColumnsPrivate &columns);
+    // steps to the next row, handling the end of the result set and errors
+    bool step();
     // initializes the recordInfo and the cache
     void initColumns(bool emptyResultset);
     void finalize();
+    // hands the statement back to the driver's statement cache
+    void release();
 
     sqlite3_stmt *stmt = nullptr;
+    QString stmtQuery; // the SQL text stmt was prepared from
     QSqlRecord rInf;
     QList<QVariant> firstRow;
     bool skippedStatus = false; // the status of the fetchNext() that's skipped
@@ -174,7 +234,7 @@ public:
 void QSQLiteResultPrivate::cleanup()
 {
     Q_Q(QSQLiteResult);
-    finalize();
+    release();
     rInf.clear();
     skippedStatus = false;
     skipRow = false;
@@ -192,6 +252,23 @@ void QSQLiteResultPrivate::finalize()
     stmt = 0;
 }
 
+void QSQLiteResultPrivate::release()
+{
+    if (!stmt)
+        return;
+
+    QSQLiteDriverPrivate *driver = const_cast<QSQLiteDriverPrivate *>(drv_d_func());
+    if (!driver) {
+        finalize();
+        return;
+    }
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    driver->statementCache.insert(stmtQuery, stmt);
+    stmt = nullptr;
+}
+
 void QSQLiteResultPrivate::initColumns(bool emptyResultset)
 {
     Q_Q(QSQLiteResult);
@@ -249,7 +326,6 @@ void QSQLiteResultPrivate::initColumns(bool emptyResultset)
 bool QSQLiteResultPrivate::fetchNext(QSqlCachedResult::ValueCache &values, int idx, bool initialFetch)
 {
     Q_Q(QSQLiteResult);
-    int res;
     int i;
 
     if (skipRow) {
@@ -267,13 +343,107 @@ bool QSQLiteResultPrivate::fetchNext(QSqlCachedResult::ValueCache &values, int i
         firstRow.resize(sqlite3_column_count(stmt));
     }
 
+    if (!step())
+        return false;
+
+    if (idx < 0 && !initialFetch)
+        return true;
+    for (i = 0; i < rInf.count(); ++i) {
+        switch (sqlite3_column_type(stmt, i)) {
+        case SQLITE_BLOB:
+            values[i + idx] = QByteArray(static_cast<const char *>(
+                        sqlite3_column_blob(stmt, i)),
+                        sqlite3_column_bytes(stmt, i));
+            break;
+        case SQLITE_INTEGER:
+            values[i + idx] = sqlite3_column_int64(stmt, i);
+            break;
+        case SQLITE_FLOAT:
+            switch(q->numericalPrecisionPolicy()) {
+                case QSql::LowPrecisionInt32:
+                    values[i + idx] = sqlite3_column_int(stmt, i);
+                    break;
+                case QSql::LowPrecisionInt64:
+                    values[i + idx] = sqlite3_column_int64(stmt, i);
+                    break;
+                case QSql::LowPrecisionDouble:
+                case QSql::HighPrecision:
+                default:
+                    values[i + idx] = sqlite3_column_double(stmt, i);
+                    break;
+            };
+            break;
+        case SQLITE_NULL:
+            values[i + idx] = QVariant(QMetaType::fromType<QString>());
+            break;
+        default:
+            values[i + idx] = QString(reinterpret_cast<const QChar *>(
+                        sqlite3_column_text16(stmt, i)),
+                        sqlite3_column_bytes16(stmt, i) / sizeof(QChar));
+            break;
+        }
+    }
+    return true;
+}
+
+bool QSQLiteResultPrivate::fetchNext(QSqlColumnsPrivate &columns)
+{
+    if (skipRow) {
+        // already fetched by exec()
+        skipRow = false;
+        if (!skippedStatus)
+            return false;
+        for (int i = 0; i < firstRow.count(); ++i)
+            columns.appendValue(i, firstRow.at(i));
+        columns.finishRow();
+        return true;
+    }
+
+    if (!step())
+        return false;
+
+    // read the values in the column's type, letting SQLite convert
+    // cells whose storage class differs
+    for (int i = 0; i < columns.columns.size(); ++i) {
+        if (sqlite3_column_type(stmt, i) == SQLITE_NULL) {
+            columns.appendNull(i);
+            continue;
+        }
+        switch (columns.columns.at(i).type) {
+        case QSqlColumns::Int64:
+            columns.appendInt64(i, sqlite3_column_int64(stmt, i));
+            break;
+        case QSqlColumns::Double:
+            columns.appendDouble(i, sqlite3_column_double(stmt, i));
+            break;
+        case QSqlColumns::Text: {
+            const char *text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, i));
+            columns.appendBytes(i, QByteArrayView(text, sqlite3_column_bytes(stmt, i)));
+            break;
+        }
+        case QSqlColumns::Blob: {
+            const char *blob = static_cast<const char *>(sqlite3_column_blob(stmt, i));
+            columns.appendBytes(i, QByteArrayView(blob, sqlite3_column_bytes(stmt, i)));
+            break;
+        }
+        case QSqlColumns::Invalid:
+            break;
+        }
+    }
+    columns.finishRow();
+    return true;
+}
+
+bool QSQLiteResultPrivate::step()
+{
+    Q_Q(QSQLiteResult);
     if (!stmt) {
         q->setLastError(QSqlError(QCoreApplication::translate("QSQLiteResult", "Unable to fetch row"),
                                   QCoreApplication::translate("QSQLiteResult", "No query"), QSqlError::ConnectionError));
         q->setAt(QSql::AfterLastRow);
         return false;
     }
-    res = sqlite3_step(stmt);
+    int res = sqlite3_step(stmt);
 
     switch(res) {
     case SQLITE_ROW:
@@ -281,43 +451,6 @@ bool QSQLiteResultPrivate::fetchNext(QSqlCachedResult::ValueCache &values, int i
         if (rInf.isEmpty())
             // must be first call.
             initColumns(false);
-        if (idx < 0 && !initialFetch)
-            return true;
-        for (i = 0; i < rInf.count(); ++i) {
-            switch (sqlite3_column_type(stmt, i)) {
-            case SQLITE_BLOB:
-                values[i + idx] = QByteArray(static_cast<const char *>(
-                            sqlite3_column_blob(stmt, i)),
-                            sqlite3_column_bytes(stmt, i));
-                break;
-            case SQLITE_INTEGER:
-                values[i + idx] = sqlite3_column_int64(stmt, i);
-                break;
-            case SQLITE_FLOAT:
-                switch(q->numericalPrecisionPolicy()) {
-                    case QSql::LowPrecisionInt32:
-                        values[i + idx] = sqlite3_column_int(stmt, i);
-                        break;
-                    case QSql::LowPrecisionInt64:
-                        values[i + idx] = sqlite3_column_int64(stmt, i);
-                        break;
-                    case QSql::LowPrecisionDouble:
-                    case QSql::HighPrecision:
-                    default:
-                        values[i + idx] = sqlite3_column_double(stmt, i);
-                        break;
-                };
-                break;
-            case SQLITE_NULL:
-                values[i + idx] = QVariant(QMetaType::fromType<QString>());
-                break;
-            default:
-                values[i + idx] = QString(reinterpret_cast<const QChar *>(
-                            sqlite3_column_text16(stmt, i)),
-                            sqlite3_column_bytes16(stmt, i) / sizeof(QChar));
-                break;
-            }
-        }
         return true;
     case SQLITE_DONE:
         if (rInf.isEmpty())
@@ -385,6 +518,11 @@ bool QSQLiteResult::prepare(const QString &query)
 
     setSelect(false);
 
+    d->stmtQuery = query;
+    d->stmt = static_cast<sqlite3_stmt *>(const_cast<QSQLiteDriverPrivate *>(d->drv_d_func())->statementCache.take(query));
+    if (d->stmt)
+        return true;
+
     const void *pzTail = NULL;
 
 #if (SQLITE_VERSION_NUMBER >= 3003011)
@@ -412,24 +550,108 @@ bool QSQLiteResult::prepare(const QString &query)
 bool QSQLiteResult::execBatch(bool arrayBind)
 {
     Q_UNUSED(arrayBind);
-    Q_D(QSqlResult);
-    QScopedValueRollback<QList<QVariant>> valuesScope(d->values);
-    QList<QVariant> values = d->values;
+    Q_D(QSQLiteResult);
+    const QList<QVariant> values = boundValues();
     if (values.count() == 0)
         return false;
 
-    for (int i = 0; i < values.at(0).toList().count(); ++i) {
-        d->values.clear();
-        QScopedValueRollback<QHash<QString, QList<int>>> indexesScope(d->indexes);
-        auto it = d->indexes.constBegin();
-        while (it != d->indexes.constEnd()) {
-            bindValue(it.key(), values.at(it.value().first()).toList().at(i), QSql::In);
-            ++it;
+    d->skippedStatus = false;
+    d->skipRow = false;
+    d->rInf.clear();
+    clearValues();
+    setLastError(QSqlError());
+    setSelect(false);
+    setActive(false);
+
+    // map each SQL parameter to its list of values once, resolving
+    // reused named placeholders the same way as exec()
+    const int paramCount = sqlite3_bind_parameter_count(d->stmt);
+    QVarLengthArray<int, 16> columnIndexes(paramCount);
+    bool paramCountIsValid = paramCount == values.count();
+    if (paramCountIsValid) {
+        for (int i = 0; i < paramCount; ++i)
+            columnIndexes[i] = i;
+    }
+#if (SQLITE_VERSION_NUMBER >= 3003011)
+    else if (paramCount >= 1 && paramCount < values.count()) {
+        paramCountIsValid = true;
+        for (int i = 0; i < paramCount && paramCountIsValid; ++i) {
+            const char *parameterName = sqlite3_bind_parameter_name(d->stmt, i + 1);
+            columnIndexes[i] = parameterName
+                    ? d->indexes.value(QString::fromUtf8(parameterName)).value(0, -1) : -1;
+            paramCountIsValid = columnIndexes[i] >= 0;
         }
-        if (!exec())
+    }
+#endif
+
+    QList<QVariantList> columns;
+    columns.reserve(values.count());
+    for (const QVariant &value : values) {
+        columns.append(value.toList());
+        if (columns.last().count() != columns.first().count())
+            paramCountIsValid = false;
+    }
+    if (!paramCountIsValid) {
+        setLastError(QSqlError(QCoreApplication::translate("QSQLiteResult",
+                        "Parameter count mismatch"), QString(), QSqlError::StatementError));
+        return false;
+    }
+
+    // without a surrounding transaction every row would be committed,
+    // and synced to disk, on its own; the implicit one is rolled back
+    // on failure, so that either all rows or none are stored
+    sqlite3 *access = d->drv_d_func()->access;
+    const bool implicitTransaction = sqlite3_get_autocommit(access) != 0;
+    if (implicitTransaction) {
+        int res = sqlite3_exec(access, "BEGIN", nullptr, nullptr, nullptr);
+        if (res != SQLITE_OK) {
+            setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                         "Unable to begin transaction"), QSqlError::TransactionError, res));
             return false;
+        }
     }
-    return true;
+
+    bool ok = true;
+    const int rowCount = columns.first().count();
+    for (int row = 0; row < rowCount && ok; ++row) {
+        int res = sqlite3_reset(d->stmt);
+        if (res != SQLITE_OK) {
+            setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                         "Unable to reset statement"), QSqlError::StatementError, res));
+            ok = false;
+            break;
+        }
+        for (int i = 0; i < paramCount; ++i) {
+            res = qBindValue(d->stmt, i + 1, columns.at(columnIndexes[i]).at(row));
+            if (res != SQLITE_OK) {
+                setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                             "Unable to bind parameters"), QSqlError::StatementError, res));
+                ok = false;
+                break;
+            }
+        }
+        if (!ok)
+            break;
+        res = sqlite3_step(d->stmt);
+        if (res != SQLITE_ROW && res != SQLITE_DONE) {
+            setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                         "Unable to fetch row"), QSqlError::ConnectionError, res));
+            ok = false;
+        }
+    }
+    sqlite3_reset(d->stmt);
+
+    if (implicitTransaction) {
+        int res = sqlite3_exec(access, ok ? "COMMIT" : "ROLLBACK", nullptr, nullptr, nullptr);
+        if (ok && res != SQLITE_OK) {
+            setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                         "Unable to commit transaction"), QSqlError::TransactionError, res));
+            sqlite3_exec(access, "ROLLBACK", nullptr, nullptr, nullptr);
+            ok = false;
+        }
+    }
+    setActive(ok);
+    return ok;
 }
 
 bool QSQLiteResult::exec()
@@ -495,57 +717,7 @@ bool QSQLiteResult::exec()
 
     if (paramCountIsValid) {
         for (int i = 0; i < paramCount; ++i) {
-            res = SQLITE_OK;
-            const QVariant value = values.at(i);
-
-            if (value.isNull()) {
-                res = sqlite3_bind_null(d->stmt, i + 1);
-            } else {
-                switch (value.userType()) {
-                case QVariant::ByteArray: {
-                    const QByteArray *ba = static_cast<const QByteArray*>(value.constData());
-                    res = sqlite3_bind_blob(d->stmt, i + 1, ba->constData(),
-                                            ba->size(), SQLITE_STATIC);
-                    break; }
-                case QVariant::Int:
-                case QVariant::Bool:
-                    res = sqlite3_bind_int(d->stmt, i + 1, value.toInt());
-                    break;
-                case QVariant::Double:
-                    res = sqlite3_bind_double(d->stmt, i + 1, value.toDouble());
-                    break;
-                case QVariant::UInt:
-                case QVariant::LongLong:
-                    res = sqlite3_bind_int64(d->stmt, i + 1, value.toLongLong());
-                    break;
-                case QVariant::DateTime: {
-                    const QDateTime dateTime = value.toDateTime();
-                    const QString str = dateTime.toString(Qt::ISODateWithMs);
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str.utf16(),
-                                              str.size() * sizeof(ushort), SQLITE_TRANSIENT);
-                    break;
-                }
-                case QVariant::Time: {
-                    const QTime time = value.toTime();
-                    const QString str = time.toString(u"hh:mm:ss.zzz");
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str.utf16(),
-                                              str.size() * sizeof(ushort), SQLITE_TRANSIENT);
-                    break;
-                }
-                case QVariant::String: {
-                    // lifetime of string == lifetime of its qvariant
-                    const QString *str = static_cast<const QString*>(value.constData());
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str->utf16(),
-                                              (str->size()) * sizeof(QChar), SQLITE_STATIC);
-                    break; }
-                default: {
-                    QString str = value.toString();
-                    // SQLITE_TRANSIENT makes sure that sqlite buffers the data
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str.utf16(),
-                                              (str.size()) * sizeof(QChar), SQLITE_TRANSIENT);
-                    break; }
-                }
-            }
+            res = qBindValue(d->stmt, i + 1, values.at(i));
             if (res != SQLITE_OK) {
                 setLastError(qMakeError(d->drv_d_func()->access, QCoreApplication::translate("QSQLiteResult",
                              "Unable to bind parameters"), QSqlError::StatementError, res));
@@ -575,6 +747,12 @@ bool QSQLiteResult::gotoNext(QSqlCachedResult::ValueCache& row, int idx)
     return d->fetchNext(row, idx, false);
 }
 
+bool QSQLiteResult::appendNextRow(QSqlColumnsPrivate &columns)
+{
+    Q_D(QSQLiteResult);
+    return d->fetchNext(columns);
+}
+
 int QSQLiteResult::size()
 {
     return -1;
@@ -664,6 +842,7 @@ QSQLiteDriver::QSQLiteDriver(sqlite3 *connection, QObject *parent)
 {
     Q_D(QSQLiteDriver);
     d->access = connection;
+    d->statementCache.setCapacity(QSQLiteDriverPrivate::DefaultStatementCacheSize);
     setOpen(true);
     setOpenError(false);
 }
@@ -716,6 +895,7 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
 
 
     int timeOut = 5000;
+    int statementCacheSize = QSQLiteDriverPrivate::DefaultStatementCacheSize;
     bool sharedCache = false;
     bool openReadOnlyOption = false;
     bool openUriOption = false;
@@ -736,6 +916,14 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
                 if (ok)
                     timeOut = nt;
             }
+        } else if (option.startsWith(QLatin1String("QSQLITE_STATEMENT_CACHE_SIZE"))) {
+            option = option.mid(28).trimmed();
+            if (option.startsWith(QLatin1Char('='))) {
+                bool ok;
+                const int size = option.mid(1).trimmed().toInt(&ok);
+                if (ok)
+                    statementCacheSize = size;
+            }
         } else if (option == QLatin1String("QSQLITE_OPEN_READONLY")) {
             openReadOnlyOption = true;
         } else if (option == QLatin1String("QSQLITE_OPEN_URI")) {
@@ -772,6 +960,7 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
 
     if (res == SQLITE_OK) {
         sqlite3_busy_timeout(d->access, timeOut);
+        d->statementCache.setCapacity(statementCacheSize);
         setOpen(true);
         setOpenError(false);
 #if QT_CONFIG(regularexpression)
@@ -802,6 +991,7 @@ void QSQLiteDriver::close()
     if (isOpen()) {
         for (QSQLiteResult *result : qAsConst(d->results))
             result->d_func()->finalize();
+        d->statementCache.clear();
 
         if (d->access && (d->notificationid.count() > 0)) {
             d->notificationid.clear();
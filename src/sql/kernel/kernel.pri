@@ -12,6 +12,9 @@ HEADERS +=      kernel/qtsqlglobal.h \
                 kernel/qsqlresult.h \
                 kernel/qsqlresult_p.h \
                 kernel/qsqlcachedresult_p.h \
+                kernel/qsqlcolumns.h \
+                kernel/qsqlcolumns_p.h \
+                kernel/qsqlconnectionpool.h \
                 kernel/qsqlindex.h
 
 SOURCES +=      kernel/qsqlquery.cpp \
@@ -23,5 +26,7 @@ SOURCES +=      kernel/qsqlquery.cpp \
                 kernel/qsqlerror.cpp \
                 kernel/qsqlresult.cpp \
                 kernel/qsqlindex.cpp \
-                kernel/qsqlcachedresult.cpp
+                kernel/qsqlcachedresult.cpp \
+                kernel/qsqlcolumns.cpp \
+                kernel/qsqlconnectionpool.cpp
 
@@ -38,8 +38,10 @@
 ****************************************************************************/
 
 #include "private/qsqlcachedresult_p.h"
+#include "private/qsqlcolumns_p.h"
 
 #include <qdatetime.h>
+#include <qsqlrecord.h>
 #include <qvariant.h>
 #include <QtSql/private/qsqldriver_p.h>
 
@@ -55,6 +57,11 @@ QT_BEGIN_NAMESPACE
    will give you an index where you can start filling in your data. Special
    case: If the user actually wants a forward-only query, idx will be -1
    to indicate that we are not interested in the actual values.
+
+   For QSqlQuery::fetchColumns() on forward-only queries, appendNextRow()
+   is called instead of gotoNext(). Its default implementation goes through
+   gotoNext(); reimplement it to store the values directly into the column
+   buffers.
 */
 
 static const uint initial_cache_size = 128;
@@ -215,6 +222,39 @@ bool QSqlCachedResult::fetchLast()
     }
 }
 
+bool QSqlCachedResult::fetchColumns(int rowCount, QSqlColumns &columns)
+{
+    Q_D(QSqlCachedResult);
+    if (!d->forwardOnly || !isActive())
+        return QSqlResult::fetchColumns(rowCount, columns);
+
+    QSqlColumnsPrivate *c = QSqlColumnsPrivate::get(columns);
+    c->init(record(), numericalPrecisionPolicy());
+    c->reserve(rowCount);
+    while (c->rowCount < rowCount && !d->atEnd) {
+        if (!appendNextRow(*c)) {
+            d->atEnd = true;
+            break;
+        }
+        setAt(at() + 1);
+    }
+    // the cache no longer holds the values of the current row
+    d->cache.fill(QVariant());
+    return c->rowCount > 0;
+}
+
+bool QSqlCachedResult::appendNextRow(QSqlColumnsPrivate &columns)
+{
+    Q_D(QSqlCachedResult);
+    d->cache.resize(d->colCount);
+    if (!gotoNext(d->cache, 0))
+        return false;
+    for (int i = 0; i < columns.columns.size(); ++i)
+        columns.appendValue(i, d->cache.at(i));
+    columns.finishRow();
+    return true;
+}
+
 QVariant QSqlCachedResult::data(int i)
 {
     Q_D(const QSqlCachedResult);
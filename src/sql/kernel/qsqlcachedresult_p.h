@@ -59,6 +59,7 @@
 QT_BEGIN_NAMESPACE
 
 class QVariant;
+class QSqlColumnsPrivate;
 
 class QSqlCachedResultPrivate;
 
@@ -77,6 +78,7 @@ protected:
     void clearValues();
 
     virtual bool gotoNext(ValueCache &values, int index) = 0;
+    virtual bool appendNextRow(QSqlColumnsPrivate &columns);
 
     QVariant data(int i) override;
     bool isNull(int i) override;
@@ -85,6 +87,7 @@ protected:
     bool fetchPrevious() override;
     bool fetchFirst() override;
     bool fetchLast() override;
+    bool fetchColumns(int rowCount, QSqlColumns &columns) override;
 
     int colCount() const;
     ValueCache &cache();
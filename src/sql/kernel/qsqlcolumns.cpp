@@ -0,0 +1,381 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsqlcolumns.h"
+#include "qsqlcolumns_p.h"
+
+#include "qsqlfield.h"
+#include "qsqlrecord.h"
+
+QT_BEGIN_NAMESPACE
+
+static QSqlColumns::Type qColumnType(QMetaType type, QSql::NumericalPrecisionPolicy policy)
+{
+    switch (type.id()) {
+    case QMetaType::Bool:
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::UChar:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Long:
+    case QMetaType::ULong:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+        return QSqlColumns::Int64;
+    case QMetaType::Float:
+    case QMetaType::Double:
+        if (policy == QSql::LowPrecisionInt32 || policy == QSql::LowPrecisionInt64)
+            return QSqlColumns::Int64;
+        return QSqlColumns::Double;
+    case QMetaType::QByteArray:
+        return QSqlColumns::Blob;
+    default:
+        return QSqlColumns::Text;
+    }
+}
+
+void QSqlColumnsPrivate::init(const QSqlRecord &record, QSql::NumericalPrecisionPolicy policy)
+{
+    rowCount = 0;
+    columns.clear();
+    columns.resize(record.count());
+    for (int i = 0; i < record.count(); ++i) {
+        const QSqlField field = record.field(i);
+        Column &c = columns[i];
+        c.name = field.name();
+        c.type = qColumnType(field.metaType(), policy);
+        if (c.type == QSqlColumns::Text || c.type == QSqlColumns::Blob)
+            c.offsets.append(0);
+    }
+}
+
+void QSqlColumnsPrivate::reserve(int rows)
+{
+    for (Column &c : columns) {
+        switch (c.type) {
+        case QSqlColumns::Int64:
+            c.int64s.reserve(rows);
+            break;
+        case QSqlColumns::Double:
+            c.doubles.reserve(rows);
+            break;
+        case QSqlColumns::Text:
+        case QSqlColumns::Blob:
+            c.offsets.reserve(rows + 1);
+            break;
+        case QSqlColumns::Invalid:
+            break;
+        }
+        c.nulls.reserve((rows + 7) / 8);
+    }
+}
+
+void QSqlColumnsPrivate::appendValue(int column, const QVariant &value)
+{
+    if (value.isNull()) {
+        appendNull(column);
+        return;
+    }
+    switch (columns.at(column).type) {
+    case QSqlColumns::Int64:
+        appendInt64(column, value.toLongLong());
+        break;
+    case QSqlColumns::Double:
+        appendDouble(column, value.toDouble());
+        break;
+    case QSqlColumns::Text:
+        appendBytes(column, value.toString().toUtf8());
+        break;
+    case QSqlColumns::Blob:
+        appendBytes(column, value.toByteArray());
+        break;
+    case QSqlColumns::Invalid:
+        break;
+    }
+}
+
+/*!
+    \class QSqlColumns
+    \brief The QSqlColumns class holds a block of rows fetched column by column.
+    \since 6.0
+
+    \ingroup database
+    \ingroup shared
+    \inmodule QtSql
+
+    QSqlColumns is returned by QSqlQuery::fetchColumns(). Instead of one
+    QVariant per cell it stores every column in a single typed buffer, so
+    that large result sets can be read without allocating an object for
+    each value.
+
+    The type() of a column is derived from the type of the corresponding
+    QSqlField in the query's record: integral and boolean fields become
+    \l Int64 columns, floating-point fields become \l Double columns (or
+    \l Int64 columns if the query's numerical precision policy is
+    QSql::LowPrecisionInt32 or QSql::LowPrecisionInt64), QByteArray fields
+    become \l Blob columns and everything else is stored as UTF-8 \l Text.
+
+    \snippet code/src_sql_kernel_qsqlcolumns.cpp 0
+
+    NULL cells are recorded in a bitmap per column, see nullBitmap(); the
+    corresponding entry of the value buffer holds 0 or an empty string.
+
+    \sa QSqlQuery::fetchColumns()
+*/
+
+/*!
+    \enum QSqlColumns::Type
+
+    This enum describes how the values of a column are stored.
+
+    \value Invalid The column index is out of range.
+    \value Int64 The values are available from int64Data().
+    \value Double The values are available from doubleData().
+    \value Text The values are UTF-8 encoded strings, available from bytes().
+    \value Blob The values are binary data, available from bytes().
+*/
+
+/*!
+    Constructs an empty QSqlColumns with no rows and no columns.
+*/
+QSqlColumns::QSqlColumns() noexcept
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QSqlColumns::QSqlColumns(const QSqlColumns &other) noexcept = default;
+
+/*!
+    Move-constructs a QSqlColumns instance from \a other.
+*/
+QSqlColumns::QSqlColumns(QSqlColumns &&other) noexcept = default;
+
+/*!
+    Assigns \a other to this object.
+*/
+QSqlColumns &QSqlColumns::operator=(const QSqlColumns &other) noexcept = default;
+
+/*!
+    \fn QSqlColumns &QSqlColumns::operator=(QSqlColumns &&other)
+
+    Move-assigns \a other to this object.
+*/
+
+/*!
+    Destroys the object.
+*/
+QSqlColumns::~QSqlColumns() = default;
+
+/*!
+    \fn void QSqlColumns::swap(QSqlColumns &other)
+
+    Swaps this object with \a other. This operation is very fast and
+    never fails.
+*/
+
+/*!
+    \fn bool QSqlColumns::isEmpty() const
+
+    Returns \c true if no rows were fetched.
+*/
+
+/*!
+    Returns the number of rows held.
+*/
+int QSqlColumns::rowCount() const noexcept
+{
+    return d ? d->rowCount : 0;
+}
+
+/*!
+    Returns the number of columns held.
+*/
+int QSqlColumns::columnCount() const noexcept
+{
+    return d ? d->columns.size() : 0;
+}
+
+/*!
+    Returns the storage type of \a column, or \l Invalid if \a column is
+    out of range.
+*/
+QSqlColumns::Type QSqlColumns::type(int column) const
+{
+    if (column < 0 || column >= columnCount())
+        return Invalid;
+    return d->columns.at(column).type;
+}
+
+/*!
+    Returns the field name of \a column.
+*/
+QString QSqlColumns::name(int column) const
+{
+    if (column < 0 || column >= columnCount())
+        return QString();
+    return d->columns.at(column).name;
+}
+
+/*!
+    Returns \c true if the value in \a row of \a column is NULL, or if
+    either index is out of range.
+*/
+bool QSqlColumns::isNull(int row, int column) const
+{
+    if (row < 0 || row >= rowCount() || column < 0 || column >= columnCount())
+        return true;
+    const uchar *bits = nullBitmap(column);
+    return bits[row >> 3] & (1 << (row & 7));
+}
+
+/*!
+    Returns the NULL bitmap of \a column: bit \c{row % 8} of byte
+    \c{row / 8} is set if the value in \c row is NULL. Returns \nullptr
+    if \a column is out of range.
+*/
+const uchar *QSqlColumns::nullBitmap(int column) const
+{
+    if (column < 0 || column >= columnCount())
+        return nullptr;
+    return reinterpret_cast<const uchar *>(d->columns.at(column).nulls.constData());
+}
+
+/*!
+    Returns the rowCount() values of \a column, or \nullptr if \a column
+    is not an \l Int64 column.
+*/
+const qint64 *QSqlColumns::int64Data(int column) const
+{
+    if (type(column) != Int64)
+        return nullptr;
+    return d->columns.at(column).int64s.constData();
+}
+
+/*!
+    Returns the rowCount() values of \a column, or \nullptr if \a column
+    is not a \l Double column.
+*/
+const double *QSqlColumns::doubleData(int column) const
+{
+    if (type(column) != Double)
+        return nullptr;
+    return d->columns.at(column).doubles.constData();
+}
+
+/*!
+    Returns the concatenated values of a \l Text or \l Blob \a column,
+    or \nullptr for columns of any other type. The value in row \c r
+    spans the bytes from \c{bytesOffsets(column)[r]} up to
+    \c{bytesOffsets(column)[r + 1]}.
+
+    \sa bytes()
+*/
+const char *QSqlColumns::bytesData(int column) const
+{
+    const Type t = type(column);
+    if (t != Text && t != Blob)
+        return nullptr;
+    return d->columns.at(column).bytes.constData();
+}
+
+/*!
+    Returns the rowCount() + 1 offsets into bytesData() for a \l Text or
+    \l Blob \a column, or \nullptr for columns of any other type.
+*/
+const qsizetype *QSqlColumns::bytesOffsets(int column) const
+{
+    const Type t = type(column);
+    if (t != Text && t != Blob)
+        return nullptr;
+    return d->columns.at(column).offsets.constData();
+}
+
+/*!
+    Returns a view on the value in \a row of the \l Text or \l Blob
+    \a column. The view remains valid as long as this object is neither
+    modified nor destroyed.
+*/
+QByteArrayView QSqlColumns::bytes(int row, int column) const
+{
+    const qsizetype *offsets = bytesOffsets(column);
+    if (!offsets || row < 0 || row >= rowCount())
+        return QByteArrayView();
+    return QByteArrayView(bytesData(column) + offsets[row], offsets[row + 1] - offsets[row]);
+}
+
+/*!
+    Returns the value in \a row of \a column as a QVariant. This is
+    convenient, but defeats the purpose of fetching columns.
+*/
+QVariant QSqlColumns::value(int row, int column) const
+{
+    if (row < 0 || row >= rowCount())
+        return QVariant();
+    switch (type(column)) {
+    case Int64:
+        if (isNull(row, column))
+            return QVariant(QMetaType::fromType<qint64>());
+        return int64Data(column)[row];
+    case Double:
+        if (isNull(row, column))
+            return QVariant(QMetaType::fromType<double>());
+        return doubleData(column)[row];
+    case Text:
+        if (isNull(row, column))
+            return QVariant(QMetaType::fromType<QString>());
+        {
+            const QByteArrayView text = bytes(row, column);
+            return QString::fromUtf8(text.data(), text.size());
+        }
+    case Blob:
+        if (isNull(row, column))
+            return QVariant(QMetaType::fromType<QByteArray>());
+        return bytes(row, column).toByteArray();
+    case Invalid:
+        break;
+    }
+    return QVariant();
+}
+
+QT_END_NAMESPACE
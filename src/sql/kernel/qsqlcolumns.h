@@ -0,0 +1,93 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSQLCOLUMNS_H
+#define QSQLCOLUMNS_H
+
+#include <QtSql/qtsqlglobal.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+class QSqlColumnsPrivate;
+
+class Q_SQL_EXPORT QSqlColumns
+{
+public:
+    enum Type { Invalid, Int64, Double, Text, Blob };
+
+    QSqlColumns() noexcept;
+    QSqlColumns(const QSqlColumns &other) noexcept;
+    QSqlColumns(QSqlColumns &&other) noexcept;
+    QSqlColumns &operator=(const QSqlColumns &other) noexcept;
+    QSqlColumns &operator=(QSqlColumns &&other) noexcept { swap(other); return *this; }
+    ~QSqlColumns();
+
+    void swap(QSqlColumns &other) noexcept { d.swap(other.d); }
+
+    bool isEmpty() const noexcept { return rowCount() == 0; }
+    int rowCount() const noexcept;
+    int columnCount() const noexcept;
+
+    Type type(int column) const;
+    QString name(int column) const;
+
+    bool isNull(int row, int column) const;
+    const uchar *nullBitmap(int column) const;
+
+    const qint64 *int64Data(int column) const;
+    const double *doubleData(int column) const;
+    const char *bytesData(int column) const;
+    const qsizetype *bytesOffsets(int column) const;
+    QByteArrayView bytes(int row, int column) const;
+
+    QVariant value(int row, int column) const;
+
+private:
+    friend class QSqlColumnsPrivate;
+    QSharedDataPointer<QSqlColumnsPrivate> d;
+};
+
+Q_DECLARE_SHARED(QSqlColumns)
+
+QT_END_NAMESPACE
+
+#endif // QSQLCOLUMNS_H
@@ -0,0 +1,149 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSQLCOLUMNS_P_H
+#define QSQLCOLUMNS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the QtSql drivers.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtSql/private/qtsqlglobal_p.h>
+#include <QtSql/qsqlcolumns.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QSqlRecord;
+
+class Q_SQL_EXPORT QSqlColumnsPrivate : public QSharedData
+{
+public:
+    struct Column
+    {
+        QString name;
+        QSqlColumns::Type type = QSqlColumns::Invalid;
+        QList<qint64> int64s;
+        QList<double> doubles;
+        QByteArray bytes;
+        QList<qsizetype> offsets; // rowCount + 1 entries for Text and Blob
+        QByteArray nulls; // one bit per row, set when the cell is NULL
+    };
+
+    static QSqlColumnsPrivate *get(QSqlColumns &columns)
+    {
+        if (!columns.d)
+            columns.d = new QSqlColumnsPrivate;
+        return columns.d.data();
+    }
+
+    void init(const QSqlRecord &record, QSql::NumericalPrecisionPolicy policy);
+    void reserve(int rows);
+
+    // Each row gets exactly one append...() per column, then finishRow().
+    // appendInt64(), appendDouble() and appendBytes() must match the
+    // column's type; appendValue() converts as needed.
+    void appendNull(int column)
+    {
+        Column &c = columns[column];
+        markNull(c, true);
+        switch (c.type) {
+        case QSqlColumns::Int64:
+            c.int64s.append(0);
+            break;
+        case QSqlColumns::Double:
+            c.doubles.append(0);
+            break;
+        case QSqlColumns::Text:
+        case QSqlColumns::Blob:
+            c.offsets.append(c.bytes.size());
+            break;
+        case QSqlColumns::Invalid:
+            break;
+        }
+    }
+    void appendInt64(int column, qint64 value)
+    {
+        Column &c = columns[column];
+        Q_ASSERT(c.type == QSqlColumns::Int64);
+        markNull(c, false);
+        c.int64s.append(value);
+    }
+    void appendDouble(int column, double value)
+    {
+        Column &c = columns[column];
+        Q_ASSERT(c.type == QSqlColumns::Double);
+        markNull(c, false);
+        c.doubles.append(value);
+    }
+    void appendBytes(int column, QByteArrayView value)
+    {
+        Column &c = columns[column];
+        Q_ASSERT(c.type == QSqlColumns::Text || c.type == QSqlColumns::Blob);
+        markNull(c, false);
+        c.bytes.append(value.data(), value.size());
+        c.offsets.append(c.bytes.size());
+    }
+    void appendValue(int column, const QVariant &value);
+    void finishRow() { ++rowCount; }
+
+    QList<Column> columns;
+    int rowCount = 0;
+
+private:
+    void markNull(Column &c, bool isNull)
+    {
+        const int byte = rowCount >> 3;
+        if (c.nulls.size() <= byte)
+            c.nulls.append('\0');
+        if (isNull)
+            c.nulls.data()[byte] |= char(1 << (rowCount & 7));
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QSQLCOLUMNS_P_H
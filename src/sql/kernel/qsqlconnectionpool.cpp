@@ -0,0 +1,432 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qsqlconnectionpool.h"
+
+#include "qsqldriver.h"
+#include "qsqlerror.h"
+#include "qsqlquery.h"
+
+#include <qcoreapplication.h>
+#include <qdeadlinetimer.h>
+#include <qelapsedtimer.h>
+#include <qlist.h>
+#include <qmutex.h>
+#include <qset.h>
+#include <qthread.h>
+#include <qwaitcondition.h>
+
+QT_BEGIN_NAMESPACE
+
+class QSqlConnectionPoolPrivate
+{
+public:
+    struct IdleConnection
+    {
+        QSqlDatabase db;
+        QThread *lastThread;
+        qint64 releasedAt;
+    };
+
+    int size() const { return idle.size() + busy.size(); }
+    QList<QSqlDatabase> takeExpired();
+    static bool revive(QSqlDatabase &db, const QString &healthCheckQuery);
+    static void drop(QSqlDatabase &db);
+
+    QString connectionName;
+    QString healthCheckQuery;
+    QSqlError lastError;
+    QList<IdleConnection> idle; // oldest first
+    QSet<QString> busy;
+    QElapsedTimer clock;
+    int minimumSize = 0;
+    int maximumSize = QThread::idealThreadCount();
+    int expiryTimeout = 60000;
+    int serial = 0;
+    mutable QMutex mutex;
+    QWaitCondition released;
+};
+
+// must be called with the mutex locked
+QList<QSqlDatabase> QSqlConnectionPoolPrivate::takeExpired()
+{
+    QList<QSqlDatabase> expired;
+    if (expiryTimeout < 0)
+        return expired;
+    const qint64 now = clock.elapsed();
+    while (!idle.isEmpty() && size() > minimumSize
+           && now - idle.constFirst().releasedAt >= expiryTimeout) {
+        expired.append(idle.takeFirst().db);
+    }
+    return expired;
+}
+
+bool QSqlConnectionPoolPrivate::revive(QSqlDatabase &db, const QString &healthCheckQuery)
+{
+    if (db.isOpen()) {
+        if (healthCheckQuery.isEmpty())
+            return true;
+        QSqlQuery query(db);
+        if (query.exec(healthCheckQuery))
+            return true;
+        db.close();
+    }
+    return db.open();
+}
+
+void QSqlConnectionPoolPrivate::drop(QSqlDatabase &db)
+{
+    const QString name = db.connectionName();
+    db.close();
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(name);
+}
+
+/*!
+    \class QSqlConnectionPool
+    \brief The QSqlConnectionPool class shares a set of database
+    connections between threads.
+    \since 6.0
+
+    \ingroup database
+    \inmodule QtSql
+
+    A QSqlDatabase connection can only be used by one thread at a time,
+    and opening a connection to a database server is expensive. The pool
+    keeps open clones of a connection that was added with
+    QSqlDatabase::addDatabase(), and hands them out to the threads that
+    need one.
+
+    acquire() returns an open connection that the calling thread may use
+    until it passes the connection to release(). Connections are opened
+    on demand, up to maximumSize(); when all of them are in use,
+    acquire() waits for one to be released. Idle connections are closed
+    after expiryTimeout(), except for the minimumSize() that the pool
+    keeps open.
+
+    \snippet code/src_sql_kernel_qsqlconnectionpool.cpp 0
+
+    Before an idle connection is handed out again, it is reopened if it
+    was closed and, if a healthCheckQuery() is set, that query is
+    executed on it; a connection on which the query fails is reopened.
+
+    Prepared queries and other state of a connection stay with it while
+    it is idle, so a connection that was used by a thread before is
+    preferred when that thread acquires a connection again.
+
+    All functions of QSqlConnectionPool are thread-safe.
+
+    \sa QSqlDatabase::cloneDatabase()
+*/
+
+/*!
+    Constructs a pool of clones of the connection \a connectionName.
+    The pool does not open any connection until one is acquired.
+*/
+QSqlConnectionPool::QSqlConnectionPool(const QString &connectionName)
+    : d(new QSqlConnectionPoolPrivate)
+{
+    d->connectionName = connectionName;
+    d->clock.start();
+}
+
+/*!
+    Closes and removes all idle connections and destroys the pool.
+    All connections should have been released before.
+*/
+QSqlConnectionPool::~QSqlConnectionPool()
+{
+    QMutexLocker locker(&d->mutex);
+    if (!d->busy.isEmpty()) {
+        qWarning("QSqlConnectionPool: destroyed while %d connection(s) of '%s' are in use",
+                 int(d->busy.size()), d->connectionName.toLocal8Bit().constData());
+    }
+    QList<QSqlConnectionPoolPrivate::IdleConnection> idle;
+    idle.swap(d->idle);
+    locker.unlock();
+    for (QSqlConnectionPoolPrivate::IdleConnection &connection : idle)
+        QSqlConnectionPoolPrivate::drop(connection.db);
+    delete d;
+}
+
+/*!
+    Returns the name of the connection the pool clones.
+*/
+QString QSqlConnectionPool::connectionName() const
+{
+    return d->connectionName;
+}
+
+/*!
+    Sets the number of connections that the pool keeps open when they
+    are idle to \a size. The default is 0.
+
+    \sa expiryTimeout()
+*/
+void QSqlConnectionPool::setMinimumSize(int size)
+{
+    QMutexLocker locker(&d->mutex);
+    d->minimumSize = qMax(0, size);
+}
+
+/*!
+    Returns the number of connections that the pool keeps open when they
+    are idle.
+*/
+int QSqlConnectionPool::minimumSize() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->minimumSize;
+}
+
+/*!
+    Sets the maximum number of connections the pool opens to \a size.
+    The default is QThread::idealThreadCount().
+
+    Lowering the maximum does not close connections; idle connections
+    above the new maximum are closed once they expire.
+*/
+void QSqlConnectionPool::setMaximumSize(int size)
+{
+    QMutexLocker locker(&d->mutex);
+    d->maximumSize = qMax(1, size);
+    d->released.wakeAll();
+}
+
+/*!
+    Returns the maximum number of connections the pool opens.
+*/
+int QSqlConnectionPool::maximumSize() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->maximumSize;
+}
+
+/*!
+    Sets the time after which idle connections above minimumSize() are
+    closed to \a msecs milliseconds. The default is 60000 (one minute);
+    a negative value keeps idle connections open.
+
+    Expired connections are closed the next time a connection is
+    acquired or released.
+*/
+void QSqlConnectionPool::setExpiryTimeout(int msecs)
+{
+    QMutexLocker locker(&d->mutex);
+    d->expiryTimeout = msecs;
+}
+
+/*!
+    Returns the time in milliseconds after which idle connections above
+    minimumSize() are closed.
+*/
+int QSqlConnectionPool::expiryTimeout() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->expiryTimeout;
+}
+
+/*!
+    Sets the SQL statement that is executed on an idle connection before
+    it is handed out by acquire() to \a query. If it fails, the
+    connection is reopened. By default no query is executed.
+
+    A cheap statement such as \c{SELECT 1} is usually enough.
+*/
+void QSqlConnectionPool::setHealthCheckQuery(const QString &query)
+{
+    QMutexLocker locker(&d->mutex);
+    d->healthCheckQuery = query;
+}
+
+/*!
+    Returns the statement executed on idle connections before they are
+    handed out.
+*/
+QString QSqlConnectionPool::healthCheckQuery() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->healthCheckQuery;
+}
+
+/*!
+    Returns an open connection for the calling thread, waiting up to
+    \a msecs milliseconds for one to be released if maximumSize()
+    connections are in use. A negative \a msecs waits forever.
+
+    Returns an invalid QSqlDatabase if the wait timed out or if no
+    connection could be opened; lastError() then describes the failure.
+
+    The connection must be passed to release(), by the same thread, when
+    it is no longer needed.
+*/
+QSqlDatabase QSqlConnectionPool::acquire(int msecs)
+{
+    QDeadlineTimer deadline(msecs < 0 ? QDeadlineTimer(QDeadlineTimer::Forever)
+                                      : QDeadlineTimer(msecs));
+    QThread *thread = QThread::currentThread();
+    QMutexLocker locker(&d->mutex);
+    for (;;) {
+        QList<QSqlDatabase> expired = d->takeExpired();
+        if (!expired.isEmpty()) {
+            locker.unlock();
+            for (QSqlDatabase &db : expired)
+                QSqlConnectionPoolPrivate::drop(db);
+            locker.relock();
+            continue;
+        }
+
+        if (!d->idle.isEmpty()) {
+            // prefer the connection this thread released last, otherwise
+            // the most recently released one
+            qsizetype i = d->idle.size() - 1;
+            for (qsizetype j = i; j >= 0; --j) {
+                if (d->idle.at(j).lastThread == thread) {
+                    i = j;
+                    break;
+                }
+            }
+            QSqlDatabase db = d->idle.takeAt(i).db;
+            const QString name = db.connectionName();
+            const QString healthCheckQuery = d->healthCheckQuery;
+            d->busy.insert(name);
+            locker.unlock();
+
+            db.driver()->moveToThread(thread);
+            if (QSqlConnectionPoolPrivate::revive(db, healthCheckQuery))
+                return db;
+
+            const QSqlError error = db.lastError();
+            QSqlConnectionPoolPrivate::drop(db);
+            locker.relock();
+            d->lastError = error;
+            d->busy.remove(name);
+            continue;
+        }
+
+        if (d->size() < d->maximumSize) {
+            const QString name = d->connectionName + QLatin1String("_pool_")
+                    + QString::number(++d->serial);
+            d->busy.insert(name);
+            locker.unlock();
+
+            QSqlDatabase db = QSqlDatabase::cloneDatabase(d->connectionName, name);
+            if (db.isValid() && db.open())
+                return db;
+
+            const QSqlError error = db.isValid() ? db.lastError()
+                    : QSqlError(QCoreApplication::translate("QSqlConnectionPool",
+                                                           "Unknown connection"),
+                                d->connectionName, QSqlError::ConnectionError);
+            if (db.isValid())
+                QSqlConnectionPoolPrivate::drop(db);
+            locker.relock();
+            d->lastError = error;
+            d->busy.remove(name);
+            d->released.wakeOne();
+            return QSqlDatabase();
+        }
+
+        if (!d->released.wait(&d->mutex, deadline)) {
+            d->lastError = QSqlError(QCoreApplication::translate("QSqlConnectionPool",
+                                                                 "No connection available"),
+                                     QString(), QSqlError::ConnectionError);
+            return QSqlDatabase();
+        }
+    }
+}
+
+/*!
+    Returns the connection \a db, obtained from acquire(), to the pool.
+    This function must be called by the thread that acquired \a db, and
+    neither \a db nor queries on it may be used afterwards.
+*/
+void QSqlConnectionPool::release(const QSqlDatabase &db)
+{
+    QMutexLocker locker(&d->mutex);
+    if (!d->busy.contains(db.connectionName())) {
+        qWarning("QSqlConnectionPool::release: connection '%s' was not acquired from this pool",
+                 db.connectionName().toLocal8Bit().constData());
+        return;
+    }
+
+    // expire older connections only, db itself has just been used
+    QList<QSqlDatabase> expired = d->takeExpired();
+    d->busy.remove(db.connectionName());
+    // no thread may use the connection until it is acquired again
+    db.driver()->moveToThread(nullptr);
+    d->idle.append({ db, QThread::currentThread(), d->clock.elapsed() });
+    d->released.wakeOne();
+    locker.unlock();
+
+    for (QSqlDatabase &connection : expired)
+        QSqlConnectionPoolPrivate::drop(connection);
+}
+
+/*!
+    Returns the number of connections the pool has open, whether they
+    are in use or idle.
+*/
+int QSqlConnectionPool::size() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->size();
+}
+
+/*!
+    Returns the number of open connections that are not in use.
+*/
+int QSqlConnectionPool::idleCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->idle.size();
+}
+
+/*!
+    Returns the reason why the last call to acquire() failed, or why a
+    connection had to be discarded.
+*/
+QSqlError QSqlConnectionPool::lastError() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->lastError;
+}
+
+QT_END_NAMESPACE
@@ -48,6 +48,7 @@
 #include "qsqlindex.h"
 #include "private/qfactoryloader_p.h"
 #include "private/qsqlnulldriver_p.h"
+#include "private/qsqldriver_p.h"
 #include "qmutex.h"
 #include "qhash.h"
 #include "qthread.h"
@@ -138,8 +139,12 @@ QSqlDatabasePrivate::QSqlDatabasePrivate(const QSqlDatabasePrivate &other) : ref
 
 QSqlDatabasePrivate::~QSqlDatabasePrivate()
 {
-    if (driver != shared_null()->driver)
+    if (driver != shared_null()->driver) {
+#if QT_CONFIG(future)
+        QSqlDriverPrivate::get(driver)->waitForAsyncQueries();
+#endif
         delete driver;
+    }
 }
 
 void QSqlDatabasePrivate::cleanConnections()
@@ -790,6 +795,9 @@ bool QSqlDatabase::open(const QString& user, const QString& password)
 
 void QSqlDatabase::close()
 {
+#if QT_CONFIG(future)
+    QSqlDriverPrivate::get(d->driver)->waitForAsyncQueries();
+#endif
     d->driver->close();
 }
 
@@ -1208,6 +1216,7 @@ QSqlRecord QSqlDatabase::record(const QString& tablename) const
     \li QSQLITE_OPEN_URI
     \li QSQLITE_ENABLE_SHARED_CACHE
     \li QSQLITE_ENABLE_REGEXP
+    \li QSQLITE_STATEMENT_CACHE_SIZE
     \endlist
 
     \li
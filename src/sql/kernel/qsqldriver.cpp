@@ -45,6 +45,9 @@
 #include "qsqlindex.h"
 #include "private/qobject_p.h"
 #include "private/qsqldriver_p.h"
+#if QT_CONFIG(future)
+#include "qthreadpool.h"
+#endif
 
 #include <limits.h>
 
@@ -102,6 +105,77 @@ QSqlDriver::~QSqlDriver()
 {
 }
 
+#if QT_CONFIG(future)
+QThreadPool *QSqlDriverPrivate::asyncThreadPool()
+{
+    Q_Q(QSqlDriver);
+    if (!asyncPool) {
+        // a single thread keeps the connection's queries in order; it never
+        // expires, since client libraries may keep per-thread state
+        asyncPool = new QThreadPool(q);
+        asyncPool->setMaxThreadCount(1);
+        asyncPool->setExpiryTimeout(-1);
+        asyncPool->setObjectName(QStringLiteral("Qt SQL async"));
+    }
+    return asyncPool;
+}
+
+void QSqlDriverPrivate::waitForAsyncQueries()
+{
+    if (asyncPool)
+        asyncPool->waitForDone();
+}
+#endif
+
+void QSqlStatementCache::setCapacity(int capacity)
+{
+    maxSize = qMax(capacity, 0);
+    trim(maxSize);
+}
+
+void *QSqlStatementCache::take(const QString &query)
+{
+    const auto it = entries.find(query);
+    if (it == entries.end())
+        return nullptr;
+    void *handle = it->handle;
+    entries.erase(it);
+    return handle;
+}
+
+void QSqlStatementCache::insert(const QString &query, void *handle)
+{
+    if (!handle)
+        return;
+    if (!destroy || maxSize == 0 || entries.contains(query)) {
+        // another result already returned a statement for the same query
+        if (destroy)
+            destroy(handle);
+        return;
+    }
+    trim(maxSize - 1);
+    entries.insert(query, { handle, ++useCounter });
+}
+
+void QSqlStatementCache::clear()
+{
+    trim(0);
+}
+
+void QSqlStatementCache::trim(int size)
+{
+    while (entries.size() > qMax(size, 0)) {
+        auto lru = entries.begin();
+        for (auto it = entries.begin(), end = entries.end(); it != end; ++it) {
+            if (it->lastUse < lru->lastUse)
+                lru = it;
+        }
+        if (destroy)
+            destroy(lru->handle);
+        entries.erase(lru);
+    }
+}
+
 /*!
     \since 5.0
 
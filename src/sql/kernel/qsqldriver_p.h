@@ -55,9 +55,50 @@
 #include "private/qobject_p.h"
 #include "qsqldriver.h"
 #include "qsqlerror.h"
+#include "qhash.h"
 
 QT_BEGIN_NAMESPACE
 
+#if QT_CONFIG(future)
+class QThreadPool;
+#endif
+
+// Keeps prepared native statement handles keyed by their SQL text so that
+// preparing the same query again on a connection can reuse them. The cache
+// owns the handles it holds and destroys them through the deleter; a handle
+// that is taken out belongs to the caller until it is inserted again.
+class Q_SQL_EXPORT QSqlStatementCache
+{
+public:
+    typedef void (*Deleter)(void *handle);
+
+    QSqlStatementCache() = default;
+    ~QSqlStatementCache() { clear(); }
+
+    void setDeleter(Deleter deleter) { destroy = deleter; }
+    int capacity() const { return maxSize; }
+    void setCapacity(int capacity);
+    int size() const { return int(entries.size()); }
+
+    void *take(const QString &query);
+    void insert(const QString &query, void *handle);
+    void clear();
+
+private:
+    Q_DISABLE_COPY_MOVE(QSqlStatementCache)
+
+    struct Entry {
+        void *handle;
+        quint64 lastUse;
+    };
+    void trim(int size);
+
+    QHash<QString, Entry> entries;
+    Deleter destroy = nullptr;
+    quint64 useCounter = 0;
+    int maxSize = 0;
+};
+
 class QSqlDriverPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QSqlDriver)
@@ -68,6 +109,17 @@ public:
         dbmsType(type)
     { }
 
+#if QT_CONFIG(future)
+    static QSqlDriverPrivate *get(QSqlDriver *driver)
+    { return static_cast<QSqlDriverPrivate *>(QObjectPrivate::get(driver)); }
+
+    QThreadPool *asyncThreadPool();
+    void waitForAsyncQueries();
+
+    QThreadPool *asyncPool = nullptr; // runs QSqlQuery::execAsync()
+#endif
+
+    QSqlStatementCache statementCache; // disabled unless a driver sets a deleter and capacity
     QSqlError error;
     QSql::NumericalPrecisionPolicy precisionPolicy = QSql::LowPrecisionDouble;
     QSqlDriver::DbmsType dbmsType;
@@ -50,6 +50,11 @@
 #include "qsqldriver.h"
 #include "qsqldatabase.h"
 #include "private/qsqlnulldriver_p.h"
+#if QT_CONFIG(future)
+#include "qfuture.h"
+#include "qthreadpool.h"
+#include "private/qsqldriver_p.h"
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -758,6 +763,41 @@ bool QSqlQuery::last()
     return d->sqlResult->fetchLast();
 }
 
+/*!
+  \since 6.0
+
+  Retrieves up to \a rowCount records following the current one and
+  returns their values column by column. This avoids creating a QVariant
+  for every value and is meant for reading large result sets; the SQLite,
+  PostgreSQL and ODBC drivers fill the column buffers directly when the
+  query is \l{setForwardOnly()}{forward only}, other drivers fall back
+  to reading each value through the generic interface.
+
+  The same rules as for next() apply to every record retrieved. The query
+  is positioned on the last record returned, or after the last record if
+  fewer than \a rowCount records were available, in which case an empty
+  QSqlColumns is eventually returned. The values of the records returned
+  are only guaranteed to be available from the returned QSqlColumns, not
+  from value().
+
+  Note that the result must be in the \l{isActive()}{active} state and
+  isSelect() must return true, otherwise an empty QSqlColumns is returned.
+
+  \snippet code/src_sql_kernel_qsqlcolumns.cpp 0
+
+  \sa next(), QSqlColumns
+*/
+QSqlColumns QSqlQuery::fetchColumns(int rowCount)
+{
+    QSqlColumns columns;
+    if (!isSelect() || !isActive() || rowCount <= 0 || at() == QSql::AfterLastRow)
+        return columns;
+    d->sqlResult->fetchColumns(rowCount, columns);
+    if (columns.rowCount() < rowCount)
+        d->sqlResult->setAt(QSql::AfterLastRow);
+    return columns;
+}
+
 /*!
   Returns the size of the result (number of rows returned), or -1 if
   the size cannot be determined or if the database does not support
@@ -1057,6 +1097,10 @@ bool QSqlQuery::exec()
   example, you cannot mix integer and string variants within a
   QVariantList.
 
+  The SQLite and PostgreSQL drivers execute the whole batch in one
+  transaction if none is active, and roll it back if any row fails, so
+  that either all rows or none are stored.
+
   The \a mode parameter indicates how the bound QVariantList will be
   interpreted.  If \a mode is \c ValuesAsRows, every variant within
   the QVariantList will be interpreted as a value for a new row. \c
@@ -1297,4 +1341,69 @@ bool QSqlQuery::nextResult()
     return false;
 }
 
+#if QT_CONFIG(future)
+template <typename Exec>
+static QFuture<QSqlQuery> qExecAsync(const QSqlQuery &query, Exec exec)
+{
+    QFutureInterface<QSqlQuery> promise;
+    promise.reportStarted();
+    QFuture<QSqlQuery> future = promise.future();
+
+    QSqlDriver *driver = const_cast<QSqlDriver *>(query.driver());
+    if (!driver || !driver->isOpen() || driver->isOpenError()) {
+        // fails right away, no need for a thread
+        QSqlQuery q = query;
+        exec(q);
+        promise.reportResult(q);
+        promise.reportFinished();
+        return future;
+    }
+
+    QSqlDriverPrivate::get(driver)->asyncThreadPool()->start([promise, q = query, exec]() mutable {
+        exec(q);
+        promise.reportResult(q);
+        promise.reportFinished();
+    });
+    return future;
+}
+
+/*!
+    \since 6.0
+
+    Executes a previously prepared SQL query in the background and
+    returns a QFuture that finishes when the query has been executed.
+    The future's result is this query, on which lastError(), next(),
+    value() and so on can then be used as after exec().
+
+    The query runs on a single worker thread owned by the database
+    connection. The driver executes all of the connection's asynchronous
+    queries on that same thread for as long as the driver exists, one at
+    a time, in the order in which they were started. Until the returned future has
+    finished, neither this query nor any other query on the same
+    connection may be used from any other thread; QSqlDatabase::close()
+    waits for pending queries.
+
+    \sa exec(), prepare()
+*/
+QFuture<QSqlQuery> QSqlQuery::execAsync()
+{
+    return qExecAsync(*this, [](QSqlQuery &q) { q.exec(); });
+}
+
+/*!
+    \since 6.0
+    \overload
+
+    Executes the SQL in  query in the background and returns a QFuture
+    that finishes when it has been executed. The future's result is a
+    QSqlQuery holding the outcome; like exec(const QString &), this
+    detaches from other copies of this query, so the results are only
+    available from the QSqlQuery returned by the future.
+*/
+QFuture<QSqlQuery> QSqlQuery::execAsync(const QString &query)
+{
+    return qExecAsync(*this, [query](QSqlQuery &q) { q.exec(query); });
+}
+#endif // QT_CONFIG(future)
+
 QT_END_NAMESPACE
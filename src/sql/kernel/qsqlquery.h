@@ -42,11 +42,15 @@
 
 #include <QtSql/qtsqlglobal.h>
 #include <QtSql/qsqldatabase.h>
+#include <QtSql/qsqlcolumns.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
 
+#if QT_CONFIG(future)
+template <typename T> class QFuture;
+#endif
 
 class QSqlDriver;
 class QSqlError;
@@ -93,6 +97,7 @@ public:
     bool previous();
     bool first();
     bool last();
+    QSqlColumns fetchColumns(int rowCount);
 
     void clear();
 
@@ -113,6 +118,11 @@ public:
     void finish();
     bool nextResult();
 
+#if QT_CONFIG(future)
+    QFuture<QSqlQuery> execAsync();
+    QFuture<QSqlQuery> execAsync(const QString &query);
+#endif
+
 private:
     QSqlQueryPrivate* d;
 };
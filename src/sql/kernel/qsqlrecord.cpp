@@ -41,6 +41,7 @@
 
 #include "qatomic.h"
 #include "qdebug.h"
+#include "qhash.h"
 #include "qlist.h"
 #include "qsqlfield.h"
 #include "qstring.h"
@@ -53,20 +54,71 @@ class QSqlRecordPrivate
 public:
     QSqlRecordPrivate();
     QSqlRecordPrivate(const QSqlRecordPrivate &other);
+    ~QSqlRecordPrivate();
 
     inline bool contains(int index) { return index >= 0 && index < fields.count(); }
     QString createField(int index, const QString &prefix) const;
 
+    int indexOfFieldName(const QString &name) const;
+    void invalidateIndex();
+
     QList<QSqlField> fields;
     QAtomicInt ref;
+
+private:
+    // Maps the case-folded field names to the position of the first field
+    // with that name. Built on the first lookup by name, and dropped when
+    // the fields change.
+    typedef QHash<QString, int> NameIndex;
+    mutable QAtomicPointer<NameIndex> nameIndex;
 };
 
-QSqlRecordPrivate::QSqlRecordPrivate() : ref(1)
+QSqlRecordPrivate::QSqlRecordPrivate() : ref(1), nameIndex(nullptr)
+{
+}
+
+QSqlRecordPrivate::QSqlRecordPrivate(const QSqlRecordPrivate &other)
+    : fields(other.fields), ref(1), nameIndex(nullptr)
 {
 }
 
-QSqlRecordPrivate::QSqlRecordPrivate(const QSqlRecordPrivate &other): fields(other.fields), ref(1)
+QSqlRecordPrivate::~QSqlRecordPrivate()
 {
+    delete nameIndex.loadRelaxed();
+}
+
+/*! \internal
+    Returns the position of the first field called \a name, compared
+    case-insensitively, or -1 if there is none.
+
+    This can be called concurrently on a shared private, so the index is
+    published atomically; a thread losing the race discards its copy.
+*/
+int QSqlRecordPrivate::indexOfFieldName(const QString &name) const
+{
+    NameIndex *index = nameIndex.loadAcquire();
+    if (!index) {
+        NameIndex *newIndex = new NameIndex;
+        newIndex->reserve(fields.count());
+        for (int i = fields.count() - 1; i >= 0; --i)
+            newIndex->insert(fields.at(i).name().toCaseFolded(), i);
+        if (nameIndex.testAndSetOrdered(nullptr, newIndex, index)) {
+            index = newIndex;
+        } else {
+            delete newIndex;
+        }
+    }
+    return index->value(name.toCaseFolded(), -1);
+}
+
+/*! \internal
+    Must be called after the fields or their names were modified. The
+    record has been detached at that point, so nobody else can be reading
+    the index.
+*/
+void QSqlRecordPrivate::invalidateIndex()
+{
+    delete nameIndex.fetchAndStoreRelaxed(nullptr);
 }
 
 /*! \internal
@@ -232,13 +284,12 @@ QString QSqlRecord::fieldName(int index) const
 
 int QSqlRecord::indexOf(const QString& name) const
 {
-    QStringView tableName;
-    QStringView fieldName(name);
     const int idx = name.indexOf(QLatin1Char('.'));
-    if (idx != -1) {
-        tableName = fieldName.left(idx);
-        fieldName = fieldName.mid(idx + 1);
-    }
+    if (idx == -1)
+        return d->indexOfFieldName(name);
+
+    const QStringView tableName = QStringView(name).left(idx);
+    const QStringView fieldName = QStringView(name).mid(idx + 1);
     const int cnt = count();
     for (int i = 0; i < cnt; ++i) {
         // Check the passed in name first in case it is an alias using a dot.
@@ -246,7 +297,7 @@ int QSqlRecord::indexOf(const QString& name) const
         const auto &currentField = d->fields.at(i);
         const auto &currentFieldName = currentField.name();
         if (currentFieldName.compare(name, Qt::CaseInsensitive) == 0
-            || (idx != -1 && currentFieldName.compare(fieldName, Qt::CaseInsensitive) == 0
+            || (currentFieldName.compare(fieldName, Qt::CaseInsensitive) == 0
                 && currentField.tableName().compare(tableName, Qt::CaseInsensitive) == 0)) {
             return i;
         }
@@ -283,6 +334,7 @@ void QSqlRecord::append(const QSqlField& field)
 {
     detach();
     d->fields.append(field);
+    d->invalidateIndex();
 }
 
 /*!
@@ -294,6 +346,7 @@ void QSqlRecord::insert(int pos, const QSqlField& field)
 {
    detach();
    d->fields.insert(pos, field);
+   d->invalidateIndex();
 }
 
 /*!
@@ -310,6 +363,7 @@ void QSqlRecord::replace(int pos, const QSqlField& field)
 
     detach();
     d->fields[pos] = field;
+    d->invalidateIndex();
 }
 
 /*!
@@ -326,6 +380,7 @@ void QSqlRecord::remove(int pos)
 
     detach();
     d->fields.remove(pos);
+    d->invalidateIndex();
 }
 
 /*!
@@ -338,6 +393,7 @@ void QSqlRecord::clear()
 {
     detach();
     d->fields.clear();
+    d->invalidateIndex();
 }
 
 /*!
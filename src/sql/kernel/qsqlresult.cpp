@@ -47,6 +47,7 @@
 #include "qsqlfield.h"
 #include "qsqlrecord.h"
 #include "qsqlresult_p.h"
+#include "qsqlcolumns_p.h"
 #include "qvariant.h"
 #include "private/qsqldriver_p.h"
 #include <QDebug>
@@ -984,6 +985,39 @@ bool QSqlResult::nextResult()
     return false;
 }
 
+/*! \internal
+    \since 6.0
+
+    Fetches up to \a rowCount rows following the current one into
+    \a columns and positions the result on the last row fetched.
+    Returns \c true if at least one row was fetched.
+
+    The default implementation reads every value through fetchNext(),
+    isNull() and data(). Drivers reimplement this function to fill the
+    column buffers straight from the database client library.
+
+    \sa QSqlQuery::fetchColumns()
+*/
+bool QSqlResult::fetchColumns(int rowCount, QSqlColumns &columns)
+{
+    QSqlColumnsPrivate *c = QSqlColumnsPrivate::get(columns);
+    c->init(record(), numericalPrecisionPolicy());
+    c->reserve(rowCount);
+    const int count = c->columns.size();
+    while (c->rowCount < rowCount) {
+        if (!(at() == QSql::BeforeFirstRow ? fetchFirst() : fetchNext()))
+            break;
+        for (int i = 0; i < count; ++i) {
+            if (isNull(i))
+                c->appendNull(i);
+            else
+                c->appendValue(i, data(i));
+        }
+        c->finishRow();
+    }
+    return c->rowCount > 0;
+}
+
 /*!
     Returns the low-level database handle for this result set
     wrapped in a QVariant or an invalid QVariant if there is no handle.
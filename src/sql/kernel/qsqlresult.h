@@ -55,6 +55,7 @@ class QSqlRecord;
 class QVariant;
 class QSqlDriver;
 class QSqlError;
+class QSqlColumns;
 class QSqlResultPrivate;
 
 class Q_SQL_EXPORT QSqlResult
@@ -133,6 +134,7 @@ protected:
     virtual void setNumericalPrecisionPolicy(QSql::NumericalPrecisionPolicy policy);
     QSql::NumericalPrecisionPolicy numericalPrecisionPolicy() const;
     virtual bool nextResult();
+    virtual bool fetchColumns(int rowCount, QSqlColumns &columns);
     void resetBindCount(); // HACK
 
     QSqlResultPrivate *d_ptr;
@@ -356,6 +356,105 @@ QString QSqlTableModel::tableName() const
     return d->tableName;
 }
 
+/*! \internal
+    Returns the values of row \a queryRow of \a query.
+*/
+QVariantList QSqlTableModelPrivate::rowValues(QSqlQuery &query, int queryRow)
+{
+    QVariantList values;
+    if (!query.seek(queryRow))
+        return values;
+    const int count = query.record().count();
+    values.reserve(count);
+    for (int i = 0; i < count; ++i)
+        values.append(query.value(i));
+    return values;
+}
+
+/*! \internal
+    Replaces the model's query with the freshly executed \a newQuery, which has
+    the same columns. Instead of resetting the model, only the rows between
+    the longest runs of unchanged rows at the start and at the end are
+    updated: surplus rows are removed or missing rows are inserted at the end
+    of that range, and the remaining rows in it are reported as changed.
+    Rows with pending or submitted changes never count as unchanged.
+
+    Returns \c false if the model cannot be updated this way.
+*/
+bool QSqlTableModelPrivate::selectIncrementally(QSqlQuery &newQuery)
+{
+    Q_Q(QSqlTableModel);
+    if (nestedResetLevel || newQuery.isForwardOnly() || newQuery.record() != rec)
+        return false;
+
+    const int oldCount = q->rowCount();
+    QList<QVariantList> oldRows;
+    oldRows.reserve(oldCount);
+    for (int row = 0; row < oldCount; ++row) {
+        if (cache.contains(row))
+            oldRows.append(QVariantList());
+        else
+            oldRows.append(rowValues(query, q->indexInQuery(q->createIndex(row, 0)).row()));
+    }
+
+    // without a query size, read as many rows as the model shows plus
+    // room for the rows that were inserted
+    bool newAtEnd = true;
+    int newCount = 0;
+    if (newQuery.driver()->hasFeature(QSqlDriver::QuerySize) && newQuery.size() >= 0) {
+        newCount = newQuery.size();
+    } else {
+        const int limit = oldCount + int(cache.size());
+        while (newCount < limit && newQuery.seek(newCount))
+            ++newCount;
+        newAtEnd = newCount < limit;
+    }
+
+    const auto unchanged = [&](int oldRow, int newRow) {
+        const QVariantList &values = oldRows.at(oldRow);
+        return !values.isEmpty() && values == rowValues(newQuery, newRow);
+    };
+    int head = 0;
+    while (head < oldCount && head < newCount && unchanged(head, head))
+        ++head;
+    int tail = 0;
+    while (tail < oldCount - head && tail < newCount - head
+           && unchanged(oldCount - tail - 1, newCount - tail - 1)) {
+        ++tail;
+    }
+
+    const auto switchQuery = [&]() {
+        cache.clear();
+        query = newQuery;
+        error = QSqlError();
+        atEnd = newAtEnd;
+        bottom = q->createIndex(newCount - 1, rec.count() - 1);
+    };
+
+    const int oldMiddle = oldCount - head - tail;
+    const int newMiddle = newCount - head - tail;
+    if (newMiddle < oldMiddle) {
+        q->beginRemoveRows(QModelIndex(), head + newMiddle, head + oldMiddle - 1);
+        switchQuery();
+        q->endRemoveRows();
+    } else if (newMiddle > oldMiddle) {
+        q->beginInsertRows(QModelIndex(), head + oldMiddle, head + newMiddle - 1);
+        switchQuery();
+        q->endInsertRows();
+    } else {
+        switchQuery();
+    }
+
+    const int changed = qMin(oldMiddle, newMiddle);
+    if (changed > 0) {
+        emit q->dataChanged(q->createIndex(head, 0),
+                            q->createIndex(head + changed - 1, rec.count() - 1));
+        emit q->headerDataChanged(Qt::Vertical, head, head + changed - 1);
+    }
+    q->queryChange();
+    return true;
+}
+
 /*!
     Populates the model with data from the table that was set via setTable(), using the
     specified filter and sort condition, and returns \c true if successful; otherwise
@@ -363,7 +462,7 @@ QString QSqlTableModel::tableName() const
 
     \note Calling select() will revert any unsubmitted changes and remove any inserted columns.
 
-    \sa setTable(), setFilter(), selectStatement()
+    \sa setTable(), setFilter(), selectStatement(), setIncrementalSelect()
 */
 bool QSqlTableModel::select()
 {
@@ -372,11 +471,14 @@ bool QSqlTableModel::select()
     if (query.isEmpty())
         return false;
 
+    QSqlQuery qu(query, d->db);
+    if (d->incrementalSelect && d->query.isActive() && qu.isActive() && d->selectIncrementally(qu))
+        return true;
+
     beginResetModel();
 
     d->clearCache();
 
-    QSqlQuery qu(query, d->db);
     setQuery(qu);
 
     if (!qu.isActive() || lastError().isValid()) {
@@ -895,6 +997,48 @@ QSqlTableModel::EditStrategy QSqlTableModel::editStrategy() const
     return d->strategy;
 }
 
+/*!
+    \since 6.0
+
+    If \a enable is true, select() updates a populated model in place
+    instead of resetting it. This includes the select() that submitAll()
+    performs with the \l OnManualSubmit strategy.
+
+    The rows read from the database are compared with the rows the model
+    showed before. Runs of unchanged rows at the start and at the end are
+    kept as they are. Only the rows between them are removed, inserted, or
+    reported through dataChanged(). Views keep their scroll position,
+    selection, and persistent indexes for the rows outside that range.
+    Because both results are read and compared, this costs more than a
+    reset when most rows have changed.
+
+    The model is reset as before if the columns of the query changed,
+    for example after removeColumns() or setTable().
+
+    By default, select() resets the model.
+
+    \sa incrementalSelect(), select()
+*/
+void QSqlTableModel::setIncrementalSelect(bool enable)
+{
+    Q_D(QSqlTableModel);
+    d->incrementalSelect = enable;
+}
+
+/*!
+    \since 6.0
+
+    Returns \c true if select() updates a populated model in place instead
+    of resetting it.
+
+    \sa setIncrementalSelect()
+*/
+bool QSqlTableModel::incrementalSelect() const
+{
+    Q_D(const QSqlTableModel);
+    return d->incrementalSelect;
+}
+
 /*!
     Reverts all pending changes.
 
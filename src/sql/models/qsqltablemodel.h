@@ -87,6 +87,9 @@ public:
     virtual void setEditStrategy(EditStrategy strategy);
     EditStrategy editStrategy() const;
 
+    void setIncrementalSelect(bool enable);
+    bool incrementalSelect() const;
+
     QSqlIndex primaryKey() const;
     QSqlDatabase database() const;
     int fieldIndex(const QString &fieldName) const;
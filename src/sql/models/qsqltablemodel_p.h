@@ -69,7 +69,8 @@ public:
         : sortColumn(-1),
           sortOrder(Qt::AscendingOrder),
           strategy(QSqlTableModel::OnRowChange),
-          busyInsertingRows(false)
+          busyInsertingRows(false),
+          incrementalSelect(false)
     {}
     ~QSqlTableModelPrivate();
 
@@ -84,6 +85,8 @@ public:
     QString strippedFieldName(const QString &name) const;
     int insertCount(int maxRow = -1) const;
     void initRecordAndPrimaryIndex();
+    static QVariantList rowValues(QSqlQuery &query, int queryRow);
+    bool selectIncrementally(QSqlQuery &query);
 
     QSqlDatabase db;
 
@@ -92,6 +95,7 @@ public:
 
     QSqlTableModel::EditStrategy strategy;
     bool busyInsertingRows;
+    bool incrementalSelect;
 
     QSqlQuery editQuery = { QSqlQuery(nullptr) };
     QSqlIndex primaryIndex;
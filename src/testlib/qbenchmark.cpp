@@ -45,6 +45,11 @@
 #include <QtCore/qdir.h>
 #include <QtCore/qset.h>
 #include <QtCore/qdebug.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 
 QT_BEGIN_NAMESPACE
 
@@ -88,6 +93,10 @@ QBenchmarkMeasurerBase * QBenchmarkGlobalData::createMeasurer()
 #endif
     } else if (mode_ == EventCounter) {
         measurer = new QBenchmarkEvent;
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+    } else if (mode_ == AllocationCounter) {
+        measurer = new QBenchmarkAllocationCounter;
+#endif
     } else {
         measurer =  new QBenchmarkTimeMeasurer;
     }
@@ -101,6 +110,61 @@ int QBenchmarkGlobalData::adjustMedianIterationCount()
         ? medianIterationCount : measurer->adjustMedianCount(1);
 }
 
+int QBenchmarkGlobalData::adjustWarmupIterationCount()
+{
+    if (warmupIterationCount != -1)
+        return warmupIterationCount;
+    return measurer->needsWarmupIteration() ? 1 : 0;
+}
+
+static qreal quantile(const qreal *sorted, qsizetype count, qreal q)
+{
+    // Linear interpolation between the closest ranks
+    const qreal position = q * (count - 1);
+    const qsizetype lower = qsizetype(position);
+    const qsizetype upper = qMin(lower + 1, count - 1);
+    return sorted[lower] + (position - lower) * (sorted[upper] - sorted[lower]);
+}
+
+QBenchmarkStatistics QBenchmarkStatistics::compute(const QList<QBenchmarkResult> &samples)
+{
+    QBenchmarkStatistics statistics;
+    if (samples.isEmpty())
+        return statistics;
+
+    QVarLengthArray<qreal, 64> values;
+    for (const QBenchmarkResult &sample : samples)
+        values.append(sample.value / sample.iterations);
+    std::sort(values.begin(), values.end());
+
+    const qreal q1 = quantile(values.constData(), values.size(), 0.25);
+    const qreal q3 = quantile(values.constData(), values.size(), 0.75);
+    const qreal fence = 1.5 * (q3 - q1);
+    const qreal *begin = std::lower_bound(values.cbegin(), values.cend(), q1 - fence);
+    const qreal *end = std::upper_bound(begin, values.cend(), q3 + fence);
+    if (begin == end) {
+        begin = values.cbegin();
+        end = values.cend();
+    }
+    const qsizetype count = end - begin;
+
+    statistics.sampleCount = int(count);
+    statistics.outlierCount = int(values.size() - count);
+    statistics.minimum = *begin;
+    statistics.median = quantile(begin, count, 0.5);
+    statistics.percentile95 = quantile(begin, count, 0.95);
+    statistics.mean = std::accumulate(begin, end, qreal(0)) / count;
+    if (count > 1) {
+        qreal sumOfSquares = 0;
+        for (const qreal *it = begin; it != end; ++it)
+            sumOfSquares += (*it - statistics.mean) * (*it - statistics.mean);
+        statistics.standardDeviation = std::sqrt(sumOfSquares / (count - 1));
+        // Normal approximation; good enough for the sample counts used here
+        statistics.confidenceInterval95 = 1.96 * statistics.standardDeviation / std::sqrt(qreal(count));
+    }
+    return statistics;
+}
+
 
 QBenchmarkTestMethodData *QBenchmarkTestMethodData::current;
 
@@ -194,7 +258,10 @@ QTest::QBenchmarkIterationController::QBenchmarkIterationController()
 QTest::QBenchmarkIterationController::~QBenchmarkIterationController()
 {
     const qreal result = QTest::endBenchmarkMeasurement();
-    QBenchmarkTestMethodData::current->setResult(result, QBenchmarkGlobalData::current->measurer->metricType());
+    QBenchmarkMeasurerBase *measurer = QBenchmarkGlobalData::current->measurer;
+    QBenchmarkTestMethodData::current->setResult(result, measurer->metricType());
+    QBenchmarkTestMethodData::current->result.secondaryMeasurements =
+            measurer->secondaryMeasurements();
 }
 
 /*! \internal
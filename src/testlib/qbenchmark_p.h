@@ -61,6 +61,17 @@
 #undef QTESTLIB_USE_PERF_EVENTS
 #endif
 
+// Counting allocations relies on interposing glibc's malloc, which does not
+// work in static builds and clashes with the sanitizers' own interceptors.
+#if defined(Q_OS_LINUX) && defined(__GLIBC__) && !defined(QT_STATIC) \
+    && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__) \
+    && !QT_HAS_FEATURE(address_sanitizer) && !QT_HAS_FEATURE(thread_sanitizer) \
+    && !QT_HAS_FEATURE(memory_sanitizer)
+#define QTESTLIB_USE_ALLOCATION_COUNTER
+#else
+#undef QTESTLIB_USE_ALLOCATION_COUNTER
+#endif
+
 #include <QtTest/private/qbenchmarkmeasurement_p.h>
 #include <QtCore/QMap>
 #include <QtTest/qttestglobal.h>
@@ -71,6 +82,9 @@
 #include <QtTest/private/qbenchmarkperfevents_p.h>
 #endif
 #include <QtTest/private/qbenchmarkevent_p.h>
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+#include <QtTest/private/qbenchmarkallocations_p.h>
+#endif
 #include <QtTest/private/qbenchmarkmetric_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -93,6 +107,29 @@ struct QBenchmarkContext
 };
 Q_DECLARE_TYPEINFO(QBenchmarkContext, Q_MOVABLE_TYPE);
 
+class QBenchmarkResult;
+
+/*
+    Summary of the per-iteration values of all samples taken for one data
+    row. Samples outside Tukey's fences (1.5 times the interquartile range
+    below the first or above the third quartile) are counted as outliers
+    and excluded from the other figures.
+*/
+struct QBenchmarkStatistics
+{
+    int sampleCount = 0;
+    int outlierCount = 0;
+    qreal minimum = 0;
+    qreal median = 0;
+    qreal percentile95 = 0;
+    qreal mean = 0;
+    qreal standardDeviation = 0;
+    qreal confidenceInterval95 = 0; // half-width of the interval around the mean
+
+    static QBenchmarkStatistics compute(const QList<QBenchmarkResult> &samples);
+};
+Q_DECLARE_TYPEINFO(QBenchmarkStatistics, Q_PRIMITIVE_TYPE);
+
 class QBenchmarkResult
 {
 public:
@@ -102,6 +139,8 @@ public:
     QTest::QBenchmarkMetric metric = QTest::FramesPerSecond;
     bool setByMacro = true;
     bool valid = false;
+    QBenchmarkStatistics statistics;
+    QList<QBenchmarkMeasurerBase::Measurement> secondaryMeasurements;
 
     QBenchmarkResult() = default;
 
@@ -135,17 +174,20 @@ public:
 
     QBenchmarkGlobalData();
     ~QBenchmarkGlobalData();
-    enum Mode { WallTime, CallgrindParentProcess, CallgrindChildProcess, PerfCounter, TickCounter, EventCounter };
+    enum Mode { WallTime, CallgrindParentProcess, CallgrindChildProcess, PerfCounter, TickCounter, EventCounter,
+                AllocationCounter };
     void setMode(Mode mode);
     Mode mode() const { return mode_; }
     QBenchmarkMeasurerBase *createMeasurer();
     int adjustMedianIterationCount();
+    int adjustWarmupIterationCount();
 
     QBenchmarkMeasurerBase *measurer = nullptr;
     QBenchmarkContext context;
     int walltimeMinimum = -1;
     int iterationCount = -1;
     int medianIterationCount = -1;
+    int warmupIterationCount = -1;
     bool createChart = false;
     bool verboseOutput = false;
     QString callgrindOutFileBase;
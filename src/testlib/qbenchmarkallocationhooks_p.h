@@ -0,0 +1,156 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtTest module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QBENCHMARKALLOCATIONHOOKS_P_H
+#define QBENCHMARKALLOCATIONHOOKS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// Include this file in exactly one source file of a test executable to be
+// able to use -allocationcounter. It replaces malloc() and friends for the
+// whole process, so it must not end up in a library: the definitions below
+// take precedence over the C library's because they live in the executable.
+// They forward to glibc's own entry points and only count while a
+// measurement is running.
+
+#include <QtTest/private/qbenchmark_p.h>
+
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+
+#include <errno.h>
+#include <stdlib.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *ptr);
+}
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+QBenchmarkAllocationHooks qt_benchmarkAllocationHooks = {
+    Q_BASIC_ATOMIC_INITIALIZER(0), Q_BASIC_ATOMIC_INITIALIZER(0), Q_BASIC_ATOMIC_INITIALIZER(0)
+};
+
+inline void qt_countAllocation(size_t size)
+{
+    if (Q_UNLIKELY(qt_benchmarkAllocationHooks.enabled.loadRelaxed())) {
+        qt_benchmarkAllocationHooks.allocationCount.fetchAndAddRelaxed(1);
+        qt_benchmarkAllocationHooks.allocatedBytes.fetchAndAddRelaxed(qint64(size));
+    }
+}
+
+const struct QBenchmarkAllocationHooksRegistrar
+{
+    QBenchmarkAllocationHooksRegistrar()
+    {
+        QBenchmarkAllocationCounter::registerHooks(&qt_benchmarkAllocationHooks);
+    }
+} qt_benchmarkAllocationHooksRegistrar;
+
+} // unnamed namespace
+
+QT_END_NAMESPACE
+
+extern "C" Q_DECL_EXPORT void *malloc(size_t size) noexcept
+{
+    QT_PREPEND_NAMESPACE(qt_countAllocation)(size);
+    return __libc_malloc(size);
+}
+
+extern "C" Q_DECL_EXPORT void *calloc(size_t count, size_t size) noexcept
+{
+    QT_PREPEND_NAMESPACE(qt_countAllocation)(count * size);
+    return __libc_calloc(count, size);
+}
+
+extern "C" Q_DECL_EXPORT void *realloc(void *ptr, size_t size) noexcept
+{
+    // Growing or shrinking a block counts as a new allocation, since that
+    // is what avoiding the realloc would save.
+    QT_PREPEND_NAMESPACE(qt_countAllocation)(size);
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" Q_DECL_EXPORT void *memalign(size_t alignment, size_t size) noexcept
+{
+    QT_PREPEND_NAMESPACE(qt_countAllocation)(size);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" Q_DECL_EXPORT void *aligned_alloc(size_t alignment, size_t size) noexcept
+{
+    QT_PREPEND_NAMESPACE(qt_countAllocation)(size);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" Q_DECL_EXPORT int posix_memalign(void **ptr, size_t alignment, size_t size) noexcept
+{
+    // __libc_memalign() accepts any alignment; posix_memalign() must not
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    QT_PREPEND_NAMESPACE(qt_countAllocation)(size);
+    void *result = __libc_memalign(alignment, size);
+    if (!result)
+        return ENOMEM;
+    *ptr = result;
+    return 0;
+}
+
+extern "C" Q_DECL_EXPORT void free(void *ptr) noexcept
+{
+    __libc_free(ptr);
+}
+
+#endif // QTESTLIB_USE_ALLOCATION_COUNTER
+
+#endif // QBENCHMARKALLOCATIONHOOKS_P_H
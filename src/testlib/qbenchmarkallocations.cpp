@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtTest module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/private/qbenchmark_p.h>
+
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+
+QT_BEGIN_NAMESPACE
+
+static QBenchmarkAllocationHooks *allocationHooks = nullptr;
+
+// This class does not exist in the API so it's qdoc comment marker was removed.
+
+/*
+    \class QBenchmarkAllocationCounter
+    \brief The heap allocation benchmark backend
+
+    Counts the heap allocations made by any thread of the process while
+    the benchmarked code runs. This includes operator new and QArrayData,
+    which both allocate through malloc(). The number of allocations is the
+    reported result; the number of bytes requested is reported as a
+    secondary BytesAllocated measurement.
+
+    QtTest itself does not replace the allocator. The test executable opts
+    in by including qbenchmarkallocationhooks_p.h, whose malloc() and
+    friends count into the QBenchmarkAllocationHooks they register here.
+*/
+
+/*
+    Called by the allocation hooks when the test executable starts.
+*/
+void QBenchmarkAllocationCounter::registerHooks(QBenchmarkAllocationHooks *hooks)
+{
+    allocationHooks = hooks;
+}
+
+bool QBenchmarkAllocationCounter::hooksRegistered()
+{
+    return allocationHooks != nullptr;
+}
+
+QBenchmarkAllocationCounter::QBenchmarkAllocationCounter()
+{
+    Q_ASSERT(allocationHooks);
+}
+
+QBenchmarkAllocationCounter::~QBenchmarkAllocationCounter()
+{
+    allocationHooks->enabled.storeRelaxed(0);
+}
+
+void QBenchmarkAllocationCounter::start()
+{
+    allocationHooks->allocationCount.storeRelaxed(0);
+    allocationHooks->allocatedBytes.storeRelaxed(0);
+    allocationHooks->enabled.storeRelaxed(1);
+}
+
+qint64 QBenchmarkAllocationCounter::checkpoint()
+{
+    return allocationHooks->allocationCount.loadRelaxed();
+}
+
+qint64 QBenchmarkAllocationCounter::stop()
+{
+    allocationHooks->enabled.storeRelaxed(0);
+    bytesAllocated = allocationHooks->allocatedBytes.loadRelaxed();
+    return allocationHooks->allocationCount.loadRelaxed();
+}
+
+// Like the event counter, zero allocations is a valid (and desirable)
+// result, so every measurement is accepted.
+bool QBenchmarkAllocationCounter::isMeasurementAccepted(qint64)
+{
+    return true;
+}
+
+int QBenchmarkAllocationCounter::adjustIterationCount(int)
+{
+    return 1;
+}
+
+int QBenchmarkAllocationCounter::adjustMedianCount(int)
+{
+    return 1;
+}
+
+QTest::QBenchmarkMetric QBenchmarkAllocationCounter::metricType()
+{
+    return QTest::Allocations;
+}
+
+QList<QBenchmarkMeasurerBase::Measurement> QBenchmarkAllocationCounter::secondaryMeasurements()
+{
+    return { { qreal(bytesAllocated), QTest::BytesAllocated } };
+}
+
+QT_END_NAMESPACE
+
+#endif // QTESTLIB_USE_ALLOCATION_COUNTER
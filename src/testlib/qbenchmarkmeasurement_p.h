@@ -52,12 +52,19 @@
 //
 
 #include <QtTest/qbenchmark.h>
+#include <QtCore/qlist.h>
 
 QT_BEGIN_NAMESPACE
 
 class QBenchmarkMeasurerBase
 {
 public:
+    struct Measurement
+    {
+        qreal value;
+        QTest::QBenchmarkMetric metric;
+    };
+
     virtual ~QBenchmarkMeasurerBase() = default;
     virtual void init() {}
     virtual void start() = 0;
@@ -69,6 +76,9 @@ public:
     virtual bool repeatCount() { return true; }
     virtual bool needsWarmupIteration() { return false; }
     virtual QTest::QBenchmarkMetric metricType() = 0;
+    // Values of any additional counters sampled together with the value
+    // returned by the last call to stop().
+    virtual QList<Measurement> secondaryMeasurements() { return {}; }
 };
 
 QT_END_NAMESPACE
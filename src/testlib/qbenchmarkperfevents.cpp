@@ -43,6 +43,8 @@
 
 #ifdef QTESTLIB_USE_PERF_EVENTS
 
+#include <QtCore/qbytearray.h>
+
 // include the qcore_unix_p.h without core-private
 // we only use inline functions anyway
 #include "../corelib/kernel/qcore_unix_p.h"
@@ -84,24 +86,29 @@
 QT_BEGIN_NAMESPACE
 
 static perf_event_attr attr;
+static QList<perf_event_attr> secondaryAttrs;
+
+static void initAttr(perf_event_attr &a)
+{
+    memset(&a, 0, sizeof a);
+    a.size = sizeof a;
+    a.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    a.disabled = true; // we'll enable later
+    a.inherit = true; // let children processes inherit the monitoring
+    a.pinned = true; // keep it running in the hardware
+    a.inherit_stat = true; // aggregate all the info from child processes
+    a.task = true; // trace fork/exits
+
+    // set a default performance counter: CPU cycles
+    a.type = PERF_TYPE_HARDWARE;
+    a.config = PERF_COUNT_HW_CPU_CYCLES; // default
+}
 
 static void initPerf()
 {
     static bool done;
     if (!done) {
-        memset(&attr, 0, sizeof attr);
-        attr.size = sizeof attr;
-        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
-        attr.disabled = true; // we'll enable later
-        attr.inherit = true; // let children processes inherit the monitoring
-        attr.pinned = true; // keep it running in the hardware
-        attr.inherit_stat = true; // aggregate all the info from child processes
-        attr.task = true; // trace fork/exits
-
-        // set a default performance counter: CPU cycles
-        attr.type = PERF_TYPE_HARDWARE;
-        attr.config = PERF_COUNT_HW_CPU_CYCLES; // default
-
+        initAttr(attr);
         done = true;
     }
 }
@@ -429,9 +436,8 @@ QTest::QBenchmarkMetric QBenchmarkPerfEventsMeasurer::metricForEvent(quint32 typ
     return QTest::Events;
 }
 
-void QBenchmarkPerfEventsMeasurer::setCounter(const char *name)
+static void parseCounter(perf_event_attr &attr, const char *name)
 {
-    initPerf();
     const char *colon = strchr(name, ':');
     int n = colon ? colon - name : strlen(name);
     const Events *ptr = eventlist;
@@ -475,6 +481,26 @@ void QBenchmarkPerfEventsMeasurer::setCounter(const char *name)
     }
 }
 
+void QBenchmarkPerfEventsMeasurer::setCounter(const char *name)
+{
+    // A comma-separated list selects several counters. The first one is
+    // the reported result; the others are opened in the same event group,
+    // so that they are scheduled, enabled and disabled together with it.
+    initPerf();
+    const QList<QByteArray> names = QByteArray(name).split(',');
+    parseCounter(attr, names.constFirst().constData());
+
+    secondaryAttrs.clear();
+    for (qsizetype i = 1; i < names.size(); ++i) {
+        perf_event_attr member;
+        initAttr(member);
+        member.disabled = false; // controlled through the group leader
+        member.pinned = false; // only valid for the group leader
+        parseCounter(member, names.at(i).constData());
+        secondaryAttrs.append(member);
+    }
+}
+
 void QBenchmarkPerfEventsMeasurer::listCounters()
 {
     if (!isAvailable()) {
@@ -497,13 +523,18 @@ void QBenchmarkPerfEventsMeasurer::listCounters()
            "  h - exclude measuring in the hypervisor\n"
            "  G - exclude measuring when running virtualized (guest VM)\n"
            "  H - exclude measuring when running non-virtualized (host system)\n"
-           "Attributes can be combined, for example: -perfcounter branch-mispredicts:kh\n");
+           "Attributes can be combined, for example: -perfcounter branch-mispredicts:kh\n"
+           "\nSeveral counters can be measured together by separating them with commas,\n"
+           "for example: -perfcounter cycles,instructions,branch-misses\n"
+           "The first counter is the reported result; the others are logged in addition.\n");
 }
 
 QBenchmarkPerfEventsMeasurer::QBenchmarkPerfEventsMeasurer() = default;
 
 QBenchmarkPerfEventsMeasurer::~QBenchmarkPerfEventsMeasurer()
 {
+    for (int memberFd : qAsConst(secondaryFds))
+        qt_safe_close(memberFd);
     qt_safe_close(fd);
 }
 
@@ -527,26 +558,43 @@ void QBenchmarkPerfEventsMeasurer::start()
         } else {
             ::fcntl(fd, F_SETFD, FD_CLOEXEC);
         }
+
+        for (perf_event_attr &member : secondaryAttrs) {
+            const int memberFd = perf_event_open(&member, 0, -1, fd, 0);
+            if (memberFd == -1) {
+                perror("QBenchmarkPerfEventsMeasurer::start: perf_event_open");
+                exit(1);
+            }
+            ::fcntl(memberFd, F_SETFD, FD_CLOEXEC);
+            secondaryFds.append(memberFd);
+        }
     }
 
-    // enable the counter
-    ::ioctl(fd, PERF_EVENT_IOC_RESET);
-    ::ioctl(fd, PERF_EVENT_IOC_ENABLE);
+    // enable the counters
+    ::ioctl(fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
 }
 
 qint64 QBenchmarkPerfEventsMeasurer::checkpoint()
 {
-    ::ioctl(fd, PERF_EVENT_IOC_DISABLE);
-    qint64 value = readValue();
-    ::ioctl(fd, PERF_EVENT_IOC_ENABLE);
+    ::ioctl(fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    qint64 value = readValue(fd, attr);
+    ::ioctl(fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
     return value;
 }
 
 qint64 QBenchmarkPerfEventsMeasurer::stop()
 {
-    // disable the counter
-    ::ioctl(fd, PERF_EVENT_IOC_DISABLE);
-    return readValue();
+    // disable the counters; the whole group stops at the same time
+    ::ioctl(fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    secondaryValues.clear();
+    for (qsizetype i = 0; i < secondaryFds.size(); ++i) {
+        const perf_event_attr &member = secondaryAttrs.at(i);
+        secondaryValues.append({ qreal(readValue(secondaryFds.at(i), member)),
+                                 metricForEvent(member.type, member.config) });
+    }
+    return readValue(fd, attr);
 }
 
 bool QBenchmarkPerfEventsMeasurer::isMeasurementAccepted(qint64)
@@ -569,6 +617,11 @@ QTest::QBenchmarkMetric QBenchmarkPerfEventsMeasurer::metricType()
     return metricForEvent(attr.type, attr.config);
 }
 
+QList<QBenchmarkMeasurerBase::Measurement> QBenchmarkPerfEventsMeasurer::secondaryMeasurements()
+{
+    return secondaryValues;
+}
+
 static quint64 rawReadValue(int fd)
 {
     /* from the kernel docs:
@@ -604,10 +657,10 @@ static quint64 rawReadValue(int fd)
     return results.value * (double(results.time_running) / double(results.time_enabled));
 }
 
-qint64 QBenchmarkPerfEventsMeasurer::readValue()
+qint64 QBenchmarkPerfEventsMeasurer::readValue(int fd, const perf_event_attr &attr)
 {
     quint64 raw = rawReadValue(fd);
-    if (metricType() == QTest::WalltimeMilliseconds) {
+    if (metricForEvent(attr.type, attr.config) == QTest::WalltimeMilliseconds) {
         // perf returns nanoseconds
         return raw / 1000000;
     }
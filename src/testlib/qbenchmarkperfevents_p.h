@@ -53,6 +53,8 @@
 
 #include <QtTest/private/qbenchmarkmeasurement_p.h>
 
+struct perf_event_attr;
+
 QT_BEGIN_NAMESPACE
 
 class QBenchmarkPerfEventsMeasurer : public QBenchmarkMeasurerBase
@@ -70,6 +72,7 @@ public:
     bool repeatCount() override { return true; }
     bool needsWarmupIteration() override { return true; }
     QTest::QBenchmarkMetric metricType() override;
+    QList<Measurement> secondaryMeasurements() override;
 
     static bool isAvailable();
     static QTest::QBenchmarkMetric metricForEvent(quint32 type, quint64 event_id);
@@ -77,8 +80,10 @@ public:
     static void listCounters();
 private:
     int fd = -1;
+    QList<int> secondaryFds;
+    QList<Measurement> secondaryValues;
 
-    qint64 readValue();
+    static qint64 readValue(int fd, const perf_event_attr &attr);
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,170 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtTest module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qjsonbenchmarklogger_p.h"
+#include "qtestresult_p.h"
+#include "qbenchmark_p.h"
+
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qmap.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Collects all benchmark results of a test run and writes them out as a
+    single JSON document when logging stops, so that tools can compare a
+    run against a stored baseline:
+
+    { "testCase": "tst_Foo",
+      "benchmarks": [ { "function": ..., "tag": ..., "metric": ...,
+                        "value": ..., "total": ..., "iterations": ...,
+                        "samples": ..., "outliers": ..., "minimum": ...,
+                        "median": ..., "p95": ..., "mean": ...,
+                        "stddev": ..., "ci95": ... }, ... ] }
+
+    When the measurer samples several counters at once (-perfcounter with a
+    comma-separated list), each entry also has a "counters" array and the
+    derived ratios that can be computed from them, such as
+    "instructionsPerCycle".
+
+    All values except total are per iteration. Normal pass/fail output is
+    suppressed, as for the CSV logger.
+*/
+QJsonBenchmarkLogger::QJsonBenchmarkLogger(const char *filename)
+    : QAbstractTestLogger(filename)
+{
+}
+
+QJsonBenchmarkLogger::~QJsonBenchmarkLogger() = default;
+
+void QJsonBenchmarkLogger::startLogging()
+{
+    results = QJsonArray();
+}
+
+void QJsonBenchmarkLogger::stopLogging()
+{
+    QJsonObject document;
+    document.insert(QLatin1String("testCase"),
+                    QString::fromUtf8(QTestResult::currentTestObjectName()));
+    document.insert(QLatin1String("benchmarks"), results);
+    outputString(QJsonDocument(document).toJson().constData());
+}
+
+void QJsonBenchmarkLogger::enterTestFunction(const char *)
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::leaveTestFunction()
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::addIncident(QAbstractTestLogger::IncidentTypes, const char *, const char *, int)
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::addBenchmarkResult(const QBenchmarkResult &result)
+{
+    const char *fn = QTestResult::currentTestFunction() ? QTestResult::currentTestFunction()
+        : "UnknownTestFunc";
+    const char *tag = QTestResult::currentDataTag() ? QTestResult::currentDataTag() : "";
+    const char *gtag = QTestResult::currentGlobalDataTag()
+                     ? QTestResult::currentGlobalDataTag()
+                     : "";
+    const char *filler = (tag[0] && gtag[0]) ? ":" : "";
+    const QBenchmarkStatistics &stats = result.statistics;
+
+    QJsonObject entry;
+    entry.insert(QLatin1String("function"), QString::fromUtf8(fn));
+    entry.insert(QLatin1String("tag"), QString(QString::fromUtf8(gtag) + QLatin1String(filler)
+                                               + QString::fromUtf8(tag)));
+    entry.insert(QLatin1String("metric"),
+                 QString::fromLatin1(QTest::benchmarkMetricName(result.metric)));
+    entry.insert(QLatin1String("value"), result.value / result.iterations);
+    entry.insert(QLatin1String("total"), result.value);
+    entry.insert(QLatin1String("iterations"), result.iterations);
+    entry.insert(QLatin1String("samples"), stats.sampleCount);
+    entry.insert(QLatin1String("outliers"), stats.outlierCount);
+    entry.insert(QLatin1String("minimum"), stats.minimum);
+    entry.insert(QLatin1String("median"), stats.median);
+    entry.insert(QLatin1String("p95"), stats.percentile95);
+    entry.insert(QLatin1String("mean"), stats.mean);
+    entry.insert(QLatin1String("stddev"), stats.standardDeviation);
+    entry.insert(QLatin1String("ci95"), stats.confidenceInterval95);
+
+    if (!result.secondaryMeasurements.isEmpty()) {
+        // Per-iteration values of all counters, including the primary one
+        QMap<QTest::QBenchmarkMetric, qreal> values;
+        values.insert(result.metric, result.value / result.iterations);
+        QJsonArray counters;
+        for (const QBenchmarkMeasurerBase::Measurement &m : result.secondaryMeasurements) {
+            QJsonObject counter;
+            counter.insert(QLatin1String("metric"),
+                           QString::fromLatin1(QTest::benchmarkMetricName(m.metric)));
+            counter.insert(QLatin1String("value"), m.value / result.iterations);
+            counters.append(counter);
+            values.insert(m.metric, m.value / result.iterations);
+        }
+        entry.insert(QLatin1String("counters"), counters);
+
+        const auto ratio = [&](const char *key, QTest::QBenchmarkMetric numerator,
+                               QTest::QBenchmarkMetric denominator) {
+            const qreal d = values.value(denominator);
+            if (values.contains(numerator) && d != 0)
+                entry.insert(QLatin1String(key), values.value(numerator) / d);
+        };
+        ratio("instructionsPerCycle", QTest::Instructions, QTest::CPUCycles);
+        ratio("cacheMissRatio", QTest::CacheMisses, QTest::CacheReferences);
+        ratio("branchMissRatio", QTest::BranchMisses, QTest::BranchInstructions);
+    }
+
+    results.append(entry);
+}
+
+void QJsonBenchmarkLogger::addMessage(QAbstractTestLogger::MessageTypes, const QString &, const char *, int)
+{
+    // don't print anything
+}
+
+QT_END_NAMESPACE
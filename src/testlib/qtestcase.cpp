@@ -53,6 +53,9 @@
 #include <QtCore/qlist.h>
 #include <QtCore/qmetaobject.h>
 #include <QtCore/qobject.h>
+#if QT_CONFIG(process)
+#include <QtCore/qprocess.h>
+#endif
 #include <QtCore/qstringlist.h>
 #include <QtCore/qtemporarydir.h>
 #include <QtCore/qthread.h>
@@ -71,6 +74,7 @@
 #include <QtTest/private/qbenchmark_p.h>
 #include <QtTest/private/cycle_p.h>
 #include <QtTest/private/qtestblacklist_p.h>
+#include <QtTest/private/qtestworkerlogger_p.h>
 #if defined(HAVE_XCTEST)
 #include <QtTest/private/qxctestlogger_p.h>
 #endif
@@ -87,6 +91,7 @@
 #include <algorithm>
 #include <condition_variable>
 #include <mutex>
+#include <memory>
 #include <chrono>
 
 #include <stdarg.h>
@@ -419,6 +424,8 @@ static std::chrono::milliseconds defaultTimeout()
 Q_TESTLIB_EXPORT bool printAvailableFunctions = false;
 Q_TESTLIB_EXPORT QStringList testFunctions;
 Q_TESTLIB_EXPORT QStringList testTags;
+static int jobCount = 1;
+static QStringList workerArguments; // options to pass on to -jobs workers
 
 static void qPrintTestSlots(FILE *stream, const char *filter = nullptr)
 {
@@ -517,6 +524,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
 
     QTest::testFunctions.clear();
     QTest::testTags.clear();
+    QTest::workerArguments.clear();
 
 #if defined(Q_OS_MAC) && defined(HAVE_XCTEST)
     if (QXcodeTestLogger::canLogTestProgress())
@@ -530,6 +538,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
          "                       Valid formats are:\n"
          "                         txt      : Plain text\n"
          "                         csv      : CSV format (suitable for benchmarks)\n"
+         "                         json     : JSON document (suitable for benchmarks)\n"
          "                         junitxml : XML JUnit document\n"
          "                         xml      : XML document\n"
          "                         lightxml : A stream of XML tags\n"
@@ -542,6 +551,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
          " -o filename         : Write the output into file\n"
          " -txt                : Output results in Plain Text\n"
          " -csv                : Output results in a CSV format (suitable for benchmarks)\n"
+         " -json               : Output results as a JSON document (suitable for benchmarks)\n"
          " -junitxml           : Output results as XML JUnit document\n"
          " -xml                : Output results as XML document\n"
          " -lightxml           : Output results as stream of XML tags\n"
@@ -569,6 +579,9 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
          " -maxwarnings n      : Sets the maximum amount of messages to output.\n"
          "                       0 means unlimited, default: 2000\n"
          " -nocrashhandler     : Disables the crash handler. Useful for debugging crashes.\n"
+#if QT_CONFIG(process)
+         " -jobs n             : Runs the test functions in n worker processes\n"
+#endif
          "\n"
          " Benchmarking options:\n"
 #if QT_CONFIG(valgrind)
@@ -576,20 +589,27 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
 #endif
 #ifdef QTESTLIB_USE_PERF_EVENTS
          " -perf               : Use Linux perf events to time benchmarks\n"
-         " -perfcounter name   : Use the counter named 'name'\n"
+         " -perfcounter name   : Use the counter named 'name'. Separate several names\n"
+         "                       with commas to measure them together\n"
          " -perfcounterlist    : Lists the counters available\n"
 #endif
 #ifdef HAVE_TICK_COUNTER
          " -tickcounter        : Use CPU tick counters to time benchmarks\n"
 #endif
          " -eventcounter       : Counts events received during benchmarks\n"
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+         " -allocationcounter  : Counts heap allocations made during benchmarks\n"
+#endif
          " -minimumvalue n     : Sets the minimum acceptable measurement value\n"
          " -minimumtotal n     : Sets the minimum acceptable total for repeated executions of a test function\n"
          " -iterations  n      : Sets the number of accumulation iterations.\n"
          " -median  n          : Sets the number of median iterations.\n"
+         " -warmup  n          : Sets the number of warmup iterations, which are discarded.\n"
          " -vb                 : Print out verbose benchmarking information.\n";
 
     for (int i = 1; i < argc; ++i) {
+        const int optionStart = i;
+        bool passToWorkers = true; // false for options that the -jobs parent handles
         if (strcmp(argv[i], "-help") == 0 || strcmp(argv[i], "--help") == 0
             || strcmp(argv[i], "/?") == 0) {
             printf(" Usage: %s [options] [testfunction[:testdata]]...\n"
@@ -624,18 +644,28 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
             }
         } else if (strcmp(argv[i], "-txt") == 0) {
             logFormat = QTestLog::Plain;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-csv") == 0) {
             logFormat = QTestLog::CSV;
+            passToWorkers = false;
+        } else if (strcmp(argv[i], "-json") == 0) {
+            logFormat = QTestLog::JSON;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-junitxml") == 0 || strcmp(argv[i], "-xunitxml") == 0)  {
             logFormat = QTestLog::JUnitXML;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-xml") == 0) {
             logFormat = QTestLog::XML;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-lightxml") == 0) {
             logFormat = QTestLog::LightXML;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-teamcity") == 0) {
             logFormat = QTestLog::TeamCity;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-tap") == 0) {
             logFormat = QTestLog::TAP;
+            passToWorkers = false;
         } else if (strcmp(argv[i], "-silent") == 0) {
             QTestLog::setVerboseLevel(-1);
         } else if (strcmp(argv[i], "-v1") == 0) {
@@ -650,6 +680,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                 exit(1);
             }
             ++i;
+            passToWorkers = false;
             // Do we have the old or new style -o option?
             char *filename = new char[strlen(argv[i])+1];
             char *format = new char[strlen(argv[i])+1];
@@ -662,6 +693,8 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                     logFormat = QTestLog::Plain;
                 else if (strcmp(format, "csv") == 0)
                     logFormat = QTestLog::CSV;
+                else if (strcmp(format, "json") == 0)
+                    logFormat = QTestLog::JSON;
                 else if (strcmp(format, "lightxml") == 0)
                     logFormat = QTestLog::LightXML;
                 else if (strcmp(format, "xml") == 0)
@@ -673,7 +706,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                 else if (strcmp(format, "tap") == 0)
                     logFormat = QTestLog::TAP;
                 else {
-                    fprintf(stderr, "output format must be one of txt, csv, lightxml, xml, tap, teamcity or junitxml\n");
+                    fprintf(stderr, "output format must be one of txt, csv, json, lightxml, xml, tap, teamcity or junitxml\n");
                     exit(1);
                 }
                 if (strcmp(filename, "-") == 0 && QTestLog::loggerUsingStdout()) {
@@ -714,6 +747,23 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
             }
         } else if (strcmp(argv[i], "-nocrashhandler") == 0) {
             QTest::noCrashHandler = true;
+#if QT_CONFIG(process)
+        } else if (strcmp(argv[i], "-jobs") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "-jobs needs an extra parameter with the number of worker processes\n");
+                exit(1);
+            }
+            QTest::jobCount = qMax(1, qToInt(argv[++i]));
+            passToWorkers = false;
+        } else if (strcmp(argv[i], "-jobworker") == 0) { // "private" option
+            if (i + 1 >= argc) {
+                fprintf(stderr, "-jobworker needs an extra parameter with the log file name\n");
+                exit(1);
+            }
+            logFormat = QTestLog::Worker;
+            logFilename = argv[++i];
+            passToWorkers = false;
+#endif
 #if QT_CONFIG(valgrind)
         } else if (strcmp(argv[i], "-callgrind") == 0) {
             if (QBenchmarkValgrindUtils::haveValgrind())
@@ -756,6 +806,15 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
 #endif
         } else if (strcmp(argv[i], "-eventcounter") == 0) {
             QBenchmarkGlobalData::current->setMode(QBenchmarkGlobalData::EventCounter);
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+        } else if (strcmp(argv[i], "-allocationcounter") == 0) {
+            if (!QBenchmarkAllocationCounter::hooksRegistered()) {
+                fprintf(stderr, "-allocationcounter needs the allocation hooks, which this test "
+                                "does not include\n");
+                exit(1);
+            }
+            QBenchmarkGlobalData::current->setMode(QBenchmarkGlobalData::AllocationCounter);
+#endif
         } else if (strcmp(argv[i], "-minimumvalue") == 0) {
             if (i + 1 >= argc) {
                 fprintf(stderr, "-minimumvalue needs an extra parameter to indicate the minimum time(ms)\n");
@@ -784,6 +843,13 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
             } else {
                 QBenchmarkGlobalData::current->medianIterationCount = qToInt(argv[++i]);
             }
+        } else if (strcmp(argv[i], "-warmup") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "-warmup needs an extra parameter to indicate the number of warmup iterations\n");
+                exit(1);
+            } else {
+                QBenchmarkGlobalData::current->warmupIterationCount = qToInt(argv[++i]);
+            }
 
         } else if (strcmp(argv[i], "-vb") == 0) {
             QBenchmarkGlobalData::current->verboseOutput = true;
@@ -806,6 +872,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                             " -help      : This help\n");
             exit(1);
         } else {
+            passToWorkers = false;
             // We can't check the availability of test functions until
             // we load the QML files.  So just store the data for now.
             int colon = -1;
@@ -832,6 +899,11 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                     QString::fromLatin1(argv[i] + colon + 1);
             }
         }
+
+        if (passToWorkers) {
+            for (int j = optionStart; j <= i; ++j)
+                QTest::workerArguments += QString::fromLocal8Bit(argv[j]);
+        }
     }
 
     bool installedTestCoverage = installCoverageTool(QTestResult::currentAppName(), QTestResult::currentTestObjectName());
@@ -908,7 +980,7 @@ void TestMethods::invokeTestOnData(int index) const
     /* Benchmarking: for each median iteration*/
 
     bool isBenchmark = false;
-    int i = (QBenchmarkGlobalData::current->measurer->needsWarmupIteration()) ? -1 : 0;
+    int i = -QBenchmarkGlobalData::current->adjustWarmupIterationCount();
 
     QList<QBenchmarkResult> results;
     bool minimumTotalReached = false;
@@ -960,11 +1032,11 @@ void TestMethods::invokeTestOnData(int index) const
 
         QBenchmarkTestMethodData::current->endDataRun();
         if (!QTestResult::skipCurrentTest() && !QTestResult::currentTestFailed()) {
-            if (i > -1)  // iteration -1 is the warmup iteration.
+            if (i >= 0)  // negative iterations are warmup iterations.
                 results.append(QBenchmarkTestMethodData::current->result);
 
             if (isBenchmark && QBenchmarkGlobalData::current->verboseOutput) {
-                if (i == -1) {
+                if (i < 0) {
                     QTestLog::info(qPrintable(
                         QString::fromLatin1("warmup stage result      : %1")
                             .arg(QBenchmarkTestMethodData::current->result.value)), nullptr, 0);
@@ -992,8 +1064,21 @@ void TestMethods::invokeTestOnData(int index) const
         bool testPassed = !QTestResult::skipCurrentTest() && !QTestResult::currentTestFailed();
         QTestResult::finishedCurrentTestDataCleanup();
         // Only report benchmark figures if the test passed
-        if (testPassed && QBenchmarkTestMethodData::current->resultsAccepted())
-            QTestLog::addBenchmarkResult(qMedian(results));
+        if (testPassed && QBenchmarkTestMethodData::current->resultsAccepted()) {
+            QBenchmarkResult result = qMedian(results);
+            result.statistics = QBenchmarkStatistics::compute(results);
+            if (QBenchmarkGlobalData::current->verboseOutput) {
+                const QBenchmarkStatistics &stats = result.statistics;
+                QTestLog::info(qPrintable(
+                    QString::fromLatin1("statistics: %1 samples (%2 outliers), min %3, median %4, "
+                                        "p95 %5, mean %6 +/- %7 (95%), stddev %8")
+                        .arg(stats.sampleCount).arg(stats.outlierCount)
+                        .arg(stats.minimum).arg(stats.median).arg(stats.percentile95)
+                        .arg(stats.mean).arg(stats.confidenceInterval95)
+                        .arg(stats.standardDeviation)), nullptr, 0);
+            }
+            QTestLog::addBenchmarkResult(result);
+        }
     }
 }
 
@@ -1884,6 +1969,96 @@ void QTest::qInit(QObject *testObject, int argc, char **argv)
     QTestLog::startLogging();
 }
 
+#if QT_CONFIG(process)
+static void reportJobFailure(const char *message)
+{
+    QTestResult::setCurrentTestFunction("initTestCase");
+    QTestLog::addFail(message, __FILE__, __LINE__);
+    QTestResult::finishedCurrentTestFunction();
+}
+
+// Runs the selected test functions in QTest::jobCount worker processes,
+// each taking a contiguous slice of them, and replays their logs to our
+// own loggers in the original order.
+static void runTestJobs()
+{
+    QStringList functions;
+    if (QTest::testFunctions.isEmpty()) {
+        const QMetaObject *metaObject = QTest::currentTestObject->metaObject();
+        for (int i = 0; i < metaObject->methodCount(); ++i) {
+            const QMetaMethod m = metaObject->method(i);
+            if (isValidSlot(m))
+                functions += QString::fromLatin1(m.name());
+        }
+    } else {
+        for (int i = 0; i < QTest::testFunctions.size(); ++i) {
+            const QString &tag = QTest::testTags.at(i);
+            functions += tag.isEmpty() ? QTest::testFunctions.at(i)
+                                       : QTest::testFunctions.at(i) + QLatin1Char(':') + tag;
+        }
+    }
+
+    QTemporaryDir logDir;
+    if (!logDir.isValid()) {
+        reportJobFailure("Could not create a directory for the worker logs");
+        return;
+    }
+
+    // QGuiApplication consumes -platform, so pass it on through the environment
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    const QString platformName = qApp ? qApp->property("platformName").toString() : QString();
+    if (!platformName.isEmpty())
+        environment.insert(QStringLiteral("QT_QPA_PLATFORM"), platformName);
+
+    const int jobs = qBound(1, QTest::jobCount, int(functions.size()));
+    std::vector<std::unique_ptr<QProcess>> workers;
+    std::vector<QByteArrayList> slices;
+    workers.reserve(jobs);
+    slices.reserve(jobs);
+    for (int job = 0; job < jobs; ++job) {
+        const int begin = int(functions.size()) * job / jobs;
+        const int end = int(functions.size()) * (job + 1) / jobs;
+        const QStringList slice = functions.mid(begin, end - begin);
+        QStringList args = QTest::workerArguments;
+        args << QStringLiteral("-jobworker") << logDir.filePath(QString::number(job)) << slice;
+
+        QByteArrayList sliceNames;
+        for (const QString &function : slice)
+            sliceNames += function.toLatin1();
+        slices.push_back(sliceNames);
+
+        auto worker = std::make_unique<QProcess>();
+        worker->setProcessChannelMode(QProcess::ForwardedChannels);
+        worker->setProcessEnvironment(environment);
+        worker->start(QString::fromLocal8Bit(QTestResult::currentAppName()), args);
+        workers.push_back(std::move(worker));
+    }
+
+    for (int job = 0; job < jobs; ++job) {
+        QProcess *worker = workers[job].get();
+        if (!worker->waitForStarted(-1)) {
+            reportJobFailure(qPrintable(QLatin1String("Could not start worker process: ")
+                                        + worker->errorString()));
+            continue;
+        }
+        worker->waitForFinished(-1);
+
+        QTestWorkerLogger::ReplayOptions options;
+        if (job > 0)
+            options |= QTestWorkerLogger::SkipPassingInitTestCase;
+        if (job < jobs - 1)
+            options |= QTestWorkerLogger::SkipPassingCleanupTestCase;
+
+        // A worker that was killed or exited before it stopped logging has
+        // the test function it was running reported as failed by replay().
+        // One that crashed afterwards, from qFatal(), has logged its failure.
+        QFile log(logDir.filePath(QString::number(job)));
+        const QByteArray records = log.open(QIODevice::ReadOnly) ? log.readAll() : QByteArray();
+        QTestWorkerLogger::replay(records, slices[job], options);
+    }
+}
+#endif // QT_CONFIG(process)
+
 /*! \internal
  */
 int QTest::qRun()
@@ -1910,6 +2085,11 @@ int QTest::qRun()
         QBenchmarkValgrindUtils::cleanup();
 
     } else
+#endif
+#if QT_CONFIG(process)
+    if (QTest::jobCount > 1) {
+        runTestJobs();
+    } else
 #endif
     {
         QScopedPointer<FatalSignalHandler> handler;
@@ -44,6 +44,8 @@
 #include <QtTest/private/qabstracttestlogger_p.h>
 #include <QtTest/private/qplaintestlogger_p.h>
 #include <QtTest/private/qcsvbenchmarklogger_p.h>
+#include <QtTest/private/qjsonbenchmarklogger_p.h>
+#include <QtTest/private/qtestworkerlogger_p.h>
 #include <QtTest/private/qjunittestlogger_p.h>
 #include <QtTest/private/qxmltestlogger_p.h>
 #include <QtTest/private/qteamcitylogger_p.h>
@@ -450,6 +452,12 @@ void QTestLog::addLogger(LogMode mode, const char *filename)
     case QTestLog::CSV:
         logger = new QCsvBenchmarkLogger(filename);
         break;
+    case QTestLog::JSON:
+        logger = new QJsonBenchmarkLogger(filename);
+        break;
+    case QTestLog::Worker:
+        logger = new QTestWorkerLogger(filename);
+        break;
     case QTestLog::XML:
         logger = new QXmlTestLogger(QXmlTestLogger::Complete, filename);
         break;
@@ -507,6 +515,13 @@ void QTestLog::info(const char *msg, const char *file, int line)
         logger->addMessage(QAbstractTestLogger::Info, QString::fromUtf8(msg), file, line);
 }
 
+void QTestLog::addMessage(QAbstractTestLogger::MessageTypes type, const QString &message,
+                          const char *file, int line)
+{
+    FOREACH_TEST_LOGGER
+        logger->addMessage(type, message, file, line);
+}
+
 void QTestLog::setVerboseLevel(int level)
 {
     QTest::verbosity = level;
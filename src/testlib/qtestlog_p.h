@@ -52,6 +52,7 @@
 //
 
 #include <QtTest/qttestglobal.h>
+#include <QtTest/private/qabstracttestlogger_p.h>
 
 #if defined(Q_OS_DARWIN)
 #include <QtCore/private/qcore_mac_p.h>
@@ -74,7 +75,7 @@ public:
     Q_DISABLE_COPY_MOVE(QTestLog)
 
     enum LogMode {
-        Plain = 0, XML, LightXML, JUnitXML, CSV, TeamCity, TAP
+        Plain = 0, XML, LightXML, JUnitXML, CSV, TeamCity, TAP, JSON, Worker
 #if defined(QT_USE_APPLE_UNIFIED_LOGGING)
         , Apple
 #endif
@@ -110,6 +111,8 @@ public:
 
     static void warn(const char *msg, const char *file, int line);
     static void info(const char *msg, const char *file, int line);
+    static void addMessage(QAbstractTestLogger::MessageTypes type, const QString &message,
+                           const char *file, int line);
 
     static void startLogging();
     static void stopLogging();
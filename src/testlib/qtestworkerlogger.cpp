@@ -0,0 +1,368 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtTest module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/private/qtestworkerlogger_p.h>
+#include <QtTest/private/qbenchmark_p.h>
+#include <QtTest/private/qtestlog_p.h>
+#include <QtTest/private/qtestresult_p.h>
+#include <QtTest/private/qtesttable_p.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Each record is one line of tab-separated, percent-encoded fields:
+
+    F function                          entering a test function
+    L                                   leaving it
+    I type gtag tag file line text      incident
+    M type gtag tag file line text      message
+    B gtag tag metric value iterations setByMacro slot ctxtag checkpoint
+      <8 statistics> [value metric]...  benchmark result
+    E                                   logging stopped normally
+
+    Strings that may be null (tags and file names) are written empty when
+    null and prefixed with '=' otherwise.
+*/
+
+static QByteArray optional(const char *s)
+{
+    return s ? '=' + QByteArray(s) : QByteArray();
+}
+
+static QByteArray number(qreal value)
+{
+    return QByteArray::number(value, 'g', 17);
+}
+
+QTestWorkerLogger::QTestWorkerLogger(const char *filename)
+    : QAbstractTestLogger(filename)
+{
+}
+
+QTestWorkerLogger::~QTestWorkerLogger() = default;
+
+void QTestWorkerLogger::writeRecord(std::initializer_list<QByteArray> fields)
+{
+    QByteArray record;
+    for (const QByteArray &field : fields) {
+        if (!record.isEmpty())
+            record += '\t';
+        record += field.toPercentEncoding();
+    }
+    record += '\n';
+    outputString(record.constData());
+}
+
+void QTestWorkerLogger::stopLogging()
+{
+    writeRecord({ "E" });
+}
+
+void QTestWorkerLogger::enterTestFunction(const char *function)
+{
+    writeRecord({ "F", function });
+}
+
+void QTestWorkerLogger::leaveTestFunction()
+{
+    writeRecord({ "L" });
+}
+
+void QTestWorkerLogger::addIncident(IncidentTypes type, const char *description,
+                                    const char *file, int line)
+{
+    writeRecord({ "I", QByteArray::number(int(type)),
+                  optional(QTestResult::currentGlobalDataTag()),
+                  optional(QTestResult::currentDataTag()),
+                  optional(file), QByteArray::number(line), description });
+}
+
+void QTestWorkerLogger::addMessage(MessageTypes type, const QString &message,
+                                   const char *file, int line)
+{
+    writeRecord({ "M", QByteArray::number(int(type)),
+                  optional(QTestResult::currentGlobalDataTag()),
+                  optional(QTestResult::currentDataTag()),
+                  optional(file), QByteArray::number(line), message.toUtf8() });
+}
+
+void QTestWorkerLogger::addBenchmarkResult(const QBenchmarkResult &result)
+{
+    const QBenchmarkStatistics &stats = result.statistics;
+    QByteArray record = "B";
+    for (const QByteArray &field : {
+             optional(QTestResult::currentGlobalDataTag()),
+             optional(QTestResult::currentDataTag()),
+             QByteArray::number(int(result.metric)), number(result.value),
+             QByteArray::number(result.iterations), QByteArray::number(result.setByMacro),
+             result.context.slotName.toUtf8(), result.context.tag.toUtf8(),
+             QByteArray::number(result.context.checkpointIndex),
+             QByteArray::number(stats.sampleCount), QByteArray::number(stats.outlierCount),
+             number(stats.minimum), number(stats.median), number(stats.percentile95),
+             number(stats.mean), number(stats.standardDeviation),
+             number(stats.confidenceInterval95) }) {
+        record += '\t' + field.toPercentEncoding();
+    }
+    for (const QBenchmarkMeasurerBase::Measurement &m : result.secondaryMeasurements)
+        record += '\t' + number(m.value) + '\t' + QByteArray::number(int(m.metric));
+    record += '\n';
+    outputString(record.constData());
+}
+
+namespace {
+
+class Replayer
+{
+public:
+    explicit Replayer(QTestWorkerLogger::ReplayOptions options) : options(options) {}
+    ~Replayer()
+    {
+        QTestResult::setCurrentGlobalTestData(nullptr);
+        QTestResult::setCurrentTestData(nullptr);
+    }
+
+    void flushFunction(bool interrupted);
+    void replayRecord(const QList<QByteArray> &fields);
+
+    QTestWorkerLogger::ReplayOptions options;
+    QByteArray function;
+    QList<QList<QByteArray>> records;
+
+private:
+    void setDataTags(const QByteArray &globalTag, const QByteArray &tag);
+    QTestData *dataForTag(const QByteArray &field);
+
+    QTestTable table; // owns the QTestData objects carrying the data tags
+    QHash<QByteArray, QTestData *> tags;
+};
+
+QTestData *Replayer::dataForTag(const QByteArray &field)
+{
+    if (field.isEmpty())
+        return nullptr;
+    QTestData *&data = tags[field];
+    if (!data)
+        data = table.newData(field.constData() + 1);
+    return data;
+}
+
+void Replayer::setDataTags(const QByteArray &globalTag, const QByteArray &tag)
+{
+    QTestData *globalData = dataForTag(globalTag);
+    if (globalData != QTestResult::currentGlobalTestData())
+        QTestResult::setCurrentGlobalTestData(globalData);
+    QTestData *data = dataForTag(tag);
+    if (data != QTestResult::currentTestData())
+        QTestResult::setCurrentTestData(data);
+}
+
+static const char *optionalString(const QByteArray &field)
+{
+    return field.isEmpty() ? nullptr : field.constData() + 1;
+}
+
+void Replayer::replayRecord(const QList<QByteArray> &fields)
+{
+    const QByteArray &kind = fields.at(0);
+    if ((kind == "I" || kind == "M") && fields.size() >= 7) {
+        setDataTags(fields.at(2), fields.at(3));
+        const char *file = optionalString(fields.at(4));
+        const int line = fields.at(5).toInt();
+        const char *text = fields.at(6).constData();
+        if (kind == "I") {
+            switch (QAbstractTestLogger::IncidentTypes(fields.at(1).toInt())) {
+            case QAbstractTestLogger::Pass:
+                QTestLog::addPass(text);
+                break;
+            case QAbstractTestLogger::XFail:
+                QTestLog::addXFail(text, file ? file : "", line);
+                break;
+            case QAbstractTestLogger::Fail:
+                QTestLog::addFail(text, file, line);
+                break;
+            case QAbstractTestLogger::XPass:
+                QTestLog::addXPass(text, file ? file : "", line);
+                break;
+            case QAbstractTestLogger::BlacklistedPass:
+                QTestLog::addBPass(text);
+                break;
+            case QAbstractTestLogger::BlacklistedFail:
+                QTestLog::addBFail(text, file ? file : "", line);
+                break;
+            case QAbstractTestLogger::BlacklistedXPass:
+                QTestLog::addBXPass(text, file ? file : "", line);
+                break;
+            case QAbstractTestLogger::BlacklistedXFail:
+                QTestLog::addBXFail(text, file ? file : "", line);
+                break;
+            }
+        } else {
+            const auto type = QAbstractTestLogger::MessageTypes(fields.at(1).toInt());
+            if (type == QAbstractTestLogger::Skip)
+                QTestLog::addSkip(text, file ? file : "", line);
+            else
+                QTestLog::addMessage(type, QString::fromUtf8(fields.at(6)), file, line);
+        }
+    } else if (kind == "B" && fields.size() >= 18) {
+        setDataTags(fields.at(1), fields.at(2));
+        QBenchmarkContext context;
+        context.slotName = QString::fromUtf8(fields.at(7));
+        context.tag = QString::fromUtf8(fields.at(8));
+        context.checkpointIndex = fields.at(9).toInt();
+        QBenchmarkResult result(context, fields.at(4).toDouble(), fields.at(5).toInt(),
+                                QTest::QBenchmarkMetric(fields.at(3).toInt()),
+                                fields.at(6).toInt() != 0);
+        QBenchmarkStatistics &stats = result.statistics;
+        stats.sampleCount = fields.at(10).toInt();
+        stats.outlierCount = fields.at(11).toInt();
+        stats.minimum = fields.at(12).toDouble();
+        stats.median = fields.at(13).toDouble();
+        stats.percentile95 = fields.at(14).toDouble();
+        stats.mean = fields.at(15).toDouble();
+        stats.standardDeviation = fields.at(16).toDouble();
+        stats.confidenceInterval95 = fields.at(17).toDouble();
+        for (qsizetype i = 18; i + 1 < fields.size(); i += 2) {
+            result.secondaryMeasurements.append(
+                    { fields.at(i).toDouble(), QTest::QBenchmarkMetric(fields.at(i + 1).toInt()) });
+        }
+        QTestLog::addBenchmarkResult(result);
+    }
+}
+
+void Replayer::flushFunction(bool interrupted)
+{
+    if (function.isEmpty()) {
+        // Messages logged outside of any test function
+        for (const QList<QByteArray> &fields : qAsConst(records))
+            replayRecord(fields);
+        records.clear();
+        return;
+    }
+
+    // Every worker runs initTestCase() and cleanupTestCase(); only show
+    // them once unless something interesting happened in them.
+    const bool skippable =
+            ((options & QTestWorkerLogger::SkipPassingInitTestCase) && function == "initTestCase")
+            || ((options & QTestWorkerLogger::SkipPassingCleanupTestCase) && function == "cleanupTestCase");
+    const bool onlyPasses = std::all_of(records.cbegin(), records.cend(),
+                                        [](const QList<QByteArray> &fields) {
+        return fields.size() >= 2 && fields.at(0) == "I"
+                && fields.at(1).toInt() == QAbstractTestLogger::Pass;
+    });
+
+    if (interrupted || !skippable || !onlyPasses) {
+        QTestResult::setCurrentTestFunction(function.constData());
+        for (const QList<QByteArray> &fields : qAsConst(records))
+            replayRecord(fields);
+        if (interrupted)
+            QTestLog::addFail("Worker process exited unexpectedly", "", 0);
+        QTestResult::finishedCurrentTestFunction();
+        QTestResult::setCurrentGlobalTestData(nullptr);
+        QTestResult::setCurrentTestData(nullptr);
+    }
+    function.clear();
+    records.clear();
+}
+
+} // unnamed namespace
+
+/*
+    Replays the records in \a log, written by a worker process that was told
+    to run \a functions, to the loggers of this process. Returns \c false if
+    the worker did not stop logging normally. The test function it was
+    running is then reported as failed: the one it was in the middle of, or
+    if it died between two of them (or before logging anything), the one it
+    would have entered next.
+*/
+bool QTestWorkerLogger::replay(const QByteArray &log, const QByteArrayList &functions,
+                               ReplayOptions options)
+{
+    Replayer replayer(options);
+    bool finished = false;
+    int enteredFunctions = 0;
+    QByteArray lastFunction;
+
+    const QList<QByteArray> lines = log.split('\n');
+    for (const QByteArray &line : lines) {
+        if (line.isEmpty())
+            continue;
+        QList<QByteArray> fields = line.split('\t');
+        for (QByteArray &field : fields)
+            field = QByteArray::fromPercentEncoding(field);
+
+        const QByteArray &kind = fields.at(0);
+        if (kind == "F") {
+            replayer.flushFunction(false);
+            replayer.function = fields.value(1);
+            lastFunction = replayer.function;
+            ++enteredFunctions;
+        } else if (kind == "L") {
+            replayer.flushFunction(false);
+        } else if (kind == "E") {
+            finished = true;
+        } else {
+            replayer.records.append(fields);
+            if (replayer.function.isEmpty())
+                replayer.flushFunction(false);
+        }
+    }
+
+    if (replayer.function.isEmpty() && !finished) {
+        // Workers enter initTestCase(), their functions and cleanupTestCase()
+        // in this order, each exactly once; a failing initTestCase() skips
+        // straight to cleanupTestCase()
+        if (enteredFunctions == 0) {
+            replayer.function = "initTestCase";
+        } else if (enteredFunctions <= functions.size() && lastFunction != "cleanupTestCase") {
+            const QByteArray &next = functions.at(enteredFunctions - 1);
+            const int colon = next.indexOf(':');
+            replayer.function = colon < 0 ? next : next.left(colon);
+        } else {
+            replayer.function = "cleanupTestCase";
+        }
+    }
+    replayer.flushFunction(!replayer.function.isEmpty());
+    return finished;
+}
+
+QT_END_NAMESPACE
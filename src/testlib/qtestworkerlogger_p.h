@@ -0,0 +1,104 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtTest module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QTESTWORKERLOGGER_P_H
+#define QTESTWORKERLOGGER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qabstracttestlogger_p.h"
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearraylist.h>
+#include <QtCore/qflags.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Used by the worker processes started for -jobs. It records every call
+    made to the loggers in a line-based format, which the parent process
+    feeds to its own loggers with replay(), so that the output of all
+    workers looks as if the tests had run in one process.
+*/
+class QTestWorkerLogger : public QAbstractTestLogger
+{
+public:
+    QTestWorkerLogger(const char *filename);
+    ~QTestWorkerLogger();
+
+    void stopLogging() override;
+
+    void enterTestFunction(const char *function) override;
+    void leaveTestFunction() override;
+
+    void addIncident(IncidentTypes type, const char *description,
+                     const char *file = nullptr, int line = 0) override;
+    void addBenchmarkResult(const QBenchmarkResult &result) override;
+
+    void addMessage(MessageTypes type, const QString &message,
+                    const char *file = nullptr, int line = 0) override;
+
+    enum ReplayOption {
+        SkipPassingInitTestCase = 0x1,
+        SkipPassingCleanupTestCase = 0x2
+    };
+    Q_DECLARE_FLAGS(ReplayOptions, ReplayOption)
+
+    static bool replay(const QByteArray &log, const QByteArrayList &functions,
+                       ReplayOptions options);
+
+private:
+    void writeRecord(std::initializer_list<QByteArray> fields);
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QTestWorkerLogger::ReplayOptions)
+
+QT_END_NAMESPACE
+
+#endif // QTESTWORKERLOGGER_P_H
@@ -15,6 +15,8 @@ HEADERS = \
     qabstracttestlogger_p.h \
     qbenchmark.h \
     qbenchmark_p.h \
+    qbenchmarkallocationhooks_p.h \
+    qbenchmarkallocations_p.h \
     qbenchmarkmeasurement_p.h \
     qbenchmarktimemeasurers_p.h \
     qbenchmarkevent_p.h \
@@ -22,6 +24,7 @@ HEADERS = \
     qbenchmarkmetric.h \
     qbenchmarkmetric_p.h \
     qcsvbenchmarklogger_p.h \
+    qjsonbenchmarklogger_p.h \
     qplaintestlogger_p.h \
     qsignaldumper_p.h \
     qsignalspy.h \
@@ -54,7 +57,8 @@ HEADERS = \
     qtestjunitstreamer_p.h \
     qtaptestlogger_p.h \
     qxmltestlogger_p.h \
-    qjunittestlogger_p.h
+    qjunittestlogger_p.h \
+    qtestworkerlogger_p.h
 
 SOURCES = \
     qtestcase.cpp \
@@ -68,11 +72,13 @@ SOURCES = \
     qsignaldumper.cpp \
     qabstracttestlogger.cpp \
     qbenchmark.cpp \
+    qbenchmarkallocations.cpp \
     qbenchmarkmeasurement.cpp \
     qbenchmarkevent.cpp \
     qbenchmarkperfevents.cpp \
     qbenchmarkmetric.cpp \
     qcsvbenchmarklogger.cpp \
+    qjsonbenchmarklogger.cpp \
     qteamcitylogger.cpp \
     qtestelement.cpp \
     qtestelementattribute.cpp \
@@ -80,7 +86,8 @@ SOURCES = \
     qtestjunitstreamer.cpp \
     qjunittestlogger.cpp \
     qtestblacklist.cpp \
-    qtaptestlogger.cpp
+    qtaptestlogger.cpp \
+    qtestworkerlogger.cpp
 
 qtConfig(itemmodeltester) {
     HEADERS += \
@@ -157,7 +157,7 @@ bool Generator::registerableMetaType(const QByteArray &propertyType)
             return true;
     }
 
-    static const QList<QByteArray> smartPointers = QList<QByteArray>()
+    static thread_local const QList<QByteArray> smartPointers = QList<QByteArray>()
 #define STREAM_SMART_POINTER(SMART_POINTER) << #SMART_POINTER
             QT_FOR_EACH_AUTOMATIC_TEMPLATE_SMART_POINTER(STREAM_SMART_POINTER)
 #undef STREAM_SMART_POINTER
@@ -169,7 +169,7 @@ bool Generator::registerableMetaType(const QByteArray &propertyType)
             return knownQObjectClasses.contains(propertyType.mid(smartPointer.size() + 1, propertyType.size() - smartPointer.size() - 1 - 1));
     }
 
-    static const QList<QByteArray> oneArgTemplates = QList<QByteArray>()
+    static thread_local const QList<QByteArray> oneArgTemplates = QList<QByteArray>()
 #define STREAM_1ARG_TEMPLATE(TEMPLATENAME) << #TEMPLATENAME
             QT_FOR_EACH_AUTOMATIC_TEMPLATE_1ARG(STREAM_1ARG_TEMPLATE)
 #undef STREAM_1ARG_TEMPLATE
@@ -380,6 +380,8 @@ void Generator::generateCode()
         index += 5 + (cdef->enumList.at(i).values.count() * 2);
     fprintf(out, "    %4d, %4d, // constructors\n", isConstructible ? int(cdef->constructorList.count()) : 0,
             isConstructible ? index : 0);
+    if (isConstructible)
+        index += cdef->constructorList.count() * QMetaObjectPrivate::IntsPerMethod;
 
     int flags = 0;
     if (cdef->hasQGadget || cdef->hasQNamespace) {
@@ -389,6 +391,8 @@ void Generator::generateCode()
     }
     fprintf(out, "    %4d,       // flags\n", flags);
     fprintf(out, "    %4d,       // signalCount\n", int(cdef->signalList.count()));
+    const int methodHashSize = QMetaObjectPrivate::methodHashBuckets(methodCount);
+    fprintf(out, "    %4d, %4d, // method hash\n", methodHashSize, methodHashSize ? index : 0);
 
 
 //
@@ -447,6 +451,11 @@ void Generator::generateCode()
     if (isConstructible)
         generateFunctions(cdef->constructorList, "constructor", MethodConstructor, paramsIndex, initialMetaTypeOffset);
 
+//
+// Build method hash table
+//
+    generateMethodHashTable();
+
 //
 // Terminate data array
 //
@@ -802,6 +811,31 @@ void Generator::generateFunctionRevisions(const QList<FunctionDef> &list, const
     }
 }
 
+void Generator::generateMethodHashTable()
+{
+    const int methodCount = cdef->signalList.count() + cdef->slotList.count() + cdef->methodList.count();
+    if (!methodCount)
+        return;
+    const auto nameAt = [this](int i) -> const QByteArray & {
+        if (i < cdef->signalList.count())
+            return cdef->signalList.at(i).name;
+        i -= cdef->signalList.count();
+        if (i < cdef->slotList.count())
+            return cdef->slotList.at(i).name;
+        return cdef->methodList.at(i - cdef->slotList.count()).name;
+    };
+    QList<int> table(QMetaObjectPrivate::methodHashTableSize(methodCount));
+    QMetaObjectPrivate::fillMethodHashTable(table.data(), methodCount, nameAt);
+
+    const int buckets = QMetaObjectPrivate::methodHashBuckets(methodCount);
+    fprintf(out, "\n // method hash: bucket offsets\n");
+    for (int i = 0; i <= buckets; ++i)
+        fprintf(out, "    %4d,\n", table.at(i));
+    fprintf(out, "\n // method hash: method indexes\n");
+    for (int i = 0; i < methodCount; ++i)
+        fprintf(out, "    %4d,\n", table.at(buckets + 1 + i));
+}
+
 void Generator::generateFunctionParameters(const QList<FunctionDef> &list, const char *functype)
 {
     if (list.isEmpty())
@@ -55,6 +55,7 @@ private:
                            int &paramsIndex, int &initialMetatypeOffset);
     void generateFunctionRevisions(const QList<FunctionDef> &list, const char *functype);
     void generateFunctionParameters(const QList<FunctionDef> &list, const char *functype);
+    void generateMethodHashTable();
     void generateTypeInfo(const QByteArray &typeName, bool allowEmptyName = false);
     void registerEnumStrings();
     void generateEnums(int index);
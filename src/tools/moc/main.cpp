@@ -31,6 +31,7 @@
 #include "moc.h"
 #include "outputrevision.h"
 #include "collectjson.h"
+#include "tokencache.h"
 
 #include <qfile.h>
 #include <qfileinfo.h>
@@ -45,6 +46,10 @@
 #include <qcommandlineparser.h>
 #include <qscopedpointer.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 /*
@@ -219,11 +224,11 @@ QByteArray escapeAndEncodeDependencyPath(const QString &path)
     return QFile::encodeName(escapeDependencyPath(path));
 }
 
-int runMoc(int argc, char **argv)
-{
-    QCoreApplication app(argc, argv);
-    QCoreApplication::setApplicationVersion(QString::fromLatin1(QT_VERSION_STR));
+static int runMocBatch(const QStringList &arguments, const QString &batchFile, int jobs,
+                       const QString &tokenCacheDirectory);
 
+static int runMocJob(const QStringList &rawArguments, TokenCache *batchTokenCache)
+{
     bool autoInclude = true;
     bool defaultInclude = true;
     Preprocessor pp;
@@ -371,6 +376,22 @@ int runMoc(int argc, char **argv)
     requireCompleTypesOption.setDescription(QStringLiteral("Require complete types for better performance"));
     parser.addOption(requireCompleTypesOption);
 
+    QCommandLineOption tokenCacheOption(QStringLiteral("token-cache"));
+    tokenCacheOption.setDescription(QStringLiteral("Keep the tokenized headers in dir, to reuse them in later runs."));
+    tokenCacheOption.setValueName(QStringLiteral("dir"));
+    parser.addOption(tokenCacheOption);
+
+    QCommandLineOption batchOption(QStringLiteral("batch"));
+    batchOption.setDescription(QStringLiteral("Run moc once for each line of file, which names an options file. "
+                                              "The other options apply to all runs."));
+    batchOption.setValueName(QStringLiteral("file"));
+    parser.addOption(batchOption);
+
+    QCommandLineOption jobsOption(QStringLiteral("jobs"));
+    jobsOption.setDescription(QStringLiteral("Number of files processed in parallel with --batch (default: number of cores)."));
+    jobsOption.setValueName(QStringLiteral("count"));
+    parser.addOption(jobsOption);
+
     parser.addPositionalArgument(QStringLiteral("[header-file]"),
             QStringLiteral("Header file to read from, otherwise stdin."));
     parser.addPositionalArgument(QStringLiteral("[@option-file]"),
@@ -378,12 +399,29 @@ int runMoc(int argc, char **argv)
     parser.addPositionalArgument(QStringLiteral("[MOC generated json file]"),
                                  QStringLiteral("MOC generated json output"));
 
-    const QStringList arguments = argumentsFromCommandLineAndFile(app.arguments());
+    const QStringList arguments = argumentsFromCommandLineAndFile(rawArguments);
     if (arguments.isEmpty())
         return 1;
 
     parser.process(arguments);
 
+    if (parser.isSet(batchOption)) {
+        if (batchTokenCache) {
+            error("--batch cannot be used in a batch job");
+            return 1;
+        }
+        int jobs = qMax(1, int(std::thread::hardware_concurrency()));
+        if (parser.isSet(jobsOption))
+            jobs = qMax(1, parser.value(jobsOption).toInt());
+        return runMocBatch(arguments, parser.value(batchOption), jobs,
+                           parser.value(tokenCacheOption));
+    }
+
+    QScopedPointer<TokenCache> ownTokenCache;
+    if (!batchTokenCache && parser.isSet(tokenCacheOption))
+        ownTokenCache.reset(new TokenCache(parser.value(tokenCacheOption)));
+    pp.tokenCache = batchTokenCache ? batchTokenCache : ownTokenCache.data();
+
     const QStringList files = parser.positionalArguments();
     output = parser.value(outputOption);
     if (parser.isSet(collectOption))
@@ -689,6 +727,97 @@ int runMoc(int argc, char **argv)
     return 0;
 }
 
+// Returns arguments without the --batch and --jobs options and their values.
+static QStringList batchJobBaseArguments(const QStringList &arguments)
+{
+    QStringList result;
+    for (int i = 0; i < arguments.size(); ++i) {
+        const QString &argument = arguments.at(i);
+        if (i > 0 && argument.startsWith(QLatin1Char('-'))) {
+            QString name = argument.mid(argument.startsWith(QLatin1String("--")) ? 2 : 1);
+            const int equals = name.indexOf(QLatin1Char('='));
+            if (equals >= 0)
+                name.truncate(equals);
+            if (name == QLatin1String("batch") || name == QLatin1String("jobs")) {
+                if (equals < 0)
+                    ++i; // skip the value
+                continue;
+            }
+        }
+        result.append(argument);
+    }
+    return result;
+}
+
+// The reference counting of the bootstrap library is not thread-safe, so
+// the threads of a batch run must not share any implicitly shared data.
+static QStringList deepCopy(const QStringList &list)
+{
+    QStringList result;
+    result.reserve(list.size());
+    for (const QString &string : list)
+        result.append(QString(string.constData(), string.size()));
+    return result;
+}
+
+// Runs the invocations listed in batchFile on several threads. Each thread
+// has its own token cache, backed by the shared cache directory, if any.
+// An error in the input of any job still terminates the whole process, like
+// it does for a single invocation.
+static int runMocBatch(const QStringList &arguments, const QString &batchFile, int jobs,
+                       const QString &tokenCacheDirectory)
+{
+    QFile f(batchFile);
+    if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        error(qPrintable(QLatin1String("Cannot open batch file ") + batchFile));
+        return 1;
+    }
+    const QStringList baseArguments = batchJobBaseArguments(arguments);
+    QList<QStringList> jobArguments;
+    while (!f.atEnd()) {
+        QString line = QString::fromLocal8Bit(f.readLine().trimmed());
+        if (line.isEmpty())
+            continue;
+        if (!line.startsWith(QLatin1Char('@')))
+            line.prepend(QLatin1Char('@'));
+        jobArguments.append(baseArguments + QStringList(line));
+    }
+    if (!tokenCacheDirectory.isEmpty())
+        QDir().mkpath(tokenCacheDirectory);
+
+    std::vector<int> results(jobArguments.size(), 0);
+    std::atomic<qsizetype> next(0);
+    const auto run = [&]() {
+        TokenCache tokenCache(QString(tokenCacheDirectory.constData(), tokenCacheDirectory.size()));
+        for (qsizetype i = next++; i < jobArguments.size(); i = next++)
+            results[i] = runMocJob(deepCopy(jobArguments.at(i)), &tokenCache);
+    };
+
+    jobs = int(qMin(qsizetype(jobs), jobArguments.size()));
+    std::vector<std::thread> threads;
+    if (jobs > 1)
+        threads.reserve(jobs - 1);
+    for (int i = 1; i < jobs; ++i)
+        threads.emplace_back(run);
+    run();
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (int result : results) {
+        if (result != 0)
+            return result;
+    }
+    return 0;
+}
+
+int runMoc(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationVersion(QString::fromLatin1(QT_VERSION_STR));
+
+    return runMocJob(app.arguments(), nullptr);
+}
+
 QT_END_NAMESPACE
 
 int main(int _argc, char **_argv)
@@ -1044,7 +1044,8 @@ static QByteArrayList make_candidates()
 
 static QByteArrayList requiredQtContainers(const QList<ClassDef> &classes)
 {
-    static const QByteArrayList candidates = make_candidates();
+    // the reference counting of the bootstrap library is not thread-safe
+    static thread_local const QByteArrayList candidates = make_candidates();
 
     QByteArrayList required;
     required.reserve(candidates.size());
@@ -7,6 +7,7 @@ HEADERS =  $$PWD/moc.h \
            $$PWD/parser.h \
            $$PWD/symbols.h \
            $$PWD/token.h \
+           $$PWD/tokencache.h \
            $$PWD/utils.h \
            $$PWD/generator.h \
            $$PWD/outputrevision.h \
@@ -18,4 +19,5 @@ SOURCES =  $$PWD/moc.cpp \
            $$PWD/generator.cpp \
            $$PWD/parser.cpp \
            $$PWD/token.cpp \
+           $$PWD/tokencache.cpp \
            $$PWD/collectjson.cpp
@@ -8,7 +8,7 @@ DEFINES += \
     QT_NO_COMPRESS \
     QT_NO_FOREACH
 
-# strerror() is safe to use because moc is single-threaded
+# strerror() is safe to use: the MSVC runtime keeps its buffer per thread
 msvc: DEFINES += _CRT_SECURE_NO_WARNINGS
 
 include(moc.pri)
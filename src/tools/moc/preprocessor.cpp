@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include "preprocessor.h"
+#include "tokencache.h"
 #include "utils.h"
 #include <qstringlist.h>
 #include <qfile.h>
@@ -107,7 +108,7 @@ static QByteArray cleaned(const QByteArray &input)
     return result;
 }
 
-bool Preprocessor::preprocessOnly = false;
+thread_local bool Preprocessor::preprocessOnly = false;
 void Preprocessor::skipUntilEndif()
 {
     while(index < symbols.size() - 1 && symbols.at(index).token != PP_ENDIF){
@@ -1049,6 +1050,27 @@ QByteArray Preprocessor::resolveInclude(const QByteArray &include, const QByteAr
     return it.value();
 }
 
+Symbols Preprocessor::tokenizeFile(const QByteArray &filename, const QByteArray &input)
+{
+    QByteArray contentHash;
+    Symbols result;
+    if (tokenCache && !filename.isEmpty()) {
+        contentHash = TokenCache::contentHash(input);
+        if (tokenCache->find(filename, contentHash, preprocessOnly, &result))
+            return result;
+    }
+
+    // phase 1: get rid of backslash-newlines
+    const QByteArray cleanedInput = cleaned(input);
+
+    // phase 2: tokenize for the preprocessor
+    result = tokenize(cleanedInput);
+
+    if (!contentHash.isEmpty())
+        tokenCache->insert(filename, contentHash, preprocessOnly, cleanedInput, result);
+    return result;
+}
+
 void Preprocessor::preprocess(const QByteArray &filename, Symbols &preprocessed)
 {
     currentFilenames.push(filename);
@@ -1090,11 +1112,8 @@ void Preprocessor::preprocess(const QByteArray &filename, Symbols &preprocessed)
             Symbols saveSymbols = symbols;
             int saveIndex = index;
 
-            // phase 1: get rid of backslash-newlines
-            input = cleaned(input);
-
-            // phase 2: tokenize for the preprocessor
-            symbols = tokenize(input);
+            // phases 1 and 2
+            symbols = tokenizeFile(include, input);
             input.clear();
 
             index = 0;
@@ -1221,12 +1240,9 @@ Symbols Preprocessor::preprocessed(const QByteArray &filename, QFile *file)
     if (input.isEmpty())
         return symbols;
 
-    // phase 1: get rid of backslash-newlines
-    input = cleaned(input);
-
-    // phase 2: tokenize for the preprocessor
+    // phases 1 and 2
     index = 0;
-    symbols = tokenize(input);
+    symbols = tokenizeFile(filename, input);
 
 #if 0
     for (int j = 0; j < symbols.size(); ++j)
@@ -53,12 +53,15 @@ typedef SubArray MacroName;
 typedef QHash<MacroName, Macro> Macros;
 
 class QFile;
+class TokenCache;
 
 class Preprocessor : public Parser
 {
 public:
     Preprocessor(){}
-    static bool preprocessOnly;
+    // thread_local, so that the jobs of a --batch run can use different options
+    static thread_local bool preprocessOnly;
+    TokenCache *tokenCache = nullptr;
     QList<QByteArray> frameworks;
     QSet<QByteArray> preprocessedIncludes;
     QHash<QByteArray, QByteArray> nonlocalIncludePathResolutionCache;
@@ -83,6 +86,7 @@ public:
 
 private:
     void until(Token);
+    Symbols tokenizeFile(const QByteArray &filename, const QByteArray &input);
 
     void preprocess(const QByteArray &filename, Symbols &preprocessed);
 };
@@ -0,0 +1,247 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "tokencache.h"
+#include "outputrevision.h"
+
+#include <qcryptographichash.h>
+#include <qdir.h>
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qsavefile.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// On-disk layout of a cache entry: the header, the cleaned input, the
+// lexems that are not part of the cleaned input and one record per symbol.
+// Entries are only read back by the moc that wrote them, so the data is
+// stored in host byte order.
+enum { EntryFormatVersion = 1 };
+
+struct EntryHeader
+{
+    char magic[8];
+    quint32 formatVersion;
+    quint32 mocRevision;
+    quint32 preprocessOnly;
+    quint32 symbolCount;
+    quint32 cleanedSize;
+    quint32 extraSize;
+    char contentHash[20];
+};
+
+enum : qint32 { NoLexem = -1, CleanedInputLexem = -2 };
+
+struct SymbolRecord
+{
+    qint32 lineNum;
+    qint32 token;
+    qint32 from;
+    qint32 len;
+    qint32 lexemFrom; // offset into the extra lexems, or one of the values above
+    qint32 lexemLen;
+};
+
+const char entryMagic[8] = { 'Q', 'M', 'O', 'C', 'T', 'O', 'K', '\0' };
+}
+
+static QByteArray cacheKey(const QByteArray &filename, bool preprocessOnly)
+{
+    // tokenize() keeps more tokens when only preprocessing
+    return preprocessOnly ? "E:" + filename : filename;
+}
+
+TokenCache::TokenCache(const QString &directory)
+    : directory(directory)
+{
+    if (!directory.isEmpty())
+        QDir().mkpath(directory);
+}
+
+QByteArray TokenCache::contentHash(const QByteArray &input)
+{
+    return QCryptographicHash::hash(input, QCryptographicHash::Sha1);
+}
+
+bool TokenCache::find(const QByteArray &filename, const QByteArray &contentHash,
+                      bool preprocessOnly, Symbols *symbols)
+{
+#ifdef USE_LEXEM_STORE
+    Q_UNUSED(filename);
+    Q_UNUSED(contentHash);
+    Q_UNUSED(preprocessOnly);
+    Q_UNUSED(symbols);
+    return false;
+#else
+    const QByteArray key = cacheKey(filename, preprocessOnly);
+    const auto it = entries.constFind(key);
+    if (it != entries.constEnd() && it->contentHash == contentHash) {
+        *symbols = it->symbols;
+        return true;
+    }
+
+    if (directory.isEmpty() || !readEntry(entryFileName(key), contentHash, preprocessOnly, symbols))
+        return false;
+    entries.insert(key, Entry{ contentHash, *symbols });
+    return true;
+#endif
+}
+
+void TokenCache::insert(const QByteArray &filename, const QByteArray &contentHash,
+                        bool preprocessOnly, const QByteArray &cleanedInput,
+                        const Symbols &symbols)
+{
+#ifdef USE_LEXEM_STORE
+    Q_UNUSED(filename);
+    Q_UNUSED(contentHash);
+    Q_UNUSED(preprocessOnly);
+    Q_UNUSED(cleanedInput);
+    Q_UNUSED(symbols);
+#else
+    const QByteArray key = cacheKey(filename, preprocessOnly);
+    entries.insert(key, Entry{ contentHash, symbols });
+    if (!directory.isEmpty())
+        writeEntry(entryFileName(key), contentHash, preprocessOnly, cleanedInput, symbols);
+#endif
+}
+
+QString TokenCache::entryFileName(const QByteArray &key) const
+{
+    // relative names of the main input file depend on the working directory
+    const QByteArray absoluteKey =
+            QFile::encodeName(QFileInfo(QFile::decodeName(key)).absoluteFilePath());
+    const QByteArray name = QCryptographicHash::hash(absoluteKey, QCryptographicHash::Sha1).toHex();
+    return directory + QLatin1Char('/') + QLatin1String(name) + QLatin1String(".tok");
+}
+
+#ifndef USE_LEXEM_STORE
+bool TokenCache::readEntry(const QString &fileName, const QByteArray &contentHash,
+                           bool preprocessOnly, Symbols *symbols) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    const QByteArray data = file.readAll();
+    file.close();
+
+    EntryHeader header;
+    if (size_t(data.size()) < sizeof(header))
+        return false;
+    memcpy(&header, data.constData(), sizeof(header));
+    if (memcmp(header.magic, entryMagic, sizeof(entryMagic)) != 0
+            || header.formatVersion != EntryFormatVersion
+            || header.mocRevision != mocOutputRevision
+            || header.preprocessOnly != quint32(preprocessOnly)
+            || contentHash.size() != int(sizeof(header.contentHash))
+            || memcmp(header.contentHash, contentHash.constData(), sizeof(header.contentHash)) != 0) {
+        return false;
+    }
+    const qint64 expectedSize = qint64(sizeof(header)) + header.cleanedSize + header.extraSize
+            + qint64(header.symbolCount) * qint64(sizeof(SymbolRecord));
+    if (data.size() != expectedSize)
+        return false;
+
+    const char *p = data.constData() + sizeof(header);
+    const QByteArray cleanedInput(p, header.cleanedSize);
+    p += header.cleanedSize;
+    const char *extra = p;
+    p += header.extraSize;
+
+    Symbols result;
+    result.reserve(header.symbolCount);
+    for (quint32 i = 0; i < header.symbolCount; ++i, p += sizeof(SymbolRecord)) {
+        SymbolRecord record;
+        memcpy(&record, p, sizeof(record));
+        Symbol symbol(record.lineNum, Token(record.token));
+        if (record.lexemFrom == CleanedInputLexem) {
+            symbol.lex = cleanedInput;
+        } else if (record.lexemFrom != NoLexem) {
+            if (record.lexemFrom < 0 || record.lexemLen < 0
+                    || quint32(record.lexemFrom) + quint32(record.lexemLen) > header.extraSize) {
+                return false;
+            }
+            symbol.lex = QByteArray(extra + record.lexemFrom, record.lexemLen);
+        }
+        symbol.from = record.from;
+        symbol.len = record.len;
+        if (symbol.from < 0 || symbol.from + qMax(symbol.len, 0) > symbol.lex.size())
+            return false;
+        result.append(symbol);
+    }
+    *symbols = std::move(result);
+    return true;
+}
+
+void TokenCache::writeEntry(const QString &fileName, const QByteArray &contentHash,
+                            bool preprocessOnly, const QByteArray &cleanedInput,
+                            const Symbols &symbols) const
+{
+    QByteArray extra;
+    QByteArray records;
+    records.reserve(symbols.size() * int(sizeof(SymbolRecord)));
+    for (const Symbol &symbol : symbols) {
+        SymbolRecord record = { symbol.lineNum, qint32(symbol.token), symbol.from, symbol.len,
+                                NoLexem, 0 };
+        if (symbol.lex.constData() == cleanedInput.constData()) {
+            record.lexemFrom = CleanedInputLexem;
+        } else if (!symbol.lex.isNull()) {
+            record.lexemFrom = extra.size();
+            record.lexemLen = symbol.lex.size();
+            extra += symbol.lex;
+        }
+        records.append(reinterpret_cast<const char *>(&record), sizeof(record));
+    }
+
+    EntryHeader header;
+    memcpy(header.magic, entryMagic, sizeof(entryMagic));
+    header.formatVersion = EntryFormatVersion;
+    header.mocRevision = mocOutputRevision;
+    header.preprocessOnly = preprocessOnly;
+    header.symbolCount = quint32(symbols.size());
+    header.cleanedSize = quint32(cleanedInput.size());
+    header.extraSize = quint32(extra.size());
+    Q_ASSERT(contentHash.size() == int(sizeof(header.contentHash)));
+    memcpy(header.contentHash, contentHash.constData(), sizeof(header.contentHash));
+
+    // Several moc processes may update the same entry at once; QSaveFile
+    // makes sure readers only ever see complete entries.
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(cleanedInput);
+    file.write(extra);
+    file.write(records);
+    file.commit();
+}
+#endif
+
+QT_END_NAMESPACE
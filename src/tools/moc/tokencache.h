@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef TOKENCACHE_H
+#define TOKENCACHE_H
+
+#include "symbols.h"
+#include <qhash.h>
+#include <qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+// Keeps the tokenized form of the files read by the preprocessor, so that
+// headers included by many translation units are only tokenized once. The
+// tokens only depend on the contents of a file, not on macros or include
+// paths, so each entry is keyed on the resolved file name and validated
+// against a hash of the file contents. With a directory, entries are also
+// stored on disk and shared between moc processes.
+//
+// The reference counting of the bootstrap library is not thread-safe, so
+// every thread of a --batch run uses its own cache.
+class TokenCache
+{
+public:
+    explicit TokenCache(const QString &directory = QString());
+
+    static QByteArray contentHash(const QByteArray &input);
+
+    // Sets *symbols and returns true if the file with the given name and
+    // content hash was tokenized before.
+    bool find(const QByteArray &filename, const QByteArray &contentHash, bool preprocessOnly,
+              Symbols *symbols);
+    // Stores the symbols obtained from tokenizing cleanedInput, which the
+    // lexems of most symbols refer to.
+    void insert(const QByteArray &filename, const QByteArray &contentHash, bool preprocessOnly,
+                const QByteArray &cleanedInput, const Symbols &symbols);
+
+private:
+    struct Entry
+    {
+        QByteArray contentHash;
+        Symbols symbols;
+    };
+
+    QString entryFileName(const QByteArray &key) const;
+    bool readEntry(const QString &fileName, const QByteArray &contentHash, bool preprocessOnly,
+                   Symbols *symbols) const;
+    void writeEntry(const QString &fileName, const QByteArray &contentHash, bool preprocessOnly,
+                    const QByteArray &cleanedInput, const Symbols &symbols) const;
+
+    QString directory;
+    QHash<QByteArray, Entry> entries;
+};
+
+QT_END_NAMESPACE
+
+#endif // TOKENCACHE_H
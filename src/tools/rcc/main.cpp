@@ -189,6 +189,12 @@ int runRcc(int argc, char *argv[])
     QCommandLineOption binaryOption(QStringLiteral("binary"), QStringLiteral("Output a binary file for use as a dynamic resource."));
     parser.addOption(binaryOption);
 
+    QCommandLineOption pageAlignOption(QStringLiteral("page-align"), QStringLiteral("Align uncompressed file data on 4096-byte boundaries, so it can be mapped directly."));
+    parser.addOption(pageAlignOption);
+
+    QCommandLineOption jobsOption(QStringLiteral("jobs"), QStringLiteral("Number of threads used to read and compress files (default: number of cores)."), QStringLiteral("count"));
+    parser.addOption(jobsOption);
+
     QCommandLineOption generatorOption(QStringList{QStringLiteral("g"), QStringLiteral("generator")});
     generatorOption.setDescription(QStringLiteral("Select generator."));
     generatorOption.setValueName(QStringLiteral("cpp|python|python2"));
@@ -265,6 +271,10 @@ int runRcc(int argc, char *argv[])
         library.setCompressThreshold(parser.value(thresholdOption).toInt());
     if (parser.isSet(binaryOption))
         library.setFormat(RCCResourceLibrary::Binary);
+    if (parser.isSet(pageAlignOption))
+        library.setPageAlign(true);
+    if (parser.isSet(jobsOption))
+        library.setJobs(parser.value(jobsOption).toInt());
     if (parser.isSet(generatorOption)) {
         auto value = parser.value(generatorOption);
         if (value == QLatin1String("cpp"))
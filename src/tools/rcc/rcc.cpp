@@ -41,6 +41,9 @@
 #include <qxmlstream.h>
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #if QT_CONFIG(zstd)
 #  include <zstd.h>
@@ -66,6 +69,9 @@ enum {
 #  define CONSTANT_COMPRESSALGO_DEFAULT     RCCResourceLibrary::CompressionAlgorithm::None
 #endif
 
+// the alignment of uncompressed payloads with --page-align
+#define CONSTANT_PAGESIZE 4096
+
 void RCCResourceLibrary::write(const char *str, int len)
 {
     int n = m_out.size();
@@ -88,6 +94,25 @@ static inline QString msgOpenReadFailed(const QString &fname, const QString &why
 }
 
 
+///////////////////////////////////////////////////////////
+//
+// RCCCompressor
+//
+///////////////////////////////////////////////////////////
+
+// per-thread state used while compressing file data
+struct RCCCompressor
+{
+    RCCCompressor() = default;
+    RCCCompressor(const RCCCompressor &) = delete;
+    RCCCompressor &operator=(const RCCCompressor &) = delete;
+#if QT_CONFIG(zstd)
+    ~RCCCompressor() { ZSTD_freeCCtx(zstdCCtx); }
+
+    ZSTD_CCtx *zstdCCtx = nullptr;
+#endif
+};
+
 ///////////////////////////////////////////////////////////
 //
 // RCCFileInfo
@@ -119,7 +144,10 @@ public:
     QString resourceName() const;
 
 public:
-    qint64 writeDataBlob(RCCResourceLibrary &lib, qint64 offset, QString *errorMessage);
+    bool prepareData(const RCCResourceLibrary &lib, RCCCompressor &compressor,
+                     QString *errorMessage);
+    qint64 writeDataBlob(RCCResourceLibrary &lib, RCCCompressor &compressor, qint64 offset,
+                         QString *errorMessage);
     qint64 writeDataName(RCCResourceLibrary &, qint64 offset);
     void writeDataInfo(RCCResourceLibrary &lib);
 
@@ -138,6 +166,11 @@ public:
     qint64 m_dataOffset;
     qint64 m_childOffset;
     bool m_noZstd;
+
+    // set by prepareData(), consumed by writeDataBlob()
+    QByteArray m_data;
+    QByteArray m_notes;
+    bool m_prepared;
 };
 
 RCCFileInfo::RCCFileInfo(const QString &name, const QFileInfo &fileInfo,
@@ -158,6 +191,7 @@ RCCFileInfo::RCCFileInfo(const QString &name, const QFileInfo &fileInfo,
     m_compressLevel = compressLevel;
     m_compressThreshold = compressThreshold;
     m_noZstd = noZstd;
+    m_prepared = false;
 }
 
 RCCFileInfo::~RCCFileInfo()
@@ -246,24 +280,21 @@ void RCCFileInfo::writeDataInfo(RCCResourceLibrary &lib)
     }
 }
 
-qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
-    QString *errorMessage)
+// Reads the file and compresses it if that is worthwhile. This only touches
+// this RCCFileInfo and the compressor, so different files may be prepared
+// on different threads.
+bool RCCFileInfo::prepareData(const RCCResourceLibrary &lib, RCCCompressor &compressor,
+                              QString *errorMessage)
 {
-    const bool text = lib.m_format == RCCResourceLibrary::C_Code;
-    const bool pass1 = lib.m_format == RCCResourceLibrary::Pass1;
-    const bool pass2 = lib.m_format == RCCResourceLibrary::Pass2;
-    const bool binary = lib.m_format == RCCResourceLibrary::Binary;
-    const bool python = lib.m_format == RCCResourceLibrary::Python3_Code
-        || lib.m_format == RCCResourceLibrary::Python2_Code;
-
-    //capture the offset
-    m_dataOffset = offset;
+#if !QT_CONFIG(zstd)
+    Q_UNUSED(compressor);
+#endif
 
     //find the data to be written
     QFile file(m_fileInfo.absoluteFilePath());
     if (!file.open(QFile::ReadOnly)) {
         *errorMessage = msgOpenReadFailed(m_fileInfo.absoluteFilePath(), file.errorString());
-        return 0;
+        return false;
     }
     QByteArray data = file.readAll();
 
@@ -275,8 +306,8 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
             m_compressLevel = 19;   // not ZSTD_maxCLevel(), as 20+ are experimental
         }
         if (m_compressAlgo == RCCResourceLibrary::CompressionAlgorithm::Zstd && !m_noZstd) {
-            if (lib.m_zstdCCtx == nullptr)
-                lib.m_zstdCCtx = ZSTD_createCCtx();
+            if (compressor.zstdCCtx == nullptr)
+                compressor.zstdCCtx = ZSTD_createCCtx();
             qsizetype size = data.size();
             size = ZSTD_COMPRESSBOUND(size);
 
@@ -286,34 +317,33 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
 
             QByteArray compressed(size, Qt::Uninitialized);
             char *dst = const_cast<char *>(compressed.constData());
-            size_t n = ZSTD_compressCCtx(lib.m_zstdCCtx, dst, size,
+            size_t n = ZSTD_compressCCtx(compressor.zstdCCtx, dst, size,
                                          data.constData(), data.size(),
                                          compressLevel);
             if (n * 100.0 < data.size() * 1.0 * (100 - m_compressThreshold) ) {
                 // compressing is worth it
                 if (m_compressLevel < 0) {
                     // heuristic compression, so recompress
-                    n = ZSTD_compressCCtx(lib.m_zstdCCtx, dst, size,
+                    n = ZSTD_compressCCtx(compressor.zstdCCtx, dst, size,
                                           data.constData(), data.size(),
                                           CONSTANT_ZSTDCOMPRESSLEVEL_STORE);
                 }
                 if (ZSTD_isError(n)) {
                     QString msg = QString::fromLatin1("%1: error: compression with zstd failed: %2\n")
                             .arg(m_name, QString::fromUtf8(ZSTD_getErrorName(n)));
-                    lib.m_errorDevice->write(msg.toUtf8());
+                    m_notes += msg.toUtf8();
                 } else if (lib.verbose()) {
                     QString msg = QString::fromLatin1("%1: note: compressed using zstd (%2 -> %3)\n")
                             .arg(m_name).arg(data.size()).arg(n);
-                    lib.m_errorDevice->write(msg.toUtf8());
+                    m_notes += msg.toUtf8();
                 }
 
-                lib.m_overallFlags |= CompressedZstd;
                 m_flags |= CompressedZstd;
                 data = std::move(compressed);
                 data.truncate(n);
             } else if (lib.verbose()) {
                 QString msg = QString::fromLatin1("%1: note: not compressed\n").arg(m_name);
-                lib.m_errorDevice->write(msg.toUtf8());
+                m_notes += msg.toUtf8();
             }
         }
 #endif
@@ -331,19 +361,64 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
                 if (lib.verbose()) {
                     QString msg = QString::fromLatin1("%1: note: compressed using zlib (%2 -> %3)\n")
                             .arg(m_name).arg(data.size()).arg(compressed.size());
-                    lib.m_errorDevice->write(msg.toUtf8());
+                    m_notes += msg.toUtf8();
                 }
                 data = compressed;
-                lib.m_overallFlags |= Compressed;
                 m_flags |= Compressed;
             } else if (lib.verbose()) {
                 QString msg = QString::fromLatin1("%1: note: not compressed\n").arg(m_name);
-                lib.m_errorDevice->write(msg.toUtf8());
+                m_notes += msg.toUtf8();
             }
         }
 #endif // QT_NO_COMPRESS
     }
 
+    m_data = std::move(data);
+    m_prepared = true;
+    return true;
+}
+
+qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, RCCCompressor &compressor,
+                                  qint64 offset, QString *errorMessage)
+{
+    const bool text = lib.m_format == RCCResourceLibrary::C_Code;
+    const bool pass1 = lib.m_format == RCCResourceLibrary::Pass1;
+    const bool pass2 = lib.m_format == RCCResourceLibrary::Pass2;
+    const bool binary = lib.m_format == RCCResourceLibrary::Binary;
+    const bool python = lib.m_format == RCCResourceLibrary::Python3_Code
+        || lib.m_format == RCCResourceLibrary::Python2_Code;
+
+    if (!m_prepared && !prepareData(lib, compressor, errorMessage))
+        return 0;
+    if (!m_notes.isEmpty())
+        lib.m_errorDevice->write(m_notes);
+    lib.m_overallFlags |= m_flags & (Compressed | CompressedZstd);
+    const QByteArray data = std::move(m_data);
+    m_notes.clear();
+    m_prepared = false;
+
+    // pad, so that uncompressed payloads start on a page boundary and can be
+    // used straight from a mapped file
+    if (lib.m_pageAlign && (text || binary) && !(m_flags & (Compressed | CompressedZstd))) {
+        const qint64 start = (binary ? lib.m_dataOffset : 0) + offset + 4;
+        const qint64 padding = (CONSTANT_PAGESIZE - start % CONSTANT_PAGESIZE) % CONSTANT_PAGESIZE;
+        for (qint64 i = 0; i < padding; ++i) {
+            if (binary) {
+                lib.writeChar(0);
+            } else {
+                lib.writeHex(0);
+                if (i % 16 == 15)
+                    lib.writeString("\n  ");
+            }
+        }
+        if (text && padding)
+            lib.writeString("\n  ");
+        offset += padding;
+    }
+
+    //capture the offset
+    m_dataOffset = offset;
+
     // some info
     if (text || pass1) {
         lib.writeString("  // ");
@@ -475,20 +550,16 @@ RCCResourceLibrary::RCCResourceLibrary(quint8 formatVersion)
     m_errorDevice(nullptr),
     m_outDevice(nullptr),
     m_formatVersion(formatVersion),
-    m_noZstd(false)
+    m_noZstd(false),
+    m_pageAlign(false),
+    m_jobs(qMax(1, int(std::thread::hardware_concurrency())))
 {
     m_out.reserve(30 * 1000 * 1000);
-#if QT_CONFIG(zstd)
-    m_zstdCCtx = nullptr;
-#endif
 }
 
 RCCResourceLibrary::~RCCResourceLibrary()
 {
     delete m_root;
-#if QT_CONFIG(zstd)
-    ZSTD_freeCCtx(m_zstdCCtx);
-#endif
 }
 
 enum RCCXmlTag {
@@ -1124,11 +1195,40 @@ bool RCCResourceLibrary::writeHeader()
     return true;
 }
 
+// Reads and compresses the files on m_jobs threads. The output is still written
+// serially, in the same order, so it does not depend on the number of jobs.
+// Files that fail here are left alone, writeDataBlob() retries them and
+// reports the error.
+void RCCResourceLibrary::prepareDataBlobs(const QList<RCCFileInfo *> &files)
+{
+    const int jobs = int(qMin(qsizetype(m_jobs), files.size()));
+    if (jobs < 2)
+        return;
+
+    std::atomic<qsizetype> next(0);
+    const auto prepare = [&]() {
+        RCCCompressor compressor;
+        QString errorMessage;
+        for (qsizetype i = next++; i < files.size(); i = next++)
+            files.at(i)->prepareData(*this, compressor, &errorMessage);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(jobs - 1);
+    for (int i = 1; i < jobs; ++i)
+        threads.emplace_back(prepare);
+    prepare();
+    for (std::thread &thread : threads)
+        thread.join();
+}
+
 bool RCCResourceLibrary::writeDataBlobs()
 {
     Q_ASSERT(m_errorDevice);
     switch (m_format) {
     case C_Code:
+        if (m_pageAlign)
+            writeString("alignas(" QT_STRINGIFY(CONSTANT_PAGESIZE) ") ");
         writeString("static const unsigned char qt_resource_data[] = {\n");
         break;
     case Python3_Code:
@@ -1147,23 +1247,30 @@ bool RCCResourceLibrary::writeDataBlobs()
     if (!m_root)
         return false;
 
+    QList<RCCFileInfo *> files;
     QStack<RCCFileInfo*> pending;
     pending.push(m_root);
-    qint64 offset = 0;
-    QString errorMessage;
     while (!pending.isEmpty()) {
         RCCFileInfo *file = pending.pop();
         for (auto it = file->m_children.cbegin(); it != file->m_children.cend(); ++it) {
             RCCFileInfo *child = it.value();
             if (child->m_flags & RCCFileInfo::Directory)
                 pending.push(child);
-            else {
-                offset = child->writeDataBlob(*this, offset, &errorMessage);
-                if (offset == 0) {
-                    m_errorDevice->write(errorMessage.toUtf8());
-                    return false;
-                }
-            }
+            else
+                files.append(child);
+        }
+    }
+
+    prepareDataBlobs(files);
+
+    RCCCompressor compressor;
+    qint64 offset = 0;
+    QString errorMessage;
+    for (RCCFileInfo *file : qAsConst(files)) {
+        offset = file->writeDataBlob(*this, compressor, offset, &errorMessage);
+        if (offset == 0) {
+            m_errorDevice->write(errorMessage.toUtf8());
+            return false;
         }
     }
     switch (m_format) {
@@ -36,8 +36,6 @@
 #include <qhash.h>
 #include <qstring.h>
 
-typedef struct ZSTD_CCtx_s ZSTD_CCtx;
-
 QT_BEGIN_NAMESPACE
 
 class RCCFileInfo;
@@ -112,6 +110,12 @@ public:
     void setNoZstd(bool v) { m_noZstd = v; }
     bool noZstd() const { return m_noZstd; }
 
+    void setPageAlign(bool v) { m_pageAlign = v; }
+    bool pageAlign() const { return m_pageAlign; }
+
+    void setJobs(int jobs) { m_jobs = qMax(1, jobs); }
+    int jobs() const { return m_jobs; }
+
 private:
     struct Strings {
         Strings();
@@ -131,6 +135,7 @@ private:
     bool interpretResourceFile(QIODevice *inputDevice, const QString &file,
         QString currentPath = QString(), bool listMode = false);
     bool writeHeader();
+    void prepareDataBlobs(const QList<RCCFileInfo *> &files);
     bool writeDataBlobs();
     bool writeDataNames();
     bool writeDataStructure();
@@ -148,10 +153,6 @@ private:
     void write(const char *, int len);
     void writeString(const char *s) { write(s, static_cast<int>(strlen(s))); }
 
-#if QT_CONFIG(zstd)
-    ZSTD_CCtx *m_zstdCCtx;
-#endif
-
     const Strings m_strings;
     RCCFileInfo *m_root;
     QStringList m_fileNames;
@@ -174,6 +175,8 @@ private:
     QByteArray m_out;
     quint8 m_formatVersion;
     bool m_noZstd;
+    bool m_pageAlign;
+    int m_jobs;
 };
 
 QT_END_NAMESPACE
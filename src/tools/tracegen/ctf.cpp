@@ -0,0 +1,181 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the tools applications of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "ctf.h"
+#include "provider.h"
+#include "helpers.h"
+#include "qtheaders.h"
+
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qtextstream.h>
+
+static QString tracePointVar(const QString &name)
+{
+    return QLatin1String("ctf_") + name;
+}
+
+static void writeDescription(QTextStream &stream, const Tracepoint::Field &field)
+{
+    const QString &name = field.name;
+
+    switch (field.backendType) {
+    case Tracepoint::Field::Array:
+        stream << "    ctfDescribeArray<" << field.paramType << ">(fields, \""
+               << name << "\", " << field.arrayLen << ");\n";
+        return;
+    case Tracepoint::Field::Sequence:
+        stream << "    ctfDescribeSequence<" << field.paramType << ">(fields, \""
+               << name << "\");\n";
+        return;
+    default:
+        break;
+    }
+
+    stream << "    ctfDescribeField<" << field.paramType << ">(fields, \"" << name << "\");\n";
+}
+
+static void writeSerialization(QTextStream &stream, const Tracepoint::Field &field)
+{
+    const QString &name = field.name;
+
+    switch (field.backendType) {
+    case Tracepoint::Field::Array:
+        stream << "    ctfWriteArray(payload, " << name << ", " << field.arrayLen << ");\n";
+        return;
+    case Tracepoint::Field::Sequence:
+        stream << "    ctfWriteSequence(payload, " << name << ", " << field.seqLen << ");\n";
+        return;
+    default:
+        break;
+    }
+
+    stream << "    ctfWriteField(payload, " << name << ");\n";
+}
+
+static void writePrologue(QTextStream &stream, const QString &fileName, const Provider &provider)
+{
+    const QString guard = includeGuard(fileName);
+
+    stream << "#ifndef " << guard << "\n"
+           << "#define " << guard << "\n"
+           << "\n"
+           << "#include <QtCore/private/qctf_p.h>\n"
+           << qtHeaders()
+           << "\n";
+
+    if (!provider.prefixText.isEmpty())
+        stream << provider.prefixText.join(QLatin1Char('\n')) << "\n\n";
+}
+
+static void writeEpilogue(QTextStream &stream, const QString &fileName)
+{
+    stream << "\n#endif // " << includeGuard(fileName) << "\n"
+           << "#include <private/qtrace_p.h>\n";
+}
+
+static void writeWrapper(QTextStream &stream, const Tracepoint &tracepoint,
+                         const QString &providerName)
+{
+    const QString argList = formatFunctionSignature(tracepoint.args);
+    const QString paramList = formatParameterList(tracepoint.args, ETW);
+    const QString &name = tracepoint.name;
+    const QString var = tracePointVar(name);
+
+    stream << "\n";
+
+    /* how each argument is stored is decided by QCtfType in qctf_p.h,
+     * so that the C++ type rather than its spelling picks the CTF type
+     */
+    stream << "inline void " << var << "_describe(QByteArray &"
+           << (tracepoint.fields.isEmpty() ? "" : "fields") << ")\n"
+           << "{\n";
+    for (const Tracepoint::Field &field : tracepoint.fields)
+        writeDescription(stream, field);
+    stream << "}\n";
+
+    stream << "inline QCtfTracePoint " << var << " = { \"" << providerName << "\", \""
+           << name << "\", " << var << "_describe, Q_BASIC_ATOMIC_INITIALIZER(-1) };\n";
+
+    stream << "inline void do_trace_" << name << "(" << argList << ")\n"
+           << "{\n"
+           << "    QCtfPayload payload;\n";
+    for (const Tracepoint::Field &field : tracepoint.fields)
+        writeSerialization(stream, field);
+    stream << "    ctfWriteEvent(&" << var << ", payload);\n"
+           << "}\n";
+
+    stream << "inline bool trace_" << name << "_enabled()\n"
+           << "{\n"
+           << "    return ctfIsTracing();\n"
+           << "}\n";
+
+    stream << "inline void trace_" << name << "(" << argList << ")\n"
+           << "{\n"
+           << "    if (Q_UNLIKELY(trace_" << name << "_enabled()))\n"
+           << "        do_trace_" << name << "(" << paramList << ");\n"
+           << "}\n";
+}
+
+static void writeTracepoints(QTextStream &stream, const Provider &provider)
+{
+    if (provider.tracepoints.isEmpty())
+        return;
+
+    stream << "QT_BEGIN_NAMESPACE\n"
+           << "namespace QtPrivate {\n";
+
+    for (const Tracepoint &t : provider.tracepoints)
+        writeWrapper(stream, t, provider.name);
+
+    stream << "} // namespace QtPrivate\n"
+           << "QT_END_NAMESPACE\n";
+}
+
+void writeCtf(QFile &file, const Provider &provider)
+{
+    QTextStream stream(&file);
+
+    const QString fileName = QFileInfo(file.fileName()).fileName();
+
+    writePrologue(stream, fileName, provider);
+    writeTracepoints(stream, provider);
+    writeEpilogue(stream, fileName);
+}
@@ -222,7 +222,7 @@ static Tracepoint parseTracepoint(const QString &name, const QStringList &args,
     static const QRegularExpression rx(QStringLiteral("^(.*)\\b([A-Za-z_][A-Za-z0-9_]*)$"));
 
     while (i != end) {
-        auto match = rx.match(*i);
+        auto match = rx.match(i->trimmed());
 
         const QString type = match.captured(1).trimmed();
 
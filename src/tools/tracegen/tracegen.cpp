@@ -40,6 +40,7 @@
 #include "provider.h"
 #include "lttng.h"
 #include "etw.h"
+#include "ctf.h"
 #include "panic.h"
 
 #include <qstring.h>
@@ -48,12 +49,13 @@
 enum class Target
 {
     LTTNG,
-    ETW
+    ETW,
+    CTF
 };
 
 static inline void usage(int status)
 {
-    printf("Usage: tracegen <lttng|etw> <input file> <output file>\n");
+    printf("Usage: tracegen <lttng|etw|ctf> <input file> <output file>\n");
     exit(status);
 }
 
@@ -70,6 +72,8 @@ static void parseArgs(int argc, char *argv[], Target *target, QString *inFile, Q
         *target = Target::LTTNG;
     } else if (qstrcmp(targetString, "etw") == 0) {
         *target = Target::ETW;
+    } else if (qstrcmp(targetString, "ctf") == 0) {
+        *target = Target::CTF;
     } else {
         fprintf(stderr, "Invalid target: %s\n", targetString);
         usage(EXIT_FAILURE);
@@ -103,6 +107,9 @@ int main(int argc, char *argv[])
     case Target::ETW:
         writeEtw(out, p);
         break;
+    case Target::CTF:
+        writeCtf(out, p);
+        break;
     }
 
     return 0;
@@ -2,6 +2,7 @@ option(host_build)
 CONFIG += force_bootstrap
 
 SOURCES += \
+    ctf.cpp \
     etw.cpp \
     helpers.cpp \
     lttng.cpp \
@@ -11,6 +12,7 @@ SOURCES += \
     tracegen.cpp
 
 HEADERS += \
+    ctf.h \
     etw.h \
     helpers.h \
     lttng.h \
@@ -2,9 +2,11 @@ INCLUDEPATH += $$PWD $$QT_BUILD_TREE/src/tools/uic
 
 # Input
 HEADERS += $$PWD/cppwritedeclaration.h \
+           $$PWD/cppwriteformdata.h \
            $$PWD/cppwriteincludes.h \
            $$PWD/cppwriteinitialization.h
 
 SOURCES += $$PWD/cppwritedeclaration.cpp \
+           $$PWD/cppwriteformdata.cpp \
            $$PWD/cppwriteincludes.cpp \
            $$PWD/cppwriteinitialization.cpp
@@ -27,6 +27,7 @@
 ****************************************************************************/
 
 #include "cppwritedeclaration.h"
+#include "cppwriteformdata.h"
 #include "cppwriteinitialization.h"
 #include "driver.h"
 #include "ui4.h"
@@ -115,7 +116,10 @@ void WriteDeclaration::acceptUI(DomUI *node)
 
     m_output << "\n";
 
-    WriteInitialization(m_uic).acceptUI(node);
+    if (m_option.formData)
+        WriteFormData(m_uic).acceptUI(node);
+    else
+        WriteInitialization(m_uic).acceptUI(node);
 
     m_output << "};\n\n";
 
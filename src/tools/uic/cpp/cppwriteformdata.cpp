@@ -0,0 +1,1269 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the tools applications of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "cppwriteformdata.h"
+#include "customwidgetsinfo.h"
+#include "databaseinfo.h"
+#include "driver.h"
+#include "ui4.h"
+#include "uic.h"
+#include "utils.h"
+
+#include <language.h>
+
+#include <qtextstream.h>
+
+#include <stdio.h>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+// The form data format. If it changes, you MUST change
+// src/widgets/kernel/qtuichelpers.cpp and its FormDataRevision too.
+enum { FormDataRevision = 1, HeaderSize = 9 };
+
+enum Operation {
+    OpEnd,
+    OpCreateObject,
+    OpCreateSpacer,
+    OpSetObjectName,
+    OpSetProperty,
+    OpSetContentsMargins,
+    OpResize,
+    OpAddLayoutItem,
+    OpSetLayoutStretch,
+    OpAddPage,
+    OpSetPageAttribute,
+    OpSetBuddy,
+    OpSetTabOrder,
+    OpConnect,
+    OpRaise,
+    OpRetranslateUi
+};
+
+enum TranslationOperation { TrEnd, TrProperty, TrPageAttribute };
+
+enum PropertyFlag { DynamicProperty = 0x1, OptionalProperty = 0x2 };
+
+enum ValueType {
+    ValueBool = 1,
+    ValueInt,
+    ValueUInt,
+    ValueLongLong,
+    ValueULongLong,
+    ValueDouble,
+    ValueFloat,
+    ValueString,
+    ValueByteArray,
+    ValueEnum,
+    ValueRect,
+    ValueRectF,
+    ValuePoint,
+    ValuePointF,
+    ValueSize,
+    ValueSizeF,
+    ValueSizePolicy,
+    ValueFont,
+    ValueColor,
+    ValueCursor,
+    ValueCursorShape,
+    ValueLocale,
+    ValueChar,
+    ValueDate,
+    ValueTime,
+    ValueDateTime,
+    ValueStringList,
+    ValueUrl
+};
+
+enum FontField {
+    FontFamily = 0x1,
+    FontPointSize = 0x2,
+    FontBold = 0x4,
+    FontItalic = 0x8,
+    FontUnderline = 0x10,
+    FontWeight = 0x20,
+    FontStrikeOut = 0x40,
+    FontKerning = 0x80,
+    FontAntialiasing = 0x100,
+    FontStyleStrategy = 0x200
+};
+
+enum LayoutItemKind { ItemWidget, ItemLayout, ItemSpacer };
+
+enum LayoutStretchKind {
+    Stretch,
+    RowStretch,
+    ColumnStretch,
+    ColumnMinimumWidth,
+    RowMinimumHeight
+};
+
+enum PageKind {
+    PageCentralWidget,
+    PageMenuBar,
+    PageStatusBar,
+    PageAddWidget,
+    PageSetWidget,
+    PageAddSubWindow,
+    PageAddTab
+};
+
+enum PageAttribute { PageText, PageToolTip, PageWhatsThis };
+
+void appendByte(QByteArray &data, uint value)
+{
+    data.append(char(value));
+}
+
+void appendUInt(QByteArray &data, quint64 value)
+{
+    do {
+        uchar byte = value & 0x7f;
+        value >>= 7;
+        if (value)
+            byte |= 0x80;
+        data.append(char(byte));
+    } while (value);
+}
+
+void appendInt(QByteArray &data, qint64 value)
+{
+    appendUInt(data, (quint64(value) << 1) ^ quint64(value >> 63));
+}
+
+void appendUInt32(QByteArray &data, quint32 value)
+{
+    for (int i = 0; i < 4; ++i)
+        data.append(char(value >> (8 * i)));
+}
+
+void appendDouble(QByteArray &data, double value)
+{
+    quint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i)
+        data.append(char(bits >> (8 * i)));
+}
+
+// "Qt::AlignLeft|Qt::AlignTop" -> "AlignLeft|AlignTop"
+QString unqualifiedEnumKeys(const QString &value)
+{
+    QStringList keys = value.split(QLatin1Char('|'));
+    for (QString &key : keys) {
+        key = key.trimmed();
+        const int pos = key.lastIndexOf(QLatin1String("::"));
+        if (pos >= 0)
+            key.remove(0, pos + 2);
+    }
+    return keys.join(QLatin1Char('|'));
+}
+
+template <class DomElement> // (DomString, DomStringList)
+bool needsTranslation(const DomElement *element)
+{
+    if (!element)
+        return false;
+    return !element->hasAttributeNotr() || !toBool(element->attributeNotr());
+}
+
+// Properties uic guards by QT_CONFIG() in generated code
+bool isConfigDependentProperty(const QString &propertyName)
+{
+    return propertyName == QLatin1String("toolTip")
+        || propertyName == QLatin1String("whatsThis")
+        || propertyName == QLatin1String("statusTip")
+        || propertyName == QLatin1String("shortcut")
+        || propertyName == QLatin1String("accessibleName")
+        || propertyName == QLatin1String("accessibleDescription");
+}
+
+QString unsupportedProperty(const DomProperty *p, bool stdsetdef)
+{
+    const char *what = nullptr;
+    switch (p->kind()) {
+    case DomProperty::Brush:
+        what = "brush";
+        break;
+    case DomProperty::IconSet:
+        what = "icon";
+        break;
+    case DomProperty::Palette:
+        what = "palette";
+        break;
+    case DomProperty::Pixmap:
+        what = "pixmap";
+        break;
+    case DomProperty::StringList:
+        if (needsTranslation(p->elementStringList()))
+            what = "translatable string list";
+        break;
+    case DomProperty::CursorShape:
+    case DomProperty::Enum:
+    case DomProperty::Set:
+        if (!(p->hasAttributeStdset() ? p->attributeStdset() : stdsetdef))
+            what = "non-standard enumeration";
+        break;
+    default:
+        break;
+    }
+    if (!what)
+        return QString();
+    return QString::fromLatin1("%1 property '%2'").arg(QLatin1String(what), p->attributeName());
+}
+
+QString unsupportedProperties(const QList<DomProperty *> &properties, bool stdsetdef)
+{
+    for (const DomProperty *p : properties) {
+        const QString feature = unsupportedProperty(p, stdsetdef);
+        if (!feature.isEmpty())
+            return feature;
+    }
+    return QString();
+}
+
+QString unsupportedWidgetFeature(const CustomWidgetsInfo *cwi, const DomWidget *node,
+                                 const QString &parentClass, bool stdsetdef);
+
+QString unsupportedLayoutFeature(const CustomWidgetsInfo *cwi, const DomLayout *node,
+                                 const QString &widgetClass, bool stdsetdef)
+{
+    const auto properties = node->elementProperty();
+    for (const DomProperty *p : properties) {
+        if (p->attributeName() == QLatin1String("margin"))
+            return QStringLiteral("layout property 'margin'");
+    }
+    QString feature = unsupportedProperties(properties, stdsetdef);
+    const auto items = node->elementItem();
+    for (auto it = items.cbegin(), end = items.cend(); feature.isEmpty() && it != end; ++it) {
+        const DomLayoutItem *item = *it;
+        if (item->kind() == DomLayoutItem::Widget)
+            feature = unsupportedWidgetFeature(cwi, item->elementWidget(), widgetClass, stdsetdef);
+        else if (item->kind() == DomLayoutItem::Layout)
+            feature = unsupportedLayoutFeature(cwi, item->elementLayout(), widgetClass, stdsetdef);
+    }
+    return feature;
+}
+
+QString unsupportedWidgetFeature(const CustomWidgetsInfo *cwi, const DomWidget *node,
+                                 const QString &parentClass, bool stdsetdef)
+{
+    const QString className = node->attributeClass();
+    const QString name = node->attributeName();
+
+    if (!node->elementAction().isEmpty() || !node->elementActionGroup().isEmpty()
+        || !node->elementAddAction().isEmpty()) {
+        return QString::fromLatin1("actions of '%1'").arg(name);
+    }
+    if (!node->elementItem().isEmpty() || !node->elementRow().isEmpty()
+        || !node->elementColumn().isEmpty()) {
+        return QString::fromLatin1("items of '%1'").arg(name);
+    }
+
+    static const QStringList unsupportedClasses = {
+        QLatin1String("QMenu"), QLatin1String("QAxWidget")
+    };
+    if (cwi->extendsOneOf(className, unsupportedClasses))
+        return QString::fromLatin1("%1 '%2'").arg(className, name);
+
+    static const QStringList mainWindowBars = {
+        QLatin1String("QToolBar"), QLatin1String("QDockWidget")
+    };
+    if (cwi->extends(parentClass, QLatin1String("QMainWindow"))
+        && cwi->extendsOneOf(className, mainWindowBars)) {
+        return QString::fromLatin1("%1 '%2' of a main window").arg(className, name);
+    }
+
+    static const QStringList pageContainers = {
+        QLatin1String("QToolBox"), QLatin1String("QWizard")
+    };
+    if (cwi->extendsOneOf(parentClass, pageContainers)
+        || !cwi->customWidgetAddPageMethod(parentClass).isEmpty()) {
+        return QString::fromLatin1("pages of %1").arg(parentClass);
+    }
+
+    const auto attributes = node->elementAttribute();
+    for (const DomProperty *a : attributes) {
+        const QString attributeName = a->attributeName();
+        if (attributeName == QLatin1String("buttonGroup"))
+            return QString::fromLatin1("button group of '%1'").arg(name);
+        if (attributeName == QLatin1String("icon"))
+            return QString::fromLatin1("page icon of '%1'").arg(name);
+        if (attributeName.startsWith(QLatin1String("header"))
+            || attributeName.startsWith(QLatin1String("horizontalHeader"))
+            || attributeName.startsWith(QLatin1String("verticalHeader"))) {
+            return QString::fromLatin1("header attributes of '%1'").arg(name);
+        }
+    }
+
+    QString feature = unsupportedProperties(node->elementProperty(), stdsetdef);
+    const auto children = node->elementWidget();
+    for (auto it = children.cbegin(), end = children.cend(); feature.isEmpty() && it != end; ++it)
+        feature = unsupportedWidgetFeature(cwi, *it, className, stdsetdef);
+    if (feature.isEmpty() && !node->elementLayout().isEmpty())
+        feature = unsupportedLayoutFeature(cwi, node->elementLayout().constFirst(), className, stdsetdef);
+    return feature;
+}
+
+} // namespace
+
+namespace CPP {
+
+WriteFormData::WriteFormData(Uic *uic) :
+    m_uic(uic),
+    m_driver(uic->driver()), m_output(uic->output()), m_option(uic->option()),
+    m_indent(m_option.indent + m_option.indent),
+    m_dindent(m_indent + m_option.indent),
+    m_strings(1, '\0')
+{
+}
+
+QString WriteFormData::unsupportedFeature(const Uic *uic, const DomUI *ui)
+{
+    if (!uic->option().translateFunction.isEmpty())
+        return QStringLiteral("a custom translation function");
+    if (!uic->databaseInfo()->connections().isEmpty())
+        return QStringLiteral("database connections");
+    if (ui->elementButtonGroups())
+        return QStringLiteral("button groups");
+    if (ui->elementLayoutFunction())
+        return QStringLiteral("layout functions");
+
+    const bool stdsetdef = !ui->hasAttributeStdSetDef() || ui->attributeStdSetDef();
+    return unsupportedWidgetFeature(uic->customWidgetsInfo(), ui->elementWidget(),
+                                    QString(), stdsetdef);
+}
+
+void WriteFormData::acceptUI(DomUI *node)
+{
+    m_widgetChain.push(nullptr);
+    m_layoutChain.push(nullptr);
+
+    if (node->hasAttributeConnectslotsbyname())
+        m_connectSlotsByName = node->attributeConnectslotsbyname();
+
+    acceptLayoutDefault(node->elementLayoutDefault());
+
+    if (node->hasAttributeStdSetDef())
+        m_stdsetdef = node->attributeStdSetDef();
+
+    m_generatedClass = node->elementClass() + m_option.postfix;
+
+    DomWidget *form = node->elementWidget();
+    m_widgetClassName = form->attributeClass();
+    const QString varName = m_driver->findOrInsertWidget(form);
+    m_objects.append({varName, m_widgetClassName});
+    m_objectIndexes.insert(varName, 0);
+
+    acceptWidget(form);
+
+    for (const Buddy &b : qAsConst(m_buddies)) {
+        const int buddy = objectIndex(m_driver->widgetVariableName(b.buddyAttributeName));
+        if (buddy < 0) {
+            fprintf(stderr, "%s: Warning: Buddy assignment: '%s' is not a valid widget.\n",
+                    qPrintable(m_option.messagePrefix()),
+                    qPrintable(b.buddyAttributeName));
+            continue;
+        }
+        appendByte(m_setupData, OpSetBuddy);
+        appendUInt(m_setupData, b.label);
+        appendUInt(m_setupData, uint(buddy));
+    }
+
+    if (node->elementTabStops())
+        acceptTabStops(node->elementTabStops());
+
+    appendByte(m_setupData, OpRetranslateUi);
+
+    if (node->elementConnections())
+        acceptConnections(node->elementConnections());
+
+    m_setupData += m_delayedData;
+    appendByte(m_setupData, OpEnd);
+
+    writeSetupUi();
+    writeRetranslateUi();
+    writeData();
+
+    m_layoutChain.pop();
+    m_widgetChain.pop();
+}
+
+void WriteFormData::acceptLayoutDefault(DomLayoutDefault *node)
+{
+    if (!node)
+        return;
+    if (node->hasAttributeMargin()) {
+        m_hasDefaultMargin = true;
+        m_defaultMargin = node->attributeMargin();
+    }
+    if (node->hasAttributeSpacing()) {
+        m_hasDefaultSpacing = true;
+        m_defaultSpacing = node->attributeSpacing();
+    }
+}
+
+void WriteFormData::acceptWidget(DomWidget *node)
+{
+    const QString className = node->attributeClass();
+    const QString varName = m_driver->findOrInsertWidget(node);
+    const auto *cwi = m_uic->customWidgetsInfo();
+
+    const DomWidget *parentNode = m_widgetChain.top();
+    QString parentClass;
+    uint parent = 0;
+    if (parentNode) {
+        parentClass = parentNode->attributeClass();
+        parent = m_objectIndexes.value(m_driver->findOrInsertWidget(parentNode));
+    }
+
+    uint object = 0;
+    if (m_widgetChain.size() != 1) {
+        object = createObject(varName, cwi->realClassName(className),
+                              m_uic->isContainer(parentClass) ? 0 : parent + 1);
+    }
+
+    writeProperties(object, varName, className, node->elementProperty());
+
+    if (node->elementLayout().isEmpty())
+        m_layoutChain.push(nullptr);
+
+    m_layoutWidget = false;
+    if (className == QLatin1String("QWidget") && !node->hasAttributeNative() && parentNode
+        && parentClass != QLatin1String("QMainWindow")
+        && !cwi->isCustomWidgetContainer(parentClass)
+        && !m_uic->isContainer(parentClass)) {
+        m_layoutWidget = true;
+    }
+    m_widgetChain.push(node);
+    m_layoutChain.push(nullptr);
+    TreeWalker::acceptWidget(node);
+    m_layoutChain.pop();
+    m_widgetChain.pop();
+    m_layoutWidget = false;
+
+    const auto addPage = [&](uint kind) {
+        appendByte(m_setupData, OpAddPage);
+        appendUInt(m_setupData, parent);
+        appendByte(m_setupData, kind);
+        appendUInt(m_setupData, object);
+    };
+
+    if (cwi->extends(parentClass, QLatin1String("QMainWindow"))) {
+        if (cwi->extends(className, QLatin1String("QMenuBar")))
+            addPage(PageMenuBar);
+        else if (cwi->extends(className, QLatin1String("QStatusBar")))
+            addPage(PageStatusBar);
+        else
+            addPage(PageCentralWidget);
+    }
+
+    const QString addPageMethod = cwi->simpleContainerAddPageMethod(parentClass);
+    if (addPageMethod == QLatin1String("addWidget")) {
+        addPage(PageAddWidget);
+    } else if (addPageMethod == QLatin1String("setWidget")) {
+        addPage(PageSetWidget);
+    } else if (addPageMethod == QLatin1String("addSubWindow")) {
+        addPage(PageAddSubWindow);
+    } else if (cwi->extends(parentClass, QLatin1String("QTabWidget"))) {
+        addPage(PageAddTab);
+        const DomPropertyMap attributes = propertyMap(node->elementAttribute());
+        const DomProperty *ptitle = attributes.value(QLatin1String("title"));
+        writePageAttribute(parent, object, PageText, ptitle ? ptitle->elementString() : nullptr,
+                           QStringLiteral("Page"));
+        if (const DomProperty *ptoolTip = attributes.value(QLatin1String("toolTip")))
+            writePageAttribute(parent, object, PageToolTip, ptoolTip->elementString());
+        if (const DomProperty *pwhatsThis = attributes.value(QLatin1String("whatsThis")))
+            writePageAttribute(parent, object, PageWhatsThis, pwhatsThis->elementString());
+    }
+
+    if (node->elementLayout().isEmpty())
+        m_layoutChain.pop();
+
+    const QStringList zOrder = node->elementZOrder();
+    for (const QString &name : zOrder) {
+        const int widget = objectIndex(m_driver->widgetVariableName(name));
+        if (widget < 0) {
+            fprintf(stderr, "%s: Warning: Z-order assignment: '%s' is not a valid widget.\n",
+                    qPrintable(m_option.messagePrefix()),
+                    name.toLatin1().data());
+        } else {
+            appendByte(m_setupData, OpRaise);
+            appendUInt(m_setupData, uint(widget));
+        }
+    }
+}
+
+void WriteFormData::acceptLayout(DomLayout *node)
+{
+    const QString className = node->attributeClass();
+    const QString varName = m_driver->findOrInsertLayout(node);
+
+    uint parent = 0;
+    if (!m_layoutChain.top())
+        parent = m_objectIndexes.value(m_driver->findOrInsertWidget(m_widgetChain.top())) + 1;
+    const uint object = createObject(varName, className, parent);
+
+    // The layout defaults, there is no 'margin' property (see unsupportedFeature())
+    const DomPropertyMap properties = propertyMap(node->elementProperty());
+    if (const DomProperty *p = properties.value(QLatin1String("spacing")))
+        writeIntProperty(m_setupData, object, "spacing", p->elementNumber());
+    else if (m_hasDefaultSpacing)
+        writeIntProperty(m_setupData, object, "spacing", m_defaultSpacing);
+    if (!m_layoutChain.top() && m_hasDefaultMargin) {
+        appendByte(m_setupData, OpSetContentsMargins);
+        appendUInt(m_setupData, object);
+        for (int i = 0; i < 4; ++i)
+            appendInt(m_setupData, m_defaultMargin);
+    }
+
+    unsigned flags = WritePropertyIgnoreMargin | WritePropertyIgnoreSpacing;
+    if (m_layoutWidget) {
+        flags |= WritePropertyZeroMargins;
+        m_layoutWidget = false;
+    }
+    writeProperties(object, varName, className, node->elementProperty(), flags);
+
+    m_layoutChain.push(node);
+    TreeWalker::acceptLayout(node);
+    m_layoutChain.pop();
+
+    writeStretchList(object, Stretch, node->attributeStretch());
+    writeStretchList(object, RowStretch, node->attributeRowStretch());
+    writeStretchList(object, ColumnStretch, node->attributeColumnStretch());
+    writeStretchList(object, ColumnMinimumWidth, node->attributeColumnMinimumWidth());
+    writeStretchList(object, RowMinimumHeight, node->attributeRowMinimumHeight());
+}
+
+void WriteFormData::writeStretchList(uint layout, uint kind, const QString &values)
+{
+    if (values.isEmpty())
+        return;
+    const QStringList list = values.split(QLatin1Char(','));
+    for (int i = 0, count = list.size(); i < count; ++i) {
+        if (list.at(i) == QLatin1String("0"))
+            continue;
+        appendByte(m_setupData, OpSetLayoutStretch);
+        appendUInt(m_setupData, layout);
+        appendByte(m_setupData, kind);
+        appendInt(m_setupData, i);
+        appendInt(m_setupData, list.at(i).toInt());
+    }
+}
+
+void WriteFormData::acceptSpacer(DomSpacer *node)
+{
+    m_spacers.append(m_driver->findOrInsertSpacer(node));
+
+    const DomPropertyMap properties = propertyMap(node->elementProperty());
+    int w = 0;
+    int h = 0;
+    if (const DomProperty *sh = properties.value(QLatin1String("sizeHint"))) {
+        if (const DomSize *sizeHint = sh->elementSize()) {
+            w = sizeHint->elementWidth();
+            h = sizeHint->elementHeight();
+        }
+    }
+
+    QString sizeType = QStringLiteral("Expanding");
+    if (const DomProperty *st = properties.value(QLatin1String("sizeType")))
+        sizeType = unqualifiedEnumKeys(st->elementEnum());
+
+    bool isVspacer = false;
+    if (const DomProperty *o = properties.value(QLatin1String("orientation"))) {
+        const QString orientation = o->elementEnum();
+        if (orientation == QLatin1String("Qt::Vertical") || orientation == QLatin1String("Vertical"))
+            isVspacer = true;
+    }
+    const QString minimum = QStringLiteral("Minimum");
+
+    appendByte(m_setupData, OpCreateSpacer);
+    appendInt(m_setupData, w);
+    appendInt(m_setupData, h);
+    appendUInt(m_setupData, string(isVspacer ? minimum : sizeType));
+    appendUInt(m_setupData, string(isVspacer ? sizeType : minimum));
+}
+
+void WriteFormData::acceptLayoutItem(DomLayoutItem *node)
+{
+    TreeWalker::acceptLayoutItem(node);
+
+    const DomLayout *layout = m_layoutChain.top();
+    if (!layout)
+        return;
+
+    uint kind = ItemWidget;
+    uint item = 0;
+    switch (node->kind()) {
+    case DomLayoutItem::Widget:
+        item = m_objectIndexes.value(m_driver->findOrInsertWidget(node->elementWidget()));
+        break;
+    case DomLayoutItem::Layout:
+        kind = ItemLayout;
+        item = m_objectIndexes.value(m_driver->findOrInsertLayout(node->elementLayout()));
+        break;
+    case DomLayoutItem::Spacer:
+        kind = ItemSpacer;
+        item = uint(m_spacers.indexOf(m_driver->findOrInsertSpacer(node->elementSpacer())));
+        break;
+    case DomLayoutItem::Unknown:
+        return;
+    }
+
+    appendByte(m_setupData, OpAddLayoutItem);
+    appendUInt(m_setupData, m_objectIndexes.value(m_driver->findOrInsertLayout(layout)));
+    appendByte(m_setupData, kind);
+    appendUInt(m_setupData, item);
+    appendInt(m_setupData, node->attributeRow());
+    appendInt(m_setupData, node->attributeColumn());
+    appendInt(m_setupData, node->hasAttributeRowSpan() ? node->attributeRowSpan() : 1);
+    appendInt(m_setupData, node->hasAttributeColSpan() ? node->attributeColSpan() : 1);
+    appendUInt(m_setupData, string(unqualifiedEnumKeys(node->attributeAlignment())));
+}
+
+void WriteFormData::acceptTabStops(DomTabStops *tabStops)
+{
+    int last = -1;
+
+    const QStringList l = tabStops->elementTabStop();
+    for (const QString &name : l) {
+        const int widget = objectIndex(m_driver->widgetVariableName(name));
+        if (widget < 0) {
+            fprintf(stderr, "%s: Warning: Tab-stop assignment: '%s' is not a valid widget.\n",
+                    qPrintable(m_option.messagePrefix()), qPrintable(name));
+            continue;
+        }
+        if (last >= 0) {
+            appendByte(m_setupData, OpSetTabOrder);
+            appendUInt(m_setupData, uint(last));
+            appendUInt(m_setupData, uint(widget));
+        }
+        last = widget;
+    }
+}
+
+void WriteFormData::acceptConnection(DomConnection *connection)
+{
+    const QString senderName = connection->elementSender();
+    const QString receiverName = connection->elementReceiver();
+
+    const auto indexOfWidget = [this](const QString &name) {
+        const DomWidget *widget = m_driver->widgetByName(name);
+        return widget ? objectIndex(m_driver->findOrInsertWidget(widget)) : -1;
+    };
+    const int sender = indexOfWidget(senderName);
+    const int receiver = indexOfWidget(receiverName);
+    if (sender < 0 || receiver < 0) {
+        fprintf(stderr, "%s: Warning: Invalid signal/slot connection: \"%s\" -> \"%s\".\n",
+                qPrintable(m_option.messagePrefix()),
+                qPrintable(senderName), qPrintable(receiverName));
+        return;
+    }
+
+    // The codes of the SIGNAL() and SLOT() macros
+    appendByte(m_setupData, OpConnect);
+    appendUInt(m_setupData, uint(sender));
+    appendUInt(m_setupData, string(QLatin1Char('2') + connection->elementSignal()));
+    appendUInt(m_setupData, uint(receiver));
+    appendUInt(m_setupData, string(QLatin1Char('1') + connection->elementSlot()));
+}
+
+uint WriteFormData::createObject(const QString &varName, const QString &className, uint parent)
+{
+    int factory = m_factories.indexOf(className);
+    if (factory < 0) {
+        factory = m_factories.size();
+        m_factories.append(className);
+    }
+    appendByte(m_setupData, OpCreateObject);
+    appendUInt(m_setupData, uint(factory));
+    appendUInt(m_setupData, parent);
+
+    const uint object = uint(m_objects.size());
+    m_objects.append({varName, className});
+    m_objectIndexes.insert(varName, object);
+    return object;
+}
+
+int WriteFormData::objectIndex(const QString &varName) const
+{
+    const auto it = m_objectIndexes.constFind(varName);
+    return it != m_objectIndexes.constEnd() ? int(it.value()) : -1;
+}
+
+// Returns the offset of \a s in the string pool
+uint WriteFormData::string(const QString &s)
+{
+    if (s.isEmpty())
+        return 0;
+    const QByteArray utf8 = s.toUtf8();
+    const auto it = m_stringOffsets.constFind(utf8);
+    if (it != m_stringOffsets.constEnd())
+        return it.value();
+    const uint offset = uint(m_strings.size());
+    m_strings += utf8;
+    m_strings += '\0';
+    m_stringOffsets.insert(utf8, offset);
+    return offset;
+}
+
+void WriteFormData::writeIntProperty(QByteArray &data, uint object, const char *name, int value)
+{
+    appendByte(data, OpSetProperty);
+    appendUInt(data, object);
+    appendUInt(data, string(QLatin1String(name)));
+    appendByte(data, 0);
+    appendByte(data, ValueInt);
+    appendInt(data, value);
+}
+
+void WriteFormData::writeEnumProperty(QByteArray &data, uint object, const char *name,
+                                      const char *keys)
+{
+    appendByte(data, OpSetProperty);
+    appendUInt(data, object);
+    appendUInt(data, string(QLatin1String(name)));
+    appendByte(data, 0);
+    appendByte(data, ValueEnum);
+    appendUInt(data, string(QLatin1String(keys)));
+}
+
+// Appends the source text and comment of a translatable string, see trCall()
+// of WriteInitialization.
+void WriteFormData::writeTranslation(const DomString *str, const QString &defaultString)
+{
+    QString value = defaultString;
+    QString comment;
+    QString id;
+    if (str) {
+        value = toString(str);
+        comment = str->attributeComment();
+        id = str->attributeId();
+    }
+    if (!value.isEmpty() && m_driver->useIdBasedTranslations())
+        value = id;
+    appendUInt(m_translationData, string(value));
+    appendUInt(m_translationData, string(comment));
+}
+
+void WriteFormData::writePageAttribute(uint container, uint page, uint attribute,
+                                       const DomString *str, const QString &defaultString)
+{
+    if ((!str && !defaultString.isEmpty()) || needsTranslation(str)) {
+        appendByte(m_translationData, TrPageAttribute);
+        appendUInt(m_translationData, container);
+        appendUInt(m_translationData, page);
+        appendByte(m_translationData, attribute);
+        writeTranslation(str, defaultString);
+        m_translatedObjectCount = qMax(m_translatedObjectCount, qMax(container, page) + 1);
+    } else {
+        appendByte(m_setupData, OpSetPageAttribute);
+        appendUInt(m_setupData, container);
+        appendUInt(m_setupData, page);
+        appendByte(m_setupData, attribute);
+        appendUInt(m_setupData, string(str ? str->text() : defaultString));
+    }
+}
+
+void WriteFormData::writeProperties(uint object, const QString &varName,
+                                    const QString &className, const QList<DomProperty *> &lst,
+                                    unsigned flags)
+{
+    const bool isTopLevel = m_widgetChain.count() == 1;
+    const auto *cwi = m_uic->customWidgetsInfo();
+
+    appendByte(m_setupData, OpSetObjectName);
+    appendUInt(m_setupData, object);
+    appendUInt(m_setupData, string(varName));
+
+    const int defaultMargin = (flags & WritePropertyZeroMargins) ? 0 : -1;
+    int leftMargin, topMargin, rightMargin, bottomMargin;
+    leftMargin = topMargin = rightMargin = bottomMargin = defaultMargin;
+    bool frameShadowEncountered = false;
+
+    static const QStringList currentIndexWidgets = {
+        QLatin1String("QComboBox"), QLatin1String("QStackedWidget"),
+        QLatin1String("QTabWidget"), QLatin1String("QToolBox")
+    };
+
+    for (const DomProperty *p : lst) {
+        QString propertyName = p->attributeName();
+        bool delayProperty = false;
+
+        // special case for the property `geometry': Do not use position
+        if (isTopLevel && propertyName == QLatin1String("geometry") && p->elementRect()) {
+            const DomRect *r = p->elementRect();
+            appendByte(m_setupData, OpResize);
+            appendUInt(m_setupData, object);
+            appendInt(m_setupData, r->elementWidth());
+            appendInt(m_setupData, r->elementHeight());
+            continue;
+        }
+        if (propertyName == QLatin1String("currentRow") // QListWidget::currentRow
+            && cwi->extends(className, QLatin1String("QListWidget"))) {
+            writeIntProperty(m_delayedData, object, "currentRow", p->elementNumber());
+            continue;
+        }
+        if (propertyName == QLatin1String("currentIndex") // set currentIndex later
+            && cwi->extendsOneOf(className, currentIndexWidgets)) {
+            writeIntProperty(m_delayedData, object, "currentIndex", p->elementNumber());
+            continue;
+        }
+        if (propertyName == QLatin1String("default")
+            && cwi->extends(className, QLatin1String("QPushButton"))) {
+            // QTBUG-44406: Setting of QPushButton::default needs to be delayed until the parent is set
+            delayProperty = true;
+        } else if (propertyName == QLatin1String("database") && p->elementStringList()) {
+            // Sql support
+            continue;
+        } else if (propertyName == QLatin1String("frameworkCode")
+                   && p->kind() == DomProperty::Bool) {
+            // Sql support
+            continue;
+        } else if (propertyName == QLatin1String("orientation")
+                   && cwi->extends(className, QLatin1String("Line"))) {
+            // Line support
+            const bool vertical = p->elementEnum() == QLatin1String("Qt::Vertical");
+            writeEnumProperty(m_setupData, object, "frameShape", vertical ? "VLine" : "HLine");
+            // QFrame Default is 'Plain'. Make the line 'Sunken' unless otherwise specified
+            if (!frameShadowEncountered)
+                writeEnumProperty(m_setupData, object, "frameShadow", "Sunken");
+            continue;
+        } else if ((flags & WritePropertyIgnoreMargin) && propertyName == QLatin1String("margin")) {
+            continue;
+        } else if ((flags & WritePropertyIgnoreSpacing) && propertyName == QLatin1String("spacing")) {
+            continue;
+        } else if (propertyName == QLatin1String("leftMargin") && p->kind() == DomProperty::Number) {
+            leftMargin = p->elementNumber();
+            continue;
+        } else if (propertyName == QLatin1String("topMargin") && p->kind() == DomProperty::Number) {
+            topMargin = p->elementNumber();
+            continue;
+        } else if (propertyName == QLatin1String("rightMargin") && p->kind() == DomProperty::Number) {
+            rightMargin = p->elementNumber();
+            continue;
+        } else if (propertyName == QLatin1String("bottomMargin") && p->kind() == DomProperty::Number) {
+            bottomMargin = p->elementNumber();
+            continue;
+        } else if (propertyName == QLatin1String("numDigits") // Deprecated in Qt 4, removed in Qt 5.
+                   && cwi->extends(className, QLatin1String("QLCDNumber"))) {
+            qWarning("Widget '%s': Deprecated property QLCDNumber::numDigits encountered. It has been replaced by QLCDNumber::digitCount.",
+                     qPrintable(varName));
+            propertyName = QLatin1String("digitCount");
+        } else if (propertyName == QLatin1String("frameShadow")) {
+            frameShadowEncountered = true;
+        }
+
+        const bool stdset = p->hasAttributeStdset() ? p->attributeStdset() : m_stdsetdef;
+        uint propertyFlags = stdset ? 0 : DynamicProperty;
+        if (isConfigDependentProperty(propertyName))
+            propertyFlags |= OptionalProperty;
+
+        if (p->kind() == DomProperty::Cstring && propertyName == QLatin1String("buddy")
+            && cwi->extends(className, QLatin1String("QLabel"))) {
+            m_buddies.append({object, p->elementCstring()});
+            continue;
+        }
+        if (const DomString *str = p->elementString()) {
+            if (propertyName == QLatin1String("objectName") && str->text() == varName)
+                continue;
+            if (needsTranslation(str)) {
+                appendByte(m_translationData, TrProperty);
+                appendUInt(m_translationData, object);
+                appendUInt(m_translationData, string(propertyName));
+                appendByte(m_translationData, propertyFlags);
+                writeTranslation(str);
+                m_translatedObjectCount = qMax(m_translatedObjectCount, object + 1);
+                continue;
+            }
+        }
+
+        QByteArray value;
+        if (!writeValue(value, p))
+            continue;
+        QByteArray &data = delayProperty ? m_delayedData : m_setupData;
+        appendByte(data, OpSetProperty);
+        appendUInt(data, object);
+        appendUInt(data, string(propertyName));
+        appendByte(data, propertyFlags);
+        data += value;
+    }
+
+    if (leftMargin != -1 || topMargin != -1 || rightMargin != -1 || bottomMargin != -1) {
+        appendByte(m_setupData, OpSetContentsMargins);
+        appendUInt(m_setupData, object);
+        appendInt(m_setupData, leftMargin);
+        appendInt(m_setupData, topMargin);
+        appendInt(m_setupData, rightMargin);
+        appendInt(m_setupData, bottomMargin);
+    }
+}
+
+// Appends the type and value of \a p, returns false for unsupported types.
+bool WriteFormData::writeValue(QByteArray &data, const DomProperty *p)
+{
+    switch (p->kind()) {
+    case DomProperty::Bool:
+        appendByte(data, ValueBool);
+        appendByte(data, p->elementBool() == QLatin1String("true") ? 1 : 0);
+        return true;
+    case DomProperty::Color: {
+        const DomColor *c = p->elementColor();
+        appendByte(data, ValueColor);
+        appendByte(data, c->elementRed());
+        appendByte(data, c->elementGreen());
+        appendByte(data, c->elementBlue());
+        appendByte(data, c->hasAttributeAlpha() ? c->attributeAlpha() : 255);
+        return true;
+    }
+    case DomProperty::Cstring:
+        appendByte(data, ValueByteArray);
+        appendUInt(data, string(p->elementCstring()));
+        return true;
+    case DomProperty::Cursor:
+        appendByte(data, ValueCursor);
+        appendInt(data, p->elementCursor());
+        return true;
+    case DomProperty::CursorShape:
+        appendByte(data, ValueCursorShape);
+        appendUInt(data, string(p->elementCursorShape()));
+        return true;
+    case DomProperty::Enum:
+        appendByte(data, ValueEnum);
+        appendUInt(data, string(unqualifiedEnumKeys(p->elementEnum())));
+        return true;
+    case DomProperty::Set:
+        appendByte(data, ValueEnum);
+        appendUInt(data, string(unqualifiedEnumKeys(p->elementSet())));
+        return true;
+    case DomProperty::Font: {
+        const DomFont *f = p->elementFont();
+        uint fields = 0;
+        QByteArray font;
+        if (f->hasElementFamily() && !f->elementFamily().isEmpty()) {
+            fields |= FontFamily;
+            appendUInt(font, string(f->elementFamily()));
+        }
+        if (f->hasElementPointSize() && f->elementPointSize() > 0) {
+            fields |= FontPointSize;
+            appendInt(font, f->elementPointSize());
+        }
+        if (f->hasElementBold()) {
+            fields |= FontBold;
+            appendByte(font, f->elementBold());
+        }
+        if (f->hasElementItalic()) {
+            fields |= FontItalic;
+            appendByte(font, f->elementItalic());
+        }
+        if (f->hasElementUnderline()) {
+            fields |= FontUnderline;
+            appendByte(font, f->elementUnderline());
+        }
+        if (f->hasElementWeight() && f->elementWeight() > 0) {
+            fields |= FontWeight;
+            appendInt(font, f->elementWeight());
+        }
+        if (f->hasElementStrikeOut()) {
+            fields |= FontStrikeOut;
+            appendByte(font, f->elementStrikeOut());
+        }
+        if (f->hasElementKerning()) {
+            fields |= FontKerning;
+            appendByte(font, f->elementKerning());
+        }
+        if (f->hasElementAntialiasing()) {
+            fields |= FontAntialiasing;
+            appendByte(font, f->elementAntialiasing());
+        }
+        if (f->hasElementStyleStrategy()) {
+            fields |= FontStyleStrategy;
+            appendUInt(font, string(f->elementStyleStrategy()));
+        }
+        appendByte(data, ValueFont);
+        appendUInt(data, fields);
+        data += font;
+        return true;
+    }
+    case DomProperty::Point: {
+        const DomPoint *po = p->elementPoint();
+        appendByte(data, ValuePoint);
+        appendInt(data, po->elementX());
+        appendInt(data, po->elementY());
+        return true;
+    }
+    case DomProperty::PointF: {
+        const DomPointF *pof = p->elementPointF();
+        appendByte(data, ValuePointF);
+        appendDouble(data, pof->elementX());
+        appendDouble(data, pof->elementY());
+        return true;
+    }
+    case DomProperty::Rect: {
+        const DomRect *r = p->elementRect();
+        appendByte(data, ValueRect);
+        appendInt(data, r->elementX());
+        appendInt(data, r->elementY());
+        appendInt(data, r->elementWidth());
+        appendInt(data, r->elementHeight());
+        return true;
+    }
+    case DomProperty::RectF: {
+        const DomRectF *rf = p->elementRectF();
+        appendByte(data, ValueRectF);
+        appendDouble(data, rf->elementX());
+        appendDouble(data, rf->elementY());
+        appendDouble(data, rf->elementWidth());
+        appendDouble(data, rf->elementHeight());
+        return true;
+    }
+    case DomProperty::Locale: {
+        const DomLocale *locale = p->elementLocale();
+        appendByte(data, ValueLocale);
+        appendUInt(data, string(locale->attributeLanguage()));
+        appendUInt(data, string(locale->attributeCountry()));
+        return true;
+    }
+    case DomProperty::SizePolicy: {
+        const DomSizePolicy *sp = p->elementSizePolicy();
+        QString horizontal = QStringLiteral("Preferred");
+        QString vertical = horizontal;
+        if (sp->hasElementHSizeType() && sp->hasElementVSizeType()) {
+            horizontal = QLatin1String(language::sizePolicy(sp->elementHSizeType()));
+            vertical = QLatin1String(language::sizePolicy(sp->elementVSizeType()));
+        } else if (sp->hasAttributeHSizeType() && sp->hasAttributeVSizeType()) {
+            horizontal = sp->attributeHSizeType();
+            vertical = sp->attributeVSizeType();
+        }
+        appendByte(data, ValueSizePolicy);
+        appendUInt(data, string(horizontal));
+        appendUInt(data, string(vertical));
+        appendInt(data, sp->elementHorStretch());
+        appendInt(data, sp->elementVerStretch());
+        return true;
+    }
+    case DomProperty::Size: {
+        const DomSize *s = p->elementSize();
+        appendByte(data, ValueSize);
+        appendInt(data, s->elementWidth());
+        appendInt(data, s->elementHeight());
+        return true;
+    }
+    case DomProperty::SizeF: {
+        const DomSizeF *sf = p->elementSizeF();
+        appendByte(data, ValueSizeF);
+        appendDouble(data, sf->elementWidth());
+        appendDouble(data, sf->elementHeight());
+        return true;
+    }
+    case DomProperty::String:
+        appendByte(data, ValueString);
+        appendUInt(data, string(p->elementString()->text()));
+        return true;
+    case DomProperty::Number:
+        appendByte(data, ValueInt);
+        appendInt(data, p->elementNumber());
+        return true;
+    case DomProperty::UInt:
+        appendByte(data, ValueUInt);
+        appendUInt(data, p->elementUInt());
+        return true;
+    case DomProperty::LongLong:
+        appendByte(data, ValueLongLong);
+        appendInt(data, p->elementLongLong());
+        return true;
+    case DomProperty::ULongLong:
+        appendByte(data, ValueULongLong);
+        appendUInt(data, p->elementULongLong());
+        return true;
+    case DomProperty::Float:
+        appendByte(data, ValueFloat);
+        appendDouble(data, p->elementFloat());
+        return true;
+    case DomProperty::Double:
+        appendByte(data, ValueDouble);
+        appendDouble(data, p->elementDouble());
+        return true;
+    case DomProperty::Char:
+        appendByte(data, ValueChar);
+        appendUInt(data, uint(p->elementChar()->elementUnicode()));
+        return true;
+    case DomProperty::Date: {
+        const DomDate *d = p->elementDate();
+        appendByte(data, ValueDate);
+        appendInt(data, d->elementYear());
+        appendInt(data, d->elementMonth());
+        appendInt(data, d->elementDay());
+        return true;
+    }
+    case DomProperty::Time: {
+        const DomTime *t = p->elementTime();
+        appendByte(data, ValueTime);
+        appendInt(data, t->elementHour());
+        appendInt(data, t->elementMinute());
+        appendInt(data, t->elementSecond());
+        return true;
+    }
+    case DomProperty::DateTime: {
+        const DomDateTime *dt = p->elementDateTime();
+        appendByte(data, ValueDateTime);
+        appendInt(data, dt->elementYear());
+        appendInt(data, dt->elementMonth());
+        appendInt(data, dt->elementDay());
+        appendInt(data, dt->elementHour());
+        appendInt(data, dt->elementMinute());
+        appendInt(data, dt->elementSecond());
+        return true;
+    }
+    case DomProperty::StringList: {
+        const QStringList values = p->elementStringList()->elementString();
+        appendByte(data, ValueStringList);
+        appendUInt(data, uint(values.size()));
+        for (const QString &value : values)
+            appendUInt(data, string(value));
+        return true;
+    }
+    case DomProperty::Url:
+        appendByte(data, ValueUrl);
+        appendUInt(data, string(p->elementUrl()->elementString()->text()));
+        return true;
+    case DomProperty::Brush:
+    case DomProperty::IconSet:
+    case DomProperty::Palette:
+    case DomProperty::Pixmap:
+    case DomProperty::Unknown:
+        break;
+    }
+    return false;
+}
+
+void WriteFormData::writeSetupUi()
+{
+    const QString &formVarName = m_objects.constFirst().varName;
+    const QString parameterType = m_widgetClassName + QLatin1String(" *");
+
+    m_output << m_option.indent
+             << language::startFunctionDefinition1("setupUi", parameterType, formVarName, m_option.indent);
+
+    if (!m_factories.isEmpty()) {
+        m_output << m_indent << "static const QtUicHelpers::ObjectFactory factories[] = {\n";
+        for (const QString &className : qAsConst(m_factories)) {
+            m_output << m_dindent << "[](QWidget *parent) -> QObject * { return new "
+                     << className << "(parent); },\n";
+        }
+        m_output << m_indent << "};\n";
+    }
+    m_output << m_indent << "QObject *objects[" << m_objects.size() << "];\n";
+    if (!m_spacers.isEmpty())
+        m_output << m_indent << "QSpacerItem *spacers[" << m_spacers.size() << "];\n";
+    m_output << m_indent << "QtUicHelpers::setupUi(" << formVarName << ", qt_formData, "
+             << (m_factories.isEmpty() ? "nullptr" : "factories") << ", objects, "
+             << (m_spacers.isEmpty() ? "nullptr" : "spacers") << ");\n";
+
+    for (int i = 1, count = m_objects.size(); i < count; ++i) {
+        const Object &object = m_objects.at(i);
+        m_output << m_indent << object.varName << " = static_cast<" << object.className
+                 << " *>(objects[" << i << "]);\n";
+    }
+    for (int i = 0, count = m_spacers.size(); i < count; ++i)
+        m_output << m_indent << m_spacers.at(i) << " = spacers[" << i << "];\n";
+
+    if (m_option.autoConnection && m_connectSlotsByName)
+        m_output << "\n" << m_indent << "QMetaObject::connectSlotsByName(" << formVarName << ");\n";
+
+    m_output << m_option.indent << language::endFunctionDefinition("setupUi");
+}
+
+void WriteFormData::writeRetranslateUi()
+{
+    const QString &formVarName = m_objects.constFirst().varName;
+    const QString parameterType = m_widgetClassName + QLatin1String(" *");
+
+    m_output << m_option.indent
+             << language::startFunctionDefinition1("retranslateUi", parameterType, formVarName, m_option.indent);
+
+    if (m_translatedObjectCount == 0) {
+        // Mark formVarName as unused to avoid compiler warnings.
+        m_output << m_indent << "(void)" << formVarName << ";\n";
+    } else {
+        m_output << m_indent << "QObject *const objects[] = {";
+        int column = 80;
+        for (uint i = 0; i < m_translatedObjectCount; ++i) {
+            const QString &varName = m_objects.at(int(i)).varName;
+            if (column + varName.size() > 80) {
+                m_output << (i ? ",\n" : "\n") << m_dindent;
+                column = m_dindent.size();
+            } else {
+                m_output << ", ";
+                column += 2;
+            }
+            m_output << varName;
+            column += varName.size();
+        }
+        m_output << "\n" << m_indent << "};\n"
+                 << m_indent << "QtUicHelpers::retranslateUi(qt_formData, objects);\n";
+    }
+
+    m_output << m_option.indent << language::endFunctionDefinition("retranslateUi");
+}
+
+void WriteFormData::writeData()
+{
+    QByteArray translations;
+    appendUInt(translations, string(m_generatedClass));
+    appendByte(translations, m_driver->useIdBasedTranslations() || m_option.idBased ? 1 : 0);
+    translations += m_translationData;
+    appendByte(translations, TrEnd);
+
+    QByteArray data;
+    appendByte(data, FormDataRevision);
+    appendUInt32(data, HeaderSize + m_setupData.size());
+    appendUInt32(data, HeaderSize + m_setupData.size() + translations.size());
+    data += m_setupData;
+    data += translations;
+    data += m_strings;
+
+    m_output << "private:\n"
+             << m_option.indent << "static constexpr unsigned char qt_formData[] = {";
+    for (int i = 0, size = data.size(); i < size; ++i) {
+        if (i % 12 == 0)
+            m_output << "\n" << m_indent;
+        else
+            m_output << ' ';
+        m_output << "0x" << QString::number(uchar(data.at(i)), 16).rightJustified(2, QLatin1Char('0'));
+        if (i + 1 < size)
+            m_output << ',';
+    }
+    m_output << "\n" << m_option.indent << "};\n";
+}
+
+} // namespace CPP
+
+QT_END_NAMESPACE
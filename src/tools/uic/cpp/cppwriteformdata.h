@@ -0,0 +1,146 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the tools applications of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef CPPWRITEFORMDATA_H
+#define CPPWRITEFORMDATA_H
+
+#include "treewalker.h"
+#include <qbytearray.h>
+#include <qhash.h>
+#include <qlist.h>
+#include <qstack.h>
+#include <qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+class Driver;
+class Uic;
+class QTextStream;
+
+struct Option;
+
+namespace CPP {
+
+// Writes setupUi() and retranslateUi() as calls into QtUicHelpers, which
+// build the form from a static byte array instead of one statement per
+// widget, layout and property (--form-data).
+struct WriteFormData : public TreeWalker
+{
+    using DomPropertyMap = QHash<QString, DomProperty *>;
+
+    explicit WriteFormData(Uic *uic);
+
+    // Returns a description of the first construct of \a ui that cannot be
+    // expressed as form data, or an empty string if the form is supported.
+    static QString unsupportedFeature(const Uic *uic, const DomUI *ui);
+
+    void acceptUI(DomUI *node) override;
+    void acceptWidget(DomWidget *node) override;
+    void acceptLayout(DomLayout *node) override;
+    void acceptSpacer(DomSpacer *node) override;
+    void acceptLayoutItem(DomLayoutItem *node) override;
+    void acceptLayoutDefault(DomLayoutDefault *node) override;
+    void acceptTabStops(DomTabStops *tabStops) override;
+    void acceptConnection(DomConnection *connection) override;
+
+private:
+    enum WritePropertyFlags {
+        WritePropertyIgnoreMargin = 1,
+        WritePropertyIgnoreSpacing = 2,
+        WritePropertyZeroMargins = 4
+    };
+
+    struct Object
+    {
+        QString varName;
+        QString className;
+    };
+
+    struct Buddy
+    {
+        uint label;
+        QString buddyAttributeName;
+    };
+
+    uint createObject(const QString &varName, const QString &className, uint parent);
+    int objectIndex(const QString &varName) const;
+    uint string(const QString &s);
+
+    void writeProperties(uint object, const QString &varName, const QString &className,
+                         const QList<DomProperty *> &lst, unsigned flags = 0);
+    bool writeValue(QByteArray &data, const DomProperty *p);
+    void writeIntProperty(QByteArray &data, uint object, const char *name, int value);
+    void writeEnumProperty(QByteArray &data, uint object, const char *name, const char *keys);
+    void writeTranslation(const DomString *str, const QString &defaultString = QString());
+    void writePageAttribute(uint container, uint page, uint attribute,
+                            const DomString *str, const QString &defaultString = QString());
+    void writeStretchList(uint layout, uint kind, const QString &values);
+
+    void writeSetupUi();
+    void writeRetranslateUi();
+    void writeData();
+
+    Uic *m_uic;
+    Driver *m_driver;
+    QTextStream &m_output;
+    const Option &m_option;
+    QString m_indent;
+    QString m_dindent;
+    QString m_generatedClass;
+    QString m_widgetClassName;
+
+    bool m_stdsetdef = true;
+    bool m_connectSlotsByName = true;
+    bool m_layoutWidget = false;
+    bool m_hasDefaultMargin = false;
+    bool m_hasDefaultSpacing = false;
+    int m_defaultMargin = 0;
+    int m_defaultSpacing = 0;
+
+    QStack<DomWidget *> m_widgetChain;
+    QStack<DomLayout *> m_layoutChain;
+
+    QList<Object> m_objects;          // in creation order, starting with the form
+    QHash<QString, uint> m_objectIndexes;
+    QStringList m_factories;          // class names
+    QStringList m_spacers;            // variable names
+    QList<Buddy> m_buddies;
+    uint m_translatedObjectCount = 0; // objects needed by retranslateUi()
+
+    QByteArray m_setupData;
+    QByteArray m_delayedData;
+    QByteArray m_translationData;
+    QByteArray m_strings;
+    QHash<QByteArray, uint> m_stringOffsets;
+};
+
+} // namespace CPP
+
+QT_END_NAMESPACE
+
+#endif // CPPWRITEFORMDATA_H
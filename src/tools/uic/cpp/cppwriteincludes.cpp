@@ -116,6 +116,9 @@ void WriteIncludes::acceptUI(DomUI *node)
     if (!includeFile.isEmpty())
         m_globalIncludes.insert(includeFile);
 
+    if (m_uic->option().formData)
+        m_globalIncludes.insert(QLatin1String("QtWidgets/qtuichelpers.h"));
+
     writeHeaders(m_globalIncludes, true);
     writeHeaders(m_localIncludes, false);
 
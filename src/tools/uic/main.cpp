@@ -112,6 +112,10 @@ int runUic(int argc, char *argv[])
     fromImportsOption.setDescription(QStringLiteral("Python: generate imports relative to '.'"));
     parser.addOption(fromImportsOption);
 
+    QCommandLineOption formDataOption(QStringLiteral("form-data"));
+    formDataOption.setDescription(QStringLiteral("C++: build the form from compact data at run time."));
+    parser.addOption(formDataOption);
+
     parser.addPositionalArgument(QStringLiteral("[uifile]"), QStringLiteral("Input file (*.ui), otherwise stdin."));
 
     parser.process(app);
@@ -123,6 +127,7 @@ int runUic(int argc, char *argv[])
     driver.option().implicitIncludes = !parser.isSet(noImplicitIncludesOption);
     driver.option().idBased = parser.isSet(idBasedOption);
     driver.option().fromImports = parser.isSet(fromImportsOption);
+    driver.option().formData = parser.isSet(formDataOption);
     driver.option().postfix = parser.value(postfixOption);
     driver.option().translateFunction = parser.value(translateOption);
     driver.option().includeFile = parser.value(includeOption);
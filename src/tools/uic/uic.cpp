@@ -35,6 +35,7 @@
 
 #include "cppwriteincludes.h"
 #include "cppwritedeclaration.h"
+#include "cppwriteformdata.h"
 #include <pythonwritedeclaration.h>
 #include <pythonwriteimports.h>
 
@@ -278,6 +279,14 @@ bool Uic::write(DomUI *ui)
 
     switch (language::language()) {
     case Language::Cpp: {
+        if (opt.formData) {
+            const QString feature = CPP::WriteFormData::unsupportedFeature(this, ui);
+            if (!feature.isEmpty()) {
+                fprintf(stderr, "%s: Warning: Form data does not support %s, generating code instead.\n",
+                        qPrintable(opt.messagePrefix()), qPrintable(feature));
+                opt.formData = 0;
+            }
+        }
         CPP::WriteIncludes writeIncludes(this);
         writeIncludes.acceptUI(ui);
         Validator(this).acceptUI(ui);
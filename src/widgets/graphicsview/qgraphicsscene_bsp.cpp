@@ -42,6 +42,8 @@
 #include <QtCore/qstring.h>
 #include <private/qgraphicsitem_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 class QGraphicsSceneInsertItemBspTreeVisitor : public QGraphicsSceneBspTreeVisitor
@@ -131,14 +133,10 @@ void QGraphicsSceneBspTree::removeItem(QGraphicsItem *item, const QRectF &rect)
 void QGraphicsSceneBspTree::removeItems(const QSet<QGraphicsItem *> &items)
 {
     for (int i = 0; i < leaves.size(); ++i) {
-        QList<QGraphicsItem *> newItemList;
-        const QList<QGraphicsItem *> &oldItemList = leaves[i];
-        for (int j = 0; j < oldItemList.size(); ++j) {
-            QGraphicsItem *item = oldItemList.at(j);
-            if (!items.contains(item))
-                newItemList << item;
-        }
-        leaves[i] = newItemList;
+        QList<QGraphicsItem *> &itemList = leaves[i];
+        const auto it = std::remove_if(itemList.begin(), itemList.end(),
+                                       [&items](QGraphicsItem *item) { return items.contains(item); });
+        itemList.erase(it, itemList.end());
     }
 }
 
@@ -185,6 +185,21 @@ void QGraphicsSceneBspTreeIndexPrivate::_q_updateIndex()
 */
 void QGraphicsSceneBspTreeIndexPrivate::purgeRemovedItems()
 {
+    // Items taken out of the index, typically because they moved, are
+    // removed from the tree in one batch. Removing them one by one is
+    // cheaper while they are few; once there are more of them than leaves,
+    // a single pass over all leaves is.
+    if (!pendingBspRemovals.isEmpty()) {
+        if (pendingBspRemovals.size() > bsp.leafCount()) {
+            for (auto it = pendingBspRemovals.cbegin(), end = pendingBspRemovals.cend(); it != end; ++it)
+                removedItems.insert(it.key());
+        } else {
+            for (auto it = pendingBspRemovals.cbegin(), end = pendingBspRemovals.cend(); it != end; ++it)
+                bsp.removeItem(it.key(), it.value());
+        }
+        pendingBspRemovals.clear();
+    }
+
     if (!purgePending && removedItems.isEmpty())
         return;
 
@@ -305,7 +320,8 @@ void QGraphicsSceneBspTreeIndexPrivate::addItem(QGraphicsItem *item, bool recurs
         return;
 
     // Prevent reusing a recently deleted pointer: purge all removed item from our lists.
-    purgeRemovedItems();
+    if (purgePending || !removedItems.isEmpty())
+        purgeRemovedItems();
 
     // Invalidate any sort caching; arrival of a new item means we need to resort.
     // Update the scene's sort cache settings.
@@ -352,7 +368,8 @@ void QGraphicsSceneBspTreeIndexPrivate::removeItem(QGraphicsItem *item, bool rec
             removedItems << item;
         } else if (!(item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
                      || item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren)) {
-            bsp.removeItem(item, item->d_ptr->sceneEffectiveBoundingRect());
+            // Removed from the tree in purgeRemovedItems(), before the next query or reindexing.
+            pendingBspRemovals.insert(item, item->d_ptr->sceneEffectiveBoundingRect());
         }
     } else {
         unindexedItems.removeOne(item);
@@ -467,6 +484,7 @@ void QGraphicsSceneBspTreeIndex::clear()
 {
     Q_D(QGraphicsSceneBspTreeIndex);
     d->bsp.clear();
+    d->pendingBspRemovals.clear();
     d->lastItemCount = 0;
     d->freeItemIndexes.clear();
     for (int i = 0; i < d->indexedItems.size(); ++i) {
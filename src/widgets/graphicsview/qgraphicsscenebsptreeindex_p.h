@@ -59,6 +59,7 @@
 
 #include <QtCore/qrect.h>
 #include <QtCore/qlist.h>
+#include <QtCore/qhash.h>
 
 QT_REQUIRE_CONFIG(graphicsview);
 
@@ -128,6 +129,7 @@ public:
 
     bool purgePending;
     QSet<QGraphicsItem *> removedItems;
+    QHash<QGraphicsItem *, QRectF> pendingBspRemovals;
     void purgeRemovedItems();
 
     void _q_updateIndex();
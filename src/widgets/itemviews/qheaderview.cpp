@@ -802,7 +802,7 @@ void QHeaderView::moveSection(int from, int to)
 
     qMoveRange(d->sectionItems, from, from + 1, to);
 
-    d->sectionStartposRecalc = true;
+    d->invalidateSectionStartPos(qMin(from, to));
 
     if (d->hasAutoResizeSections())
         d->doDelayedResizeSections();
@@ -1902,7 +1902,7 @@ void QHeaderView::sectionsInserted(const QModelIndex &parent,
     }
 
     QHeaderViewPrivate::SectionItem section(d->defaultSectionSize, d->globalResizeMode);
-    d->sectionStartposRecalc = true;
+    d->invalidateSectionStartPos(qMin(insertAt, d->sectionCount()));
 
     if (d->sectionItems.isEmpty() || insertAt >= d->sectionItems.count()) {
         int insertLength = d->defaultSectionSize * insertCount;
@@ -2035,7 +2035,7 @@ void QHeaderViewPrivate::_q_sectionsRemoved(const QModelIndex &parent,
             //Q_ASSERT(headerSectionCount() == sectionCount);
             removeSectionsFromSectionItems(visual, visual);
         } else {
-            sectionStartposRecalc = true; // We will need to recalc positions after removing items
+            invalidateSectionStartPos(); // We will need to recalc positions after removing items
             for (int u = 0; u < sectionItems.count(); ++u)  // Store section info
                 sectionItems.at(u).tmpLogIdx = logicalIndices.at(u);
             for (int v = sectionItems.count() - 1; v >= 0; --v) {  // Remove the sections
@@ -2128,6 +2128,7 @@ void QHeaderViewPrivate::_q_sectionsAboutToBeChanged(const QList<QPersistentMode
             if (itemRef.size != lastSectionSize) {
                 length += lastSectionSize - itemRef.size;
                 itemRef.size = lastSectionSize;
+                invalidateSectionStartPos(visual);
             }
         }
     }
@@ -3442,16 +3443,14 @@ bool QHeaderViewPrivate::isSectionSelected(int section) const
 
 bool QHeaderViewPrivate::isFirstVisibleSection(int section) const
 {
-    if (sectionStartposRecalc)
-        recalcSectionStartPos();
+    ensureSectionStartPos(section);
     const SectionItem &item = sectionItems.at(section);
     return item.size > 0 && item.calculated_startpos == 0;
 }
 
 bool QHeaderViewPrivate::isLastVisibleSection(int section) const
 {
-    if (sectionStartposRecalc)
-        recalcSectionStartPos();
+    ensureSectionStartPos(section);
     const SectionItem &item = sectionItems.at(section);
     return item.size > 0 && item.calculatedEndPos() == length;
 }
@@ -3654,13 +3653,14 @@ void QHeaderViewPrivate::createSectionItems(int start, int end, int size, QHeade
 {
     int sizePerSection = size / (end - start + 1);
     if (end >= sectionItems.count()) {
+        invalidateSectionStartPos(sectionItems.count());
         sectionItems.resize(end + 1);
-        sectionStartposRecalc = true;
     }
     SectionItem *sectiondata = sectionItems.data();
     for (int i = start; i <= end; ++i) {
         length += (sizePerSection - sectiondata[i].size);
-        sectionStartposRecalc |= (sectiondata[i].size != sizePerSection);
+        if (sectiondata[i].size != sizePerSection)
+            invalidateSectionStartPos(i);
         sectiondata[i].size = sizePerSection;
         sectiondata[i].resizeMode = mode;
     }
@@ -3669,7 +3669,8 @@ void QHeaderViewPrivate::createSectionItems(int start, int end, int size, QHeade
 void QHeaderViewPrivate::removeSectionsFromSectionItems(int start, int end)
 {
     // remove sections
-    sectionStartposRecalc |= (end != sectionItems.count() - 1);
+    if (end != sectionItems.count() - 1)
+        invalidateSectionStartPos(start);
     int removedlength = 0;
     for (int u = start; u <= end; ++u)
         removedlength += sectionItems.at(u).size;
@@ -3843,7 +3844,7 @@ void QHeaderViewPrivate::setDefaultSectionSize(int size)
             }
         }
     }
-    sectionStartposRecalc = true;
+    invalidateSectionStartPos();
     if (hasAutoResizeSections())
         doDelayedResizeSections();
     viewport->update();
@@ -3867,7 +3868,24 @@ void QHeaderViewPrivate::recalcSectionStartPos() const // linear (but fast)
         i.calculated_startpos = pixelpos; // write into const mutable
         pixelpos += i.size;
     }
-    sectionStartposRecalc = false;
+    firstStaleSectionStartpos = sectionItems.count();
+}
+
+// Recalculates the start positions from the first stale section up to visual,
+// so that resizing sections near the end of a long header stays cheap.
+void QHeaderViewPrivate::updateSectionStartPos(int visual) const
+{
+    const int last = qMin(visual, int(sectionItems.count()) - 1);
+    int i = firstStaleSectionStartpos;
+    if (i > last)
+        return;
+    int pixelpos = (i > 0 ? sectionItems.at(i - 1).calculatedEndPos() : 0);
+    for (; i <= last; ++i) {
+        const SectionItem &section = sectionItems.at(i);
+        section.calculated_startpos = pixelpos; // write into const mutable
+        pixelpos += section.size;
+    }
+    firstStaleSectionStartpos = last + 1;
 }
 
 void QHeaderViewPrivate::resizeSectionItem(int visualIndex, int oldSize, int newSize)
@@ -3888,8 +3906,7 @@ int QHeaderViewPrivate::headerSectionSize(int visual) const
 int QHeaderViewPrivate::headerSectionPosition(int visual) const
 {
     if (visual < sectionCount() && visual >= 0) {
-        if (sectionStartposRecalc)
-            recalcSectionStartPos();
+        ensureSectionStartPos(visual);
         return sectionItems.at(visual).calculated_startpos;
     }
     return -1;
@@ -3897,8 +3914,7 @@ int QHeaderViewPrivate::headerSectionPosition(int visual) const
 
 int QHeaderViewPrivate::headerVisualIndexAt(int position) const
 {
-    if (sectionStartposRecalc)
-        recalcSectionStartPos();
+    ensureSectionStartPos(sectionItems.count() - 1);
     int startidx = 0;
     int endidx = sectionItems.count() - 1;
     while (startidx <= endidx) {
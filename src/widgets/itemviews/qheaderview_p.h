@@ -105,7 +105,7 @@ public:
           sectionIndicator(nullptr),
 #endif
           globalResizeMode(QHeaderView::Interactive),
-          sectionStartposRecalc(true),
+          firstStaleSectionStartpos(0),
           resizeContentsPrecision(1000)
     {}
 
@@ -300,7 +300,7 @@ public:
     QLabel *sectionIndicator;
 #endif
     QHeaderView::ResizeMode globalResizeMode;
-    mutable bool sectionStartposRecalc;
+    mutable int firstStaleSectionStartpos; // sections from here on need a new calculated_startpos
     int resizeContentsPrecision;
     // header sections
 
@@ -313,7 +313,7 @@ public:
         union { // This union is made in order to save space and ensure good vector performance (on remove)
             mutable int calculated_startpos; // <- this is the primary used member.
             mutable int tmpLogIdx;         // When one of these 'tmp'-members has been used we call
-            int tmpDataStreamSectionCount; // recalcSectionStartPos() or set sectionStartposRecalc to true
+            int tmpDataStreamSectionCount; // recalcSectionStartPos() or invalidateSectionStartPos()
         };                                 // to ensure that calculated_startpos will be calculated afterwards.
 
         inline SectionItem() : size(0), isHidden(0), resizeMode(QHeaderView::Interactive) {}
@@ -342,6 +342,14 @@ public:
     void setDefaultSectionSize(int size);
     void updateDefaultSectionSizeFromStyle();
     void recalcSectionStartPos() const; // not really const
+    void updateSectionStartPos(int visual) const;
+    inline void invalidateSectionStartPos(int visual = 0) const {
+        firstStaleSectionStartpos = qMin(firstStaleSectionStartpos, visual);
+    }
+    inline void ensureSectionStartPos(int visual) const {
+        if (visual >= firstStaleSectionStartpos)
+            updateSectionStartPos(visual);
+    }
 
     inline int headerLength() const { // for debugging
         int len = 0;
@@ -3348,7 +3348,7 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
         if (!afterIsUninitialized)
             insertViewItems(i + 1, count, QTreeViewItem()); // expand
         else if (count > 0)
-            viewItems.resize(viewItems.count() + count);
+            growViewItems(count);
     } else {
         expanding = false;
     }
@@ -3373,7 +3373,7 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
             item->parentItem = i;
             item->level = level;
             item->height = 0;
-            item->spanning = q->isFirstColumnSpanned(current.row(), parent);
+            item->spanning = !spanningIndexes.isEmpty() && spanningIndexes.contains(current);
             item->expanded = false;
             item->total = 0;
             item->hasMoreSiblings = false;
@@ -3409,6 +3409,24 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
     }
 }
 
+/*!
+  \internal
+
+  Appends \a count default constructed items to viewItems.
+
+  When laying out recursively, viewItems is grown once for every expanded
+  node. QList::resize() allocates exactly the requested size, which would
+  copy all items laid out so far for each of those nodes, so grow the
+  capacity geometrically instead.
+*/
+void QTreeViewPrivate::growViewItems(int count)
+{
+    const int newSize = viewItems.count() + count;
+    if (newSize > viewItems.capacity())
+        viewItems.reserve(qMax(newSize, 2 * int(viewItems.capacity())));
+    viewItems.resize(newSize);
+}
+
 int QTreeViewPrivate::pageUp(int i) const
 {
     int index = itemAtCoordinate(coordinateForItem(i) - viewport->height());
@@ -138,6 +138,7 @@ public:
     QRect intersectedRect(const QRect rect, const QModelIndex &topLeft, const QModelIndex &bottomRight) const override;
 
     void layout(int item, bool recusiveExpanding = false, bool afterIsUninitialized = false);
+    void growViewItems(int count);
 
     int pageUp(int item) const;
     int pageDown(int item) const;
@@ -218,7 +219,8 @@ public:
 
     inline bool isIndexExpanded(const QModelIndex &idx) const {
         //We first check if the idx is a QPersistentModelIndex, because creating QPersistentModelIndex is slow
-        return !(idx.flags() & Qt::ItemNeverHasChildren) && isPersistent(idx) && expandedIndexes.contains(idx);
+        return !expandedIndexes.isEmpty() && !(idx.flags() & Qt::ItemNeverHasChildren)
+                && isPersistent(idx) && expandedIndexes.contains(idx);
     }
 
     // used when hiding and showing items
@@ -28,7 +28,8 @@ HEADERS += \
         kernel/qdesktopwidget_p.h \
         kernel/qwidgetwindow_p.h \
         kernel/qwindowcontainer_p.h \
-        kernel/qtestsupport_widgets.h
+        kernel/qtestsupport_widgets.h \
+        kernel/qtuichelpers.h
 
 SOURCES += \
 	kernel/qapplication.cpp \
@@ -50,6 +51,7 @@ SOURCES += \
         kernel/qwidgetwindow.cpp \
         kernel/qwindowcontainer.cpp \
         kernel/qtestsupport_widgets.cpp \
+        kernel/qtuichelpers.cpp \
         kernel/qwidgetstatemachine.cpp
 
 macx: {
@@ -916,6 +916,8 @@ QStyle *QApplication::style()
             return nullptr;
         }
 
+        Q_TRACE_SCOPE(QApplication_style);
+
         auto &defaultStyle = QApplicationPrivate::app_style;
 
         defaultStyle = QStyleFactory::create(QApplicationPrivate::desktopStyleKey());
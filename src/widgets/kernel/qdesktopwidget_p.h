@@ -55,7 +55,7 @@
 #include "private/qwidget_p.h"
 
 #include <QtGui/qscreen.h>
-#include <QtCore/private/qflatmap_p.h>
+#include <QtCore/qflatmap.h>
 
 QT_BEGIN_NAMESPACE
 
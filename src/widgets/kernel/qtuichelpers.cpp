@@ -0,0 +1,877 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qtuichelpers.h"
+
+#include "qboxlayout.h"
+#include "qformlayout.h"
+#include "qgridlayout.h"
+#include "qlayout.h"
+#include "qlayoutitem.h"
+#include "qsizepolicy.h"
+#include "qwidget.h"
+#if QT_CONFIG(dockwidget)
+#include "qdockwidget.h"
+#endif
+#if QT_CONFIG(label)
+#include "qlabel.h"
+#endif
+#if QT_CONFIG(mainwindow)
+#include "qmainwindow.h"
+#endif
+#if QT_CONFIG(mdiarea)
+#include "qmdiarea.h"
+#endif
+#if QT_CONFIG(menubar)
+#include "qmenubar.h"
+#endif
+#if QT_CONFIG(scrollarea)
+#include "qscrollarea.h"
+#endif
+#if QT_CONFIG(splitter)
+#include "qsplitter.h"
+#endif
+#if QT_CONFIG(stackedwidget)
+#include "qstackedwidget.h"
+#endif
+#if QT_CONFIG(statusbar)
+#include "qstatusbar.h"
+#endif
+#if QT_CONFIG(tabwidget)
+#include "qtabwidget.h"
+#endif
+#if QT_CONFIG(toolbar)
+#include "qtoolbar.h"
+#endif
+
+#include <QtGui/qcolor.h>
+#if QT_CONFIG(cursor)
+#include <QtGui/qcursor.h>
+#endif
+#include <QtGui/qfont.h>
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlocale.h>
+#include <QtCore/qmetaobject.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qurl.h>
+#include <QtCore/qvariant.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \namespace QtUicHelpers
+    \inmodule QtWidgets
+    \internal
+
+    \brief Runtime support for forms compiled by uic in form data mode.
+
+    When uic is run with \c{--form-data}, the generated setupUi() does not
+    contain one statement per widget, layout and property. Instead, uic
+    writes a compact description of the form into a static byte array and
+    setupUi() hands it to QtUicHelpers::setupUi(), which creates the objects
+    through a table of factory functions and applies the properties through
+    the meta-object system. Translatable strings are kept in a separate
+    section of the same array that QtUicHelpers::retranslateUi() walks.
+
+    The data starts with a header of nine bytes: the revision
+    (QtUicHelpers::FormDataRevision), followed by the offsets of the
+    translation section and of the string pool as 32-bit little endian
+    numbers. Integers are stored as LEB128 varints, signed ones zigzag
+    encoded, and strings as varint offsets into the pool of NUL-terminated
+    UTF-8 strings, offset 0 being the empty string.
+
+    The opcodes and value types are shared with uic's
+    cppwriteformdata.cpp and must be kept in sync with it.
+*/
+
+namespace QtUicHelpers {
+
+namespace {
+
+enum : uint { HeaderSize = 9 };
+
+enum Operation : uchar {
+    OpEnd,
+    OpCreateObject,         // factory, parent + 1 (0: no parent)
+    OpCreateSpacer,         // width, height, horizontal policy, vertical policy
+    OpSetObjectName,        // object, name
+    OpSetProperty,          // object, name, flags, value
+    OpSetContentsMargins,   // object, left, top, right, bottom
+    OpResize,               // object, width, height
+    OpAddLayoutItem,        // layout, item kind, item, row, column, row span, column span, alignment
+    OpSetLayoutStretch,     // layout, stretch kind, index, value
+    OpAddPage,              // container, page kind, page
+    OpSetPageAttribute,     // container, page, attribute, text
+    OpSetBuddy,             // label, buddy
+    OpSetTabOrder,          // first, second
+    OpConnect,              // sender, signal, receiver, method
+    OpRaise,                // widget
+    OpRetranslateUi
+};
+
+enum TranslationOperation : uchar {
+    TrEnd,
+    TrProperty,             // object, name, flags, source text, comment
+    TrPageAttribute         // container, page, attribute, source text, comment
+};
+
+enum PropertyFlag : uchar {
+    DynamicProperty = 0x1,  // set through QObject::setProperty(), no setter
+    OptionalProperty = 0x2  // might be configured out of Qt, do not warn
+};
+
+enum ValueType : uchar {
+    ValueBool = 1,
+    ValueInt,
+    ValueUInt,
+    ValueLongLong,
+    ValueULongLong,
+    ValueDouble,
+    ValueFloat,
+    ValueString,
+    ValueByteArray,
+    ValueEnum,              // '|'-separated keys without scope
+    ValueRect,
+    ValueRectF,
+    ValuePoint,
+    ValuePointF,
+    ValueSize,
+    ValueSizeF,
+    ValueSizePolicy,        // policy keys, stretch factors
+    ValueFont,              // field mask, fields
+    ValueColor,             // red, green, blue, alpha
+    ValueCursor,            // shape number
+    ValueCursorShape,       // shape key
+    ValueLocale,            // language key, country key
+    ValueChar,
+    ValueDate,
+    ValueTime,
+    ValueDateTime,
+    ValueStringList,        // count, strings
+    ValueUrl
+};
+
+enum FontField : uint {
+    FontFamily = 0x1,
+    FontPointSize = 0x2,
+    FontBold = 0x4,
+    FontItalic = 0x8,
+    FontUnderline = 0x10,
+    FontWeight = 0x20,
+    FontStrikeOut = 0x40,
+    FontKerning = 0x80,
+    FontAntialiasing = 0x100,
+    FontStyleStrategy = 0x200
+};
+
+enum LayoutItemKind : uchar { ItemWidget, ItemLayout, ItemSpacer };
+
+enum LayoutStretchKind : uchar {
+    Stretch,
+    RowStretch,
+    ColumnStretch,
+    ColumnMinimumWidth,
+    RowMinimumHeight
+};
+
+enum PageKind : uchar {
+    PageCentralWidget,
+    PageMenuBar,
+    PageStatusBar,
+    PageAddWidget,
+    PageSetWidget,
+    PageAddSubWindow,
+    PageAddTab
+};
+
+enum PageAttribute : uchar { PageText, PageToolTip, PageWhatsThis };
+
+class FormDataReader
+{
+public:
+    FormDataReader(const uchar *data, uint offset)
+        : m_strings(reinterpret_cast<const char *>(data) + qFromLittleEndian<quint32>(data + 5)),
+          m_pos(data + offset)
+    {}
+
+    static uint translationsOffset(const uchar *data) { return qFromLittleEndian<quint32>(data + 1); }
+
+    uchar readByte() { return *m_pos++; }
+
+    quint64 readUInt64()
+    {
+        quint64 result = 0;
+        int shift = 0;
+        uchar byte;
+        do {
+            byte = *m_pos++;
+            result |= quint64(byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        return result;
+    }
+
+    qint64 readInt64()
+    {
+        const quint64 v = readUInt64();
+        return qint64(v >> 1) ^ -qint64(v & 1);
+    }
+
+    uint readUInt() { return uint(readUInt64()); }
+    int readInt() { return int(readInt64()); }
+
+    double readDouble()
+    {
+        const quint64 bits = qFromLittleEndian<quint64>(m_pos);
+        m_pos += sizeof(bits);
+        double result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    const char *readString() { return m_strings + readUInt(); }
+    QString readQString() { return QString::fromUtf8(readString()); }
+
+private:
+    const char *m_strings;
+    const uchar *m_pos;
+};
+
+// Property indexes by meta-object and name. Widgets are only ever
+// created in the GUI thread, so the cache is not locked.
+using PropertyIndexCache = QHash<QPair<const QMetaObject *, QByteArray>, int>;
+Q_GLOBAL_STATIC(PropertyIndexCache, propertyIndexCache)
+
+QMetaProperty findProperty(const QObject *object, const char *name)
+{
+    const QMetaObject *metaObject = object->metaObject();
+    PropertyIndexCache *cache = propertyIndexCache();
+    const auto key = qMakePair(metaObject, QByteArray::fromRawData(name, int(qstrlen(name))));
+    auto it = cache->constFind(key);
+    if (it == cache->constEnd())
+        it = cache->insert(qMakePair(metaObject, QByteArray(name)), metaObject->indexOfProperty(name));
+    return it.value() >= 0 ? metaObject->property(it.value()) : QMetaProperty();
+}
+
+template <typename Enum>
+int enumValue(const char *keys)
+{
+    return QMetaEnum::fromType<Enum>().keysToValue(keys);
+}
+
+QVariant enumVariant(const QMetaProperty &property, const char *keys)
+{
+    if (!property.isEnumType()) {
+        qWarning("QtUicHelpers::setupUi: Property '%s' is not an enumeration, cannot set '%s'",
+                 property.isValid() ? property.name() : "", keys);
+        return QVariant();
+    }
+    const QMetaEnum metaEnum = property.enumerator();
+    bool ok;
+    int value = metaEnum.isFlag() ? metaEnum.keysToValue(keys, &ok)
+                                  : metaEnum.keyToValue(keys, &ok);
+    if (!ok) {
+        qWarning("QtUicHelpers::setupUi: '%s' is not a value of %s::%s", keys,
+                 metaEnum.scope(), metaEnum.name());
+        return QVariant();
+    }
+    const QMetaType type = property.metaType();
+    return type.sizeOf() == int(sizeof(int)) ? QVariant(type, &value) : QVariant(value);
+}
+
+QSizePolicy::Policy sizePolicyValue(const char *key)
+{
+    return QSizePolicy::Policy(enumValue<QSizePolicy::Policy>(key));
+}
+
+QVariant readValue(FormDataReader &reader, QObject *object, const QMetaProperty &property)
+{
+    switch (reader.readByte()) {
+    case ValueBool:
+        return QVariant(reader.readByte() != 0);
+    case ValueInt:
+        return QVariant(reader.readInt());
+    case ValueUInt:
+        return QVariant(reader.readUInt());
+    case ValueLongLong:
+        return QVariant(reader.readInt64());
+    case ValueULongLong:
+        return QVariant(reader.readUInt64());
+    case ValueDouble:
+        return QVariant(reader.readDouble());
+    case ValueFloat:
+        return QVariant(float(reader.readDouble()));
+    case ValueString:
+        return QVariant(reader.readQString());
+    case ValueByteArray:
+        return QVariant(QByteArray(reader.readString()));
+    case ValueEnum:
+        return enumVariant(property, reader.readString());
+    case ValueRect: {
+        const int x = reader.readInt();
+        const int y = reader.readInt();
+        const int w = reader.readInt();
+        const int h = reader.readInt();
+        return QVariant(QRect(x, y, w, h));
+    }
+    case ValueRectF: {
+        const double x = reader.readDouble();
+        const double y = reader.readDouble();
+        const double w = reader.readDouble();
+        const double h = reader.readDouble();
+        return QVariant(QRectF(x, y, w, h));
+    }
+    case ValuePoint: {
+        const int x = reader.readInt();
+        return QVariant(QPoint(x, reader.readInt()));
+    }
+    case ValuePointF: {
+        const double x = reader.readDouble();
+        return QVariant(QPointF(x, reader.readDouble()));
+    }
+    case ValueSize: {
+        const int w = reader.readInt();
+        return QVariant(QSize(w, reader.readInt()));
+    }
+    case ValueSizeF: {
+        const double w = reader.readDouble();
+        return QVariant(QSizeF(w, reader.readDouble()));
+    }
+    case ValueSizePolicy: {
+        const QSizePolicy::Policy horizontal = sizePolicyValue(reader.readString());
+        QSizePolicy sizePolicy(horizontal, sizePolicyValue(reader.readString()));
+        sizePolicy.setHorizontalStretch(reader.readInt());
+        sizePolicy.setVerticalStretch(reader.readInt());
+        if (object->isWidgetType())
+            sizePolicy.setHeightForWidth(static_cast<QWidget *>(object)->sizePolicy().hasHeightForWidth());
+        return QVariant::fromValue(sizePolicy);
+    }
+    case ValueFont: {
+        QFont font;
+        const uint fields = reader.readUInt();
+        if (fields & FontFamily)
+            font.setFamily(reader.readQString());
+        if (fields & FontPointSize)
+            font.setPointSize(reader.readInt());
+        if (fields & FontBold)
+            font.setBold(reader.readByte());
+        if (fields & FontItalic)
+            font.setItalic(reader.readByte());
+        if (fields & FontUnderline)
+            font.setUnderline(reader.readByte());
+        if (fields & FontWeight)
+            font.setWeight(reader.readInt());
+        if (fields & FontStrikeOut)
+            font.setStrikeOut(reader.readByte());
+        if (fields & FontKerning)
+            font.setKerning(reader.readByte());
+        if (fields & FontAntialiasing)
+            font.setStyleStrategy(reader.readByte() ? QFont::PreferDefault : QFont::NoAntialias);
+        if (fields & FontStyleStrategy)
+            font.setStyleStrategy(QFont::StyleStrategy(enumValue<QFont::StyleStrategy>(reader.readString())));
+        return QVariant::fromValue(font);
+    }
+    case ValueColor: {
+        const int r = reader.readByte();
+        const int g = reader.readByte();
+        const int b = reader.readByte();
+        return QVariant::fromValue(QColor(r, g, b, reader.readByte()));
+    }
+    case ValueCursor: {
+        const int shape = reader.readInt();
+#if QT_CONFIG(cursor)
+        return QVariant::fromValue(QCursor(Qt::CursorShape(shape)));
+#else
+        Q_UNUSED(shape);
+        return QVariant();
+#endif
+    }
+    case ValueCursorShape: {
+        const char *shape = reader.readString();
+#if QT_CONFIG(cursor)
+        return QVariant::fromValue(QCursor(Qt::CursorShape(enumValue<Qt::CursorShape>(shape))));
+#else
+        Q_UNUSED(shape);
+        return QVariant();
+#endif
+    }
+    case ValueLocale: {
+        const auto language = QLocale::Language(enumValue<QLocale::Language>(reader.readString()));
+        const auto country = QLocale::Country(enumValue<QLocale::Country>(reader.readString()));
+        return QVariant(QLocale(language, country));
+    }
+    case ValueChar:
+        return QVariant(QChar(char16_t(reader.readUInt())));
+    case ValueDate: {
+        const int year = reader.readInt();
+        const int month = reader.readInt();
+        return QVariant(QDate(year, month, reader.readInt()));
+    }
+    case ValueTime: {
+        const int hour = reader.readInt();
+        const int minute = reader.readInt();
+        return QVariant(QTime(hour, minute, reader.readInt()));
+    }
+    case ValueDateTime: {
+        const int year = reader.readInt();
+        const int month = reader.readInt();
+        const int day = reader.readInt();
+        const int hour = reader.readInt();
+        const int minute = reader.readInt();
+        const int second = reader.readInt();
+        return QVariant(QDateTime(QDate(year, month, day), QTime(hour, minute, second)));
+    }
+    case ValueStringList: {
+        QStringList list;
+        const uint count = reader.readUInt();
+        list.reserve(count);
+        for (uint i = 0; i < count; ++i)
+            list.append(reader.readQString());
+        return QVariant(list);
+    }
+    case ValueUrl:
+        return QVariant(QUrl(reader.readQString()));
+    }
+    Q_UNREACHABLE();
+    return QVariant();
+}
+
+void writeProperty(const char *function, QObject *object, const char *name, uint flags,
+                   const QMetaProperty &property, const QVariant &value)
+{
+    if (property.isValid()) {
+        if (value.isValid() && !property.write(object, value)) {
+            qWarning("QtUicHelpers::%s: Could not set property '%s' of %s", function, name,
+                     object->metaObject()->className());
+        }
+    } else if (flags & DynamicProperty) {
+        object->setProperty(name, value);
+    } else if (!(flags & OptionalProperty)) {
+        qWarning("QtUicHelpers::%s: %s has no property named '%s'", function,
+                 object->metaObject()->className(), name);
+    }
+}
+
+QWidget *widgetAt(QObject *const *objects, uint index)
+{
+    Q_ASSERT(objects[index]->isWidgetType());
+    return static_cast<QWidget *>(objects[index]);
+}
+
+QLayout *layoutAt(QObject *const *objects, uint index)
+{
+    Q_ASSERT(qobject_cast<QLayout *>(objects[index]));
+    return static_cast<QLayout *>(objects[index]);
+}
+
+void addLayoutItem(FormDataReader &reader, QObject *const *objects, QSpacerItem *const *spacers)
+{
+    QLayout *layout = layoutAt(objects, reader.readUInt());
+    const uchar kind = reader.readByte();
+    const uint index = reader.readUInt();
+    const int row = reader.readInt();
+    const int column = reader.readInt();
+    const int rowSpan = reader.readInt();
+    const int columnSpan = reader.readInt();
+    const char *alignmentKeys = reader.readString();
+    const Qt::Alignment alignment(QFlag(*alignmentKeys ? enumValue<Qt::Alignment>(alignmentKeys) : 0));
+
+    QWidget *widget = kind == ItemWidget ? widgetAt(objects, index) : nullptr;
+    QLayout *childLayout = kind == ItemLayout ? layoutAt(objects, index) : nullptr;
+    QSpacerItem *spacer = kind == ItemSpacer ? spacers[index] : nullptr;
+
+    if (QGridLayout *grid = qobject_cast<QGridLayout *>(layout)) {
+        if (widget)
+            grid->addWidget(widget, row, column, rowSpan, columnSpan, alignment);
+        else if (childLayout)
+            grid->addLayout(childLayout, row, column, rowSpan, columnSpan, alignment);
+        else
+            grid->addItem(spacer, row, column, rowSpan, columnSpan, alignment);
+    } else if (QFormLayout *form = qobject_cast<QFormLayout *>(layout)) {
+        const QFormLayout::ItemRole role = columnSpan > 1 ? QFormLayout::SpanningRole
+            : column == 0 ? QFormLayout::LabelRole : QFormLayout::FieldRole;
+        if (widget)
+            form->setWidget(row, role, widget);
+        else if (childLayout)
+            form->setLayout(row, role, childLayout);
+        else
+            form->setItem(row, role, spacer);
+    } else if (QBoxLayout *box = qobject_cast<QBoxLayout *>(layout)) {
+        if (widget)
+            box->addWidget(widget, 0, alignment);
+        else if (childLayout)
+            box->addLayout(childLayout);
+        else
+            box->addItem(spacer);
+    } else {
+        if (widget)
+            layout->addWidget(widget);
+        else if (childLayout)
+            layout->addItem(childLayout);
+        else
+            layout->addItem(spacer);
+    }
+}
+
+void setLayoutStretch(FormDataReader &reader, QObject *const *objects)
+{
+    QLayout *layout = layoutAt(objects, reader.readUInt());
+    const uchar kind = reader.readByte();
+    const int index = reader.readInt();
+    const int value = reader.readInt();
+    if (kind == Stretch) {
+        if (QBoxLayout *box = qobject_cast<QBoxLayout *>(layout))
+            box->setStretch(index, value);
+    } else if (QGridLayout *grid = qobject_cast<QGridLayout *>(layout)) {
+        switch (kind) {
+        case RowStretch:
+            grid->setRowStretch(index, value);
+            break;
+        case ColumnStretch:
+            grid->setColumnStretch(index, value);
+            break;
+        case ColumnMinimumWidth:
+            grid->setColumnMinimumWidth(index, value);
+            break;
+        case RowMinimumHeight:
+            grid->setRowMinimumHeight(index, value);
+            break;
+        }
+    }
+}
+
+void addPage(QWidget *container, uchar kind, QWidget *page)
+{
+    switch (kind) {
+#if QT_CONFIG(mainwindow)
+    case PageCentralWidget:
+        if (QMainWindow *mainWindow = qobject_cast<QMainWindow *>(container))
+            mainWindow->setCentralWidget(page);
+        return;
+#if QT_CONFIG(menubar)
+    case PageMenuBar:
+        if (QMainWindow *mainWindow = qobject_cast<QMainWindow *>(container))
+            mainWindow->setMenuBar(static_cast<QMenuBar *>(page));
+        return;
+#endif
+#if QT_CONFIG(statusbar)
+    case PageStatusBar:
+        if (QMainWindow *mainWindow = qobject_cast<QMainWindow *>(container))
+            mainWindow->setStatusBar(static_cast<QStatusBar *>(page));
+        return;
+#endif
+#endif // QT_CONFIG(mainwindow)
+    case PageAddWidget:
+#if QT_CONFIG(stackedwidget)
+        if (QStackedWidget *stackedWidget = qobject_cast<QStackedWidget *>(container)) {
+            stackedWidget->addWidget(page);
+            return;
+        }
+#endif
+#if QT_CONFIG(toolbar)
+        if (QToolBar *toolBar = qobject_cast<QToolBar *>(container)) {
+            toolBar->addWidget(page);
+            return;
+        }
+#endif
+#if QT_CONFIG(splitter)
+        if (QSplitter *splitter = qobject_cast<QSplitter *>(container)) {
+            splitter->addWidget(page);
+            return;
+        }
+#endif
+        break;
+    case PageSetWidget:
+#if QT_CONFIG(dockwidget)
+        if (QDockWidget *dockWidget = qobject_cast<QDockWidget *>(container)) {
+            dockWidget->setWidget(page);
+            return;
+        }
+#endif
+#if QT_CONFIG(scrollarea)
+        if (QScrollArea *scrollArea = qobject_cast<QScrollArea *>(container)) {
+            scrollArea->setWidget(page);
+            return;
+        }
+#endif
+        break;
+#if QT_CONFIG(mdiarea)
+    case PageAddSubWindow:
+        if (QMdiArea *mdiArea = qobject_cast<QMdiArea *>(container))
+            mdiArea->addSubWindow(page);
+        return;
+#endif
+#if QT_CONFIG(tabwidget)
+    case PageAddTab:
+        if (QTabWidget *tabWidget = qobject_cast<QTabWidget *>(container))
+            tabWidget->addTab(page, QString());
+        return;
+#endif
+    default:
+        break;
+    }
+    qWarning("QtUicHelpers::setupUi: Cannot add page %s to %s", qPrintable(page->objectName()),
+             container->metaObject()->className());
+}
+
+void setPageAttribute(QWidget *container, QWidget *page, uchar attribute, const QString &text)
+{
+#if QT_CONFIG(tabwidget)
+    if (QTabWidget *tabWidget = qobject_cast<QTabWidget *>(container)) {
+        const int index = tabWidget->indexOf(page);
+        switch (attribute) {
+        case PageText:
+            tabWidget->setTabText(index, text);
+            break;
+#if QT_CONFIG(tooltip)
+        case PageToolTip:
+            tabWidget->setTabToolTip(index, text);
+            break;
+#endif
+#if QT_CONFIG(whatsthis)
+        case PageWhatsThis:
+            tabWidget->setTabWhatsThis(index, text);
+            break;
+#endif
+        }
+    }
+#else
+    Q_UNUSED(container);
+    Q_UNUSED(page);
+    Q_UNUSED(attribute);
+    Q_UNUSED(text);
+#endif
+}
+
+} // unnamed namespace
+
+/*!
+    \internal
+
+    Builds the form described by \a data on \a form. The objects are created
+    by calling \a factories and are stored in \a objects, starting with \a form
+    at index 0, and the spacer items in \a spacers, in the order in which uic
+    declared them. Like the setupUi() of regular generated code, this calls
+    retranslateUi() before the signals and slots are connected.
+*/
+void setupUi(QWidget *form, const uchar *data, const ObjectFactory *factories,
+             QObject **objects, QSpacerItem **spacers)
+{
+    if (data[0] != FormDataRevision) {
+        qWarning("QtUicHelpers::setupUi: Form data revision %d is not supported (expected %d)",
+                 data[0], int(FormDataRevision));
+        return;
+    }
+
+    FormDataReader reader(data, HeaderSize);
+    uint objectCount = 0;
+    uint spacerCount = 0;
+    objects[objectCount++] = form;
+
+    for (;;) {
+        switch (reader.readByte()) {
+        case OpEnd:
+            return;
+        case OpCreateObject: {
+            const ObjectFactory factory = factories[reader.readUInt()];
+            const uint parent = reader.readUInt();
+            objects[objectCount++] = factory(parent ? widgetAt(objects, parent - 1) : nullptr);
+            break;
+        }
+        case OpCreateSpacer: {
+            const int width = reader.readInt();
+            const int height = reader.readInt();
+            const QSizePolicy::Policy horizontal = sizePolicyValue(reader.readString());
+            const QSizePolicy::Policy vertical = sizePolicyValue(reader.readString());
+            spacers[spacerCount++] = new QSpacerItem(width, height, horizontal, vertical);
+            break;
+        }
+        case OpSetObjectName: {
+            const uint index = reader.readUInt();
+            const char *name = reader.readString();
+            // The form keeps a name given to it before setupUi()
+            if (index != 0 || objects[index]->objectName().isEmpty())
+                objects[index]->setObjectName(QString::fromUtf8(name));
+            break;
+        }
+        case OpSetProperty: {
+            QObject *object = objects[reader.readUInt()];
+            const char *name = reader.readString();
+            const uint flags = reader.readByte();
+            const QMetaProperty property = flags & DynamicProperty
+                ? QMetaProperty() : findProperty(object, name);
+            const QVariant value = readValue(reader, object, property);
+            writeProperty("setupUi", object, name, flags, property, value);
+            break;
+        }
+        case OpSetContentsMargins: {
+            QObject *object = objects[reader.readUInt()];
+            const int left = reader.readInt();
+            const int top = reader.readInt();
+            const int right = reader.readInt();
+            const int bottom = reader.readInt();
+            if (object->isWidgetType())
+                static_cast<QWidget *>(object)->setContentsMargins(left, top, right, bottom);
+            else if (QLayout *layout = qobject_cast<QLayout *>(object))
+                layout->setContentsMargins(left, top, right, bottom);
+            break;
+        }
+        case OpResize: {
+            QWidget *widget = widgetAt(objects, reader.readUInt());
+            const int width = reader.readInt();
+            widget->resize(width, reader.readInt());
+            break;
+        }
+        case OpAddLayoutItem:
+            addLayoutItem(reader, objects, spacers);
+            break;
+        case OpSetLayoutStretch:
+            setLayoutStretch(reader, objects);
+            break;
+        case OpAddPage: {
+            QWidget *container = widgetAt(objects, reader.readUInt());
+            const uchar kind = reader.readByte();
+            addPage(container, kind, widgetAt(objects, reader.readUInt()));
+            break;
+        }
+        case OpSetPageAttribute: {
+            QWidget *container = widgetAt(objects, reader.readUInt());
+            QWidget *page = widgetAt(objects, reader.readUInt());
+            const uchar attribute = reader.readByte();
+            setPageAttribute(container, page, attribute, reader.readQString());
+            break;
+        }
+        case OpSetBuddy: {
+            QWidget *label = widgetAt(objects, reader.readUInt());
+            QWidget *buddy = widgetAt(objects, reader.readUInt());
+#if QT_CONFIG(label) && QT_CONFIG(shortcut)
+            if (QLabel *l = qobject_cast<QLabel *>(label))
+                l->setBuddy(buddy);
+#else
+            Q_UNUSED(label);
+            Q_UNUSED(buddy);
+#endif
+            break;
+        }
+        case OpSetTabOrder: {
+            QWidget *first = widgetAt(objects, reader.readUInt());
+            QWidget::setTabOrder(first, widgetAt(objects, reader.readUInt()));
+            break;
+        }
+        case OpConnect: {
+            QObject *sender = objects[reader.readUInt()];
+            const char *signal = reader.readString();
+            QObject *receiver = objects[reader.readUInt()];
+            QObject::connect(sender, signal, receiver, reader.readString());
+            break;
+        }
+        case OpRaise:
+            widgetAt(objects, reader.readUInt())->raise();
+            break;
+        case OpRetranslateUi:
+            retranslateUi(data, objects);
+            break;
+        default:
+            Q_UNREACHABLE();
+            return;
+        }
+    }
+}
+
+/*!
+    \internal
+
+    Sets the translatable strings described by \a data on \a objects, which
+    must be laid out as setupUi() created them.
+*/
+void retranslateUi(const uchar *data, QObject *const *objects)
+{
+    if (data[0] != FormDataRevision)
+        return;
+
+    FormDataReader reader(data, FormDataReader::translationsOffset(data));
+    const char *context = reader.readString();
+    const bool idBased = reader.readByte();
+    const auto translate = [&]() {
+        const char *sourceText = reader.readString();
+        const char *comment = reader.readString();
+        if (!*sourceText)
+            return QString();
+        if (idBased)
+            return qtTrId(sourceText);
+        return QCoreApplication::translate(context, sourceText, *comment ? comment : nullptr);
+    };
+
+    for (;;) {
+        switch (reader.readByte()) {
+        case TrEnd:
+            return;
+        case TrProperty: {
+            QObject *object = objects[reader.readUInt()];
+            const char *name = reader.readString();
+            const uint flags = reader.readByte();
+            const QMetaProperty property = flags & DynamicProperty
+                ? QMetaProperty() : findProperty(object, name);
+            writeProperty("retranslateUi", object, name, flags, property, QVariant(translate()));
+            break;
+        }
+        case TrPageAttribute: {
+            QWidget *container = widgetAt(objects, reader.readUInt());
+            QWidget *page = widgetAt(objects, reader.readUInt());
+            const uchar attribute = reader.readByte();
+            setPageAttribute(container, page, attribute, translate());
+            break;
+        }
+        default:
+            Q_UNREACHABLE();
+            return;
+        }
+    }
+}
+
+} // namespace QtUicHelpers
+
+QT_END_NAMESPACE
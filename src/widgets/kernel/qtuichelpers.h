@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QTUICHELPERS_H
+#define QTUICHELPERS_H
+
+#include <QtWidgets/qtwidgetsglobal.h>
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists for the convenience
+// of the code uic generates in --form-data mode. This header file may
+// change from version to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+QT_BEGIN_NAMESPACE
+
+class QObject;
+class QSpacerItem;
+class QWidget;
+
+namespace QtUicHelpers {
+
+// Revision of the form data written by uic, stored in the first byte of the data.
+// If the format changes, you MUST change it in uic's cppwriteformdata.cpp too.
+enum { FormDataRevision = 1 };
+
+using ObjectFactory = QObject *(*)(QWidget *parent);
+
+Q_WIDGETS_EXPORT void setupUi(QWidget *form, const unsigned char *data,
+                              const ObjectFactory *factories,
+                              QObject **objects, QSpacerItem **spacers);
+Q_WIDGETS_EXPORT void retranslateUi(const unsigned char *data, QObject *const *objects);
+
+} // namespace QtUicHelpers
+
+QT_END_NAMESPACE
+
+#endif // QTUICHELPERS_H
@@ -115,6 +115,8 @@
 
 #include <private/qmemory_p.h>
 
+#include <qtwidgets_tracepoints_p.h>
+
 // widget/widget data creation count
 //#define QWIDGET_EXTRA_DEBUG
 //#define ALIEN_DEBUG
@@ -5297,6 +5299,7 @@ void QWidgetPrivate::drawWidget(QPaintDevice *pdev, const QRegion &rgn, const QP
 
     qCInfo(lcWidgetPainting) << "Drawing" << rgn << "of" << q << "at" << offset
         << "into paint device" << pdev << "with" << flags;
+    Q_TRACE_SCOPE(QWidgetPrivate_drawWidget, q, rgn.boundingRect(), int(flags));
 
     const bool asRoot = flags & DrawAsRoot;
     bool onScreen = shouldPaintOnScreen();
@@ -65,6 +65,8 @@
 
 #include <private/qmemory_p.h>
 
+#include <qtwidgets_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
 #ifndef QT_NO_OPENGL
@@ -807,6 +809,7 @@ void QWidgetRepaintManager::paintAndFlush()
 {
     qCInfo(lcWidgetPainting) << "Painting and flushing dirty"
         << "top level" << dirty << "and dirty widgets" << dirtyWidgets;
+    Q_TRACE_SCOPE(QWidgetRepaintManager_paintAndFlush, tlw);
 
     const bool updatesDisabled = !tlw->updatesEnabled();
     bool repaintAllWidgets = false;
@@ -164,6 +164,9 @@
 #endif
 #include "QtCore/qdir.h"
 
+#include <algorithm>
+#include <numeric>
+
 QT_BEGIN_NAMESPACE
 
 QCompletionModel::QCompletionModel(QCompleterPrivate *c, QObject *parent)
@@ -193,11 +196,11 @@ void QCompletionModel::setSourceModel(QAbstractItemModel *source)
         connect(source, SIGNAL(modelReset()), this, SLOT(invalidate()));
         connect(source, SIGNAL(destroyed()), this, SLOT(modelDestroyed()));
         connect(source, SIGNAL(layoutChanged()), this, SLOT(invalidate()));
-        connect(source, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(rowsInserted()));
+        connect(source, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(sourceRowsInserted(QModelIndex,int,int)));
         connect(source, SIGNAL(rowsRemoved(QModelIndex,int,int)), this, SLOT(invalidate()));
         connect(source, SIGNAL(columnsInserted(QModelIndex,int,int)), this, SLOT(invalidate()));
         connect(source, SIGNAL(columnsRemoved(QModelIndex,int,int)), this, SLOT(invalidate()));
-        connect(source, SIGNAL(dataChanged(QModelIndex,QModelIndex)), this, SLOT(invalidate()));
+        connect(source, SIGNAL(dataChanged(QModelIndex,QModelIndex)), this, SLOT(sourceDataChanged(QModelIndex,QModelIndex)));
     }
 
     invalidate();
@@ -405,15 +408,22 @@ void QCompletionModel::modelDestroyed()
     invalidate();
 }
 
-void QCompletionModel::rowsInserted()
+void QCompletionModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
 {
-    invalidate();
+    engine->rowsInserted(parent, first, last);
+    filter(engine->curParts);
     emit rowsAdded();
 }
 
+void QCompletionModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    engine->dataChanged(topLeft, bottomRight);
+    filter(engine->curParts);
+}
+
 void QCompletionModel::invalidate()
 {
-    engine->cache.clear();
+    engine->invalidate();
     filter(engine->curParts);
 }
 
@@ -716,21 +726,155 @@ QMatchData QSortedModelEngine::filter(const QString& part, const QModelIndex& pa
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
-int QUnsortedModelEngine::buildIndices(const QString& str, const QModelIndex& parent, int n,
+qsizetype QUnsortedModelEngine::findSnapshot(const QModelIndex &parent) const
+{
+    for (qsizetype i = 0; i < snapshots.size(); ++i) {
+        if (snapshots.at(i).parent == parent)
+            return i;
+    }
+    return -1;
+}
+
+QUnsortedModelEngine::Snapshot *QUnsortedModelEngine::snapshot(const QModelIndex &parent)
+{
+    const qsizetype i = findSnapshot(parent);
+    if (i != -1)
+        return &snapshots[i];
+
+    const int rowCount = c->proxy->sourceModel()->rowCount(parent);
+    snapshots.append(Snapshot());
+    Snapshot *s = &snapshots.last();
+    s->parent = parent;
+    s->text.resize(rowCount);
+    s->keys.resize(rowCount);
+    s->selectable.resize(rowCount);
+    readRows(s, 0, rowCount - 1);
+
+    QList<int> rows(rowCount);
+    std::iota(rows.begin(), rows.end(), 0);
+    mergeOrder(s, std::move(rows));
+    return s;
+}
+
+void QUnsortedModelEngine::readRows(Snapshot *s, int first, int last)
+{
+    const QAbstractItemModel *model = c->proxy->sourceModel();
+    const QModelIndex parent = s->parent;
+    for (int row = first; row <= last; ++row) {
+        const QModelIndex idx = model->index(row, c->column, parent);
+        s->selectable[row] = model->flags(idx) & Qt::ItemIsSelectable;
+        s->text[row] = model->data(idx, c->role).toString();
+        s->keys[row] = c->cs == Qt::CaseInsensitive ? s->text.at(row).toCaseFolded()
+                                                    : s->text.at(row);
+    }
+}
+
+// Merges rows, which must not be in the order yet, into the sorted order
+void QUnsortedModelEngine::mergeOrder(Snapshot *s, QList<int> rows)
+{
+    if (c->filterMode != Qt::MatchStartsWith)
+        return;
+    const auto byKey = [s](int a, int b) { return s->keys.at(a) < s->keys.at(b); };
+    std::sort(rows.begin(), rows.end(), byKey);
+    QList<int> merged(s->order.size() + rows.size());
+    std::merge(s->order.cbegin(), s->order.cend(), rows.cbegin(), rows.cend(),
+               merged.begin(), byKey);
+    s->order = std::move(merged);
+}
+
+// Returns all the rows starting with part, using the sorted order
+QMatchData QUnsortedModelEngine::prefixMatch(const Snapshot &s, const QString &part) const
+{
+    const QString key = c->cs == Qt::CaseInsensitive ? part.toCaseFolded() : part;
+    auto it = std::lower_bound(s.order.cbegin(), s.order.cend(), key,
+                               [&s](int row, const QString &key) { return s.keys.at(row) < key; });
+    QList<int> rows;
+    for (; it != s.order.cend() && s.keys.at(*it).startsWith(key); ++it) {
+        if (s.selectable.at(*it))
+            rows.append(*it);
+    }
+    std::sort(rows.begin(), rows.end());
+
+    int exactMatchIndex = -1;
+    for (int row : qAsConst(rows)) {
+        if (QString::compare(s.text.at(row), part, c->cs) == 0) {
+            exactMatchIndex = row;
+            break;
+        }
+    }
+    return QMatchData(QIndexMapper(rows), exactMatchIndex, false);
+}
+
+void QUnsortedModelEngine::invalidate()
+{
+    QCompletionEngine::invalidate();
+    snapshots.clear();
+}
+
+void QUnsortedModelEngine::rowsInserted(const QModelIndex &parent, int first, int last)
+{
+    QCompletionEngine::rowsInserted(parent, first, last);
+    const qsizetype i = findSnapshot(parent);
+    if (i == -1)
+        return;
+
+    Snapshot *s = &snapshots[i];
+    const int count = last - first + 1;
+    if (s->text.size() + count != c->proxy->sourceModel()->rowCount(parent)) {
+        snapshots.removeAt(i); // out of sync, rebuild on the next filter
+        return;
+    }
+
+    for (int &row : s->order) {
+        if (row >= first)
+            row += count;
+    }
+    s->text.insert(first, count, QString());
+    s->keys.insert(first, count, QString());
+    s->selectable.insert(first, count, false);
+    readRows(s, first, last);
+
+    QList<int> rows(count);
+    std::iota(rows.begin(), rows.end(), first);
+    mergeOrder(s, std::move(rows));
+}
+
+void QUnsortedModelEngine::dataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    QCompletionEngine::dataChanged(topLeft, bottomRight);
+    if (c->column < topLeft.column() || c->column > bottomRight.column())
+        return;
+    const qsizetype i = findSnapshot(topLeft.parent());
+    if (i == -1)
+        return;
+
+    Snapshot *s = &snapshots[i];
+    const int first = topLeft.row();
+    const int last = qMin(bottomRight.row(), int(s->text.size()) - 1);
+    if (first > last)
+        return;
+    readRows(s, first, last);
+
+    const auto changed = [first, last](int row) { return row >= first && row <= last; };
+    s->order.erase(std::remove_if(s->order.begin(), s->order.end(), changed), s->order.end());
+    QList<int> rows(last - first + 1);
+    std::iota(rows.begin(), rows.end(), first);
+    mergeOrder(s, std::move(rows));
+}
+
+int QUnsortedModelEngine::buildIndices(const QString& str, const Snapshot &s, int n,
                                       const QIndexMapper& indices, QMatchData* m)
 {
     Q_ASSERT(m->partial);
     Q_ASSERT(n != -1 || m->exactMatchIndex == -1);
-    const QAbstractItemModel *model = c->proxy->sourceModel();
     int i, count = 0;
 
     for (i = 0; i < indices.count() && count != n; ++i) {
-        QModelIndex idx = model->index(indices[i], c->column, parent);
-
-        if (!(model->flags(idx) & Qt::ItemIsSelectable))
+        const int row = indices[i];
+        if (!s.selectable.at(row))
             continue;
 
-        QString data = model->data(idx, c->role).toString();
+        const QString &data = s.text.at(row);
 
         switch (c->filterMode) {
         case Qt::MatchStartsWith:
@@ -755,12 +899,12 @@ int QUnsortedModelEngine::buildIndices(const QString& str, const QModelIndex& pa
             Q_UNREACHABLE();
             break;
         }
-        m->indices.append(indices[i]);
+        m->indices.append(row);
         ++count;
         if (m->exactMatchIndex == -1 && QString::compare(data, str, c->cs) == 0) {
-            m->exactMatchIndex = indices[i];
+            m->exactMatchIndex = row;
             if (n == -1)
-                return indices[i];
+                return row;
         }
     }
     return indices[i-1];
@@ -772,10 +916,10 @@ void QUnsortedModelEngine::filterOnDemand(int n)
     if (!curMatch.partial)
         return;
     Q_ASSERT(n >= -1);
-    const QAbstractItemModel *model = c->proxy->sourceModel();
-    int lastRow = model->rowCount(curParent) - 1;
+    const Snapshot &s = *snapshot(curParent);
+    int lastRow = s.text.size() - 1;
     QIndexMapper im(curMatch.indices.last() + 1, lastRow);
-    int lastIndex = buildIndices(curParts.constLast(), curParent, n, im, &curMatch);
+    int lastIndex = buildIndices(curParts.constLast(), s, n, im, &curMatch);
     curMatch.partial = (lastRow != lastIndex);
     saveInCache(curParts.constLast(), curParent, curMatch);
 }
@@ -788,30 +932,36 @@ QMatchData QUnsortedModelEngine::filter(const QString& part, const QModelIndex&
     QIndexMapper im(v);
     QMatchData m(im, -1, true);
 
-    const QAbstractItemModel *model = c->proxy->sourceModel();
+    const Snapshot &s = *snapshot(parent);
     bool foundInCache = lookupCache(part, parent, &m);
 
+    if (!foundInCache && c->filterMode == Qt::MatchStartsWith) {
+        m = prefixMatch(s, part);
+        saveInCache(part, parent, m);
+        return m;
+    }
+
     if (!foundInCache) {
         if (matchHint(part, parent, &hint) && !hint.isValid())
             return QMatchData();
     }
 
     if (!foundInCache && !hint.isValid()) {
-        const int lastRow = model->rowCount(parent) - 1;
+        const int lastRow = s.text.size() - 1;
         QIndexMapper all(0, lastRow);
-        int lastIndex = buildIndices(part, parent, n, all, &m);
+        int lastIndex = buildIndices(part, s, n, all, &m);
         m.partial = (lastIndex != lastRow);
     } else {
         if (!foundInCache) { // build from hint as much as we can
-            buildIndices(part, parent, INT_MAX, hint.indices, &m);
+            buildIndices(part, s, INT_MAX, hint.indices, &m);
             m.partial = hint.partial;
         }
         if (m.partial && ((n == -1 && m.exactMatchIndex == -1) || (m.indices.count() < n))) {
             // need more and have more
-            const int lastRow = model->rowCount(parent) - 1;
+            const int lastRow = s.text.size() - 1;
             QIndexMapper rest(hint.indices.last() + 1, lastRow);
             int want = n == -1 ? -1 : n - m.indices.count();
-            int lastIndex = buildIndices(part, parent, want, rest, &m);
+            int lastIndex = buildIndices(part, s, want, rest, &m);
             m.partial = (lastRow != lastIndex);
         }
     }
@@ -161,6 +161,10 @@ public:
     virtual void filterOnDemand(int) { }
     virtual QMatchData filter(const QString&, const QModelIndex&, int) = 0;
 
+    virtual void invalidate() { cache.clear(); }
+    virtual void rowsInserted(const QModelIndex &, int, int) { cache.clear(); }
+    virtual void dataChanged(const QModelIndex &, const QModelIndex &) { cache.clear(); }
+
     int matchCount() const { return curMatch.indices.count() + historyMatch.indices.count(); }
 
     QMatchData curMatch, historyMatch;
@@ -189,9 +193,30 @@ public:
 
     void filterOnDemand(int) override;
     QMatchData filter(const QString&, const QModelIndex&, int) override;
+
+    void invalidate() override;
+    void rowsInserted(const QModelIndex &parent, int first, int last) override;
+    void dataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight) override;
 private:
-    int buildIndices(const QString& str, const QModelIndex& parent, int n,
+    // A copy of the completion column below one parent, so that filtering
+    // does not have to call data() for every row on every keystroke.
+    struct Snapshot {
+        QPersistentModelIndex parent;
+        QList<QString> text;
+        QList<QString> keys; // case folded when matching case insensitively
+        QList<bool> selectable;
+        QList<int> order; // rows sorted by key, only for Qt::MatchStartsWith
+    };
+
+    Snapshot *snapshot(const QModelIndex &parent);
+    qsizetype findSnapshot(const QModelIndex &parent) const;
+    void readRows(Snapshot *s, int first, int last);
+    void mergeOrder(Snapshot *s, QList<int> rows);
+    QMatchData prefixMatch(const Snapshot &s, const QString &part) const;
+    int buildIndices(const QString& str, const Snapshot &s, int n,
                      const QIndexMapper& iv, QMatchData* m);
+
+    QList<Snapshot> snapshots;
 };
 
 // ### Qt6: QStyledItemDelegate
@@ -251,7 +276,8 @@ signals:
 
 public Q_SLOTS:
     void invalidate();
-    void rowsInserted();
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
     void modelDestroyed();
 };
 
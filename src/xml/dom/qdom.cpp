@@ -3602,6 +3602,8 @@ QDomAttrPrivate::QDomAttrPrivate(QDomDocumentPrivate* d, QDomNodePrivate* parent
 {
     name = name_;
     m_specified = false;
+    if (d)
+        d->internNames(this);
 }
 
 QDomAttrPrivate::QDomAttrPrivate(QDomDocumentPrivate* d, QDomNodePrivate* p, const QString& nsURI, const QString& qName)
@@ -3611,6 +3613,8 @@ QDomAttrPrivate::QDomAttrPrivate(QDomDocumentPrivate* d, QDomNodePrivate* p, con
     namespaceURI = nsURI;
     createdWithDom1Interface = false;
     m_specified = false;
+    if (d)
+        d->internNames(this);
 }
 
 QDomAttrPrivate::QDomAttrPrivate(QDomAttrPrivate* n, bool deep)
@@ -3887,6 +3891,8 @@ QDomElementPrivate::QDomElementPrivate(QDomDocumentPrivate* d, QDomNodePrivate*
 {
     name = tagname;
     m_attr = new QDomNamedNodeMapPrivate(this);
+    if (d)
+        d->internNames(this);
 }
 
 QDomElementPrivate::QDomElementPrivate(QDomDocumentPrivate* d, QDomNodePrivate* p,
@@ -3897,6 +3903,8 @@ QDomElementPrivate::QDomElementPrivate(QDomDocumentPrivate* d, QDomNodePrivate*
     namespaceURI = nsURI;
     createdWithDom1Interface = false;
     m_attr = new QDomNamedNodeMapPrivate(this);
+    if (d)
+        d->internNames(this);
 }
 
 QDomElementPrivate::QDomElementPrivate(QDomElementPrivate* n, bool deep) :
@@ -5680,9 +5688,34 @@ void QDomDocumentPrivate::clear()
 {
     impl.reset();
     type.reset();
+    nameTable.clear();
     QDomNodePrivate::clear();
 }
 
+QString QDomDocumentPrivate::internedName(const QString &name)
+{
+    // Keep the difference between null and empty strings.
+    if (name.isEmpty())
+        return name;
+
+    const auto it = nameTable.constFind(name);
+    if (it != nameTable.cend())
+        return *it;
+
+    // The key views the data of the stored value, so that must be owned by
+    // the table and not by someone who handed us raw data.
+    QString stored = name.capacity() ? name : QString(name.constData(), name.size());
+    nameTable.insert(QStringView(stored), stored);
+    return stored;
+}
+
+void QDomDocumentPrivate::internNames(QDomNodePrivate *node)
+{
+    node->name = internedName(node->name);
+    node->prefix = internedName(node->prefix);
+    node->namespaceURI = internedName(node->namespaceURI);
+}
+
 #if QT_DEPRECATED_SINCE(5, 15)
 
 QT_WARNING_PUSH
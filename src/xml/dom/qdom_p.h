@@ -494,6 +494,9 @@ QT_WARNING_POP
 
     QDomNodePrivate *importNode(QDomNodePrivate *importedNode, bool deep);
 
+    QString internedName(const QString &name);
+    void internNames(QDomNodePrivate *node);
+
     // Reimplemented from QDomNodePrivate
     QDomNodePrivate *cloneNode(bool deep = true) override;
     QDomNode::NodeType nodeType() const override { return QDomNode::DocumentNode; }
@@ -534,6 +537,13 @@ QT_WARNING_POP
        stored timestamp.
     */
     long nodeListTime;
+
+    /* \internal
+       Element and attribute names, prefixes and namespace URIs repeat a lot
+       in a typical document. Every element and attribute shares them with
+       the first node that used them, see internNames().
+    */
+    QHash<QStringView, QString> nameTable;
 };
 
 QT_END_NAMESPACE
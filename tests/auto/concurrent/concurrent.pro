@@ -6,5 +6,6 @@ SUBDIRS=\
    qtconcurrentmedian \
    qtconcurrentrun \
    qtconcurrentthreadengine \
-   qtconcurrenttask
+   qtconcurrenttask \
+   qtconcurrenttokenize
 
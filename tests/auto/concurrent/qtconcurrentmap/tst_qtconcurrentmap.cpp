@@ -50,6 +50,7 @@ private slots:
     void mappedReducedInitialValue();
     void mappedReducedInitialValueThreadPool();
     void mappedReducedDifferentTypeInitialValue();
+    void mappedReducedParallel();
     void assignResult();
     void functionOverloads();
     void noExceptFunctionOverloads();
@@ -1047,6 +1048,56 @@ int sleeper(int val)
     return val;
 }
 
+void tst_QtConcurrentMap::mappedReducedParallel()
+{
+    QList<int> list;
+    for (int i = 0; i < 10000; ++i)
+        list.append(i % 100);
+
+    qint64 expected = 0;
+    for (int i : list)
+        expected += qint64(i) * i;
+
+    const auto square = [](int x) { return qint64(x) * x; };
+    const auto sum = [](qint64 &result, qint64 value) { result += value; };
+
+    {
+        const qint64 result = QtConcurrent::mappedReduced<qint64>(
+                list, square, sum, QtConcurrent::ParallelReduce).result();
+        QCOMPARE(result, expected);
+    }
+    {
+        QThreadPool pool;
+        pool.setMaxThreadCount(3);
+        const qint64 result = QtConcurrent::mappedReduced<qint64>(
+                &pool, list, square, sum, QtConcurrent::ParallelReduce).result();
+        QCOMPARE(result, expected);
+    }
+    {
+        const qint64 result = QtConcurrent::blockingMappedReduced<qint64>(
+                list, square, sum, qint64(1000), QtConcurrent::ParallelReduce);
+        QCOMPARE(result, expected + 1000);
+    }
+    {
+        // fewer items than blocks
+        const QList<int> shortList { 1, 2, 3 };
+        const qint64 result = QtConcurrent::blockingMappedReduced<qint64>(
+                shortList, square, sum, QtConcurrent::ParallelReduce);
+        QCOMPARE(result, 14);
+    }
+    {
+        // the reduce function can't combine partial results: falls back
+        // to an unordered reduction
+        const auto append = [](QList<int> &result, int value) { result.append(value); };
+        QList<int> result = QtConcurrent::blockingMappedReduced<QList<int>>(
+                list, [](int x) { return x; }, append, QtConcurrent::ParallelReduce);
+        std::sort(result.begin(), result.end());
+        QList<int> sorted = list;
+        std::sort(sorted.begin(), sorted.end());
+        QCOMPARE(result, sorted);
+    }
+}
+
 void tst_QtConcurrentMap::assignResult()
 {
     const QList<int> startList = QList<int>() << 0 << 1 << 2;
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qtconcurrenttokenize
+QT = core testlib concurrent
+SOURCES = tst_qtconcurrenttokenize.cpp
@@ -0,0 +1,178 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <qtconcurrenttokenize.h>
+
+#include <QtTest/QtTest>
+
+#include <QtCore/qmutex.h>
+
+class tst_QtConcurrentTokenize : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void partitionAtSeparators_data();
+    void partitionAtSeparators();
+    void overlappingSeparator();
+    void tokenize_data();
+    void tokenize();
+    void tokenizeOnPool();
+};
+
+static QString csvLines(int count)
+{
+    QString result;
+    for (int i = 0; i < count; ++i)
+        result += QString::number(i) + QLatin1String(",field") + QString::number(i % 7)
+                  + QLatin1String(",,last\n");
+    return result;
+}
+
+void tst_QtConcurrentTokenize::partitionAtSeparators_data()
+{
+    QTest::addColumn<QString>("haystack");
+    QTest::addColumn<QString>("separator");
+    QTest::addColumn<int>("partitionCount");
+
+    const QString lines = csvLines(1000);
+    QTest::newRow("empty") << QString() << QString(",") << 4;
+    QTest::newRow("no-separator") << QString("abcdefgh") << QString(",") << 4;
+    QTest::newRow("one-partition") << lines << QString(",") << 1;
+    QTest::newRow("comma") << lines << QString(",") << 16;
+    QTest::newRow("newline") << lines << QString("\n") << 7;
+    QTest::newRow("many-partitions") << QString("a,b,c") << QString(",") << 100;
+    QTest::newRow("two-chars") << lines << QString(",,") << 16;
+    QTest::newRow("case-insensitive") << lines.toUpper() << QString("field") << 16;
+}
+
+void tst_QtConcurrentTokenize::partitionAtSeparators()
+{
+    QFETCH(QString, haystack);
+    QFETCH(QString, separator);
+    QFETCH(int, partitionCount);
+
+    const auto check = [&](const QList<QStringView> &partitions) {
+        QVERIFY(!partitions.isEmpty());
+        QVERIFY(partitions.size() <= partitionCount);
+
+        // the partitions and the separators between them cover the haystack
+        QString joined;
+        QStringList tokens;
+        for (qsizetype i = 0; i < partitions.size(); ++i) {
+            if (i > 0)
+                joined += separator;
+            joined += partitions.at(i);
+            for (QStringView token : qTokenize(partitions.at(i), separator, Qt::CaseInsensitive))
+                tokens += token.toString();
+        }
+        QCOMPARE(joined, haystack);
+        QCOMPARE(tokens, haystack.split(separator, Qt::KeepEmptyParts, Qt::CaseInsensitive));
+    };
+
+    check(QtConcurrent::partitionAtSeparators(haystack, separator, partitionCount,
+                                              Qt::CaseInsensitive));
+    if (separator.size() == 1) {
+        check(QtConcurrent::partitionAtSeparators(haystack, separator.at(0), partitionCount,
+                                                  Qt::CaseInsensitive));
+    }
+}
+
+void tst_QtConcurrentTokenize::overlappingSeparator()
+{
+    // sequential tokenizing finds "aa" at 0 and 2, but a search starting at 1
+    // would find it there, so the haystack must not be partitioned
+    const QString haystack = QString("aaa").repeated(10000);
+    const auto partitions = QtConcurrent::partitionAtSeparators(haystack, u"aa", 16);
+    QCOMPARE(partitions.size(), 1);
+
+    QCOMPARE(QtConcurrent::partitionAtSeparators(haystack, u"aAa", 16, Qt::CaseInsensitive).size(), 1);
+    QCOMPARE(QtConcurrent::partitionAtSeparators(haystack, QString(), 16).size(), 1);
+}
+
+void tst_QtConcurrentTokenize::tokenize_data()
+{
+    QTest::addColumn<QString>("separator");
+    QTest::addColumn<Qt::SplitBehavior>("sb");
+
+    QTest::newRow("comma") << QString(",") << Qt::SplitBehavior(Qt::KeepEmptyParts);
+    QTest::newRow("comma/skip-empty") << QString(",") << Qt::SplitBehavior(Qt::SkipEmptyParts);
+    QTest::newRow("string") << QString(",field") << Qt::SplitBehavior(Qt::KeepEmptyParts);
+}
+
+void tst_QtConcurrentTokenize::tokenize()
+{
+    QFETCH(QString, separator);
+    QFETCH(Qt::SplitBehavior, sb);
+
+    const QString haystack = csvLines(20000);
+    QStringList expected = haystack.split(separator, sb);
+    std::sort(expected.begin(), expected.end());
+
+    QMutex mutex;
+    QStringList tokens;
+    const auto collect = [&](QStringView token) {
+        QMutexLocker locker(&mutex);
+        tokens += token.toString();
+    };
+
+    if (separator.size() == 1)
+        QtConcurrent::blockingTokenize(haystack, separator.at(0), collect, sb);
+    else
+        QtConcurrent::blockingTokenize(haystack, separator, collect, sb);
+    std::sort(tokens.begin(), tokens.end());
+    QCOMPARE(tokens, expected);
+
+    tokens.clear();
+    QFuture<void> future = QtConcurrent::tokenize(haystack, separator, collect, sb);
+    future.waitForFinished();
+    std::sort(tokens.begin(), tokens.end());
+    QCOMPARE(tokens, expected);
+}
+
+void tst_QtConcurrentTokenize::tokenizeOnPool()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    const QString haystack = csvLines(20000);
+    QAtomicInteger<qsizetype> tokenCount;
+    QAtomicInteger<qsizetype> characterCount;
+    QtConcurrent::blockingTokenize(&pool, haystack, u'\n', [&](QStringView line) {
+        tokenCount.fetchAndAddRelaxed(1);
+        characterCount.fetchAndAddRelaxed(line.size());
+    });
+
+    // 20000 lines plus the empty string after the last newline
+    QCOMPARE(tokenCount.loadRelaxed(), qsizetype(20001));
+    QCOMPARE(characterCount.loadRelaxed(), haystack.size() - 20000);
+}
+
+QTEST_MAIN(tst_QtConcurrentTokenize)
+#include "tst_qtconcurrenttokenize.moc"
@@ -57,6 +57,8 @@ private slots:
     void qMessagePattern_data();
     void qMessagePattern();
     void setMessagePattern();
+    void asyncOutput_data();
+    void asyncOutput();
 
     void formatLogMessage_data();
     void formatLogMessage();
@@ -874,6 +876,59 @@ void tst_qmessagehandler::setMessagePattern()
 #endif // QT_CONFIG(process)
 }
 
+void tst_qmessagehandler::asyncOutput_data()
+{
+    QTest::addColumn<QString>("policy");
+    QTest::newRow("block") << "block";
+    QTest::newRow("drop") << "drop";
+}
+
+void tst_qmessagehandler::asyncOutput()
+{
+#if !QT_CONFIG(process) || !QT_CONFIG(thread)
+    QSKIP("This test requires QProcess and thread support");
+#else
+#ifdef Q_OS_ANDROID
+    QSKIP("This test crashes on Android");
+#endif
+    QFETCH(QString, policy);
+
+    QProcess process;
+#ifndef Q_OS_ANDROID
+    const QString appExe(QLatin1String(HELPER_BINARY));
+#else
+    const QString appExe(QCoreApplication::applicationDirPath() + QLatin1String("/libhelper.so"));
+#endif
+
+    QStringList environment;
+    environment.reserve(m_baseEnvironment.size() + 1);
+    std::copy_if(m_baseEnvironment.cbegin(), m_baseEnvironment.cend(),
+                 std::back_inserter(environment), [](const QString &str) {
+                     return !str.startsWith(QLatin1String("QT_MESSAGE_PATTERN"));
+                 });
+    environment.append(QLatin1String("QT_LOGGING_ASYNC=") + policy);
+    process.setEnvironment(environment);
+
+    process.start(appExe);
+    QVERIFY2(process.waitForStarted(), qPrintable(
+        QString::fromLatin1("Could not start %1: %2").arg(appExe, process.errorString())));
+    process.waitForFinished();
+
+    // the output written from the background thread is complete and in order
+    QByteArray output = process.readAllStandardError();
+    QByteArray expected = "static constructor\n"
+            "[debug] qDebug\n"
+            "[info] qInfo\n"
+            "[warning] qWarning\n"
+            "[critical] qCritical\n"
+            "[warning] qDebug with category\n";
+#ifdef Q_OS_WIN
+    output.replace("\r\n", "\n");
+#endif
+    QCOMPARE(QString::fromLatin1(output), QString::fromLatin1(expected));
+#endif // QT_CONFIG(process) && QT_CONFIG(thread)
+}
+
 Q_DECLARE_METATYPE(QtMsgType)
 
 void tst_qmessagehandler::formatLogMessage_data()
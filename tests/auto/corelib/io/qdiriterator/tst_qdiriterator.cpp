@@ -110,6 +110,9 @@ private slots:
 #ifndef Q_OS_WIN
     void hiddenDirs_hiddenFiles();
 #endif
+#ifndef Q_NO_SYMLINKS
+    void symlinkMetaData();
+#endif
 #ifdef BUILTIN_TESTDATA
 private:
     QSharedPointer<QTemporaryDir> m_dataDir;
@@ -642,6 +645,48 @@ void tst_QDirIterator::hiddenDirs_hiddenFiles()
 }
 #endif // Q_OS_WIN
 
+#ifndef Q_NO_SYMLINKS
+void tst_QDirIterator::symlinkMetaData()
+{
+    // the metadata of symlinks is prefetched while iterating; it must be the
+    // same as what QFileInfo finds out on its own
+    QTemporaryDir dir;
+    QVERIFY2(dir.isValid(), qPrintable(dir.errorString()));
+    const QString path = dir.path();
+    QVERIFY(QDir(path).mkdir(QLatin1String("subdir")));
+    QFile file(path + QLatin1String("/file"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write("12345"), qint64(5));
+    file.close();
+    QVERIFY(QFile::link(path + QLatin1String("/file"), path + QLatin1String("/linkToFile")));
+#ifndef Q_NO_SYMLINKS_TO_DIRS
+    QVERIFY(QFile::link(path + QLatin1String("/subdir"), path + QLatin1String("/linkToDir")));
+#endif
+    QVERIFY(QFile::link(path + QLatin1String("/nowhere"), path + QLatin1String("/dangling")));
+
+    int count = 0;
+    QDirIterator it(path, QDir::AllEntries | QDir::System | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        it.next();
+        const QFileInfo iterated = it.fileInfo();
+        const QFileInfo fresh(it.filePath());
+        QCOMPARE(iterated.isSymLink(), fresh.isSymLink());
+        QCOMPARE(iterated.exists(), fresh.exists());
+        QCOMPARE(iterated.isDir(), fresh.isDir());
+        QCOMPARE(iterated.isFile(), fresh.isFile());
+        QCOMPARE(iterated.size(), fresh.size());
+        QCOMPARE(iterated.lastModified(), fresh.lastModified());
+        QCOMPARE(iterated.permissions(), fresh.permissions());
+        ++count;
+    }
+#ifndef Q_NO_SYMLINKS_TO_DIRS
+    QCOMPARE(count, 5);
+#else
+    QCOMPARE(count, 4);
+#endif
+}
+#endif
+
 QTEST_MAIN(tst_QDirIterator)
 
 #include "tst_qdiriterator.moc"
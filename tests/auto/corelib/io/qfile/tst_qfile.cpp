@@ -36,6 +36,8 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QTemporaryDir>
+#include <QFuture>
+#include <QThreadPool>
 
 #include <private/qabstractfileengine_p.h>
 #include <private/qfsfileengine_p.h>
@@ -185,6 +187,7 @@ private slots:
 #endif
     void setPermissions();
     void copy();
+    void readAllAsync();
     void copyAfterFail();
     void copyRemovesTemporaryFile() const;
     void copyShouldntOverwrite();
@@ -1409,6 +1412,46 @@ void tst_QFile::copy()
     QFile::copy(QDir::currentPath(), QDir::currentPath() + QLatin1String("/test2"));
 }
 
+void tst_QFile::readAllAsync()
+{
+    QFile source(m_testSourceFile);
+    QVERIFY2(source.open(QFile::ReadOnly), msgOpenFailed(source).constData());
+    const QByteArray sourceData = source.readAll();
+
+    QFuture<QByteArray> single = QFile::readAllAsync(m_testSourceFile);
+    QCOMPARE(single.result(), sourceData);
+
+    QStringList fileNames;
+    QList<QByteArray> contents;
+    for (int i = 0; i < 100; ++i) {
+        const QString fileName = QStringLiteral("readAllAsync%1.txt").arg(i);
+        QFile file(fileName);
+        QVERIFY2(file.open(QFile::WriteOnly | QFile::Truncate), msgOpenFailed(file).constData());
+        const QByteArray data = QByteArray::number(i).repeated(i);
+        QCOMPARE(file.write(data), qint64(data.size()));
+        fileNames << fileName;
+        contents << data;
+    }
+    fileNames << QStringLiteral("readAllAsync-does-not-exist.txt");
+    contents << QByteArray();
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(3);
+    QFuture<QByteArray> batch = QFile::readAllAsync(fileNames, &pool);
+    batch.waitForFinished();
+    QCOMPARE(batch.resultCount(), fileNames.size());
+    QCOMPARE(batch.results(), contents);
+    QCOMPARE(batch.resultAt(42), contents.at(42));
+
+    QFuture<QByteArray> empty = QFile::readAllAsync(QStringList());
+    empty.waitForFinished();
+    QVERIFY(empty.isFinished());
+    QCOMPARE(empty.resultCount(), 0);
+
+    for (const QString &fileName : qAsConst(fileNames))
+        QFile::remove(fileName);
+}
+
 void tst_QFile::copyAfterFail()
 {
     QFile file1("file-to-be-copied.txt");
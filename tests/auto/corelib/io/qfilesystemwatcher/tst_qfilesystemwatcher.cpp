@@ -82,6 +82,7 @@ private slots:
     void signalsEmittedAfterFileMoved();
 
     void watchUnicodeCharacters();
+    void recursivePath();
 #if defined(Q_OS_WIN)
     void watchDirectoryAttributeChanges();
 #endif
@@ -819,6 +820,43 @@ void tst_QFileSystemWatcher::watchUnicodeCharacters()
     QTRY_COMPARE(changedSpy.count(), 1);
 }
 
+void tst_QFileSystemWatcher::recursivePath()
+{
+    QTemporaryDir temporaryDirectory(m_tempDirPattern);
+    QVERIFY2(temporaryDirectory.isValid(), qPrintable(temporaryDirectory.errorString()));
+
+    const QString root = temporaryDirectory.path();
+    QDir testDir(root);
+    QVERIFY(testDir.mkpath("a/b"));
+    const QString dirA = root + QLatin1String("/a");
+    const QString dirB = root + QLatin1String("/a/b");
+
+    QFileSystemWatcher watcher;
+    QVERIFY(watcher.addRecursivePath(root));
+    QCOMPARE(watcher.directories().size(), 3);
+    QVERIFY(watcher.directories().contains(root));
+    QVERIFY(watcher.directories().contains(dirA));
+    QVERIFY(watcher.directories().contains(dirB));
+    QVERIFY(watcher.files().isEmpty());
+
+    QStringList changedDirectories;
+    connect(&watcher, &QFileSystemWatcher::directoryChanged,
+            this, [&changedDirectories](const QString &path) { changedDirectories.append(path); });
+    QFile file(dirB + QLatin1String("/file"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.close();
+    QTRY_VERIFY(changedDirectories.contains(dirB));
+
+    // a directory created later is picked up once its parent reports the change
+    const QString dirC = dirA + QLatin1String("/c");
+    QVERIFY(testDir.mkpath("a/c/d"));
+    QTRY_VERIFY(watcher.directories().contains(dirC));
+    QTRY_VERIFY(watcher.directories().contains(dirC + QLatin1String("/d")));
+
+    QVERIFY(watcher.removePath(root));
+    QVERIFY(watcher.directories().isEmpty());
+}
+
 #if defined(Q_OS_WIN)
 void tst_QFileSystemWatcher::watchDirectoryAttributeChanges()
 {
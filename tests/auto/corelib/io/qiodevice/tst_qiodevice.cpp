@@ -63,6 +63,9 @@ private slots:
     void transaction_data();
     void transaction();
 
+    void readChunks();
+    void writeChunks();
+
 private:
     QSharedPointer<QTemporaryDir> m_tempDir;
     QString m_previousCurrent;
@@ -828,5 +831,85 @@ void tst_QIODevice::transaction()
     }
 }
 
+void tst_QIODevice::readChunks()
+{
+    QByteArray data(40000, Qt::Uninitialized);
+    for (int i = 0; i < data.size(); ++i)
+        data[i] = char('a' + i % 26);
+    SequentialReadBuffer dev(&data);
+    QVERIFY(dev.open(QIODevice::ReadOnly));
+
+    // Fill the internal buffer, then take it over in one piece.
+    char c;
+    QVERIFY(dev.getChar(&c));
+    QCOMPARE(c, 'a');
+    const qint64 buffered = dev.bytesAvailable();
+    QVERIFY(buffered > 0);
+    QByteArrayList chunks = dev.readChunks(data.size());
+    QCOMPARE(chunks.size(), 1);
+    QCOMPARE(chunks.first(), data.mid(1, buffered));
+    QCOMPARE(dev.bytesAvailable(), Q_INT64_C(0));
+
+    // A request smaller than the buffered block is split off it.
+    QVERIFY(dev.getChar(&c));
+    chunks = dev.readChunks(100);
+    QCOMPARE(chunks.size(), 1);
+    QCOMPARE(chunks.first(), data.mid(buffered + 2, 100));
+
+    // Reading from an empty buffer behaves like read().
+    QByteArray rest;
+    while (!(chunks = dev.readChunks(data.size())).isEmpty())
+        rest += chunks.join();
+    QCOMPARE(rest, data.mid(buffered + 102));
+    QCOMPARE(dev.readChunks(10), QByteArrayList());
+}
+
+class ChunkRecordingDevice : public QIODevice
+{
+public:
+    bool isSequential() const override { return true; }
+
+    QByteArray written;
+    int vectoredCalls = 0;
+
+protected:
+    qint64 readData(char *, qint64) override { return -1; }
+    qint64 writeData(const char *data, qint64 maxSize) override
+    {
+        written.append(data, maxSize);
+        return maxSize;
+    }
+    qint64 writeChunksData(const QByteArrayView *chunks, qsizetype count) override
+    {
+        ++vectoredCalls;
+        return QIODevice::writeChunksData(chunks, count);
+    }
+};
+
+void tst_QIODevice::writeChunks()
+{
+    const QByteArray header("HEAD");
+    const QByteArray payload(5000, 'p');
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QCOMPARE(buffer.writeChunks({ header, QByteArrayView(), payload }),
+             qint64(header.size() + payload.size()));
+    QCOMPARE(buffer.pos(), qint64(header.size() + payload.size()));
+    QCOMPARE(buffer.data(), header + payload);
+
+    ChunkRecordingDevice dev;
+    QVERIFY(dev.open(QIODevice::WriteOnly));
+    const QByteArrayView chunks[] = { header, payload, header };
+    QCOMPARE(dev.writeChunks(chunks, 3), qint64(2 * header.size() + payload.size()));
+    QCOMPARE(dev.vectoredCalls, 1);
+    QCOMPARE(dev.written, header + payload + header);
+
+    QTest::ignoreMessage(QtWarningMsg, "QIODevice::writeChunks (QIODevice): ReadOnly device");
+    dev.close();
+    QVERIFY(dev.open(QIODevice::ReadOnly));
+    QCOMPARE(dev.writeChunks(chunks, 3), qint64(-1));
+}
+
 QTEST_MAIN(tst_QIODevice)
 #include "tst_qiodevice.moc"
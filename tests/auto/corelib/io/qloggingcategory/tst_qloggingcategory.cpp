@@ -34,6 +34,8 @@ Q_LOGGING_CATEGORY(TST_LOG, "tst.log")
 Q_LOGGING_CATEGORY(Digia_Oslo_Office_com, "Digia.Oslo.Office.com")
 Q_LOGGING_CATEGORY(Digia_Oulu_Office_com, "Digia.Oulu.Office.com")
 Q_LOGGING_CATEGORY(Digia_Berlin_Office_com, "Digia.Berlin.Office.com")
+Q_DECLARE_LOGGING_CATEGORY_WITH_MIN_LEVEL(TST_MIN_LEVEL, QtWarningMsg)
+Q_LOGGING_CATEGORY_WITH_MIN_LEVEL(TST_MIN_LEVEL, QtWarningMsg, "tst.minlevel")
 
 QT_USE_NAMESPACE
 
@@ -878,6 +880,46 @@ private slots:
         QCOMPARE(cleanLogLine(logMessage), cleanLogLine(buf));
     }
 
+    void checkMinLevelCategory()
+    {
+        static_assert(!decltype(TST_MIN_LEVEL)::isCompiledIn(QtDebugMsg));
+        static_assert(!decltype(TST_MIN_LEVEL)::isCompiledIn(QtInfoMsg));
+        static_assert(decltype(TST_MIN_LEVEL)::isCompiledIn(QtWarningMsg));
+        static_assert(decltype(TST_MIN_LEVEL)::isCompiledIn(QtCriticalMsg));
+
+        QLoggingCategory::setFilterRules(QStringLiteral("tst.minlevel=true"));
+        const QLoggingCategory &category = TST_MIN_LEVEL;
+        QCOMPARE(category.categoryName(), "tst.minlevel");
+        QVERIFY(category.isDebugEnabled());
+        QCOMPARE(TST_MIN_LEVEL.categoryName(), "tst.minlevel");
+        QVERIFY(!TST_MIN_LEVEL.isDebugEnabled());
+        QVERIFY(!TST_MIN_LEVEL.isInfoEnabled());
+        QVERIFY(TST_MIN_LEVEL.isWarningEnabled());
+        QVERIFY(TST_MIN_LEVEL.isCriticalEnabled());
+
+        int evaluated = 0;
+        logMessage.clear();
+        qCDebug(TST_MIN_LEVEL) << "Check debug" << ++evaluated;
+        qCDebug(TST_MIN_LEVEL, "Check debug %d", ++evaluated);
+        qCInfo(TST_MIN_LEVEL) << "Check info" << ++evaluated;
+        QVERIFY(logMessage.isEmpty());
+        QCOMPARE(evaluated, 0);
+
+        qCWarning(TST_MIN_LEVEL) << "Check warning";
+        QCOMPARE(logMessage, QStringLiteral("tst.minlevel.warning: Check warning"));
+        qCCritical(TST_MIN_LEVEL, "Check critical %d", 1);
+        QCOMPARE(logMessage, QStringLiteral("tst.minlevel.critical: Check critical 1"));
+
+        // run-time rules still apply from the minimum level up
+        QLoggingCategory::setFilterRules(QStringLiteral("tst.minlevel.warning=false"));
+        QVERIFY(!TST_MIN_LEVEL.isWarningEnabled());
+        logMessage.clear();
+        qCWarning(TST_MIN_LEVEL) << "Check warning";
+        QVERIFY(logMessage.isEmpty());
+
+        QLoggingCategory::setFilterRules(QString());
+    }
+
     void checkMultithreading()
     {
         multithreadtest = true;
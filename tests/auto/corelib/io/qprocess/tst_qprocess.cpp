@@ -114,6 +114,7 @@ private slots:
     void fileWriterProcess();
     void switchReadChannels();
     void discardUnwantedOutput();
+    void readBufferSize();
     void setWorkingDirectory();
     void setNonExistentWorkingDirectory();
 
@@ -2214,6 +2215,32 @@ void tst_QProcess::discardUnwantedOutput()
     QCOMPARE(process.bytesAvailable(), Q_INT64_C(0));
 }
 
+void tst_QProcess::readBufferSize()
+{
+    QProcess process;
+    QCOMPARE(process.readBufferSize(), Q_INT64_C(0));
+    process.setReadBufferSize(1000);
+    QCOMPARE(process.readBufferSize(), Q_INT64_C(1000));
+
+    process.start("testProcessDeadWhileReading/testProcessDeadWhileReading");
+    QVERIFY2(process.waitForStarted(5000), qPrintable(process.errorString()));
+
+    QByteArray output;
+    while (process.waitForReadyRead(5000)) {
+#ifdef Q_OS_UNIX
+        // the remaining output is drained without limit when the process exits
+        if (process.state() == QProcess::Running)
+            QVERIFY(process.bytesAvailable() <= 1000);
+#endif
+        output += process.readAll();
+    }
+
+    QCOMPARE(output.count('\n'), 10 * 1024);
+    QVERIFY(process.waitForFinished(5000));
+    QCOMPARE(process.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(process.exitCode(), 0);
+}
+
 // Q_OS_WIN - setWorkingDirectory will chdir before starting the process on unices
 void tst_QProcess::setWorkingDirectory()
 {
@@ -166,6 +166,13 @@ void tst_QResourceEngine::compressedResource()
     QCOMPARE(data.size(), expectedData.size());
     QCOMPARE(data, expectedData);
 
+    if (compressionAlgo != QResource::NoCompression) {
+        // the decompressed contents are cached and shared with the engine
+        QCOMPARE(resource.uncompressedData().constData(), data.constData());
+        const uchar *mapped = f.map(0, f.size());
+        QCOMPARE(static_cast<const void *>(mapped), static_cast<const void *>(data.constData()));
+    }
+
     // decompression through the engine
     data = f.readAll();
     QCOMPARE(data.size(), expectedData.size());
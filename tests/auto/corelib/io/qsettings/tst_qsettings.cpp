@@ -139,6 +139,7 @@ private slots:
     void testChildKeysAndGroups();
     void testUpdateRequestEvent();
     void testThreadSafety();
+    void testConcurrentReads();
     void testEmptyData();
     void testEmptyKey();
     void testResourceFiles();
@@ -2073,6 +2074,63 @@ void tst_QSettings::testThreadSafety()
     QCOMPARE(numThreadSafetyFailures, 0);
 }
 
+class SettingsReaderThread : public QThread
+{
+public:
+    SettingsReaderThread(const QString &fileName) : fileName(fileName) {}
+    void run() override;
+
+    QString fileName;
+    int failures = 0;
+};
+
+void SettingsReaderThread::run()
+{
+    QSettings settings(fileName, QSettings::IniFormat);
+    for (int iteration = 0; iteration < 20; ++iteration) {
+        for (int section = 0; section < 10; ++section) {
+            for (int key = 0; key < 10; ++key) {
+                const QString name = QString::fromLatin1("section%1/key%2").arg(section).arg(key);
+                if (settings.value(name).toInt() != section * 100 + key)
+                    ++failures;
+            }
+        }
+        if (settings.value(QLatin1String("topLevel")).toString() != QLatin1String("value"))
+            ++failures;
+        if (settings.contains(QLatin1String("section0/missing")))
+            ++failures;
+    }
+}
+
+void tst_QSettings::testConcurrentReads()
+{
+    // many threads reading the same file share one QConfFile; the sections
+    // are parsed lazily by whichever thread needs them first
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QLatin1String("concurrent.ini"));
+    {
+        QSettings settings(fileName, QSettings::IniFormat);
+        settings.setValue(QLatin1String("topLevel"), QLatin1String("value"));
+        for (int section = 0; section < 10; ++section) {
+            for (int key = 0; key < 10; ++key)
+                settings.setValue(QString::fromLatin1("section%1/key%2").arg(section).arg(key),
+                                  section * 100 + key);
+        }
+    }
+    QSettings keepAlive(fileName, QSettings::IniFormat);   // so that all threads share its QConfFile
+
+    std::vector<std::unique_ptr<SettingsReaderThread>> threads;
+    for (int i = 0; i < 8; ++i)
+        threads.push_back(std::make_unique<SettingsReaderThread>(fileName));
+    for (auto &thread : threads)
+        thread->start();
+    for (auto &thread : threads) {
+        QVERIFY(thread->wait());
+        QCOMPARE(thread->failures, 0);
+    }
+}
+
 #ifdef QT_BUILD_INTERNAL
 void tst_QSettings::testNormalizedKey_data()
 {
@@ -29,6 +29,7 @@
 #include <QtTest/QtTest>
 #include <QtCore/QCoreApplication>
 
+#include <QtCore/QIdentityProxyModel>
 #include <QtCore/QSortFilterProxyModel>
 #include <QtCore/QStringListModel>
 #include <QtGui/QStandardItemModel>
@@ -97,6 +98,7 @@ private slots:
     void testReset();
 
     void testDataChanged();
+    void batchUpdate();
 
     void testChildrenLayoutsChanged();
 
@@ -108,6 +110,9 @@ private slots:
 
     void checkIndex();
 
+    void modelRoleDataSpan();
+    void multiData();
+
 private:
     DynamicTreeModel *m_model;
 };
@@ -141,6 +146,10 @@ public:
                      const QModelIndex &destinationParent, int destinationChild);
     void reset();
 
+    using QAbstractItemModel::beginBatchUpdate;
+    using QAbstractItemModel::endBatchUpdate;
+    using QAbstractItemModel::reportDataChanged;
+
     bool canDropMimeData(const QMimeData *data, Qt::DropAction action,
                                  int row, int column, const QModelIndex &parent) const;
 
@@ -1974,6 +1983,82 @@ void tst_QAbstractItemModel::testDataChanged()
     QVERIFY(thirdRoles.contains(CustomRoleModel::Custom1));
 }
 
+void tst_QAbstractItemModel::batchUpdate()
+{
+    QtTestModel model(10, 10);
+    QIdentityProxyModel identity;
+    identity.setSourceModel(&model);
+    QSortFilterProxyModel sorting;
+    sorting.setSourceModel(&identity);
+    QCOMPARE(sorting.rowCount(), 10); // creates the proxy's mapping
+
+    QSignalSpy modelSpy(&model, &QAbstractItemModel::dataChanged);
+    QSignalSpy identitySpy(&identity, &QAbstractItemModel::dataChanged);
+    QSignalSpy sortingSpy(&sorting, &QAbstractItemModel::dataChanged);
+
+    const auto verifyRange = [](const QList<QVariant> &args, int top, int left, int bottom, int right) {
+        const QModelIndex topLeft = args.at(0).value<QModelIndex>();
+        const QModelIndex bottomRight = args.at(1).value<QModelIndex>();
+        QCOMPARE(topLeft.row(), top);
+        QCOMPARE(topLeft.column(), left);
+        QCOMPARE(bottomRight.row(), bottom);
+        QCOMPARE(bottomRight.column(), right);
+    };
+
+    // outside of a batch, changes are reported right away
+    model.reportDataChanged(model.index(0, 0), model.index(0, 0));
+    QCOMPARE(modelSpy.count(), 1);
+    QCOMPARE(identitySpy.count(), 1);
+    QCOMPARE(sortingSpy.count(), 1);
+    modelSpy.clear();
+    identitySpy.clear();
+    sortingSpy.clear();
+
+    model.beginBatchUpdate();
+    model.beginBatchUpdate();
+    model.reportDataChanged(model.index(0, 0), model.index(0, 0));
+    model.reportDataChanged(model.index(0, 1), model.index(0, 1));
+    model.reportDataChanged(model.index(1, 0), model.index(1, 1));
+    model.reportDataChanged(model.index(5, 5), model.index(5, 5), { Qt::DisplayRole });
+    model.reportDataChanged(model.index(5, 5), model.index(5, 5), { Qt::ToolTipRole });
+    model.endBatchUpdate();
+    QCOMPARE(modelSpy.count(), 0);
+    model.endBatchUpdate();
+
+    QCOMPARE(modelSpy.count(), 2);
+    verifyRange(modelSpy.at(0), 0, 0, 1, 1);
+    QVERIFY(modelSpy.at(0).at(2).value<QList<int>>().isEmpty());
+    verifyRange(modelSpy.at(1), 5, 5, 5, 5);
+    const QList<int> roles = modelSpy.at(1).at(2).value<QList<int>>();
+    QCOMPARE(roles.size(), 2);
+    QVERIFY(roles.contains(Qt::DisplayRole));
+    QVERIFY(roles.contains(Qt::ToolTipRole));
+
+    // the proxies batch along with their source
+    QCOMPARE(identitySpy.count(), 2);
+    verifyRange(identitySpy.at(0), 0, 0, 1, 1);
+    verifyRange(identitySpy.at(1), 5, 5, 5, 5);
+    QCOMPARE(sortingSpy.count(), 2);
+    verifyRange(sortingSpy.at(0), 0, 0, 1, 1);
+    verifyRange(sortingSpy.at(1), 5, 5, 5, 5);
+
+    // pending changes are flushed before the model's structure changes
+    modelSpy.clear();
+    QStringList log;
+    connect(&model, &QAbstractItemModel::dataChanged, this, [&log]() { log << "dataChanged"; });
+    connect(&model, &QAbstractItemModel::rowsAboutToBeInserted, this, [&log]() { log << "rowsAboutToBeInserted"; });
+    model.beginBatchUpdate();
+    model.reportDataChanged(model.index(2, 2), model.index(3, 3));
+    QVERIFY(model.insertRows(0, 1));
+    model.endBatchUpdate();
+    QCOMPARE(log, QStringList({ "dataChanged", "rowsAboutToBeInserted" }));
+    QCOMPARE(modelSpy.count(), 1);
+    verifyRange(modelSpy.at(0), 2, 2, 3, 3);
+
+    QTest::ignoreMessage(QtWarningMsg, "QAbstractItemModel::endBatchUpdate: No batch update in progress");
+    model.endBatchUpdate();
+}
+
 Q_DECLARE_METATYPE(QList<QPersistentModelIndex>)
 
 class SignalArgumentChecker : public QObject
@@ -2384,5 +2469,90 @@ void tst_QAbstractItemModel::checkIndex()
     QVERIFY(!model.checkIndex(topLevelIndex, QAbstractItemModel::CheckIndexOption::IndexIsValid));
 }
 
+void tst_QAbstractItemModel::modelRoleDataSpan()
+{
+    QModelRoleData data[3] = {
+        QModelRoleData(Qt::DisplayRole),
+        QModelRoleData(Qt::DecorationRole),
+        QModelRoleData(Qt::EditRole)
+    };
+    QModelRoleData *dataPtr = data;
+
+    QModelRoleDataSpan empty;
+    QVERIFY(!empty.data());
+    QCOMPARE(empty.size(), 0);
+
+    QModelRoleDataSpan single(data[0]);
+    QCOMPARE(single.data(), dataPtr);
+    QCOMPARE(single.size(), 1);
+
+    QModelRoleDataSpan fromArray(data);
+    QCOMPARE(fromArray.data(), dataPtr);
+    QCOMPARE(fromArray.size(), 3);
+    QCOMPARE(fromArray.end() - fromArray.begin(), 3);
+
+    QList<QModelRoleData> list;
+    list.emplaceBack(Qt::ToolTipRole);
+    list.emplaceBack(Qt::CheckStateRole);
+    QModelRoleDataSpan fromList(list);
+    QCOMPARE(fromList.data(), list.data());
+    QCOMPARE(fromList.size(), 2);
+    QCOMPARE(fromList[1].role(), int(Qt::CheckStateRole));
+
+    data[1].setData(42);
+    QCOMPARE(*fromArray.dataForRole(Qt::DecorationRole), QVariant(42));
+    data[1].clearData();
+    QVERIFY(!fromArray.dataForRole(Qt::DecorationRole)->isValid());
+    QCOMPARE(fromArray[1].role(), int(Qt::DecorationRole));
+}
+
+class RoleModel : public QAbstractListModel
+{
+public:
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    { return parent.isValid() ? 0 : 2; }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        ++dataCalls;
+        if (role == Qt::DisplayRole)
+            return QString::number(index.row());
+        if (role == Qt::UserRole)
+            return index.row() * 10;
+        return QVariant();
+    }
+
+    mutable int dataCalls = 0;
+};
+
+void tst_QAbstractItemModel::multiData()
+{
+    RoleModel model;
+    QModelRoleData data[] = {
+        QModelRoleData(Qt::DisplayRole),
+        QModelRoleData(Qt::UserRole),
+        QModelRoleData(Qt::ToolTipRole)
+    };
+    const QModelRoleDataSpan span(data);
+
+    // the default implementation calls data() for each role
+    model.index(1, 0).multiData(span);
+    QCOMPARE(model.dataCalls, 3);
+    QCOMPARE(*span.dataForRole(Qt::DisplayRole), QVariant(QString("1")));
+    QCOMPARE(*span.dataForRole(Qt::UserRole), QVariant(10));
+    QVERIFY(!span.dataForRole(Qt::ToolTipRole)->isValid());
+
+    const QPersistentModelIndex persistent(model.index(0, 0));
+    persistent.multiData(span);
+    QCOMPARE(model.dataCalls, 6);
+    QCOMPARE(*span.dataForRole(Qt::DisplayRole), QVariant(QString("0")));
+    QCOMPARE(*span.dataForRole(Qt::UserRole), QVariant(0));
+
+    // an invalid index leaves the data untouched
+    QModelIndex().multiData(span);
+    QCOMPARE(model.dataCalls, 6);
+    QCOMPARE(*span.dataForRole(Qt::UserRole), QVariant(0));
+}
+
 QTEST_MAIN(tst_QAbstractItemModel)
 #include "tst_qabstractitemmodel.moc"
@@ -2632,6 +2632,52 @@ void tst_QSortFilterProxyModel::sortStable()
     QCOMPARE(lastItemData, filterModel->index(2,0, firstRoot).data());
 }
 
+void tst_QSortFilterProxyModel::sortKeyCaching()
+{
+    // enough rows to be sorted in several chunks on machines with several cores
+    QStringList strings;
+    for (int i = 0; i < 40000; ++i)
+        strings << QString::number((i * 7919) % 1000).rightJustified(i % 3 + 1, QLatin1Char(i % 2 ? 'A' : 'a'));
+    QStringListModel model(strings);
+
+    QSortFilterProxyModel reference;
+    reference.setSourceModel(&model);
+    QSortFilterProxyModel cached;
+    cached.setSourceModel(&model);
+    QVERIFY(!cached.isSortKeyCachingEnabled());
+    QSignalSpy spy(&cached, &QSortFilterProxyModel::sortKeyCachingEnabledChanged);
+    cached.setSortKeyCachingEnabled(true);
+    QVERIFY(cached.isSortKeyCachingEnabled());
+    QCOMPARE(spy.count(), 1);
+
+    const auto compare = [&]() {
+        QCOMPARE(cached.rowCount(), reference.rowCount());
+        for (int row = 0; row < reference.rowCount(); ++row) {
+            // the sort is stable, so equal keys keep their source order
+            QCOMPARE(cached.mapToSource(cached.index(row, 0)).row(),
+                     reference.mapToSource(reference.index(row, 0)).row());
+        }
+    };
+
+    reference.sort(0, Qt::AscendingOrder);
+    cached.sort(0, Qt::AscendingOrder);
+    compare();
+
+    reference.sort(0, Qt::DescendingOrder);
+    cached.sort(0, Qt::DescendingOrder);
+    compare();
+
+    reference.setSortCaseSensitivity(Qt::CaseInsensitive);
+    cached.setSortCaseSensitivity(Qt::CaseInsensitive);
+    compare();
+
+    // rows inserted into a sorted proxy are sorted with cached keys as well
+    model.insertRows(0, 2);
+    model.setData(model.index(0, 0), QStringLiteral("0"));
+    model.setData(model.index(1, 0), QStringLiteral("zzz"));
+    compare();
+}
+
 void tst_QSortFilterProxyModel::hiddenColumns()
 {
     class MyStandardItemModel : public QStandardItemModel
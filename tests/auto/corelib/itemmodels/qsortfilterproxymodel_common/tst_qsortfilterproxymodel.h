@@ -109,6 +109,7 @@ private slots:
     void sortColumnTracking2();
 
     void sortStable();
+    void sortKeyCaching();
 
     void hiddenColumns();
     void insertRowsSort();
@@ -16,6 +16,7 @@ SUBDIRS=\
     qobject \
     qpointer \
     qsharedmemory \
+    qsharedringbuffer \
     qsignalblocker \
     qsignalmapper \
     qsocketnotifier \
@@ -23,6 +24,7 @@ SUBDIRS=\
     qtimer \
     qtranslator \
     qvariant \
+    qvariantarray \
     qwineventnotifier \
     qproperty
 
@@ -37,12 +39,13 @@ SUBDIRS=\
 !qtConfig(private_tests): SUBDIRS -= \
     qsocketnotifier \
     qsharedmemory \
+    qsharedringbuffer \
     qproperty
 
 # This test is only applicable on Windows
 !win32*: SUBDIRS -= qwineventnotifier
 
-android|uikit: SUBDIRS -= qobject qsharedmemory qsystemsemaphore
+android|uikit: SUBDIRS -= qobject qsharedmemory qsharedringbuffer qsystemsemaphore
 
 !qtConfig(systemsemaphore): SUBDIRS -= \
     qsystemsemaphore
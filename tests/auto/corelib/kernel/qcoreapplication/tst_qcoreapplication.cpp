@@ -527,6 +527,58 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+class SequenceEvent : public QEvent
+{
+public:
+    SequenceEvent(int value) : QEvent(QEvent::User), value(value) { }
+    int value;
+};
+
+class SequenceRecorder : public QObject
+{
+    Q_OBJECT
+public:
+    QList<int> sequence;
+
+    Q_INVOKABLE void record(int value) { sequence.append(value); }
+
+    bool event(QEvent *event) override
+    {
+        if (event->type() == QEvent::User) {
+            record(static_cast<SequenceEvent *>(event)->value);
+            return true;
+        }
+        return QObject::event(event);
+    }
+};
+
+void tst_QCoreApplication::crossThreadPostingOrder()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    // queued meta-calls and plain events posted from one thread must be
+    // delivered in the order they were posted, whichever way they are queued
+    const int count = 1000;
+    SequenceRecorder recorder;
+    QScopedPointer<QThread> thread(QThread::create([&recorder]() {
+        for (int i = 0; i < count; ++i) {
+            if (i % 3)
+                QMetaObject::invokeMethod(&recorder, "record", Qt::QueuedConnection, Q_ARG(int, i));
+            else
+                QCoreApplication::postEvent(&recorder, new SequenceEvent(i));
+        }
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+    QCoreApplication::sendPostedEvents(&recorder);
+    QCOMPARE(recorder.sequence.size(), count);
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(recorder.sequence.at(i), i);
+}
 #endif // QT_CONFIG(thread)
 
 void tst_QCoreApplication::applicationPid()
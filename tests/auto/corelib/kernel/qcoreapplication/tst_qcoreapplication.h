@@ -45,6 +45,7 @@ private slots:
     void removePostedEvents();
 #if QT_CONFIG(thread)
     void deliverInDefinedOrder();
+    void crossThreadPostingOrder();
 #endif
     void applicationPid();
     void globalPostedEventsCount();
@@ -322,6 +322,8 @@ private slots:
     void indexOfMethod();
 
     void indexOfMethodPMF();
+    void indexOfMethodHashTable_data();
+    void indexOfMethodHashTable();
 
     void signalOffset_data();
     void signalOffset();
@@ -1710,6 +1712,52 @@ void tst_QMetaObject::indexOfMethodPMF()
     INDEXOFMETHODPMF_HELPER(QtTestCustomObject, sig_custom, (const CustomString &))
 }
 
+void tst_QMetaObject::indexOfMethodHashTable_data()
+{
+    QTest::addColumn<const QMetaObject *>("metaObject");
+    QTest::newRow("QObject") << &QObject::staticMetaObject;
+    QTest::newRow("QtTestObject") << &QtTestObject::staticMetaObject;
+    QTest::newRow("tst_QMetaObject") << &tst_QMetaObject::staticMetaObject;
+    QTest::newRow("QAbstractProxyModel") << &QAbstractProxyModel::staticMetaObject;
+}
+
+// Checks that the lookups through the moc-generated method hash table
+// find the same methods as a scan of the whole method list would.
+void tst_QMetaObject::indexOfMethodHashTable()
+{
+    QFETCH(const QMetaObject *, metaObject);
+
+    const QMetaObjectPrivate *priv = QMetaObjectPrivate::get(metaObject);
+    QVERIFY(priv->revision >= 10);
+    QCOMPARE(priv->methodHashSize, QMetaObjectPrivate::methodHashBuckets(priv->methodCount));
+
+    for (int i = 0; i < metaObject->methodCount(); ++i) {
+        const QMetaMethod method = metaObject->method(i);
+        const QByteArray signature = method.methodSignature();
+
+        int expected = -1, expectedSignal = -1, expectedSlot = -1;
+        for (int j = metaObject->methodCount() - 1; j >= 0; --j) {
+            const QMetaMethod candidate = metaObject->method(j);
+            if (candidate.methodSignature() != signature)
+                continue;
+            if (expected < 0)
+                expected = j;
+            if (expectedSignal < 0 && candidate.methodType() == QMetaMethod::Signal)
+                expectedSignal = j;
+            // indexOfSlot() also finds invokable methods
+            if (expectedSlot < 0 && candidate.methodType() != QMetaMethod::Signal)
+                expectedSlot = j;
+        }
+
+        QCOMPARE(metaObject->indexOfMethod(signature), expected);
+        QCOMPARE(metaObject->indexOfSignal(signature), expectedSignal);
+        QCOMPARE(metaObject->indexOfSlot(signature), expectedSlot);
+    }
+
+    QCOMPARE(metaObject->indexOfMethod("noSuchMethod()"), -1);
+    QCOMPARE(metaObject->indexOfMethod("deleteLater(int)"), -1);
+}
+
 namespace SignalTestHelper
 {
 // These functions use the public QMetaObject/QMetaMethod API to implement
@@ -29,6 +29,7 @@
 #include <QtTest/QtTest>
 #include <QtCore/qlocale.h>
 #include <private/qmetaobjectbuilder_p.h>
+#include <private/qmetaobject_p.h>
 
 class tst_QMetaObjectBuilder : public QObject
 {
@@ -53,6 +54,7 @@ private slots:
     void serialize();
     void relocatableData();
     void removeNotifySignal();
+    void methodLookup();
 
     void usage_signal();
     void usage_property();
@@ -1098,6 +1100,39 @@ void tst_QMetaObjectBuilder::relocatableData()
 
 
 // Check that removing a method updates notify signals appropriately
+void tst_QMetaObjectBuilder::methodLookup()
+{
+    QMetaObjectBuilder builder;
+    builder.setClassName("Lookup");
+    builder.setSuperClass(&QObject::staticMetaObject);
+    builder.addSignal("changed()");
+    builder.addSignal("changed(int)");
+    builder.addSlot("changed(QString)");
+    builder.addMethod("foo(int)");
+    builder.addSlot("foo(int)");
+    for (int i = 0; i < 40; ++i)
+        builder.addSlot("slot" + QByteArray::number(i) + "()");
+
+    QMetaObject *meta = builder.toMetaObject();
+    const QMetaObjectPrivate *priv = QMetaObjectPrivate::get(meta);
+    QCOMPARE(priv->methodHashSize, 64);
+
+    const int offset = meta->methodOffset();
+    QCOMPARE(meta->indexOfSignal("changed()"), offset);
+    QCOMPARE(meta->indexOfSignal("changed(int)"), offset + 1);
+    QCOMPARE(meta->indexOfSlot("changed(int)"), -1);
+    QCOMPARE(meta->indexOfSlot("changed(QString)"), offset + 2);
+    QCOMPARE(meta->indexOfSignal("changed(QString)"), -1);
+    // the last method with a given signature wins, as with a linear scan
+    QCOMPARE(meta->indexOfMethod("foo(int)"), offset + 4);
+    for (int i = 0; i < 40; ++i)
+        QCOMPARE(meta->indexOfSlot("slot" + QByteArray::number(i) + "()"), offset + 5 + i);
+    QCOMPARE(meta->indexOfSlot("deleteLater()"), QObject::staticMetaObject.indexOfSlot("deleteLater()"));
+    QCOMPARE(meta->indexOfMethod("slot40()"), -1);
+
+    free(meta);
+}
+
 void tst_QMetaObjectBuilder::removeNotifySignal()
 {
     QMetaObjectBuilder builder;
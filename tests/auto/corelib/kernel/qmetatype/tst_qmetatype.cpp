@@ -183,6 +183,7 @@ private slots:
     void qMetaTypeId();
     void properties();
     void normalizedTypes();
+    void fromNameRepeated();
     void typeName_data();
     void typeName();
     void type_data();
@@ -669,6 +670,38 @@ void tst_QMetaType::normalizedTypes()
     QCOMPARE(qRegisterMetaType<Whity<double> >("Whity<double > "), WhityDoubleId);
 }
 
+struct LateRegistered { int i; };
+Q_DECLARE_METATYPE(LateRegistered)
+
+void tst_QMetaType::fromNameRepeated()
+{
+    // lookups of names that need normalizing are remembered; make sure
+    // that gives the same answers every time
+    const QMetaType whityInt = QMetaType::fromType<Whity<int>>();
+    for (int i = 0; i < 3; ++i) {
+        QCOMPARE(QMetaType::fromName(" Whity < int > "), whityInt);
+        QCOMPARE(QMetaType::fromName("const QString &"), QMetaType::fromType<QString>());
+        QCOMPARE(QMetaType::fromName("unsigned"), QMetaType::fromType<uint>());
+    }
+
+    // a failed lookup must not hide a type registered afterwards
+    QVERIFY(!QMetaType::fromName(" LateRegistered ").isValid());
+    QVERIFY(!QMetaType::fromName("LateRegistered").isValid());
+    const int lateId = qRegisterMetaType<LateRegistered>();
+    QCOMPARE(QMetaType::fromName(" LateRegistered ").id(), lateId);
+    QCOMPARE(QMetaType::fromName("LateRegistered").id(), lateId);
+
+    // enough typedefs to make the name table grow a few times
+    QList<QByteArray> names;
+    for (int i = 0; i < 300; ++i) {
+        names.append("FromNameRepeatedTypedef" + QByteArray::number(i));
+        QCOMPARE(qRegisterMetaType<LateRegistered>(names.last().constData()), lateId);
+    }
+    for (const QByteArray &name : qAsConst(names))
+        QCOMPARE(QMetaType::fromName(name).id(), lateId);
+    QCOMPARE(QMetaType::fromName(" Whity < int > "), whityInt);
+}
+
 #define TYPENAME_DATA(MetaTypeName, MetaTypeId, RealType)\
     QTest::newRow(#RealType) << int(QMetaType::MetaTypeName) << #RealType;
 
@@ -154,6 +154,8 @@ private slots:
     void nullReceiver();
     void functorReferencesConnection();
     void disconnectDisconnects();
+    void batchedEmission();
+    void manyPendingQueuedCalls();
 };
 
 struct QObjectCreatedOnShutdown
@@ -7468,6 +7470,95 @@ void tst_QObject::disconnectDisconnects()
     QCOMPARE(count, 3); // + δ
 }
 
+class BatchSender : public QObject
+{
+    Q_OBJECT
+signals:
+    void valueChanged(int value, const QString &name);
+};
+
+class BatchReceiver : public QObject
+{
+    Q_OBJECT
+public:
+    QList<int> values;
+    QStringList names;
+    int metaCallEvents = 0;
+
+    bool event(QEvent *e) override
+    {
+        if (e->type() == QEvent::MetaCall)
+            ++metaCallEvents;
+        return QObject::event(e);
+    }
+
+public slots:
+    void setValue(int value, const QString &name)
+    {
+        values << value;
+        names << name;
+    }
+};
+
+void tst_QObject::batchedEmission()
+{
+    BatchSender sender;
+    BatchReceiver queuedReceiver;
+    BatchReceiver functorReceiver;
+    BatchReceiver directReceiver;
+
+    connect(&sender, &BatchSender::valueChanged, &queuedReceiver, &BatchReceiver::setValue,
+            Qt::QueuedConnection);
+    connect(&sender, &BatchSender::valueChanged, &functorReceiver,
+            [&functorReceiver](int value, const QString &name) { functorReceiver.setValue(value, name); },
+            Qt::QueuedConnection);
+    connect(&sender, SIGNAL(valueChanged(int,QString)), &directReceiver, SLOT(setValue(int,QString)));
+
+    const std::tuple<int, QString> packs[] = {
+        { 1, QStringLiteral("one") },
+        { 2, QStringLiteral("two") },
+        { 3, QStringLiteral("three") },
+    };
+    QObjectPrivate::emitBatch(&sender, &BatchSender::valueChanged, packs, 3);
+
+    // direct connections are called once per emission, right away
+    QCOMPARE(directReceiver.values, QList<int>({ 1, 2, 3 }));
+    QCOMPARE(directReceiver.names, QStringList({ "one", "two", "three" }));
+    QVERIFY(queuedReceiver.values.isEmpty());
+    QVERIFY(functorReceiver.values.isEmpty());
+
+    // each queued connection gets a single event for the whole batch
+    QCoreApplication::processEvents();
+    QCOMPARE(queuedReceiver.metaCallEvents, 1);
+    QCOMPARE(queuedReceiver.values, QList<int>({ 1, 2, 3 }));
+    QCOMPARE(queuedReceiver.names, QStringList({ "one", "two", "three" }));
+    QCOMPARE(functorReceiver.metaCallEvents, 1);
+    QCOMPARE(functorReceiver.values, QList<int>({ 1, 2, 3 }));
+
+    // blocked signals are not delivered at all
+    sender.blockSignals(true);
+    QObjectPrivate::emitBatch(&sender, &BatchSender::valueChanged, packs, 3);
+    QCoreApplication::processEvents();
+    QCOMPARE(directReceiver.values.size(), 3);
+    QCOMPARE(queuedReceiver.values.size(), 3);
+}
+
+void tst_QObject::manyPendingQueuedCalls()
+{
+    // more pending events than the QMetaCallEvent free list can hold
+    const int count = 0x10000 + 1000;
+    BatchReceiver receiver;
+    for (int i = 0; i < count; ++i)
+        QMetaObject::invokeMethod(&receiver, "setValue", Qt::QueuedConnection,
+                                  Q_ARG(int, i), Q_ARG(QString, QString()));
+
+    QCoreApplication::processEvents();
+    QCOMPARE(receiver.metaCallEvents, count);
+    QCOMPARE(receiver.values.size(), count);
+    QCOMPARE(receiver.values.first(), 0);
+    QCOMPARE(receiver.values.last(), count - 1);
+}
+
 // Test for QtPrivate::HasQ_OBJECT_Macro
 static_assert(QtPrivate::HasQ_OBJECT_Macro<tst_QObject>::Value);
 static_assert(!QtPrivate::HasQ_OBJECT_Macro<SiblingDeleter>::Value);
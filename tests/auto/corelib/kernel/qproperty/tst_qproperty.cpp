@@ -31,6 +31,10 @@
 #include <qproperty.h>
 #include <private/qproperty_p.h>
 
+#include <array>
+#include <memory>
+#include <numeric>
+
 using namespace QtPrivate;
 
 class tst_QProperty : public QObject
@@ -74,6 +78,11 @@ private slots:
     void notifiedPropertyWithGuard();
     void typeNoOperatorEqual();
     void bindingValueReplacement();
+    void largeFunctorBinding();
+    void updateGroup();
+    void nestedUpdateGroups();
+    void updateGroupDeletesProperty();
+    void updateGroupNotifiedProperty();
 };
 
 void tst_QProperty::functorBinding()
@@ -1087,6 +1096,145 @@ void tst_QProperty::bindingValueReplacement()
     QCOMPARE(test.iconText.value(), 42);
 }
 
+void tst_QProperty::largeFunctorBinding()
+{
+    // too large to be stored inline in the binding
+    std::array<int, 16> values;
+    std::iota(values.begin(), values.end(), 1);
+    QProperty<int> factor(1);
+    QProperty<int> sum([values, &factor]() {
+        return std::accumulate(values.begin(), values.end(), 0) * factor;
+    });
+    QCOMPARE(sum.value(), 136);
+    factor = 2;
+    QCOMPARE(sum.value(), 272);
+
+    QProperty<int> moved(std::move(sum));
+    factor = 3;
+    QCOMPARE(moved.value(), 408);
+}
+
+void tst_QProperty::updateGroup()
+{
+    QProperty<int> a(1);
+    QProperty<int> b(2);
+    int evaluations = 0;
+    QProperty<int> sum([&]() { ++evaluations; return a + b; });
+    QProperty<int> twice([&]() { return sum * 2; });
+    QCOMPARE(twice.value(), 6);
+    evaluations = 0;
+
+    QList<int> recordedSums;
+    QList<int> recordedA;
+    auto sumHandler = sum.onValueChanged([&]() { recordedSums << sum; });
+    auto aHandler = a.onValueChanged([&]() { recordedA << a; });
+
+    Qt::beginPropertyUpdateGroup();
+    a = 10;
+    b = 20;
+    a = 11;
+    QCOMPARE(evaluations, 0);
+    QVERIFY(recordedSums.isEmpty());
+    QVERIFY(recordedA.isEmpty());
+    Qt::endPropertyUpdateGroup();
+
+    QCOMPARE(recordedA, QList<int>{ 11 });
+    QCOMPARE(recordedSums, QList<int>{ 31 });
+    QCOMPARE(twice.value(), 62);
+    QCOMPARE(evaluations, 1);
+
+    // reading a value inside a group evaluates the binding right away, and
+    // the change is still reported when the group ends
+    {
+        QScopedPropertyUpdateGroup group;
+        b = 30;
+        QCOMPARE(sum.value(), 41);
+    }
+    QCOMPARE(recordedSums, QList<int>({ 31, 41 }));
+    QCOMPARE(evaluations, 2);
+
+    // without a group every change is delivered immediately
+    a = 1;
+    b = 2;
+    QCOMPARE(recordedSums, QList<int>({ 31, 41, 31, 3 }));
+}
+
+void tst_QProperty::nestedUpdateGroups()
+{
+    QProperty<int> source(0);
+    QProperty<int> dependent([&]() { return source + 1; });
+    QCOMPARE(dependent.value(), 1);
+    int calls = 0;
+    auto handler = dependent.onValueChanged([&]() { ++calls; });
+
+    {
+        QScopedPropertyUpdateGroup outer;
+        source = 1;
+        {
+            QScopedPropertyUpdateGroup inner;
+            source = 2;
+        }
+        QCOMPARE(calls, 0);
+        source = 3;
+    }
+    QCOMPARE(calls, 1);
+    QCOMPARE(dependent.value(), 4);
+
+    // a change handler may itself use an update group
+    QProperty<int> other(0);
+    auto otherHandler = other.onValueChanged([&]() {
+        QScopedPropertyUpdateGroup group;
+        source = other * 10;
+    });
+    {
+        QScopedPropertyUpdateGroup group;
+        other = 5;
+    }
+    QCOMPARE(dependent.value(), 51);
+    QCOMPARE(calls, 2);
+}
+
+void tst_QProperty::updateGroupDeletesProperty()
+{
+    auto first = std::make_unique<QProperty<int>>(0);
+    auto second = std::make_unique<QProperty<int>>(0);
+    int secondCalls = 0;
+    auto firstHandler = first->onValueChanged([&]() { second.reset(); });
+    auto secondHandler = second->onValueChanged([&]() { ++secondCalls; });
+
+    {
+        QScopedPropertyUpdateGroup group;
+        *first = 1;
+        *second = 1;
+    }
+    QVERIFY(!second);
+    QCOMPARE(secondCalls, 0);
+
+    {
+        QScopedPropertyUpdateGroup group;
+        *first = 2;
+        first.reset();
+    }
+}
+
+void tst_QProperty::updateGroupNotifiedProperty()
+{
+    ClassWithNotifiedProperty instance;
+    QProperty<int> x(1);
+    QProperty<int> y(2);
+    instance.property.setBinding(&instance, [&]() { return x * y; });
+    instance.recordedValues.clear();
+
+    {
+        QScopedPropertyUpdateGroup group;
+        x = 3;
+        y = 4;
+        x = 5;
+        QVERIFY(instance.recordedValues.isEmpty());
+    }
+    QCOMPARE(instance.recordedValues, QList<int>{ 20 });
+}
+
 QTEST_MAIN(tst_QProperty);
 
 #include "tst_qproperty.moc"
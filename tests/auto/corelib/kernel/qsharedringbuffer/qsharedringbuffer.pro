@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qsharedringbuffer
+QT = core core-private testlib
+SOURCES = tst_qsharedringbuffer.cpp
@@ -0,0 +1,185 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/private/qsharedringbuffer_p.h>
+
+class tst_QSharedRingBuffer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void createAndAttach();
+    void readWrite();
+    void wrapAround();
+    void full();
+    void blockingTransfer();
+
+private:
+    static QString uniqueKey();
+};
+
+QString tst_QSharedRingBuffer::uniqueKey()
+{
+    return QStringLiteral("tst_qsharedringbuffer_%1_%2")
+            .arg(QCoreApplication::applicationPid())
+            .arg(QLatin1String(QTest::currentTestFunction()));
+}
+
+void tst_QSharedRingBuffer::createAndAttach()
+{
+    const QString key = uniqueKey();
+
+    QSharedRingBuffer reader(key);
+    QVERIFY(!reader.attach());
+    QVERIFY(!reader.errorString().isEmpty());
+
+    QSharedRingBuffer writer(key);
+    QVERIFY(!writer.create(0));
+    QVERIFY2(writer.create(1000), qPrintable(writer.errorString()));
+    QVERIFY(writer.isAttached());
+    QCOMPARE(writer.capacity(), qsizetype(1024));
+    QCOMPARE(writer.maximumMessageSize(), qsizetype(1020));
+
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+    QCOMPARE(reader.capacity(), qsizetype(1024));
+
+    QVERIFY(reader.detach());
+    QVERIFY(!reader.isAttached());
+    QCOMPARE(reader.capacity(), qsizetype(0));
+}
+
+void tst_QSharedRingBuffer::readWrite()
+{
+    QSharedRingBuffer writer(uniqueKey());
+    QVERIFY2(writer.create(256), qPrintable(writer.errorString()));
+    QSharedRingBuffer reader(uniqueKey());
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    QByteArray message;
+    QVERIFY(!reader.tryRead(&message));
+    QVERIFY(!reader.read(&message, QDeadlineTimer(10)));
+
+    QVERIFY(writer.tryWrite("Hello"));
+    QVERIFY(writer.tryWrite(QByteArray()));
+    QVERIFY(writer.write("World", 5));
+
+    QVERIFY(reader.tryRead(&message));
+    QCOMPARE(message, QByteArray("Hello"));
+    QVERIFY(reader.read(&message));
+    QCOMPARE(message, QByteArray());
+    QVERIFY(reader.read(&message));
+    QCOMPARE(message, QByteArray("World"));
+    QVERIFY(!reader.tryRead(&message));
+}
+
+void tst_QSharedRingBuffer::wrapAround()
+{
+    QSharedRingBuffer writer(uniqueKey());
+    QVERIFY2(writer.create(64), qPrintable(writer.errorString()));
+    QSharedRingBuffer reader(uniqueKey());
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    // odd sizes make the payloads straddle the end of the buffer
+    for (int i = 0; i < 200; ++i) {
+        const QByteArray expected(i % 41, char('a' + i % 26));
+        QVERIFY(writer.tryWrite(expected));
+        QByteArray message;
+        QVERIFY(reader.tryRead(&message));
+        QCOMPARE(message, expected);
+    }
+}
+
+void tst_QSharedRingBuffer::full()
+{
+    QSharedRingBuffer writer(uniqueKey());
+    QVERIFY2(writer.create(64), qPrintable(writer.errorString()));
+    QSharedRingBuffer reader(uniqueKey());
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    QVERIFY(!writer.tryWrite(QByteArray(61, 'x')));
+    QVERIFY(!writer.errorString().isEmpty());
+
+    // each message takes 16 bytes including its length
+    for (int i = 0; i < 4; ++i)
+        QVERIFY(writer.tryWrite(QByteArray(12, char('0' + i))));
+    QVERIFY(!writer.tryWrite("x"));
+    QVERIFY(!writer.write("x", 1, QDeadlineTimer(10)));
+
+    QByteArray message;
+    QVERIFY(reader.tryRead(&message));
+    QCOMPARE(message, QByteArray(12, '0'));
+    QVERIFY(writer.tryWrite("x"));
+}
+
+class ProducerThread : public QThread
+{
+public:
+    ProducerThread(const QString &key, int count) : key(key), count(count) {}
+
+    void run() override
+    {
+        QSharedRingBuffer writer(key);
+        if (!writer.attach())
+            return;
+        for (int i = 0; i < count; ++i) {
+            const QByteArray message = QByteArray::number(i).repeated(i % 7 + 1);
+            if (!writer.write(message, QDeadlineTimer(10000)))
+                return;
+            ++written;
+        }
+    }
+
+    QString key;
+    int count;
+    int written = 0;
+};
+
+void tst_QSharedRingBuffer::blockingTransfer()
+{
+    // A buffer much smaller than the data transferred makes both sides
+    // wait for each other repeatedly.
+    const int count = 20000;
+    QSharedRingBuffer reader(uniqueKey());
+    QVERIFY2(reader.create(256), qPrintable(reader.errorString()));
+
+    ProducerThread producer(uniqueKey(), count);
+    producer.start();
+
+    QByteArray message;
+    for (int i = 0; i < count; ++i) {
+        QVERIFY2(reader.read(&message, QDeadlineTimer(10000)), QByteArray::number(i));
+        QCOMPARE(message, QByteArray::number(i).repeated(i % 7 + 1));
+    }
+    QVERIFY(producer.wait(10000));
+    QCOMPARE(producer.written, count);
+    QVERIFY(!reader.tryRead(&message));
+}
+
+QTEST_MAIN(tst_QSharedRingBuffer)
+#include "tst_qsharedringbuffer.moc"
@@ -31,6 +31,7 @@
 #include <QtTest/QTestEventLoop>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QTemporaryFile>
 #include <QtCore/QTimer>
 #include <QtCore/QSocketNotifier>
 #include <QtNetwork/QTcpServer>
@@ -40,6 +41,7 @@
 #define NATIVESOCKETENGINE QNativeSocketEngine
 #ifdef Q_OS_UNIX
 #include <private/qnet_unix_p.h>
+#include <private/qeventdispatcher_unix_p.h>
 #include <sys/select.h>
 #endif
 #include <limits>
@@ -58,6 +60,10 @@ private slots:
     void mixingWithTimers();
 #ifdef Q_OS_UNIX
     void posixSockets();
+#endif
+#if QT_CONFIG(epoll)
+    void epollEventDispatcher();
+    void epollRegularFile();
 #endif
     void asyncMultipleDatagram();
     void activationReason_data();
@@ -316,6 +322,101 @@ void tst_QSocketNotifier::posixSockets()
 }
 #endif
 
+#if QT_CONFIG(epoll)
+void tst_QSocketNotifier::epollEventDispatcher()
+{
+    qputenv("QT_EVENTDISPATCHER_EPOLL", "1");
+    QEventDispatcherUNIX *dispatcher = new QEventDispatcherUNIX;
+    qunsetenv("QT_EVENTDISPATCHER_EPOLL");
+    QVERIFY(static_cast<QEventDispatcherUNIXPrivate *>(QObjectPrivate::get(dispatcher))->epollFd >= 0);
+
+    int fds[2];
+    QCOMPARE(qt_safe_pipe(fds, O_NONBLOCK), 0);
+
+    int activations = 0;
+    bool activatedWhileDisabled = false;
+    QScopedPointer<QThread> thread(QThread::create([&]() {
+        QEventLoop loop;
+        QSocketNotifier notifier(fds[0], QSocketNotifier::Read);
+        connect(&notifier, &QSocketNotifier::activated, [&]() {
+            if (!notifier.isEnabled())
+                activatedWhileDisabled = true;
+            char c;
+            while (qt_safe_read(fds[0], &c, 1) == 1) { }
+            if (++activations == 3) {
+                // a disabled notifier must be dropped from the epoll set
+                notifier.setEnabled(false);
+                qt_safe_write(fds[1], "x", 1);
+                QTimer::singleShot(100, &loop, &QEventLoop::quit);
+            } else {
+                qt_safe_write(fds[1], "x", 1);
+            }
+        });
+        QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+        qt_safe_write(fds[1], "x", 1);
+        loop.exec();
+    }));
+    thread->setEventDispatcher(dispatcher);
+    thread->start();
+    QVERIFY(thread->wait(20000));
+
+    QCOMPARE(activations, 3);
+    QVERIFY(!activatedWhileDisabled);
+    qt_safe_close(fds[0]);
+    qt_safe_close(fds[1]);
+}
+
+void tst_QSocketNotifier::epollRegularFile()
+{
+    qputenv("QT_EVENTDISPATCHER_EPOLL", "1");
+    QEventDispatcherUNIX *dispatcher = new QEventDispatcherUNIX;
+    qunsetenv("QT_EVENTDISPATCHER_EPOLL");
+    auto d = static_cast<QEventDispatcherUNIXPrivate *>(QObjectPrivate::get(dispatcher));
+    QVERIFY(d->epollFd >= 0);
+
+    // epoll refuses regular files, but poll() reports them as always ready
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write("data"), qint64(4));
+    QVERIFY(file.flush());
+    const int fd = int(file.handle());
+
+    int readActivations = 0;
+    int writeActivations = 0;
+    bool fallbackDropped = false;
+    QScopedPointer<QThread> thread(QThread::create([&]() {
+        QEventLoop loop;
+        QSocketNotifier readNotifier(fd, QSocketNotifier::Read);
+        QSocketNotifier writeNotifier(fd, QSocketNotifier::Write);
+        auto quitWhenBothActivated = [&]() {
+            if (readActivations && writeActivations) {
+                readNotifier.setEnabled(false);
+                writeNotifier.setEnabled(false);
+                fallbackDropped = !d->epollFallbackFds.contains(fd);
+                loop.quit();
+            }
+        };
+        connect(&readNotifier, &QSocketNotifier::activated, [&]() {
+            ++readActivations;
+            quitWhenBothActivated();
+        });
+        connect(&writeNotifier, &QSocketNotifier::activated, [&]() {
+            ++writeActivations;
+            quitWhenBothActivated();
+        });
+        QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+        loop.exec();
+    }));
+    thread->setEventDispatcher(dispatcher);
+    thread->start();
+    QVERIFY(thread->wait(20000));
+
+    QVERIFY(readActivations > 0);
+    QVERIFY(writeActivations > 0);
+    QVERIFY(fallbackDropped);
+}
+#endif
+
 void tst_QSocketNotifier::async_readDatagramSlot()
 {
     char buf[1];
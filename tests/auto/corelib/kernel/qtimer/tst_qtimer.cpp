@@ -84,6 +84,7 @@ private slots:
     void timerOrder_data();
     void timerOrderBackgroundThread();
     void timerOrderBackgroundThread_data() { timerOrder_data(); }
+    void manyTimersOrder();
 
     void dontBlockEvents();
     void postedEventsShouldNotStarveTimers();
@@ -1126,6 +1127,43 @@ void tst_QTimer::timerOrderBackgroundThread()
 #endif
 }
 
+class ManyTimersObject : public QObject
+{
+public:
+    QHash<int, int> intervals;
+    QList<int> firedIntervals;
+
+    void timerEvent(QTimerEvent *te) override
+    {
+        // cancelled timers are not in the hash and are recorded as -1
+        firedIntervals << intervals.value(te->timerId(), -1);
+        killTimer(te->timerId());
+        intervals.remove(te->timerId());
+    }
+};
+
+void tst_QTimer::manyTimersOrder()
+{
+    ManyTimersObject object;
+    int expectedFirings = 0;
+    for (int i = 0; i < 200; ++i) {
+        const int interval = (i * 37) % 20 * 5;
+        const int id = object.startTimer(interval, Qt::PreciseTimer);
+        QVERIFY(id > 0);
+        if (i % 3 == 0) {
+            object.killTimer(id);
+        } else {
+            object.intervals.insert(id, interval);
+            ++expectedFirings;
+        }
+    }
+
+    QTRY_COMPARE(object.firedIntervals.size(), expectedFirings);
+    QVERIFY(object.intervals.isEmpty());
+    QVERIFY(!object.firedIntervals.contains(-1));
+    QVERIFY(std::is_sorted(object.firedIntervals.cbegin(), object.firedIntervals.cend()));
+}
+
 struct StaticSingleShotUser
 {
     StaticSingleShotUser()
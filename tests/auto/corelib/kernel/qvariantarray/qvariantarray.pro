@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qvariantarray
+QT = core testlib
+SOURCES = tst_qvariantarray.cpp
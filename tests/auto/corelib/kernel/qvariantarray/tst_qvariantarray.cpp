@@ -0,0 +1,195 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+
+#include <qvariantarray.h>
+
+class tst_QVariantArray : public QObject
+{
+    Q_OBJECT
+private slots:
+    void defaultConstructed();
+    void appendTyped();
+    void appendVariant();
+    void appendConvertsToElementType();
+    void implicitSharing();
+    void complexType();
+    void fromVariantList();
+    void variantConversion();
+    void equality();
+};
+
+void tst_QVariantArray::defaultConstructed()
+{
+    QVariantArray array;
+    QVERIFY(!array.isValid());
+    QVERIFY(array.isEmpty());
+    QCOMPARE(array.constData(), nullptr);
+    QCOMPARE(array.constData<int>(), nullptr);
+    QVERIFY(array.toVariantList().isEmpty());
+
+    // appending to a null array without a type has no effect
+    QVERIFY(!array.append(QVariant()));
+    QVERIFY(!array.isValid());
+}
+
+void tst_QVariantArray::appendTyped()
+{
+    QVariantArray array(QMetaType::fromType<QRectF>());
+    QVERIFY(array.isValid());
+    QCOMPARE(array.metaType(), QMetaType::fromType<QRectF>());
+
+    for (int i = 0; i < 100; ++i)
+        array.append(QRectF(i, i, 2 * i, 3 * i));
+    QCOMPARE(array.size(), 100);
+    QVERIFY(array.capacity() >= 100);
+
+    const QRectF *rects = array.constData<QRectF>();
+    QVERIFY(rects);
+    QCOMPARE(array.constData<QRect>(), nullptr);
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(rects[i], QRectF(i, i, 2 * i, 3 * i));
+
+    QCOMPARE(array.value<QRectF>(42), QRectF(42, 42, 84, 126));
+    QCOMPARE(array.at(42), QVariant(QRectF(42, 42, 84, 126)));
+    QCOMPARE(array.toList<QRectF>().size(), 100);
+
+    array.clear();
+    QVERIFY(array.isEmpty());
+    QCOMPARE(array.metaType(), QMetaType::fromType<QRectF>());
+}
+
+void tst_QVariantArray::appendVariant()
+{
+    QVariantArray array;
+    QVERIFY(array.append(QVariant(1.5)));
+    QCOMPARE(array.metaType(), QMetaType::fromType<double>());
+    QVERIFY(array.append(QVariant(2.5)));
+    QCOMPARE(array.toList<double>(), QList<double>({ 1.5, 2.5 }));
+}
+
+void tst_QVariantArray::appendConvertsToElementType()
+{
+    QVariantArray array(QMetaType::fromType<double>());
+    QVERIFY(array.append(QVariant(3)));
+    QVERIFY(array.append(QVariant(QStringLiteral("4.25"))));
+    QVERIFY(!array.append(QVariant(QRect(1, 2, 3, 4))));
+    QCOMPARE(array.toList<double>(), QList<double>({ 3.0, 4.25 }));
+
+    // asking for a different type converts each element
+    QCOMPARE(array.toList<int>(), QList<int>({ 3, 4 }));
+    QCOMPARE(array.value<QString>(1), QStringLiteral("4.25"));
+}
+
+void tst_QVariantArray::implicitSharing()
+{
+    QVariantArray a(QMetaType::fromType<int>());
+    for (int i = 0; i < 10; ++i)
+        a.append(i);
+
+    QVariantArray b = a;
+    QCOMPARE(b.constData(), a.constData());
+
+    *static_cast<int *>(b.data(0)) = 42;
+    QVERIFY(b.constData() != a.constData());
+    QCOMPARE(a.value<int>(0), 0);
+    QCOMPARE(b.value<int>(0), 42);
+
+    QVariantArray c = a;
+    c.clear();
+    QCOMPARE(a.size(), 10);
+    QVERIFY(c.isEmpty());
+}
+
+void tst_QVariantArray::complexType()
+{
+    QVariantArray array(QMetaType::fromType<QString>());
+    for (int i = 0; i < 50; ++i)
+        array.append(QString::number(i));
+    QVariantArray copy = array;
+    copy.append(QStringLiteral("extra"));
+    copy.reserve(1000);
+
+    QCOMPARE(array.size(), 50);
+    QCOMPARE(copy.size(), 51);
+    for (int i = 0; i < 50; ++i) {
+        QCOMPARE(array.value<QString>(i), QString::number(i));
+        QCOMPARE(copy.value<QString>(i), QString::number(i));
+    }
+    QCOMPARE(copy.value<QString>(50), QStringLiteral("extra"));
+}
+
+void tst_QVariantArray::fromVariantList()
+{
+    const QVariantList list = { 1, 2.25, QStringLiteral("3"), QVariant() };
+
+    QVariantArray ints = QVariantArray::fromVariantList(list);
+    QCOMPARE(ints.metaType(), QMetaType::fromType<int>());
+    QCOMPARE(ints.toList<int>(), QList<int>({ 1, 2, 3, 0 }));
+
+    QVariantArray doubles = QVariantArray::fromVariantList(list, QMetaType::fromType<double>());
+    QCOMPARE(doubles.toList<double>(), QList<double>({ 1.0, 2.25, 3.0, 0.0 }));
+
+    QVariantList back = doubles.toVariantList();
+    QCOMPARE(back.size(), 4);
+    QCOMPARE(back.at(1), QVariant(2.25));
+
+    QVERIFY(!QVariantArray::fromVariantList(QVariantList()).isValid());
+}
+
+void tst_QVariantArray::variantConversion()
+{
+    const QVariantArray array = QVariantArray::fromList(QList<QPointF>{ { 1, 2 }, { 3, 4 } });
+    const QVariant v = QVariant::fromValue(array);
+    QCOMPARE(v.metaType(), QMetaType::fromType<QVariantArray>());
+
+    QVERIFY(v.canConvert<QVariantList>());
+    const QVariantList list = v.toList();
+    QCOMPARE(list.size(), 2);
+    QCOMPARE(list.at(1), QVariant(QPointF(3, 4)));
+
+    const QVariantArray roundTrip = QVariant(list).value<QVariantArray>();
+    QCOMPARE(roundTrip, array);
+    QCOMPARE(v.value<QVariantArray>().constData(), array.constData());
+}
+
+void tst_QVariantArray::equality()
+{
+    const QVariantArray a = QVariantArray::fromList(QList<int>{ 1, 2, 3 });
+    QVariantArray b = QVariantArray::fromList(QList<int>{ 1, 2, 3 });
+    QCOMPARE(a, b);
+    b.append(4);
+    QVERIFY(a != b);
+    QVERIFY(a != QVariantArray::fromList(QList<uint>{ 1, 2, 3 }));
+    QCOMPARE(QVariantArray(), QVariantArray());
+}
+
+QTEST_MAIN(tst_QVariantArray)
+#include "tst_qvariantarray.moc"
@@ -258,6 +258,9 @@ void tst_QMimeDatabase::mimeTypeForFileName_data()
     QTest::newRow(".doc should assume msword") << "somefile.doc" << "application/msword"; // #204139
     QTest::newRow("glob that uses [] syntax, 1") << "Makefile" << "text/x-makefile";
     QTest::newRow("glob that uses [] syntax, 2") << "makefile" << "text/x-makefile";
+    QTest::newRow("glob that uses [] syntax, 3") << "foo.anim2" << "video/x-anim";
+    QTest::newRow("glob that uses [] syntax, case-insensitive") << "foo.ANIMJ" << "video/x-anim";
+    QTest::newRow("glob that uses [] syntax, no match") << "foo.anim0" << "application/octet-stream";
     QTest::newRow("glob that ends with *, no extension") << "README" << "text/x-readme";
     QTest::newRow("glob that ends with *, extension") << "README.foo" << "text/x-readme";
     QTest::newRow("glob that ends with *, also matches *.txt. Higher weight wins.") << "README.txt" << "text/plain";
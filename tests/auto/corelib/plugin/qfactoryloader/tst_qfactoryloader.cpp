@@ -30,7 +30,12 @@
 #include <QtCore/qdir.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qplugin.h>
+#include <QtCore/qstandardpaths.h>
 #include <private/qfactoryloader_p.h>
+#if QT_CONFIG(library)
+#include <QtCore/qlibrary.h>
+#include <private/qpluginmetadatacache_p.h>
+#endif
 #include "plugin1/plugininterface1.h"
 #include "plugin2/plugininterface2.h"
 
@@ -46,12 +51,16 @@ class tst_QFactoryLoader : public QObject
 #ifdef Q_OS_ANDROID
     QSharedPointer<QTemporaryDir> directory;
 #endif
+    QString m_binFolder;
 
 public slots:
     void initTestCase();
 
 private slots:
     void usingTwoFactoriesFromSameDir();
+#if defined(QT_BUILD_INTERNAL) && QT_CONFIG(library) && defined(QT_SHARED)
+    void metaDataCache();
+#endif
 };
 
 static const char binFolderC[] = "bin";
@@ -64,6 +73,13 @@ void tst_QFactoryLoader::initTestCase()
     QVERIFY(directory->isValid());
     QVERIFY2(QDir::setCurrent(directory->path()), qPrintable("Could not chdir to " + directory->path()));
 #endif
+    // keep the plugin metadata cache out of the user's cache directory
+    QStandardPaths::setTestModeEnabled(true);
+#if defined(QT_BUILD_INTERNAL) && QT_CONFIG(library) && defined(QT_SHARED)
+    m_binFolder = QFileInfo(QFINDTESTDATA(binFolderC)).canonicalFilePath();
+    QFile::remove(QPluginMetaDataCache::cacheFileName(m_binFolder));
+#endif
+
     const QString binFolder = QFINDTESTDATA(binFolderC);
     QVERIFY2(!binFolder.isEmpty(), "Unable to locate 'bin' folder");
 #if QT_CONFIG(library)
@@ -92,5 +108,52 @@ void tst_QFactoryLoader::usingTwoFactoriesFromSameDir()
     QCOMPARE(plugin2->pluginName(), QLatin1String("Plugin2 ok"));
 }
 
+#if defined(QT_BUILD_INTERNAL) && QT_CONFIG(library) && defined(QT_SHARED)
+void tst_QFactoryLoader::metaDataCache()
+{
+    if (!QPluginMetaDataCache::isEnabled())
+        QSKIP("The plugin metadata cache is disabled");
+
+    const QString suffix = QLatin1Char('/') + QLatin1String(binFolderC);
+    QFactoryLoader loader(PluginInterface1_iid, suffix);
+    QCOMPARE(loader.metaData().size(), 1);
+
+    // scanning the directory wrote the cache
+    const QString cacheFile = QPluginMetaDataCache::cacheFileName(m_binFolder);
+    QVERIFY(!cacheFile.isEmpty());
+    QVERIFY2(QFile::exists(cacheFile), qPrintable(cacheFile));
+
+    // read it back from disk
+    QPluginMetaDataCache::clear();
+    QFileInfoList plugins = QDir(m_binFolder).entryInfoList(QDir::Files);
+    plugins.erase(std::remove_if(plugins.begin(), plugins.end(), [](const QFileInfo &info) {
+                      return !QLibrary::isLibrary(info.fileName());
+                  }), plugins.end());
+    QVERIFY(!plugins.isEmpty());
+    int pluginCount = 0;
+    for (const QFileInfo &plugin : qAsConst(plugins)) {
+        QJsonObject metaData;
+        QVERIFY2(QPluginMetaDataCache::lookup(plugin.filePath(), &metaData),
+                 qPrintable(plugin.filePath()));
+        const QString iid = metaData.value(QLatin1String("IID")).toString();
+        if (iid == QLatin1String(PluginInterface1_iid) || iid == QLatin1String(PluginInterface2_iid))
+            ++pluginCount;
+    }
+    QCOMPARE(pluginCount, 2);
+
+    // a modified plugin is not looked up from the cache
+    const QString plugin = plugins.first().filePath();
+    const QDateTime lastModified = plugins.first().lastModified();
+    QFile file(plugin);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.setFileTime(lastModified.addSecs(-1), QFileDevice::FileModificationTime));
+    QJsonObject metaData;
+    QVERIFY(!QPluginMetaDataCache::lookup(plugin, &metaData));
+    QVERIFY(file.setFileTime(lastModified, QFileDevice::FileModificationTime));
+    QVERIFY(QPluginMetaDataCache::lookup(plugin, &metaData));
+    QPluginMetaDataCache::clear();
+}
+#endif
+
 QTEST_MAIN(tst_QFactoryLoader)
 #include "tst_qfactoryloader.moc"
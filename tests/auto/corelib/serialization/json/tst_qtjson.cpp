@@ -34,6 +34,7 @@ QT_WARNING_DISABLE_DEPRECATED
 #include "qjsonobject.h"
 #include "qjsonvalue.h"
 #include "qjsondocument.h"
+#include "qjsonview.h"
 #include "qregularexpression.h"
 #include <limits>
 
@@ -59,6 +60,7 @@ private Q_SLOTS:
     void testObjectSimple();
     void testObjectSmallKeys();
     void testObjectInsertCopies();
+    void testObjectFromKeyValueList();
     void testArraySimple();
     void testArrayInsertCopies();
     void testValueObject();
@@ -105,6 +107,7 @@ private Q_SLOTS:
     void fromJsonErrors();
     void parseNumbers();
     void parseStrings();
+    void parseLongStringsAndWhitespace();
     void parseDuplicateKeys();
     void testParser();
 
@@ -167,6 +170,10 @@ private Q_SLOTS:
     void fromToVariantConversions_data();
     void fromToVariantConversions();
 
+    void jsonView();
+    void jsonViewMatchesDocument_data();
+    void jsonViewMatchesDocument();
+
 private:
     QString testDataDir;
 };
@@ -660,6 +667,31 @@ void tst_QtJson::testObjectInsertCopies()
     }
 }
 
+void tst_QtJson::testObjectFromKeyValueList()
+{
+    QList<QPair<QString, QJsonValue>> list;
+    QJsonObject expected;
+    for (int i = 0; i < 200; ++i) {
+        // unsorted, with duplicates and a mix of ASCII and non-ASCII keys
+        const QString key = QString::number((i * 37) % 150) + (i % 3 ? QString() : QStringLiteral("\u00e9"));
+        const QJsonValue value = i % 11 ? QJsonValue(i) : QJsonValue(QJsonValue::Undefined);
+        list.append({ key, value });
+        expected.insert(key, value);
+    }
+
+    const QJsonObject object = QJsonObject::fromKeyValueList(list);
+    QCOMPARE(object, expected);
+    QCOMPARE(object.keys(), expected.keys());
+    for (const QString &key : expected.keys())
+        QVERIFY(object.contains(key));
+
+    QVERIFY(QJsonObject::fromKeyValueList({}).isEmpty());
+    QJsonObject initialized{ {"b", 1}, {"a", 2}, {"b", 3} };
+    QCOMPARE(initialized.size(), 2);
+    QCOMPARE(initialized.value("b"), QJsonValue(3));
+    QCOMPARE(initialized.keys(), QStringList({ "a", "b" }));
+}
+
 void tst_QtJson::testArraySimple()
 {
     QJsonArray array;
@@ -2149,6 +2181,44 @@ void tst_QtJson::parseNumbers()
     }
 }
 
+void tst_QtJson::parseLongStringsAndWhitespace()
+{
+    // The parser scans whitespace and strings in blocks; vary the lengths so
+    // that every special character is seen at each position of a block.
+    const char *const specials[] = { "", "\\\"", "\\n", "\\u00e9", UNICODE_DJE };
+    const QString decodedSpecials[] = { QString(), QString("\""), QString("\n"),
+                                        QString(QChar(0xe9)), QString(QChar(0x402)) };
+    const char whitespace[] = " \t\r\n";
+
+    for (int length = 0; length < 40; ++length) {
+        for (int special = 0; special < int(std::size(specials)); ++special) {
+            QByteArray spaces;
+            for (int i = 0; i < length; ++i)
+                spaces += whitespace[i % 4];
+
+            const QByteArray plain(length, 'a');
+            const QByteArray str = plain + specials[special] + plain;
+            const QByteArray json = spaces + "[" + spaces + "\"" + str + "\"" + spaces + ","
+                    + spaces + "1" + spaces + "]" + spaces;
+
+            QJsonParseError error;
+            const QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+            QCOMPARE(error.error, QJsonParseError::NoError);
+            const QJsonArray array = doc.array();
+            QCOMPARE(array.size(), 2);
+            QCOMPARE(array.at(0).toString(),
+                     QString(plain) + decodedSpecials[special] + QString(plain));
+            QCOMPARE(array.at(1).toInt(), 1);
+
+            // Unterminated strings must not be read past their end
+            QJsonDocument::fromJson("[\"" + str, &error);
+            QCOMPARE(error.error, QJsonParseError::UnterminatedString);
+            QCOMPARE(QJsonDocument::fromJson("[" + spaces, &error), QJsonDocument());
+            QVERIFY(error.error != QJsonParseError::NoError);
+        }
+    }
+}
+
 void tst_QtJson::parseStrings()
 {
     const char *strings [] =
@@ -3073,6 +3143,11 @@ void tst_QtJson::parseErrorOffset()
 
     QVERIFY(error.error != QJsonParseError::NoError);
     QCOMPARE(error.offset, errorOffset);
+
+    QJsonParseError viewError;
+    QVERIFY(QJsonView::fromJson(json, &viewError).isUndefined());
+    QCOMPARE(viewError.error, error.error);
+    QCOMPARE(viewError.offset, errorOffset);
 }
 
 void tst_QtJson::implicitValueType()
@@ -3454,5 +3529,139 @@ void tst_QtJson::fromToVariantConversions()
     }
 }
 
+void tst_QtJson::jsonView()
+{
+    const QByteArray json = "{ \"id\": 42, \"name\": \"caf\xc3\xa9\", \"escaped\": \"a\\tb\\u0402\",\n"
+                            "  \"big\": 1e100, \"fraction\": -2.5, \"t\": true, \"f\": false,\n"
+                            "  \"n\": null, \"nested\": { \"list\": [ 1, [ \"]\" ], { \"}\": {} } ] },\n"
+                            "  \"k\\u0065y\": 1, \"dup\": 1, \"dup\": 2 }";
+    QJsonParseError error;
+    const QJsonView root = QJsonView::fromJson(json, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QVERIFY(root.isObject());
+    QCOMPARE(root.size(), 12);
+    QCOMPARE(root.rawJson(), QByteArrayView(json));
+
+    QCOMPARE(root[u"id"].type(), QJsonValue::Double);
+    QCOMPARE(root.value(QLatin1String("id")).toInt(), 42);
+    QCOMPARE(root[QString("id")].toInteger(), 42);
+    QCOMPARE(root[u"id"].toString(), QString());
+
+    QCOMPARE(root[u"name"].toString(), QString::fromUtf8("caf\xc3\xa9"));
+    QCOMPARE(root[u"name"].toUtf8StringView(), QByteArrayView("caf\xc3\xa9"));
+    QCOMPARE(root[u"escaped"].toString(), QString::fromUtf8("a\tb\xd0\x82"));
+    QVERIFY(root[u"escaped"].toUtf8StringView().isNull());
+
+    QCOMPARE(root[u"big"].toDouble(), 1e100);
+    QCOMPARE(root[u"big"].toInt(-1), -1);
+    QCOMPARE(root[u"fraction"].toDouble(), -2.5);
+    QCOMPARE(root[u"fraction"].toValue(), QJsonValue(-2.5));
+    QCOMPARE(root[u"t"].toBool(), true);
+    QCOMPARE(root[u"f"].toBool(true), false);
+    QVERIFY(root[u"n"].isNull());
+    QVERIFY(root[u"missing"].isUndefined());
+    QVERIFY(!root.contains(u"missing"));
+    QVERIFY(root.contains(QLatin1String("key")));
+    QCOMPARE(root[u"key"].toInt(), 1);
+    QCOMPARE(root[u"dup"].toInt(), 2);
+
+    const QJsonView list = root[u"nested"][u"list"];
+    QVERIFY(list.isArray());
+    QCOMPARE(list.size(), 3);
+    QCOMPARE(list[0].toInt(), 1);
+    QCOMPARE(list[1][0].toString(), QString("]"));
+    QCOMPARE(list[2].keys(), QStringList { "}" });
+    QCOMPARE(list[2][u"}"].size(), 0);
+    QVERIFY(list[3].isUndefined());
+    QVERIFY(list[-1].isUndefined());
+    QCOMPARE(list.rawJson(), QByteArrayView("[ 1, [ \"]\" ], { \"}\": {} } ]"));
+
+    QCOMPARE(root.keys(), (QStringList { "id", "name", "escaped", "big", "fraction", "t", "f",
+                                         "n", "nested", "key", "dup", "dup" }));
+    QCOMPARE(root.toValue(), QJsonValue(QJsonDocument::fromJson(json).object()));
+
+    // Views share the source and its index, also when used from copies
+    QJsonView copy = list;
+    QCOMPARE(copy[1].rawJson().data(), list[1].rawJson().data());
+
+    QJsonView undefined;
+    QVERIFY(undefined.isUndefined());
+    QCOMPARE(undefined.size(), 0);
+    QVERIFY(undefined[0].isUndefined());
+    QVERIFY(undefined[u"id"].isUndefined());
+    QVERIFY(undefined.rawJson().isNull());
+    QCOMPARE(undefined.toValue(), QJsonValue(QJsonValue::Undefined));
+
+    QVERIFY(QJsonView::fromJson("42", &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::IllegalValue);
+    QVERIFY(QJsonView::fromJson("[] x", &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::GarbageAtEnd);
+    QVERIFY(QJsonView::fromJson("[\"\\u12\"]", &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::IllegalEscapeSequence);
+    QVERIFY(QJsonView::fromJson("[\"\\", &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::UnterminatedString);
+    QVERIFY(QJsonView::fromJson("[\"\xff\"]", &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::IllegalUTF8String);
+    QVERIFY(QJsonView::fromJson("[1", &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::TerminationByNumber);
+    QVERIFY(QJsonView::fromJson(QByteArray(2000, '[') + QByteArray(2000, ']'), &error).isUndefined());
+    QCOMPARE(error.error, QJsonParseError::DeepNesting);
+}
+
+void tst_QtJson::jsonViewMatchesDocument_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    QTest::newRow("test.json") << QString("test.json");
+    QTest::newRow("test2.json") << QString("test2.json");
+    QTest::newRow("test3.json") << QString("test3.json");
+    QTest::newRow("bom.json") << QString("bom.json");
+}
+
+void tst_QtJson::jsonViewMatchesDocument()
+{
+    QFETCH(QString, fileName);
+
+    QFile file(testDataDir + QLatin1Char('/') + fileName);
+    QVERIFY(file.open(QFile::ReadOnly));
+    const QByteArray json = file.readAll();
+
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+    QJsonParseError viewError;
+    const QJsonView view = QJsonView::fromJson(json, &viewError);
+    QCOMPARE(viewError.error, error.error);
+    QCOMPARE(viewError.offset, error.offset);
+    if (error.error != QJsonParseError::NoError)
+        return;
+
+    const QJsonValue expected = doc.isArray() ? QJsonValue(doc.array()) : QJsonValue(doc.object());
+    QCOMPARE(view.toValue(), expected);
+
+    // Walk the document through the view, member by member
+    std::function<void(const QJsonView &, const QJsonValue &)> compare =
+            [&compare](const QJsonView &view, const QJsonValue &value) {
+        QCOMPARE(view.type(), value.type());
+        if (value.isObject()) {
+            const QJsonObject object = value.toObject();
+            for (auto it = object.begin(); it != object.end(); ++it)
+                compare(view[it.key()], it.value());
+        } else if (value.isArray()) {
+            const QJsonArray array = value.toArray();
+            QCOMPARE(view.size(), array.size());
+            for (qsizetype i = 0; i < array.size(); ++i)
+                compare(view[i], array.at(i));
+        } else if (value.isString()) {
+            QCOMPARE(view.toString(), value.toString());
+        } else if (value.isDouble()) {
+            QCOMPARE(view.toDouble(), value.toDouble());
+            QCOMPARE(view.toValue(), value);
+        } else {
+            QCOMPARE(view.toValue(), value);
+        }
+    };
+    compare(view, expected);
+}
+
 QTEST_MAIN(tst_QtJson)
 #include "tst_qtjson.moc"
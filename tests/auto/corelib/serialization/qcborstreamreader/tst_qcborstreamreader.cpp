@@ -57,6 +57,8 @@ private Q_SLOTS:
     void fixed();
     void strings_data();
     void strings();
+    void stringChunkViews_data() { strings_data(); }
+    void stringChunkViews();
     void tags_data();
     void tags() { fixed(); }
     void emptyContainers_data();
@@ -723,6 +725,47 @@ void tst_QCborStreamReader::strings()
         QCOMPARE(chunks, 1);
 }
 
+void tst_QCborStreamReader::stringChunkViews()
+{
+    QFETCH(QByteArray, data);
+    QFETCH_GLOBAL(bool, useDevice);
+
+    QBuffer buffer(&data), controlBuffer(&data);
+    QCborStreamReader reader(data), controlReader(data);
+    if (useDevice) {
+        buffer.open(QIODevice::ReadOnly);
+        controlBuffer.open(QIODevice::ReadOnly);
+        reader.setDevice(&buffer);
+        controlReader.setDevice(&controlBuffer);
+    }
+    QVERIFY(reader.isString() || reader.isByteArray());
+
+    forever {
+        QCborStreamReader::StringResult<QByteArray> controlData;
+        if (reader.isString()) {
+            auto r = controlReader.readString();
+            controlData.data = r.data.toUtf8();
+            controlData.status =  r.status;
+        } else {
+            controlData = controlReader.readByteArray();
+        }
+        QVERIFY(controlData.status != QCborStreamReader::Error);
+
+        auto r = reader.readStringChunkView();
+        QCOMPARE(r.status, controlData.status);
+        if (r.status == QCborStreamReader::EndOfString)
+            break;
+        QCOMPARE(r.data.toByteArray(), controlData.data);
+
+        if (!useDevice && !r.data.isEmpty()) {
+            // the view must point into the source data
+            QVERIFY(r.data.data() >= data.constData());
+            QVERIFY(r.data.data() + r.data.size() <= data.constData() + data.size());
+        }
+    }
+    QVERIFY(reader.lastError() == QCborError::NoError);
+}
+
 void tst_QCborStreamReader::tags_data()
 {
     addColumns();
@@ -85,6 +85,7 @@ private slots:
     void mapMutateWithCopies();
     void mapStringValues();
     void mapStringKeys();
+    void mapFromKeyValueList();
     void mapInsertRemove_data() { basics_data(); }
     void mapInsertRemove();
     void mapInsertTagged_data() { basics_data(); }
@@ -1313,6 +1314,39 @@ void tst_QCborValue::mapStringValues()
     QVERIFY(m.isEmpty());
 }
 
+void tst_QCborValue::mapFromKeyValueList()
+{
+    QList<QCborMap::value_type> strings;
+    QCborMap expected;
+    for (int i = 0; i < 200; ++i) {
+        // mix of US-ASCII, Latin-1 and UTF-16 string keys
+        QCborValue key;
+        if (i % 3 == 0)
+            key = QLatin1String(QByteArray::number((i * 37) % 120));
+        else if (i % 3 == 1)
+            key = QString::number((i * 37) % 120);
+        else
+            key = QString::number((i * 37) % 120) + QChar(0xe9);
+        strings.append({ key, i });
+        expected.insert(key, i);
+    }
+    QCOMPARE(QCborMap::fromKeyValueList(strings), expected);
+
+    QList<QCborMap::value_type> mixed = {
+        { 1, "one" }, { "one", 1 }, { 2, "two" }, { 1, "uno" }, { QByteArray("one"), 3 },
+        { "one", -1 }, { false, 0 }
+    };
+    expected = QCborMap();
+    for (const auto &pair : qAsConst(mixed))
+        expected.insert(pair.first, pair.second);
+    const QCborMap m = QCborMap::fromKeyValueList(mixed);
+    QCOMPARE(m, expected);
+    QCOMPARE(m.keys(), expected.keys());
+    QCOMPARE(m.size(), 5);
+
+    QVERIFY(QCborMap::fromKeyValueList({}).isEmpty());
+}
+
 void tst_QCborValue::mapStringKeys()
 {
     QCborMap m{{QLatin1String("Hello"), 1}, {QStringLiteral("World"), 2}};
@@ -44,6 +44,23 @@ static_assert(!QTypeTraits::has_ostream_operator_v<QDataStream, NonStreamable>);
 static_assert(!QTypeTraits::has_ostream_operator_v<QDataStream, QList<NonStreamable>>);
 static_assert(!QTypeTraits::has_ostream_operator_v<QDataStream, QMap<int, NonStreamable>>);
 
+struct StreamedGadget
+{
+    Q_GADGET
+    Q_PROPERTY(int id MEMBER id)
+    Q_PROPERTY(QString name MEMBER name)
+    Q_PROPERTY(QList<qint16> samples MEMBER samples)
+    Q_PROPERTY(double computed READ computed)
+public:
+    int id = 0;
+    QString name;
+    QList<qint16> samples;
+
+    double computed() const { return 1.5; }
+    bool operator==(const StreamedGadget &other) const
+    { return id == other.id && name == other.name && samples == other.samples; }
+};
+
 class tst_QDataStream : public QObject
 {
 Q_OBJECT
@@ -193,6 +210,9 @@ private slots:
     void status_QHash_QMap();
 
     void status_QList_QVector();
+    void stream_QList_integral_data();
+    void stream_QList_integral();
+    void stream_gadget();
 
     void streamToAndFromQByteArray();
 
@@ -3133,6 +3153,136 @@ void tst_QDataStream::status_QHash_QMap()
             break; \
     }
 
+void tst_QDataStream::stream_QList_integral_data()
+{
+    QTest::addColumn<QDataStream::ByteOrder>("byteOrder");
+    QTest::newRow("BigEndian") << QDataStream::BigEndian;
+    QTest::newRow("LittleEndian") << QDataStream::LittleEndian;
+}
+
+void tst_QDataStream::stream_QList_integral()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    // the bulk path must produce the same bytes as the element-wise one
+    const QList<qint16> shorts = { 0, 1, -1, 0x1234, SHRT_MIN, SHRT_MAX };
+    const QList<quint32> uints = { 0, 1, 0x12345678, UINT_MAX };
+    const QList<qint64> longs = { 0, -1, Q_INT64_C(0x123456789abcdef0), LLONG_MIN };
+    const QList<quint8> bytes = { 0, 1, 0x80, 0xff };
+
+    QByteArray bulk, elementWise;
+    {
+        QDataStream out(&bulk, QIODevice::WriteOnly);
+        out.setByteOrder(byteOrder);
+        out << shorts << uints << longs << bytes << QList<int>();
+        QCOMPARE(out.status(), QDataStream::Ok);
+    }
+    {
+        QDataStream out(&elementWise, QIODevice::WriteOnly);
+        out.setByteOrder(byteOrder);
+        out << quint32(shorts.size());
+        for (qint16 v : shorts)
+            out << v;
+        out << quint32(uints.size());
+        for (quint32 v : uints)
+            out << v;
+        out << quint32(longs.size());
+        for (qint64 v : longs)
+            out << v;
+        out << quint32(bytes.size());
+        for (quint8 v : bytes)
+            out << v;
+        out << quint32(0);
+    }
+    QCOMPARE(bulk, elementWise);
+
+    QDataStream in(bulk);
+    in.setByteOrder(byteOrder);
+    QList<qint16> shorts2;
+    QList<quint32> uints2;
+    QList<qint64> longs2;
+    QList<quint8> bytes2;
+    QList<int> empty = { 1 };
+    in >> shorts2 >> uints2 >> longs2 >> bytes2 >> empty;
+    QCOMPARE(in.status(), QDataStream::Ok);
+    QCOMPARE(shorts2, shorts);
+    QCOMPARE(uints2, uints);
+    QCOMPARE(longs2, longs);
+    QCOMPARE(bytes2, bytes);
+    QVERIFY(empty.isEmpty());
+    QVERIFY(in.atEnd());
+
+    // truncated data and a count larger than the data
+    for (int len : { 4, 5, 8, 11 }) {
+        QDataStream truncated(bulk.left(len));
+        truncated.setByteOrder(byteOrder);
+        QList<qint16> list = { 1 };
+        truncated >> list;
+        QCOMPARE(truncated.status(), QDataStream::ReadPastEnd);
+        QVERIFY(list.isEmpty());
+    }
+    QByteArray huge("\xff\xff\xff\xf0\x01\x02\x03\x04", 8);
+    QDataStream hugeStream(huge);
+    hugeStream.setByteOrder(byteOrder);
+    QList<qint32> list;
+    hugeStream >> list;
+    QCOMPARE(hugeStream.status(), QDataStream::ReadPastEnd);
+    QVERIFY(list.isEmpty());
+}
+
+void tst_QDataStream::stream_gadget()
+{
+    StreamedGadget gadget;
+    gadget.id = 42;
+    gadget.name = QStringLiteral("snapshot");
+    gadget.samples = { 1, -2, 3 };
+
+    const QMetaType type = QMetaType::fromType<StreamedGadget>();
+
+    // the stored, writable properties in declaration order, without type names
+    QByteArray data, expected;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        QVERIFY(type.save(out, &gadget));
+        QCOMPARE(out.status(), QDataStream::Ok);
+    }
+    {
+        QDataStream out(&expected, QIODevice::WriteOnly);
+        out << gadget.id << gadget.name << gadget.samples;
+    }
+    QCOMPARE(data, expected);
+
+    StreamedGadget loaded;
+    {
+        QDataStream in(data);
+        QVERIFY(type.load(in, &loaded));
+        QCOMPARE(in.status(), QDataStream::Ok);
+        QVERIFY(in.atEnd());
+    }
+    QCOMPARE(loaded, gadget);
+
+    {
+        QDataStream in(data.left(data.size() - 1));
+        StreamedGadget partial;
+        type.load(in, &partial);
+        QCOMPARE(in.status(), QDataStream::ReadPastEnd);
+    }
+
+    // and through QVariant
+    qRegisterMetaType<StreamedGadget>();
+    QByteArray variantData;
+    {
+        QDataStream out(&variantData, QIODevice::WriteOnly);
+        out << QVariant::fromValue(gadget);
+        QCOMPARE(out.status(), QDataStream::Ok);
+    }
+    QDataStream in(variantData);
+    QVariant v;
+    in >> v;
+    QCOMPARE(in.status(), QDataStream::Ok);
+    QCOMPARE(v.value<StreamedGadget>(), gadget);
+}
+
 void tst_QDataStream::status_QList_QVector()
 {
     typedef QList<QString> List;
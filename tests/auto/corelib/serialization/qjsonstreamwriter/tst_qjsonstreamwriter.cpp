@@ -0,0 +1,253 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtCore/qjsonstreamwriter.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+
+Q_DECLARE_METATYPE(QJsonDocument::JsonFormat)
+
+class tst_QJsonStreamWriter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void matchesToJson_data();
+    void matchesToJson();
+    void scalars();
+    void appendValue();
+    void mismatchedEnd();
+    void bufferedDevice();
+};
+
+static const char sampleJson[] = R"({
+    "array": [ true, 999, "string", -1.5, null, [], {}, [ [ 1 ] ] ],
+    "empty": {},
+    "escapes": "\"\\\b\f\n\r\t\u0001\u00e9\u20ac",
+    "nested": { "a": { "b": [ { "c": false } ] } },
+    "big": 1e300,
+    "small": -4.9406564584124654e-324
+})";
+
+// Writes a QJsonValue with the stream API, as a user would
+static void writeValue(QJsonStreamWriter &writer, const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Array:
+        writer.startArray();
+        for (const QJsonValue element : value.toArray())
+            writeValue(writer, element);
+        QVERIFY(writer.endArray());
+        break;
+    case QJsonValue::Object: {
+        writer.startObject();
+        const QJsonObject object = value.toObject();
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            writer.appendKey(it.key());
+            writeValue(writer, it.value());
+        }
+        QVERIFY(writer.endObject());
+        break;
+    }
+    case QJsonValue::Bool:
+        writer.append(value.toBool());
+        break;
+    case QJsonValue::Double:
+        if (value.toDouble() == value.toInteger())
+            writer.append(value.toInteger());
+        else
+            writer.append(value.toDouble());
+        break;
+    case QJsonValue::String:
+        writer.append(value.toString());
+        break;
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        writer.appendNull();
+        break;
+    }
+}
+
+void tst_QJsonStreamWriter::matchesToJson_data()
+{
+    QTest::addColumn<QJsonDocument>("document");
+    QTest::addColumn<QJsonDocument::JsonFormat>("format");
+
+    const QJsonDocument sample = QJsonDocument::fromJson(sampleJson);
+    QVERIFY(sample.isObject());
+    const QJsonDocument emptyArray{QJsonArray()};
+    const QJsonDocument emptyObject{QJsonObject()};
+    const QJsonDocument array{sample.object().value("array").toArray()};
+
+    const QJsonDocument::JsonFormat formats[] = { QJsonDocument::Indented, QJsonDocument::Compact };
+    for (QJsonDocument::JsonFormat format : formats) {
+        const char *name = format == QJsonDocument::Indented ? "indented" : "compact";
+        QTest::addRow("sample-%s", name) << sample << format;
+        QTest::addRow("empty-array-%s", name) << emptyArray << format;
+        QTest::addRow("empty-object-%s", name) << emptyObject << format;
+        QTest::addRow("array-%s", name) << array << format;
+    }
+}
+
+void tst_QJsonStreamWriter::matchesToJson()
+{
+    QFETCH(QJsonDocument, document);
+    QFETCH(QJsonDocument::JsonFormat, format);
+    const QJsonValue value = document.isArray() ? QJsonValue(document.array())
+                                                : QJsonValue(document.object());
+
+    QByteArray streamed;
+    {
+        QJsonStreamWriter writer(&streamed, format);
+        QCOMPARE(writer.format(), format);
+        writeValue(writer, value);
+    }
+    QCOMPARE(streamed, document.toJson(format));
+
+    QByteArray appended;
+    {
+        QJsonStreamWriter writer(&appended, format);
+        writer.append(value);
+    }
+    QCOMPARE(appended, document.toJson(format));
+
+    // Values appended inside containers are indented to their level
+    QByteArray wrapped;
+    {
+        QJsonStreamWriter writer(&wrapped, format);
+        writer.startArray();
+        writer.append(value);
+        writer.startObject();
+        writer.appendKey(QLatin1String("key"));
+        writer.append(value);
+        QVERIFY(writer.endObject());
+        QVERIFY(writer.endArray());
+    }
+    const QJsonArray expected = { value, QJsonObject { { "key", value } } };
+    QCOMPARE(wrapped, QJsonDocument(expected).toJson(format));
+}
+
+void tst_QJsonStreamWriter::scalars()
+{
+    QByteArray json;
+    QJsonStreamWriter writer(&json, QJsonDocument::Compact);
+    writer.startArray();
+    writer.append(0);
+    writer.append(std::numeric_limits<qint64>::min());
+    writer.append(0.1);
+    writer.append(qInf());
+    writer.append(qQNaN());
+    writer.append(true);
+    writer.append(false);
+    writer.appendNull();
+    writer.append(QLatin1String("l\xe9"));
+    writer.append(u"\u20ac");
+    writer.append("\xe2\x82\xac");
+    writer.append(QString());
+    writer.append(QStringView(u"\xd800"));
+    QVERIFY(writer.endArray());
+    QCOMPARE(json, QByteArray("[0,-9223372036854775808,0.1,null,null,true,false,null,"
+                              "\"l\xc3\xa9\",\"\xe2\x82\xac\",\"\xe2\x82\xac\",\"\",\"\\ud800\"]"));
+}
+
+void tst_QJsonStreamWriter::appendValue()
+{
+    QByteArray json;
+    QJsonStreamWriter writer(&json, QJsonDocument::Compact);
+    writer.startObject();
+    writer.appendKey(u"undefined");
+    writer.append(QJsonValue(QJsonValue::Undefined));
+    writer.appendKey(u"object");
+    writer.append(QJsonObject { { "a", 1 }, { "b", QJsonArray { 2, "three" } } });
+    QVERIFY(writer.endObject());
+    QCOMPARE(json, QByteArray(R"({"undefined":null,"object":{"a":1,"b":[2,"three"]}})"));
+}
+
+void tst_QJsonStreamWriter::mismatchedEnd()
+{
+    QByteArray json;
+    QJsonStreamWriter writer(&json, QJsonDocument::Compact);
+    QVERIFY(!writer.endArray());
+    QVERIFY(!writer.endObject());
+
+    writer.startArray();
+    QVERIFY(!writer.endObject());
+    writer.startObject();
+    QVERIFY(!writer.endArray());
+    writer.appendKey(u"key");
+    QVERIFY(!writer.endObject()); // missing value
+    writer.append(1);
+    QVERIFY(writer.endObject());
+    QVERIFY(writer.endArray());
+    QCOMPARE(json, QByteArray(R"([{"key":1}])"));
+}
+
+void tst_QJsonStreamWriter::bufferedDevice()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+    QJsonStreamWriter writer(&buffer);
+    QCOMPARE(writer.device(), static_cast<QIODevice *>(&buffer));
+    QCOMPARE(writer.bufferSize(), qsizetype(16 * 1024));
+    writer.setBufferSize(100);
+    QCOMPARE(writer.bufferSize(), qsizetype(100));
+
+    QJsonArray expected;
+    writer.startArray();
+    QCOMPARE(buffer.size(), qint64(0));
+    qint64 lastSize = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const QString value = QString::number(i).repeated(i % 7);
+        expected.append(value);
+        writer.append(value);
+        // The text is passed on in blocks of about the buffer size
+        QVERIFY(buffer.size() >= lastSize);
+        QVERIFY(buffer.size() - lastSize < 200);
+        lastSize = buffer.size();
+    }
+    QVERIFY(buffer.size() > 0);
+    QVERIFY(writer.endArray());
+    writer.flush();
+    QCOMPARE(buffer.data(), QJsonDocument(expected).toJson());
+
+    // Switching devices writes the buffered text to the old device
+    QBuffer other;
+    QVERIFY(other.open(QIODevice::WriteOnly));
+    writer.setDevice(&other);
+    writer.append(u"tail");
+    QCOMPARE(other.size(), qint64(0));
+    writer.setDevice(nullptr);
+    QCOMPARE(other.data(), QByteArray("\"tail\""));
+    QVERIFY(!writer.device());
+}
+
+QTEST_MAIN(tst_QJsonStreamWriter)
+
+#include "tst_qjsonstreamwriter.moc"
@@ -579,6 +579,8 @@ private slots:
     void roundTrip_data() const;
 
     void entityExpansionLimit() const;
+    void longTextRuns_data() const;
+    void longTextRuns() const;
 
 private:
     static QByteArray readFile(const QString &filename);
@@ -1664,6 +1666,70 @@ void tst_QXmlStream::roundTrip_data() const
         "</root>\n";
 }
 
+void tst_QXmlStream::longTextRuns_data() const
+{
+    QTest::addColumn<int>("chunkSize");
+    QTest::newRow("whole") << 0;
+    QTest::newRow("1") << 1;
+    QTest::newRow("7") << 7;
+    QTest::newRow("100") << 100;
+}
+
+void tst_QXmlStream::longTextRuns() const
+{
+    // runs long enough for the fast scanners, with special characters at
+    // every offset relative to the scanning blocks and the chunk boundaries
+    QFETCH(int, chunkSize);
+
+    QString xml = QStringLiteral("<?xml version=\"1.0\"?>\n<root>");
+    QStringList texts, values;
+    for (int i = 0; i < 40; ++i) {
+        const QString run(i, QLatin1Char('x'));
+        const QString blanks(i, i % 2 ? QLatin1Char(' ') : QLatin1Char('\t'));
+        const QString value = run + QString::fromUtf8("\xc3\xa9 ") + run;
+        const QString text = blanks + run + QString::fromUtf8("\xe6\x97\xa5") + run + QLatin1Char(']') + run;
+        xml += QLatin1String("<e v=\"") + value + QLatin1String("\" w='") + run + QLatin1String("&amp;\"'>")
+                + text + QLatin1String("&lt;") + run + QLatin1String("</e>\n") + blanks;
+        values << value << run + QLatin1String("&\"");
+        texts << text + QLatin1Char('<') + run;
+    }
+    xml += QLatin1String("</root>\n");
+    const QByteArray data = xml.toUtf8();
+
+    QXmlStreamReader reader;
+    if (!chunkSize)
+        reader.addData(data);
+    int pos = 0;
+    QStringList readTexts, readValues;
+    QString currentText;
+    while (true) {
+        if (chunkSize && pos < data.size()) {
+            reader.addData(data.mid(pos, chunkSize));
+            pos += chunkSize;
+        }
+        const QXmlStreamReader::TokenType token = reader.readNext();
+        if (token == QXmlStreamReader::Invalid) {
+            QCOMPARE(reader.error(), QXmlStreamReader::PrematureEndOfDocumentError);
+            QVERIFY(chunkSize && pos < data.size());
+            continue;
+        }
+        if (token == QXmlStreamReader::EndDocument)
+            break;
+        if (token == QXmlStreamReader::StartElement && reader.name() == QLatin1String("e")) {
+            for (const QXmlStreamAttribute &attribute : reader.attributes())
+                readValues << attribute.value().toString();
+            currentText.clear();
+        } else if (token == QXmlStreamReader::Characters) {
+            currentText += reader.text();
+        } else if (token == QXmlStreamReader::EndElement && reader.name() == QLatin1String("e")) {
+            readTexts << currentText;
+        }
+    }
+    QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+    QCOMPARE(readValues, values);
+    QCOMPARE(readTexts, texts);
+}
+
 void tst_QXmlStream::entityExpansionLimit() const
 {
     QString xml = QStringLiteral("<?xml version=\"1.0\"?>"
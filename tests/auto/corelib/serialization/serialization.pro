@@ -5,6 +5,7 @@ SUBDIRS = \
     qcborstreamwriter \
     qcborvalue \
     qcborvalue_json \
+    qjsonstreamwriter \
     qdatastream \
     qdatastream_core_pixmap \
     qtextstream \
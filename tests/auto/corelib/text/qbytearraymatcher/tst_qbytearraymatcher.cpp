@@ -44,6 +44,10 @@ private slots:
     void interface();
     void indexIn();
     void staticByteArrayMatcher();
+    void multiMatcher_data();
+    void multiMatcher();
+    void multiMatcherFindAll();
+    void multiMatcherAgainstSingleMatchers();
 };
 
 void tst_QByteArrayMatcher::interface()
@@ -208,6 +212,153 @@ void tst_QByteArrayMatcher::staticByteArrayMatcher()
 
 }
 
+void tst_QByteArrayMatcher::multiMatcher_data()
+{
+    QTest::addColumn<QByteArrayList>("patterns");
+    QTest::addColumn<QByteArray>("haystack");
+    QTest::addColumn<qsizetype>("from");
+    QTest::addColumn<qsizetype>("expectedIndex");
+    QTest::addColumn<qsizetype>("expectedPattern");
+
+    const QByteArrayList keywords = { "he", "she", "his", "hers" };
+
+    QTest::newRow("no-patterns") << QByteArrayList() << QByteArray("ushers") << qsizetype(0)
+                                 << qsizetype(-1) << qsizetype(-1);
+    QTest::newRow("only-empty-pattern") << QByteArrayList{ "" } << QByteArray("ushers")
+                                        << qsizetype(0) << qsizetype(-1) << qsizetype(-1);
+    QTest::newRow("empty-haystack") << keywords << QByteArray() << qsizetype(0)
+                                    << qsizetype(-1) << qsizetype(-1);
+    QTest::newRow("not-found") << keywords << QByteArray("abcdefg") << qsizetype(0)
+                               << qsizetype(-1) << qsizetype(-1);
+    // "she" starts before "he" and "hers"
+    QTest::newRow("ushers") << keywords << QByteArray("ushers") << qsizetype(0)
+                            << qsizetype(1) << qsizetype(1);
+    QTest::newRow("ushers-from-2") << keywords << QByteArray("ushers") << qsizetype(2)
+                                   << qsizetype(2) << qsizetype(0);
+    QTest::newRow("ushers-from-3") << keywords << QByteArray("ushers") << qsizetype(3)
+                                   << qsizetype(-1) << qsizetype(-1);
+    QTest::newRow("negative-from") << keywords << QByteArray("his") << qsizetype(-5)
+                                   << qsizetype(0) << qsizetype(2);
+    // the leftmost occurrence ends after a shorter one
+    QTest::newRow("leftmost-longer") << QByteArrayList{ "bc", "abcd" } << QByteArray("xabcd")
+                                     << qsizetype(0) << qsizetype(1) << qsizetype(1);
+    QTest::newRow("leftmost-not-complete") << QByteArrayList{ "bc", "abcd" } << QByteArray("xabce")
+                                           << qsizetype(0) << qsizetype(2) << qsizetype(0);
+    // ties go to the lowest index
+    QTest::newRow("same-start") << QByteArrayList{ "abc", "ab" } << QByteArray("abc")
+                                << qsizetype(0) << qsizetype(0) << qsizetype(0);
+    QTest::newRow("duplicates") << QByteArrayList{ "x", "ab", "ab" } << QByteArray("cab")
+                                << qsizetype(0) << qsizetype(1) << qsizetype(1);
+    QTest::newRow("binary") << QByteArrayList{ QByteArray("\0\xff", 2), QByteArray("\x80") }
+                            << QByteArray("abc\x80\0\xff", 6) << qsizetype(0)
+                            << qsizetype(3) << qsizetype(1);
+}
+
+void tst_QByteArrayMatcher::multiMatcher()
+{
+    QFETCH(QByteArrayList, patterns);
+    QFETCH(QByteArray, haystack);
+    QFETCH(qsizetype, from);
+    QFETCH(qsizetype, expectedIndex);
+    QFETCH(qsizetype, expectedPattern);
+
+    const QMultiByteArrayMatcher matcher(patterns);
+    QCOMPARE(matcher.patterns(), patterns);
+
+    qsizetype patternIndex = -42;
+    QCOMPARE(matcher.indexIn(haystack, from, &patternIndex), expectedIndex);
+    QCOMPARE(patternIndex, expectedPattern);
+    QCOMPARE(matcher.indexIn(haystack, from), expectedIndex);
+
+    // copies and setPatterns() give the same results
+    QMultiByteArrayMatcher copy = matcher;
+    QCOMPARE(copy.indexIn(haystack, from), expectedIndex);
+    QMultiByteArrayMatcher reset;
+    QCOMPARE(reset.indexIn(haystack, from), qsizetype(-1));
+    reset.setPatterns(patterns);
+    QCOMPARE(reset.indexIn(haystack, from), expectedIndex);
+    QMultiByteArrayMatcher moved = std::move(reset);
+    QCOMPARE(moved.indexIn(haystack, from), expectedIndex);
+}
+
+void tst_QByteArrayMatcher::multiMatcherFindAll()
+{
+    const QMultiByteArrayMatcher matcher({ "he", "she", "his", "hers", "" });
+    const QList<QMultiByteArrayMatcher::Match> matches = matcher.findAll("ushers and his hens");
+
+    const QList<std::tuple<qsizetype, qsizetype, qsizetype>> expected = {
+        { 1, 3, 1 },  // she
+        { 2, 2, 0 },  // he
+        { 2, 4, 3 },  // hers
+        { 11, 3, 2 }, // his
+        { 15, 2, 0 }, // he
+    };
+    QCOMPARE(matches.size(), expected.size());
+    for (qsizetype i = 0; i < matches.size(); ++i) {
+        QCOMPARE(matches.at(i).position, std::get<0>(expected.at(i)));
+        QCOMPARE(matches.at(i).length, std::get<1>(expected.at(i)));
+        QCOMPARE(matches.at(i).patternIndex, std::get<2>(expected.at(i)));
+    }
+
+    QCOMPARE(matcher.findAll("ushers and his hens", 12).size(), 1);
+    QVERIFY(matcher.findAll("nothing to see").isEmpty());
+    QVERIFY(QMultiByteArrayMatcher().findAll("he").isEmpty());
+}
+
+void tst_QByteArrayMatcher::multiMatcherAgainstSingleMatchers()
+{
+    // many overlapping patterns over a tiny alphabet, compared with
+    // QByteArrayMatcher and with a brute force search
+    QRandomGenerator rng(42);
+    const auto randomBytes = [&rng](qsizetype size) {
+        QByteArray result(size, Qt::Uninitialized);
+        for (char &c : result)
+            c = char('a' + rng.bounded(3));
+        return result;
+    };
+
+    for (int round = 0; round < 20; ++round) {
+        QByteArrayList patterns;
+        for (int i = 0; i < 50; ++i)
+            patterns.append(randomBytes(1 + rng.bounded(6)));
+        const QMultiByteArrayMatcher matcher(patterns);
+
+        for (int i = 0; i < 20; ++i) {
+            const QByteArray haystack = randomBytes(rng.bounded(100));
+            const qsizetype from = rng.bounded(10);
+
+            qsizetype expectedIndex = -1;
+            qsizetype expectedPattern = -1;
+            for (qsizetype p = 0; p < patterns.size(); ++p) {
+                const qsizetype index = QByteArrayMatcher(patterns.at(p)).indexIn(haystack, from);
+                if (index >= 0 && (expectedIndex < 0 || index < expectedIndex)) {
+                    expectedIndex = index;
+                    expectedPattern = p;
+                }
+            }
+            qsizetype patternIndex;
+            QCOMPARE(matcher.indexIn(haystack, from, &patternIndex), expectedIndex);
+            QCOMPARE(patternIndex, expectedPattern);
+
+            qsizetype expectedCount = 0;
+            for (qsizetype pos = from; pos < haystack.size(); ++pos) {
+                for (qsizetype p = 0; p < patterns.size(); ++p) {
+                    if (patterns.indexOf(patterns.at(p)) == p
+                            && haystack.mid(pos).startsWith(patterns.at(p))) {
+                        ++expectedCount;
+                    }
+                }
+            }
+            const QList<QMultiByteArrayMatcher::Match> matches = matcher.findAll(haystack, from);
+            QCOMPARE(matches.size(), expectedCount);
+            for (const QMultiByteArrayMatcher::Match &match : matches) {
+                QCOMPARE(haystack.mid(match.position, match.length), patterns.at(match.patternIndex));
+                QCOMPARE(patterns.indexOf(patterns.at(match.patternIndex)), match.patternIndex);
+            }
+        }
+    }
+}
+
 #undef LONG_STRING_256
 #undef LONG_STRING_128
 #undef LONG_STRING__64
@@ -45,6 +45,9 @@ private Q_SLOTS:
     void compare();
 
     void state();
+
+    void sort_data();
+    void sort();
 };
 
 static bool dpointer_is_null(QCollator &c)
@@ -242,6 +245,52 @@ void tst_QCollator::state()
 
 }
 
+void tst_QCollator::sort_data()
+{
+    QTest::addColumn<QString>("locale");
+    QTest::addColumn<bool>("numericMode");
+
+    QTest::newRow("C") << QString("C") << false;
+    QTest::newRow("english") << QString("en_US") << false;
+    QTest::newRow("english-numeric") << QString("en_US") << true;
+    QTest::newRow("swedish") << QString("sv_SE") << false;
+    QTest::newRow("german") << QString("de_DE") << false;
+}
+
+void tst_QCollator::sort()
+{
+    QFETCH(QString, locale);
+    QFETCH(bool, numericMode);
+
+    QCollator collator((QLocale(locale)));
+#if defined(Q_OS_ANDROID) && !defined(Q_OS_ANDROID_EMBEDDED)
+    if (collator.locale() != QLocale())
+        QSKIP("Posix implementation of collation only supports default locale");
+#endif
+    collator.setNumericMode(numericMode);
+
+    // Long enough for sort() to order the list by sort keys
+    QStringList list;
+    const QString words[] = {
+        QString::fromLatin1("z"), QString::fromLatin1("\xe5"), QString::fromLatin1("\xe4"),
+        QString::fromLatin1("\xf6"), QString("A"), QString("a"), QString("test 9"),
+        QString("test 19"), QString("test_19"), QString(), QString("42"), QString("9"),
+        QString::fromLatin1("\xe9"), QString("e"), QString("oe"), QString("b")
+    };
+    for (int i = 0; i < 4; ++i) {
+        for (const QString &word : words)
+            list.append(word);
+    }
+
+    for (qsizetype size : { qsizetype(0), qsizetype(1), qsizetype(5), list.size() }) {
+        QStringList sorted = list.mid(0, size);
+        collator.sort(sorted);
+        QStringList reference = list.mid(0, size);
+        std::stable_sort(reference.begin(), reference.end(), collator);
+        QCOMPARE(sorted, reference);
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_QCollator)
 
 #include "tst_qcollator.moc"
@@ -92,6 +92,7 @@ private slots:
     void long_long_conversion_data();
     void long_long_conversion();
     void long_long_conversion_extra();
+    void cLocaleMatchesGeneralPath();
     void testInfAndNan();
     void fpExceptions();
     void negativeZero_data();
@@ -1395,6 +1396,73 @@ void tst_QLocale::long_long_conversion_extra()
     QCOMPARE(l.toString((qulonglong)12345), QString("12,345"));
 }
 
+void tst_QLocale::cLocaleMatchesGeneralPath()
+{
+    // The C locale formats and parses numbers on a path of its own; English,
+    // without group separators, uses the same symbols but the general path.
+    const QLocale c(QLocale::C);
+    QLocale english(QLocale::English, QLocale::UnitedStates);
+    english.setNumberOptions(QLocale::OmitGroupSeparator);
+    const QString exponential = english.exponential();
+
+    const double values[] = {
+        0.0, -0.0, 1.0, -1.0, 0.5, 0.1, 1.0 / 3, 2.0 / 3, 12.5, 100.0, 123456789.0,
+        1.2345678901234567e15, 1e21, -9.87654321e-7, 1e-300, 6.02214076e23,
+        std::numeric_limits<double>::max(), std::numeric_limits<double>::min(),
+        std::numeric_limits<double>::denorm_min(), qInf(), -qInf(), qQNaN()
+    };
+    const char formats[] = { 'e', 'E', 'f', 'g', 'G' };
+    const int precisions[] = { -1, 0, 1, 2, 6, 10, 17, QLocale::FloatingPointShortest };
+
+    for (double value : values) {
+        for (char format : formats) {
+            for (int precision : precisions) {
+                const QString expected = english.toString(value, format, precision)
+                                                .replace(exponential, QLatin1String("e"),
+                                                         Qt::CaseInsensitive);
+                const QString actual = c.toString(value, format, precision);
+                QCOMPARE(actual.toLower(), expected.toLower());
+                if (format == 'e' || format == 'f' || format == 'g')
+                    QCOMPARE(actual, expected);
+                QCOMPARE(QString::number(value, format, precision), actual);
+                QCOMPARE(QByteArray::number(value, format, precision),
+                         QString::number(value, format, precision).toLatin1());
+
+                bool ok = false;
+                if (qIsFinite(value)) {
+                    QCOMPARE(c.toDouble(actual, &ok), english.toDouble(expected));
+                    QVERIFY(ok);
+                }
+            }
+        }
+    }
+
+    // Flags taking part in the C locale's formatting
+    QCOMPARE(QString::asprintf("%+.3e", 1234.5), QString("+1.234e+03"));
+    QCOMPARE(QString::asprintf("% f", 2.5), QString(" 2.500000"));
+    QCOMPARE(QString::asprintf("%010.2f", -3.14159), QString("-000003.14"));
+    QCOMPARE(QString::asprintf("%-10.2f|", 3.14159), QString("3.14      |"));
+    QCOMPARE(QString::asprintf("%#.0f", 3.0), QString("3."));
+    QCOMPARE(QString::asprintf("%G", 1e-10), QString("1E-10"));
+
+    const qlonglong integers[] = {
+        0, 1, -1, 9, 10, -10, 255, 65535, 1234567890, -1234567890,
+        std::numeric_limits<qlonglong>::max(), std::numeric_limits<qlonglong>::min()
+    };
+    for (qlonglong value : integers) {
+        QCOMPARE(c.toString(value), english.toString(value));
+        QCOMPARE(QString::number(value), english.toString(value));
+        QCOMPARE(c.toString(qulonglong(value)), english.toString(qulonglong(value)));
+        bool ok = false;
+        QCOMPARE(c.toLongLong(english.toString(value), &ok), value);
+        QVERIFY(ok);
+    }
+    QCOMPARE(QString::number(255, 16), QString("ff"));
+    QCOMPARE(QString::number(-255, 16), QString("ffffffffffffff01"));
+    QCOMPARE(QString::number(0, 2), QString("0"));
+    QCOMPARE(QString::number(Q_UINT64_C(0xfedcba9876543210), 36), QString("3viyrl200xgk0"));
+}
+
 void tst_QLocale::testInfAndNan()
 {
     double neginf = log(0.0);
@@ -2245,6 +2313,14 @@ void tst_QLocale::numberOptions()
     QVERIFY(ok);
     locale.toDouble(QString("12.400"), &ok);
     QVERIFY(!ok);
+
+    // Locales constructed separately must not share number options
+    QLocale german(QLocale::German, QLocale::Germany);
+    german.setNumberOptions(QLocale::OmitGroupSeparator);
+    QCOMPARE(QLocale(QLocale::German, QLocale::Germany).numberOptions(), QLocale::DefaultNumberOptions);
+    QCOMPARE(QLocale(QStringLiteral("de_DE")).numberOptions(), QLocale::DefaultNumberOptions);
+    QCOMPARE(german.toString(12345), QString("12345"));
+    QCOMPARE(QLocale(QLocale::German, QLocale::Germany).toString(12345), QString("12.345"));
 }
 
 void tst_QLocale::negativeNumbers()
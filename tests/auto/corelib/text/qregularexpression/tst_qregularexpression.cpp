@@ -79,6 +79,10 @@ private slots:
     void QStringAndQStringViewEquivalence();
     void threadSafety_data();
     void threadSafety();
+    void sharedCompiledPatterns();
+    void sharedCompiledPatternsThreadSafety();
+    void matchingIndexes_data();
+    void matchingIndexes();
 
     void wildcard_data();
     void wildcard();
@@ -2181,6 +2185,172 @@ void tst_QRegularExpression::threadSafety()
     }
 }
 
+void tst_QRegularExpression::sharedCompiledPatterns()
+{
+    // equal regular expressions share their compiled pattern; make sure
+    // that they (and the ones detached from them) still behave independently
+    const QString pattern = QStringLiteral("(\\w+)@(\\w+)");
+    const QRegularExpression re1(pattern);
+    const QRegularExpression re2(pattern);
+    QVERIFY(re1.isValid());
+    QVERIFY(re2.isValid());
+    QCOMPARE(re1.captureCount(), 2);
+    QCOMPARE(re2.captureCount(), 2);
+
+    QRegularExpression re3 = re1;
+    re3.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
+    QVERIFY(re3.isValid());
+    QCOMPARE(re3.captureCount(), 2);
+
+    QRegularExpression re4 = re2;
+    re4.setPattern(QStringLiteral("(\\w+)@(\\w+)\\.(\\w+)"));
+    QCOMPARE(re4.captureCount(), 3);
+    QCOMPARE(re2.captureCount(), 2);
+
+    const QString subject = QStringLiteral("user@example.org");
+    QCOMPARE(re1.match(subject).captured(2), QStringLiteral("example"));
+    QCOMPARE(re2.match(subject).captured(2), QStringLiteral("example"));
+    QCOMPARE(re3.match(subject).captured(2), QStringLiteral("example"));
+    QCOMPARE(re4.match(subject).captured(3), QStringLiteral("org"));
+
+    // invalid patterns are shared too, including their error
+    const QRegularExpression invalid1(QStringLiteral("(abc"));
+    const QRegularExpression invalid2(QStringLiteral("(abc"));
+    QVERIFY(!invalid1.isValid());
+    QVERIFY(!invalid2.isValid());
+    QCOMPARE(invalid2.patternErrorOffset(), invalid1.patternErrorOffset());
+    QCOMPARE(invalid2.errorString(), invalid1.errorString());
+
+    // a pattern with many capturing groups after one with few: the
+    // reused match data must grow accordingly
+    QString manyGroups;
+    QString manyGroupsSubject;
+    for (int i = 0; i < 40; ++i) {
+        manyGroups += QLatin1String("(.)");
+        manyGroupsSubject += QLatin1Char('a' + i % 26);
+    }
+    const QRegularExpression manyRe(manyGroups);
+    const QRegularExpressionMatch manyMatch = manyRe.match(manyGroupsSubject);
+    QVERIFY(manyMatch.hasMatch());
+    QCOMPARE(manyMatch.lastCapturedIndex(), 40);
+    QCOMPARE(manyMatch.captured(40), QStringLiteral("n"));
+    QCOMPARE(re1.match(subject).lastCapturedIndex(), 2);
+}
+
+class CompilingMatcherThread : public QThread
+{
+public:
+    explicit CompilingMatcherThread(const QString &pattern, const QString &subject)
+        : m_pattern(pattern),
+          m_subject(subject)
+    {
+    }
+
+    bool allMatched = true;
+
+private:
+    void run() override
+    {
+        yieldCurrentThread();
+        for (int i = 0; i < 50; ++i) {
+            // every thread compiles its own copy of the same pattern
+            const QRegularExpression re(m_pattern);
+            if (!re.match(m_subject).hasMatch())
+                allMatched = false;
+        }
+    }
+
+    const QString m_pattern;
+    const QString m_subject;
+};
+
+void tst_QRegularExpression::sharedCompiledPatternsThreadSafety()
+{
+    const int threadCount = qMax(QThread::idealThreadCount(), 4);
+
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        // use a different pattern every time, so that it's not cached yet
+        const QString pattern = QStringLiteral("a(b+)c\\d{%1}").arg(iteration + 1);
+        const QString subject = QStringLiteral("xxabbbc") + QString(iteration + 1, QLatin1Char('7'));
+
+        QList<CompilingMatcherThread *> threads;
+        for (int i = 0; i < threadCount; ++i) {
+            CompilingMatcherThread *thread = new CompilingMatcherThread(pattern, subject);
+            thread->start();
+            threads.push_back(thread);
+        }
+
+        for (CompilingMatcherThread *thread : threads) {
+            thread->wait();
+            QVERIFY(thread->allMatched);
+        }
+
+        qDeleteAll(threads);
+    }
+}
+
+void tst_QRegularExpression::matchingIndexes_data()
+{
+    QTest::addColumn<QString>("pattern");
+    QTest::addColumn<QStringList>("subjects");
+    QTest::addColumn<QList<qsizetype>>("expected");
+
+    const QStringList log = {
+        QStringLiteral("INFO connection established"),
+        QStringLiteral("WARN connection timeout after 30s"),
+        QStringLiteral(""),
+        QStringLiteral("ERROR disk full"),
+        QStringLiteral("warn retrying"),
+        QStringLiteral("INFO Timeout reset"),
+    };
+
+    QTest::newRow("empty-list") << "abc" << QStringList() << QList<qsizetype>();
+    QTest::newRow("none") << "fatal" << log << QList<qsizetype>();
+    QTest::newRow("all") << "" << log << QList<qsizetype>{ 0, 1, 2, 3, 4, 5 };
+    QTest::newRow("anchored") << "^WARN" << log << QList<qsizetype>{ 1 };
+    QTest::newRow("word") << "\\btimeout\\b" << log << QList<qsizetype>{ 1 };
+    QTest::newRow("case-insensitive") << "(?i)\\btimeout\\b" << log << QList<qsizetype>{ 1, 5 };
+    QTest::newRow("empty-line") << "^$" << log << QList<qsizetype>{ 2 };
+    QTest::newRow("captures") << "(\\w+) (\\w+) (\\d+)s$" << log << QList<qsizetype>{ 1 };
+    QTest::newRow("non-ascii") << "\\p{Greek}+"
+                               << QStringList{ QStringLiteral("abc"), QString::fromUtf16(u"x\u03b1\u03b2y") }
+                               << QList<qsizetype>{ 1 };
+}
+
+void tst_QRegularExpression::matchingIndexes()
+{
+    QFETCH(QString, pattern);
+    QFETCH(QStringList, subjects);
+    QFETCH(QList<qsizetype>, expected);
+
+    const QRegularExpression re(pattern);
+    QVERIFY(re.isValid());
+
+    QList<QStringView> views;
+    for (const QString &subject : qAsConst(subjects))
+        views.append(subject);
+
+    QCOMPARE(re.matchingIndexes(views), expected);
+
+    // must agree with match()
+    QList<qsizetype> fromMatch;
+    for (qsizetype i = 0; i < views.size(); ++i) {
+        if (re.match(views.at(i)).hasMatch())
+            fromMatch.append(i);
+    }
+    QCOMPARE(fromMatch, expected);
+
+    // anchored matches have to start at the beginning of the subjects
+    QList<qsizetype> anchored;
+    for (qsizetype i = 0; i < views.size(); ++i) {
+        if (re.match(views.at(i), 0, QRegularExpression::NormalMatch,
+                     QRegularExpression::AnchorAtOffsetMatchOption).hasMatch()) {
+            anchored.append(i);
+        }
+    }
+    QCOMPARE(re.matchingIndexes(views, QRegularExpression::AnchorAtOffsetMatchOption), anchored);
+}
+
 void tst_QRegularExpression::wildcard_data()
 {
     QTest::addColumn<QString>("pattern");
@@ -475,6 +475,8 @@ private slots:
     void indexOfInvalidRegex();
     void indexOf2_data();
     void indexOf2();
+    void searchBlockBoundaries_data();
+    void searchBlockBoundaries();
     void indexOf3_data();
 //  void indexOf3();
     void asprintf();
@@ -1573,6 +1575,78 @@ void tst_QString::indexOfInvalidRegex()
     QVERIFY(!match.hasMatch());
 }
 
+void tst_QString::searchBlockBoundaries_data()
+{
+    QTest::addColumn<QString>("haystack");
+    QTest::addColumn<QString>("needle");
+    QTest::addColumn<int>("firstPos");
+    QTest::addColumn<int>("lastPos");
+    QTest::addColumn<int>("matches");
+
+    // Exercise the vectorized search loops right around their 16, 32 and
+    // 64 character blocks. The filler repeats the needle's first character,
+    // so every position is a candidate the loops have to reject.
+    const int lengths[] = { 15, 16, 17, 31, 32, 33, 63, 64, 65 };
+    const int needleLengths[] = { 1, 2, 3, 20 };
+    for (int length : lengths) {
+        for (int needleLength : needleLengths) {
+            if (needleLength > length)
+                continue;
+            const QString needle = needleLength == 1
+                    ? QString(QLatin1Char('c'))
+                    : QLatin1Char('a') + QString(needleLength - 2, QLatin1Char('b')) + QLatin1Char('c');
+            const QString filler(length, QLatin1Char('a'));
+            const int last = length - needleLength;
+            const QByteArray tag = QByteArray::number(length) + "-needle" + QByteArray::number(needleLength);
+
+            QTest::newRow(tag + "-none") << filler << needle << -1 << -1 << 0;
+
+            QString haystack = filler;
+            haystack.replace(0, needleLength, needle);
+            QTest::newRow(tag + "-first") << haystack << needle << 0 << 0 << 1;
+
+            haystack = filler;
+            haystack.replace(last, needleLength, needle);
+            QTest::newRow(tag + "-last") << haystack << needle << last << last << 1;
+
+            if (2 * needleLength <= length) {
+                haystack.replace(0, needleLength, needle);
+                QTest::newRow(tag + "-both") << haystack << needle << 0 << last << 2;
+            }
+        }
+    }
+}
+
+void tst_QString::searchBlockBoundaries()
+{
+    QFETCH(QString, haystack);
+    QFETCH(QString, needle);
+    QFETCH(int, firstPos);
+    QFETCH(int, lastPos);
+    QFETCH(int, matches);
+
+    QCOMPARE(haystack.indexOf(needle), firstPos);
+    QCOMPARE(haystack.lastIndexOf(needle), lastPos);
+    QCOMPARE(haystack.count(needle), matches);
+    QCOMPARE(haystack.contains(needle), matches != 0);
+
+    const QStringView view(haystack);
+    QCOMPARE(view.indexOf(needle), firstPos);
+    QCOMPARE(view.count(needle), matches);
+    QCOMPARE(view.contains(needle), matches != 0);
+
+    if (firstPos >= 0 && firstPos != lastPos)
+        QCOMPARE(haystack.indexOf(needle, firstPos + 1), lastPos);
+
+    if (needle.size() == 1) {
+        const QChar ch = needle.at(0);
+        QCOMPARE(haystack.indexOf(ch), firstPos);
+        QCOMPARE(haystack.lastIndexOf(ch), lastPos);
+        QCOMPARE(haystack.count(ch), matches);
+        QCOMPARE(haystack.contains(ch), matches != 0);
+    }
+}
+
 void tst_QString::lastIndexOf_data()
 {
     QTest::addColumn<QString>("haystack" );
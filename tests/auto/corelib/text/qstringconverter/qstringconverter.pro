@@ -1,5 +1,5 @@
 CONFIG += testcase
-QT = core testlib
+QT = core-private testlib
 SOURCES = tst_qstringconverter.cpp
 
 TARGET = tst_qstringconverter
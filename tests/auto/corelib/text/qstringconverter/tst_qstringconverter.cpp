@@ -30,6 +30,7 @@
 #include <QtTest/QtTest>
 
 #include <qstringconverter.h>
+#include <private/qstringconverter_p.h>
 #include <qthreadpool.h>
 
 class tst_QStringConverter : public QObject
@@ -57,6 +58,11 @@ private slots:
     void utf8stateful_data();
     void utf8stateful();
 
+    void utf8MultiByteRuns_data();
+    void utf8MultiByteRuns();
+    void utf8MultiByteRunsInvalid_data();
+    void utf8MultiByteRunsInvalid();
+
     void utfHeaders_data();
     void utfHeaders();
 
@@ -1421,6 +1427,93 @@ void tst_QStringConverter::utf8stateful()
     }
 }
 
+void tst_QStringConverter::utf8MultiByteRuns_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+    QTest::addColumn<QString>("utf16");
+
+    // long enough for the vectorized code to handle whole blocks
+    QTest::newRow("cyrillic")
+            << QByteArray("Съешь же ещё этих мягких французских булок, да выпей чаю. "
+                          "ЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖ")
+            << QString::fromUtf16(u"Съешь же ещё этих мягких французских булок, да выпей чаю. "
+                                  u"ЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖЖ");
+    QTest::newRow("cjk")
+            << QByteArray("日志记录成功完成日志记录成功完成日志记录成功完成日志记录成功完成")
+            << QString::fromUtf16(u"日志记录成功完成日志记录成功完成日志记录成功完成日志记录成功完成");
+    QTest::newRow("cjk-ascii")
+            << QByteArray("2020-05-01 12:00:00 [信息] 用户登录成功，会话已经建立并且开始记录日志。\n").repeated(4)
+            << QString::fromUtf16(u"2020-05-01 12:00:00 [信息] 用户登录成功，会话已经建立并且开始记录日志。\n").repeated(4);
+    QTest::newRow("non-bmp")
+            << QByteArray("日志记录成功完成日志记录\xf0\x9f\x98\x80成功完成日志记录成功完成日志记录成功完成")
+            << QString::fromUtf16(u"日志记录成功完成日志记录\U0001f600成功完成日志记录成功完成日志记录成功完成");
+    QTest::newRow("limits")
+            << QByteArray("\xe0\xa0\x80\xef\xbf\xbf\xed\x9f\xbf\xee\x80\x80").repeated(8)
+               + QByteArray("\xc2\x80\xdf\xbf").repeated(8)
+            << QString::fromUtf16(u"\u0800\uffff\ud7ff\ue000").repeated(8)
+               + QString::fromUtf16(u"\u0080\u07ff").repeated(8);
+}
+
+void tst_QStringConverter::utf8MultiByteRuns()
+{
+    QFETCH(QByteArray, utf8);
+    QFETCH(QString, utf16);
+
+    QCOMPARE(QString::fromUtf8(utf8), utf16);
+    QCOMPARE(utf16.toUtf8(), utf8);
+    QVERIFY(QUtf8::isValidUtf8(utf8.constData(), utf8.size()).isValidUtf8);
+
+    // splitting the input anywhere must not change the result
+    for (int i = 0; i <= utf8.size(); ++i) {
+        QStringDecoder decoder(QStringDecoder::Utf8);
+        QString decoded = decoder(utf8.left(i));
+        decoded += decoder(utf8.mid(i));
+        QVERIFY(!decoder.hasError());
+        QCOMPARE(decoded, utf16);
+    }
+    for (int i = 0; i <= utf16.size(); ++i) {
+        QStringEncoder encoder(QStringEncoder::Utf8);
+        QByteArray encoded = encoder(QStringView(utf16).left(i));
+        encoded += encoder(QStringView(utf16).mid(i));
+        QVERIFY(!encoder.hasError());
+        QCOMPARE(encoded, utf8);
+    }
+}
+
+void tst_QStringConverter::utf8MultiByteRunsInvalid_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+    QTest::addColumn<QString>("utf16");
+
+    // each invalid byte is replaced by one replacement character
+    const QByteArray cjk("日志记录成功完成日志记录成功完成");
+    const QString cjk16 = QString::fromUtf16(u"日志记录成功完成日志记录成功完成");
+    const auto replacements = [](int n) { return QString(n, QChar::ReplacementCharacter); };
+    QTest::newRow("overlong-3") << cjk + "\xe0\x80\x80" + cjk << cjk16 + replacements(3) + cjk16;
+    QTest::newRow("overlong-2") << cjk + "\xc1\xbf" + cjk << cjk16 + replacements(2) + cjk16;
+    QTest::newRow("surrogate") << cjk + "\xed\xa0\x80" + cjk << cjk16 + replacements(3) + cjk16;
+    QTest::newRow("too-large") << cjk + "\xf4\x90\x80\x80" + cjk << cjk16 + replacements(4) + cjk16;
+    QTest::newRow("missing-continuation") << cjk + "\xe6\x97" + cjk << cjk16 + replacements(2) + cjk16;
+    QTest::newRow("stray-continuation") << cjk.left(9) + "\x80" + cjk
+                                        << cjk16.left(3) + replacements(1) + cjk16;
+    QTest::newRow("two-byte-run") << QByteArray("ЖЖЖЖЖЖЖЖ\xd0ЖЖЖЖЖЖЖЖЖЖЖ")
+                                  << QString::fromUtf16(u"ЖЖЖЖЖЖЖЖ�ЖЖЖЖЖЖЖЖЖЖЖ");
+}
+
+void tst_QStringConverter::utf8MultiByteRunsInvalid()
+{
+    QFETCH(QByteArray, utf8);
+    QFETCH(QString, utf16);
+
+    QVERIFY(!QUtf8::isValidUtf8(utf8.constData(), utf8.size()).isValidUtf8);
+    QCOMPARE(QString::fromUtf8(utf8), utf16);
+
+    QStringDecoder decoder(QStringDecoder::Utf8);
+    const QString decoded = decoder(utf8);
+    QVERIFY(decoder.hasError());
+    QCOMPARE(decoded, utf16);
+}
+
 void tst_QStringConverter::utfHeaders_data()
 {
     QTest::addColumn<QStringConverter::Encoding>("encoding");
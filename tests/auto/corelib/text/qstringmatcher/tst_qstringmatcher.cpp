@@ -41,6 +41,10 @@ private slots:
     void setCaseSensitivity_data();
     void setCaseSensitivity();
     void assignOperator();
+    void multiMatcher_data();
+    void multiMatcher();
+    void multiMatcherFindAll();
+    void multiMatcherCaseSensitivity();
 };
 
 void tst_QStringMatcher::qstringmatcher()
@@ -148,6 +152,103 @@ void tst_QStringMatcher::assignOperator()
     QCOMPARE(m2.indexIn(hayStack), 3);
 }
 
+void tst_QStringMatcher::multiMatcher_data()
+{
+    QTest::addColumn<QStringList>("patterns");
+    QTest::addColumn<QString>("haystack");
+    QTest::addColumn<int>("cs");
+    QTest::addColumn<qsizetype>("expectedIndex");
+    QTest::addColumn<qsizetype>("expectedPattern");
+
+    const QStringList keywords = { "error", "warning", "fatal" };
+
+    QTest::newRow("no-patterns") << QStringList() << "an error" << int(Qt::CaseSensitive)
+                                 << qsizetype(-1) << qsizetype(-1);
+    QTest::newRow("sensitive") << keywords << "a Fatal error" << int(Qt::CaseSensitive)
+                               << qsizetype(8) << qsizetype(0);
+    QTest::newRow("insensitive") << keywords << "a Fatal error" << int(Qt::CaseInsensitive)
+                                 << qsizetype(2) << qsizetype(2);
+    QTest::newRow("insensitive-pattern") << QStringList{ "WARNING" } << "a warning"
+                                         << int(Qt::CaseInsensitive) << qsizetype(2) << qsizetype(0);
+    QTest::newRow("non-latin1") << QStringList{ QString::fromUtf16(u"\u0394\u03b5\u03bb\u03c4\u03b1"), "x" }
+                                << QString::fromUtf16(u"\u03b1 \u03b4\u03b5\u03bb\u03c4\u03b1")
+                                << int(Qt::CaseInsensitive) << qsizetype(2) << qsizetype(0);
+    QTest::newRow("non-latin1-sensitive") << QStringList{ QString::fromUtf16(u"\u0394\u03b5\u03bb\u03c4\u03b1"), "x" }
+                                          << QString::fromUtf16(u"\u03b1 \u03b4\u03b5\u03bb\u03c4\u03b1")
+                                          << int(Qt::CaseSensitive) << qsizetype(-1) << qsizetype(-1);
+    // U+10400 DESERET CAPITAL LETTER LONG I folds to U+10428
+    QTest::newRow("surrogates") << QStringList{ QString::fromUtf16(u"a\U00010400") }
+                                << QString::fromUtf16(u"xxA\U00010428")
+                                << int(Qt::CaseInsensitive) << qsizetype(2) << qsizetype(0);
+}
+
+void tst_QStringMatcher::multiMatcher()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(QString, haystack);
+    QFETCH(int, cs);
+    QFETCH(qsizetype, expectedIndex);
+    QFETCH(qsizetype, expectedPattern);
+
+    const QMultiStringMatcher matcher(patterns, Qt::CaseSensitivity(cs));
+    QCOMPARE(matcher.patterns(), patterns);
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseSensitivity(cs));
+
+    qsizetype patternIndex = -42;
+    QCOMPARE(matcher.indexIn(haystack, 0, &patternIndex), expectedIndex);
+    QCOMPARE(patternIndex, expectedPattern);
+
+    // must agree with QStringMatcher
+    qsizetype index = -1;
+    for (const QString &pattern : patterns) {
+        const qsizetype i = QStringMatcher(pattern, Qt::CaseSensitivity(cs)).indexIn(QStringView(haystack));
+        if (i >= 0 && (index < 0 || i < index))
+            index = i;
+    }
+    QCOMPARE(index, expectedIndex);
+}
+
+void tst_QStringMatcher::multiMatcherFindAll()
+{
+    const QMultiStringMatcher matcher({ "ab", "b", "abc", "" });
+    const QList<QMultiStringMatcher::Match> matches = matcher.findAll(u"xabcab", 1);
+    QCOMPARE(matches.size(), 5);
+    QCOMPARE(matches.at(0).position, 1);
+    QCOMPARE(matches.at(0).patternIndex, 0);
+    QCOMPARE(matches.at(1).position, 1);
+    QCOMPARE(matches.at(1).patternIndex, 2);
+    QCOMPARE(matches.at(1).length, 3);
+    QCOMPARE(matches.at(2).position, 2);
+    QCOMPARE(matches.at(2).patternIndex, 1);
+    QCOMPARE(matches.at(3).position, 4);
+    QCOMPARE(matches.at(3).patternIndex, 0);
+    QCOMPARE(matches.at(4).position, 5);
+    QCOMPARE(matches.at(4).patternIndex, 1);
+
+    QCOMPARE(matcher.findAll(u"xabcab", 5).size(), 1);
+    QVERIFY(QMultiStringMatcher().findAll(u"ab").isEmpty());
+}
+
+void tst_QStringMatcher::multiMatcherCaseSensitivity()
+{
+    QMultiStringMatcher matcher;
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseSensitive);
+    QCOMPARE(matcher.indexIn(u"foo"), -1);
+
+    matcher.setCaseSensitivity(Qt::CaseInsensitive);
+    matcher.setPatterns({ "Bar", "FOO" });
+    QCOMPARE(matcher.indexIn(u"a foo bar"), 2);
+
+    matcher.setCaseSensitivity(Qt::CaseSensitive);
+    QCOMPARE(matcher.indexIn(u"a foo bar"), -1);
+    QCOMPARE(matcher.indexIn(u"a foo Bar"), 6);
+
+    QMultiStringMatcher copy = matcher;
+    copy.setCaseSensitivity(Qt::CaseInsensitive);
+    QCOMPARE(copy.indexIn(u"a foo bar"), 2);
+    QCOMPARE(matcher.indexIn(u"a foo bar"), -1);
+}
+
 QTEST_MAIN(tst_QStringMatcher)
 #include "tst_qstringmatcher.moc"
 
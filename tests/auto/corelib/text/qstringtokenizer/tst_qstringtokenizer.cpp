@@ -44,6 +44,7 @@ private Q_SLOTS:
     void basics_data() const;
     void basics() const;
     void toContainer() const;
+    void rangeAdaptors() const;
 };
 
 static QStringList skipped(const QStringList &sl)
@@ -147,5 +148,36 @@ void tst_QStringTokenizer::toContainer() const
     }
 }
 
+void tst_QStringTokenizer::rangeAdaptors() const
+{
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+    {
+        auto tok = qTokenize(u"a,bb,,ccc,dddd,eeeee", u',');
+        static_assert(std::ranges::forward_range<decltype(tok)>);
+        static_assert(std::ranges::view<decltype(tok)>);
+
+        auto sizes = tok
+                | std::views::filter([](QStringView t) { return !t.isEmpty(); })
+                | std::views::transform([](QStringView t) { return t.size(); })
+                | std::views::take(3);
+        QList<qsizetype> result;
+        for (qsizetype size : sizes)
+            result.push_back(size);
+        QCOMPARE(result, QList<qsizetype>({1, 2, 3}));
+    }
+#if __cpp_lib_ranges >= 202110L // std::ranges::owning_view
+    {
+        // the tokenizer owns its haystack, so it's not a view, but it can still be adapted
+        static_assert(!std::ranges::view<decltype(qTokenize(QString(), u','))>);
+        auto upper = qTokenize(QStringList{"a", "b", "c"}.join(u';'), u';')
+                | std::views::transform([](QStringView t) { return t.toString().toUpper(); });
+        QCOMPARE(toQStringList(upper), QStringList({"A", "B", "C"}));
+    }
+#endif
+#else
+    QSKIP("This test requires C++20 ranges");
+#endif
+}
+
 QTEST_APPLESS_MAIN(tst_QStringTokenizer)
 #include "tst_qstringtokenizer.moc"
@@ -145,6 +145,7 @@ private slots:
     void canceledFutureIsNotValid();
     void signalConnect();
     void waitForFinished();
+    void coroutines();
 
 private:
     using size_type = std::vector<int>::size_type;
@@ -3101,5 +3102,117 @@ void tst_QFuture::waitForFinished()
     QVERIFY(waitingThread->isFinished());
 }
 
+#ifdef Q_FUTURE_COROUTINES
+static QFuture<int> addOne(QFuture<int> future)
+{
+    const int value = co_await future;
+    co_return value + 1;
+}
+
+static QFuture<void> recordResumingThread(QObject *context, QFuture<int> future,
+                                          QThread **thread)
+{
+    co_await QtFuture::resumeOn(context, future);
+    *thread = QThread::currentThread();
+}
+
+struct DestructionRecorder
+{
+    bool *destroyed;
+    ~DestructionRecorder() { *destroyed = true; }
+};
+
+static QFuture<void> recordAbandoning(QObject *context, QFuture<int> future,
+                                      bool *resumed, bool *destroyed)
+{
+    DestructionRecorder recorder{destroyed};
+    co_await QtFuture::resumeOn(context, future);
+    *resumed = true;
+}
+#endif
+
+void tst_QFuture::coroutines()
+{
+#ifndef Q_FUTURE_COROUTINES
+    QSKIP("This test requires a compiler with C++20 coroutine support");
+#else
+    {
+        QFutureInterface<int> source;
+        source.reportStarted();
+        QFuture<int> result = addOne(source.future());
+        QVERIFY(!result.isFinished());
+
+        source.reportResult(41);
+        source.reportFinished();
+        QVERIFY(result.isFinished());
+        QCOMPARE(result.result(), 42);
+    }
+    {
+        // already finished, no suspension
+        QFutureInterface<int> source;
+        source.reportStarted();
+        source.reportResult(1);
+        source.reportFinished();
+        QFuture<int> result = addOne(source.future());
+        QVERIFY(result.isFinished());
+        QCOMPARE(result.result(), 2);
+    }
+    {
+        // resumed through the event loop of the context object
+        QObject context;
+        QThread *thread = nullptr;
+        QFutureInterface<int> source;
+        source.reportStarted();
+        QFuture<void> done = recordResumingThread(&context, source.future(), &thread);
+
+        source.reportResult(1);
+        source.reportFinished();
+        QVERIFY(!done.isFinished());
+        QTRY_VERIFY(done.isFinished());
+        QCOMPARE(thread, QThread::currentThread());
+    }
+    {
+        // context destroyed before the future finishes: the coroutine is
+        // destroyed when it does
+        auto context = std::make_unique<QObject>();
+        bool resumed = false;
+        bool destroyed = false;
+        QFutureInterface<int> source;
+        source.reportStarted();
+        QFuture<void> done = recordAbandoning(context.get(), source.future(),
+                                              &resumed, &destroyed);
+
+        context.reset();
+        QVERIFY(!destroyed);
+        source.reportResult(1);
+        source.reportFinished();
+        QVERIFY(destroyed);
+        QVERIFY(!resumed);
+        QVERIFY(done.isFinished());
+        QVERIFY(done.isCanceled());
+    }
+    {
+        // context destroyed while the queued resumption is pending
+        auto context = std::make_unique<QObject>();
+        bool resumed = false;
+        bool destroyed = false;
+        QFutureInterface<int> source;
+        source.reportStarted();
+        QFuture<void> done = recordAbandoning(context.get(), source.future(),
+                                              &resumed, &destroyed);
+
+        source.reportResult(1);
+        source.reportFinished();
+        QVERIFY(!destroyed);
+        context.reset();
+        QVERIFY(destroyed);
+        QCoreApplication::processEvents();
+        QVERIFY(!resumed);
+        QVERIFY(done.isFinished());
+        QVERIFY(done.isCanceled());
+    }
+#endif
+}
+
 QTEST_MAIN(tst_QFuture)
 #include "tst_qfuture.moc"
@@ -52,6 +52,9 @@
 
 #include <stdio.h>
 
+#include <memory>
+#include <vector>
+
 class tst_QReadWriteLock : public QObject
 {
     Q_OBJECT
@@ -94,6 +97,8 @@ private slots:
     // recursive locking tests
     void recursiveReadLock();
     void recursiveWriteLock();
+
+    void distributedReaders();
 };
 
 void tst_QReadWriteLock::constructDestruct()
@@ -1103,6 +1108,54 @@ void tst_QReadWriteLock::recursiveWriteLock()
     QVERIFY(thread.wait());
 }
 
+void tst_QReadWriteLock::distributedReaders()
+{
+    QReadWriteLock lock(QReadWriteLock::NonRecursive, QReadWriteLock::DistributedReaders);
+
+    // several readers at once, no writer
+    QVERIFY(lock.tryLockForRead());
+    QVERIFY(lock.tryLockForRead());
+    QVERIFY(!lock.tryLockForWrite());
+    QVERIFY(!lock.tryLockForWrite(10));
+    lock.unlock();
+    QVERIFY(!lock.tryLockForWrite());
+    lock.unlock();
+
+    // a failed write attempt does not keep readers out
+    QVERIFY(lock.tryLockForRead());
+    lock.unlock();
+
+    // one writer, no readers
+    QVERIFY(lock.tryLockForWrite());
+    QVERIFY(!lock.tryLockForRead());
+    QVERIFY(!lock.tryLockForRead(10));
+    QVERIFY(!lock.tryLockForWrite());
+    lock.unlock();
+    QVERIFY(lock.tryLockForWrite());
+    lock.unlock();
+
+    // readers blocked by a writer in another thread get the lock once it is released
+    lock.lockForWrite();
+    ReadLockThread reader(lock);
+    reader.start();
+    QVERIFY(!reader.wait(100));
+    lock.unlock();
+    QVERIFY(reader.wait());
+
+    // same as countingTest(), shorter
+    count = 0;
+    const int time = 1000;
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < 8; ++i)
+        threads.emplace_back(new ReadLockCountThread(lock, time, 1));
+    for (int i = 0; i < 2; ++i)
+        threads.emplace_back(new WriteLockCountThread(lock, time, 50, 10000));
+    for (auto &t : threads)
+        t->start();
+    for (auto &t : threads)
+        QVERIFY(t->wait());
+}
+
 QTEST_MAIN(tst_QReadWriteLock)
 
 #include "tst_qreadwritelock.moc"
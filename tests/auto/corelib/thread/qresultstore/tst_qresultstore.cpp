@@ -53,6 +53,7 @@ private slots:
     void filterMode();
     void addCanceledResult();
     void count();
+    void inOrderResults();
 private:
     int int0;
     int int1;
@@ -477,5 +478,59 @@ void tst_QtConcurrentResultStore::count()
     }
 }
 
+void tst_QtConcurrentResultStore::inOrderResults()
+{
+    const int resultCount = 5000;
+    ResultStoreInt store;
+    store.addResult(-1, &int0);
+    const int *first = store.resultAt(0).pointer<int>();
+
+    for (int i = 1; i < resultCount; ++i) {
+        if (i % 2)
+            QCOMPARE(store.addResult(-1, &i), i);
+        else
+            QCOMPARE(store.moveResult(i, int(i)), i);
+        QCOMPARE(store.count(), i + 1);
+    }
+
+    // earlier results must not move while later ones are added
+    QCOMPARE(store.resultAt(0).pointer<int>(), first);
+
+    int index = 0;
+    int batches = 0;
+    for (ResultIteratorBase it = store.begin(); it != store.end(); it.batchedAdvance()) {
+        QCOMPARE(it.resultIndex(), index);
+        index += it.batchSize();
+        ++batches;
+    }
+    QCOMPARE(index, resultCount);
+    QVERIFY(batches < resultCount / 100);
+
+    for (int i = 0; i < resultCount; ++i)
+        QCOMPARE(store.resultAt(i).value<int>(), i);
+
+    // a result out of order starts a new batch; in-order results follow it
+    QCOMPARE(store.addResult(resultCount + 1, &int1), resultCount + 1);
+    QCOMPARE(store.count(), resultCount);
+    QCOMPARE(store.addResult(resultCount, &int2), resultCount);
+    QCOMPARE(store.count(), resultCount + 2);
+    QCOMPARE(store.addResult(-1, &int0), resultCount + 2);
+    QCOMPARE(store.count(), resultCount + 3);
+    QCOMPARE(store.resultAt(resultCount).value<int>(), int2);
+    QCOMPARE(store.resultAt(resultCount + 1).value<int>(), int1);
+    QCOMPARE(store.resultAt(resultCount + 2).value<int>(), int0);
+
+    // canceled results leave no gaps in the stored indexes
+    ResultStoreInt canceled;
+    canceled.addResult(-1, &int0);
+    canceled.addCanceledResult(1);
+    canceled.addResult(-1, &int1);
+    canceled.addResult(-1, &int2);
+    QCOMPARE(canceled.count(), 3);
+    QCOMPARE(canceled.resultAt(0).value<int>(), int0);
+    QCOMPARE(canceled.resultAt(1).value<int>(), int1);
+    QCOMPARE(canceled.resultAt(2).value<int>(), int2);
+}
+
 QTEST_MAIN(tst_QtConcurrentResultStore)
 #include "tst_qresultstore.moc"
@@ -100,6 +100,8 @@ private slots:
     void stressTest();
     void takeAllAndIncreaseMaxThreadCount();
     void waitForDoneAfterTake();
+    void workStealing();
+    void workStealingWaitForChild();
 
 private:
     QMutex m_functionTestMutex;
@@ -1282,5 +1284,54 @@ void tst_QThreadPool::waitForDoneAfterTake()
 
 }
 
+void tst_QThreadPool::workStealing()
+{
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(4);
+    threadPool.setWorkStealingEnabled(true);
+    QVERIFY(threadPool.isWorkStealingEnabled());
+
+    const int childCount = 200;
+    QAtomicInt count;
+    QMutex mutex;
+    QSet<QThread *> threads;
+
+    threadPool.start([&]() {
+        for (int i = 0; i < childCount; ++i) {
+            threadPool.start([&]() {
+                {
+                    QMutexLocker locker(&mutex);
+                    threads.insert(QThread::currentThread());
+                }
+                QThread::msleep(1);
+                count.ref();
+            });
+        }
+    });
+
+    QVERIFY(threadPool.waitForDone(30000));
+    QCOMPARE(count.loadRelaxed(), childCount);
+    // idle threads must have stolen from the spawning thread
+    QVERIFY(threads.count() > 1);
+}
+
+void tst_QThreadPool::workStealingWaitForChild()
+{
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(2);
+    threadPool.setWorkStealingEnabled(true);
+
+    QSemaphore childDone;
+    bool childRan = false;
+    threadPool.start([&]() {
+        threadPool.start([&]() { childDone.release(); });
+        // the child sits on this thread's local queue; another thread has to pick it up
+        childRan = childDone.tryAcquire(1, 10000);
+    });
+
+    QVERIFY(threadPool.waitForDone(30000));
+    QVERIFY(childRan);
+}
+
 QTEST_MAIN(tst_QThreadPool);
 #include "tst_qthreadpool.moc"
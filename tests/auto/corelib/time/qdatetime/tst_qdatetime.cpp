@@ -30,6 +30,9 @@
 #include <QtTest/QtTest>
 #include <time.h>
 #include <qdatetime.h>
+#if QT_CONFIG(datestring)
+#include <qdatetimeformat.h>
+#endif
 #include <private/qdatetime_p.h>
 
 #ifdef Q_OS_WIN
@@ -83,6 +86,8 @@ private Q_SLOTS:
     void toString_rfcDate();
     void toString_enumformat();
     void toString_strformat();
+    void dateTimeFormat_data();
+    void dateTimeFormat();
 #endif
     void addDays();
     void addMonths();
@@ -1046,6 +1051,54 @@ void tst_QDateTime::toString_strformat()
     QCOMPARE(testTime.toString("hh:mm:ss"), QString("01:02:03"));
     QCOMPARE(testDateTime.toString("yyyy-MM-dd hh:mm:ss t"), QString("2013-01-01 01:02:03 UTC"));
 }
+
+void tst_QDateTime::dateTimeFormat_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<QDateTime>("dateTime");
+
+    const QDateTime utc(QDate(2013, 1, 1), QTime(1, 2, 3, 40), Qt::UTC);
+    const QDateTime local(QDate(1999, 12, 31), QTime(23, 59, 58, 7), Qt::LocalTime);
+    const QDateTime afternoon(QDate(2020, 7, 4), QTime(13, 5, 0, 500), Qt::OffsetFromUTC, 3600);
+
+    QTest::newRow("iso") << QString("yyyy-MM-ddThh:mm:ss.zzz") << utc;
+    QTest::newRow("names") << QString("dddd d MMMM yy, ddd MMM") << afternoon;
+    QTest::newRow("12-hour") << QString("h:mm ap, hh:m:s AP, a A") << afternoon;
+    QTest::newRow("12-hour-midnight") << QString("hh:mm ap") << local.addSecs(2);
+    QTest::newRow("24-hour") << QString("H:HH:m") << afternoon;
+    QTest::newRow("msecs") << QString("z zz zzz zzzz") << afternoon;
+    QTest::newRow("zone") << QString("yyyy-MM-dd hh:mm:ss t") << utc;
+    QTest::newRow("local-zone") << QString("hh:mm t") << local;
+    QTest::newRow("quoted") << QString("'yyyy''s' yyyy ''hh'' 'at' h") << utc;
+    QTest::newRow("unterminated-quote") << QString("hh 'mm") << utc;
+    QTest::newRow("odd-repeats") << QString("y yyy yyyyy MMMMM ddddd hhh sss zzzzz") << local;
+    QTest::newRow("literals") << QString("[yyyy/MM/dd] {hh.mm.ss} #") << local;
+    QTest::newRow("empty") << QString() << utc;
+    QTest::newRow("invalid") << QString("yyyy") << QDateTime();
+}
+
+void tst_QDateTime::dateTimeFormat()
+{
+    QFETCH(QString, format);
+    QFETCH(QDateTime, dateTime);
+
+    const QDateTimeFormat dateTimeFormat(format);
+    QCOMPARE(dateTimeFormat.format(), format);
+    QCOMPARE(dateTimeFormat.isEmpty(), format.isEmpty());
+    QCOMPARE(dateTimeFormat.toString(dateTime), dateTime.toString(format));
+    // Reuse gives the same result:
+    QCOMPARE(dateTimeFormat.toString(dateTime), dateTime.toString(format));
+    QCOMPARE(dateTimeFormat.toString(dateTime.addDays(1)), dateTime.addDays(1).toString(format));
+
+    const QLocale locale(QLocale::German, QLocale::Germany);
+    QCOMPARE(dateTimeFormat.toString(dateTime, locale), locale.toString(dateTime, format));
+
+    const QCalendar calendar(QCalendar::System::Julian);
+    const QDateTimeFormat julianFormat(format, calendar);
+    QCOMPARE(julianFormat.toString(dateTime), dateTime.toString(format, calendar));
+
+    QCOMPARE(QDateTimeFormat().toString(dateTime), QString());
+}
 #endif // datestring
 
 void tst_QDateTime::addDays()
@@ -2657,6 +2710,9 @@ void tst_QDateTime::fromStringStringFormat()
     QDateTime dt = QDateTime::fromString(string, format);
 
     QCOMPARE(dt, expected);
+    const QDateTimeFormat dateTimeFormat(format);
+    QCOMPARE(dateTimeFormat.fromString(string), dt);
+    QCOMPARE(dateTimeFormat.fromString(string), dt);
     if (expected.isValid()) {
         QCOMPARE(dt.timeSpec(), expected.timeSpec());
 #if QT_CONFIG(timezone)
@@ -1226,6 +1226,35 @@ void tst_QTimeZone::tzTest()
     QCOMPARE(dat.standardTimeOffset, 3600);
     QCOMPARE(dat.daylightTimeOffset, 0);
 
+    // The POSIX rule is expanded into a table up to the end of 2100; check
+    // that transitions are consistent on both sides of its end:
+    const auto lastSunday = [](int year, int month) {
+        const QDate last = QDate(year, month, 1).addMonths(1).addDays(-1);
+        return last.addDays(-(last.dayOfWeek() % 7));
+    };
+    for (const QTzTimeZonePrivate *zone : { &tzp, &tzposix }) {
+        for (int year = 2095; year <= 2105; ++year) {
+            const qint64 start = QDateTime(QDate(year, 1, 1), QTime(0, 0), Qt::UTC).toMSecsSinceEpoch();
+            const qint64 dstStart = QDateTime(lastSunday(year, 3), QTime(1, 0), Qt::UTC).toMSecsSinceEpoch();
+            const qint64 dstEnd = QDateTime(lastSunday(year, 10), QTime(1, 0), Qt::UTC).toMSecsSinceEpoch();
+
+            dat = zone->nextTransition(start);
+            QCOMPARE(dat.atMSecsSinceEpoch, dstStart);
+            QCOMPARE(dat.daylightTimeOffset, 3600);
+            dat = zone->nextTransition(dstStart);
+            QCOMPARE(dat.atMSecsSinceEpoch, dstEnd);
+            QCOMPARE(dat.daylightTimeOffset, 0);
+            QCOMPARE(zone->previousTransition(dstEnd).atMSecsSinceEpoch, dstStart);
+            QCOMPARE(zone->previousTransition(dstStart + 1).atMSecsSinceEpoch, dstStart);
+
+            QCOMPARE(zone->data(dstStart - 1).daylightTimeOffset, 0);
+            QCOMPARE(zone->data(dstStart).daylightTimeOffset, 3600);
+            QCOMPARE(zone->data(dstEnd - 1).daylightTimeOffset, 3600);
+            QCOMPARE(zone->data(dstEnd).daylightTimeOffset, 0);
+            QCOMPARE(zone->data(dstEnd).atMSecsSinceEpoch, dstEnd);
+        }
+    }
+
     // Test TZ timezone vs UTC timezone for fractionary negative offset
     QTzTimeZonePrivate  tztz1("America/Caracas");
     QUtcTimeZonePrivate tzutc1("UTC-04:30");
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qarenascope
+QT = core testlib
+SOURCES = tst_qarenascope.cpp
@@ -0,0 +1,147 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCore/qarenascope.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+
+class tst_QArenaScope : public QObject
+{
+    Q_OBJECT
+private slots:
+    void isActive();
+    void allocations();
+    void growInScope();
+    void heapDataSurvives();
+    void threads();
+};
+
+void tst_QArenaScope::isActive()
+{
+    QVERIFY(!QArenaScope::isActive());
+    {
+        QArenaScope arena;
+        QVERIFY(QArenaScope::isActive());
+        {
+            QArenaScope inner(4096);
+            QVERIFY(QArenaScope::isActive());
+        }
+        QVERIFY(QArenaScope::isActive());
+    }
+    QVERIFY(!QArenaScope::isActive());
+}
+
+void tst_QArenaScope::allocations()
+{
+    QArenaScope arena;
+    QCOMPARE(arena.bytesAllocated(), 0);
+
+    qsizetype total = 0;
+    for (int i = 0; i < 10000; ++i) {
+        const QString s = QString::number(i);
+        total += s.size();
+        QCOMPARE(s.toInt(), i);
+    }
+    QCOMPARE(total, 38890);
+    QVERIFY(arena.bytesAllocated() > 0);
+
+    // larger than a chunk
+    const QByteArray big(3 * QArenaScope::DefaultChunkSize, 'x');
+    QCOMPARE(big.count('x'), 3 * QArenaScope::DefaultChunkSize);
+    QVERIFY(arena.bytesAllocated() > 3 * QArenaScope::DefaultChunkSize);
+}
+
+void tst_QArenaScope::growInScope()
+{
+    QArenaScope arena(1024);
+    QString s;
+    QList<int> list;
+    for (int i = 0; i < 1000; ++i) {
+        s += QLatin1Char('a' + i % 26);
+        list.append(i);
+    }
+    QCOMPARE(s.size(), 1000);
+    QCOMPARE(s.at(27), QLatin1Char('b'));
+    QCOMPARE(list.size(), 1000);
+    QCOMPARE(list.last(), 999);
+
+    s.squeeze();
+    QCOMPARE(s.size(), 1000);
+    QCOMPARE(s.at(999), QLatin1Char('a' + 999 % 26));
+}
+
+void tst_QArenaScope::heapDataSurvives()
+{
+    QString result;
+    result.reserve(100);
+    QString grown = QStringLiteral("abc");
+    grown.detach();
+    {
+        QArenaScope arena;
+        const QStringList parts = QStringLiteral("one,two,three").split(QLatin1Char(','));
+        for (const QString &part : parts)
+            result += part;
+        // reallocating heap data keeps it on the heap
+        for (int i = 0; i < 100; ++i)
+            grown += QLatin1Char('d');
+    }
+    QCOMPARE(result, QStringLiteral("onetwothree"));
+    QCOMPARE(grown.size(), 103);
+    QCOMPARE(grown.count(QLatin1Char('d')), 100);
+}
+
+void tst_QArenaScope::threads()
+{
+    QArenaScope arena;
+    int results[4] = {};
+    QList<QThread *> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.append(QThread::create([&results, t] {
+            // the scope of the main thread doesn't apply here
+            if (QArenaScope::isActive())
+                return;
+            QArenaScope local;
+            QString s;
+            for (int i = 0; i < 100; ++i)
+                s += QString::number(t);
+            results[t] = s.count(QString::number(t).at(0));
+        }));
+        threads.last()->start();
+    }
+    for (QThread *thread : std::as_const(threads)) {
+        QVERIFY(thread->wait());
+        delete thread;
+    }
+    for (int r : results)
+        QCOMPARE(r, 100);
+}
+
+QTEST_APPLESS_MAIN(tst_QArenaScope)
+#include "tst_qarenascope.moc"
@@ -60,6 +60,7 @@ private slots:
     void allocate();
     void reallocate_data() { allocate_data(); }
     void reallocate();
+    void smallBlockReuse();
     void alignment_data();
     void alignment();
     void typedData();
@@ -559,6 +560,42 @@ void tst_QArrayData::reallocate()
         QCOMPARE(static_cast<char *>(dataPointer)[i], 'A');
 }
 
+void tst_QArrayData::smallBlockReuse()
+{
+    // Blocks for short strings may be recycled; check that the capacity is
+    // still honored, and that recycled blocks can be reallocated and shrunk.
+    for (int round = 0; round < 3; ++round) {
+        Deallocator keeper(sizeof(char16_t), alignof(QArrayData));
+        for (qsizetype capacity = 1; capacity <= 100; ++capacity) {
+            QArrayData *data;
+            void *dataPointer = QArrayData::allocate(&data, sizeof(char16_t), alignof(QArrayData),
+                                                     capacity);
+            QVERIFY(data);
+            QCOMPARE(data->allocatedCapacity(), capacity);
+            memset(dataPointer, 'A', sizeof(char16_t) * capacity);
+
+            if (capacity % 3 == 0) {
+                auto pair = QArrayData::reallocateUnaligned(data, dataPointer, sizeof(char16_t),
+                                                            capacity / 3);
+                QVERIFY(pair.first);
+                QCOMPARE(pair.first->allocatedCapacity(), capacity / 3);
+                data = pair.first;
+            }
+            keeper.headers.append(data);
+        }
+    }
+
+    QStringList strings;
+    for (int i = 0; i < 1000; ++i) {
+        strings.append(QString::number(i));
+        if (i % 2)
+            strings.removeFirst();
+    }
+    QCOMPARE(strings.size(), 500);
+    QCOMPARE(strings.first(), QString::number(500));
+    QCOMPARE(strings.last(), QString::number(999));
+}
+
 class Unaligned
 {
     Q_DECL_UNUSED_MEMBER char dummy[8];
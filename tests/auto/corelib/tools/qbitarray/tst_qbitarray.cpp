@@ -317,6 +317,11 @@ void tst_QBitArray::operator_andeq_data()
     QTest::newRow( "data6" ) << QStringToQBitArray(QString())
                              << QStringToQBitArray(QString())
                              << QStringToQBitArray(QString());
+
+    QTest::newRow( "long" ) << QStringToQBitArray(QString("11011011").repeated(20) + "101")
+                            << QStringToQBitArray(QString("00101100").repeated(11))
+                            << QStringToQBitArray(QString("00001000").repeated(11)
+                                                  + QString(9 * 8 + 3, QLatin1Char('0')));
 }
 
 void tst_QBitArray::operator_andeq()
@@ -368,6 +373,11 @@ void tst_QBitArray::operator_oreq_data()
     QTest::newRow( "data7" ) << QStringToQBitArray(QString())
                              << QStringToQBitArray(QString())
                              << QStringToQBitArray(QString());
+
+    QTest::newRow( "long" ) << QStringToQBitArray(QString("11011011").repeated(20) + "101")
+                            << QStringToQBitArray(QString("00101100").repeated(11))
+                            << QStringToQBitArray(QString("11111111").repeated(11)
+                                                  + QString("11011011").repeated(9) + "101");
 }
 
 void tst_QBitArray::operator_oreq()
@@ -417,6 +427,11 @@ void tst_QBitArray::operator_xoreq_data()
     QTest::newRow( "data7" ) << QStringToQBitArray(QString())
                              << QStringToQBitArray(QString())
                              << QStringToQBitArray(QString());
+
+    QTest::newRow( "long" ) << QStringToQBitArray(QString("11011011").repeated(20) + "101")
+                            << QStringToQBitArray(QString("00101100").repeated(11))
+                            << QStringToQBitArray(QString("11110111").repeated(11)
+                                                  + QString("11011011").repeated(9) + "101");
 }
 
 void tst_QBitArray::operator_xoreq()
@@ -468,6 +483,9 @@ void tst_QBitArray::operator_neg_data()
 
     QTest::newRow( "data10" )   << QStringToQBitArray("0111010101111010")
                                 << QStringToQBitArray("1000101010000101");
+
+    QTest::newRow( "long" )   << QStringToQBitArray(QString("0111010101111010").repeated(9) + "011")
+                              << QStringToQBitArray(QString("1000101010000101").repeated(9) + "100");
 }
 
 void tst_QBitArray::operator_neg()
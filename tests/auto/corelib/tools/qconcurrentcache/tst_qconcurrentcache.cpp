@@ -0,0 +1,203 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/private/qconcurrentcache_p.h>
+
+#include <thread>
+#include <vector>
+
+class tst_QConcurrentCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void insertAndLookup();
+    void viewLookup();
+    void replace();
+    void eviction();
+    void referencedSurvivesEviction();
+    void tooExpensive();
+    void evictedObjectStaysAlive();
+    void concurrentAccess();
+};
+
+struct Counted
+{
+    static QAtomicInt count;
+    int value;
+    Counted(int v) : value(v) { count.ref(); }
+    ~Counted() { count.deref(); }
+};
+QAtomicInt Counted::count = 0;
+
+void tst_QConcurrentCache::insertAndLookup()
+{
+    QConcurrentCache<int, int> cache(1600);
+    for (int i = 0; i < 50; ++i)
+        QVERIFY(cache.insert(i, new int(i * 2)));
+    QCOMPARE(cache.size(), 50);
+    QCOMPARE(cache.totalCost(), 50);
+
+    for (int i = 0; i < 50; ++i) {
+        QSharedPointer<int> p = cache.object(i);
+        QVERIFY(p);
+        QCOMPARE(*p, i * 2);
+    }
+    QVERIFY(!cache.object(50));
+    QVERIFY(cache.contains(10));
+    QVERIFY(cache.remove(10));
+    QVERIFY(!cache.remove(10));
+    QVERIFY(!cache.contains(10));
+    QCOMPARE(cache.size(), 49);
+
+    cache.clear();
+    QCOMPARE(cache.size(), 0);
+    QCOMPARE(cache.totalCost(), 0);
+}
+
+void tst_QConcurrentCache::viewLookup()
+{
+    QConcurrentCache<QString, int> strings;
+    QVERIFY(strings.insert(QStringLiteral("alpha"), new int(1)));
+    const QString text = QStringLiteral("the alpha and omega");
+    QSharedPointer<int> p = strings.object(QStringView(text).mid(4, 5));
+    QVERIFY(p);
+    QCOMPARE(*p, 1);
+    QVERIFY(!strings.contains(QStringView(text).mid(0, 3)));
+    QVERIFY(strings.remove(QStringView(u"alpha")));
+
+    QConcurrentCache<QByteArray, int> bytes;
+    QVERIFY(bytes.insert(QByteArrayLiteral("beta"), new int(2)));
+    p = bytes.object(QByteArrayView("beta"));
+    QVERIFY(p);
+    QCOMPARE(*p, 2);
+}
+
+void tst_QConcurrentCache::replace()
+{
+    QConcurrentCache<int, Counted, 1> cache(10);
+    QVERIFY(cache.insert(1, new Counted(1), 3));
+    QVERIFY(cache.insert(1, new Counted(2), 4));
+    QCOMPARE(Counted::count.loadRelaxed(), 1);
+    QCOMPARE(cache.size(), 1);
+    QCOMPARE(cache.totalCost(), 4);
+    QCOMPARE(cache.object(1)->value, 2);
+    cache.clear();
+    QCOMPARE(Counted::count.loadRelaxed(), 0);
+}
+
+void tst_QConcurrentCache::eviction()
+{
+    QConcurrentCache<int, Counted, 1> cache(10);
+    for (int i = 0; i < 20; ++i)
+        QVERIFY(cache.insert(i, new Counted(i)));
+    QCOMPARE(cache.size(), 10);
+    QCOMPARE(cache.totalCost(), 10);
+    QCOMPARE(Counted::count.loadRelaxed(), 10);
+
+    cache.setMaxCost(4);
+    QCOMPARE(cache.size(), 4);
+    QCOMPARE(Counted::count.loadRelaxed(), 4);
+    cache.clear();
+    QCOMPARE(Counted::count.loadRelaxed(), 0);
+}
+
+void tst_QConcurrentCache::referencedSurvivesEviction()
+{
+    QConcurrentCache<int, int, 1> cache(4);
+    for (int i = 0; i < 4; ++i)
+        QVERIFY(cache.insert(i, new int(i)));
+
+    // a hit gives the entry a second chance over the unreferenced ones
+    QVERIFY(cache.object(0));
+    QVERIFY(cache.insert(4, new int(4)));
+    QVERIFY(cache.contains(0));
+    QVERIFY(cache.contains(4));
+    QCOMPARE(cache.size(), 4);
+}
+
+void tst_QConcurrentCache::tooExpensive()
+{
+    QConcurrentCache<int, Counted, 4> cache(40);
+    QVERIFY(!cache.insert(1, new Counted(1), 11));
+    QCOMPARE(Counted::count.loadRelaxed(), 0);
+    QVERIFY(!cache.contains(1));
+    QVERIFY(cache.insert(1, new Counted(1), 10));
+    QCOMPARE(Counted::count.loadRelaxed(), 1);
+    cache.clear();
+}
+
+void tst_QConcurrentCache::evictedObjectStaysAlive()
+{
+    QConcurrentCache<int, Counted, 1> cache(1);
+    QVERIFY(cache.insert(1, new Counted(1)));
+    QSharedPointer<Counted> held = cache.object(1);
+    QVERIFY(cache.insert(2, new Counted(2)));
+    QVERIFY(!cache.contains(1));
+    QCOMPARE(Counted::count.loadRelaxed(), 2);
+    QCOMPARE(held->value, 1);
+    held.reset();
+    QCOMPARE(Counted::count.loadRelaxed(), 1);
+    cache.clear();
+}
+
+void tst_QConcurrentCache::concurrentAccess()
+{
+    QConcurrentCache<int, Counted> cache(16 * 64);
+    const int threadCount = 8;
+    const int iterations = 20000;
+    QAtomicInt mismatches;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&cache, &mismatches, t] {
+            for (int i = 0; i < iterations; ++i) {
+                const int key = (i * 7 + t) % 2000;
+                if (QSharedPointer<Counted> p = cache.object(key)) {
+                    if (p->value != key)
+                        mismatches.ref();
+                } else {
+                    cache.insert(key, new Counted(key));
+                }
+                if (i % 97 == 0)
+                    cache.remove(key + 1);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    QCOMPARE(mismatches.loadRelaxed(), 0);
+    QVERIFY(cache.totalCost() <= cache.maxCost());
+    QCOMPARE(Counted::count.loadRelaxed(), int(cache.size()));
+    cache.clear();
+    QCOMPARE(Counted::count.loadRelaxed(), 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QConcurrentCache)
+#include "tst_qconcurrentcache.moc"
@@ -28,7 +28,7 @@
 
 #include <QtTest/QtTest>
 
-#include <private/qflatmap_p.h>
+#include <QtCore/qflatmap.h>
 #include <qbytearray.h>
 #include <qstring.h>
 #include <qstringview.h>
@@ -43,6 +43,7 @@ class tst_QFlatMap : public QObject
     Q_OBJECT
 private slots:
     void constructing();
+    void bulkConstruction();
     void constAccess();
     void insertion();
     void removal();
@@ -105,6 +106,26 @@ void tst_QFlatMap::constructing()
     auto fmFromSortedRange = Map(Qt::OrderedUniqueRange, sv.begin(), sv.end());
 }
 
+void tst_QFlatMap::bulkConstruction()
+{
+    using Map = QFlatMap<int, int>;
+    std::vector<Map::value_type> v;
+    for (int i = 0; i < 1000; ++i)
+        v.emplace_back((i * 7919) % 500, i);
+
+    const Map m(v.begin(), v.end());
+    QCOMPARE(m.size(), Map::size_type(500));
+    QVERIFY(std::is_sorted(m.keys().begin(), m.keys().end()));
+    // of equivalent keys, the last one in the range is kept
+    for (int i = 500; i < 1000; ++i)
+        QCOMPARE(m.value((i * 7919) % 500), i);
+
+    Map m2;
+    m2.insert(v.data(), v.data() + v.size());
+    QCOMPARE(m2.keys(), m.keys());
+    QCOMPARE(m2.values(), m.values());
+}
+
 void tst_QFlatMap::constAccess()
 {
     using Map = QFlatMap<QByteArray, QByteArray>;
@@ -386,6 +407,31 @@ void tst_QFlatMap::transparency()
     QCOMPARE(m.lower_bound(sv1).value(), "een");
     QCOMPARE(m.lower_bound(sv2).value(), "twee");
     QCOMPARE(m.lower_bound(sv3).value(), "dree");
+
+    QVERIFY(m.contains(sv1));
+    QVERIFY(!m.contains(QStringView(u"four")));
+    QCOMPARE(m.find(sv2).value(), "twee");
+    QCOMPARE(std::as_const(m).find(sv3).value(), "dree");
+    QCOMPARE(m.value(sv1), "een");
+    QCOMPARE(m.value(QStringView(u"four"), "vier"), "vier");
+    QCOMPARE(m.take(sv1), "een");
+    QVERIFY(m.remove(sv2));
+    QVERIFY(!m.remove(sv2));
+    QCOMPARE(m.size(), Map::size_type(1));
+
+    using ByteArrayMap = QFlatMap<QByteArray, int, std::less<>>;
+    const auto bm = ByteArrayMap{ { "one", 1 }, { "two", 2 }, { "three", 3 } };
+    const QByteArray bytes = "one two three";
+    QCOMPARE(bm.value(QByteArrayView(bytes.constData(), 3)), 1);
+    QCOMPARE(bm.value(QByteArrayView(bytes.constData() + 4, 3)), 2);
+    QVERIFY(bm.contains(QByteArrayView(bytes.constData() + 8, 5)));
+    QVERIFY(!bm.contains(QByteArrayView(bytes.constData(), 2)));
+
+    using StdLessMap = QFlatMap<QString, int, std::less<>>;
+    const auto sm = StdLessMap{ { "one", 1 }, { "two", 2 } };
+    QCOMPARE(sm.value(sv1), 1);
+    QCOMPARE(sm.value(sv2), 2);
+    QVERIFY(!sm.contains(sv3));
 }
 
 void tst_QFlatMap::viewIterators()
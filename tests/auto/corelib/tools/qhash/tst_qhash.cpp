@@ -73,6 +73,7 @@ private slots:
     void emplace();
 
     void badHashFunction();
+    void sameHashTag();
 };
 
 struct IdentityTracker {
@@ -1754,5 +1755,47 @@ void tst_QHash::badHashFunction()
 
 }
 
+struct SameTagKey {
+    int k;
+    SameTagKey(int i) : k(i) {}
+    bool operator==(const SameTagKey &other) const
+    {
+        return k == other.k;
+    }
+};
+
+size_t qHash(SameTagKey key, size_t)
+{
+    // the high bits are the same for all keys, and clusters of keys share a bucket
+    return size_t(key.k / 4);
+}
+
+void tst_QHash::sameHashTag()
+{
+    QHash<SameTagKey, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+    QCOMPARE(hash.size(), 1000);
+
+    for (int i = 0; i < 1000; i += 3)
+        QCOMPARE(hash.take(i), i);
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 == 0) {
+            QVERIFY(!hash.contains(i));
+        } else {
+            QCOMPARE(hash.value(i, -1), i);
+        }
+    }
+
+    QHash<SameTagKey, int> copy = hash;
+    copy.reserve(10000);
+    for (int i = 0; i < 1000; ++i)
+        QCOMPARE(copy.value(i, -1), i % 3 == 0 ? -1 : i);
+
+    for (int i = 1000; i < 2000; ++i)
+        QVERIFY(!hash.contains(i));
+}
+
 QTEST_APPLESS_MAIN(tst_QHash)
 #include "tst_qhash.moc"
@@ -53,6 +53,7 @@ private slots:
     void indexOf();
     void appendAndRead();
     void peek();
+    void peekChunks();
     void readLine();
 };
 
@@ -389,6 +390,38 @@ void tst_QRingBuffer::peek()
     QCOMPARE(resultBuffer, testBuffer);
 }
 
+void tst_QRingBuffer::peekChunks()
+{
+    QRingBuffer ringBuffer;
+    QByteArrayView chunks[4];
+    QCOMPARE(ringBuffer.peekChunks(chunks, 4, 100), 0);
+
+    const QByteArray ba1("Hello ");
+    const QByteArray ba2("chunked ");
+    const QByteArray ba3("world!");
+    ringBuffer.append(ba1);
+    ringBuffer.append(ba2);
+    ringBuffer.append(ba3);
+
+    QCOMPARE(ringBuffer.peekChunks(chunks, 4, ringBuffer.size()), 3);
+    QCOMPARE(chunks[0], ba1);
+    QCOMPARE(chunks[1], ba2);
+    QCOMPARE(chunks[2], ba3);
+    // the views alias the stored chunks
+    QCOMPARE(chunks[0].data(), ba1.constData());
+
+    // limited by count and by length
+    QCOMPARE(ringBuffer.peekChunks(chunks, 2, ringBuffer.size()), 2);
+    QCOMPARE(ringBuffer.peekChunks(chunks, 4, 10), 2);
+    QCOMPARE(chunks[0], ba1);
+    QCOMPARE(chunks[1], QByteArrayView("chun"));
+
+    ringBuffer.free(3);
+    QCOMPARE(ringBuffer.peekChunks(chunks, 4, 3), 1);
+    QCOMPARE(chunks[0], QByteArrayView("lo "));
+    QCOMPARE(ringBuffer.size(), qint64(ba1.size() + ba2.size() + ba3.size() - 3));
+}
+
 void tst_QRingBuffer::readLine()
 {
     QRingBuffer ringBuffer;
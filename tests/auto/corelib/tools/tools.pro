@@ -3,10 +3,12 @@ SUBDIRS=\
     collections \
     containerapisymmetry \
     qalgorithms \
+    qarenascope \
     qarraydata \
     qbitarray \
     qcache \
     qcommandlineparser \
+    qconcurrentcache \
     qcontiguouscache \
     qcryptographichash \
     qeasingcurve \
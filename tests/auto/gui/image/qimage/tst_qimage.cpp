@@ -91,6 +91,9 @@ private slots:
     void rotate_data();
     void rotate();
 
+    void rotateLarge_data();
+    void rotateLarge();
+
     void copy();
 
     void load();
@@ -1210,6 +1213,55 @@ void tst_QImage::rotate()
     QCOMPARE(original, dest);
 }
 
+void tst_QImage::rotateLarge_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<int>("degrees");
+
+    const QImage::Format formats[] = {
+        QImage::Format_Grayscale8, QImage::Format_RGB16, QImage::Format_RGB888,
+        QImage::Format_ARGB32, QImage::Format_RGBA64
+    };
+    for (int degrees : {90, 180, 270}) {
+        for (QImage::Format format : formats)
+            QTest::addRow("%d %s", degrees, formatToString(format).data()) << format << degrees;
+    }
+}
+
+void tst_QImage::rotateLarge()
+{
+    QFETCH(QImage::Format, format);
+    QFETCH(int, degrees);
+
+    // Large enough to be rotated in several bands, and not a multiple of the band width
+    const int w = 517;
+    const int h = 389;
+    QImage original(w, h, format);
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x)
+            original.setPixel(x, y, qRgb(x & 0xff, y & 0xff, (x + y) & 0xff));
+    }
+
+    QTransform transform;
+    transform.rotate(degrees);
+    const QImage rotated = original.transformed(transform);
+    QCOMPARE(rotated.format(), format);
+
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            QRgb pixel;
+            if (degrees == 90)
+                pixel = rotated.pixel(h - y - 1, x);
+            else if (degrees == 180)
+                pixel = rotated.pixel(w - x - 1, h - y - 1);
+            else
+                pixel = rotated.pixel(y, w - x - 1);
+            if (pixel != original.pixel(x, y))
+                QFAIL(qPrintable(QString::fromLatin1("Pixel %1,%2 differs").arg(x).arg(y)));
+        }
+    }
+}
+
 void tst_QImage::copy()
 {
     // Task 99250
@@ -2944,6 +2996,8 @@ void tst_QImage::largeGenericRgbConversion_data()
         QImage::Format_ARGB32_Premultiplied,
         QImage::Format_RGB16,
         QImage::Format_RGB888,
+        QImage::Format_BGR888,
+        QImage::Format_RGBX8888,
         QImage::Format_RGBA8888,
         QImage::Format_BGR30,
         QImage::Format_A2RGB30_Premultiplied,
@@ -83,6 +83,10 @@ private slots:
     void getSetCheck();
     void readImage_data();
     void readImage();
+#if QT_CONFIG(future)
+    void readAsync_data();
+    void readAsync();
+#endif
     void jpegRgbCmyk();
 
     void setScaledSize_data();
@@ -319,6 +323,47 @@ void tst_QImageReader::readImage()
     }
 }
 
+#if QT_CONFIG(future)
+void tst_QImageReader::readAsync_data()
+{
+    readImage_data();
+}
+
+void tst_QImageReader::readAsync()
+{
+    QFETCH(QString, fileName);
+    QFETCH(bool, success);
+    QFETCH(QByteArray, format);
+
+    SKIP_IF_UNSUPPORTED(format);
+
+    const QImage expected = QImageReader(prefix + fileName, format).read();
+    QCOMPARE(expected.isNull(), !success);
+
+    // From a file name
+    QImageReader fileReader(prefix + fileName, format);
+    QFuture<QImage> future = fileReader.readAsync();
+    QCOMPARE(future.result(), expected);
+
+    // From a device
+    QFile file(prefix + fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QImageReader deviceReader(&file, format);
+    future = deviceReader.readAsync();
+    QCOMPARE(future.result(), expected);
+
+    // Settings are taken when the read is scheduled
+    if (success && !expected.size().isEmpty()) {
+        const QSize scaledSize = expected.size() / 2 + QSize(1, 1);
+        QImageReader scaledReader(prefix + fileName, format);
+        scaledReader.setScaledSize(scaledSize);
+        future = scaledReader.readAsync();
+        scaledReader.setScaledSize(QSize());
+        QCOMPARE(future.result().size(), scaledSize);
+    }
+}
+#endif
+
 void tst_QImageReader::jpegRgbCmyk()
 {
     QImage image1(prefix + QLatin1String("YCbCr_cmyk.jpg"));
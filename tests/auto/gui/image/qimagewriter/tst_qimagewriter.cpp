@@ -73,6 +73,9 @@ private slots:
     void supportsOption_data();
     void supportsOption();
 
+    void pngCompression_data();
+    void pngCompression();
+
     void saveWithNoFormat_data();
     void saveWithNoFormat();
 
@@ -402,6 +405,7 @@ void tst_QImageWriter::supportsOption_data()
                               << QImageIOHandler::Description
                               << QImageIOHandler::Quality
                               << QImageIOHandler::CompressionRatio
+                              << QImageIOHandler::OptimizedWrite
                               << QImageIOHandler::Size
                               << QImageIOHandler::ScaledSize);
 }
@@ -428,6 +432,7 @@ void tst_QImageWriter::supportsOption()
         QImageIOHandler::Endianness,
         QImageIOHandler::Animation,
         QImageIOHandler::BackgroundColor,
+        QImageIOHandler::OptimizedWrite,
     };
 
     QImageWriter writer(writePrefix + fileName);
@@ -436,6 +441,52 @@ void tst_QImageWriter::supportsOption()
     }
 }
 
+void tst_QImageWriter::pngCompression_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<int>("compression");
+    QTest::addColumn<bool>("optimizedWrite");
+
+    const QImage::Format formats[] = { QImage::Format_ARGB32, QImage::Format_RGB16,
+                                       QImage::Format_RGBA64_Premultiplied };
+    for (QImage::Format format : formats) {
+        for (int compression : { 0, 20, 50, 100 }) {
+            for (bool optimizedWrite : { false, true }) {
+                QTest::addRow("format %d, compression %d%s", int(format), compression,
+                              optimizedWrite ? ", optimized" : "")
+                        << format << compression << optimizedWrite;
+            }
+        }
+    }
+}
+
+void tst_QImageWriter::pngCompression()
+{
+    SKIP_IF_UNSUPPORTED(QByteArray("png"));
+
+    QFETCH(QImage::Format, format);
+    QFETCH(int, compression);
+    QFETCH(bool, optimizedWrite);
+
+    QImage image(97, 75, QImage::Format_ARGB32);
+    for (int y = 0; y < image.height(); ++y)
+        for (int x = 0; x < image.width(); ++x)
+            image.setPixel(x, y, qRgba(x * 2, y * 3, (x ^ y) & 0xff, 255));
+    image = image.convertToFormat(format);
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QImageWriter writer(&buffer, "png");
+    writer.setCompression(compression);
+    writer.setOptimizedWrite(optimizedWrite);
+    QVERIFY(writer.write(image));
+    buffer.close();
+
+    QImage written = QImage::fromData(buffer.data(), "png");
+    QVERIFY(!written.isNull());
+    QCOMPARE(written.convertToFormat(format), image);
+}
+
 void tst_QImageWriter::saveWithNoFormat_data()
 {
     QTest::addColumn<QString>("fileName");
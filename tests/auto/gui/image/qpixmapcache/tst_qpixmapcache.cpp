@@ -33,6 +33,7 @@
 
 #include <qpixmapcache.h>
 #include "private/qpixmapcache_p.h"
+#include "private/qimagecache_p.h"
 
 class tst_QPixmapCache : public QObject
 {
@@ -57,6 +58,10 @@ private slots:
     void noLeak();
     void strictCacheLimit();
     void noCrashOnLargeInsert();
+
+    void imageCache();
+    void imageCacheEviction();
+    void imageCacheThreads();
 };
 
 static QPixmapCache::KeyData* getPrivate(QPixmapCache::Key &key)
@@ -537,5 +542,105 @@ void tst_QPixmapCache::noCrashOnLargeInsert()
     QVERIFY(true); // no crash
 }
 
+void tst_QPixmapCache::imageCache()
+{
+    QImageCache cache(1024);
+    QImage image(64, 64, QImage::Format_ARGB32); // 16 KB
+    image.fill(Qt::red);
+
+    QVERIFY(cache.insert("a", image));
+    QCOMPARE(cache.totalUsed(), 16);
+
+    QImage found;
+    QVERIFY(cache.find("a", &found));
+    QCOMPARE(found, image);
+    QVERIFY(!cache.find("b", &found));
+
+    // replacing does not double the cost
+    image.fill(Qt::blue);
+    QVERIFY(cache.insert("a", image));
+    QCOMPARE(cache.totalUsed(), 16);
+    QVERIFY(cache.find("a", &found));
+    QCOMPARE(found.pixel(0, 0), QColor(Qt::blue).rgb());
+
+    cache.remove("a");
+    QVERIFY(!cache.find("a", &found));
+    QCOMPARE(cache.totalUsed(), 0);
+
+    // too large for the whole cache
+    QVERIFY(!cache.insert("large", QImage(1024, 1024, QImage::Format_ARGB32)));
+    QCOMPARE(cache.totalUsed(), 0);
+
+    cache.insert("a", image);
+    cache.insert("b", image);
+    cache.clear();
+    QCOMPARE(cache.totalUsed(), 0);
+    QVERIFY(!cache.find("b", &found));
+}
+
+void tst_QPixmapCache::imageCacheEviction()
+{
+    QImageCache cache(16 * 10);
+    QStringList evicted;
+    cache.setEvictionCallback([&evicted](const QString &key, const QImage &) {
+        evicted.append(key);
+    });
+
+    const QImage image(64, 64, QImage::Format_ARGB32); // 16 KB
+    for (int i = 0; i < 10; ++i)
+        QVERIFY(cache.insert(QString::number(i), image));
+    QCOMPARE(cache.totalUsed(), 16 * 10);
+    QVERIFY(evicted.isEmpty());
+
+    for (int i = 10; i < 20; ++i) {
+        QVERIFY(cache.insert(QString::number(i), image));
+        QVERIFY(cache.totalUsed() <= cache.cacheLimit());
+    }
+    QCOMPARE(evicted.size(), 10);
+    // the most recent insertion always survives
+    QVERIFY(cache.find("19", nullptr));
+
+    evicted.clear();
+    cache.setCacheLimit(16 * 2);
+    QVERIFY(cache.totalUsed() <= 16 * 2);
+    QCOMPARE(evicted.size(), 10 - cache.totalUsed() / 16);
+}
+
+void tst_QPixmapCache::imageCacheThreads()
+{
+    QImageCache cache(16 * 50);
+    QAtomicInt evictions;
+    QAtomicInt mismatches;
+    cache.setEvictionCallback([&evictions](const QString &, const QImage &) {
+        evictions.ref();
+    });
+
+    const int threadCount = 4;
+    const int insertsPerThread = 100;
+    QList<QThread *> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.append(QThread::create([&cache, &mismatches, t] {
+            QImage image(64, 64, QImage::Format_ARGB32);
+            image.fill(Qt::green);
+            for (int i = 0; i < insertsPerThread; ++i) {
+                const QString key = QString::number(t) + QLatin1Char('-') + QString::number(i);
+                cache.insert(key, image);
+                QImage found;
+                if (cache.find(key, &found) && found != image)
+                    mismatches.ref();
+            }
+        }));
+        threads.last()->start();
+    }
+    for (QThread *thread : qAsConst(threads)) {
+        QVERIFY(thread->wait());
+        delete thread;
+    }
+
+    QCOMPARE(mismatches.loadRelaxed(), 0);
+    QVERIFY(cache.totalUsed() <= cache.cacheLimit());
+    QCOMPARE(evictions.loadRelaxed() + cache.totalUsed() / 16, threadCount * insertsPerThread);
+}
+
 QTEST_MAIN(tst_QPixmapCache)
 #include "tst_qpixmapcache.moc"
@@ -83,6 +83,7 @@ private slots:
     void mouseEventSequence();
     void windowModality();
     void inputReentrancy();
+    void compressMouseMoves();
     void tabletEvents();
     void windowModality_QTBUG27039();
     void visibility();
@@ -1739,6 +1740,41 @@ void tst_QWindow::inputReentrancy()
     QCOMPARE(window.touchReleasedCount, 1);
 }
 
+void tst_QWindow::compressMouseMoves()
+{
+    InputTestWindow window;
+    window.setTitle(QLatin1String(QTest::currentTestFunction()));
+    window.setGeometry(QRect(m_availableTopLeft + QPoint(80, 80), m_testWindowSize));
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    const bool compress = QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents);
+    QCoreApplication::setAttribute(Qt::AA_CompressHighFrequencyEvents);
+
+    // Consecutive moves collapse into the last one, a press in between is kept.
+    QPointF local(12, 34);
+    for (int i = 0; i < 3; ++i) {
+        local += QPointF(2, 2);
+        QWindowSystemInterface::handleMouseEvent<QWindowSystemInterface::AsynchronousDelivery>(
+                    &window, local, window.mapToGlobal(local), {}, Qt::NoButton, QEvent::MouseMove);
+    }
+    QWindowSystemInterface::handleMouseEvent<QWindowSystemInterface::AsynchronousDelivery>(
+                &window, local, window.mapToGlobal(local), Qt::LeftButton, Qt::LeftButton, QEvent::MouseButtonPress);
+    local += QPointF(2, 2);
+    QWindowSystemInterface::handleMouseEvent<QWindowSystemInterface::AsynchronousDelivery>(
+                &window, local, window.mapToGlobal(local), Qt::LeftButton, Qt::NoButton, QEvent::MouseMove);
+    QWindowSystemInterface::handleMouseEvent<QWindowSystemInterface::AsynchronousDelivery>(
+                &window, local, window.mapToGlobal(local), Qt::NoButton, Qt::LeftButton, QEvent::MouseButtonRelease);
+    QWindowSystemInterface::flushWindowSystemEvents();
+
+    QCoreApplication::setAttribute(Qt::AA_CompressHighFrequencyEvents, compress);
+
+    QCOMPARE(window.mouseMovedCount, 2);
+    QCOMPARE(window.mousePressedCount, 1);
+    QCOMPARE(window.mouseReleasedCount, 1);
+    QCOMPARE(window.mouseMoveScreenPos, window.mapToGlobal(local));
+}
+
 #if QT_CONFIG(tabletevent)
 class TabletTestWindow : public QWindow
 {
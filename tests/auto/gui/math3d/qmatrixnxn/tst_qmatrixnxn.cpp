@@ -154,6 +154,9 @@ private slots:
     void mapVector_data();
     void mapVector();
 
+    void mapArray_data() { mapVector_data(); }
+    void mapArray();
+
     void properties();
     void metaTypes();
 
@@ -3300,6 +3303,50 @@ void tst_QMatrixNxN::mapVector()
     QVERIFY(qFuzzyCompare(actual2.z(), expected.z()));
 }
 
+void tst_QMatrixNxN::mapArray()
+{
+    QFETCH(void *, mValues);
+
+    QMatrix4x4 m1((const float *)mValues);
+
+    const QVector3D points3[] = {
+        QVector3D(3.5f, -1.0f, 2.5f), QVector3D(0.0f, 0.0f, 0.0f),
+        QVector3D(-2.0f, 4.0f, 1.0f), QVector3D(1.0f, 1.0f, -7.5f), QVector3D(8.0f, 0.5f, 3.0f)
+    };
+    const QVector4D points4[] = {
+        QVector4D(3.5f, -1.0f, 2.5f, 1.0f), QVector4D(0.0f, 0.0f, 0.0f, 0.0f),
+        QVector4D(-2.0f, 4.0f, 1.0f, 2.0f), QVector4D(1.0f, 1.0f, -7.5f, 0.5f)
+    };
+    const int count3 = int(sizeof(points3) / sizeof(points3[0]));
+    const int count4 = int(sizeof(points4) / sizeof(points4[0]));
+
+    for (int pass = 0; pass < 2; ++pass) {
+        // The second pass lets the matrix take its type-specific paths.
+        if (pass == 1)
+            m1.optimize();
+
+        QVector3D results3[count3];
+        m1.map(points3, results3, count3);
+        QVector3D inPlace3[count3];
+        std::copy(points3, points3 + count3, inPlace3);
+        m1.map(inPlace3, inPlace3, count3);
+        for (int i = 0; i < count3; ++i) {
+            QVERIFY(qFuzzyCompare(results3[i], m1.map(points3[i])));
+            QCOMPARE(inPlace3[i], results3[i]);
+        }
+
+        QVector4D results4[count4];
+        m1.map(points4, results4, count4);
+        QVector4D inPlace4[count4];
+        std::copy(points4, points4 + count4, inPlace4);
+        m1.map(inPlace4, inPlace4, count4);
+        for (int i = 0; i < count4; ++i) {
+            QVERIFY(qFuzzyCompare(results4[i], m1.map(points4[i])));
+            QCOMPARE(inPlace4[i], results4[i]);
+        }
+    }
+}
+
 class tst_QMatrixNxN4x4Properties : public QObject
 {
     Q_OBJECT
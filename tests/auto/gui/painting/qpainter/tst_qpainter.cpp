@@ -298,9 +298,13 @@ private slots:
     void toRGB64();
 
     void fillPolygon();
+    void analyticAntialiasing_data();
+    void analyticAntialiasing();
 
     void drawImageAtPointF();
 
+    void strokeCachedPath();
+
 private:
     void fillData();
     void setPenColor(QPainter& p);
@@ -5358,6 +5362,61 @@ void tst_QPainter::fillPolygon()
     }
 }
 
+void tst_QPainter::analyticAntialiasing_data()
+{
+    QTest::addColumn<Qt::FillRule>("fillRule");
+
+    QTest::newRow("winding") << Qt::WindingFill;
+    QTest::newRow("odd-even") << Qt::OddEvenFill;
+}
+
+void tst_QPainter::analyticAntialiasing()
+{
+    QFETCH(Qt::FillRule, fillRule);
+
+    // A self-intersecting star overlapping a polygonal ellipse, so that both
+    // fill rules and the clip rectangle matter
+    QPainterPath path;
+    path.setFillRule(fillRule);
+    QPolygonF star;
+    for (int i = 0; i < 5; ++i) {
+        const qreal angle = i * 4 * M_PI / 5 - M_PI / 2;
+        star << QPointF(100.3 + 90 * qCos(angle), 100.7 + 90 * qSin(angle));
+    }
+    path.addPolygon(star);
+    path.closeSubpath();
+    QPolygonF ellipse;
+    for (int i = 0; i < 40; ++i) {
+        const qreal angle = i * 2 * M_PI / 40;
+        ellipse << QPointF(60.1 + 57.3 * qCos(angle), 130.2 + 33.9 * qSin(angle));
+    }
+    path.addPolygon(ellipse);
+    path.closeSubpath();
+
+    QImage expected(190, 200, QImage::Format_ARGB32_Premultiplied);
+    expected.fill(Qt::transparent);
+    QImage actual = expected;
+    {
+        QPainter p(&expected);
+        p.setRenderHint(QPainter::Antialiasing);
+        p.fillPath(path, Qt::black);
+    }
+    {
+        QPainter p(&actual);
+        p.setRenderHints(QPainter::Antialiasing | QPainter::AnalyticAntialiasing);
+        p.fillPath(path, Qt::black);
+    }
+
+    // Both rasterizers compute exact area coverage, so they only differ by rounding
+    for (int y = 0; y < expected.height(); ++y) {
+        for (int x = 0; x < expected.width(); ++x) {
+            const int difference = qAbs(qAlpha(actual.pixel(x, y)) - qAlpha(expected.pixel(x, y)));
+            if (difference > 3)
+                QFAIL(qPrintable(QString::fromLatin1("Coverage at %1,%2 differs by %3").arg(x).arg(y).arg(difference)));
+        }
+    }
+}
+
 void tst_QPainter::drawImageAtPointF()
 {
     // Just test we do not crash
@@ -5372,6 +5431,54 @@ void tst_QPainter::drawImageAtPointF()
     paint.end();
 }
 
+static QPainterPath zigZagPath()
+{
+    QPainterPath path;
+    path.moveTo(5, 5);
+    for (int i = 1; i < 200; ++i)
+        path.lineTo(5 + i, (i & 1) ? 60 : 5);
+    path.cubicTo(210, 5, 220, 60, 5, 90);
+    return path;
+}
+
+static QImage strokedPath(const QPainterPath &path, const QPen &pen, const QTransform &transform)
+{
+    QImage image(250, 250, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter p(&image);
+    p.setRenderHint(QPainter::Antialiasing);
+    p.setTransform(transform);
+    p.strokePath(path, pen);
+    p.end();
+    return image;
+}
+
+void tst_QPainter::strokeCachedPath()
+{
+    // Large paths drawn repeatedly have their stroke cached; make sure the
+    // cached stroke matches a fresh one and follows pen and scale changes.
+    const QPainterPath path = zigZagPath();
+    QPen pen(Qt::red, 3);
+    QTransform transform;
+
+    const QImage reference = strokedPath(zigZagPath(), pen, transform);
+    for (int i = 0; i < 3; ++i)
+        QCOMPARE(strokedPath(path, pen, transform), reference);
+
+    transform.translate(10, 20);
+    QCOMPARE(strokedPath(path, pen, transform), strokedPath(zigZagPath(), pen, transform));
+
+    pen.setWidthF(5);
+    pen.setJoinStyle(Qt::RoundJoin);
+    QCOMPARE(strokedPath(path, pen, transform), strokedPath(zigZagPath(), pen, transform));
+
+    transform.scale(1.5, 1.5);
+    QCOMPARE(strokedPath(path, pen, transform), strokedPath(zigZagPath(), pen, transform));
+
+    pen.setStyle(Qt::DashLine);
+    QCOMPARE(strokedPath(path, pen, transform), strokedPath(zigZagPath(), pen, transform));
+}
+
 QTEST_MAIN(tst_QPainter)
 
 #include "tst_qpainter.moc"
@@ -30,6 +30,7 @@
 #include <QtGlobal>
 #include <QtAlgorithms>
 #include <QtGui/QAbstractTextDocumentLayout>
+#include <QtGui/QPainter>
 #include <QtGui/QPageLayout>
 #include <QtGui/QPdfWriter>
 #include <QtGui/QTextCursor>
@@ -44,6 +45,7 @@ private slots:
     void testPageMetrics_data();
     void testPageMetrics();
     void qtbug59443();
+    void imageDeduplication();
 };
 
 void tst_QPdfWriter::basics()
@@ -281,6 +283,33 @@ void tst_QPdfWriter::qtbug59443()
 
 }
 
+void tst_QPdfWriter::imageDeduplication()
+{
+    QImage image(64, 64, QImage::Format_RGB32);
+    for (int y = 0; y < image.height(); ++y) {
+        for (int x = 0; x < image.width(); ++x)
+            image.setPixel(x, y, qRgb(x * 4, y * 4, (x ^ y) * 4));
+    }
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    {
+        QPdfWriter writer(&buffer);
+        QPainter painter(&writer);
+        painter.drawImage(0, 0, image);
+        writer.newPage();
+        // same contents, different cache key
+        const QImage copy = image.copy();
+        QVERIFY(copy.cacheKey() != image.cacheKey());
+        painter.drawImage(0, 0, copy);
+        writer.newPage();
+        // different contents
+        painter.drawImage(0, 0, image.mirrored());
+    }
+
+    QCOMPARE(buffer.data().count("/Subtype /Image"), 2);
+}
+
 QTEST_MAIN(tst_QPdfWriter)
 
 #include "tst_qpdfwriter.moc"
@@ -676,6 +676,29 @@ void tst_QRegion::operator_minus_data()
     rects << QRect(0, 0, 12, 12) << QRect(15, 0, 12, 12);
     minus.setRects(rects.constData(), rects.size());
     QTest::newRow("empty 3") << dest << minus << QRegion();
+
+    rects.clear();
+    rects << QRect(0, 0, 30, 10)
+          << QRect(0, 10, 10, 10) << QRect(20, 10, 10, 10)
+          << QRect(0, 20, 30, 10);
+    dest.setRects(rects.constData(), rects.size());
+    QTest::newRow("rect hole") << QRegion(0, 0, 30, 30)
+                               << QRegion(10, 10, 10, 10)
+                               << dest;
+
+    rects.clear();
+    rects << QRect(0, 0, 30, 10) << QRect(0, 10, 20, 20);
+    dest.setRects(rects.constData(), rects.size());
+    QTest::newRow("rect corner") << QRegion(0, 0, 30, 30)
+                                 << QRegion(20, 10, 20, 30)
+                                 << dest;
+
+    QTest::newRow("rect top") << QRegion(0, 0, 30, 30)
+                              << QRegion(-5, -5, 40, 15)
+                              << QRegion(0, 10, 30, 20);
+    QTest::newRow("rect left") << QRegion(0, 0, 30, 30)
+                               << QRegion(-5, -5, 15, 40)
+                               << QRegion(10, 0, 20, 30);
 }
 
 void tst_QRegion::operator_minus()
@@ -326,6 +326,12 @@ void tst_QRhi::create()
 
         rhi->releaseCachedResources();
 
+        // Round-tripping the pipeline cache data, or feeding in garbage,
+        // must not cause problems.
+        const QByteArray pipelineCacheData = rhi->pipelineCacheData();
+        rhi->setPipelineCacheData(pipelineCacheData);
+        rhi->setPipelineCacheData(QByteArray(64, 'x'));
+
         QVERIFY(!rhi->isDeviceLost());
 
         rhi.reset();
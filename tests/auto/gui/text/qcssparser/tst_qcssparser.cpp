@@ -1010,6 +1010,11 @@ void tst_QCssParser::styleSelector_data()
 
     QTest::newRow("class") << true << QString(".foo") << QString("<p class=\"foo\" />") << QString();
     QTest::newRow("noclass") << false << QString(".bar") << QString("<p class=\"foo\" />") << QString();
+    QTest::newRow("multiclass") << true << QString(".bar") << QString("<p class=\"foo bar\" />") << QString();
+    QTest::newRow("duplicateclass") << true << QString(".foo") << QString("<p class=\"foo foo\" />") << QString();
+    QTest::newRow("classdescendant") << true << QString("parent .foo")
+                                     << QString("<parent><child class=\"foo\" /></parent>")
+                                     << QString("parent/child");
 
     QTest::newRow("attrset") << true << QString("[justset]") << QString("<p justset=\"bar\" />") << QString();
     QTest::newRow("notattrset") << false << QString("[justset]") << QString("<p otherattribute=\"blub\" />") << QString();
@@ -1426,6 +1426,16 @@ void tst_QTextCursor::insertText()
     QCOMPARE(cursor.block().text(), QString(QString("Meep") + QChar(QChar::LineSeparator) + QString("Baz")));
     cursor.movePosition(QTextCursor::NextBlock);
     QCOMPARE(cursor.block().text(), QString("yoyodyne"));
+
+    // the inserted string is shared with the document, but must not be modified
+    QVERIFY(txt.startsWith("Foo\nBar\r\nMeep"));
+
+    const QString plainText = doc->toPlainText();
+    doc->undo();
+    QVERIFY(doc->isEmpty());
+    doc->redo();
+    QCOMPARE(blockCount(), 4);
+    QCOMPARE(doc->toPlainText(), plainText);
 }
 
 void tst_QTextCursor::insertFragmentShouldUseCurrentCharFormat()
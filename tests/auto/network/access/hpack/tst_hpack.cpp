@@ -59,6 +59,7 @@ private Q_SLOTS:
 
     void lookupTableStatic();
     void lookupTableDynamic();
+    void lookupTableDuplicates();
 
     void hpackEncodeRequest_data();
     void hpackEncodeRequest();
@@ -493,6 +494,52 @@ void tst_Hpack::lookupTableDynamic()
     QVERIFY(table.indexOf("name1") == 0);
 }
 
+void tst_Hpack::lookupTableDuplicates()
+{
+    FieldLookupTable table(4096, true);
+    const quint32 firstDynamic = table.numberOfStaticEntries() + 1;
+
+    QVERIFY(table.prependField("x-a", "1"));
+    QVERIFY(table.prependField("x-b", "2"));
+    QVERIFY(table.prependField("x-a", "1"));
+    QCOMPARE(table.numberOfDynamicEntries(), 3u);
+    // The newest duplicate is found:
+    QCOMPARE(table.indexOf("x-a", "1"), firstDynamic);
+    QCOMPARE(table.indexOf("x-a"), firstDynamic);
+    QCOMPARE(table.indexOf("x-b", "2"), firstDynamic + 1);
+
+    // Evicting the older duplicate keeps the newer one indexed:
+    table.evictEntry();
+    QCOMPARE(table.numberOfDynamicEntries(), 2u);
+    QCOMPARE(table.indexOf("x-a", "1"), firstDynamic);
+    QCOMPARE(table.indexOf("x-b"), firstDynamic + 1);
+    table.evictEntry();
+    QCOMPARE(table.indexOf("x-b"), 0u);
+    QCOMPARE(table.indexOf("x-a", "1"), firstDynamic);
+
+    // Fill the table well beyond its capacity, so that entries wrap
+    // around in the dynamic part and the oldest ones get evicted:
+    table.clearDynamicTable();
+    QByteArray name, value;
+    for (int i = 0; i < 1000; ++i) {
+        const QByteArray number = QByteArray::number(i);
+        QVERIFY(table.prependField("x-field", number));
+        QCOMPARE(table.indexOf("x-field", number), firstDynamic);
+        QCOMPARE(table.indexOf("x-field"), firstDynamic);
+        QVERIFY(table.dynamicDataSize() <= 4096);
+    }
+    const quint32 nDynamic = table.numberOfDynamicEntries();
+    QVERIFY(nDynamic > 16);
+    for (quint32 i = 0; i < nDynamic; ++i) {
+        const QByteArray number = QByteArray::number(999 - int(i));
+        QCOMPARE(table.indexOf("x-field", number), firstDynamic + i);
+        QVERIFY(table.field(firstDynamic + i, &name, &value));
+        QCOMPARE(name, QByteArray("x-field"));
+        QCOMPARE(value, number);
+    }
+    QCOMPARE(table.indexOf("x-field", QByteArray::number(999 - int(nDynamic))), 0u);
+}
+
 void  tst_Hpack::hpackEncodeRequest_data()
 {
     QTest::addColumn<bool>("compression");
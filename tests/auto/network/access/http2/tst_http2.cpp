@@ -101,6 +101,7 @@ private slots:
     void singleRequest_data();
     void singleRequest();
     void multipleRequests();
+    void flowControlClientSide_data();
     void flowControlClientSide();
     void flowControlServerSide();
     void pushPromise();
@@ -319,6 +320,14 @@ void tst_Http2::multipleRequests()
     QVERIFY(serverGotSettingsACK);
 }
 
+void tst_Http2::flowControlClientSide_data()
+{
+    QTest::addColumn<unsigned>("windowUpdateThreshold");
+
+    QTest::addRow("default") << 50u;
+    QTest::addRow("exhausted-windows") << 100u;
+}
+
 void tst_Http2::flowControlClientSide()
 {
     // Create a server but impose limits:
@@ -342,6 +351,13 @@ void tst_Http2::flowControlClientSide()
     params.setSessionReceiveWindowSize(Http2::defaultSessionWindowSize * 5);
     params.setStreamReceiveWindowSize(Http2::defaultSessionWindowSize);
 
+    QFETCH(unsigned, windowUpdateThreshold);
+    QCOMPARE(params.windowUpdateThreshold(), 50u);
+    QTest::ignoreMessage(QtWarningMsg, "Invalid window update threshold");
+    QVERIFY(!params.setWindowUpdateThreshold(0));
+    QVERIFY(params.setWindowUpdateThreshold(windowUpdateThreshold));
+    QCOMPARE(params.windowUpdateThreshold(), windowUpdateThreshold);
+
     const RawSettings serverSettings = {{Settings::MAX_CONCURRENT_STREAMS_ID, quint32(3)}};
     ServerPtr srv(newServer(serverSettings, defaultConnectionType(), qt_H2ConfigurationToSettings(params)));
 
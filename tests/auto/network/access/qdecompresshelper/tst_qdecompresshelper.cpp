@@ -53,6 +53,10 @@ private Q_SLOTS:
     void partialDecompress_data();
     void partialDecompress();
 
+    void decompressIntoBuffer_data();
+    void decompressIntoBuffer();
+    void decompressIntoBufferBlocks();
+
     void countAhead_data();
     void countAhead();
     void countAheadByteDataBuffer_data();
@@ -202,6 +206,67 @@ void tst_QDecompressHelper::partialDecompress()
     QCOMPARE(actual, expected);
 }
 
+void tst_QDecompressHelper::decompressIntoBuffer_data()
+{
+    sharedDecompress_data();
+}
+
+void tst_QDecompressHelper::decompressIntoBuffer()
+{
+    QDecompressHelper helper;
+
+    QFETCH(QByteArray, encoding);
+    QVERIFY(helper.setEncoding(encoding));
+
+    QFETCH(QByteArray, data);
+    helper.feed(data);
+
+    QByteDataBuffer buffer;
+    QFETCH(QByteArray, expected);
+    QCOMPARE(helper.read(&buffer), expected.size());
+    QVERIFY(!helper.hasData());
+    QCOMPARE(buffer.bufferCount(), 1);
+    QCOMPARE(buffer.readAll(), expected);
+}
+
+// Data that expands to more than one block should fill every block but the last
+void tst_QDecompressHelper::decompressIntoBufferBlocks()
+{
+    QByteArray expected;
+    for (int i = 0; expected.size() < 1024 * 1024; ++i)
+        expected += "line " + QByteArray::number(i) + '\n';
+    // qCompress prepends the expected size to the zlib stream
+    const QByteArray compressed = qCompress(expected).mid(4);
+
+    QDecompressHelper helper;
+    QVERIFY(helper.setEncoding("deflate"));
+    QByteDataBuffer buffer;
+    qsizetype total = 0;
+    for (qsizetype i = 0; i < compressed.size(); i += 1000) {
+        helper.feed(compressed.mid(i, 1000));
+        const qsizetype bytesRead = helper.read(&buffer);
+        QVERIFY(bytesRead >= 0);
+        total += bytesRead;
+    }
+    QCOMPARE(total, expected.size());
+
+    QVERIFY(buffer.bufferCount() > 1);
+    QByteArray actual;
+    while (!buffer.isEmpty())
+        actual += buffer.read();
+    QCOMPARE(actual, expected);
+
+    // Fed in one go, the whole body is decompressed in a single call
+    helper.clear();
+    QVERIFY(helper.setEncoding("deflate"));
+    helper.feed(compressed);
+    QCOMPARE(helper.read(&buffer), expected.size());
+    const qint64 firstBlockSize = buffer.sizeNextBlock();
+    while (buffer.bufferCount() > 1)
+        QCOMPARE(buffer.read().size(), firstBlockSize);
+    QVERIFY(buffer.sizeNextBlock() <= firstBlockSize);
+}
+
 void tst_QDecompressHelper::countAhead_data()
 {
     sharedDecompress_data();
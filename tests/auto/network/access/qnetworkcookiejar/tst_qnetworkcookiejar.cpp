@@ -50,6 +50,7 @@ private slots:
     void setCookiesFromUrl();
     void cookiesForUrl_data();
     void cookiesForUrl();
+    void manyDomains();
 #if defined(QT_BUILD_INTERNAL) && QT_CONFIG(topleveldomain)
     void effectiveTLDs_data();
     void effectiveTLDs();
@@ -406,6 +407,48 @@ void tst_QNetworkCookieJar::cookiesForUrl()
 }
 
 // This test requires private API.
+void tst_QNetworkCookieJar::manyDomains()
+{
+    MyCookieJar jar;
+    QList<QNetworkCookie> expectedAll;
+    for (int i = 0; i < 1000; ++i) {
+        QNetworkCookie cookie("c" + QByteArray::number(i), "v");
+        cookie.setDomain(".host" + QString::number(i % 100) + ".example.com");
+        cookie.setPath((i / 100) % 2 ? "/" : "/web");
+        QVERIFY(jar.insertCookie(cookie));
+        expectedAll += cookie;
+    }
+    QNetworkCookie parent("parent", "v");
+    parent.setDomain(".example.com");
+    parent.setPath("/");
+    QVERIFY(jar.insertCookie(parent));
+    expectedAll += parent;
+    QNetworkCookie hostOnly("hostonly", "v");
+    hostOnly.setDomain("example.com");
+    hostOnly.setPath("/");
+    QVERIFY(jar.insertCookie(hostOnly));
+    expectedAll += hostOnly;
+    QCOMPARE(jar.allCookies(), expectedAll);
+
+    QVERIFY(jar.deleteCookie(expectedAll.takeAt(7)));
+    QCOMPARE(jar.allCookies(), expectedAll);
+
+    const QList<QNetworkCookie> result = jar.cookiesForUrl(QUrl("http://www.host7.example.com/web/page"));
+    // ten cookies set for .host7, minus the deleted one, plus the .example.com one
+    QCOMPARE(result.size(), 10);
+    for (int i = 0; i < result.size(); ++i) {
+        if (i < 4)
+            QCOMPARE(result.at(i).path(), QLatin1String("/web"));
+        else
+            QCOMPARE(result.at(i).path(), QLatin1String("/"));
+    }
+    QCOMPARE(result.first().name(), QByteArray("c207"));
+    QCOMPARE(result.last(), parent);
+
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://example.com/")), (QList<QNetworkCookie>{ parent, hostOnly }));
+    QVERIFY(jar.cookiesForUrl(QUrl("http://host7.example.org/")).isEmpty());
+}
+
 #if defined(QT_BUILD_INTERNAL) && QT_CONFIG(topleveldomain)
 void tst_QNetworkCookieJar::effectiveTLDs_data()
 {
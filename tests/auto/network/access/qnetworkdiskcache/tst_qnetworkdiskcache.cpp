@@ -69,6 +69,7 @@ private slots:
     void updateMetaData();
     void fileMetaData();
     void expire();
+    void expireLeastRecentlyUsed();
 
     void oldCacheVersionFile_data();
     void oldCacheVersionFile();
@@ -534,6 +535,35 @@ void tst_QNetworkDiskCache::expire()
     }
 }
 
+void tst_QNetworkDiskCache::expireLeastRecentlyUsed()
+{
+    SubQNetworkDiskCache cache;
+    cache.setCacheDirectory(tempDir.path());
+    QCOMPARE(cache.call_expire(), (qint64)0);
+
+    const QByteArray payload(1024 * 256, 'Z');
+    for (int i = 0; i < 3; ++i) {
+        QNetworkCacheMetaData m;
+        m.setUrl(QUrl("http://localhost:4/" + QString::number(i)));
+        QIODevice *d = cache.prepare(m);
+        QVERIFY(d);
+        d->write(payload);
+        cache.insert(d);
+    }
+
+    // reading the oldest entry makes the second one the least recently used
+    QScopedPointer<QIODevice> device(cache.data(QUrl("http://localhost:4/0")));
+    QVERIFY(device);
+    QCOMPARE(device->readAll(), payload);
+    device.reset();
+
+    cache.setMaximumCacheSize(1024 * 600);
+    QVERIFY(cache.cacheSize() < cache.maximumCacheSize());
+    QVERIFY(cache.metaData(QUrl("http://localhost:4/0")).isValid());
+    QVERIFY(!cache.metaData(QUrl("http://localhost:4/1")).isValid());
+    QVERIFY(cache.metaData(QUrl("http://localhost:4/2")).isValid());
+}
+
 void tst_QNetworkDiskCache::oldCacheVersionFile_data()
 {
     QTest::addColumn<int>("pass");
@@ -294,6 +294,7 @@ private Q_SLOTS:
 #endif
     void ioGetFromHttpBrokenServer_data();
     void ioGetFromHttpBrokenServer();
+    void replyTimings();
     void ioGetFromHttpStatus100_data();
     void ioGetFromHttpStatus100();
     void ioGetFromHttpNoHeaders_data();
@@ -3910,6 +3911,46 @@ void tst_QNetworkReply::ioGetFromHttpBrokenServer()
     QVERIFY(reply->error() != QNetworkReply::NoError);
 }
 
+void tst_QNetworkReply::replyTimings()
+{
+    QVERIFY(!QNetworkReplyTimings().isValid());
+    QCOMPARE(QNetworkReplyTimings().nsecsSinceStart(QNetworkReplyTimings::ResponseEnd), qint64(-1));
+
+    MiniHttpServer server("HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\nabc");
+    server.doClose = false;
+    server.multiple = true;
+
+    QNetworkRequest request(QUrl("http://localhost:" + QString::number(server.serverPort())));
+    QNetworkReplyPtr reply(manager.get(request));
+    QCOMPARE(waitForFinish(reply), int(Success));
+
+    const QNetworkReplyTimings timings = reply->timings();
+    QVERIFY(timings.isValid());
+    const QNetworkReplyTimings::Milestone milestones[] = {
+        QNetworkReplyTimings::RequestStart, QNetworkReplyTimings::ConnectStart,
+        QNetworkReplyTimings::ConnectEnd, QNetworkReplyTimings::RequestSent,
+        QNetworkReplyTimings::ResponseStart, QNetworkReplyTimings::ResponseEnd
+    };
+    qint64 previous = 0;
+    for (QNetworkReplyTimings::Milestone milestone : milestones) {
+        QVERIFY2(timings.hasMilestone(milestone), QByteArray::number(int(milestone)));
+        QVERIFY(timings.nsecsSinceStart(milestone) >= previous);
+        previous = timings.nsecsSinceStart(milestone);
+    }
+    QVERIFY(!timings.hasMilestone(QNetworkReplyTimings::SecureConnectionStart));
+    QCOMPARE(timings.nsecsBetween(QNetworkReplyTimings::RequestStart, QNetworkReplyTimings::ResponseEnd),
+             timings.nsecsSinceStart(QNetworkReplyTimings::ResponseEnd));
+    QCOMPARE(timings.nsecsBetween(QNetworkReplyTimings::ConnectEnd,
+                                  QNetworkReplyTimings::SecureConnectionStart), qint64(-1));
+
+    // The second request reuses the connection, so it has no connection milestones.
+    reply.reset(manager.get(request));
+    QCOMPARE(waitForFinish(reply), int(Success));
+    QVERIFY(reply->timings().hasMilestone(QNetworkReplyTimings::ResponseEnd));
+    QVERIFY(!reply->timings().hasMilestone(QNetworkReplyTimings::ConnectStart));
+    QCOMPARE(server.totalConnections, 1);
+}
+
 void tst_QNetworkReply::ioGetFromHttpStatus100_data()
 {
     QTest::addColumn<QByteArray>("dataToSend");
@@ -31,6 +31,9 @@
 #include <QtCore/QUrl>
 #include <QtNetwork/QNetworkRequest>
 #include <QtNetwork/QNetworkCookie>
+#if QT_CONFIG(http)
+#include <QtNetwork/QHttp1Configuration>
+#endif
 
 Q_DECLARE_METATYPE(QNetworkRequest::KnownHeaders)
 
@@ -55,6 +58,9 @@ private slots:
     void originatingObject();
 
     void removeHeader();
+#if QT_CONFIG(http)
+    void http1Configuration();
+#endif
 };
 
 void tst_QNetworkRequest::ctor_data()
@@ -556,5 +562,34 @@ void tst_QNetworkRequest::originatingObject()
     QVERIFY(!request.originatingObject());
 }
 
+#if QT_CONFIG(http)
+void tst_QNetworkRequest::http1Configuration()
+{
+    QNetworkRequest request;
+    QHttp1Configuration config = request.http1Configuration();
+    QCOMPARE(config.numberOfConnectionsPerHost(), 6U);
+
+    QTest::ignoreMessage(QtWarningMsg, "QHttp1Configuration::setNumberOfConnectionsPerHost: "
+                                       "invalid number of connections: 0");
+    QVERIFY(!config.setNumberOfConnectionsPerHost(0));
+    QTest::ignoreMessage(QtWarningMsg, "QHttp1Configuration::setNumberOfConnectionsPerHost: "
+                                       "invalid number of connections: 256");
+    QVERIFY(!config.setNumberOfConnectionsPerHost(256));
+    QCOMPARE(config.numberOfConnectionsPerHost(), 6U);
+
+    QVERIFY(config.setNumberOfConnectionsPerHost(12));
+    QCOMPARE(config.numberOfConnectionsPerHost(), 12U);
+    QVERIFY(config != request.http1Configuration());
+
+    request.setHttp1Configuration(config);
+    QCOMPARE(request.http1Configuration(), config);
+    QCOMPARE(request.http1Configuration().numberOfConnectionsPerHost(), 12U);
+
+    const QNetworkRequest copy = request;
+    QCOMPARE(copy, request);
+    QVERIFY(QNetworkRequest() != request);
+}
+#endif
+
 QTEST_MAIN(tst_QNetworkRequest)
 #include "tst_qnetworkrequest.moc"
@@ -104,6 +104,7 @@ private slots:
     void multipleDifferentLookups();
 
     void cache();
+    void cacheRefresh();
 
     void abortHostLookup();
 protected slots:
@@ -695,6 +696,77 @@ void tst_QHostInfo::cache()
     QCOMPARE(lookupsDoneCounter, 2);
 }
 
+void tst_QHostInfo::cacheRefresh()
+{
+    QFETCH_GLOBAL(bool, cache);
+    if (!cache)
+        return; // test makes only sense when cache enabled
+
+    // entries expire after 3 seconds and get refreshed after 200 ms
+    const int maxAge = 3000;
+    qt_qhostinfo_set_cache_ages(maxAge, 200);
+    const auto restoreAges = qScopeGuard([] { qt_qhostinfo_set_cache_ages(60 * 1000, 45 * 1000); });
+
+    // the name does not resolve, so refreshing the entry fails
+    const QString name = QStringLiteral("invalid" TEST_DOMAIN);
+    QHostInfo injected;
+    injected.setHostName(name);
+    injected.setAddresses({ QHostAddress(QStringLiteral("192.0.2.1")) });
+    qt_qhostinfo_cache_inject(name, injected);
+    QElapsedTimer age;
+    age.start();
+    QTest::qSleep(300);
+
+    // Each lookup and each refresh takes the next lookup id, so the ids of
+    // two consecutive lookups tell how many refreshes were scheduled.
+    lookupsDoneCounter = 0;
+    int id = QHostInfo::lookupHost(name, this, SLOT(resultsReady(QHostInfo)));
+    QTestEventLoop::instance().enterLoop(5);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(lookupResults.error(), QHostInfo::NoError);
+    QCOMPARE(lookupResults.addresses(), injected.addresses());
+
+    int nextId = QHostInfo::lookupHost(name, this, SLOT(resultsReady(QHostInfo)));
+    QCOMPARE(nextId, id + 2);
+    QTestEventLoop::instance().enterLoop(5);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(lookupResults.addresses(), injected.addresses());
+
+    id = nextId;
+    nextId = QHostInfo::lookupHost(name, this, SLOT(resultsReady(QHostInfo)));
+    QCOMPARE(nextId, id + 1);
+    QTestEventLoop::instance().enterLoop(5);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(lookupResults.addresses(), injected.addresses());
+    QCOMPARE(lookupsDoneCounter, 3);
+
+    // Wait for the refresh to fail: a lookup that bypasses the cache is
+    // postponed until the refresh for the same name has finished.
+    qt_qhostinfo_enable_cache(false);
+    QHostInfo::lookupHost(name, this, SLOT(resultsReady(QHostInfo)));
+    QTestEventLoop::instance().enterLoop(10);
+    qt_qhostinfo_enable_cache(true);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(lookupResults.error(), QHostInfo::HostNotFound);
+
+    if (age.elapsed() >= maxAge - 100)
+        QSKIP("The refresh took longer than the cache keeps entries");
+
+    // the failed refresh left the entry in the cache
+    bool valid = false;
+    QHostInfo result = qt_qhostinfo_lookup(name, this, SLOT(resultsReady(QHostInfo)), &valid, &id);
+    QVERIFY(valid);
+    QCOMPARE(result.addresses(), injected.addresses());
+
+    // until it expires
+    QTest::qSleep(qMax(0, maxAge - int(age.elapsed())) + 100);
+    result = qt_qhostinfo_lookup(name, this, SLOT(resultsReady(QHostInfo)), &valid, &id);
+    QVERIFY(!valid);
+    QTestEventLoop::instance().enterLoop(10);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(lookupResults.error(), QHostInfo::HostNotFound);
+}
+
 void tst_QHostInfo::resultsReady(const QHostInfo &hi)
 {
     QVERIFY(QThread::currentThread() == thread());
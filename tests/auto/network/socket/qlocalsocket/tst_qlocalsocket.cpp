@@ -78,6 +78,9 @@ private slots:
     void sendData();
 
     void readBufferOverflow();
+#if defined(Q_OS_UNIX) && !defined(QT_LOCALSOCKET_TCP)
+    void fileDescriptorPassing();
+#endif
 
     void simpleCommandProtocol1();
     void simpleCommandProtocol2();
@@ -682,6 +685,46 @@ static QVariant readCommand(QIODevice *ioDevice, int *readCommandCounter, bool r
     return command;
 }
 
+#if defined(Q_OS_UNIX) && !defined(QT_LOCALSOCKET_TCP)
+void tst_QLocalSocket::fileDescriptorPassing()
+{
+    const QString serverName = QLatin1String("tst_localsocket_fdpassing");
+    LocalServer server;
+    QVERIFY(server.listen(serverName));
+
+    LocalSocket client;
+    client.connectToServer(serverName);
+    QVERIFY(server.waitForNewConnection(3000));
+    QCOMPARE(client.state(), QLocalSocket::ConnectedState);
+    QLocalSocket *serverSocket = server.nextPendingConnection();
+    QVERIFY(serverSocket);
+
+    int pipes[2];
+    QCOMPARE(::pipe(pipes), 0);
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         "QLocalSocket::writeFileDescriptors: Descriptors must be sent with data");
+    QVERIFY(!client.writeFileDescriptors(QByteArray(), { pipes[1] }));
+    QVERIFY(client.writeFileDescriptors("pipe", { pipes[1] }));
+    ::close(pipes[1]);      // the socket holds its own copy
+    QVERIFY(client.waitForBytesWritten());
+
+    QVERIFY(serverSocket->waitForReadyRead());
+    QCOMPARE(serverSocket->readAll(), QByteArray("pipe"));
+    const QList<int> received = serverSocket->takeFileDescriptors();
+    QCOMPARE(received.size(), 1);
+    QVERIFY(serverSocket->takeFileDescriptors().isEmpty());
+
+    // the received descriptor refers to the same pipe
+    QCOMPARE(::write(received.first(), "x", 1), ssize_t(1));
+    ::close(received.first());
+    char c = 0;
+    QCOMPARE(::read(pipes[0], &c, 1), ssize_t(1));
+    QCOMPARE(c, 'x');
+    ::close(pipes[0]);
+}
+#endif
+
 void tst_QLocalSocket::simpleCommandProtocol1()
 {
     QLocalServer server;
@@ -91,6 +91,7 @@ private slots:
     void setSocketDescriptor();
     void listenWhileListening();
     void addressReusable();
+    void portSharing();
     void setNewSocketDescriptorBlocking();
 #ifndef QT_NO_NETWORKPROXY
     void invalidProxy_data();
@@ -629,6 +630,50 @@ void tst_QTcpServer::addressReusable()
 #endif
 }
 
+void tst_QTcpServer::portSharing()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        QSKIP("Port sharing is not supported through a proxy");
+
+    QTcpServer first;
+    QVERIFY(!first.isPortSharingEnabled());
+    first.setPortSharingEnabled(true);
+    QVERIFY(first.isPortSharingEnabled());
+#if !defined(Q_OS_UNIX)
+    QVERIFY(!first.listen(QHostAddress::LocalHost));
+    QCOMPARE(first.serverError(), QAbstractSocket::UnsupportedSocketOperationError);
+#else
+    QVERIFY2(first.listen(QHostAddress::LocalHost), qPrintable(first.errorString()));
+    const quint16 port = first.serverPort();
+
+    QTcpServer exclusive;
+    QVERIFY(!exclusive.listen(QHostAddress::LocalHost, port));
+
+    QTcpServer second;
+    second.setPortSharingEnabled(true);
+    QVERIFY2(second.listen(QHostAddress::LocalHost, port), qPrintable(second.errorString()));
+
+    QSignalSpy firstSpy(&first, &QTcpServer::newConnection);
+    QSignalSpy secondSpy(&second, &QTcpServer::newConnection);
+    first.setMaxPendingConnections(10);
+    second.setMaxPendingConnections(10);
+
+    QTcpSocket clients[8];
+    for (QTcpSocket &client : clients)
+        client.connectToHost(QHostAddress::LocalHost, port);
+    for (QTcpSocket &client : clients)
+        QVERIFY(client.waitForConnected(5000));
+    QTRY_COMPARE(firstSpy.count() + secondSpy.count(), 8);
+
+    QTcpServer *server = first.hasPendingConnections() ? &first : &second;
+    QTcpSocket *accepted = server->nextPendingConnection();
+    QVERIFY(accepted);
+    QCOMPARE(accepted->state(), QAbstractSocket::ConnectedState);
+    QVERIFY(::fcntl(int(accepted->socketDescriptor()), F_GETFL) & O_NONBLOCK);
+#endif
+}
+
 void tst_QTcpServer::setNewSocketDescriptorBlocking()
 {
     QFETCH_GLOBAL(bool, setProxy);
@@ -60,6 +60,7 @@
 #endif
 #include <QRandomGenerator>
 #include <QStringList>
+#include <QTemporaryFile>
 #include <QTcpServer>
 #include <QTcpSocket>
 #ifndef QT_NO_SSL
@@ -178,6 +179,7 @@ private slots:
     void suddenRemoteDisconnect_data();
     void suddenRemoteDisconnect();
     void connectToMultiIP();
+    void connectionRacing();
     void moveToThread0();
     void increaseReadBufferSize();
     void increaseReadBufferSizeFromSlot();
@@ -200,6 +202,9 @@ private slots:
     void socketDiscardDataInWriteMode();
     void writeOnReadBufferOverflow();
     void readNotificationsAfterBind();
+    void sendFile();
+    void writeChunks();
+    void writeBufferMarks();
 
 protected slots:
     void nonBlockingIMAP_hostFound();
@@ -2577,6 +2582,36 @@ void tst_QTcpSocket::connectToMultiIP()
 #endif
 }
 
+//----------------------------------------------------------------------------------
+void tst_QTcpSocket::connectionRacing()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+
+    // The first address is from TEST-NET-1 (RFC 5737) and never answers, so
+    // without racing the connection attempt would wait for the 30 s timeout.
+    const QString hostName = QStringLiteral("qt-test-server-racing");
+    QHostInfo info;
+    info.setAddresses({ QHostAddress("192.0.2.1"), QHostAddress::LocalHost });
+    qt_qhostinfo_cache_inject(hostName, info);
+
+    QTcpSocket *socket = newSocket();
+    QElapsedTimer stopWatch;
+    stopWatch.start();
+    socket->connectToHost(hostName, server.serverPort());
+    QTRY_COMPARE_WITH_TIMEOUT(socket->state(), QAbstractSocket::ConnectedState, 10000);
+    QVERIFY(stopWatch.elapsed() < 10000);
+    QCOMPARE(socket->peerAddress(), QHostAddress(QHostAddress::LocalHost));
+    QCOMPARE(socket->peerName(), hostName);
+    QVERIFY(server.waitForNewConnection(5000));
+
+    delete socket;
+}
+
 //----------------------------------------------------------------------------------
 void tst_QTcpSocket::moveToThread0()
 {
@@ -3216,5 +3251,163 @@ void tst_QTcpSocket::readNotificationsAfterBind()
     QCOMPARE(spyReadyRead.count(), 0);
 }
 
+// Test that sendFile() keeps file contents ordered with surrounding writes
+void tst_QTcpSocket::sendFile()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QByteArray contents(3 * 1024 * 1024 + 17, Qt::Uninitialized);
+    for (int i = 0; i < contents.size(); ++i)
+        contents[i] = char(i * 7 + (i >> 11));
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write(contents), qint64(contents.size()));
+    QVERIFY(file.flush());
+    QVERIFY(file.seek(5));
+
+    QTcpServer tcpServer;
+    QTcpSocket *socket = newSocket();
+    QVERIFY(tcpServer.listen(QHostAddress::LocalHost));
+    socket->connectToHost(tcpServer.serverAddress(), tcpServer.serverPort());
+    QVERIFY(socket->waitForConnected(5000));
+    QVERIFY2(tcpServer.waitForNewConnection(5000), "Network timeout");
+    QTcpSocket *newConnection = tcpServer.nextPendingConnection();
+    QVERIFY(newConnection != nullptr);
+
+    QSignalSpy spyBytesWritten(socket, &QIODevice::bytesWritten);
+    const qint64 offset = 1000;
+    QCOMPARE(socket->write("head"), Q_INT64_C(4));
+    QCOMPARE(socket->sendFile(&file, offset), qint64(contents.size()) - offset);
+    QCOMPARE(socket->sendFile(&file, 0, 3), Q_INT64_C(3));
+    QCOMPARE(socket->write("tail"), Q_INT64_C(4));
+    // the file's own position is not touched
+    QCOMPARE(file.pos(), Q_INT64_C(5));
+    file.close();
+
+    const QByteArray expected = "head" + contents.mid(offset) + contents.left(3) + "tail";
+    QByteArray received;
+    QElapsedTimer timer;
+    timer.start();
+    while (received.size() < expected.size() && timer.elapsed() < 20000) {
+        QCoreApplication::processEvents();
+        if (newConnection->waitForReadyRead(100))
+            received += newConnection->readAll();
+    }
+    QCOMPARE(received.size(), expected.size());
+    QVERIFY(received == expected);
+
+    qint64 totalWritten = 0;
+    for (const QList<QVariant> &args : qAsConst(spyBytesWritten))
+        totalWritten += args.at(0).toLongLong();
+    QCOMPARE(totalWritten, qint64(expected.size()));
+    QCOMPARE(socket->bytesToWrite(), Q_INT64_C(0));
+
+    // out-of-range offsets are rejected
+    QVERIFY(file.open());
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("offset .* is out of range"));
+    QCOMPARE(socket->sendFile(&file, contents.size() + 1), Q_INT64_C(-1));
+
+    delete newConnection;
+    delete socket;
+}
+
+// Test that writeBufferFull() and writeBufferDrained() follow bytesToWrite()
+void tst_QTcpSocket::writeBufferMarks()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTcpServer tcpServer;
+    QTcpSocket *socket = newSocket();
+    QVERIFY(tcpServer.listen(QHostAddress::LocalHost));
+    socket->connectToHost(tcpServer.serverAddress(), tcpServer.serverPort());
+    QVERIFY(socket->waitForConnected(5000));
+    QVERIFY2(tcpServer.waitForNewConnection(5000), "Network timeout");
+    QTcpSocket *newConnection = tcpServer.nextPendingConnection();
+    QVERIFY(newConnection != nullptr);
+
+    QCOMPARE(socket->writeBufferSize(), Q_INT64_C(0));
+    QCOMPARE(socket->writeBufferLowWaterMark(), Q_INT64_C(0));
+    socket->setWriteBufferSize(64 * 1024);
+    socket->setWriteBufferLowWaterMark(16 * 1024);
+
+    QSignalSpy fullSpy(socket, &QAbstractSocket::writeBufferFull);
+    QSignalSpy drainedSpy(socket, &QAbstractSocket::writeBufferDrained);
+
+    // below the mark
+    QCOMPARE(socket->write(QByteArray(1024, 'a')), Q_INT64_C(1024));
+    QCOMPARE(fullSpy.count(), 0);
+
+    // the mark is advisory: all of the data is accepted, the signal is sent once
+    const QByteArray block(48 * 1024, 'b');
+    for (int i = 0; i < 4; ++i)
+        QCOMPARE(socket->write(block), qint64(block.size()));
+    QCOMPARE(fullSpy.count(), 1);
+    QCOMPARE(drainedSpy.count(), 0);
+
+    const qint64 expected = 1024 + 4 * block.size();
+    qint64 received = 0;
+    QElapsedTimer timer;
+    timer.start();
+    while (received < expected && timer.elapsed() < 20000) {
+        QCoreApplication::processEvents();
+        if (newConnection->waitForReadyRead(100))
+            received += newConnection->readAll().size();
+    }
+    QCOMPARE(received, expected);
+    QTRY_COMPARE(drainedSpy.count(), 1);
+    QVERIFY(socket->bytesToWrite() <= socket->writeBufferLowWaterMark());
+    QCOMPARE(fullSpy.count(), 1);
+
+    // the next crossing is reported again
+    QCOMPARE(socket->write(QByteArray(64 * 1024, 'c')), Q_INT64_C(64 * 1024));
+    QCOMPARE(fullSpy.count(), 2);
+
+    delete newConnection;
+    delete socket;
+}
+
+// Test that writeChunks() sends the chunks back to back
+void tst_QTcpSocket::writeChunks()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTcpServer tcpServer;
+    QTcpSocket *socket = newSocket();
+    QVERIFY(tcpServer.listen(QHostAddress::LocalHost));
+    socket->connectToHost(tcpServer.serverAddress(), tcpServer.serverPort());
+    QVERIFY(socket->waitForConnected(5000));
+    QVERIFY2(tcpServer.waitForNewConnection(5000), "Network timeout");
+    QTcpSocket *newConnection = tcpServer.nextPendingConnection();
+    QVERIFY(newConnection != nullptr);
+
+    const QByteArray header("HEADER");
+    const QByteArray payload(200000, 'x');
+    QCOMPARE(socket->writeChunks({ header, payload, header }),
+             qint64(2 * header.size() + payload.size()));
+    QCOMPARE(socket->writeChunks({ header, QByteArrayView(), "end" }),
+             qint64(header.size() + 3));
+
+    const QByteArray expected = header + payload + header + header + "end";
+    QByteArray received;
+    QElapsedTimer timer;
+    timer.start();
+    while (received.size() < expected.size() && timer.elapsed() < 20000) {
+        QCoreApplication::processEvents();
+        if (newConnection->waitForReadyRead(100))
+            received += newConnection->readAll();
+    }
+    QVERIFY(received == expected);
+    QCOMPARE(socket->bytesToWrite(), Q_INT64_C(0));
+
+    delete newConnection;
+    delete socket;
+}
+
 QTEST_MAIN(tst_QTcpSocket)
 #include "tst_qtcpsocket.moc"
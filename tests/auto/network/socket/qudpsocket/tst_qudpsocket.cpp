@@ -90,6 +90,7 @@ private slots:
     void bindAndConnectToHost();
     void pendingDatagramSize();
     void writeDatagram();
+    void batchedDatagrams();
     void performance();
     void bindMode();
     void writeDatagramToNonExistingPeer_data();
@@ -911,6 +912,54 @@ void tst_QUdpSocket::writeDatagram()
     }
 }
 
+void tst_QUdpSocket::batchedDatagrams()
+{
+    QUdpSocket server;
+    QVERIFY2(server.bind(), server.errorString().toLatin1().constData());
+    const QHostAddress serverAddress = makeNonAny(server.localAddress());
+
+    QUdpSocket client;
+    QSignalSpy bytesspy(&client, SIGNAL(bytesWritten(qint64)));
+
+    const int count = 8;
+    QNetworkDatagram outgoing[count];
+    for (int i = 0; i < count; ++i) {
+        outgoing[i].setData(QByteArray(i + 1, char('a' + i)));
+        outgoing[i].setDestination(serverAddress, server.localPort());
+    }
+    QCOMPARE(client.writeDatagrams(outgoing, count), count);
+    QCOMPARE(bytesspy.count(), count);
+    QCOMPARE(bytesspy.at(1).at(0).toLongLong(), qint64(2));
+
+    QNetworkDatagram incoming[count + 2];
+    int received = 0;
+    while (received < count) {
+        if (!server.hasPendingDatagrams() && !server.waitForReadyRead(5000))
+            QSKIP("UDP packet lost, unable to complete the test.");
+        const int n = server.receiveDatagrams(incoming + received, count + 2 - received, 64);
+        QVERIFY(n >= 0);
+        received += n;
+    }
+    QCOMPARE(received, count);
+    for (int i = 0; i < count; ++i) {
+        QCOMPARE(incoming[i].data(), outgoing[i].data());
+        QCOMPARE(incoming[i].senderPort(), int(client.localPort()));
+        QCOMPARE(incoming[i].destinationPort(), int(server.localPort()));
+    }
+    QVERIFY(incoming[count].data().isEmpty());
+    QVERIFY(!server.hasPendingDatagrams());
+
+    // an unshared payload buffer that is large enough gets reused
+    const char *buffer = incoming[0].data().constData();
+    QCOMPARE(client.writeDatagrams(outgoing + 2, 1), 1);
+    QVERIFY(server.waitForReadyRead(5000));
+    QCOMPARE(server.receiveDatagrams(incoming, 1, 64), 1);
+    QCOMPARE(incoming[0].data(), outgoing[2].data());
+    QCOMPARE(incoming[0].data().constData(), buffer);
+
+    QCOMPARE(server.receiveDatagrams(incoming, count, 64), 0);
+}
+
 void tst_QUdpSocket::performance()
 {
     QByteArray arr(8192, '@');
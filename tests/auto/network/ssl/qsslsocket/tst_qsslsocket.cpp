@@ -153,6 +153,7 @@ public slots:
 private slots:
     void constructing();
     void configNoOnDemandLoad();
+    void sessionCacheLimits();
     void simpleConnect();
     void simpleConnectWithIgnore();
 
@@ -590,6 +591,27 @@ void tst_QSslSocket::configNoOnDemandLoad()
     QCOMPARE(customConfig, socket.sslConfiguration());
 }
 
+void tst_QSslSocket::sessionCacheLimits()
+{
+    const int capacity = QSslSocket::sessionCacheCapacity();
+    const int timeout = QSslSocket::sessionCacheTimeout();
+    QCOMPARE(capacity, 64);
+    QCOMPARE(timeout, 7200);
+
+    QSslSocket::setSessionCacheCapacity(10);
+    QCOMPARE(QSslSocket::sessionCacheCapacity(), 10);
+    QSslSocket::setSessionCacheCapacity(-1);
+    QCOMPARE(QSslSocket::sessionCacheCapacity(), 0);
+
+    QSslSocket::setSessionCacheTimeout(300);
+    QCOMPARE(QSslSocket::sessionCacheTimeout(), 300);
+    QSslSocket::setSessionCacheTimeout(-5);
+    QCOMPARE(QSslSocket::sessionCacheTimeout(), 0);
+
+    QSslSocket::setSessionCacheCapacity(capacity);
+    QSslSocket::setSessionCacheTimeout(timeout);
+}
+
 void tst_QSslSocket::simpleConnect()
 {
     if (!QSslSocket::supportsSsl())
@@ -0,0 +1,247 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtSql/QtSql>
+
+class tst_QSqlConnectionPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+    void acquireRelease();
+    void maximumSize();
+    void expiry();
+    void healthCheck();
+    void threads();
+    void unknownConnection();
+
+private:
+    QTemporaryDir dir;
+    QScopedPointer<QSqlConnectionPool> pool;
+};
+
+static const char connectionName[] = "tst_qsqlconnectionpool";
+
+void tst_QSqlConnectionPool::initTestCase()
+{
+    if (!QSqlDatabase::isDriverAvailable("QSQLITE"))
+        QSKIP("Test requires the QSQLITE driver");
+    QVERIFY(dir.isValid());
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    db.setDatabaseName(dir.filePath("pool.db"));
+    QVERIFY(db.open());
+    QVERIFY(db.exec("CREATE TABLE counter (thread integer, value integer)").isActive());
+}
+
+void tst_QSqlConnectionPool::cleanupTestCase()
+{
+    QSqlDatabase::removeDatabase(connectionName);
+}
+
+void tst_QSqlConnectionPool::init()
+{
+    pool.reset(new QSqlConnectionPool(connectionName));
+}
+
+void tst_QSqlConnectionPool::cleanup()
+{
+    pool.reset();
+}
+
+void tst_QSqlConnectionPool::acquireRelease()
+{
+    QCOMPARE(pool->connectionName(), QString(connectionName));
+    QCOMPARE(pool->size(), 0);
+
+    QSqlDatabase db = pool->acquire();
+    QVERIFY(db.isValid());
+    QVERIFY(db.isOpen());
+    QVERIFY(db.connectionName() != QLatin1String(connectionName));
+    QCOMPARE(db.databaseName(), QSqlDatabase::database(connectionName).databaseName());
+    QCOMPARE(pool->size(), 1);
+    QCOMPARE(pool->idleCount(), 0);
+
+    const QString name = db.connectionName();
+    pool->release(db);
+    QCOMPARE(pool->size(), 1);
+    QCOMPARE(pool->idleCount(), 1);
+
+    // the idle connection is handed out again
+    db = pool->acquire();
+    QCOMPARE(db.connectionName(), name);
+    QCOMPARE(db.driver()->thread(), QThread::currentThread());
+    QSqlDatabase other = pool->acquire();
+    QVERIFY(other.connectionName() != name);
+    QCOMPARE(pool->size(), 2);
+    pool->release(other);
+    pool->release(db);
+    QCOMPARE(pool->idleCount(), 2);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("was not acquired from this pool"));
+    pool->release(QSqlDatabase::database(connectionName));
+    QCOMPARE(pool->idleCount(), 2);
+
+    db = QSqlDatabase();
+    other = QSqlDatabase();
+    pool.reset();
+    QVERIFY(!QSqlDatabase::contains(name));
+}
+
+void tst_QSqlConnectionPool::maximumSize()
+{
+    pool->setMaximumSize(2);
+    QCOMPARE(pool->maximumSize(), 2);
+    QSqlDatabase first = pool->acquire();
+    QSqlDatabase second = pool->acquire();
+    QVERIFY(first.isOpen());
+    QVERIFY(second.isOpen());
+
+    QVERIFY(!pool->acquire(10).isValid());
+    QCOMPARE(pool->lastError().type(), QSqlError::ConnectionError);
+
+    // releasing a connection wakes up a thread waiting for one
+    bool acquired = false;
+    QScopedPointer<QThread> waiter(QThread::create([&] {
+        QSqlDatabase db = pool->acquire(10000);
+        acquired = db.isOpen() && db.driver()->thread() == QThread::currentThread();
+        if (db.isValid())
+            pool->release(db);
+    }));
+    waiter->start();
+    QThread::msleep(50);
+    pool->release(first);
+    QVERIFY(waiter->wait());
+    QVERIFY(acquired);
+    QCOMPARE(pool->size(), 2);
+
+    pool->release(second);
+}
+
+void tst_QSqlConnectionPool::expiry()
+{
+    pool->setMinimumSize(1);
+    pool->setExpiryTimeout(0);
+    QSqlDatabase first = pool->acquire();
+    QSqlDatabase second = pool->acquire();
+    pool->release(first);
+    first = QSqlDatabase();
+    pool->release(second);
+    second = QSqlDatabase();
+    // the connection released first has expired, the minimum is kept
+    QCOMPARE(pool->size(), 1);
+    QCOMPARE(pool->idleCount(), 1);
+
+    pool->setMinimumSize(0);
+    pool->setExpiryTimeout(-1);
+    first = pool->acquire();
+    pool->release(first);
+    QCOMPARE(pool->idleCount(), 1);
+}
+
+void tst_QSqlConnectionPool::healthCheck()
+{
+    pool->setHealthCheckQuery("SELECT 1");
+    QCOMPARE(pool->healthCheckQuery(), QString("SELECT 1"));
+
+    QSqlDatabase db = pool->acquire();
+    db.close();
+    pool->release(db);
+    // closed connections are reopened
+    db = pool->acquire();
+    QVERIFY(db.isOpen());
+    pool->release(db);
+
+    pool->setHealthCheckQuery("SELECT nonexistent FROM nowhere");
+    db = pool->acquire();
+    QVERIFY(db.isOpen());
+    pool->release(db);
+}
+
+void tst_QSqlConnectionPool::threads()
+{
+    const int threadCount = 8;
+    const int iterations = 50;
+    pool->setMaximumSize(3);
+
+    QAtomicInt failures;
+    QList<QThread *> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.append(QThread::create([this, t, &failures] {
+            for (int i = 0; i < iterations; ++i) {
+                QSqlDatabase db = pool->acquire();
+                if (!db.isOpen()) {
+                    failures.ref();
+                    continue;
+                }
+                bool ok = false;
+                {
+                    QSqlQuery query(db);
+                    query.prepare("INSERT INTO counter (thread, value) VALUES (?, ?)");
+                    query.addBindValue(t);
+                    query.addBindValue(i);
+                    // SQLite may report the database as busy under contention
+                    for (int attempt = 0; attempt < 100 && !ok; ++attempt) {
+                        ok = query.exec();
+                        if (!ok)
+                            QThread::msleep(5);
+                    }
+                }
+                if (!ok)
+                    failures.ref();
+                pool->release(db);
+            }
+        }));
+    }
+    for (QThread *thread : qAsConst(threads))
+        thread->start();
+    for (QThread *thread : qAsConst(threads)) {
+        QVERIFY(thread->wait());
+        delete thread;
+    }
+    QCOMPARE(failures.loadRelaxed(), 0);
+    QVERIFY(pool->size() <= 3);
+    QCOMPARE(pool->idleCount(), pool->size());
+}
+
+void tst_QSqlConnectionPool::unknownConnection()
+{
+    QSqlConnectionPool unknown("tst_qsqlconnectionpool_unknown");
+    QVERIFY(!unknown.acquire().isValid());
+    QVERIFY(unknown.lastError().isValid());
+    QCOMPARE(unknown.size(), 0);
+}
+
+QTEST_MAIN(tst_QSqlConnectionPool)
+#include "tst_qsqlconnectionpool.moc"
@@ -96,6 +96,10 @@ private slots:
     void forwardOnly();
     void forwardOnlyMultipleResultSet_data() { generic_data(); }
     void forwardOnlyMultipleResultSet();
+    void fetchColumns_data() { generic_data(); }
+    void fetchColumns();
+    void execAsync_data() { generic_data(); }
+    void execAsync();
     void psql_forwardOnlyQueryResultsLost_data() { generic_data("QPSQL"); }
     void psql_forwardOnlyQueryResultsLost();
 
@@ -150,6 +154,10 @@ private slots:
     void invalidQuery();
     void batchExec_data() { generic_data(); }
     void batchExec();
+    void batchExecTransaction_data() { generic_data(); }
+    void batchExecTransaction();
+    void preparedStatementCache_data() { generic_data("QSQLITE"); }
+    void preparedStatementCache();
     void QTBUG_43874_data() { generic_data(); }
     void QTBUG_43874();
     void oraArrayBind_data() { generic_data("QOCI"); }
@@ -2583,6 +2591,122 @@ void tst_QSqlQuery::batchExec()
     }
 }
 
+void tst_QSqlQuery::batchExecTransaction()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QSqlDriver::DbmsType dbType = tst_Databases::getDatabaseType(db);
+    if (dbType != QSqlDriver::SQLite && dbType != QSqlDriver::PostgreSQL)
+        QSKIP("Test requires a driver that executes batches in a transaction");
+
+    QSqlQuery q(db);
+    const QString tableName = qTableName("qtest_batchtrans", __FILE__, db);
+    tst_Databases::safeDropTable(db, tableName);
+    QVERIFY_SQL(q, exec("create table " + tableName + " (id int primary key, name varchar(20))"));
+    QVERIFY_SQL(q, prepare("insert into " + tableName + " (id, name) values (?, ?)"));
+
+    // the duplicated key makes the whole batch fail
+    q.addBindValue(QVariantList { 1, 2, 1 });
+    q.addBindValue(QVariantList { QStringLiteral("a"), QStringLiteral("b"), QStringLiteral("c") });
+    QVERIFY(!q.execBatch());
+    QVERIFY(q.lastError().isValid());
+
+    QSqlQuery check(db);
+    QVERIFY_SQL(check, exec("select count(*) from " + tableName));
+    QVERIFY(check.next());
+    QCOMPARE(check.value(0).toInt(), 0);
+
+    const int rowCount = 5000;
+    QVariantList ids;
+    QVariantList names;
+    for (int i = 0; i < rowCount; ++i) {
+        ids << i;
+        names << QString::number(i);
+    }
+    q.addBindValue(ids);
+    q.addBindValue(names);
+    QVERIFY_SQL(q, execBatch());
+
+    QVERIFY_SQL(check, exec("select count(*), max(id) from " + tableName));
+    QVERIFY(check.next());
+    QCOMPARE(check.value(0).toInt(), rowCount);
+    QCOMPARE(check.value(1).toInt(), rowCount - 1);
+
+    // mismatched list sizes are rejected
+    q.addBindValue(QVariantList { rowCount });
+    q.addBindValue(QVariantList { QStringLiteral("x"), QStringLiteral("y") });
+    QVERIFY(!q.execBatch());
+}
+
+void tst_QSqlQuery::preparedStatementCache()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    const QString tableName = qTableName("qtest_stmtcache", __FILE__, db);
+    tst_Databases::safeDropTable(db, tableName);
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec("create table " + tableName + " (id int primary key, name varchar(20))"));
+    QVERIFY_SQL(q, exec("insert into " + tableName + " values (1, 'one')"));
+    QVERIFY_SQL(q, exec("insert into " + tableName + " values (2, 'two')"));
+
+    const QString select = "select name from " + tableName + " where id = ?";
+    for (int i = 0; i < 10; ++i) {
+        QSqlQuery q2(db);
+        QVERIFY_SQL(q2, prepare(select));
+        q2.addBindValue(i % 2 + 1);
+        QVERIFY_SQL(q2, exec());
+        QVERIFY(q2.next());
+        QCOMPARE(q2.value(0).toString(), i % 2 ? QLatin1String("two") : QLatin1String("one"));
+    }
+
+    // two active queries with the same SQL must not share a statement
+    QSqlQuery first(db);
+    QSqlQuery second(db);
+    QVERIFY_SQL(first, prepare(select));
+    QVERIFY_SQL(second, prepare(select));
+    first.addBindValue(1);
+    second.addBindValue(2);
+    QVERIFY_SQL(first, exec());
+    QVERIFY_SQL(second, exec());
+    QVERIFY(first.next());
+    QVERIFY(second.next());
+    QCOMPARE(first.value(0).toString(), QLatin1String("one"));
+    QCOMPARE(second.value(0).toString(), QLatin1String("two"));
+    first.clear();
+    second.clear();
+
+    // a reused statement keeps no bindings from its previous use
+    QSqlQuery insert(db);
+    const QString insertSql = "insert into " + tableName + " (id, name) values (?, ?)";
+    QVERIFY_SQL(insert, prepare(insertSql));
+    insert.addBindValue(3);
+    insert.addBindValue(QLatin1String("three"));
+    QVERIFY_SQL(insert, exec());
+    QVERIFY_SQL(insert, prepare(insertSql));
+    insert.addBindValue(4);
+    insert.addBindValue(QVariant(QVariant::String));
+    QVERIFY_SQL(insert, exec());
+    QVERIFY_SQL(q, exec("select name from " + tableName + " where id = 4"));
+    QVERIFY(q.next());
+    QVERIFY(q.isNull(0));
+
+    // cached statements are recompiled after a schema change
+    const QString selectAll = "select * from " + tableName + " where id = 1";
+    QVERIFY_SQL(q, prepare(selectAll));
+    QVERIFY_SQL(q, exec());
+    QVERIFY(q.next());
+    QCOMPARE(q.record().count(), 2);
+    QVERIFY_SQL(q, exec("alter table " + tableName + " add column extra int default 7"));
+    QVERIFY_SQL(q, prepare(selectAll));
+    QVERIFY_SQL(q, exec());
+    QVERIFY(q.next());
+    QCOMPARE(q.record().count(), 3);
+    QCOMPARE(q.value(2).toInt(), 7);
+}
+
 void tst_QSqlQuery::QTBUG_43874()
 {
     QFETCH(QString, dbName);
@@ -4764,5 +4888,127 @@ void tst_QSqlQuery::mysql_timeType()
     }
 }
 
+void tst_QSqlQuery::fetchColumns()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QSqlDriver::DbmsType dbType = tst_Databases::getDatabaseType(db);
+    const QString tableName(qTableName("fetchcolumns", __FILE__, db));
+    tst_Databases::safeDropTable(db, tableName);
+
+    QSqlQuery q(db);
+    const QString doubleType = dbType == QSqlDriver::PostgreSQL
+            ? QStringLiteral("double precision") : QStringLiteral("real");
+    QVERIFY_SQL(q, exec("CREATE TABLE " + tableName + " (id integer, num " + doubleType
+                        + ", name varchar(20))"));
+    QVERIFY_SQL(q, exec("INSERT INTO " + tableName + " VALUES (1, 1.5, 'one')"));
+    QVERIFY_SQL(q, exec("INSERT INTO " + tableName + " VALUES (2, NULL, 'tw\xc3\xb6')"));
+    QVERIFY_SQL(q, exec("INSERT INTO " + tableName + " VALUES (3, -2.25, NULL)"));
+
+    for (bool forwardOnly : { false, true }) {
+        q.setForwardOnly(forwardOnly);
+        QVERIFY_SQL(q, exec("SELECT id, num, name FROM " + tableName + " ORDER BY id"));
+
+        QSqlColumns columns = q.fetchColumns(2);
+        QCOMPARE(columns.rowCount(), 2);
+        QCOMPARE(columns.columnCount(), 3);
+        QCOMPARE(q.at(), 1);
+        QCOMPARE(columns.type(2), QSqlColumns::Text);
+        QCOMPARE(columns.type(3), QSqlColumns::Invalid);
+        QCOMPARE(columns.name(2).toLower(), QStringLiteral("name"));
+        QCOMPARE(columns.value(0, 0).toInt(), 1);
+        QCOMPARE(columns.value(1, 0).toInt(), 2);
+        QCOMPARE(columns.value(0, 1).toDouble(), 1.5);
+        QVERIFY(!columns.isNull(0, 1));
+        QVERIFY(columns.isNull(1, 1));
+        QVERIFY(columns.value(1, 1).isNull());
+        QCOMPARE(columns.bytes(0, 2).toByteArray(), QByteArray("one"));
+        QCOMPARE(columns.value(1, 2).toString(), QString::fromUtf8("tw\xc3\xb6"));
+        if (dbType == QSqlDriver::SQLite || dbType == QSqlDriver::PostgreSQL) {
+            QCOMPARE(columns.type(0), QSqlColumns::Int64);
+            QCOMPARE(columns.type(1), QSqlColumns::Double);
+            QCOMPARE(columns.int64Data(0)[1], qint64(2));
+            QCOMPARE(columns.doubleData(1)[0], 1.5);
+            QVERIFY(!columns.doubleData(0));
+            QCOMPARE(columns.nullBitmap(1)[0], uchar(0x02));
+        }
+
+        columns = q.fetchColumns(2);
+        QCOMPARE(columns.rowCount(), 1);
+        QCOMPARE(q.at(), int(QSql::AfterLastRow));
+        QCOMPARE(columns.value(0, 0).toInt(), 3);
+        QCOMPARE(columns.value(0, 1).toDouble(), -2.25);
+        QVERIFY(columns.isNull(0, 2));
+        QVERIFY(columns.bytes(0, 2).isEmpty());
+
+        QVERIFY(q.fetchColumns(2).isEmpty());
+        QVERIFY(!q.next());
+
+        // mixing with next()
+        QVERIFY_SQL(q, exec("SELECT id, num, name FROM " + tableName + " ORDER BY id"));
+        QVERIFY(q.next());
+        QCOMPARE(q.value(0).toInt(), 1);
+        columns = q.fetchColumns(10);
+        QCOMPARE(columns.rowCount(), 2);
+        QCOMPARE(columns.value(0, 0).toInt(), 2);
+        QCOMPARE(columns.value(1, 0).toInt(), 3);
+    }
+
+    QVERIFY(QSqlQuery(db).fetchColumns(1).isEmpty());
+    QVERIFY(QSqlColumns().isEmpty());
+    QCOMPARE(QSqlColumns().columnCount(), 0);
+    QVERIFY(!QSqlColumns().nullBitmap(0));
+}
+
+void tst_QSqlQuery::execAsync()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QString tableName(qTableName("execasync", __FILE__, db));
+    tst_Databases::safeDropTable(db, tableName);
+
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec("CREATE TABLE " + tableName + " (id integer)"));
+    QVERIFY_SQL(q, prepare("INSERT INTO " + tableName + " (id) VALUES (?)"));
+
+    // the query must not be touched until its future has finished
+    QList<QFuture<QSqlQuery>> inserts;
+    for (int i = 0; i < 10; ++i) {
+        q.addBindValue(i);
+        inserts.append(q.execAsync());
+        inserts.last().waitForFinished();
+    }
+    for (const QFuture<QSqlQuery> &insert : qAsConst(inserts)) {
+        QVERIFY(insert.isFinished());
+        QVERIFY2(!insert.result().lastError().isValid(),
+                 qPrintable(insert.result().lastError().text()));
+    }
+
+    QFuture<QSqlQuery> select = QSqlQuery(db).execAsync("SELECT id FROM " + tableName
+                                                        + " ORDER BY id");
+    QFuture<QSqlQuery> invalid = QSqlQuery(db).execAsync("SELECT nonexistent FROM " + tableName);
+    // both run on the connection's thread, one after the other
+    invalid.waitForFinished();
+    QVERIFY(select.isFinished());
+    QSqlQuery result = select.result();
+    QVERIFY_SQL(result, isActive());
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(result.next());
+        QCOMPARE(result.value(0).toInt(), i);
+    }
+    QVERIFY(!result.next());
+    result.clear();
+
+    QVERIFY(!invalid.result().isActive());
+    QVERIFY(invalid.result().lastError().isValid());
+
+    // not connected: finishes right away with an error
+    QFuture<QSqlQuery> unconnected = QSqlQuery().execAsync("SELECT 1");
+    QVERIFY(unconnected.isFinished());
+    QVERIFY(!unconnected.result().isActive());
+}
+
 QTEST_MAIN( tst_QSqlQuery )
 #include "tst_qsqlquery.moc"
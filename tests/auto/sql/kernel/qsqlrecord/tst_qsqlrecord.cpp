@@ -399,6 +399,27 @@ void tst_QSqlRecord::position()
         if (!fields[i]->tableName().isEmpty())
             QCOMPARE(rec->indexOf(fields[i]->tableName() + QChar('.') + fields[i]->name()), i);
     }
+
+    QCOMPARE(rec->indexOf("STRING"), 0);
+    QCOMPARE(rec->indexOf("Int"), 1);
+    QCOMPARE(rec->indexOf("nonexistent"), -1);
+
+    // the lookup must follow changes to the fields, but not affect copies
+    QSqlRecord copy = *rec;
+    rec->insert(0, QSqlField("int", QVariant::Int));
+    QCOMPARE(rec->indexOf("int"), 0);
+    QCOMPARE(copy.indexOf("int"), 1);
+    rec->replace(0, QSqlField("other", QVariant::Int));
+    QCOMPARE(rec->indexOf("int"), 2);
+    QCOMPARE(rec->indexOf("other"), 0);
+    rec->remove(0);
+    QCOMPARE(rec->indexOf("other"), -1);
+    QCOMPARE(rec->indexOf("int"), 1);
+    rec->append(QSqlField("new", QVariant::Int));
+    QCOMPARE(rec->indexOf("new"), NUM_FIELDS);
+    rec->clear();
+    QCOMPARE(rec->indexOf("string"), -1);
+    QCOMPARE(copy.indexOf("string"), 0);
 }
 
 void tst_QSqlRecord::remove()
@@ -85,6 +85,8 @@ private slots:
     void insertColumns();
     void submitAll_data() { generic_data(); }
     void submitAll();
+    void incrementalSelect_data() { generic_data(); }
+    void incrementalSelect();
     void setData_data()  { generic_data(); }
     void setData();
     void setRecord_data()  { generic_data(); }
@@ -520,6 +522,76 @@ void tst_QSqlTableModel::insertColumns()
     QCOMPARE(model.data(model.index(3, 5)), QVariant());
 }
 
+void tst_QSqlTableModel::incrementalSelect()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QString test = qTableName("test1", __FILE__, db);
+
+    QSqlTableModel model(0, db);
+    model.setEditStrategy(QSqlTableModel::OnManualSubmit);
+    model.setTable(test);
+    model.setSort(0, Qt::AscendingOrder);
+    QVERIFY(!model.incrementalSelect());
+    model.setIncrementalSelect(true);
+    QVERIFY(model.incrementalSelect());
+    QVERIFY_SQL(model, select());
+    QCOMPARE(model.rowCount(), 3);
+
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy insertSpy(&model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removeSpy(&model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy changeSpy(&model, &QAbstractItemModel::dataChanged);
+
+    // an external change is picked up without touching the other rows
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec("insert into " + test + " values(0, 'first', 0)"));
+    QVERIFY_SQL(model, select());
+    QCOMPARE(model.rowCount(), 4);
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(insertSpy.at(0).at(2).toInt(), 0);
+    QCOMPARE(changeSpy.count(), 0);
+    QCOMPARE(model.data(model.index(0, 1)).toString(), QString("first"));
+    QCOMPARE(model.data(model.index(3, 1)).toString(), QString("vohi"));
+
+    // an edited row is reported as changed
+    QVERIFY_SQL(model, setData(model.index(2, 1), QString("edited")));
+    changeSpy.clear();
+    QVERIFY_SQL(model, submitAll());
+    QCOMPARE(changeSpy.count(), 1);
+    QCOMPARE(changeSpy.at(0).at(0).value<QModelIndex>().row(), 2);
+    QCOMPARE(changeSpy.at(0).at(1).value<QModelIndex>().row(), 2);
+    QCOMPARE(model.data(model.index(2, 1)).toString(), QString("edited"));
+
+    // a deleted row is removed
+    QVERIFY_SQL(model, removeRows(1, 1));
+    QVERIFY_SQL(model, submitAll());
+    QCOMPARE(model.rowCount(), 3);
+    QCOMPARE(removeSpy.count(), 1);
+    QCOMPARE(removeSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(removeSpy.at(0).at(2).toInt(), 1);
+    QCOMPARE(model.data(model.index(0, 1)).toString(), QString("first"));
+    QCOMPARE(model.data(model.index(1, 1)).toString(), QString("edited"));
+    QCOMPARE(model.data(model.index(2, 1)).toString(), QString("vohi"));
+
+    // an inserted row stays where it is
+    QSqlRecord rec = model.record();
+    rec.setValue(0, 4);
+    rec.setValue(1, QString("last"));
+    rec.setValue(2, 4);
+    QVERIFY_SQL(model, insertRecord(-1, rec));
+    QCOMPARE(insertSpy.count(), 2);
+    QVERIFY_SQL(model, submitAll());
+    QCOMPARE(insertSpy.count(), 2);
+    QCOMPARE(model.rowCount(), 4);
+    QCOMPARE(model.data(model.index(3, 1)).toString(), QString("last"));
+
+    QCOMPARE(resetSpy.count(), 0);
+    QVERIFY(!model.isDirty());
+}
+
 void tst_QSqlTableModel::setData()
 {
     QFETCH(QString, dbName);
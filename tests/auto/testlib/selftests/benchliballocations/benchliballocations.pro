@@ -0,0 +1,9 @@
+SOURCES += tst_benchliballocations.cpp
+QT = core testlib-private
+
+mac:CONFIG -= app_bundle
+CONFIG -= debug_and_release_target
+
+TARGET = benchliballocations
+
+include($$QT_SOURCE_TREE/src/testlib/selfcover.pri)
@@ -0,0 +1,110 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QString>
+#include <QtTest/QtTest>
+#include <QtTest/private/qbenchmarkallocationhooks_p.h>
+
+#include <malloc.h>
+#include <stdlib.h>
+
+class tst_BenchlibAllocations : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void noAllocation();
+    void multiArg();
+    void chainedArg();
+    void alignedAllocations();
+};
+
+void tst_BenchlibAllocations::noAllocation()
+{
+    const QString pattern = QStringLiteral("%1 and %2");
+    qsizetype size = 0;
+    QBENCHMARK {
+        size += pattern.size();
+    }
+    QVERIFY(size > 0);
+}
+
+void tst_BenchlibAllocations::multiArg()
+{
+    const QString pattern = QStringLiteral("%1 and %2");
+    const QString first = QStringLiteral("first");
+    const QString second = QStringLiteral("second");
+    QString result;
+    // Only the result is allocated
+    QBENCHMARK {
+        result = pattern.arg(first, second);
+    }
+    QCOMPARE(result, QStringLiteral("first and second"));
+}
+
+void tst_BenchlibAllocations::chainedArg()
+{
+    const QString pattern = QStringLiteral("%1 and %2");
+    const QString first = QStringLiteral("first");
+    const QString second = QStringLiteral("second");
+    QString result;
+    // The intermediate string costs a second allocation
+    QBENCHMARK {
+        result = pattern.arg(first).arg(second);
+    }
+    QCOMPARE(result, QStringLiteral("first and second"));
+}
+
+void tst_BenchlibAllocations::alignedAllocations()
+{
+    // volatile, so that the compiler cannot drop the allocations
+    void *volatile blocks[3] = {};
+    QBENCHMARK {
+        blocks[0] = aligned_alloc(64, 64);
+        void *block = nullptr;
+        if (posix_memalign(&block, 64, 64) == 0)
+            blocks[1] = block;
+        blocks[2] = memalign(64, 64);
+        for (void *b : blocks)
+            free(b);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<const char*> args(argv, argv + argc);
+    args.push_back("-allocationcounter");
+    argc = args.size();
+    argv = const_cast<char**>(&args[0]);
+
+    // No QCoreApplication, so that no other thread allocates while counting
+    tst_BenchlibAllocations test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_benchliballocations.moc"
@@ -0,0 +1,9 @@
+SOURCES += tst_benchlibstatistics.cpp
+QT = core testlib
+
+mac:CONFIG -= app_bundle
+CONFIG -= debug_and_release_target
+
+TARGET = benchlibstatistics
+
+include($$QT_SOURCE_TREE/src/testlib/selfcover.pri)
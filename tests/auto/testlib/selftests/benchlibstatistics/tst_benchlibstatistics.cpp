@@ -0,0 +1,64 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QCoreApplication>
+#include <QtTest/QtTest>
+
+class tst_BenchlibStatistics : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void fixedSamples();
+};
+
+// One value per median iteration; 40 lies outside the fences and is
+// counted as an outlier.
+static const qreal samples[] = { 12, 10, 11, 13, 10, 12, 11, 40, 12, 11, 13 };
+
+void tst_BenchlibStatistics::fixedSamples()
+{
+    static int sample = 0;
+    QVERIFY(sample < int(std::size(samples)));
+    QTest::setBenchmarkResult(samples[sample++], QTest::Events);
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<const char*> args(argv, argv + argc);
+    args.push_back("-median");
+    args.push_back("11");
+    args.push_back("-warmup");
+    args.push_back("0");
+    argc = args.size();
+    argv = const_cast<char**>(&args[0]);
+
+    QTEST_MAIN_IMPL(tst_BenchlibStatistics)
+}
+
+#include "tst_benchlibstatistics.moc"
@@ -44,14 +44,15 @@ import subprocess
 import re
 
 
-TESTS = ['assert', 'badxml', 'benchlibcallgrind', 'benchlibcounting',
-         'benchlibeventcounter', 'benchliboptions', 'benchlibtickcounter',
-         'benchlibwalltime', 'blacklisted', 'cmptest', 'commandlinedata',
-         'counting', 'crashes', 'datatable', 'datetime', 'deleteLater',
-         'deleteLater_noApp', 'differentexec', 'exceptionthrow', 'expectfail',
-         'failcleanup', 'faildatatype', 'failfetchtype', 'failinit',
-         'failinitdata', 'fetchbogus', 'findtestdata', 'float', 'globaldata',
-         'longstring', 'maxwarnings', 'multiexec', 'pairdiagnostics', 'pass',
+TESTS = ['assert', 'badxml', 'benchliballocations', 'benchlibcallgrind',
+         'benchlibcounting', 'benchlibeventcounter', 'benchliboptions',
+         'benchlibstatistics', 'benchlibtickcounter', 'benchlibwalltime',
+         'blacklisted', 'cmptest', 'commandlinedata', 'counting', 'crashes',
+         'datatable', 'datetime', 'deleteLater', 'deleteLater_noApp',
+         'differentexec', 'exceptionthrow', 'expectfail', 'failcleanup',
+         'faildatatype', 'failfetchtype', 'failinit', 'failinitdata',
+         'fetchbogus', 'findtestdata', 'float', 'globaldata', 'longstring',
+         'maxwarnings', 'multiexec', 'pairdiagnostics', 'pass',
          'printdatatags', 'printdatatagswithglobaltags', 'qexecstringlist',
          'signaldumper', 'silent', 'singleskip', 'skip', 'skipcleanup',
          'skipinit', 'skipinitdata', 'sleep', 'strcmp', 'subtest', 'testlib',
@@ -1,10 +1,12 @@
 SUBPROGRAMS = \
      assert \
      badxml \
+     benchliballocations \
      benchlibcallgrind \
      benchlibcounting \
      benchlibeventcounter \
      benchliboptions \
+     benchlibstatistics \
      benchlibtickcounter \
      benchlibwalltime \
      blacklisted \
@@ -564,6 +564,7 @@ BenchmarkResult BenchmarkResult::parse(QString const& line, QString* error)
 
 #include "catch_p.h"
 #include <QtTest/private/qtestlog_p.h>
+#include <QtTest/private/qbenchmark_p.h>
 
 #if defined(Q_OS_MACOS)
 #include <QtCore/private/qcore_mac_p.h>
@@ -740,9 +741,29 @@ bool TestLogger::shouldIgnoreTest(const QString &test) const
             || logger == QTestLog::LightXML || logger == QTestLog::JUnitXML))
         return true;
 
+    // The allocation counts only need checking once, and only exist when
+    // the allocation hooks can be built
+    if (test == "benchliballocations") {
+#ifdef QTESTLIB_USE_ALLOCATION_COUNTER
+        if (logger != QTestLog::Plain)
+            return true;
+#else
+        return true;
+#endif
+    }
+
     if (logger == QTestLog::CSV && !test.startsWith("benchlib"))
         return true;
 
+    // The JSON logger only reports benchmark results, including statistics
+    // that only come out the same every time for counted events
+    if (logger == QTestLog::JSON && test != "benchlibcounting" && test != "benchlibstatistics")
+        return true;
+
+    // This test checks the statistics, which only the JSON logger reports
+    if (test == "benchlibstatistics" && logger != QTestLog::JSON && logger != QTestLog::Plain)
+        return true;
+
     if (logger == QTestLog::TeamCity && test.startsWith("benchlib"))
         return true; // Skip benchmark for TeamCity logger
 
@@ -968,6 +989,7 @@ static QProcessEnvironment testEnvironment()
 
 struct TestProcessResult
 {
+    QProcess::ExitStatus exitStatus;
     int exitCode;
     QByteArray standardOutput;
     QByteArray errorOutput;
@@ -1005,7 +1027,8 @@ TestProcessResult runTestProcess(const QString &test, const QStringList &argumen
     if (!crashes)
          REQUIRE(process.exitStatus() == QProcess::NormalExit);
 
-    return { process.exitCode(), process.readAllStandardOutput(), process.readAllStandardError() };
+    return { process.exitStatus(), process.exitCode(),
+             process.readAllStandardOutput(), process.readAllStandardError() };
 }
 
 /*
@@ -1104,11 +1127,13 @@ static const auto kBaselineTest = "pass";
 
 bool isCommandLineLogger(QTestLog::LogMode logger)
 {
+    // The worker logger is only used internally, by -jobs
+    if (logger == QTestLog::Worker)
+        return false;
 #if defined(QT_USE_APPLE_UNIFIED_LOGGING)
     // The Apple logger is internal and never logs to file or stdout
     return logger != QTestLog::Apple;
 #else
-    Q_UNUSED(logger);
     return true;
 #endif
 }
@@ -1196,6 +1221,33 @@ SCENARIO("Test output of the loggers is as expected")
     }
 }
 
+TEST_CASE("Running in worker processes gives the same output as running sequentially")
+{
+    auto test = GENERATE(as<QString>{}, "pass", "counting", "blacklisted");
+
+    GIVEN("The " << test << " subtest") {
+        const TestLoggers loggers = {
+            TestLogger(QTestLog::Plain), TestLogger(QTestLog::XML), TestLogger(QTestLog::JUnitXML)
+        };
+        QStringList arguments;
+        for (auto logger : loggers)
+            arguments += logger.arguments(test);
+
+        CAPTURE(arguments);
+        const auto sequential = runTestProcess(test, arguments);
+        const auto parallel = runTestProcess(test, arguments + QStringList{ "-jobs", "2" });
+
+        checkErrorOutput(test, parallel.errorOutput);
+        for (auto logger : loggers)
+            checkTestOutput(test, logger, logger.testOutput(test));
+
+        // A worker crashing, as blacklisted does on purpose, is not a crash of the test
+        REQUIRE(parallel.exitStatus == QProcess::NormalExit);
+        if (sequential.exitStatus == QProcess::NormalExit)
+            CHECK(parallel.exitCode == sequential.exitCode);
+    }
+}
+
 #endif // QT_CONFIG(process)
 
 // ----------------------- Entrypoint -----------------------
@@ -724,6 +724,8 @@ private slots:
     void gadgetHierarchy();
     void optionsFileError_data();
     void optionsFileError();
+    void tokenCache();
+    void batchMode();
     void testQNamespace();
     void cxx17Namespaces();
     void cxxAttributes();
@@ -3859,6 +3861,109 @@ void tst_Moc::optionsFileError()
 #endif
 }
 
+void tst_Moc::tokenCache()
+{
+#ifdef MOC_CROSS_COMPILED
+    QSKIP("Not tested when cross-compiled");
+#endif
+#if QT_CONFIG(process)
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+    const QString header = m_sourceDirectory + QStringLiteral("/cxx11-enums.h");
+
+    QProcess proc;
+    proc.start(m_moc, QStringList(header));
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitCode(), 0);
+    const QByteArray expected = proc.readAllStandardOutput();
+    QVERIFY(!expected.isEmpty());
+
+    // the first run fills the cache, the second one reads from it
+    const QStringList arguments = { QStringLiteral("--token-cache"), cacheDir.path(), header };
+    for (int run = 0; run < 2; ++run) {
+        proc.start(m_moc, arguments);
+        QVERIFY(proc.waitForFinished());
+        QCOMPARE(proc.exitCode(), 0);
+        QCOMPARE(proc.readAllStandardOutput(), expected);
+        QVERIFY(!QDir(cacheDir.path()).isEmpty());
+    }
+
+    // entries of files that changed are not used anymore
+    const QString changingHeader = cacheDir.filePath(QStringLiteral("changing.h"));
+    const auto writeHeader = [&](const QByteArray &signalName) {
+        QFile file(changingHeader);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return false;
+        file.write("#include <QtCore/qobject.h>\n"
+                   "class Changing : public QObject\n{\n    Q_OBJECT\nsignals:\n    void "
+                   + signalName + "();\n};\n");
+        return true;
+    };
+    for (const QByteArray &signalName : { QByteArray("first"), QByteArray("second") }) {
+        QVERIFY(writeHeader(signalName));
+        proc.start(m_moc, QStringList({ QStringLiteral("--token-cache"), cacheDir.path(),
+                                        changingHeader }));
+        QVERIFY(proc.waitForFinished());
+        QCOMPARE(proc.exitCode(), 0);
+        QVERIFY(proc.readAllStandardOutput().contains(signalName));
+    }
+#endif
+}
+
+void tst_Moc::batchMode()
+{
+#ifdef MOC_CROSS_COMPILED
+    QSKIP("Not tested when cross-compiled");
+#endif
+#if QT_CONFIG(process)
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QStringList headers = {
+        m_sourceDirectory + QStringLiteral("/cxx11-enums.h"),
+        m_sourceDirectory + QStringLiteral("/no-keywords.h"),
+        m_sourceDirectory + QStringLiteral("/single_function_keyword.h"),
+    };
+
+    QProcess proc;
+    QList<QByteArray> expected;
+    QStringList outputs;
+    QFile batchFile(dir.filePath(QStringLiteral("batch.txt")));
+    QVERIFY(batchFile.open(QIODevice::WriteOnly));
+    for (int i = 0; i < headers.size(); ++i) {
+        proc.start(m_moc, QStringList({ QStringLiteral("-i"), headers.at(i) }));
+        QVERIFY(proc.waitForFinished());
+        QCOMPARE(proc.exitCode(), 0);
+        expected.append(proc.readAllStandardOutput());
+
+        outputs.append(dir.filePath(QStringLiteral("moc_%1.cpp").arg(i)));
+        QFile optionsFile(dir.filePath(QStringLiteral("job%1.txt").arg(i)));
+        QVERIFY(optionsFile.open(QIODevice::WriteOnly));
+        optionsFile.write("-o\n" + QFile::encodeName(outputs.at(i)) + '\n'
+                          + QFile::encodeName(headers.at(i)) + '\n');
+        batchFile.write(QFile::encodeName(optionsFile.fileName()) + '\n');
+    }
+    batchFile.close();
+
+    // options given on the command line apply to all jobs
+    proc.start(m_moc, QStringList({ QStringLiteral("-i"), QStringLiteral("--jobs"),
+                                    QStringLiteral("2"), QStringLiteral("--batch"),
+                                    batchFile.fileName() }));
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitCode(), 0);
+    for (int i = 0; i < outputs.size(); ++i) {
+        QFile output(outputs.at(i));
+        QVERIFY2(output.open(QIODevice::ReadOnly), qPrintable(outputs.at(i)));
+        QCOMPARE(output.readAll(), expected.at(i));
+    }
+
+    proc.start(m_moc, QStringList({ QStringLiteral("--batch"),
+                                    dir.filePath(QStringLiteral("nonexistent.txt")) }));
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitCode(), 1);
+    QVERIFY(proc.readAllStandardError().contains("moc: "));
+#endif
+}
+
 static void checkEnum(const QMetaEnum &enumerator, const QByteArray &name,
                       const QList<QPair<QByteArray, int>> &keys)
 {
@@ -38,6 +38,7 @@
 #include <QtCore/QMap>
 #include <QtCore/QList>
 #include <QtCore/QResource>
+#include <QtCore/QScopeGuard>
 #include <QtCore/QLocale>
 #include <QtCore/QtGlobal>
 
@@ -94,6 +95,9 @@ private slots:
 
     void python();
 
+    void pageAlign();
+    void jobs();
+
     void cleanupTestCase();
 
 private:
@@ -494,6 +498,81 @@ void tst_rcc::python()
         QFAIL(qPrintable(diff));
 }
 
+void tst_rcc::pageAlign()
+{
+    const QString dataPath = m_dataPath + QLatin1String("/binary/");
+    const QString rccFileName = dataPath + QLatin1String("pagealign.rcc");
+
+    QProcess rccProcess;
+    rccProcess.setWorkingDirectory(dataPath);
+    rccProcess.start(m_rcc, { "-binary", "-no-compress", "--page-align", "-o", rccFileName,
+                              dataPath + QLatin1String("multiple.qrc") });
+    QVERIFY2(rccProcess.waitForStarted(), msgProcessStartFailed(rccProcess).constData());
+    if (!rccProcess.waitForFinished()) {
+        rccProcess.kill();
+        QFAIL(msgProcessTimeout(rccProcess).constData());
+    }
+    QVERIFY2(rccProcess.exitStatus() == QProcess::NormalExit,
+             msgProcessCrashed(rccProcess).constData());
+    QVERIFY2(rccProcess.exitCode() == 0,
+             msgProcessFailed(rccProcess).constData());
+
+    QVERIFY(QResource::registerResource(rccFileName, QLatin1String("/pagealign")));
+    const auto unregister = qScopeGuard([&] {
+        QResource::unregisterResource(rccFileName, QLatin1String("/pagealign"));
+    });
+
+    const QStringList names = { QLatin1String("blahblah.txt"),
+                                QLatin1String("currentdir.txt"),
+                                QLatin1String("currentdir2.txt") };
+    for (const QString &name : names) {
+        QResource resource(QLatin1String(":/pagealign/") + name);
+        QVERIFY2(resource.isValid(), qPrintable(name));
+        QCOMPARE(resource.compressionAlgorithm(), QResource::NoCompression);
+
+        QFile actual(dataPath + name);
+        QVERIFY(actual.open(QIODevice::ReadOnly));
+        QCOMPARE(resource.uncompressedData(), actual.readAll());
+
+#if defined(Q_OS_UNIX) && !defined(Q_OS_INTEGRITY)
+        // the file is mapped at a page boundary, so the payload must be too
+        QCOMPARE(quintptr(resource.data()) % 4096, quintptr(0));
+#endif
+    }
+}
+
+void tst_rcc::jobs()
+{
+    const QString dataPath = m_dataPath + QLatin1String("/binary/");
+
+    // the output must not depend on how many threads compressed the files
+    QByteArray outputs[2];
+    const char *jobCounts[2] = { "1", "4" };
+    for (int i = 0; i < 2; ++i) {
+        const QString rccFileName = dataPath + QLatin1String("jobs") + QLatin1String(jobCounts[i])
+                + QLatin1String(".rcc");
+        QProcess rccProcess;
+        rccProcess.setWorkingDirectory(dataPath);
+        rccProcess.start(m_rcc, { "-binary", "-threshold", "0", "--jobs", jobCounts[i],
+                                  "-o", rccFileName, dataPath + QLatin1String("allfeatures.qrc") });
+        QVERIFY2(rccProcess.waitForStarted(), msgProcessStartFailed(rccProcess).constData());
+        if (!rccProcess.waitForFinished()) {
+            rccProcess.kill();
+            QFAIL(msgProcessTimeout(rccProcess).constData());
+        }
+        QVERIFY2(rccProcess.exitStatus() == QProcess::NormalExit,
+                 msgProcessCrashed(rccProcess).constData());
+        QVERIFY2(rccProcess.exitCode() == 0,
+                 msgProcessFailed(rccProcess).constData());
+
+        QFile rccFile(rccFileName);
+        QVERIFY(rccFile.open(QIODevice::ReadOnly));
+        outputs[i] = rccFile.readAll();
+        QVERIFY(!outputs[i].isEmpty());
+    }
+    QCOMPARE(outputs[1], outputs[0]);
+}
+
 void tst_rcc::cleanupTestCase()
 {
     QDir dataDir(m_dataPath + QLatin1String("/binary"));
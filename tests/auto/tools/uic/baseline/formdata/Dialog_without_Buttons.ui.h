@@ -0,0 +1,55 @@
+/********************************************************************************
+** Form generated from reading UI file 'Dialog_without_Buttons.ui'
+**
+** Created by: Qt User Interface Compiler version 6.0.0
+**
+** WARNING! All changes made in this file will be lost when recompiling UI file!
+********************************************************************************/
+
+#ifndef DIALOG_WITHOUT_BUTTONS_H
+#define DIALOG_WITHOUT_BUTTONS_H
+
+#include <QtCore/QVariant>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QDialog>
+#include <QtWidgets/qtuichelpers.h>
+
+QT_BEGIN_NAMESPACE
+
+class Ui_Dialog
+{
+public:
+
+    void setupUi(QDialog *Dialog)
+    {
+        QObject *objects[1];
+        QtUicHelpers::setupUi(Dialog, qt_formData, nullptr, objects, nullptr);
+
+        QMetaObject::connectSlotsByName(Dialog);
+    } // setupUi
+
+    void retranslateUi(QDialog *Dialog)
+    {
+        QObject *const objects[] = {
+            Dialog
+        };
+        QtUicHelpers::retranslateUi(qt_formData, objects);
+    } // retranslateUi
+
+private:
+    static constexpr unsigned char qt_formData[] = {
+        0x01, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01,
+        0x06, 0x00, 0xa0, 0x06, 0xd8, 0x04, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x69, 0x61, 0x6c, 0x6f, 0x67,
+        0x00, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x54, 0x69, 0x74, 0x6c, 0x65,
+        0x00
+    };
+};
+
+namespace Ui {
+    class Dialog: public Ui_Dialog {};
+} // namespace Ui
+
+QT_END_NAMESPACE
+
+#endif // DIALOG_WITHOUT_BUTTONS_H
@@ -0,0 +1,231 @@
+/********************************************************************************
+** Form generated from reading UI file 'calculator.ui'
+**
+** Created by: Qt User Interface Compiler version 6.0.0
+**
+** WARNING! All changes made in this file will be lost when recompiling UI file!
+********************************************************************************/
+
+#ifndef CALCULATOR_H
+#define CALCULATOR_H
+
+#include <QtCore/QVariant>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QToolButton>
+#include <QtWidgets/QWidget>
+#include <QtWidgets/qtuichelpers.h>
+
+QT_BEGIN_NAMESPACE
+
+class Ui_Calculator
+{
+public:
+    QToolButton *backspaceButton;
+    QToolButton *clearButton;
+    QToolButton *clearAllButton;
+    QToolButton *clearMemoryButton;
+    QToolButton *readMemoryButton;
+    QToolButton *setMemoryButton;
+    QToolButton *addToMemoryButton;
+    QToolButton *sevenButton;
+    QToolButton *eightButton;
+    QToolButton *nineButton;
+    QToolButton *fourButton;
+    QToolButton *fiveButton;
+    QToolButton *sixButton;
+    QToolButton *oneButton;
+    QToolButton *twoButton;
+    QToolButton *threeButton;
+    QToolButton *zeroButton;
+    QToolButton *pointButton;
+    QToolButton *changeSignButton;
+    QToolButton *plusButton;
+    QToolButton *divisionButton;
+    QToolButton *timesButton;
+    QToolButton *minusButton;
+    QToolButton *squareRootButton;
+    QToolButton *powerButton;
+    QToolButton *reciprocalButton;
+    QToolButton *equalButton;
+    QLineEdit *display;
+
+    void setupUi(QWidget *Calculator)
+    {
+        static const QtUicHelpers::ObjectFactory factories[] = {
+            [](QWidget *parent) -> QObject * { return new QToolButton(parent); },
+            [](QWidget *parent) -> QObject * { return new QLineEdit(parent); },
+        };
+        QObject *objects[29];
+        QtUicHelpers::setupUi(Calculator, qt_formData, factories, objects, nullptr);
+        backspaceButton = static_cast<QToolButton *>(objects[1]);
+        clearButton = static_cast<QToolButton *>(objects[2]);
+        clearAllButton = static_cast<QToolButton *>(objects[3]);
+        clearMemoryButton = static_cast<QToolButton *>(objects[4]);
+        readMemoryButton = static_cast<QToolButton *>(objects[5]);
+        setMemoryButton = static_cast<QToolButton *>(objects[6]);
+        addToMemoryButton = static_cast<QToolButton *>(objects[7]);
+        sevenButton = static_cast<QToolButton *>(objects[8]);
+        eightButton = static_cast<QToolButton *>(objects[9]);
+        nineButton = static_cast<QToolButton *>(objects[10]);
+        fourButton = static_cast<QToolButton *>(objects[11]);
+        fiveButton = static_cast<QToolButton *>(objects[12]);
+        sixButton = static_cast<QToolButton *>(objects[13]);
+        oneButton = static_cast<QToolButton *>(objects[14]);
+        twoButton = static_cast<QToolButton *>(objects[15]);
+        threeButton = static_cast<QToolButton *>(objects[16]);
+        zeroButton = static_cast<QToolButton *>(objects[17]);
+        pointButton = static_cast<QToolButton *>(objects[18]);
+        changeSignButton = static_cast<QToolButton *>(objects[19]);
+        plusButton = static_cast<QToolButton *>(objects[20]);
+        divisionButton = static_cast<QToolButton *>(objects[21]);
+        timesButton = static_cast<QToolButton *>(objects[22]);
+        minusButton = static_cast<QToolButton *>(objects[23]);
+        squareRootButton = static_cast<QToolButton *>(objects[24]);
+        powerButton = static_cast<QToolButton *>(objects[25]);
+        reciprocalButton = static_cast<QToolButton *>(objects[26]);
+        equalButton = static_cast<QToolButton *>(objects[27]);
+        display = static_cast<QLineEdit *>(objects[28]);
+
+        QMetaObject::connectSlotsByName(Calculator);
+    } // setupUi
+
+    void retranslateUi(QWidget *Calculator)
+    {
+        QObject *const objects[] = {
+            Calculator, backspaceButton, clearButton, clearAllButton,
+            clearMemoryButton, readMemoryButton, setMemoryButton,
+            addToMemoryButton, sevenButton, eightButton, nineButton, fourButton,
+            fiveButton, sixButton, oneButton, twoButton, threeButton, zeroButton,
+            pointButton, changeSignButton, plusButton, divisionButton, timesButton,
+            minusButton, squareRootButton, powerButton, reciprocalButton,
+            equalButton
+        };
+        QtUicHelpers::retranslateUi(qt_formData, objects);
+    } // retranslateUi
+
+private:
+    static constexpr unsigned char qt_formData[] = {
+        0x01, 0x30, 0x02, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01,
+        0x06, 0x00, 0xf4, 0x04, 0xda, 0x04, 0x04, 0x00, 0x12, 0x00, 0x11, 0x0c,
+        0x0c, 0x00, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x0f, 0xf4, 0x04, 0xda, 0x04,
+        0x04, 0x00, 0x29, 0x00, 0x0f, 0xf4, 0x04, 0xda, 0x04, 0x01, 0x00, 0x01,
+        0x03, 0x01, 0x41, 0x04, 0x01, 0x51, 0x00, 0x0b, 0x14, 0x64, 0xb6, 0x01,
+        0x52, 0x01, 0x00, 0x01, 0x03, 0x02, 0x69, 0x04, 0x02, 0x51, 0x00, 0x0b,
+        0xdc, 0x01, 0x64, 0xb6, 0x01, 0x52, 0x01, 0x00, 0x01, 0x03, 0x03, 0x7b,
+        0x04, 0x03, 0x51, 0x00, 0x0b, 0xa4, 0x03, 0x64, 0xb6, 0x01, 0x52, 0x01,
+        0x00, 0x01, 0x03, 0x04, 0x94, 0x01, 0x04, 0x04, 0x51, 0x00, 0x0b, 0x14,
+        0xc8, 0x01, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x05, 0xa9, 0x01, 0x04,
+        0x05, 0x51, 0x00, 0x0b, 0x14, 0xac, 0x02, 0x52, 0x52, 0x01, 0x00, 0x01,
+        0x03, 0x06, 0xbd, 0x01, 0x04, 0x06, 0x51, 0x00, 0x0b, 0x14, 0x90, 0x03,
+        0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x07, 0xd0, 0x01, 0x04, 0x07, 0x51,
+        0x00, 0x0b, 0x14, 0xf4, 0x03, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x08,
+        0xe5, 0x01, 0x04, 0x08, 0x51, 0x00, 0x0b, 0x78, 0xc8, 0x01, 0x52, 0x52,
+        0x01, 0x00, 0x01, 0x03, 0x09, 0xf3, 0x01, 0x04, 0x09, 0x51, 0x00, 0x0b,
+        0xdc, 0x01, 0xc8, 0x01, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x0a, 0x81,
+        0x02, 0x04, 0x0a, 0x51, 0x00, 0x0b, 0xc0, 0x02, 0xc8, 0x01, 0x52, 0x52,
+        0x01, 0x00, 0x01, 0x03, 0x0b, 0x8e, 0x02, 0x04, 0x0b, 0x51, 0x00, 0x0b,
+        0x78, 0xac, 0x02, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x0c, 0x9b, 0x02,
+        0x04, 0x0c, 0x51, 0x00, 0x0b, 0xdc, 0x01, 0xac, 0x02, 0x52, 0x52, 0x01,
+        0x00, 0x01, 0x03, 0x0d, 0xa8, 0x02, 0x04, 0x0d, 0x51, 0x00, 0x0b, 0xc0,
+        0x02, 0xac, 0x02, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x0e, 0xb4, 0x02,
+        0x04, 0x0e, 0x51, 0x00, 0x0b, 0x78, 0x90, 0x03, 0x52, 0x52, 0x01, 0x00,
+        0x01, 0x03, 0x0f, 0xc0, 0x02, 0x04, 0x0f, 0x51, 0x00, 0x0b, 0xdc, 0x01,
+        0x90, 0x03, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x10, 0xcc, 0x02, 0x04,
+        0x10, 0x51, 0x00, 0x0b, 0xc0, 0x02, 0x90, 0x03, 0x52, 0x52, 0x01, 0x00,
+        0x01, 0x03, 0x11, 0xda, 0x02, 0x04, 0x11, 0x51, 0x00, 0x0b, 0x78, 0xf4,
+        0x03, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x12, 0xe7, 0x02, 0x04, 0x12,
+        0x51, 0x00, 0x0b, 0xdc, 0x01, 0xf4, 0x03, 0x52, 0x52, 0x01, 0x00, 0x01,
+        0x03, 0x13, 0xf5, 0x02, 0x04, 0x13, 0x51, 0x00, 0x0b, 0xc0, 0x02, 0xf4,
+        0x03, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x14, 0x89, 0x03, 0x04, 0x14,
+        0x51, 0x00, 0x0b, 0xa4, 0x03, 0xf4, 0x03, 0x52, 0x52, 0x01, 0x00, 0x01,
+        0x03, 0x15, 0x96, 0x03, 0x04, 0x15, 0x51, 0x00, 0x0b, 0xa4, 0x03, 0xc8,
+        0x01, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x16, 0xa7, 0x03, 0x04, 0x16,
+        0x51, 0x00, 0x0b, 0xa4, 0x03, 0xac, 0x02, 0x52, 0x52, 0x01, 0x00, 0x01,
+        0x03, 0x17, 0xb5, 0x03, 0x04, 0x17, 0x51, 0x00, 0x0b, 0xa4, 0x03, 0x90,
+        0x03, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x18, 0xc3, 0x03, 0x04, 0x18,
+        0x51, 0x00, 0x0b, 0x88, 0x04, 0xc8, 0x01, 0x52, 0x52, 0x01, 0x00, 0x01,
+        0x03, 0x19, 0xd9, 0x03, 0x04, 0x19, 0x51, 0x00, 0x0b, 0x88, 0x04, 0xac,
+        0x02, 0x52, 0x52, 0x01, 0x00, 0x01, 0x03, 0x1a, 0xe9, 0x03, 0x04, 0x1a,
+        0x51, 0x00, 0x0b, 0x88, 0x04, 0x90, 0x03, 0x52, 0x52, 0x01, 0x00, 0x01,
+        0x03, 0x1b, 0xfe, 0x03, 0x04, 0x1b, 0x51, 0x00, 0x0b, 0x88, 0x04, 0xf4,
+        0x03, 0x52, 0x52, 0x01, 0x01, 0x01, 0x03, 0x1c, 0x8c, 0x04, 0x04, 0x1c,
+        0x51, 0x00, 0x0b, 0x14, 0x14, 0xc6, 0x04, 0x3e, 0x04, 0x1c, 0x94, 0x04,
+        0x00, 0x02, 0x1e, 0x04, 0x1c, 0xc4, 0x04, 0x00, 0x0a, 0x9e, 0x04, 0x04,
+        0x1c, 0xce, 0x04, 0x00, 0x01, 0x01, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x35, 0x00, 0x01, 0x00, 0x01, 0x01, 0x5a, 0x00, 0x5f, 0x00, 0x01, 0x02,
+        0x5a, 0x00, 0x75, 0x00, 0x01, 0x03, 0x5a, 0x00, 0x8a, 0x01, 0x00, 0x01,
+        0x04, 0x5a, 0x00, 0xa6, 0x01, 0x00, 0x01, 0x05, 0x5a, 0x00, 0xba, 0x01,
+        0x00, 0x01, 0x06, 0x5a, 0x00, 0xcd, 0x01, 0x00, 0x01, 0x07, 0x5a, 0x00,
+        0xe2, 0x01, 0x00, 0x01, 0x08, 0x5a, 0x00, 0xf1, 0x01, 0x00, 0x01, 0x09,
+        0x5a, 0x00, 0xff, 0x01, 0x00, 0x01, 0x0a, 0x5a, 0x00, 0x8c, 0x02, 0x00,
+        0x01, 0x0b, 0x5a, 0x00, 0x99, 0x02, 0x00, 0x01, 0x0c, 0x5a, 0x00, 0xa6,
+        0x02, 0x00, 0x01, 0x0d, 0x5a, 0x00, 0xb2, 0x02, 0x00, 0x01, 0x0e, 0x5a,
+        0x00, 0xbe, 0x02, 0x00, 0x01, 0x0f, 0x5a, 0x00, 0xca, 0x02, 0x00, 0x01,
+        0x10, 0x5a, 0x00, 0xd8, 0x02, 0x00, 0x01, 0x11, 0x5a, 0x00, 0xe5, 0x02,
+        0x00, 0x01, 0x12, 0x5a, 0x00, 0xf3, 0x02, 0x00, 0x01, 0x13, 0x5a, 0x00,
+        0x86, 0x03, 0x00, 0x01, 0x14, 0x5a, 0x00, 0x94, 0x03, 0x00, 0x01, 0x15,
+        0x5a, 0x00, 0xa5, 0x03, 0x00, 0x01, 0x16, 0x5a, 0x00, 0xb3, 0x03, 0x00,
+        0x01, 0x17, 0x5a, 0x00, 0xc1, 0x03, 0x00, 0x01, 0x18, 0x5a, 0x00, 0xd4,
+        0x03, 0x00, 0x01, 0x19, 0x5a, 0x00, 0xe5, 0x03, 0x00, 0x01, 0x1a, 0x5a,
+        0x00, 0xfa, 0x03, 0x00, 0x01, 0x1b, 0x5a, 0x00, 0x8a, 0x04, 0x00, 0x00,
+        0x00, 0x43, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x00,
+        0x46, 0x69, 0x78, 0x65, 0x64, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x50, 0x6f,
+        0x6c, 0x69, 0x63, 0x79, 0x00, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
+        0x53, 0x69, 0x7a, 0x65, 0x00, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
+        0x53, 0x69, 0x7a, 0x65, 0x00, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x54,
+        0x69, 0x74, 0x6c, 0x65, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x70, 0x61,
+        0x63, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x67, 0x65, 0x6f,
+        0x6d, 0x65, 0x74, 0x72, 0x79, 0x00, 0x74, 0x65, 0x78, 0x74, 0x00, 0x42,
+        0x61, 0x63, 0x6b, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x63, 0x6c, 0x65,
+        0x61, 0x72, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x43, 0x6c, 0x65,
+        0x61, 0x72, 0x00, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x41, 0x6c, 0x6c, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x43, 0x6c, 0x65, 0x61, 0x72, 0x20,
+        0x41, 0x6c, 0x6c, 0x00, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x4d, 0x65, 0x6d,
+        0x6f, 0x72, 0x79, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x4d, 0x43,
+        0x00, 0x72, 0x65, 0x61, 0x64, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x4d, 0x52, 0x00, 0x73, 0x65, 0x74,
+        0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+        0x00, 0x4d, 0x53, 0x00, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x4d, 0x65, 0x6d,
+        0x6f, 0x72, 0x79, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x4d, 0x2b,
+        0x00, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+        0x00, 0x37, 0x00, 0x65, 0x69, 0x67, 0x68, 0x74, 0x42, 0x75, 0x74, 0x74,
+        0x6f, 0x6e, 0x00, 0x38, 0x00, 0x6e, 0x69, 0x6e, 0x65, 0x42, 0x75, 0x74,
+        0x74, 0x6f, 0x6e, 0x00, 0x39, 0x00, 0x66, 0x6f, 0x75, 0x72, 0x42, 0x75,
+        0x74, 0x74, 0x6f, 0x6e, 0x00, 0x34, 0x00, 0x66, 0x69, 0x76, 0x65, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x35, 0x00, 0x73, 0x69, 0x78, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x36, 0x00, 0x6f, 0x6e, 0x65, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x31, 0x00, 0x74, 0x77, 0x6f, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x32, 0x00, 0x74, 0x68, 0x72, 0x65,
+        0x65, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x33, 0x00, 0x7a, 0x65,
+        0x72, 0x6f, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x30, 0x00, 0x70,
+        0x6f, 0x69, 0x6e, 0x74, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x2e,
+        0x00, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x69, 0x67, 0x6e, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x2b, 0x2d, 0x00, 0x70, 0x6c, 0x75,
+        0x73, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x2b, 0x00, 0x64, 0x69,
+        0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+        0x00, 0x2f, 0x00, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x42, 0x75, 0x74, 0x74,
+        0x6f, 0x6e, 0x00, 0x2a, 0x00, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x42, 0x75,
+        0x74, 0x74, 0x6f, 0x6e, 0x00, 0x2d, 0x00, 0x73, 0x71, 0x75, 0x61, 0x72,
+        0x65, 0x52, 0x6f, 0x6f, 0x74, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00,
+        0x53, 0x71, 0x72, 0x74, 0x00, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x42, 0x75,
+        0x74, 0x74, 0x6f, 0x6e, 0x00, 0x78, 0x5e, 0x32, 0x00, 0x72, 0x65, 0x63,
+        0x69, 0x70, 0x72, 0x6f, 0x63, 0x61, 0x6c, 0x42, 0x75, 0x74, 0x74, 0x6f,
+        0x6e, 0x00, 0x31, 0x2f, 0x78, 0x00, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x42,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x00, 0x3d, 0x00, 0x64, 0x69, 0x73, 0x70,
+        0x6c, 0x61, 0x79, 0x00, 0x6d, 0x61, 0x78, 0x4c, 0x65, 0x6e, 0x67, 0x74,
+        0x68, 0x00, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74,
+        0x7c, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x54, 0x72, 0x61, 0x69, 0x6c, 0x69,
+        0x6e, 0x67, 0x7c, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x56, 0x43, 0x65, 0x6e,
+        0x74, 0x65, 0x72, 0x00, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e,
+        0x74, 0x00, 0x72, 0x65, 0x61, 0x64, 0x4f, 0x6e, 0x6c, 0x79, 0x00
+    };
+};
+
+namespace Ui {
+    class Calculator: public Ui_Calculator {};
+} // namespace Ui
+
+QT_END_NAMESPACE
+
+#endif // CALCULATOR_H
@@ -0,0 +1,89 @@
+/********************************************************************************
+** Form generated from reading UI file 'gridalignment.ui'
+**
+** Created by: Qt User Interface Compiler version 6.0.0
+**
+** WARNING! All changes made in this file will be lost when recompiling UI file!
+********************************************************************************/
+
+#ifndef GRIDALIGNMENT_H
+#define GRIDALIGNMENT_H
+
+#include <QtCore/QVariant>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QGridLayout>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QWidget>
+#include <QtWidgets/qtuichelpers.h>
+
+QT_BEGIN_NAMESPACE
+
+class Ui_Form
+{
+public:
+    QGridLayout *gridLayout;
+    QPushButton *pushButton;
+    QPushButton *pushButton_3;
+    QPushButton *pushButton_2;
+    QPushButton *pushButton_4;
+
+    void setupUi(QWidget *Form)
+    {
+        static const QtUicHelpers::ObjectFactory factories[] = {
+            [](QWidget *parent) -> QObject * { return new QGridLayout(parent); },
+            [](QWidget *parent) -> QObject * { return new QPushButton(parent); },
+        };
+        QObject *objects[6];
+        QtUicHelpers::setupUi(Form, qt_formData, factories, objects, nullptr);
+        gridLayout = static_cast<QGridLayout *>(objects[1]);
+        pushButton = static_cast<QPushButton *>(objects[2]);
+        pushButton_3 = static_cast<QPushButton *>(objects[3]);
+        pushButton_2 = static_cast<QPushButton *>(objects[4]);
+        pushButton_4 = static_cast<QPushButton *>(objects[5]);
+
+        QMetaObject::connectSlotsByName(Form);
+    } // setupUi
+
+    void retranslateUi(QWidget *Form)
+    {
+        QObject *const objects[] = {
+            Form, gridLayout, pushButton, pushButton_3, pushButton_2, pushButton_4
+        };
+        QtUicHelpers::retranslateUi(qt_formData, objects);
+    } // retranslateUi
+
+private:
+    static constexpr unsigned char qt_formData[] = {
+        0x01, 0x57, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01,
+        0x06, 0x00, 0xae, 0x04, 0xc6, 0x02, 0x01, 0x00, 0x01, 0x03, 0x01, 0x12,
+        0x01, 0x01, 0x01, 0x03, 0x02, 0x1d, 0x07, 0x01, 0x00, 0x02, 0x00, 0x00,
+        0x02, 0x02, 0x32, 0x01, 0x01, 0x01, 0x03, 0x03, 0x3c, 0x07, 0x01, 0x00,
+        0x03, 0x00, 0x02, 0x02, 0x02, 0x4d, 0x01, 0x01, 0x01, 0x03, 0x04, 0x56,
+        0x07, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x02, 0x69, 0x01, 0x01, 0x01,
+        0x03, 0x05, 0x74, 0x07, 0x01, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02, 0x88,
+        0x01, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01,
+        0x02, 0x28, 0x00, 0x2d, 0x00, 0x01, 0x03, 0x28, 0x00, 0x49, 0x00, 0x01,
+        0x04, 0x28, 0x00, 0x63, 0x00, 0x01, 0x05, 0x28, 0x00, 0x81, 0x01, 0x00,
+        0x00, 0x00, 0x46, 0x6f, 0x72, 0x6d, 0x00, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+        0x77, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x00, 0x67, 0x72, 0x69, 0x64, 0x4c,
+        0x61, 0x79, 0x6f, 0x75, 0x74, 0x00, 0x70, 0x75, 0x73, 0x68, 0x42, 0x75,
+        0x74, 0x74, 0x6f, 0x6e, 0x00, 0x74, 0x65, 0x78, 0x74, 0x00, 0x4c, 0x65,
+        0x66, 0x74, 0x00, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x4c, 0x65, 0x66, 0x74,
+        0x00, 0x70, 0x75, 0x73, 0x68, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x5f,
+        0x33, 0x00, 0x54, 0x6f, 0x70, 0x00, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x54,
+        0x6f, 0x70, 0x00, 0x70, 0x75, 0x73, 0x68, 0x42, 0x75, 0x74, 0x74, 0x6f,
+        0x6e, 0x5f, 0x32, 0x00, 0x52, 0x69, 0x67, 0x68, 0x74, 0x00, 0x41, 0x6c,
+        0x69, 0x67, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x00, 0x70, 0x75, 0x73,
+        0x68, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x5f, 0x34, 0x00, 0x42, 0x6f,
+        0x74, 0x74, 0x6f, 0x6d, 0x00, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x42, 0x6f,
+        0x74, 0x74, 0x6f, 0x6d, 0x00
+    };
+};
+
+namespace Ui {
+    class Form: public Ui_Form {};
+} // namespace Ui
+
+QT_END_NAMESPACE
+
+#endif // GRIDALIGNMENT_H
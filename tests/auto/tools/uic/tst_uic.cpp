@@ -90,6 +90,10 @@ private Q_SLOTS:
 
     void runCompare();
 
+    void formData();
+    void formData_data() const;
+    void formDataFallback();
+
 private:
     void populateTestEntries();
 
@@ -409,6 +413,79 @@ void tst_uic::runCompare()
     QCOMPARE(generatedFileContents, originalFileContents);
 }
 
+void tst_uic::formData_data() const
+{
+    QTest::addColumn<QString>("uiFile");
+
+    QTest::newRow("Dialog_without_Buttons") << QString::fromLatin1("Dialog_without_Buttons.ui");
+    QTest::newRow("calculator") << QString::fromLatin1("calculator.ui");
+    QTest::newRow("gridalignment") << QString::fromLatin1("gridalignment.ui");
+}
+
+void tst_uic::formData()
+{
+    QFETCH(QString, uiFile);
+
+    const QDir baseline(m_baseline);
+    const QString originalFile = baseline.filePath(QLatin1String("formdata/") + uiFile + QLatin1String(".h"));
+
+    QDir generated(m_generated.path());
+    generated.mkdir(QLatin1String("formdata"));
+    const QString generatedFile = generated.absoluteFilePath(QLatin1String("formdata/") + uiFile + QLatin1String(".h"));
+
+    QProcess process;
+    process.start(m_command, QStringList(baseline.filePath(uiFile))
+        << QString(QLatin1String("--form-data"))
+        << QString(QLatin1String("-o")) << generatedFile);
+    QVERIFY2(process.waitForStarted(), msgProcessStartFailed(m_command, process.errorString()));
+    QVERIFY(process.waitForFinished());
+    QCOMPARE(process.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(process.exitCode(), 0);
+    QVERIFY(process.readAllStandardError().isEmpty());
+
+    QFile orgFile(originalFile);
+    QFile genFile(generatedFile);
+    QVERIFY2(orgFile.open(QIODevice::ReadOnly | QIODevice::Text), msgCannotReadFile(orgFile));
+    QVERIFY2(genFile.open(QIODevice::ReadOnly | QIODevice::Text), msgCannotReadFile(genFile));
+
+    QString originalFileContents = orgFile.readAll();
+    originalFileContents.replace(m_versionRegexp, QString());
+
+    QString generatedFileContents = genFile.readAll();
+    generatedFileContents.replace(m_versionRegexp, QString());
+
+    if (generatedFileContents != originalFileContents) {
+        const QString diff = generateDiff(originalFile, generatedFile);
+        if (!diff.isEmpty())
+            outputDiff(diff);
+    }
+
+    QCOMPARE(generatedFileContents, originalFileContents);
+}
+
+// Forms using features the form data cannot express fall back to regular code.
+void tst_uic::formDataFallback()
+{
+    const QDir baseline(m_baseline);
+    QProcess process;
+    process.start(m_command, QStringList(baseline.filePath(QLatin1String("pixmapfunction.ui")))
+        << QString(QLatin1String("--form-data")));
+    QVERIFY2(process.waitForStarted(), msgProcessStartFailed(m_command, process.errorString()));
+    QVERIFY(process.waitForFinished());
+    QCOMPARE(process.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(process.exitCode(), 0);
+    QVERIFY(process.readAllStandardError().contains("generating code instead"));
+
+    QFile orgFile(baseline.filePath(QLatin1String("pixmapfunction.ui.h")));
+    QVERIFY2(orgFile.open(QIODevice::ReadOnly | QIODevice::Text), msgCannotReadFile(orgFile));
+    QString originalFileContents = orgFile.readAll();
+    originalFileContents.replace(m_versionRegexp, QString());
+    QString generatedFileContents = QString::fromLocal8Bit(process.readAllStandardOutput());
+    generatedFileContents.remove(QLatin1Char('\r'));
+    generatedFileContents.replace(m_versionRegexp, QString());
+    QCOMPARE(generatedFileContents, originalFileContents);
+}
+
 // Let uic generate Python code and verify that it is syntactically
 // correct by compiling it into .pyc. This test is executed only
 // when python with an installed Qt for Python is detected (see locatePython()).
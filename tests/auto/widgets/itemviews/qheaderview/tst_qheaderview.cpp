@@ -217,6 +217,7 @@ private slots:
     void QTBUG75615_sizeHintWithStylesheet();
     void ensureNoIndexAtLength();
     void offsetConsistent();
+    void sectionPositionConsistent();
 
     void initialSortOrderRole();
 
@@ -2616,6 +2617,41 @@ void tst_QHeaderView::offsetConsistent()
     QVERIFY(offset2 > offset1);
 }
 
+void tst_QHeaderView::sectionPositionConsistent()
+{
+    // Positions are recalculated lazily from the first changed section;
+    // interleave resizes, moves and lookups and compare against a full sum
+    QTableView qtv;
+    QStandardItemModel amodel(1000, 1);
+    qtv.setModel(&amodel);
+    QHeaderView *hv = qtv.verticalHeader();
+    const auto verifyPositions = [hv]() {
+        int pos = 0;
+        for (int visual = 0; visual < hv->count(); ++visual) {
+            const int logical = hv->logicalIndex(visual);
+            if (hv->sectionPosition(logical) != pos)
+                return false;
+            pos += hv->sectionSize(logical);
+        }
+        return pos == hv->length();
+    };
+
+    hv->resizeSection(990, 50);
+    QCOMPARE(hv->sectionPosition(995), hv->sectionPosition(990) + 50 + 4 * hv->sectionSize(991));
+    QVERIFY(verifyPositions());
+    hv->resizeSection(10, 40);
+    QCOMPARE(hv->sectionPosition(5), 5 * hv->sectionSize(0));
+    hv->resizeSection(500, 30);
+    QCOMPARE(hv->logicalIndexAt(hv->sectionPosition(500) + 29), 500);
+    QVERIFY(verifyPositions());
+    hv->moveSection(800, 20);
+    hv->hideSection(700);
+    amodel.insertRows(300, 5);
+    QVERIFY(verifyPositions());
+    amodel.removeRows(0, 3);
+    QVERIFY(verifyPositions());
+}
+
 void tst_QHeaderView::initialSortOrderRole()
 {
     QTableView view; // ### Shadowing member view (of type QHeaderView)
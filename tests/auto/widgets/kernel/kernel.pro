@@ -8,6 +8,7 @@ SUBDIRS=\
    qlayout \
    qstackedlayout \
    qtooltip \
+   qtuichelpers \
    qwidget \
    qwidget_window \
    qwidgetmetatype \
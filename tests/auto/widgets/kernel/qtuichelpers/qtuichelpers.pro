@@ -0,0 +1,8 @@
+CONFIG += testcase
+TARGET = tst_qtuichelpers
+
+QT += widgets testlib
+
+SOURCES += tst_qtuichelpers.cpp
+FORMS += formdatadialog.ui
+QMAKE_UIC_FLAGS += --form-data
@@ -0,0 +1,229 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <QtWidgets/qcheckbox.h>
+#include <QtWidgets/qdialog.h>
+#include <QtWidgets/qdialogbuttonbox.h>
+#include <QtWidgets/qgridlayout.h>
+#include <QtWidgets/qlabel.h>
+#include <QtWidgets/qlineedit.h>
+#include <QtWidgets/qpushbutton.h>
+#include <QtWidgets/qspinbox.h>
+#include <QtWidgets/qtabwidget.h>
+
+#include <QtCore/qtranslator.h>
+
+#include "ui_formdatadialog.h"
+
+class PrefixTranslator : public QTranslator
+{
+public:
+    QString translate(const char *context, const char *sourceText,
+                      const char *disambiguation, int n) const override
+    {
+        Q_UNUSED(n);
+        if (qstrcmp(context, "FormDataDialog") != 0)
+            return QString();
+        QString result = QLatin1String("tr:") + QString::fromUtf8(sourceText);
+        if (disambiguation)
+            result += QLatin1Char('|') + QString::fromUtf8(disambiguation);
+        return result;
+    }
+    bool isEmpty() const override { return false; }
+};
+
+class tst_QtUicHelpers : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void objects();
+    void properties();
+    void layouts();
+    void tabs();
+    void buddyAndTabOrder();
+    void connections();
+    void retranslate();
+    void keepsFormObjectName();
+
+private:
+    QDialog *m_dialog = nullptr;
+    Ui::FormDataDialog m_ui;
+};
+
+void tst_QtUicHelpers::init()
+{
+    m_dialog = new QDialog;
+    m_ui.setupUi(m_dialog);
+}
+
+void tst_QtUicHelpers::cleanup()
+{
+    delete m_dialog;
+    m_dialog = nullptr;
+}
+
+void tst_QtUicHelpers::objects()
+{
+    QCOMPARE(m_dialog->objectName(), QLatin1String("FormDataDialog"));
+    QVERIFY(m_ui.verticalLayout);
+    QCOMPARE(m_dialog->layout(), m_ui.verticalLayout);
+
+    const QList<QObject *> objects = {
+        m_ui.gridLayout, m_ui.nameLabel, m_ui.nameEdit, m_ui.enableCheckBox,
+        m_ui.countSpinBox, m_ui.line, m_ui.tabWidget, m_ui.firstTab,
+        m_ui.firstTabLayout, m_ui.pushButton, m_ui.secondTab, m_ui.buttonBox
+    };
+    const QStringList names = {
+        "gridLayout", "nameLabel", "nameEdit", "enableCheckBox", "countSpinBox",
+        "line", "tabWidget", "firstTab", "firstTabLayout", "pushButton",
+        "secondTab", "buttonBox"
+    };
+    for (int i = 0; i < objects.size(); ++i) {
+        QVERIFY2(objects.at(i), qPrintable(names.at(i)));
+        QCOMPARE(objects.at(i)->objectName(), names.at(i));
+    }
+
+    QCOMPARE(m_ui.nameLabel->parentWidget(), m_dialog);
+    QCOMPARE(m_ui.pushButton->parentWidget(), m_ui.firstTab);
+    QCOMPARE(m_ui.firstTab->layout(), m_ui.firstTabLayout);
+    QCOMPARE(m_ui.line->metaObject(), &QFrame::staticMetaObject);
+}
+
+void tst_QtUicHelpers::properties()
+{
+    QCOMPARE(m_dialog->size(), QSize(320, 240));
+    QCOMPARE(m_dialog->property("formDataTag").toString(), QLatin1String("tagged"));
+
+    QCOMPARE(m_ui.nameLabel->sizePolicy().horizontalPolicy(), QSizePolicy::Fixed);
+    QCOMPARE(m_ui.nameLabel->sizePolicy().verticalPolicy(), QSizePolicy::Preferred);
+    QCOMPARE(m_ui.nameEdit->maxLength(), 20);
+    QCOMPARE(m_ui.nameEdit->placeholderText(), QLatin1String("name"));
+    QVERIFY(m_ui.enableCheckBox->isChecked());
+    QVERIFY(m_ui.enableCheckBox->font().bold());
+    QCOMPARE(m_ui.countSpinBox->alignment(),
+             Qt::AlignRight | Qt::AlignTrailing | Qt::AlignVCenter);
+    QCOMPARE(m_ui.countSpinBox->maximum(), 50);
+    QCOMPARE(m_ui.countSpinBox->value(), 42);
+    QCOMPARE(m_ui.line->frameShape(), QFrame::HLine);
+    QCOMPARE(m_ui.line->frameShadow(), QFrame::Sunken);
+    QCOMPARE(m_ui.buttonBox->standardButtons(),
+             QDialogButtonBox::Cancel | QDialogButtonBox::Ok);
+    QCOMPARE(m_ui.pushButton->text(), QLatin1String("Push"));
+}
+
+void tst_QtUicHelpers::layouts()
+{
+    QCOMPARE(m_ui.verticalLayout->count(), 4);
+    QCOMPARE(m_ui.verticalLayout->itemAt(0)->layout(), m_ui.gridLayout);
+    QCOMPARE(m_ui.verticalLayout->itemAt(1)->widget(), m_ui.line);
+    QCOMPARE(m_ui.verticalLayout->itemAt(3)->widget(), m_ui.buttonBox);
+
+    QCOMPARE(m_ui.gridLayout->horizontalSpacing(), 11);
+    QCOMPARE(m_ui.gridLayout->columnStretch(0), 0);
+    QCOMPARE(m_ui.gridLayout->columnStretch(1), 1);
+    QCOMPARE(m_ui.gridLayout->itemAtPosition(0, 0)->widget(), m_ui.nameLabel);
+    QCOMPARE(m_ui.gridLayout->itemAtPosition(0, 1)->widget(), m_ui.nameEdit);
+    QCOMPARE(m_ui.gridLayout->itemAtPosition(1, 1)->widget(), m_ui.enableCheckBox);
+    QLayoutItem *spinBoxItem = m_ui.gridLayout->itemAtPosition(2, 1);
+    QCOMPARE(spinBoxItem->widget(), m_ui.countSpinBox);
+    QCOMPARE(spinBoxItem->alignment(), Qt::AlignRight);
+
+    QCOMPARE(m_ui.firstTabLayout->count(), 2);
+    QCOMPARE(m_ui.firstTabLayout->itemAt(0)->widget(), m_ui.pushButton);
+    QCOMPARE(m_ui.firstTabLayout->itemAt(1)->spacerItem(), m_ui.verticalSpacer);
+    QCOMPARE(m_ui.verticalSpacer->sizeHint(), QSize(20, 40));
+    QCOMPARE(m_ui.verticalSpacer->sizePolicy().verticalPolicy(), QSizePolicy::Expanding);
+}
+
+void tst_QtUicHelpers::tabs()
+{
+    QCOMPARE(m_ui.tabWidget->count(), 2);
+    QCOMPARE(m_ui.tabWidget->widget(0), m_ui.firstTab);
+    QCOMPARE(m_ui.tabWidget->widget(1), m_ui.secondTab);
+    QCOMPARE(m_ui.tabWidget->tabText(0), QLatin1String("First"));
+    QCOMPARE(m_ui.tabWidget->tabText(1), QLatin1String("Second"));
+#if QT_CONFIG(tooltip)
+    QCOMPARE(m_ui.tabWidget->tabToolTip(0), QLatin1String("first tab"));
+#endif
+    QCOMPARE(m_ui.tabWidget->currentIndex(), 1);
+}
+
+void tst_QtUicHelpers::buddyAndTabOrder()
+{
+#if QT_CONFIG(shortcut)
+    QCOMPARE(m_ui.nameLabel->buddy(), m_ui.nameEdit);
+#endif
+    QCOMPARE(m_ui.countSpinBox->nextInFocusChain(), m_ui.nameEdit);
+}
+
+void tst_QtUicHelpers::connections()
+{
+    m_ui.buttonBox->button(QDialogButtonBox::Ok)->click();
+    QCOMPARE(m_dialog->result(), int(QDialog::Accepted));
+    m_ui.buttonBox->button(QDialogButtonBox::Cancel)->click();
+    QCOMPARE(m_dialog->result(), int(QDialog::Rejected));
+}
+
+void tst_QtUicHelpers::retranslate()
+{
+    QCOMPARE(m_dialog->windowTitle(), QLatin1String("Form Data"));
+    QCOMPARE(m_ui.nameLabel->text(), QLatin1String("&Name:"));
+
+    PrefixTranslator translator;
+    QCoreApplication::installTranslator(&translator);
+    m_ui.retranslateUi(m_dialog);
+    QCoreApplication::removeTranslator(&translator);
+
+    QCOMPARE(m_dialog->windowTitle(), QLatin1String("tr:Form Data"));
+    QCOMPARE(m_ui.nameLabel->text(), QLatin1String("tr:&Name:|label"));
+    QCOMPARE(m_ui.enableCheckBox->text(), QLatin1String("tr:Enable"));
+    QCOMPARE(m_ui.tabWidget->tabText(0), QLatin1String("tr:First"));
+    QCOMPARE(m_ui.tabWidget->tabText(1), QLatin1String("tr:Second"));
+    // notr strings are left alone
+    QCOMPARE(m_ui.pushButton->text(), QLatin1String("Push"));
+    QCOMPARE(m_ui.nameEdit->placeholderText(), QLatin1String("name"));
+}
+
+void tst_QtUicHelpers::keepsFormObjectName()
+{
+    QDialog dialog;
+    dialog.setObjectName(QLatin1String("custom"));
+    Ui::FormDataDialog ui;
+    ui.setupUi(&dialog);
+    QCOMPARE(dialog.objectName(), QLatin1String("custom"));
+    QCOMPARE(ui.nameEdit->objectName(), QLatin1String("nameEdit"));
+}
+
+QTEST_MAIN(tst_QtUicHelpers)
+#include "tst_qtuichelpers.moc"
@@ -129,6 +129,7 @@ private slots:
 
     void dynamicSortOrder();
     void disabledItems();
+    void unsortedEngineUpdates();
 
     // task-specific tests below me
     void task178797_activatedOnReturn();
@@ -1170,6 +1171,41 @@ void tst_QCompleter::disabledItems()
     QVERIFY(!view->isVisible());
 }
 
+void tst_QCompleter::unsortedEngineUpdates()
+{
+    QStringList list;
+    for (int i = 0; i < 1000; ++i)
+        list << QString::fromLatin1("item%1").arg(999 - i, 3, 10, QLatin1Char('0'));
+    QStringListModel model(list);
+    QCompleter completer(&model);
+    completer.setCaseSensitivity(Qt::CaseInsensitive);
+
+    completer.setCompletionPrefix("ITEM12");
+    QCOMPARE(completer.completionCount(), 10);
+    QCOMPARE(completer.currentCompletion(), QLatin1String("item129"));
+
+    model.insertRows(0, 2);
+    model.setData(model.index(0), "item12x");
+    model.setData(model.index(1), "other");
+    QCOMPARE(completer.completionCount(), 11);
+    QCOMPARE(completer.currentCompletion(), QLatin1String("item12x"));
+
+    model.setData(model.index(0), "other");
+    QCOMPARE(completer.completionCount(), 10);
+    model.setData(model.index(1), "Item120");
+    QCOMPARE(completer.completionCount(), 11);
+    QCOMPARE(completer.currentCompletion(), QLatin1String("Item120"));
+
+    completer.setCompletionPrefix("item120");
+    QCOMPARE(completer.completionCount(), 2);
+    QVERIFY(completer.setCurrentRow(1));
+    QCOMPARE(completer.currentCompletion(), QLatin1String("item120"));
+
+    completer.setFilterMode(Qt::MatchContains);
+    completer.setCompletionPrefix("M12");
+    QCOMPARE(completer.completionCount(), 11);
+}
+
 void tst_QCompleter::task178797_activatedOnReturn()
 {
     if (QGuiApplication::platformName().startsWith(QLatin1String("wayland"), Qt::CaseInsensitive))
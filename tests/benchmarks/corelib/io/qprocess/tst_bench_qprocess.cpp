@@ -37,6 +37,15 @@ class tst_QProcess : public QObject
 private slots:
 
     void echoTest_performance();
+    void startAndWait_data();
+    void startAndWait();
+};
+
+class ForkingProcess : public QProcess
+{
+protected:
+    // overriding this makes QProcess use a real fork()
+    void setupChildProcess() override {}
 };
 
 void tst_QProcess::echoTest_performance()
@@ -84,5 +93,34 @@ void tst_QProcess::echoTest_performance()
     QVERIFY(process.waitForFinished());
 }
 
+void tst_QProcess::startAndWait_data()
+{
+    QTest::addColumn<bool>("forceFork");
+    QTest::addColumn<int>("residentMB");
+
+    QTest::newRow("plain") << false << 0;
+    QTest::newRow("plain-256MB") << false << 256;
+    QTest::newRow("fork") << true << 0;
+    QTest::newRow("fork-256MB") << true << 256;
+}
+
+void tst_QProcess::startAndWait()
+{
+    QFETCH(bool, forceFork);
+    QFETCH(int, residentMB);
+
+    // touch every page so the child has a sizeable address space to copy
+    QByteArray ballast(residentMB * 1024 * 1024, 'x');
+    Q_UNUSED(ballast);
+
+    QBENCHMARK {
+        QScopedPointer<QProcess> process(forceFork ? new ForkingProcess : new QProcess);
+        process->start("testProcessLoopback/testProcessLoopback");
+        QVERIFY2(process->waitForStarted(), qPrintable(process->errorString()));
+        process->closeWriteChannel();
+        QVERIFY(process->waitForFinished());
+    }
+}
+
 QTEST_MAIN(tst_QProcess)
 #include "tst_bench_qprocess.moc"
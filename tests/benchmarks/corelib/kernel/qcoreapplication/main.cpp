@@ -35,6 +35,24 @@ Q_OBJECT
 private slots:
     void event_posting_benchmark_data();
     void event_posting_benchmark();
+    void queued_connection_throughput_data();
+    void queued_connection_throughput();
+};
+
+class Producer : public QObject
+{
+Q_OBJECT
+signals:
+    void valueChanged(int value);
+};
+
+class Consumer : public QObject
+{
+Q_OBJECT
+public slots:
+    void onValueChanged(int) { ++count; }
+public:
+    int count = 0;
 };
 
 void QCoreApplicationBenchmark::event_posting_benchmark_data()
@@ -64,6 +82,48 @@ void QCoreApplicationBenchmark::event_posting_benchmark()
     }
 }
 
+void QCoreApplicationBenchmark::queued_connection_throughput_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<int>("size");
+    QTest::newRow("1 thread, 100000 signals") << 1 << 100000;
+    QTest::newRow("2 threads, 50000 signals") << 2 << 50000;
+    QTest::newRow("4 threads, 25000 signals") << 4 << 25000;
+    QTest::newRow("8 threads, 12500 signals") << 8 << 12500;
+    QTest::newRow("16 threads, 6250 signals") << 16 << 6250;
+}
+
+void QCoreApplicationBenchmark::queued_connection_throughput()
+{
+    QFETCH(int, threadCount);
+    QFETCH(int, size);
+
+    Producer producer;
+    Consumer consumer;
+    connect(&producer, &Producer::valueChanged, &consumer, &Consumer::onValueChanged,
+            Qt::QueuedConnection);
+
+    // benchmark emitting queued signals from several threads at once and
+    // delivering them in the receiver's thread
+    QBENCHMARK {
+        consumer.count = 0;
+        QList<QThread *> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads << QThread::create([&producer, size]() {
+                for (int i = 0; i < size; ++i)
+                    emit producer.valueChanged(i);
+            });
+        }
+        for (QThread *thread : qAsConst(threads))
+            thread->start();
+        for (QThread *thread : qAsConst(threads))
+            thread->wait();
+        QCoreApplication::sendPostedEvents(&consumer, QEvent::MetaCall);
+        qDeleteAll(threads);
+        QCOMPARE(consumer.count, threadCount * size);
+    }
+}
+
 QTEST_MAIN(QCoreApplicationBenchmark)
 
 #include "main.moc"
@@ -85,6 +85,11 @@ private slots:
     void createCoreType();
     void createCoreTypeCopy_data();
     void createCoreTypeCopy();
+
+    void doubleVariantList();
+    void doubleVariantArray();
+    void rectFVariantList();
+    void rectFVariantArray();
 };
 
 struct BigClass
@@ -373,6 +378,72 @@ void tst_qvariant::createCoreTypeCopy()
     }
 }
 
+// Compares passing a batch of values through a QVariant as a
+// QVariantList, which boxes each element separately, with passing it as
+// a QVariantArray, which stores the elements unboxed in one block.
+static const int BatchSize = 1000;
+
+static double makeDouble(int i) { return i * 0.5; }
+static QRectF makeRectF(int i) { return QRectF(i, i, 10, 10); }
+static double accumulate(double sum, double value) { return sum + value; }
+static QRectF accumulate(const QRectF &sum, const QRectF &value) { return sum.united(value); }
+
+template <typename T>
+static void variantListBatch(T (*make)(int))
+{
+    QBENCHMARK {
+        QVariantList list;
+        list.reserve(BatchSize);
+        for (int i = 0; i < BatchSize; ++i)
+            list.append(QVariant::fromValue(make(i)));
+        const QVariant v(list);
+
+        T sum = T();
+        for (const QVariant &e : v.toList())
+            sum = accumulate(sum, e.value<T>());
+        Q_UNUSED(sum);
+    }
+}
+
+template <typename T>
+static void variantArrayBatch(T (*make)(int))
+{
+    QBENCHMARK {
+        QVariantArray array(QMetaType::fromType<T>());
+        array.reserve(BatchSize);
+        for (int i = 0; i < BatchSize; ++i)
+            array.append(make(i));
+        const QVariant v = QVariant::fromValue(array);
+
+        const QVariantArray values = v.value<QVariantArray>();
+        const T *p = values.constData<T>();
+        T sum = T();
+        for (qsizetype i = 0; i < values.size(); ++i)
+            sum = accumulate(sum, p[i]);
+        Q_UNUSED(sum);
+    }
+}
+
+void tst_qvariant::doubleVariantList()
+{
+    variantListBatch(makeDouble);
+}
+
+void tst_qvariant::doubleVariantArray()
+{
+    variantArrayBatch(makeDouble);
+}
+
+void tst_qvariant::rectFVariantList()
+{
+    variantListBatch(makeRectF);
+}
+
+void tst_qvariant::rectFVariantArray()
+{
+    variantArrayBatch(makeRectF);
+}
+
 QTEST_MAIN(tst_qvariant)
 
 #include "tst_qvariant.moc"
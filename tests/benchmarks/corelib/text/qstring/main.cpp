@@ -48,6 +48,15 @@ private slots:
     void toCaseFolded_data();
     void toCaseFolded();
 
+    void indexOfChar_data();
+    void indexOfChar();
+    void indexOfString_data();
+    void indexOfString();
+    void countChar_data() { indexOfChar_data(); }
+    void countChar();
+    void split_data() { indexOfChar_data(); }
+    void split();
+
 private:
     void section_data_impl(bool includeRegExOnly = true);
     template <typename RX> void section_impl();
@@ -187,6 +196,74 @@ void tst_QString::toCaseFolded()
     }
 }
 
+void tst_QString::indexOfChar_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::addColumn<QChar>("c");
+
+    QString line = QString(40, u'x') + u',';
+    QTest::newRow("short, found") << QStringLiteral("key,value") << QChar(u',');
+    QTest::newRow("41 chars, separated") << line.repeated(1000) << QChar(u',');
+    QTest::newRow("41000 chars, not found") << line.repeated(1000) << QChar(u';');
+    QTest::newRow("1M chars, rare") << (QString(1 << 20, u'x') + u';') << QChar(u';');
+}
+
+void tst_QString::indexOfChar()
+{
+    QFETCH(QString, s);
+    QFETCH(QChar, c);
+
+    QBENCHMARK {
+        qsizetype from = 0;
+        while ((from = s.indexOf(c, from)) != -1)
+            ++from;
+    }
+}
+
+void tst_QString::indexOfString_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::addColumn<QString>("needle");
+
+    const QString haystack = QStringLiteral("the quick brown fox jumps over the lazy dog ").repeated(1000);
+    QTest::newRow("2 chars") << haystack << QStringLiteral("og");
+    QTest::newRow("5 chars") << haystack << QStringLiteral("lazy ");
+    QTest::newRow("12 chars") << haystack << QStringLiteral("jumps over t");
+    QTest::newRow("not found") << haystack << QStringLiteral("quick fox");
+}
+
+void tst_QString::indexOfString()
+{
+    QFETCH(QString, s);
+    QFETCH(QString, needle);
+
+    QBENCHMARK {
+        qsizetype from = 0;
+        while ((from = s.indexOf(needle, from)) != -1)
+            ++from;
+    }
+}
+
+void tst_QString::countChar()
+{
+    QFETCH(QString, s);
+    QFETCH(QChar, c);
+
+    QBENCHMARK {
+        s.count(c);
+    }
+}
+
+void tst_QString::split()
+{
+    QFETCH(QString, s);
+    QFETCH(QChar, c);
+
+    QBENCHMARK {
+        s.split(c);
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_QString)
 
 #include "main.moc"
@@ -80,6 +80,14 @@ struct FunctionPtrHolder
 };
 Q_DECLARE_METATYPE(FunctionPtrHolder)
 
+struct DistributedReadWriteLock : QReadWriteLock
+{
+    DistributedReadWriteLock()
+        : QReadWriteLock(QReadWriteLock::NonRecursive, QReadWriteLock::DistributedReaders)
+    {
+    }
+};
+
 struct FakeLock
 {
     FakeLock(volatile int *i) { *i = 0; }
@@ -108,6 +116,10 @@ void tst_QReadWriteLock::uncontended_data()
         << FunctionPtrHolder(testUncontended<QReadWriteLock, QReadLocker>);
     QTest::newRow("QReadWriteLock, write")
         << FunctionPtrHolder(testUncontended<QReadWriteLock, QWriteLocker>);
+    QTest::newRow("QReadWriteLock distributed, read")
+        << FunctionPtrHolder(testUncontended<DistributedReadWriteLock, QReadLocker>);
+    QTest::newRow("QReadWriteLock distributed, write")
+        << FunctionPtrHolder(testUncontended<DistributedReadWriteLock, QWriteLocker>);
     QTest::newRow("std::mutex") << FunctionPtrHolder(
         testUncontended<std::mutex, LockerWrapper<std::unique_lock<std::mutex>>>);
 #ifdef __cpp_lib_shared_mutex
@@ -175,6 +187,8 @@ void tst_QReadWriteLock::readOnly_data()
     QTest::newRow("nothing") << FunctionPtrHolder(testReadOnly<int, FakeLock>);
     QTest::newRow("QMutex") << FunctionPtrHolder(testReadOnly<QMutex, QMutexLocker>);
     QTest::newRow("QReadWriteLock") << FunctionPtrHolder(testReadOnly<QReadWriteLock, QReadLocker>);
+    QTest::newRow("QReadWriteLock distributed")
+        << FunctionPtrHolder(testReadOnly<DistributedReadWriteLock, QReadLocker>);
     QTest::newRow("std::mutex") << FunctionPtrHolder(
         testReadOnly<std::mutex, LockerWrapper<std::unique_lock<std::mutex>>>);
 #ifdef __cpp_lib_shared_mutex
@@ -236,6 +250,8 @@ void tst_QReadWriteLock::writeOnly_data()
     // QTest::newRow("nothing") << FunctionPtrHolder(testWriteOnly<int, FakeLock>);
     QTest::newRow("QMutex") << FunctionPtrHolder(testWriteOnly<QMutex, QMutexLocker>);
     QTest::newRow("QReadWriteLock") << FunctionPtrHolder(testWriteOnly<QReadWriteLock, QWriteLocker>);
+    QTest::newRow("QReadWriteLock distributed")
+        << FunctionPtrHolder(testWriteOnly<DistributedReadWriteLock, QWriteLocker>);
     QTest::newRow("std::mutex") << FunctionPtrHolder(
         testWriteOnly<std::mutex, LockerWrapper<std::unique_lock<std::mutex>>>);
 #ifdef __cpp_lib_shared_mutex
@@ -170,6 +170,8 @@ private slots:
 
     void compositionModes_data();
     void compositionModes();
+    void compositionModesWithOpacity_data() { compositionModes_data(); }
+    void compositionModesWithOpacity();
 
     void fillPrimitives_10_data() { drawPrimitives_data_helper(false); }
     void fillPrimitives_100_data() { drawPrimitives_data_helper(false); }
@@ -831,6 +833,29 @@ void tst_QPainter::compositionModes()
     }
 }
 
+void tst_QPainter::compositionModesWithOpacity()
+{
+    QFETCH(QPainter::CompositionMode, mode);
+    QFETCH(QSize, size);
+    QFETCH(QColor, color);
+
+    QPixmap src = rasterPixmap(size);
+    src.fill(color);
+
+    QPixmap dest = rasterPixmap(size);
+    if (mode < QPainter::RasterOp_SourceOrDestination)
+        color.setAlpha(127); // porter-duff needs an alpha channel
+    dest.fill(color);
+
+    QPainter p(&dest);
+    p.setCompositionMode(mode);
+    p.setOpacity(0.5);
+
+    QBENCHMARK {
+        p.drawPixmap(0, 0, src);
+    }
+}
+
 void tst_QPainter::drawTiledPixmap_data()
 {
     QTest::addColumn<QSize>("srcSize");
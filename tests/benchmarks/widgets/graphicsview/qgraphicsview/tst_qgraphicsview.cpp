@@ -118,6 +118,8 @@ private slots:
     void paintSingleItem();
     void paintDeepStackingItems();
     void paintDeepStackingItems_clipped();
+    void paintManyItems_data();
+    void paintManyItems();
     void moveSingleItem();
     void mapPointToScene_data();
     void mapPointToScene();
@@ -249,6 +251,43 @@ void tst_QGraphicsView::paintDeepStackingItems_clipped()
     }
 }
 
+void tst_QGraphicsView::paintManyItems_data()
+{
+    QTest::addColumn<int>("cacheMode");
+    QTest::addColumn<bool>("savePainterState");
+    QTest::newRow("No Cache") << int(QGraphicsItem::NoCache) << true;
+    QTest::newRow("No Cache, DontSavePainterState") << int(QGraphicsItem::NoCache) << false;
+    QTest::newRow("ItemCoordinate Cache") << int(QGraphicsItem::ItemCoordinateCache) << true;
+    QTest::newRow("DeviceCoordinate Cache") << int(QGraphicsItem::DeviceCoordinateCache) << true;
+}
+
+void tst_QGraphicsView::paintManyItems()
+{
+    QFETCH(int, cacheMode);
+    QFETCH(bool, savePainterState);
+
+    QGraphicsScene scene(0, 0, 400, 400);
+    for (int y = 0; y < 400; y += 8) {
+        for (int x = 0; x < 400; x += 8) {
+            QGraphicsRectItem *item = scene.addRect(0, 0, 6, 6, QPen(Qt::black), QBrush(Qt::green));
+            item->setPos(x, y);
+            item->setCacheMode(QGraphicsItem::CacheMode(cacheMode));
+        }
+    }
+
+    mView.setOptimizationFlag(QGraphicsView::DontSavePainterState, !savePainterState);
+    mView.setScene(&scene);
+    mView.tryResize(400, 400);
+    processEvents();
+
+    QImage image(400, 400, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    QBENCHMARK {
+        mView.viewport()->render(&painter);
+    }
+    mView.setOptimizationFlag(QGraphicsView::DontSavePainterState, false);
+}
+
 void tst_QGraphicsView::moveSingleItem()
 {
     QGraphicsScene scene(0, 0, 100, 100);